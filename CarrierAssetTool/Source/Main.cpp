@@ -0,0 +1,337 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Builds the carrier library from .wav files: Source/WaveTable.cpp with every
+    table as a CarrierCodec stream, Source/WaveTableSize.h with their count, and
+    optionally a .carrier file per table and host rate holding the table at that
+    rate with its precomputed spectra, to be linked into the plugin as binary
+    resources.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include "../../Source/WaveTable.h"
+#include "../../Source/Carrier/CarrierAsset.h"
+#include "../../Source/Carrier/CarrierCodec.h"
+#include "../../Source/Carrier/CarrierRegistry.h"
+#include "../../Source/Carrier/CarrierResampler.h"
+
+namespace
+{
+    const char* const usage =
+        "usage: CarrierAssetTool --out <dir> [--assets <dir>] [--rates 44100,48000] [--frame 1024] [--shift 1024]\n"
+        "                        [--storage half|float|double] [--no-whiten]\n"
+        "                        --carrier <identifier> <display name> <file.wav> [--carrier ...]\n"
+        "\n"
+        "Writes <dir>/WaveTable.cpp, <dir>/WaveTableSize.h and, for every rate in --rates,\n"
+        "<identifier>_<rate>.carrier in the --assets directory (--out if not given).\n"
+        "The STFT layout, storage and whitening must match the plugin's for the spectra to be used.\n";
+
+    struct CarrierSource
+    {
+        juce::String identifier;
+        juce::String displayName;
+        juce::File file;
+    };
+
+    struct Options
+    {
+        juce::File outputDirectory;
+        juce::File assetDirectory;
+        juce::Array<double> rates;
+        // the plugin's STFT layout (MyUtils), cache storage and whitening
+        int frame = 1024;
+        int shift = 1024;
+        DSP::CarrierSpectrumCache::Storage storage = DSP::CarrierSpectrumCache::Storage::Float;
+        bool whiten = true;
+        std::vector<CarrierSource> carriers;
+    };
+
+    bool parseArguments(const juce::StringArray& args, Options& options, juce::String& error)
+    {
+        const auto workingDirectory = juce::File::getCurrentWorkingDirectory();
+        for (int i = 0; i < args.size(); ++i)
+        {
+            const auto& arg = args[i];
+            const auto valuesLeft = args.size() - i - 1;
+            if (arg == "--out" && valuesLeft >= 1)
+            {
+                options.outputDirectory = workingDirectory.getChildFile(args[++i]);
+            }
+            else if (arg == "--assets" && valuesLeft >= 1)
+            {
+                options.assetDirectory = workingDirectory.getChildFile(args[++i]);
+            }
+            else if (arg == "--rates" && valuesLeft >= 1)
+            {
+                for (const auto& rate : juce::StringArray::fromTokens(args[++i], ",", ""))
+                    options.rates.addIfNotAlreadyThere(rate.getDoubleValue());
+            }
+            else if (arg == "--frame" && valuesLeft >= 1)
+            {
+                options.frame = args[++i].getIntValue();
+            }
+            else if (arg == "--shift" && valuesLeft >= 1)
+            {
+                options.shift = args[++i].getIntValue();
+            }
+            else if (arg == "--storage" && valuesLeft >= 1)
+            {
+                const auto storage = args[++i];
+                if (storage == "half")
+                    options.storage = DSP::CarrierSpectrumCache::Storage::Half;
+                else if (storage == "float")
+                    options.storage = DSP::CarrierSpectrumCache::Storage::Float;
+                else if (storage == "double")
+                    options.storage = DSP::CarrierSpectrumCache::Storage::Double;
+                else
+                {
+                    error = "unknown storage " + storage;
+                    return false;
+                }
+            }
+            else if (arg == "--no-whiten")
+            {
+                options.whiten = false;
+            }
+            else if (arg == "--carrier" && valuesLeft >= 3)
+            {
+                CarrierSource source { args[i + 1], args[i + 2], workingDirectory.getChildFile(args[i + 3]) };
+                i += 3;
+                if (! source.identifier.containsOnly("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_")
+                    || source.identifier.isEmpty() || juce::CharacterFunctions::isDigit(source.identifier[0]))
+                {
+                    error = "carrier identifier " + source.identifier + " is not a C++ identifier";
+                    return false;
+                }
+                options.carriers.push_back(source);
+            }
+            else
+            {
+                error = "unexpected argument " + arg;
+                return false;
+            }
+        }
+
+        if (options.outputDirectory == juce::File() || options.carriers.empty())
+            error = "--out and at least one --carrier are needed";
+        else if (options.frame <= 0 || options.shift <= 0 || options.shift > options.frame)
+            error = "bad --frame or --shift";
+        for (const auto rate : options.rates)
+            if (! (rate > 0.0))
+                error = "bad rate in --rates";
+        if (options.assetDirectory == juce::File())
+            options.assetDirectory = options.outputDirectory;
+        return error.isEmpty();
+    }
+
+    /** The whole file mixed down to mono, as the plugin does with a dropped file. */
+    bool readMono(const juce::File& file, std::vector<float>& mono, double& sampleRate, juce::String& error)
+    {
+        juce::AudioFormatManager formats;
+        formats.registerBasicFormats();
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+        if (reader == nullptr)
+        {
+            error = "cannot read " + file.getFullPathName();
+            return false;
+        }
+        if (reader->lengthInSamples < 2 || reader->lengthInSamples > std::numeric_limits<int>::max())
+        {
+            error = file.getFileName() + " is empty or too long";
+            return false;
+        }
+
+        const auto length = (int)reader->lengthInSamples;
+        juce::AudioBuffer<float> decoded((int)reader->numChannels, length);
+        reader->read(&decoded, 0, length, 0, true, true);
+        mono.assign((size_t)length, 0.0f);
+        for (int channel = 0; channel < decoded.getNumChannels(); ++channel)
+        {
+            juce::FloatVectorOperations::addWithMultiply(mono.data(), decoded.getReadPointer(channel),
+                                                         1.0f / decoded.getNumChannels(), length);
+        }
+        sampleRate = reader->sampleRate;
+        return true;
+    }
+
+    bool writeFile(const juce::File& file, const void* data, size_t size)
+    {
+        if (! file.replaceWithData(data, size))
+        {
+            std::cerr << "cannot write " << file.getFullPathName() << std::endl;
+            return false;
+        }
+        std::cout << "wrote " << file.getFullPathName() << " (" << size << " bytes)" << std::endl;
+        return true;
+    }
+
+    /** The table and its spectra at every requested rate, resampled exactly as the
+        registry would resample the decoded table, so the plugin plays the same carrier
+        whether or not the files are linked. */
+    bool writeAssets(const Options& options, const CarrierSource& source, const std::vector<float>& table)
+    {
+        const auto tableRate = WaveTable::AllWaveTable::tableSampleRate;
+        const auto length = (int)table.size();
+        for (const auto rate : options.rates)
+        {
+            const auto playedLength = DSP::CarrierRegistry::getPlayedLength(length, tableRate, rate);
+            const auto played = rate == tableRate ? table : DSP::CarrierResampler().process(table.data(), length, playedLength);
+            const DSP::CarrierSpectrumCache cache(played.data(), playedLength, options.frame, options.shift,
+                                                  options.storage, options.whiten);
+            const auto asset = DSP::CarrierAsset::write(played.data(), playedLength, rate, 0, playedLength,
+                                                        DSP::CarrierAsset::SampleFormat::Float32, &cache);
+            const auto name = source.identifier + "_" + juce::String(juce::roundToInt(rate)) + ".carrier";
+            if (! writeFile(options.assetDirectory.getChildFile(name), asset.data(), asset.size()))
+                return false;
+        }
+        return true;
+    }
+
+    /** The bytes of one stream as WaveTable.cpp lays them out, 40 to a line. */
+    void appendStream(juce::String& source, const juce::String& identifier, const std::vector<uint8_t>& stream)
+    {
+        source << "        const uint8_t " << identifier << "[] = {";
+        for (size_t i = 0; i < stream.size(); ++i)
+        {
+            if (i % 40 == 0)
+                source << "\n";
+            source << (int)stream[i] << ",";
+        }
+        source << "\n        };\n";
+    }
+
+    juce::String makeWaveTableSource(const Options& options, const std::vector<std::vector<uint8_t>>& streams)
+    {
+        juce::String source;
+        source << "/*\n"
+                  "  ==============================================================================\n"
+                  "\n"
+                  "    WaveTable.cpp\n"
+                  "    Written by CarrierAssetTool, edit the tool's command line rather than this file.\n"
+                  "\n"
+                  "  ==============================================================================\n"
+                  "*/\n"
+                  "\n"
+                  "#include \"WaveTable.h\"\n"
+                  "\n"
+                  "namespace WaveTable\n"
+                  "{\n"
+                  "    // CarrierCodec streams; only this file pays to compile them\n"
+                  "    namespace\n"
+                  "    {\n";
+        for (size_t i = 0; i < streams.size(); ++i)
+        {
+            if (i > 0)
+                source << "\n";
+            appendStream(source, options.carriers[i].identifier, streams[i]);
+        }
+        source << "    }\n"
+                  "\n"
+                  "    const std::array<AllWaveTable::Carrier, AllWaveTable::numCarriers> AllWaveTable::carriers{ {\n";
+        for (size_t i = 0; i < streams.size(); ++i)
+        {
+            const auto& carrier = options.carriers[i];
+            source << "        { \"" << carrier.displayName.replace("\\", "\\\\").replace("\"", "\\\"") << "\", \""
+                   << carrier.identifier << "\", " << carrier.identifier << ", sizeof(" << carrier.identifier
+                   << "), tableSampleRate }" << (i + 1 < streams.size() ? ",\n" : "\n");
+        }
+        source << "    } };\n"
+                  "\n"
+                  "    static_assert(AllWaveTable::numCarriers == " << (int)streams.size() << ", "
+                  "\"WaveTable.cpp and WaveTableSize.h are from different CarrierAssetTool runs\");\n"
+                  "}\n";
+        return source;
+    }
+
+    /** The carrier count for WaveTable.h, written with WaveTable.cpp so the two always agree. */
+    juce::String makeWaveTableSizeHeader(int numCarriers)
+    {
+        juce::String source;
+        source << "/*\n"
+                  "  ==============================================================================\n"
+                  "\n"
+                  "    WaveTableSize.h\n"
+                  "    Written by CarrierAssetTool with WaveTable.cpp, edit the tool's command line rather than this file.\n"
+                  "\n"
+                  "  ==============================================================================\n"
+                  "*/\n"
+                  "\n"
+                  "#pragma once\n"
+                  "\n"
+                  "namespace WaveTable\n"
+                  "{\n"
+                  "    /** The number of carriers defined in WaveTable.cpp. */\n"
+                  "    enum { generatedNumCarriers = " << numCarriers << " };\n"
+                  "}\n";
+        return source;
+    }
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    Options options;
+    juce::String error;
+    if (! parseArguments(args, options, error))
+    {
+        std::cerr << error << "\n\n" << usage;
+        return 1;
+    }
+    for (const auto& directory : { options.outputDirectory, options.assetDirectory })
+    {
+        if (! directory.createDirectory())
+        {
+            std::cerr << "cannot create " << directory.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> streams;
+    for (const auto& carrier : options.carriers)
+    {
+        std::vector<float> samples;
+        double sampleRate = 0.0;
+        if (! readMono(carrier.file, samples, sampleRate, error))
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+
+        // every table is stored at one rate, which the plugin resamples from to the host's;
+        // keep its length exact here so the registry's rounding is only applied once, when played
+        const auto tableRate = WaveTable::AllWaveTable::tableSampleRate;
+        if (sampleRate != tableRate)
+        {
+            const auto length = (int)std::lround((double)samples.size() * tableRate / sampleRate);
+            samples = DSP::CarrierResampler().process(samples.data(), (int)samples.size(), length);
+        }
+
+        // the assets are made from the decoded stream, which is what the plugin plays
+        streams.push_back(DSP::CarrierCodec::encode(samples.data(), (int)samples.size()));
+        const auto& stream = streams.back();
+        std::vector<float> table((size_t)DSP::CarrierCodec::getLength(stream.data(), stream.size()));
+        DSP::CarrierCodec::decode(stream.data(), stream.size(), table.data());
+        std::cout << carrier.identifier << ": " << table.size() << " samples, " << stream.size() << " bytes compressed" << std::endl;
+
+        if (! writeAssets(options, carrier, table))
+            return 1;
+    }
+
+    const auto source = makeWaveTableSource(options, streams);
+    const auto header = makeWaveTableSizeHeader((int)streams.size());
+    if (! writeFile(options.outputDirectory.getChildFile("WaveTable.cpp"), source.toRawUTF8(), source.getNumBytesAsUTF8())
+        || ! writeFile(options.outputDirectory.getChildFile("WaveTableSize.h"), header.toRawUTF8(), header.getNumBytesAsUTF8()))
+        return 1;
+    return 0;
+}
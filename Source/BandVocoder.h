@@ -0,0 +1,376 @@
+/*
+  ==============================================================================
+
+    BandVocoder.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include "EmotionDSP.h"
+
+// the AVX path is compiled on every x86 build and chosen at run time, so a build without
+// /arch:AVX or -mavx still uses it on CPUs that have it
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ #define BAND_VOCODER_AVX 1
+ #include <immintrin.h>
+ #if defined(_MSC_VER) && ! defined(__clang__)
+  #include <intrin.h>
+  #define BAND_VOCODER_AVX_TARGET
+ #else
+  #define BAND_VOCODER_AVX_TARGET __attribute__((target("avx")))
+ #endif
+#else
+ #define BAND_VOCODER_AVX 0
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BAND_VOCODER_SSE2 1
+#include <emmintrin.h>
+#else
+#define BAND_VOCODER_SSE2 0
+#endif
+
+namespace DSP
+{
+    /** Zero latency time-domain vocoder: 48 band-pass filters on the carrier, 48 on the
+        modulator, and an envelope follower per modulator band.
+
+        Coefficients come from BandPassFilter, but the filters are stored structure of
+        arrays so one instruction advances several biquads: 8 with AVX when the CPU has it,
+        4 with SSE2 (the x64 baseline), scalar otherwise. The arrays live in one block
+        aligned to 32 bytes by hand, because operator new only guarantees 16 before C++17.
+    */
+    class BandVocoder
+    {
+    public:
+        static constexpr int numBands = 48;
+
+        BandVocoder() : avx(hasAVX())
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+            lanes = storage.data() + ((alignment - address % alignment) % alignment) / sizeof(float);
+            coeffB0 = lanes;
+            coeffB2 = coeffB0 + numBands;
+            coeffA1 = coeffB2 + numBands;
+            coeffA2 = coeffA1 + numBands;
+            carrierState1 = coeffA2 + numBands;
+            carrierState2 = carrierState1 + numBands;
+            modulatorState1 = carrierState2 + numBands;
+            modulatorState2 = modulatorState1 + numBands;
+            envelope = modulatorState2 + numBands;
+            std::fill(lanes, lanes + numArrays * numBands, 0.0f);
+        }
+
+        BandVocoder(const BandVocoder&) = delete;
+        BandVocoder& operator=(const BandVocoder&) = delete;
+
+        /** True when this CPU and OS run AVX; checked once per process. */
+        static bool hasAVX()
+        {
+#if BAND_VOCODER_AVX
+            static const bool supported = []
+            {
+ #if defined(_MSC_VER) && ! defined(__clang__)
+                int info[4];
+                __cpuid(info, 1);
+                // AVX needs the OS to save the ymm registers (OSXSAVE, then XCR0 bits 1 and 2)
+                return (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+ #else
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx") != 0;
+ #endif
+            }();
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        void prepare(double sampleRate)
+        {
+            BandPassFilter filter;
+            for (int i = 0; i < numBands; ++i)
+            {
+                filter.setCoefficients(sampleRate, freqList[i], bandQ);
+                float b0, b1, b2, a1, a2;
+                filter.getCoefficients(b0, b1, b2, a1, a2);
+                coeffB0[i] = b0;
+                coeffB2[i] = b2;
+                coeffA1[i] = a1;
+                coeffA2[i] = a2;
+            }
+            outputGain = getOutputGain(sampleRate);
+
+            attackCoeff = std::exp(-1.0f / (attackSeconds * (float)sampleRate));
+            releaseCoeff = std::exp(-1.0f / (releaseSeconds * (float)sampleRate));
+            reset();
+        }
+
+        void reset()
+        {
+            std::fill(carrierState1, envelope + numBands, 0.0f);
+        }
+
+        /** Vocodes numSamples of modulator against the looping carrier table, reading the
+            carrier from carrierPosition on. Returns the carrier position after the block. */
+        int process(const float* carrierTable, int tableLength, int carrierPosition,
+                    const float* modulator, float* out, int numSamples)
+        {
+#if BAND_VOCODER_AVX
+            if (avx)
+                return processAVX(carrierTable, tableLength, carrierPosition, modulator, out, numSamples);
+#endif
+            for (int i = 0; i < numSamples; ++i)
+            {
+                out[i] = processSample(carrierTable[carrierPosition], modulator[i]) * outputGain;
+                if (++carrierPosition == tableLength)
+                    carrierPosition = 0;
+            }
+            return carrierPosition;
+        }
+
+    private:
+#if BAND_VOCODER_AVX
+        /** process() with processSampleAVX; only called when hasAVX(). */
+        BAND_VOCODER_AVX_TARGET
+        int processAVX(const float* carrierTable, int tableLength, int carrierPosition,
+                       const float* modulator, float* out, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                out[i] = processSampleAVX(carrierTable[carrierPosition], modulator[i]) * outputGain;
+                if (++carrierPosition == tableLength)
+                    carrierPosition = 0;
+            }
+            return carrierPosition;
+        }
+
+        BAND_VOCODER_AVX_TARGET
+        float processSampleAVX(float carrier, float modulator)
+        {
+            const __m256 c = _mm256_set1_ps(carrier);
+            const __m256 m = _mm256_set1_ps(modulator);
+            const __m256 attack = _mm256_set1_ps(attackCoeff);
+            const __m256 release = _mm256_set1_ps(releaseCoeff);
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            __m256 sum = _mm256_setzero_ps();
+
+            for (int i = 0; i < numBands; i += 8)
+            {
+                const __m256 b0 = _mm256_load_ps(coeffB0 + i);
+                const __m256 b2 = _mm256_load_ps(coeffB2 + i);
+                const __m256 a1 = _mm256_load_ps(coeffA1 + i);
+                const __m256 a2 = _mm256_load_ps(coeffA2 + i);
+
+                // carrier band (b1 is always zero for the band-pass)
+                __m256 s1 = _mm256_load_ps(carrierState1 + i);
+                __m256 s2 = _mm256_load_ps(carrierState2 + i);
+                const __m256 carrierBand = _mm256_add_ps(_mm256_mul_ps(b0, c), s1);
+                s1 = _mm256_sub_ps(s2, _mm256_mul_ps(a1, carrierBand));
+                s2 = _mm256_sub_ps(_mm256_mul_ps(b2, c), _mm256_mul_ps(a2, carrierBand));
+                _mm256_store_ps(carrierState1 + i, s1);
+                _mm256_store_ps(carrierState2 + i, s2);
+
+                // modulator band
+                s1 = _mm256_load_ps(modulatorState1 + i);
+                s2 = _mm256_load_ps(modulatorState2 + i);
+                const __m256 modulatorBand = _mm256_add_ps(_mm256_mul_ps(b0, m), s1);
+                s1 = _mm256_sub_ps(s2, _mm256_mul_ps(a1, modulatorBand));
+                s2 = _mm256_sub_ps(_mm256_mul_ps(b2, m), _mm256_mul_ps(a2, modulatorBand));
+                _mm256_store_ps(modulatorState1 + i, s1);
+                _mm256_store_ps(modulatorState2 + i, s2);
+
+                // envelope follower: attack when rising, release when falling
+                const __m256 level = _mm256_andnot_ps(signMask, modulatorBand);
+                __m256 env = _mm256_load_ps(envelope + i);
+                const __m256 rising = _mm256_cmp_ps(level, env, _CMP_GT_OQ);
+                const __m256 coeff = _mm256_or_ps(_mm256_and_ps(rising, attack), _mm256_andnot_ps(rising, release));
+                env = _mm256_add_ps(level, _mm256_mul_ps(coeff, _mm256_sub_ps(env, level)));
+                _mm256_store_ps(envelope + i, env);
+
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(carrierBand, env));
+            }
+
+            const __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+            const __m128 quarter = _mm_add_ps(half, _mm_movehl_ps(half, half));
+            return _mm_cvtss_f32(_mm_add_ss(quarter, _mm_shuffle_ps(quarter, quarter, 1)));
+        }
+#endif
+
+        float processSample(float carrier, float modulator)
+        {
+#if BAND_VOCODER_SSE2
+            const __m128 c = _mm_set1_ps(carrier);
+            const __m128 m = _mm_set1_ps(modulator);
+            const __m128 attack = _mm_set1_ps(attackCoeff);
+            const __m128 release = _mm_set1_ps(releaseCoeff);
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            __m128 sum = _mm_setzero_ps();
+
+            for (int i = 0; i < numBands; i += 4)
+            {
+                const __m128 b0 = _mm_load_ps(coeffB0 + i);
+                const __m128 b2 = _mm_load_ps(coeffB2 + i);
+                const __m128 a1 = _mm_load_ps(coeffA1 + i);
+                const __m128 a2 = _mm_load_ps(coeffA2 + i);
+
+                __m128 s1 = _mm_load_ps(carrierState1 + i);
+                __m128 s2 = _mm_load_ps(carrierState2 + i);
+                const __m128 carrierBand = _mm_add_ps(_mm_mul_ps(b0, c), s1);
+                s1 = _mm_sub_ps(s2, _mm_mul_ps(a1, carrierBand));
+                s2 = _mm_sub_ps(_mm_mul_ps(b2, c), _mm_mul_ps(a2, carrierBand));
+                _mm_store_ps(carrierState1 + i, s1);
+                _mm_store_ps(carrierState2 + i, s2);
+
+                s1 = _mm_load_ps(modulatorState1 + i);
+                s2 = _mm_load_ps(modulatorState2 + i);
+                const __m128 modulatorBand = _mm_add_ps(_mm_mul_ps(b0, m), s1);
+                s1 = _mm_sub_ps(s2, _mm_mul_ps(a1, modulatorBand));
+                s2 = _mm_sub_ps(_mm_mul_ps(b2, m), _mm_mul_ps(a2, modulatorBand));
+                _mm_store_ps(modulatorState1 + i, s1);
+                _mm_store_ps(modulatorState2 + i, s2);
+
+                const __m128 level = _mm_andnot_ps(signMask, modulatorBand);
+                __m128 env = _mm_load_ps(envelope + i);
+                const __m128 rising = _mm_cmpgt_ps(level, env);
+                const __m128 coeff = _mm_or_ps(_mm_and_ps(rising, attack), _mm_andnot_ps(rising, release));
+                env = _mm_add_ps(level, _mm_mul_ps(coeff, _mm_sub_ps(env, level)));
+                _mm_store_ps(envelope + i, env);
+
+                sum = _mm_add_ps(sum, _mm_mul_ps(carrierBand, env));
+            }
+
+            const __m128 half = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            return _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+#else
+            float sum = 0.0f;
+            for (int i = 0; i < numBands; ++i)
+            {
+                const auto carrierBand = coeffB0[i] * carrier + carrierState1[i];
+                carrierState1[i] = carrierState2[i] - coeffA1[i] * carrierBand;
+                carrierState2[i] = coeffB2[i] * carrier - coeffA2[i] * carrierBand;
+
+                const auto modulatorBand = coeffB0[i] * modulator + modulatorState1[i];
+                modulatorState1[i] = modulatorState2[i] - coeffA1[i] * modulatorBand;
+                modulatorState2[i] = coeffB2[i] * modulator - coeffA2[i] * modulatorBand;
+
+                const auto level = std::abs(modulatorBand);
+                const auto coeff = level > envelope[i] ? attackCoeff : releaseCoeff;
+                envelope[i] = level + coeff * (envelope[i] - level);
+
+                sum += carrierBand * envelope[i];
+            }
+            return sum;
+#endif
+        }
+
+        /** Gain that brings a carrier partial and a modulator partial of the same frequency
+            out at the product of their amplitudes. Such a partial passes every band near it,
+            attenuated by |H| in the carrier band and again in the follower, and a follower
+            settles on 2/pi of a sine's amplitude, so the bands sum to 2/pi times the sum of
+            |H|^2 over the bank; that sum is averaged over the band centres, about 5 at Q = 5
+            and semitone spacing. */
+        float getOutputGain(double sampleRate) const
+        {
+            double overlap = 0.0;
+            for (int k = 0; k < numBands; ++k)
+            {
+                const auto z = std::polar(1.0, 2.0 * M_PI * freqList[k] / sampleRate);
+                for (int i = 0; i < numBands; ++i)
+                {
+                    // b1 is zero for the band-pass
+                    const auto response = ((double)coeffB0[i] * z * z + (double)coeffB2[i])
+                                        / (z * z + (double)coeffA1[i] * z + (double)coeffA2[i]);
+                    overlap += std::norm(response);
+                }
+            }
+            return (float)(M_PI / (2.0 * overlap / numBands));
+        }
+
+        static constexpr int numArrays = 9;
+        static constexpr std::size_t alignment = 32;
+
+        std::array<float, numArrays * numBands + alignment / sizeof(float)> storage;
+        float* lanes = nullptr;
+
+        /** Filter coefficients, one lane per band. */
+        float* coeffB0 = nullptr;
+        float* coeffB2 = nullptr;
+        float* coeffA1 = nullptr;
+        float* coeffA2 = nullptr;
+        /** Filter and envelope state between audio buffers, contiguous from carrierState1 to envelope. */
+        float* carrierState1 = nullptr;
+        float* carrierState2 = nullptr;
+        float* modulatorState1 = nullptr;
+        float* modulatorState2 = nullptr;
+        float* envelope = nullptr;
+
+        float attackCoeff = 0.0f;
+        float releaseCoeff = 0.0f;
+        float outputGain = 1.0f;
+        bool avx;
+
+        const float bandQ = 5.0f;
+        const float attackSeconds = 0.005f;
+        const float releaseSeconds = 0.030f;
+
+        using BandArray = std::array<float, numBands>;
+
+        // semitone spaced from F#3 to F7
+        const BandArray freqList{
+            185.00f,
+            196.00f,
+            207.65f,
+            220.00f,
+            233.08f,
+            246.94f,
+            261.63f,
+            277.18f,
+            293.66f,
+            311.13f,
+            329.63f,
+            349.23f,
+            369.99f,
+            392.00f,
+            415.30f,
+            440.00f,
+            466.16f,
+            493.88f,
+            523.25f,
+            554.37f,
+            587.33f,
+            622.25f,
+            659.25f,
+            698.46f,
+            739.99f,
+            783.99f,
+            830.61f,
+            880.00f,
+            932.33f,
+            987.77f,
+            1046.50f,
+            1108.73f,
+            1174.66f,
+            1244.51f,
+            1318.51f,
+            1396.91f,
+            1479.98f,
+            1567.98f,
+            1661.22f,
+            1760.00f,
+            1864.66f,
+            1975.53f,
+            2093.00f,
+            2217.46f,
+            2349.32f,
+            2489.02f,
+            2637.02f,
+            2793.83f,
+        };
+    };
+}
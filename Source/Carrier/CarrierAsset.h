@@ -0,0 +1,289 @@
+/*
+  ==============================================================================
+
+    CarrierAsset.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "CarrierSpectrumCache.h"
+
+namespace DSP
+{
+    /** Binary carrier file (.carrier): one mono table with its rate and loop, ready to map.
+
+        Layout, little-endian, every section starting on a 64-byte boundary so the samples
+        and frames can be used straight from a read-only mapping:
+
+            Header          64 bytes, below
+            samples         length float32, or length int16 times sampleScale
+            spectra         optional: SpectraHeader, whitening gains (float32, frame/2 + 1),
+                            then numFrames frames of frame + 2 values in the cache's storage
+
+        The checksum is 32-bit FNV-1a over the whole file, header included, with the checksum
+        field itself read as zero. Readers accept any
+        version up to their own and skip header fields past the ones they know by headerSize.
+    */
+    class CarrierAsset
+    {
+    public:
+        enum class SampleFormat : uint32_t { Float32 = 1, Int16 = 2 };
+
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t headerSize;
+            uint32_t sampleFormat;
+            double sampleRate;
+            uint32_t length;
+            uint32_t loopStart;
+            uint32_t loopEnd;
+            uint32_t checksum;
+            float sampleScale;
+            uint32_t reserved;
+            uint64_t samplesOffset;
+            uint64_t spectraOffset;
+        };
+
+        /** Spectra of the loop, as CarrierSpectrumCache would build them at this rate. */
+        struct SpectraHeader
+        {
+            uint32_t frameSize;
+            uint32_t shiftSize;
+            uint32_t numFrames;
+            uint32_t storage;
+            uint32_t whitened;
+            uint32_t reserved;
+            uint64_t gainOffset;
+            uint64_t framesOffset;
+        };
+
+        static constexpr uint32_t currentVersion = 1;
+        static constexpr size_t alignment = 64;
+
+        CarrierAsset() {}
+
+        /** Checks the file in data and points the accessors into it; data must stay alive
+            and unchanged for as long as they are used. Touches every page when verifying. */
+        bool open(const void* data, size_t size, bool verifyChecksum = true)
+        {
+            bytes = static_cast<const uint8_t*>(data);
+            header = nullptr;
+            spectra = nullptr;
+
+            if (bytes == nullptr || size < sizeof(Header))
+                return fail("too short for a carrier header");
+            const auto* candidate = reinterpret_cast<const Header*>(bytes);
+            if (std::memcmp(candidate->magic, "EVCA", 4) != 0)
+                return fail("not a carrier file");
+            if (candidate->version == 0 || candidate->version > currentVersion)
+                return fail("unsupported carrier version " + std::to_string(candidate->version));
+            if (candidate->headerSize < sizeof(Header) || candidate->headerSize > size)
+                return fail("bad header size");
+            if (candidate->length < 2 || ! (candidate->sampleRate > 0.0)
+                || candidate->loopStart >= candidate->loopEnd || candidate->loopEnd > candidate->length)
+                return fail("bad length, rate or loop");
+
+            const auto format = (SampleFormat)candidate->sampleFormat;
+            const size_t bytesPerSample = format == SampleFormat::Float32 ? 4 : format == SampleFormat::Int16 ? 2 : 0;
+            if (bytesPerSample == 0)
+                return fail("unknown sample format");
+            if (! fits(candidate->samplesOffset, (uint64_t)candidate->length * bytesPerSample, size))
+                return fail("samples run past the end of the file");
+
+            if (candidate->spectraOffset != 0)
+            {
+                if (! fits(candidate->spectraOffset, sizeof(SpectraHeader), size))
+                    return fail("spectra header runs past the end of the file");
+                const auto* table = reinterpret_cast<const SpectraHeader*>(bytes + candidate->spectraOffset);
+                const auto frameValues = (uint64_t)table->frameSize + 2;
+                const auto valueSize = storageValueSize((CarrierSpectrumCache::Storage)table->storage);
+                if (table->frameSize == 0 || table->shiftSize == 0 || table->numFrames == 0 || valueSize == 0
+                    || ! fits(table->gainOffset, frameValues / 2 * sizeof(float), size)
+                    || ! fits(table->framesOffset, frameValues * table->numFrames * valueSize, size))
+                    return fail("bad spectra section");
+                spectra = table;
+            }
+
+            if (verifyChecksum && fileChecksum(bytes, size) != candidate->checksum)
+            {
+                spectra = nullptr;
+                return fail("checksum mismatch");
+            }
+
+            header = candidate;
+            error.clear();
+            return true;
+        }
+
+        bool isOpen() const { return header != nullptr; }
+        const std::string& getError() const { return error; }
+
+        double getSampleRate() const { return header->sampleRate; }
+        int getLength() const { return (int)header->length; }
+        int getLoopStart() const { return (int)header->loopStart; }
+        int getLoopEnd() const { return (int)header->loopEnd; }
+        SampleFormat getSampleFormat() const { return (SampleFormat)header->sampleFormat; }
+
+        /** The mapped samples when they are float32, otherwise nullptr (decode with readSamples). */
+        const float* getFloatSamples() const
+        {
+            return getSampleFormat() == SampleFormat::Float32 ? reinterpret_cast<const float*>(bytes + header->samplesOffset) : nullptr;
+        }
+
+        /** Copies numSamples from start into dest as float, whatever the stored format. */
+        void readSamples(int start, int numSamples, float* dest) const
+        {
+            if (const auto* samples = getFloatSamples())
+            {
+                std::memcpy(dest, samples + start, sizeof(float) * (size_t)numSamples);
+                return;
+            }
+            const auto* samples = reinterpret_cast<const int16_t*>(bytes + header->samplesOffset) + start;
+            for (int i = 0; i < numSamples; ++i)
+                dest[i] = samples[i] * header->sampleScale;
+        }
+
+        bool hasSpectra() const { return spectra != nullptr; }
+        const SpectraHeader& getSpectraHeader() const { return *spectra; }
+        const float* getWhiteningGain() const { return reinterpret_cast<const float*>(bytes + spectra->gainOffset); }
+        const void* getFrames() const { return bytes + spectra->framesOffset; }
+
+        /** A whole carrier file. The loop is what gets played; its spectra are written when
+            spectra is given, which must have been built from exactly that loop. Int16 keeps
+            the peak at full scale and halves the size at about 96 dB of dynamic range. */
+        static std::vector<uint8_t> write(const float* samples, int length, double sampleRate, int loopStart, int loopEnd,
+                                          SampleFormat format, const CarrierSpectrumCache* spectraToWrite = nullptr)
+        {
+            Header h {};
+            std::memcpy(h.magic, "EVCA", 4);
+            h.version = currentVersion;
+            h.headerSize = sizeof(Header);
+            h.sampleFormat = (uint32_t)format;
+            h.sampleRate = sampleRate;
+            h.length = (uint32_t)length;
+            h.loopStart = (uint32_t)loopStart;
+            h.loopEnd = (uint32_t)loopEnd;
+            h.sampleScale = 1.0f;
+
+            std::vector<uint8_t> file(sizeof(Header));
+            h.samplesOffset = pad(file);
+            if (format == SampleFormat::Float32)
+            {
+                append(file, samples, sizeof(float) * (size_t)length);
+            }
+            else
+            {
+                float peak = 0.0f;
+                for (int i = 0; i < length; ++i)
+                    peak = std::max(peak, std::fabs(samples[i]));
+                h.sampleScale = peak > 0.0f ? peak / 32767.0f : 1.0f;
+                std::vector<int16_t> quantised((size_t)length);
+                for (int i = 0; i < length; ++i)
+                    quantised[(size_t)i] = (int16_t)std::lround(samples[i] / h.sampleScale);
+                append(file, quantised.data(), sizeof(int16_t) * quantised.size());
+            }
+
+            if (spectraToWrite != nullptr && spectraToWrite->hasFrames())
+            {
+                const auto& cache = *spectraToWrite;
+                SpectraHeader s {};
+                s.frameSize = (uint32_t)cache.getFrameSize();
+                s.shiftSize = (uint32_t)cache.getShiftSize();
+                s.numFrames = (uint32_t)cache.getNumFrames();
+                s.storage = (uint32_t)cache.getStorage();
+                s.whitened = cache.isWhitened() ? 1 : 0;
+
+                h.spectraOffset = pad(file);
+                append(file, &s, sizeof(s));
+                const auto numBins = cache.getFrameSize() / 2 + 1;
+                std::vector<float> gain(cache.getWhiteningGain(), cache.getWhiteningGain() + numBins);
+                s.gainOffset = pad(file);
+                append(file, gain.data(), sizeof(float) * gain.size());
+                s.framesOffset = pad(file);
+                append(file, cache.getFrameData(), cache.getFrameDataSize());
+                std::memcpy(file.data() + h.spectraOffset, &s, sizeof(s));
+            }
+
+            std::memcpy(file.data(), &h, sizeof(h));
+            h.checksum = fileChecksum(file.data(), file.size());
+            std::memcpy(file.data(), &h, sizeof(h));
+            return file;
+        }
+
+        /** 32-bit FNV-1a, continuing from hash. */
+        static uint32_t checksum(const uint8_t* data, size_t size, uint32_t hash = 2166136261u)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        /** The checksum stored in a carrier file: every byte, the checksum field taken as zero. */
+        static uint32_t fileChecksum(const uint8_t* file, size_t size)
+        {
+            const size_t field = offsetof(Header, checksum);
+            const uint8_t zero[sizeof(Header::checksum)] = {};
+            auto hash = checksum(file, field);
+            hash = checksum(zero, sizeof(zero), hash);
+            return checksum(file + field + sizeof(zero), size - field - sizeof(zero), hash);
+        }
+
+        static size_t storageValueSize(CarrierSpectrumCache::Storage storage)
+        {
+            switch (storage)
+            {
+                case CarrierSpectrumCache::Storage::Half: return sizeof(uint16_t);
+                case CarrierSpectrumCache::Storage::Float: return sizeof(float);
+                case CarrierSpectrumCache::Storage::Double: return sizeof(double);
+                default: return 0;
+            }
+        }
+
+    private:
+        const uint8_t* bytes = nullptr;
+        const Header* header = nullptr;
+        const SpectraHeader* spectra = nullptr;
+        std::string error;
+
+        bool fail(const std::string& message)
+        {
+            error = message;
+            return false;
+        }
+
+        /** True when [offset, offset + size) is aligned and inside a file of fileSize bytes. */
+        static bool fits(uint64_t offset, uint64_t size, size_t fileSize)
+        {
+            return offset % alignment == 0 && offset <= fileSize && size <= fileSize - offset;
+        }
+
+        /** Zero-pads file to the next section boundary and returns that offset. */
+        static uint64_t pad(std::vector<uint8_t>& file)
+        {
+            file.resize((file.size() + alignment - 1) / alignment * alignment, 0);
+            return file.size();
+        }
+
+        static void append(std::vector<uint8_t>& file, const void* data, size_t size)
+        {
+            const auto* first = static_cast<const uint8_t*>(data);
+            file.insert(file.end(), first, first + size);
+        }
+
+        static_assert(sizeof(Header) == 64, "the carrier header is 64 bytes on disk");
+        static_assert(sizeof(SpectraHeader) == 40, "the spectra header is 40 bytes on disk");
+    };
+}
@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    CarrierAssetFile.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "CarrierAsset.h"
+
+/** A .carrier file mapped read-only, or one linked into the binary.
+
+    The mapping is shared: opening a path that is already open in this process returns
+    the same object, and other processes mapping the file share its pages through the
+    OS, so nothing is parsed or copied. Only int16 files are decoded, once, into floats.
+    Opening reads the file to verify it, so do it off the audio thread.
+*/
+class CarrierAssetFile : public std::enable_shared_from_this<CarrierAssetFile>
+{
+public:
+    /** The file's mapping, or nullptr with the reason in error. */
+    static std::shared_ptr<const CarrierAssetFile> open (const juce::File& file, juce::String& error)
+    {
+        return openShared (file.getFullPathName(), error, [&file] { return new CarrierAssetFile (file); });
+    }
+
+    /** A carrier file already in memory for the life of the process, e.g. BinaryData; it is
+        only copied if it is not aligned enough to read its samples in place. */
+    static std::shared_ptr<const CarrierAssetFile> openStatic (const void* data, size_t size, const juce::String& name,
+                                                               juce::String& error)
+    {
+        return openShared ("binary:" + name, error, [data, size, &name] { return new CarrierAssetFile (data, size, name); });
+    }
+
+    const DSP::CarrierAsset& getAsset() const { return asset; }
+    double getSampleRate() const { return asset.getSampleRate(); }
+
+    /** The loop as floats, straight from the mapping unless the file is int16. */
+    const float* getLoop() const { return loop; }
+    int getLoopLength() const { return asset.getLoopEnd() - asset.getLoopStart(); }
+
+    /** A spectrum cache over the loop from the file's own spectra, or nullptr when the file
+        has none for this rate, STFT layout and whitening. The frames stay in the mapping. */
+    std::shared_ptr<const DSP::CarrierSpectrumCache> getSpectrumCache (double sampleRate, int frame, int shift, bool whiten,
+                                                                       std::shared_ptr<const DSP::CarrierMipmap> mipmap = nullptr) const
+    {
+        if (! asset.hasSpectra() || sampleRate != asset.getSampleRate())
+            return nullptr;
+
+        const auto& spectra = asset.getSpectraHeader();
+        if ((int)spectra.frameSize != frame || (int)spectra.shiftSize != shift || (spectra.whitened != 0) != whiten)
+            return nullptr;
+
+        auto cache = std::make_shared<const DSP::CarrierSpectrumCache> (loop, getLoopLength(), frame, shift,
+                                                                       (DSP::CarrierSpectrumCache::Storage) spectra.storage, whiten,
+                                                                       asset.getWhiteningGain(), asset.getFrames(),
+                                                                       shared_from_this(), std::move (mipmap));
+        // a file written for another grid would be read out of bounds
+        return cache->getNumFrames() == (int)spectra.numFrames ? cache : nullptr;
+    }
+
+private:
+    std::unique_ptr<juce::MemoryMappedFile> mapping;
+    DSP::CarrierAsset asset;
+    std::vector<float> decoded;
+    const float* loop = nullptr;
+    juce::String error;
+
+    std::vector<double> alignedCopy;
+
+    template <typename Create>
+    static std::shared_ptr<const CarrierAssetFile> openShared (const juce::String& key, juce::String& error, Create create)
+    {
+        static std::mutex openLock;
+        static std::map<juce::String, std::weak_ptr<const CarrierAssetFile>> openFiles;
+
+        const std::lock_guard<std::mutex> lock (openLock);
+        if (auto existing = openFiles[key].lock())
+            return existing;
+
+        std::shared_ptr<CarrierAssetFile> opened (create());
+        if (! opened->asset.isOpen())
+        {
+            error = opened->error;
+            return nullptr;
+        }
+        openFiles[key] = opened;
+        return opened;
+    }
+
+    explicit CarrierAssetFile (const juce::File& file)
+        : mapping (new juce::MemoryMappedFile (file, juce::MemoryMappedFile::readOnly))
+    {
+        if (mapping->getData() == nullptr)
+        {
+            error = "cannot map " + file.getFullPathName();
+            return;
+        }
+        openAsset (mapping->getData(), mapping->getSize(), file.getFileName());
+    }
+
+    CarrierAssetFile (const void* data, size_t size, const juce::String& name)
+    {
+        // mappings start on a page; linked data is only as aligned as the compiler made it
+        if (reinterpret_cast<uintptr_t> (data) % alignof (double) != 0)
+        {
+            alignedCopy.resize ((size + sizeof (double) - 1) / sizeof (double));
+            std::memcpy (alignedCopy.data(), data, size);
+            data = alignedCopy.data();
+        }
+        openAsset (data, size, name);
+    }
+
+    void openAsset (const void* data, size_t size, const juce::String& name)
+    {
+        if (! asset.open (data, size))
+        {
+            error = name + ": " + juce::String (asset.getError());
+            return;
+        }
+
+        const auto loopStart = asset.getLoopStart();
+        if (const auto* samples = asset.getFloatSamples())
+        {
+            loop = samples + loopStart;
+            return;
+        }
+        decoded.resize ((size_t) getLoopLength());
+        asset.readSamples (loopStart, getLoopLength(), decoded.data());
+        loop = decoded.data();
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (CarrierAssetFile)
+};
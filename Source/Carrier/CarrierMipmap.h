@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    CarrierMipmap.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "CarrierOscillator.h"
+#include "CarrierResampler.h"
+
+namespace DSP
+{
+    /** Band-limited copies of a looping carrier table for reading it faster than recorded.
+
+        Level 0 is the table itself; every further level is the one before it resampled to
+        half the length, so level L holds only what survives being read 2^L times faster
+        and costs half as much memory as the level below it. A read at rate r above 1 blends
+        level ceil(log2(r)), the first one clean at that rate, with the level above it, which
+        takes over as r nears the next octave. Both are band-limited for r, so nothing
+        aliases, and the brightness moves smoothly with the rate above 1; going from rate 1,
+        which reads the table as it is, to just above it drops the top octave at once. Each
+        read is at most two interpolated reads whatever the rate. Build it off the audio
+        thread.
+    */
+    class CarrierMipmap
+    {
+    public:
+        /** Reads up to 2^(numLevels - 2) times faster are clean; the vocoder reads at most 4x, so 4 levels. */
+        CarrierMipmap(const float* table, int length, int numLevels = 4)
+            : tableLength(length)
+        {
+            levels.push_back({ table, length, 1.0 });
+            const CarrierResampler resampler;
+            for (int level = 1; level < numLevels; ++level)
+            {
+                const auto& below = levels.back();
+                const auto levelLength = (below.length + 1) / 2;
+                if (levelLength < 2)
+                    break;
+                storage.emplace_back(resampler.process(below.samples, below.length, levelLength));
+                levels.push_back({ storage.back().data(), levelLength, (double)levelLength / tableLength });
+            }
+        }
+
+        int getNumLevels() const { return (int)levels.size(); }
+        int getTableLength() const { return tableLength; }
+
+        /** numSamples from table position `position` onwards, advancing `rate` table samples
+            per output sample. Rates at or below 1 read level 0 only. */
+        template <typename SampleType>
+        void read(double position, double rate, SampleType* out, int numSamples,
+                  CarrierOscillator::Interpolation interpolation = CarrierOscillator::Interpolation::Linear) const
+        {
+            if (rate <= 1.0)
+            {
+                readLevel(levels.front(), position, rate, 1.0, false, interpolation, out, numSamples);
+                return;
+            }
+
+            // the upper level's weight is how far r is past the octave below the lower level's,
+            // so it is 1 at each power of two, where the level above takes over on its own
+            const auto octave = std::log2(rate);
+            const auto lower = std::min((int)std::ceil(octave), getNumLevels() - 1);
+            const auto upper = std::min(lower + 1, getNumLevels() - 1);
+            const auto upperWeight = upper == lower ? 0.0 : std::min(1.0, octave - lower + 1.0);
+
+            if (upperWeight < 1.0)
+                readLevel(levels[(size_t)lower], position, rate, 1.0 - upperWeight, false, interpolation, out, numSamples);
+            if (upperWeight > 0.0)
+                readLevel(levels[(size_t)upper], position, rate, upperWeight, upperWeight < 1.0, interpolation, out, numSamples);
+        }
+
+    private:
+        struct Level
+        {
+            const float* samples;
+            int length;
+            /** level samples per table sample */
+            double scale;
+        };
+
+        int tableLength;
+        std::vector<Level> levels;
+        std::vector<std::vector<float>> storage;
+
+        /** Writes (or adds) gain times the interpolated level into out. */
+        template <typename SampleType>
+        static void readLevel(const Level& level, double position, double rate, double gain, bool add,
+                              CarrierOscillator::Interpolation interpolation, SampleType* out, int numSamples)
+        {
+            const CarrierOscillator oscillator(level.samples, level.length, interpolation);
+            oscillator.process(position * level.scale, rate * level.scale, out, numSamples, (float)gain, add);
+        }
+    };
+}
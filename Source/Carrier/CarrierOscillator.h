@@ -0,0 +1,261 @@
+/*
+  ==============================================================================
+
+    CarrierOscillator.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+// the AVX2 path is compiled on every x86 build and chosen at run time, so a build without
+// /arch:AVX2 or -mavx2 still uses it on CPUs that have it
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ #define EMOTION_CARRIER_OSCILLATOR_AVX2 1
+ #include <immintrin.h>
+ #if defined(_MSC_VER) && ! defined(__clang__)
+  #include <intrin.h>
+  #define EMOTION_CARRIER_OSCILLATOR_AVX2_TARGET
+ #else
+  #define EMOTION_CARRIER_OSCILLATOR_AVX2_TARGET __attribute__((target("avx2")))
+ #endif
+#endif
+
+namespace DSP
+{
+    /** Reads a looping table at any rate from a fractional (double) phase.
+
+        Rather than wrapping every sample, a read is split into runs: inside the table,
+        where all four taps around the phase are in range, samples are made 8 at a time
+        (AVX2 gathers when the CPU has them, otherwise a plain loop over the same 8
+        lanes), and only the few samples whose taps straddle the loop point wrap each tap.
+        A whole-sample phase at rate 1 is a straight copy. The reader keeps no state, so
+        one table can be read from several places at once.
+    */
+    class CarrierOscillator
+    {
+    public:
+        /** Linear uses two taps; Cubic is the 4-point Lagrange polynomial, Hermite the 4-point,
+            3rd-order Hermite (Catmull-Rom) spline, which is smoother between samples. */
+        enum class Interpolation { Linear, Cubic, Hermite };
+
+        CarrierOscillator(const float* tableToUse, int lengthToUse, Interpolation interpolationToUse = Interpolation::Linear)
+            : table(tableToUse), length(lengthToUse), interpolation(interpolationToUse), avx2(hasAVX2()) {}
+
+        /** True when this CPU and OS run AVX2; checked once per process. */
+        static bool hasAVX2()
+        {
+#if EMOTION_CARRIER_OSCILLATOR_AVX2
+            static const bool supported = []
+            {
+ #if defined(_MSC_VER) && ! defined(__clang__)
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] < 7)
+                    return false;
+                __cpuid(info, 1);
+                // AVX needs the OS to save the ymm registers (OSXSAVE, then XCR0 bits 1 and 2)
+                if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+                    return false;
+                __cpuidex(info, 7, 0);
+                return (info[1] & (1 << 5)) != 0;
+ #else
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+ #endif
+            }();
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        /** Writes (or with add, adds) gain times numSamples of the table, starting at phase and
+            advancing rate table samples per output sample. Returns the phase after the last
+            one, wrapped into the table. */
+        template <typename SampleType>
+        double process(double phase, double rate, SampleType* out, int numSamples, float gain = 1.0f, bool add = false) const
+        {
+            phase = wrap(phase);
+            if (rate == 1.0 && phase == std::floor(phase))
+                return copy((int)phase, out, numSamples, gain, add);
+
+            // a run stays where index - 1 and index + 2 are both inside the table
+            const double runEnd = length - 2;
+            float lanes[8];
+            int done = 0;
+            while (done < numSamples)
+            {
+                int run = phase >= 1.0 && phase < runEnd ? (int)((runEnd - phase) / rate) : 0;
+                run = std::min(run, numSamples - done) / 8 * 8;
+                for (int j = 0; j < run; j += 8)
+                {
+                    interpolate8(phase + j * rate, rate, lanes);
+                    write(lanes, out + done + j, 8, gain, add);
+                }
+                done += run;
+                phase += run * rate;
+
+                // samples around the loop point, until the next run can start
+                for (int j = 0; done < numSamples && j < 8; ++j, ++done)
+                {
+                    lanes[0] = interpolateWrapped(phase);
+                    write(lanes, out + done, 1, gain, add);
+                    phase = wrap(phase + rate);
+                }
+            }
+            return wrap(phase);
+        }
+
+    private:
+        const float* table;
+        int length;
+        Interpolation interpolation;
+        bool avx2;
+
+        double wrap(double phase) const
+        {
+            if (phase >= length || phase < 0.0)
+                phase -= std::floor(phase / length) * length;
+            return phase < length ? phase : 0.0;
+        }
+
+        template <typename SampleType>
+        static void write(const float* values, SampleType* out, int numSamples, float gain, bool add)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                out[i] = add ? out[i] + gain * values[i] : gain * values[i];
+        }
+
+        template <typename SampleType>
+        double copy(int index, SampleType* out, int numSamples, float gain, bool add) const
+        {
+            for (int done = 0; done < numSamples;)
+            {
+                const auto num = std::min(numSamples - done, length - index);
+                write(table + index, out + done, num, gain, add);
+                done += num;
+                index = index + num == length ? 0 : index + num;
+            }
+            return index;
+        }
+
+        /** The sample f of the way from b to c, with a before b and d after c. */
+        template <Interpolation mode>
+        static float interpolate(float a, float b, float c, float d, float f)
+        {
+            switch (mode)
+            {
+                case Interpolation::Cubic:
+                {
+                    const auto c1 = c - a * (1.0f / 3.0f) - b * 0.5f - d * (1.0f / 6.0f);
+                    const auto c2 = (a + c) * 0.5f - b;
+                    const auto c3 = (d - a) * (1.0f / 6.0f) + (b - c) * 0.5f;
+                    return ((c3 * f + c2) * f + c1) * f + b;
+                }
+                case Interpolation::Hermite:
+                {
+                    const auto c1 = (c - a) * 0.5f;
+                    const auto c2 = a - b * 2.5f + c * 2.0f - d * 0.5f;
+                    const auto c3 = (d - a) * 0.5f + (b - c) * 1.5f;
+                    return ((c3 * f + c2) * f + c1) * f + b;
+                }
+                default:
+                    return b + f * (c - b);
+            }
+        }
+
+        /** One sample anywhere in the table, every tap wrapped. */
+        float interpolateWrapped(double phase) const
+        {
+            const auto index = (int)phase;
+            const auto f = (float)(phase - index);
+            const auto before = index == 0 ? length - 1 : index - 1;
+            const auto after = index + 1 == length ? 0 : index + 1;
+            const auto afterNext = after + 1 == length ? 0 : after + 1;
+            switch (interpolation)
+            {
+                case Interpolation::Cubic: return interpolate<Interpolation::Cubic>(table[before], table[index], table[after], table[afterNext], f);
+                case Interpolation::Hermite: return interpolate<Interpolation::Hermite>(table[before], table[index], table[after], table[afterNext], f);
+                default: return interpolate<Interpolation::Linear>(table[before], table[index], table[after], table[afterNext], f);
+            }
+        }
+
+        /** Eight samples from phase on, every tap inside the table. */
+        void interpolate8(double phase, double rate, float* out) const
+        {
+#if EMOTION_CARRIER_OSCILLATOR_AVX2
+            if (avx2)
+            {
+                interpolate8AVX2(phase, rate, out);
+                return;
+            }
+#endif
+            switch (interpolation)
+            {
+                case Interpolation::Cubic: interpolateLanes<Interpolation::Cubic>(phase, rate, out); break;
+                case Interpolation::Hermite: interpolateLanes<Interpolation::Hermite>(phase, rate, out); break;
+                default: interpolateLanes<Interpolation::Linear>(phase, rate, out); break;
+            }
+        }
+
+#if EMOTION_CARRIER_OSCILLATOR_AVX2
+        /** interpolate8 with AVX2 gathers; only called when hasAVX2(). */
+        EMOTION_CARRIER_OSCILLATOR_AVX2_TARGET
+        void interpolate8AVX2(double phase, double rate, float* out) const
+        {
+            // positions in double so a long table keeps its sub-sample accuracy, taps gathered as float
+            const auto low = _mm256_add_pd(_mm256_set1_pd(phase), _mm256_mul_pd(_mm256_set_pd(3.0, 2.0, 1.0, 0.0), _mm256_set1_pd(rate)));
+            const auto high = _mm256_add_pd(low, _mm256_set1_pd(4.0 * rate));
+            const auto lowIndex = _mm256_cvttpd_epi32(low);
+            const auto highIndex = _mm256_cvttpd_epi32(high);
+            const auto index = _mm256_set_m128i(highIndex, lowIndex);
+            const auto f = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_sub_pd(high, _mm256_cvtepi32_pd(highIndex))),
+                                           _mm256_cvtpd_ps(_mm256_sub_pd(low, _mm256_cvtepi32_pd(lowIndex))));
+            const auto b = _mm256_i32gather_ps(table, index, 4);
+            const auto c = _mm256_i32gather_ps(table + 1, index, 4);
+            if (interpolation == Interpolation::Linear)
+            {
+                _mm256_storeu_ps(out, _mm256_add_ps(b, _mm256_mul_ps(f, _mm256_sub_ps(c, b))));
+                return;
+            }
+
+            const auto a = _mm256_i32gather_ps(table - 1, index, 4);
+            const auto d = _mm256_i32gather_ps(table + 2, index, 4);
+            const auto half = _mm256_set1_ps(0.5f);
+            __m256 c1, c2, c3;
+            if (interpolation == Interpolation::Cubic)
+            {
+                const auto third = _mm256_set1_ps(1.0f / 3.0f);
+                const auto sixth = _mm256_set1_ps(1.0f / 6.0f);
+                c1 = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(c, _mm256_mul_ps(a, third)), _mm256_mul_ps(b, half)), _mm256_mul_ps(d, sixth));
+                c2 = _mm256_sub_ps(_mm256_mul_ps(_mm256_add_ps(a, c), half), b);
+                c3 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(d, a), sixth), _mm256_mul_ps(_mm256_sub_ps(b, c), half));
+            }
+            else
+            {
+                c1 = _mm256_mul_ps(_mm256_sub_ps(c, a), half);
+                c2 = _mm256_sub_ps(_mm256_add_ps(_mm256_sub_ps(a, _mm256_mul_ps(b, _mm256_set1_ps(2.5f))), _mm256_mul_ps(c, _mm256_set1_ps(2.0f))),
+                                   _mm256_mul_ps(d, half));
+                c3 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(d, a), half), _mm256_mul_ps(_mm256_sub_ps(b, c), _mm256_set1_ps(1.5f)));
+            }
+            const auto y = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(c3, f), c2), f), c1), f), b);
+            _mm256_storeu_ps(out, y);
+        }
+#endif
+
+        /** interpolate8 without SIMD; the same 8 lanes, which compilers vectorise as far as they can. */
+        template <Interpolation mode>
+        void interpolateLanes(double phase, double rate, float* out) const
+        {
+            for (int lane = 0; lane < 8; ++lane)
+            {
+                const auto position = phase + lane * rate;
+                const auto index = (int)position;
+                const auto f = (float)(position - index);
+                out[lane] = interpolate<mode>(table[index - 1], table[index], table[index + 1], table[index + 2], f);
+            }
+        }
+    };
+}
@@ -0,0 +1,375 @@
+/*
+  ==============================================================================
+
+    CarrierRegistry.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "CarrierCodec.h"
+#include "CarrierMipmap.h"
+#include "CarrierResampler.h"
+#include "CarrierSpectrumCache.h"
+
+namespace DSP
+{
+    /** Process-wide store of read-only data derived from the carrier tables.
+
+        The tables themselves are compressed constant data in WaveTable.cpp; everything built
+        from them (the decoded samples, copies resampled to the host rate, their mipmaps, spectral caches) is built once per sample
+        rate here and shared by every plugin instance. Nothing built from a library table is
+        dropped while the registry lives, so going back to a rate used before costs nothing.
+        Hold it through juce::SharedResourcePointer so the registry lives exactly as long
+        as some instance does. Lookups lock, so call them from prepareToPlay, the
+        constructor or a timer, never from the audio thread.
+
+        Caches are built on demand: getSpectrumCache() builds on the calling thread,
+        requestSpectrumCache() hands the build to the registry's loader thread and
+        returns straight away, so the message thread never waits for a carrier.
+
+        Tables are identified by their address, so a table loaded at run time has to be
+        handed to addTable() first. The handle it returns stands for the table: the table
+        and everything built from it stay here while some copy of the handle lives, and
+        releaseUnusedTables() frees them after the last one has gone, so the address can
+        only be reused once nothing refers to it. Whoever asks for a cache, mipmap or
+        resampled copy of such a table must hold its handle meanwhile, and so must anything
+        that keeps what it got back.
+    */
+    class CarrierRegistry
+    {
+    public:
+        CarrierRegistry() {}
+
+        ~CarrierRegistry()
+        {
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                quit = true;
+                loadQueue.clear();
+            }
+            loadRequested.notify_all();
+            if (loader.joinable())
+                loader.join();
+        }
+
+        /** A table made at tableRate, played at sampleRate. */
+        struct Table
+        {
+            const float* samples;
+            int length;
+        };
+
+        /** Samples a table of length samples at tableRate plays as at sampleRate.
+
+            The length is rounded to a multiple of up to 256 samples, the largest power of two
+            that moves the pitch by no more than 3 cents. The cache holds a frame for every
+            gcd(hop, length) samples, so an exact length can need a frame every few samples:
+            96000 samples at 48 kHz are 88200 at 44.1 kHz, a frame every 8 samples and 45 MB per
+            carrier, where 88320 samples (2.4 cents flat) are a frame every 256 and 1.4 MB. */
+        static int getPlayedLength(int length, double tableRate, double sampleRate)
+        {
+            if (sampleRate <= 0.0 || sampleRate == tableRate)
+                return length;
+            const auto exactLength = length * sampleRate / tableRate;
+            // half a step over the length is the largest pitch error; 3 cents is a ratio of 1.00173
+            int step = 256;
+            while (step > 1 && step * 0.5 > exactLength * 0.00173)
+                step /= 2;
+            return std::max(step, (int)std::lround(exactLength / step) * step);
+        }
+
+        /** Keeps owner, and so the table it holds, alive until the registry goes. */
+        void keepTable(std::shared_ptr<const void> owner)
+        {
+            std::lock_guard<std::mutex> lock(registryLock);
+            if (std::find(keptTables.begin(), keptTables.end(), owner) == keptTables.end())
+                keptTables.push_back(std::move(owner));
+        }
+
+        /** Registers a table loaded at run time, whose samples owner keeps alive, and returns
+            its handle; adding a table that is already here returns the handle it has. */
+        std::shared_ptr<const void> addTable(const float* table, std::shared_ptr<const void> owner)
+        {
+            std::lock_guard<std::mutex> lock(registryLock);
+            auto& added = addedTables[table];
+            if (auto handle = added.handle.lock())
+                return handle;
+            // an entry whose handles have all gone but which is not released yet still holds the
+            // same samples, so whatever was built from it stays valid
+            std::shared_ptr<const void> handle = std::make_shared<const float*>(table);
+            added.handle = handle;
+            if (added.owner == nullptr)
+                added.owner = std::move(owner);
+            return handle;
+        }
+
+        /** Frees every table from addTable() whose handles have all gone, with its resampled
+            copies, mipmaps and caches. Call it now and then off the audio thread. */
+        void releaseUnusedTables()
+        {
+            std::vector<std::shared_ptr<const void>> released;
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                for (auto added = addedTables.begin(); added != addedTables.end();)
+                {
+                    if (! added->second.handle.expired())
+                    {
+                        ++added;
+                        continue;
+                    }
+                    const auto* table = added->first;
+                    released.push_back(std::move(added->second.owner));
+                    eraseTable(resampledTables, table, released);
+                    eraseTable(mipmaps, table, released);
+                    eraseTable(spectrumCaches, table, released);
+                    for (auto source = spectrumSources.begin(); source != spectrumSources.end();)
+                        source = std::get<0>(source->first) == table ? spectrumSources.erase(source) : std::next(source);
+                    for (auto key = queued.begin(); key != queued.end();)
+                        key = std::get<0>(*key) == table ? queued.erase(key) : std::next(key);
+                    loadQueue.erase(std::remove_if(loadQueue.begin(), loadQueue.end(),
+                                                   [table] (const CacheKey& key) { return std::get<0>(key) == table; }),
+                                    loadQueue.end());
+                    added = addedTables.erase(added);
+                }
+            }
+            // the samples and everything built from them are freed here, outside the lock
+        }
+
+        /** The samples of a table stored as a CarrierCodec stream, decoded on first use and
+            kept; the decoded table is then the one to use as a key everywhere else. */
+        Table getDecodedTable(const uint8_t* data, size_t size)
+        {
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = decodedTables.find(data);
+                if (found != decodedTables.end())
+                    return { found->second->data(), (int)found->second->size() };
+            }
+
+            std::unique_ptr<std::vector<float>> decoded(new std::vector<float>((size_t)CarrierCodec::getLength(data, size)));
+            if (! CarrierCodec::decode(data, size, decoded->data()))
+                std::fill(decoded->begin(), decoded->end(), 0.0f);
+            std::lock_guard<std::mutex> lock(registryLock);
+            const auto& stored = *decodedTables.emplace(data, std::move(decoded)).first->second;
+            return { stored.data(), (int)stored.size() };
+        }
+
+        /** The table itself when the rates match, otherwise its copy resampled to sampleRate
+            (built on first use; the copy lives as long as the registry). */
+        Table getTable(const float* table, int length, double tableRate, double sampleRate)
+        {
+            if (sampleRate <= 0.0 || sampleRate == tableRate)
+                return { table, length };
+
+            const auto key = std::make_tuple(table, length, tableRate, sampleRate);
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = resampledTables.find(key);
+                if (found != resampledTables.end())
+                    return { found->second->data(), (int)found->second->size() };
+            }
+
+            const auto resampledLength = getPlayedLength(length, tableRate, sampleRate);
+            std::unique_ptr<const std::vector<float>> resampled(
+                new std::vector<float>(CarrierResampler().process(table, length, resampledLength)));
+            std::lock_guard<std::mutex> lock(registryLock);
+            const auto& stored = *resampledTables.emplace(key, std::move(resampled)).first->second;
+            return { stored.data(), (int)stored.size() };
+        }
+
+        /** Returns the cache for this table at sampleRate, STFT layout and whitening, building it on first use. */
+        std::shared_ptr<const CarrierSpectrumCache> getSpectrumCache(const float* table, int length, double tableRate, double sampleRate,
+                                                                     int frame, int shift, CarrierSpectrumCache::Storage storage,
+                                                                     bool whiten = false)
+        {
+            const auto key = std::make_tuple(table, length, tableRate, sampleRate, frame, shift, (int)storage, whiten);
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = spectrumCaches.find(key);
+                if (found != spectrumCaches.end())
+                    return found->second;
+            }
+            return build(key);
+        }
+
+        /** Returns the cache if it has been built, otherwise queues it for the loader thread
+            and returns nullptr; ask again later. */
+        std::shared_ptr<const CarrierSpectrumCache> requestSpectrumCache(const float* table, int length, double tableRate, double sampleRate,
+                                                                         int frame, int shift, CarrierSpectrumCache::Storage storage,
+                                                                         bool whiten = false)
+        {
+            const auto key = std::make_tuple(table, length, tableRate, sampleRate, frame, shift, (int)storage, whiten);
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = spectrumCaches.find(key);
+                if (found != spectrumCaches.end())
+                    return found->second;
+                if (queued.insert(key).second)
+                    loadQueue.push_back(key);
+                if (! loader.joinable())
+                    loader = std::thread([this] { runLoader(); });
+            }
+            loadRequested.notify_one();
+            return nullptr;
+        }
+
+        /** Stores a cache built elsewhere (e.g. read from a carrier file) under this key, unless
+            one is there already; returns the one stored. */
+        std::shared_ptr<const CarrierSpectrumCache> addSpectrumCache(const float* table, int length, double tableRate, double sampleRate,
+                                                                     int frame, int shift, CarrierSpectrumCache::Storage storage,
+                                                                     bool whiten, std::shared_ptr<const CarrierSpectrumCache> cache)
+        {
+            const auto key = std::make_tuple(table, length, tableRate, sampleRate, frame, shift, (int)storage, whiten);
+            std::lock_guard<std::mutex> lock(registryLock);
+            return spectrumCaches.emplace(key, std::move(cache)).first->second;
+        }
+
+        /** Makes a table's cache from its mipmap without analysing it, or returns nullptr. */
+        using SpectrumSource = std::function<std::shared_ptr<const CarrierSpectrumCache>(std::shared_ptr<const CarrierMipmap>)>;
+
+        /** Precomputed spectra for this key (e.g. linked into the binary), used instead of
+            analysing the table by whichever thread builds the key first. make gets the
+            table's mipmap and returns the cache, or nullptr to analyse after all. */
+        void addSpectrumSource(const float* table, int length, double tableRate, double sampleRate,
+                               int frame, int shift, CarrierSpectrumCache::Storage storage, bool whiten,
+                               SpectrumSource make)
+        {
+            const auto key = std::make_tuple(table, length, tableRate, sampleRate, frame, shift, (int)storage, whiten);
+            std::lock_guard<std::mutex> lock(registryLock);
+            spectrumSources.emplace(key, std::move(make));
+        }
+
+        /** The mipmap read when the table at sampleRate is played at other pitches. */
+        std::shared_ptr<const CarrierMipmap> getMipmap(const float* table, int length, double tableRate, double sampleRate)
+        {
+            return getMipmap(std::make_tuple(table, length, tableRate, sampleRate), getTable(table, length, tableRate, sampleRate));
+        }
+
+    private:
+        /** Source table, its length and rate, the rate played at. */
+        using TableKey = std::tuple<const float*, int, double, double>;
+        /** TableKey followed by frame, shift, storage and whitening. */
+        using CacheKey = std::tuple<const float*, int, double, double, int, int, int, bool>;
+
+        std::mutex registryLock;
+        std::map<const uint8_t*, std::unique_ptr<const std::vector<float>>> decodedTables;
+        std::map<TableKey, std::unique_ptr<const std::vector<float>>> resampledTables;
+        std::map<TableKey, std::shared_ptr<const CarrierMipmap>> mipmaps;
+        std::vector<std::shared_ptr<const void>> keptTables;
+        /** A table from addTable(): its samples, and the handle its users hold. */
+        struct AddedTable
+        {
+            std::shared_ptr<const void> owner;
+            std::weak_ptr<const void> handle;
+        };
+        std::map<const float*, AddedTable> addedTables;
+        std::map<CacheKey, std::shared_ptr<const CarrierSpectrumCache>> spectrumCaches;
+        std::map<CacheKey, SpectrumSource> spectrumSources;
+
+        std::thread loader;
+        std::condition_variable loadRequested;
+        std::deque<CacheKey> loadQueue;
+        std::set<CacheKey> queued;
+        bool quit = false;
+
+        /** Resamples and builds outside the lock so lookups of other carriers are never held
+            up; if two threads race on the same key the first one stored wins. */
+        std::shared_ptr<const CarrierSpectrumCache> build(const CacheKey& key)
+        {
+            const auto tableKey = std::make_tuple(std::get<0>(key), std::get<1>(key), std::get<2>(key), std::get<3>(key));
+            const auto table = getTable(std::get<0>(key), std::get<1>(key), std::get<2>(key), std::get<3>(key));
+            auto mipmap = getMipmap(tableKey, table);
+            SpectrumSource source;
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = spectrumSources.find(key);
+                if (found != spectrumSources.end())
+                    source = found->second;
+            }
+            std::shared_ptr<const CarrierSpectrumCache> cache = source ? source(mipmap) : nullptr;
+            if (cache == nullptr)
+                cache = std::make_shared<const CarrierSpectrumCache>(table.samples, table.length, std::get<4>(key),
+                                                                     std::get<5>(key), (CarrierSpectrumCache::Storage)std::get<6>(key),
+                                                                     std::get<7>(key), std::move(mipmap));
+            std::lock_guard<std::mutex> lock(registryLock);
+            queued.erase(key);
+            return spectrumCaches.emplace(key, std::move(cache)).first->second;
+        }
+
+        /** Moves every entry of map built from table into released. */
+        template <typename Map>
+        static void eraseTable(Map& map, const float* table, std::vector<std::shared_ptr<const void>>& released)
+        {
+            for (auto entry = map.begin(); entry != map.end();)
+            {
+                if (std::get<0>(entry->first) != table)
+                {
+                    ++entry;
+                    continue;
+                }
+                released.push_back(std::shared_ptr<const void>(std::move(entry->second)));
+                entry = map.erase(entry);
+            }
+        }
+
+        /** One mipmap per table and rate, whatever the STFT layout of the caches that share it. */
+        std::shared_ptr<const CarrierMipmap> getMipmap(const TableKey& key, const Table& table)
+        {
+            {
+                std::lock_guard<std::mutex> lock(registryLock);
+                const auto found = mipmaps.find(key);
+                if (found != mipmaps.end())
+                    return found->second;
+            }
+            auto mipmap = std::make_shared<const CarrierMipmap>(table.samples, table.length);
+            std::lock_guard<std::mutex> lock(registryLock);
+            return mipmaps.emplace(key, std::move(mipmap)).first->second;
+        }
+
+        void runLoader()
+        {
+            for (;;)
+            {
+                CacheKey key;
+                std::shared_ptr<const void> handle;
+                {
+                    std::unique_lock<std::mutex> lock(registryLock);
+                    loadRequested.wait(lock, [this] { return quit || ! loadQueue.empty(); });
+                    if (quit)
+                        return;
+                    key = loadQueue.front();
+                    loadQueue.pop_front();
+                    if (spectrumCaches.count(key) != 0)
+                        continue;
+                    // a run-time table is held until the build is done; one nobody holds any
+                    // more is about to be released and is not worth building
+                    const auto added = addedTables.find(std::get<0>(key));
+                    if (added != addedTables.end())
+                    {
+                        handle = added->second.handle.lock();
+                        if (handle == nullptr)
+                        {
+                            queued.erase(key);
+                            continue;
+                        }
+                    }
+                }
+                build(key);
+                handle = nullptr;
+            }
+        }
+    };
+}
@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    CarrierResampler.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace DSP
+{
+    /** Offline polyphase resampler for looping carrier tables.
+
+        A Kaiser windowed sinc is tabulated at numPhases phases per input sample, and
+        each output sample sums the taps around its input position, interpolating
+        linearly between the two nearest phases; that handles any ratio, not just small
+        rational ones. When shrinking, the kernel is stretched so it also band-limits to
+        the new Nyquist. Input reads wrap around, so the resampled loop is as seamless
+        as the original. Runs once per table and rate, never on the audio thread.
+    */
+    class CarrierResampler
+    {
+    public:
+        /** zeroCrossings per side of the sinc, and stopband from the Kaiser beta (8 is about 80 dB). */
+        explicit CarrierResampler(int zeroCrossingsToUse = 64, int numPhasesToUse = 256, double beta = 8.0)
+            : zeroCrossings(zeroCrossingsToUse), numPhases(numPhasesToUse)
+        {
+            // one side of the prototype, u = 0 .. zeroCrossings in steps of 1/numPhases
+            kernel.resize((size_t)(zeroCrossings * numPhases + 2));
+            const auto pi = 3.14159265358979323846;
+            const auto normaliser = besselI0(beta);
+            for (size_t i = 0; i < kernel.size(); ++i)
+            {
+                const auto u = (double)i / numPhases;
+                const auto x = u / zeroCrossings;
+                const auto window = x < 1.0 ? besselI0(beta * std::sqrt(1.0 - x * x)) / normaliser : 0.0;
+                const auto sinc = u == 0.0 ? 1.0 : std::sin(pi * u) / (pi * u);
+                kernel[i] = sinc * window;
+            }
+        }
+
+        /** Resamples one loop of inLength samples to outLength samples. */
+        std::vector<float> process(const float* in, int inLength, int outLength) const
+        {
+            std::vector<float> out((size_t)outLength);
+            const auto ratio = (double)outLength / inLength;
+            // cutoff relative to the input Nyquist, a little under the lower of the two
+            const auto cutoff = std::min(1.0, ratio) * 0.95;
+            const auto halfWidth = zeroCrossings / cutoff;
+
+            for (int n = 0; n < outLength; ++n)
+            {
+                const auto position = n / ratio;
+                const auto first = (int)std::ceil(position - halfWidth);
+                const auto last = (int)std::floor(position + halfWidth);
+                double sum = 0.0;
+                for (int j = first; j <= last; ++j)
+                {
+                    auto index = j % inLength;
+                    if (index < 0)
+                        index += inLength;
+                    sum += in[index] * tap(std::fabs(position - j) * cutoff);
+                }
+                out[(size_t)n] = (float)(sum * cutoff);
+            }
+            return out;
+        }
+
+    private:
+        int zeroCrossings;
+        int numPhases;
+        std::vector<double> kernel;
+
+        /** Prototype at u zero crossings from the centre, between tabulated phases. */
+        double tap(double u) const
+        {
+            const auto scaled = u * numPhases;
+            const auto index = (size_t)scaled;
+            if (index + 1 >= kernel.size())
+                return 0.0;
+            const auto fraction = scaled - index;
+            return kernel[index] + fraction * (kernel[index + 1] - kernel[index]);
+        }
+
+        static double besselI0(double x)
+        {
+            double sum = 1.0, term = 1.0;
+            const auto quarterSquare = x * x * 0.25;
+            for (int k = 1; k < 50; ++k)
+            {
+                term *= quarterSquare / ((double)k * k);
+                sum += term;
+                if (term < sum * 1e-12)
+                    break;
+            }
+            return sum;
+        }
+    };
+}
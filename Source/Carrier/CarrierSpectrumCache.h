@@ -0,0 +1,424 @@
+/*
+  ==============================================================================
+
+    CarrierSpectrumCache.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "../STFT/STFT.h"
+#include "CarrierMipmap.h"
+
+namespace DSP
+{
+    /** Precomputed STFT frames of a looping carrier table.
+
+        The carrier loops forever and always advances by whole hops, so every frame
+        the vocoder can ask for starts on a grid of gcd(shift, tableLength) samples.
+        All of those frames (including the ones that wrap around the loop point) are
+        transformed once here, and the audio thread only has to read them back.
+    */
+    class CarrierSpectrumCache
+    {
+    public:
+        /** How the frames are stored. None keeps no frames at all and makes the
+            vocoder analyse the carrier live, Half/Float/Double trade memory for
+            precision (Half is a quarter of Double, at roughly 66 dB of headroom
+            below the loudest bin, which is far below audibility here). */
+        enum class Storage { None, Half, Float, Double };
+
+        /** With whiten set, every frame is multiplied by a per-bin gain that flattens the
+            carrier's long-term average spectrum, so the vocoder output does not inherit
+            its tilt. The gain is applied once here and costs nothing per hop.
+            mipmap, when given, must be built from the same table; it is what a live
+            analysis at another pitch reads. */
+        CarrierSpectrumCache(const float* table, int length, int frame, int shift, Storage storageToUse, bool whitenToUse = false,
+                             std::shared_ptr<const CarrierMipmap> mipmapToUse = nullptr)
+            : carrierTable(table), tableLength(length), frameSize(frame), shiftSize(shift), storage(storageToUse), whiten(whitenToUse),
+              mipmap(std::move(mipmapToUse))
+        {
+            gridSize = greatestCommonDivisor(shiftSize, tableLength);
+            numFrames = tableLength / gridSize;
+            frameLength = frameSize + 2;
+            whiteningGain.assign(frameLength / 2, 1.0);
+
+            rms = tableRms();
+
+            // same window and FFT as STFT so cached frames match the live path exactly
+            HannWindow window(frameSize, shiftSize);
+            Ooura_FFT fft(frameSize, 1);
+            std::vector<double> temp(frameLength);
+
+            if (whiten)
+                computeWhiteningGain(window, fft, temp);
+
+            if (storage == Storage::None)
+                return;
+
+            const auto numValues = (size_t)numFrames * (size_t)frameLength;
+            if (storage == Storage::Double)
+                doubleFrames.resize(numValues);
+            else if (storage == Storage::Float)
+                floatFrames.resize(numValues);
+            else
+                halfFrames.resize(numValues);
+
+            for (int index = 0; index < numFrames; ++index)
+            {
+                analyseFrame(index, window, fft, temp);
+                if (whiten)
+                {
+                    for (int i = 0; i < frameLength; ++i)
+                        temp[i] *= whiteningGain[i / 2];
+                }
+                storeFrame(index, temp.data());
+            }
+            pointAtFrames(doubleFrames.data(), floatFrames.data(), halfFrames.data());
+        }
+
+        /** Uses frames computed before, e.g. read from a carrier file, instead of analysing the
+            table: frames holds getNumFrames() frames in storageToUse and whitening gain already
+            applied, and is not copied. owner keeps the memory behind frames alive. */
+        CarrierSpectrumCache(const float* table, int length, int frame, int shift, Storage storageToUse, bool whitenToUse,
+                             const float* whiteningGainToUse, const void* frames, std::shared_ptr<const void> owner,
+                             std::shared_ptr<const CarrierMipmap> mipmapToUse = nullptr)
+            : carrierTable(table), tableLength(length), frameSize(frame), shiftSize(shift), storage(storageToUse), whiten(whitenToUse),
+              mipmap(std::move(mipmapToUse)), frameOwner(std::move(owner))
+        {
+            gridSize = greatestCommonDivisor(shiftSize, tableLength);
+            numFrames = tableLength / gridSize;
+            frameLength = frameSize + 2;
+            whiteningGain.assign(whiteningGainToUse, whiteningGainToUse + frameLength / 2);
+            rms = tableRms();
+            pointAtFrames(static_cast<const double*>(frames), static_cast<const float*>(frames), static_cast<const uint16_t*>(frames));
+        }
+
+        bool hasFrames() const { return storage != Storage::None; }
+        Storage getStorage() const { return storage; }
+        const float* getTable() const { return carrierTable; }
+        int getTableLength() const { return tableLength; }
+        int getFrameSize() const { return frameSize; }
+        int getShiftSize() const { return shiftSize; }
+        int getGridSize() const { return gridSize; }
+        int getNumFrames() const { return numFrames; }
+        bool isWhitened() const { return whiten; }
+
+        /** Band-limited levels of the table for reading it at other rates, or nullptr. */
+        const CarrierMipmap* getMipmap() const { return mipmap.get(); }
+
+        /** RMS of the table; whitening keeps the total power, so this is the level of the frames too. */
+        double getRms() const { return rms; }
+
+        /** Per-bin gain (frame/2 + 1 values) already folded into the cached frames; all
+            ones unless whitened. A live analysis of the table has to apply it itself. */
+        const double* getWhiteningGain() const { return whiteningGain.data(); }
+
+        /** The frames as stored, getNumFrames() * (frame + 2) values, for writing them out. */
+        const void* getFrameData() const
+        {
+            return storage == Storage::Double ? (const void*)doubleData
+                 : storage == Storage::Float ? (const void*)floatData : (const void*)halfData;
+        }
+
+        size_t getFrameDataSize() const
+        {
+            return getFrameDataSizeFor(tableLength, frameSize, shiftSize, storage);
+        }
+
+        /** What getFrameDataSize() will be for a table of this length, before building it.
+            Lengths with few factors of two in common with the shift need a frame every few samples. */
+        static size_t getFrameDataSizeFor(int length, int frame, int shift, Storage storage)
+        {
+            const auto valueSize = storage == Storage::Double ? sizeof(double)
+                                 : storage == Storage::Float ? sizeof(float)
+                                 : storage == Storage::Half ? sizeof(uint16_t) : 0;
+            const auto frames = length / greatestCommonDivisor(shift, length);
+            return (size_t)frames * (size_t)(frame + 2) * valueSize;
+        }
+
+        /** True when the hop starting at this table position has a cached frame. */
+        bool hasFrameAt(int position) const
+        {
+            return hasFrames() && (position % gridSize) == 0;
+        }
+
+        int getFrameIndex(int position) const
+        {
+            return (wrap(position) / gridSize) % numFrames;
+        }
+
+        /** Copies one frame (frame + 2 values, half FFT in complex) into dest. */
+        void readFrame(int index, double* dest) const
+        {
+            const auto offset = (size_t)index * (size_t)frameLength;
+            if (storage == Storage::Double)
+            {
+                std::memcpy(dest, doubleData + offset, sizeof(double) * frameLength);
+            }
+            else if (storage == Storage::Float)
+            {
+                const auto* src = floatData + offset;
+                for (int i = 0; i < frameLength; ++i)
+                    dest[i] = src[i];
+            }
+            else if (storage == Storage::Half)
+            {
+                const auto* src = halfData + offset;
+                for (int i = 0; i < frameLength; ++i)
+                    dest[i] = halfToFloat(src[i]);
+            }
+        }
+
+        /** The spectrum of a hop starting anywhere in the table (position in [0, length)),
+            read between the two cached frames around it: magnitudes are interpolated
+            linearly and the phases are the nearer frame's, so two frames with unrelated
+            phases do not cancel part way. scratch holds frame + 2 values. */
+        void readFrameBetween(double position, double* dest, double* scratch) const
+        {
+            const auto gridPosition = position / gridSize;
+            const auto index = (int)gridPosition;
+            const auto fraction = gridPosition - index;
+            const auto before = index % numFrames;
+            const auto after = (before + 1) % numFrames;
+            const bool nearBefore = fraction < 0.5;
+            readFrame(nearBefore ? before : after, dest);
+            if (fraction == 0.0)
+                return;
+
+            readFrame(nearBefore ? after : before, scratch);
+            const auto nearWeight = nearBefore ? 1.0 - fraction : fraction;
+            for (int k = 0; k < frameLength; k += 2)
+            {
+                const auto nearMagnitude = std::sqrt(dest[k] * dest[k] + dest[k+1] * dest[k+1]);
+                const auto farMagnitude = std::sqrt(scratch[k] * scratch[k] + scratch[k+1] * scratch[k+1]);
+                const auto magnitude = nearWeight * nearMagnitude + (1.0 - nearWeight) * farMagnitude;
+                const auto gain = nearMagnitude > 0.0 ? magnitude / nearMagnitude : 0.0;
+                dest[k] *= gain;
+                dest[k+1] *= gain;
+            }
+        }
+
+        /** Accumulates gain * frame into dest. */
+        void addFrame(int index, double gain, double* dest) const
+        {
+            const auto offset = (size_t)index * (size_t)frameLength;
+            if (storage == Storage::Double)
+            {
+                const auto* src = doubleData + offset;
+                for (int i = 0; i < frameLength; ++i)
+                    dest[i] += gain * src[i];
+            }
+            else if (storage == Storage::Float)
+            {
+                const auto* src = floatData + offset;
+                for (int i = 0; i < frameLength; ++i)
+                    dest[i] += gain * src[i];
+            }
+            else if (storage == Storage::Half)
+            {
+                const auto* src = halfData + offset;
+                for (int i = 0; i < frameLength; ++i)
+                    dest[i] += gain * halfToFloat(src[i]);
+            }
+        }
+
+        /** Heap memory held by the cache; frames in a mapped carrier file are not counted. */
+        size_t getMemorySize() const
+        {
+            return doubleFrames.size() * sizeof(double)
+                 + floatFrames.size() * sizeof(float)
+                 + halfFrames.size() * sizeof(uint16_t)
+                 + whiteningGain.size() * sizeof(double);
+        }
+
+    private:
+        /** Fills temp with the spectrum of the frame for the hop at index * gridSize. */
+        void analyseFrame(int index, HannWindow& window, Ooura_FFT& fft, std::vector<double>& temp) const
+        {
+            // STFT frames end at the last sample of the current hop
+            const auto hopStart = index * gridSize;
+            const auto frameStart = hopStart + shiftSize - frameSize;
+            for (int i = 0; i < frameSize; ++i)
+                temp[i] = carrierTable[wrap(frameStart + i)];
+            temp[frameSize] = 0.0;
+            temp[frameSize + 1] = 0.0;
+
+            window.Process(temp.data());
+            fft.FFT(temp.data());
+        }
+
+        /** Long-term average power over the loop, then the gain that brings each bin to the
+            mean power (boost capped at 40 dB for near-empty bins). The average is taken over
+            frames a hop apart, which cover every sample: a table whose length shares few
+            factors with the hop has a grid frame every few samples, and analysing all of
+            them would cost an FFT per sample even when no frames are cached. */
+        void computeWhiteningGain(HannWindow& window, Ooura_FFT& fft, std::vector<double>& temp)
+        {
+            const auto numBins = frameLength / 2;
+            const auto framesPerHop = shiftSize / gridSize;
+            std::vector<double> power(numBins, 0.0);
+            for (int index = 0; index < numFrames; index += framesPerHop)
+            {
+                analyseFrame(index, window, fft, temp);
+                for (int k = 0; k < numBins; ++k)
+                    power[k] += temp[2*k] * temp[2*k] + temp[2*k + 1] * temp[2*k + 1];
+            }
+
+            double meanPower = 0.0;
+            for (auto p : power)
+                meanPower += p;
+            meanPower /= numBins;
+            if (meanPower <= 0.0)
+                return;
+
+            const auto floor = meanPower * 1e-4;
+            for (int k = 0; k < numBins; ++k)
+                whiteningGain[k] = std::sqrt(meanPower / (power[k] > floor ? power[k] : floor));
+        }
+
+        double tableRms() const
+        {
+            double sumOfSquares = 0.0;
+            for (int i = 0; i < tableLength; ++i)
+                sumOfSquares += (double)carrierTable[i] * carrierTable[i];
+            return tableLength > 0 ? std::sqrt(sumOfSquares / tableLength) : 0.0;
+        }
+
+        /** readFrame() and addFrame() read through these, whoever owns the frames. */
+        void pointAtFrames(const double* doubles, const float* floats, const uint16_t* halves)
+        {
+            doubleData = storage == Storage::Double ? doubles : nullptr;
+            floatData = storage == Storage::Float ? floats : nullptr;
+            halfData = storage == Storage::Half ? halves : nullptr;
+        }
+
+        int wrap(int position) const
+        {
+            position %= tableLength;
+            return position < 0 ? position + tableLength : position;
+        }
+
+        void storeFrame(int index, const double* src)
+        {
+            const auto offset = (size_t)index * (size_t)frameLength;
+            for (int i = 0; i < frameLength; ++i)
+            {
+                if (storage == Storage::Double)
+                    doubleFrames[offset + i] = src[i];
+                else if (storage == Storage::Float)
+                    floatFrames[offset + i] = (float)src[i];
+                else
+                    halfFrames[offset + i] = floatToHalf((float)src[i]);
+            }
+        }
+
+        static int greatestCommonDivisor(int a, int b)
+        {
+            while (b != 0)
+            {
+                const auto t = a % b;
+                a = b;
+                b = t;
+            }
+            return a;
+        }
+
+        /** IEEE 754 binary16 conversion, round to nearest even. */
+        static uint16_t floatToHalf(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            const auto sign = (uint16_t)((bits >> 16) & 0x8000u);
+            const auto exponent = (int)((bits >> 23) & 0xffu) - 127 + 15;
+            auto mantissa = bits & 0x7fffffu;
+
+            if (exponent >= 31)
+                return (uint16_t)(sign | 0x7c00u);
+
+            if (exponent <= 0)
+            {
+                if (exponent < -10)
+                    return sign;
+                mantissa |= 0x800000u;
+                const auto shift = (uint32_t)(14 - exponent);
+                auto half = mantissa >> shift;
+                const auto rest = mantissa & ((1u << shift) - 1u);
+                const auto halfway = 1u << (shift - 1u);
+                if (rest > halfway || (rest == halfway && (half & 1u)))
+                    ++half;
+                return (uint16_t)(sign | half);
+            }
+
+            auto half = (uint32_t)(exponent << 10) | (mantissa >> 13);
+            const auto rest = mantissa & 0x1fffu;
+            if (rest > 0x1000u || (rest == 0x1000u && (half & 1u)))
+                ++half;
+            return (uint16_t)(sign | half);
+        }
+
+        static float halfToFloat(uint16_t half)
+        {
+            const auto sign = (uint32_t)(half & 0x8000u) << 16;
+            auto exponent = (uint32_t)(half >> 10) & 0x1fu;
+            auto mantissa = (uint32_t)half & 0x3ffu;
+            uint32_t bits;
+
+            if (exponent == 0)
+            {
+                if (mantissa == 0)
+                {
+                    bits = sign;
+                }
+                else
+                {
+                    exponent = 127 - 15 + 1;
+                    while ((mantissa & 0x400u) == 0)
+                    {
+                        mantissa <<= 1;
+                        --exponent;
+                    }
+                    bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+                }
+            }
+            else if (exponent == 31)
+            {
+                bits = sign | 0x7f800000u | (mantissa << 13);
+            }
+            else
+            {
+                bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+            }
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        const float* carrierTable;
+        int tableLength;
+        int frameSize;
+        int shiftSize;
+        int frameLength;
+        int gridSize;
+        int numFrames;
+        Storage storage;
+        bool whiten;
+        double rms;
+        std::shared_ptr<const CarrierMipmap> mipmap;
+        std::shared_ptr<const void> frameOwner;
+        const double* doubleData = nullptr;
+        const float* floatData = nullptr;
+        const uint16_t* halfData = nullptr;
+
+        std::vector<double> whiteningGain;
+        std::vector<double> doubleFrames;
+        std::vector<float> floatFrames;
+        std::vector<uint16_t> halfFrames;
+    };
+}
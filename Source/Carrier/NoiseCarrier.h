@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    NoiseCarrier.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../STFT/STFT.h"
+
+namespace DSP
+{
+    /** Precomputed STFT frames of white noise, the carrier for unvoiced sounds.
+
+        numFrames frames of unit RMS noise go through the same window and FFT as the
+        carrier cache, so at a gain equal to a carrier's RMS they sit at that carrier's
+        level. Every hop picks one at random: repeating a single frame would buzz at the
+        hop rate, and a fixed cycle would be heard as a loop.
+    */
+    class NoiseCarrier
+    {
+    public:
+        NoiseCarrier() {}
+
+        /** Allocates and runs numFrames FFTs, so call it from prepareToPlay. */
+        void prepare(int frameToUse, int shiftToUse, int numFramesToUse = 32)
+        {
+            frameLength = frameToUse + 2;
+            numFrames = numFramesToUse;
+            frames.resize((size_t)numFrames * (size_t)frameLength);
+
+            HannWindow window(frameToUse, shiftToUse);
+            Ooura_FFT fft(frameToUse, 1);
+            std::vector<double> temp(frameLength);
+            std::mt19937 generator(20261020);
+            std::normal_distribution<double> noise(0.0, 1.0);
+
+            for (int index = 0; index < numFrames; ++index)
+            {
+                for (int i = 0; i < frameToUse; ++i)
+                    temp[i] = noise(generator);
+                temp[frameToUse] = 0.0;
+                temp[frameToUse + 1] = 0.0;
+                window.Process(temp.data());
+                fft.FFT(temp.data());
+
+                auto* frame = frames.data() + (size_t)index * (size_t)frameLength;
+                for (int i = 0; i < frameLength; ++i)
+                    frame[i] = (float)temp[i];
+            }
+        }
+
+        bool isPrepared() const { return numFrames > 0; }
+
+        /** A random noise frame (frame + 2 values, half FFT in complex). */
+        const float* nextFrame()
+        {
+            // xorshift: cheap, allocation free and good enough to pick a frame
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return frames.data() + (size_t)(state % (uint32_t)numFrames) * (size_t)frameLength;
+        }
+
+    private:
+        int frameLength = 0;
+        int numFrames = 0;
+        uint32_t state = 2463534242u;
+        std::vector<float> frames;
+    };
+}
@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    DeferredSwap.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace DSP
+{
+    /** Hands an object built off the audio thread to the audio thread without locks,
+        and frees the object it replaces only once the audio thread is done with it.
+
+        Audio thread: get() during a block and use the pointer for that block only. The
+        owner counts finished audio blocks in one counter that every swap reads.
+        Any other single thread (message thread, loader): publish() new objects and call
+        collect() now and then; an object retired during audio block n is deleted once
+        block n has finished. Nothing on the audio side allocates, frees or waits.
+    */
+    template <typename ObjectType>
+    class DeferredSwap
+    {
+    public:
+        /** blockCounter is incremented by the audio thread at the end of every block. */
+        explicit DeferredSwap(const std::atomic<uint64_t>& blockCounter) : completedBlocks(blockCounter) {}
+
+        ~DeferredSwap()
+        {
+            delete current.load();
+        }
+
+        /** Audio thread: the latest published object, or nullptr. */
+        ObjectType* get() const { return current.load(std::memory_order_acquire); }
+
+        /** Publishing thread: makes next current and retires the previous object. */
+        void publish(std::unique_ptr<ObjectType> next)
+        {
+            auto* previous = current.exchange(next.release(), std::memory_order_acq_rel);
+            if (previous != nullptr)
+            {
+                // a block in flight may still hold previous; it is done once the count moves on
+                retired.emplace_back(std::unique_ptr<ObjectType>(previous),
+                                     completedBlocks.load(std::memory_order_acquire));
+            }
+            collect();
+        }
+
+        /** Publishing thread: deletes retired objects the audio thread can no longer see. */
+        void collect()
+        {
+            const auto done = completedBlocks.load(std::memory_order_acquire);
+            for (size_t i = 0; i < retired.size();)
+            {
+                if (done > retired[i].second)
+                {
+                    std::swap(retired[i], retired.back());
+                    retired.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        /** Publishing thread, when the audio thread is known to be stopped. */
+        void collectAll() { retired.clear(); }
+
+    private:
+        std::atomic<ObjectType*> current { nullptr };
+        const std::atomic<uint64_t>& completedBlocks;
+        std::vector<std::pair<std::unique_ptr<ObjectType>, uint64_t> > retired;
+
+        DeferredSwap(const DeferredSwap&) = delete;
+        DeferredSwap& operator=(const DeferredSwap&) = delete;
+    };
+}
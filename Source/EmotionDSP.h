@@ -9,6 +9,7 @@
 */
 
 #pragma once
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <cmath>
@@ -16,6 +17,16 @@
 #include <numbers>
 #include <utility>
 #include "STFT/STFT.h"
+#include "Carrier/CarrierOscillator.h"
+#include "Carrier/CarrierSpectrumCache.h"
+#include "Modulator/MelFilterbank.h"
+#include "Modulator/CepstralEnvelope.h"
+#include "Modulator/LpcEnvelope.h"
+#include "Modulator/EnvelopeSmoother.h"
+#include "Modulator/FormantShift.h"
+#include "Modulator/PitchTracker.h"
+#include "Modulator/VoicingDetector.h"
+#include "Carrier/NoiseCarrier.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -63,6 +74,14 @@ namespace DSP
             state[1] = lv2;
         }
 
+        void getCoefficients(float& outB0, float& outB1, float& outB2, float& outA1, float& outA2) const
+        {
+            outB0 = b0;
+            outB1 = b1;
+            outB2 = b2;
+            outA1 = a1;
+            outA2 = a2;
+        }
 
     private:
         /** Filter coefficients. */
@@ -74,10 +93,91 @@ namespace DSP
     class MyUtils
     {
     public:
+        /** How the modulator spectrum is turned into the envelope that shapes the carrier.
+            Raw uses every bin's magnitude, Mel smooths it through a mel filterbank,
+            Cepstrum keeps only the low quefrencies of its log (the formants), LPC fits
+            an all-pole model to the hop and skips the modulator FFT altogether. */
+        enum class EnvelopeMode { Raw, Mel, Cepstrum, LPC };
+
         MyUtils() {
             //mySTFT = STFT(ch,frame,shift);
         }
 
+        /** Builds the sample rate dependent envelope tables; allocates, so call it from prepareToPlay. */
+        void prepare(double sampleRate, int numMelBands = 64, int numCepstralCoefficients = 32, int lpcOrder = 24)
+        {
+            melFilterbank.prepare(frame / 2 + 1, numMelBands, sampleRate);
+            melBands.assign(numMelBands, 0.0);
+            cepstralEnvelope.prepare(frame / 2 + 1, numCepstralCoefficients);
+            lpcEnvelope.prepare(frame, shift, lpcOrder);
+            binSmoother.prepare(frame / 2 + 1, shift, sampleRate);
+            bandSmoother.prepare(numMelBands, shift, sampleRate);
+            pitchTracker.prepare(frame, shift, sampleRate);
+            voicingDetector.prepare(frame / 2 + 1, sampleRate);
+            noiseCarrier.prepare(frame, shift);
+        }
+
+        /** How far unvoiced hops (sibilants, plosives) crossfade from the carrier to noise:
+            0 never, 1 fully for a frame that is clearly unvoiced. Equal-power, at the
+            carrier's level. Safe to call from the audio thread. */
+        void setUnvoicedBlend(float amount) { unvoicedBlend = amount; }
+
+        /** 0 (voiced) to 1 (unvoiced) for the last hop. */
+        float getUnvoiced() const { return unvoiced; }
+
+        /** With tracking on, every hop reads the carrier at modulator pitch / referenceFrequency
+            (from band-limited mipmap levels, live STFT instead of the cache), so the carrier follows the
+            voice's intonation; unvoiced hops keep the last rate. Needs the modulator FFT, so
+            the LPC envelope keeps the carrier at its own pitch. Safe to call from the audio thread. */
+        void setPitchTracking(bool enabled, double referenceFrequency)
+        {
+            pitchTracking = enabled && pitchTracker.isPrepared();
+            pitchReference = referenceFrequency;
+            if (! pitchTracking)
+                carrierRate = 1.0;
+        }
+
+        /** How the carrier is interpolated when it is read at another pitch. Safe to call from the audio thread. */
+        void setCarrierInterpolation(CarrierOscillator::Interpolation interpolation) { carrierInterpolation = interpolation; }
+
+        /** With scanning on, a carrier position between hops of the cache grid reads between
+            its two nearest cached frames instead of analysing the table there, so a carrier
+            scanned at any speed or jittered costs no more than one played straight through.
+            Off, only on-grid positions come from the cache. Safe to call from the audio thread. */
+        void setScanning(bool enabled) { scanning = enabled; }
+
+        /** Stacks voices copies of the carrier (1 for just the carrier): voice v of n reads the
+            table spreadSamples * v / (n - 1) further on, so the first and last are spreadSamples
+            apart, and is detuned evenly from -detuneCents to +detuneCents. Each voice is a cached
+            frame, read between frames off the grid and detuned by moving its bins, and the stack
+            is scaled to the power of one voice before the modulator shapes it, so a stack costs
+            frame reads and adds rather than vocoders. Safe to call from the audio thread. */
+        void setUnison(int voices, double spreadSamples, double detuneCents)
+        {
+            unisonVoices = std::max(1, voices);
+            unisonSpread = spreadSamples;
+            unisonDetune = detuneCents;
+        }
+
+        /** Carrier samples read per output sample in the last hop. */
+        double getCarrierRate() const { return carrierRate; }
+
+        /** Remap applied to the envelope before the carrier multiply, nullptr for none.
+            It must stay alive until the next call; safe to call from the audio thread. */
+        void setFormantShift(const FormantShift* shift) { formantShift = shift; }
+
+        /** Attack/release times of the frame to frame envelope smoothing, 0 for none.
+            Safe to call from the audio thread. */
+        void setSmoothing(double attackSeconds, double releaseSeconds)
+        {
+            binSmoother.setTimes(attackSeconds, releaseSeconds);
+            bandSmoother.setTimes(attackSeconds, releaseSeconds);
+        }
+
+        /** Safe to call from the audio thread. Modes other than Raw fall back to Raw until prepare() has run. */
+        void setEnvelopeMode(EnvelopeMode mode) { envelopeMode = mode; }
+        EnvelopeMode getEnvelopeMode() const { return envelopeMode; }
+
         float calculateRMS(const float *data, double numSamples)
         {
             if (numSamples <= 0)
@@ -195,8 +295,115 @@ namespace DSP
             }
             applyISTFT(multipliedSTFT, vocoderOut);
         }
-        
-        
+
+        /** Vocoder against a looping carrier table starting at carrierPosition.
+            Carrier frames are read from the cache whenever the hop lands on its grid,
+            so only the modulator FFT and the synthesis iFFT run per hop. */
+        void applyVocoder(const CarrierSpectrumCache& carrier, int carrierPosition, std::vector<double>& modulatorIn, std::vector<double>& vocoderOut)
+        {
+            int restNum = modulatorIn.size() % shift;
+            if (restNum != 0)
+            {
+                for (int i = 0; i < (shift - restNum); i++)
+                {
+                    modulatorIn.emplace_back(0.0);
+                }
+            }
+
+            int numShift = modulatorIn.size() / shift;
+            std::vector<double> hopOut(shift);
+            for (int i = 0; i < numShift; i++)
+            {
+                processHop<double>(carrier, carrierPosition, modulatorIn.data() + i*shift, hopOut.data());
+                for (int k = 0; k < shift; k++)
+                {
+                    vocoderOut.emplace_back(hopOut[k]);
+                }
+                carrierPosition = (carrierPosition + shift) % carrier.getTableLength();
+            }
+        }
+
+        /** One hop of the vocoder: shift samples of modulator in, shift samples out.
+            The hop's carrier starts at carrierPosition in the carrier table, which may
+            fall between samples. SampleType can be short, float or double; samples are converted straight
+            into and out of the STFT buffers. */
+        template <typename SampleType>
+        void processHop(const CarrierSpectrumCache& carrier, double carrierPosition, const SampleType* modulatorHop, SampleType* vocoderOut)
+        {
+            processHop(carrier, carrier, 0.0f, carrierPosition, modulatorHop, vocoderOut);
+        }
+
+        /** processHop against a morph of two carriers: 0 is all first, 1 all second, with an
+            equal-power (cos/sin) crossfade of their spectra in between. Both tables are read
+            at carrierPosition, wrapped to each table's own length. */
+        template <typename SampleType>
+        void processHop(const CarrierSpectrumCache& first, const CarrierSpectrumCache& second, float morph,
+                        double carrierPosition, const SampleType* modulatorHop, SampleType* vocoderOut)
+        {
+            analyseModulator(modulatorHop);
+            if (&first == &second || morph <= 0.0f)
+            {
+                getCarrierSpectrum(first, carrierPosition, carrierSTFT, carrierSpectrum.data());
+            }
+            else if (morph >= 1.0f)
+            {
+                getCarrierSpectrum(second, carrierPosition, carrierSTFT, carrierSpectrum.data());
+            }
+            else
+            {
+                getCarrierSpectrum(first, carrierPosition, carrierSTFT, carrierSpectrum.data());
+                getCarrierSpectrum(second, carrierPosition, morphSTFT, morphSpectrum.data());
+                const auto angle = morph * 0.5 * M_PI;
+                const auto firstGain = std::cos(angle);
+                const auto secondGain = std::sin(angle);
+                for (int k = 0; k < (frame+2); k++)
+                {
+                    carrierSpectrum[k] = firstGain * carrierSpectrum[k] + secondGain * morphSpectrum[k];
+                }
+            }
+            if (unvoiced > 0.0f && unvoicedBlend > 0.0f)
+            {
+                blendNoise(carrierLevel(first, second, morph));
+            }
+            synthesise(vocoderOut);
+        }
+
+        /** processHop against a live carrier (e.g. a sidechain): carrierHop is shift samples
+            analysed straight from wherever they are, with no copy or cache. There is no
+            table to read at another rate, so pitch tracking does not apply. */
+        template <typename SampleType>
+        void processHop(const SampleType* carrierHop, const SampleType* modulatorHop, SampleType* vocoderOut)
+        {
+            analyseModulator(modulatorHop);
+            carrierSTFT.stft<SampleType>(carrierHop, carrierSpectrum.data());
+            if (unvoiced > 0.0f && unvoicedBlend > 0.0f)
+            {
+                double sum = 0.0;
+                for (int j = 0; j < shift; j++)
+                {
+                    sum += (double)carrierHop[j] * carrierHop[j];
+                }
+                blendNoise(std::sqrt(sum / shift));
+            }
+            synthesise(vocoderOut);
+        }
+
+        /** Batch version of processHop for offline use: vocodes numHops whole hops
+            from in to out and returns the carrier position after the last one. */
+        template <typename SampleType>
+        int processHops(const CarrierSpectrumCache& carrier, int carrierPosition, const SampleType* in, SampleType* out, int numHops)
+        {
+            for (int i = 0; i < numHops; i++)
+            {
+                processHop(carrier, carrierPosition, in + i*shift, out + i*shift);
+                carrierPosition = (carrierPosition + shift) % carrier.getTableLength();
+            }
+            return carrierPosition;
+        }
+
+        int getFrameSize() const { return frame; }
+        int getShiftSize() const { return shift; }
+
 
     private:
         const int ch = 1;
@@ -205,6 +412,283 @@ namespace DSP
         const int frame = 1024;
         const int shift = 1024;
         STFT mySTFT = STFT(ch,frame,shift);
+        STFT carrierSTFT = STFT(ch,frame,shift);
+
+        std::vector<double> modulatorSpectrum = std::vector<double>(frame + 2);
+        std::vector<double> carrierSpectrum = std::vector<double>(frame + 2);
+        std::vector<double> carrierHop = std::vector<double>(shift);
+        /** Second carrier of a morph, analysed with its own STFT state. */
+        STFT morphSTFT = STFT(ch,frame,shift);
+        std::vector<double> morphSpectrum = std::vector<double>(frame + 2);
+        /** The farther frame of a read between cached frames. */
+        std::vector<double> scanSpectrum = std::vector<double>(frame + 2);
+        /** One unison voice before it is detuned into the stack. */
+        std::vector<double> voiceSpectrum = std::vector<double>(frame + 2);
+        std::vector<double> voiceMagnitude = std::vector<double>(frame/2 + 1);
+        std::vector<double> modulatorEnvelope = std::vector<double>(frame/2 + 1);
+
+        EnvelopeMode envelopeMode = EnvelopeMode::Raw;
+        MelFilterbank melFilterbank;
+        std::vector<double> melBands;
+        CepstralEnvelope cepstralEnvelope;
+        LpcEnvelope lpcEnvelope;
+        /** Mel mode smooths its bands, the other modes every bin. */
+        EnvelopeSmoother binSmoother;
+        EnvelopeSmoother bandSmoother;
+        const FormantShift* formantShift = nullptr;
+        PitchTracker pitchTracker;
+        VoicingDetector voicingDetector;
+        NoiseCarrier noiseCarrier;
+        float unvoicedBlend = 0.0f;
+        float unvoiced = 0.0f;
+        bool pitchTracking = false;
+        double pitchReference = 200.0;
+        double carrierRate = 1.0;
+        bool scanning = false;
+        int unisonVoices = 1;
+        double unisonSpread = 0.0;
+        double unisonDetune = 0.0;
+        CarrierOscillator::Interpolation carrierInterpolation = CarrierOscillator::Interpolation::Linear;
+        std::vector<double> shiftedEnvelope = std::vector<double>(frame/2 + 1);
+
+        /** Modulator envelope of one hop, formant shift included. */
+        template <typename SampleType>
+        void analyseModulator(const SampleType* modulatorHop)
+        {
+            if (envelopeMode == EnvelopeMode::LPC && lpcEnvelope.isPrepared())
+            {
+                // the LPC fit keeps its own frame of input; the STFT's is not fed meanwhile,
+                // which with frame == shift holds nothing to go stale
+                lpcEnvelope.process(modulatorHop, modulatorEnvelope.data());
+                detectVoicing();
+                binSmoother.process(modulatorEnvelope.data());
+                carrierRate = 1.0;
+            }
+            else
+            {
+                mySTFT.stft<SampleType>(modulatorHop, modulatorSpectrum.data());
+                if (pitchTracking)
+                    trackPitch();
+                getModulatorEnvelope();
+            }
+            if (formantShift != nullptr && ! formantShift->isIdentity())
+            {
+                formantShift->apply(modulatorEnvelope.data(), shiftedEnvelope.data());
+                std::swap(modulatorEnvelope, shiftedEnvelope);
+            }
+        }
+
+        /** Carrier spectrum times modulator envelope, back to shift samples. */
+        template <typename SampleType>
+        void synthesise(SampleType* vocoderOut)
+        {
+            for (int k = 0; k < (frame+2); k = k + 2)//carrier multiplied by modulator envelope
+            {
+                modulatorSpectrum[k] = carrierSpectrum[k] * modulatorEnvelope[k/2];
+                modulatorSpectrum[k+1] = carrierSpectrum[k+1] * modulatorEnvelope[k/2];
+            }
+
+            mySTFT.istft<SampleType>(modulatorSpectrum.data(), vocoderOut);
+        }
+
+        void getModulatorEnvelope()
+        {
+            for (int k = 0; k < (frame+2); k = k + 2)
+            {
+                modulatorEnvelope[k/2] = std::sqrt(modulatorSpectrum[k]*modulatorSpectrum[k] + modulatorSpectrum[k+1]*modulatorSpectrum[k+1]);
+            }
+            detectVoicing();
+
+            if (envelopeMode == EnvelopeMode::Mel && melFilterbank.getNumBands() > 0)
+            {
+                melFilterbank.analyse(modulatorEnvelope.data(), melBands.data());
+                bandSmoother.process(melBands.data());
+                melFilterbank.interpolate(melBands.data(), modulatorEnvelope.data());
+                return;
+            }
+
+            if (envelopeMode == EnvelopeMode::Cepstrum && cepstralEnvelope.isPrepared())
+            {
+                cepstralEnvelope.process(mySTFT, modulatorEnvelope.data());
+            }
+            binSmoother.process(modulatorEnvelope.data());
+        }
+
+        /** One hop of carrier spectrum into spectrum, every unison voice summed. */
+        void getCarrierSpectrum(const CarrierSpectrumCache& carrier, double carrierPosition, STFT& stft, double* spectrum)
+        {
+            if (unisonVoices == 1)
+            {
+                getVoiceSpectrum(carrier, carrierPosition, stft, spectrum);
+                return;
+            }
+
+            // frame == shift, so one STFT can analyse every voice that is not cached
+            const auto power = [this] (const double* bins)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < (frame+2); k++)
+                    sum += bins[k] * bins[k];
+                return sum;
+            };
+            double voicePower = 0.0;
+            std::fill(spectrum, spectrum + frame + 2, 0.0);
+            for (int voice = 0; voice < unisonVoices; ++voice)
+            {
+                const auto spread = (double)voice / (unisonVoices - 1);
+                const auto detune = unisonDetune * (2.0 * spread - 1.0);
+                getVoiceSpectrum(carrier, carrierPosition + unisonSpread * spread, stft, voiceSpectrum.data());
+                voicePower += power(voiceSpectrum.data());
+                addDetuned(voiceSpectrum.data(), std::pow(2.0, detune / 1200.0), 1.0, spectrum);
+            }
+
+            // the stack has the power of one average voice however alike the voices are:
+            // 1/n when they coincide (no spread or detune), 1/sqrt(n) when they are unrelated,
+            // and never more than one voice's gain where they happen to cancel
+            const auto stackPower = power(spectrum);
+            if (stackPower > 0.0)
+            {
+                const auto gain = std::min(1.0, std::sqrt(voicePower / unisonVoices / stackPower));
+                for (int k = 0; k < (frame+2); k++)
+                    spectrum[k] *= gain;
+            }
+        }
+
+        /** gain times spectrum source with every bin moved to ratio times its frequency, added
+            to dest. A bin that lands between source bins takes their interpolated magnitude
+            and the nearer one's phase, as a read between cache frames does. */
+        void addDetuned(const double* source, double ratio, double gain, double* dest)
+        {
+            if (ratio == 1.0)
+            {
+                for (int k = 0; k < (frame+2); k++)
+                    dest[k] += gain * source[k];
+                return;
+            }
+
+            const int lastBin = frame / 2;
+            for (int k = 0; k <= lastBin; k++)
+                voiceMagnitude[k] = std::sqrt(source[2*k] * source[2*k] + source[2*k + 1] * source[2*k + 1]);
+            for (int k = 0; k <= lastBin; k++)
+            {
+                const auto position = k / ratio;
+                const auto bin = (int)position;
+                if (bin >= lastBin)
+                {
+                    if (position == lastBin)
+                    {
+                        dest[2*k] += gain * source[2*bin];
+                        dest[2*k + 1] += gain * source[2*bin + 1];
+                    }
+                    continue;
+                }
+
+                const auto fraction = position - bin;
+                const auto nearBin = fraction < 0.5 ? bin : bin + 1;
+                const auto farBin = fraction < 0.5 ? bin + 1 : bin;
+                const auto nearWeight = fraction < 0.5 ? 1.0 - fraction : fraction;
+                const auto magnitude = nearWeight * voiceMagnitude[nearBin] + (1.0 - nearWeight) * voiceMagnitude[farBin];
+                const auto binGain = voiceMagnitude[nearBin] > 0.0 ? gain * magnitude / voiceMagnitude[nearBin] : 0.0;
+                dest[2*k] += binGain * source[2*nearBin];
+                dest[2*k + 1] += binGain * source[2*nearBin + 1];
+            }
+        }
+
+        /** One voice of carrier spectrum into spectrum: read from the cache when the position
+            is on its grid (or anywhere when scanning or stacking voices), otherwise analysed
+            live with stft. */
+        void getVoiceSpectrum(const CarrierSpectrumCache& carrier, double carrierPosition, STFT& stft, double* spectrum)
+        {
+            const auto tableLength = carrier.getTableLength();
+            carrierPosition = std::fmod(carrierPosition, (double)tableLength);
+            if (carrierPosition < 0.0)
+                carrierPosition += tableLength;
+            if (carrierPosition >= tableLength)
+                carrierPosition = 0.0;
+
+            const auto sample = (int)carrierPosition;
+            if (carrierRate == 1.0 && carrierPosition == sample && carrier.hasFrameAt(sample))
+            {
+                carrier.readFrame(carrier.getFrameIndex(sample), spectrum);
+                return;
+            }
+            if (carrierRate == 1.0 && (scanning || unisonVoices > 1) && carrier.hasFrames())
+            {
+                carrier.readFrameBetween(carrierPosition, spectrum, scanSpectrum.data());
+                return;
+            }
+
+            // off the cache grid, no cache at all or pitch tracked: analyse the carrier live.
+            // The hop still starts at carrierPosition, so the carrier's timeline is unchanged
+            // and only its pitch moves; faster reads come from band-limited levels
+            if (carrierRate != 1.0 && carrier.getMipmap() != nullptr)
+            {
+                carrier.getMipmap()->read(carrierPosition, carrierRate, carrierHop.data(), shift, carrierInterpolation);
+            }
+            else
+            {
+                const CarrierOscillator oscillator(carrier.getTable(), carrier.getTableLength(), carrierInterpolation);
+                oscillator.process(carrierPosition, carrierRate, carrierHop.data(), shift);
+            }
+            stft.stft(carrierHop.data(), spectrum);
+
+            if (carrier.isWhitened())
+            {
+                // each bin takes the gain of the carrier bin it was moved from
+                const auto* gain = carrier.getWhiteningGain();
+                const int lastBin = frame / 2;
+                for (int k = 0; k < (frame+2); k++)
+                {
+                    const auto bin = carrierRate == 1.0 ? k/2 : std::min(lastBin, (int)((k/2) / carrierRate + 0.5));
+                    spectrum[k] *= gain[bin];
+                }
+            }
+        }
+
+        /** Scores the unsmoothed envelope, i.e. the modulator magnitude (or its LPC fit). */
+        void detectVoicing()
+        {
+            const bool needed = unvoicedBlend > 0.0f && voicingDetector.isPrepared();
+            unvoiced = needed ? voicingDetector.process(modulatorEnvelope.data()) : 0.0f;
+        }
+
+        /** RMS of the carrier a morph plays: the tables' levels under the same equal-power gains. */
+        static double carrierLevel(const CarrierSpectrumCache& first, const CarrierSpectrumCache& second, float morph)
+        {
+            if (&first == &second || morph <= 0.0f)
+                return first.getRms();
+
+            const auto angle = morph * 0.5 * M_PI;
+            const auto firstLevel = std::cos(angle) * first.getRms();
+            const auto secondLevel = std::sin(angle) * second.getRms();
+            return std::sqrt(firstLevel * firstLevel + secondLevel * secondLevel);
+        }
+
+        /** Equal-power crossfade of carrierSpectrum towards a noise frame at the given RMS level. */
+        void blendNoise(double level)
+        {
+            if (! noiseCarrier.isPrepared())
+                return;
+
+            const auto angle = std::min(1.0f, unvoiced * unvoicedBlend) * 0.5 * M_PI;
+            const auto carrierGain = std::cos(angle);
+            const auto noiseGain = std::sin(angle) * level;
+            const auto* noise = noiseCarrier.nextFrame();
+            for (int k = 0; k < (frame+2); k++)
+            {
+                carrierSpectrum[k] = carrierGain * carrierSpectrum[k] + noiseGain * noise[k];
+            }
+        }
+
+        /** Carrier rate for this hop from the modulator pitch; unvoiced hops hold the last one. */
+        void trackPitch()
+        {
+            const auto pitch = pitchTracker.process(modulatorSpectrum.data());
+            if (pitch > 0.0)
+            {
+                carrierRate = std::max(0.25, std::min(4.0, pitch / pitchReference));
+            }
+        }
 
     };
 
@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    CepstralEnvelope.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <cmath>
+#include <vector>
+#include "../STFT/STFT.h"
+
+namespace DSP
+{
+    /** Smooth spectral envelope by cepstral liftering.
+
+        The log magnitude of the half spectrum is cosine transformed into the real
+        cepstrum, everything from numCoefficients on (the pitch harmonics) is dropped,
+        and the cosine transform back gives the log of an envelope that follows the
+        formants but not the harmonic comb. The transforms are STFT::dfct, so this
+        costs two half-size cosine transforms per frame on the FFT's own tables.
+    */
+    class CepstralEnvelope
+    {
+    public:
+        CepstralEnvelope() {}
+
+        /** numBins = frame/2 + 1; allocates, so call it from prepareToPlay. */
+        void prepare(int numBinsToUse, int numCoefficientsToUse)
+        {
+            numBins = numBinsToUse;
+            numCoefficients = numCoefficientsToUse < numBins - 1 ? numCoefficientsToUse : numBins - 1;
+            cepstrum.assign(numBins, 0.0);
+        }
+
+        int getNumCoefficients() const { return numCoefficients; }
+        bool isPrepared() const { return numBins > 0; }
+
+        /** Replaces numBins magnitudes with their liftered envelope; transform must be
+            the STFT whose frame size the magnitudes came from. */
+        void process(STFT& transform, double* magnitude)
+        {
+            const int n = numBins - 1;
+            for (int k = 0; k < numBins; k++)
+            {
+                cepstrum[k] = std::log(magnitude[k] > floor ? magnitude[k] : floor);
+            }
+
+            // dfct sums the end points with full weight, a symmetric spectrum wants half
+            cepstrum[0] *= 0.5;
+            cepstrum[n] *= 0.5;
+            transform.dfct(cepstrum.data());
+
+            // lifter, folding in the inverse transform's scaling (same end point rule)
+            const double scale = 2.0 / n;
+            cepstrum[0] *= 0.5 * scale;
+            for (int q = 1; q < numCoefficients; q++)
+            {
+                cepstrum[q] *= scale;
+            }
+            for (int q = numCoefficients; q < numBins; q++)
+            {
+                cepstrum[q] = 0.0;
+            }
+            transform.dfct(cepstrum.data());
+
+            for (int k = 0; k < numBins; k++)
+            {
+                magnitude[k] = std::exp(cepstrum[k]);
+            }
+        }
+
+    private:
+        int numBins = 0;
+        int numCoefficients = 0;
+        std::vector<double> cepstrum;
+
+        /** Keeps log() finite on empty bins, about -180 dB. */
+        const double floor = 1e-9;
+    };
+}
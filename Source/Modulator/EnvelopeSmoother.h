@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    EnvelopeSmoother.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "../STFT/SampleConverter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENVELOPE_SMOOTHER_SSE2 1
+#include <emmintrin.h>
+#else
+#define ENVELOPE_SMOOTHER_SSE2 0
+#endif
+
+namespace DSP
+{
+    /** One-pole attack/release smoothing of an envelope from frame to frame, one
+        pole per value (bin or band).
+
+        The state is a contiguous float array updated 4 values at a time with SSE2.
+        Coefficients are per frame, so they come from the hop size as well as the
+        sample rate: the same attack/release times sound the same at any hop.
+    */
+    class EnvelopeSmoother
+    {
+    public:
+        EnvelopeSmoother() {}
+
+        /** Allocates, so call it from prepareToPlay. */
+        void prepare(int numValuesToUse, int hopSizeToUse, double sampleRateToUse)
+        {
+            numValues = numValuesToUse;
+            hopSize = hopSizeToUse;
+            sampleRate = sampleRateToUse;
+            // padded to whole SIMD vectors
+            state.assign((numValues + 3) & ~3, 0.0f);
+            input.assign(state.size(), 0.0f);
+            attackSeconds = releaseSeconds = -1.0;
+            setTimes(0.0, 0.0);
+        }
+
+        /** Cheap when the times have not changed, so it can be called every block. */
+        void setTimes(double attackTime, double releaseTime)
+        {
+            if (attackTime == attackSeconds && releaseTime == releaseSeconds)
+                return;
+            attackSeconds = attackTime;
+            releaseSeconds = releaseTime;
+            attackCoeff = coefficient(attackSeconds);
+            releaseCoeff = coefficient(releaseSeconds);
+        }
+
+        void reset() { std::fill(state.begin(), state.end(), 0.0f); }
+
+        bool isActive() const { return numValues > 0 && (attackCoeff > 0.0f || releaseCoeff > 0.0f); }
+
+        /** Smooths numValues envelope values in place against the previous frame. */
+        void process(double* values)
+        {
+            if (! isActive())
+                return;
+
+            SampleConverter<float>::FromDouble(values, input.data(), numValues);
+
+            int i = 0;
+#if ENVELOPE_SMOOTHER_SSE2
+            const __m128 attack = _mm_set1_ps(attackCoeff);
+            const __m128 release = _mm_set1_ps(releaseCoeff);
+            for (; i + 4 <= numValues; i += 4)
+            {
+                const __m128 x = _mm_loadu_ps(input.data() + i);
+                __m128 y = _mm_loadu_ps(state.data() + i);
+                const __m128 rising = _mm_cmpgt_ps(x, y);
+                const __m128 coeff = _mm_or_ps(_mm_and_ps(rising, attack), _mm_andnot_ps(rising, release));
+                y = _mm_add_ps(x, _mm_mul_ps(coeff, _mm_sub_ps(y, x)));
+                _mm_storeu_ps(state.data() + i, y);
+            }
+#endif
+            for (; i < numValues; i++)
+            {
+                const auto x = input[i];
+                const auto coeff = x > state[i] ? attackCoeff : releaseCoeff;
+                state[i] = x + coeff * (state[i] - x);
+            }
+
+            SampleConverter<float>::ToDouble(state.data(), values, numValues);
+        }
+
+    private:
+        int numValues = 0;
+        int hopSize = 0;
+        double sampleRate = 0.0;
+        double attackSeconds = 0.0;
+        double releaseSeconds = 0.0;
+        float attackCoeff = 0.0f;
+        float releaseCoeff = 0.0f;
+
+        std::vector<float> state;
+        std::vector<float> input;
+
+        /** Per frame pole for a time constant; zero time means no smoothing. */
+        float coefficient(double seconds) const
+        {
+            if (seconds <= 0.0 || sampleRate <= 0.0)
+                return 0.0f;
+            return (float)std::exp(-hopSize / (seconds * sampleRate));
+        }
+    };
+}
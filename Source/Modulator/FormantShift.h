@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    FormantShift.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <cmath>
+#include <vector>
+
+namespace DSP
+{
+    /** Bin remap that moves a spectral envelope up or down in frequency.
+
+        Output bin k reads the input envelope at k / 2^(semitones/12), linearly
+        interpolated between the two nearest bins. The indices and weights are worked
+        out once per setting (this allocates, so build it off the audio thread); apply()
+        is then one gather-and-lerp over the bins.
+    */
+    class FormantShift
+    {
+    public:
+        FormantShift(int numBinsToUse, float semitonesToUse)
+            : numBins(numBinsToUse), semitones(semitonesToUse),
+              lowerBin(numBinsToUse), upperWeight(numBinsToUse)
+        {
+            const auto ratio = std::pow(2.0, semitones / 12.0);
+            for (int k = 0; k < numBins; k++)
+            {
+                const auto position = k / ratio;
+                if (position >= numBins - 1)
+                {
+                    // held at the top bin when shifting down
+                    lowerBin[k] = numBins - 2;
+                    upperWeight[k] = 1.0f;
+                    continue;
+                }
+                lowerBin[k] = (int)position;
+                upperWeight[k] = (float)(position - lowerBin[k]);
+            }
+        }
+
+        float getSemitones() const { return semitones; }
+        int getNumBins() const { return numBins; }
+        bool isIdentity() const { return semitones == 0.0f; }
+
+        /** numBins values from in to out; in and out must not overlap. */
+        void apply(const double* in, double* out) const
+        {
+            for (int k = 0; k < numBins; k++)
+            {
+                const auto j = lowerBin[k];
+                out[k] = in[j] + upperWeight[k] * (in[j + 1] - in[j]);
+            }
+        }
+
+    private:
+        int numBins;
+        float semitones;
+        std::vector<int> lowerBin;
+        std::vector<float> upperWeight;
+    };
+}
@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+    LpcEnvelope.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "../STFT/HannWindow.h"
+#include "../STFT/SampleConverter.h"
+
+namespace DSP
+{
+    /** All-pole (LPC) spectral envelope of one time-domain frame, without an FFT.
+
+        The frame gets the same Hann window as the STFT, then autocorrelation up to
+        order, Levinson-Durbin for the predictor, and |G / A(e^jw)| on the STFT's bin
+        grid. A(e^jw) reads a one-period cos/sin table, so a frame costs about
+        frame * order for the autocorrelation plus bins * order for the evaluation.
+        The gain is chosen so the envelope has the same energy as the windowed frame's
+        FFT magnitude, i.e. it can stand in for it directly.
+    */
+    class LpcEnvelope
+    {
+    public:
+        LpcEnvelope() {}
+
+        /** frame must be a power of two; allocates, so call it from prepareToPlay. */
+        void prepare(int frameToUse, int shiftToUse, int orderToUse)
+        {
+            frame = frameToUse;
+            shift = shiftToUse;
+            order = orderToUse;
+            window.reset(new HannWindow(frame, shift));
+            input.assign(frame, 0.0);
+            windowed.assign(frame, 0.0);
+            autocorrelation.assign(order + 1, 0.0);
+            coefficients.assign(order + 1, 0.0);
+            previous.assign(order + 1, 0.0);
+
+            cosTable.resize(frame);
+            sinTable.resize(frame);
+            const double twoPi = 2.0 * 3.14159265358979323846;
+            for (int i = 0; i < frame; i++)
+            {
+                cosTable[i] = std::cos(twoPi * i / frame);
+                sinTable[i] = std::sin(twoPi * i / frame);
+            }
+        }
+
+        bool isPrepared() const { return frame > 0; }
+        int getOrder() const { return order; }
+
+        /** One hop (shift samples) in, frame/2 + 1 envelope values out. The hop is the end of
+            the analysed frame, which keeps the frame - shift samples before it as the STFT does. */
+        template <typename SampleType>
+        void process(const SampleType* hop, double* envelope)
+        {
+            std::copy(input.begin() + shift, input.end(), input.begin());
+            SampleConverter<SampleType>::ToDouble(hop, input.data() + frame - shift, shift);
+            std::copy(input.begin(), input.end(), windowed.begin());
+            window->Process(windowed.data());
+
+            for (int lag = 0; lag <= order; lag++)
+            {
+                // four partial sums so the compiler can keep several multiply-adds in flight
+                const double* x = windowed.data();
+                double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+                int n = lag;
+                for (; n + 4 <= frame; n += 4)
+                {
+                    sum0 += x[n] * x[n - lag];
+                    sum1 += x[n + 1] * x[n + 1 - lag];
+                    sum2 += x[n + 2] * x[n + 2 - lag];
+                    sum3 += x[n + 3] * x[n + 3 - lag];
+                }
+                for (; n < frame; n++)
+                {
+                    sum0 += x[n] * x[n - lag];
+                }
+                autocorrelation[lag] = (sum0 + sum1) + (sum2 + sum3);
+            }
+
+            const int numBins = frame / 2 + 1;
+            if (autocorrelation[0] <= 0.0)
+            {
+                std::fill(envelope, envelope + numBins, 0.0);
+                return;
+            }
+
+            // a touch of white noise keeps the recursion stable on very clean input
+            autocorrelation[0] *= 1.0 + 1e-9;
+            const auto error = levinsonDurbin();
+            const auto gain = std::sqrt(error);
+
+            const int mask = frame - 1;
+            for (int k = 0; k < numBins; k++)
+            {
+                double re = 1.0, im = 0.0;
+                int index = 0;
+                for (int i = 1; i <= order; i++)
+                {
+                    index = (index + k) & mask;
+                    re += coefficients[i] * cosTable[index];
+                    im -= coefficients[i] * sinTable[index];
+                }
+                envelope[k] = gain / std::sqrt(re*re + im*im);
+            }
+        }
+
+    private:
+        int frame = 0;
+        int shift = 0;
+        int order = 0;
+
+        std::unique_ptr<HannWindow> window;
+        /** The last frame of input, newest hop at the end. */
+        std::vector<double> input;
+        std::vector<double> windowed;
+        std::vector<double> autocorrelation;
+        /** A(z) = 1 + sum coefficients[i] z^-i, coefficients[0] unused. */
+        std::vector<double> coefficients;
+        std::vector<double> previous;
+        /** One period of cos/sin on the frame's FFT grid. */
+        std::vector<double> cosTable;
+        std::vector<double> sinTable;
+
+        /** Solves for coefficients from autocorrelation, returns the prediction error. */
+        double levinsonDurbin()
+        {
+            std::fill(coefficients.begin(), coefficients.end(), 0.0);
+            double error = autocorrelation[0];
+
+            for (int i = 1; i <= order; i++)
+            {
+                double acc = autocorrelation[i];
+                for (int j = 1; j < i; j++)
+                {
+                    acc += coefficients[j] * autocorrelation[i - j];
+                }
+                const auto reflection = -acc / error;
+
+                previous = coefficients;
+                for (int j = 1; j < i; j++)
+                {
+                    coefficients[j] = previous[j] + reflection * previous[i - j];
+                }
+                coefficients[i] = reflection;
+
+                error *= 1.0 - reflection * reflection;
+                if (error <= 0.0)
+                    break;
+            }
+            return error > 0.0 ? error : 0.0;
+        }
+    };
+}
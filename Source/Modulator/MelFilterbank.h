@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    MelFilterbank.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace DSP
+{
+    /** Triangular mel filterbank over the bins of one STFT frame.
+
+        analyse() reduces a magnitude spectrum to numBands band levels, interpolate()
+        spreads band levels back over the bins. The weights are kept as a sparse CSR
+        matrix (each band only stores the bins under its triangle), so analyse() costs
+        about two multiply-adds per bin however many bands there are.
+    */
+    class MelFilterbank
+    {
+    public:
+        MelFilterbank() {}
+
+        /** Builds the weights; allocates, so call it from prepareToPlay. */
+        MelFilterbank(int numBinsToUse, int numBandsToUse, double sampleRate)
+        {
+            prepare(numBinsToUse, numBandsToUse, sampleRate);
+        }
+
+        void prepare(int numBinsToUse, int numBandsToUse, double sampleRate)
+        {
+            numBins = numBinsToUse;
+            numBands = numBandsToUse;
+
+            // band edges equally spaced in mel from 0 Hz to Nyquist, in bins
+            const auto binWidth = sampleRate / (2.0 * (numBins - 1));
+            const auto maxMel = hzToMel(sampleRate / 2.0);
+            std::vector<double> edges(numBands + 2);
+            for (int j = 0; j < numBands + 2; ++j)
+                edges[j] = melToHz(maxMel * j / (numBands + 1)) / binWidth;
+
+            rowStart.assign(1, 0);
+            binIndex.clear();
+            weight.clear();
+            centres.resize(numBands);
+
+            for (int j = 0; j < numBands; ++j)
+            {
+                const auto lower = edges[j], centre = edges[j + 1], upper = edges[j + 2];
+                centres[j] = centre;
+
+                double weightSum = 0.0;
+                const auto first = (int)std::ceil(lower);
+                const auto last = std::min((int)std::floor(upper), numBins - 1);
+                const auto rowBegin = binIndex.size();
+                for (int k = first; k <= last; ++k)
+                {
+                    const auto w = k <= centre ? (k - lower) / (centre - lower) : (upper - k) / (upper - centre);
+                    if (w > 0.0)
+                    {
+                        binIndex.push_back(k);
+                        weight.push_back(w);
+                        weightSum += w;
+                    }
+                }
+
+                // low bands can be narrower than a bin, give them the nearest one
+                if (binIndex.size() == rowBegin)
+                {
+                    binIndex.push_back(std::min((int)std::lround(centre), numBins - 1));
+                    weight.push_back(1.0);
+                    weightSum = 1.0;
+                }
+
+                // normalised so a flat spectrum gives the same level in every band
+                for (auto i = rowBegin; i < weight.size(); ++i)
+                    weight[i] /= weightSum;
+                rowStart.push_back((int)binIndex.size());
+            }
+
+            // piecewise linear from band centre to band centre, held flat outside them
+            lowerBand.resize(numBins);
+            upperFraction.resize(numBins);
+            for (int k = 0; k < numBins; ++k)
+            {
+                const auto upper = (int)(std::upper_bound(centres.begin(), centres.end(), (double)k) - centres.begin());
+                if (upper == 0)
+                {
+                    lowerBand[k] = 0;
+                    upperFraction[k] = 0.0;
+                }
+                else if (upper == numBands)
+                {
+                    lowerBand[k] = numBands - 2;
+                    upperFraction[k] = 1.0;
+                }
+                else
+                {
+                    lowerBand[k] = upper - 1;
+                    upperFraction[k] = (k - centres[upper - 1]) / (centres[upper] - centres[upper - 1]);
+                }
+            }
+        }
+
+        int getNumBands() const { return numBands; }
+        int getNumBins() const { return numBins; }
+
+        /** magnitude holds numBins values, bands receives numBands. */
+        void analyse(const double* magnitude, double* bands) const
+        {
+            for (int j = 0; j < numBands; ++j)
+            {
+                double sum = 0.0;
+                for (int i = rowStart[j]; i < rowStart[j + 1]; ++i)
+                    sum += weight[i] * magnitude[binIndex[i]];
+                bands[j] = sum;
+            }
+        }
+
+        /** bands holds numBands values, magnitude receives numBins. */
+        void interpolate(const double* bands, double* magnitude) const
+        {
+            for (int k = 0; k < numBins; ++k)
+            {
+                const auto j = lowerBand[k];
+                magnitude[k] = bands[j] + upperFraction[k] * (bands[j + 1] - bands[j]);
+            }
+        }
+
+        static double hzToMel(double hz) { return 2595.0 * std::log10(1.0 + hz / 700.0); }
+        static double melToHz(double mel) { return 700.0 * (std::pow(10.0, mel / 2595.0) - 1.0); }
+
+    private:
+        int numBins = 0;
+        int numBands = 0;
+
+        /** CSR weights: band j covers binIndex/weight[rowStart[j] .. rowStart[j+1]). */
+        std::vector<int> rowStart;
+        std::vector<int> binIndex;
+        std::vector<double> weight;
+
+        /** Band centres in bins, and for each bin the band below it and how far towards the next. */
+        std::vector<double> centres;
+        std::vector<int> lowerBand;
+        std::vector<double> upperFraction;
+    };
+}
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    PitchTracker.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "../STFT/Ooura_FFT.h"
+#include "../STFT/HannWindow.h"
+
+namespace DSP
+{
+    /** Fundamental frequency of a frame from the spectrum the STFT has already produced.
+
+        The autocorrelation is the inverse FFT of the power spectrum, so no forward
+        transform is needed. Only the bins below frame/decimation are used, which turns
+        the inverse into a small FFT giving the autocorrelation every `decimation` lags;
+        the pitch peak is then refined by parabolic interpolation. The circular
+        autocorrelation of the analysis window is divided out so long lags are not
+        penalised, and the first peak within 80% of the highest one wins, which avoids
+        picking octaves too low. Being circular, lags stop at frame/2: the lowest pitch
+        that can be tracked is 2 * sampleRate / frame.
+    */
+    class PitchTracker
+    {
+    public:
+        PitchTracker() {}
+
+        /** Allocates, so call it from prepareToPlay. frame must match the STFT. */
+        void prepare(int frameToUse, int shiftToUse, double sampleRateToUse,
+                     double maxFrequency = 1000.0, int decimationToUse = 8)
+        {
+            frame = frameToUse;
+            sampleRate = sampleRateToUse;
+            decimation = decimationToUse;
+            size = frame / decimation;
+            fft.reset(new Ooura_FFT(size, 1));
+            buffer.assign(size + 2, 0.0);
+
+            minLag = std::max(2, (int)std::ceil(sampleRate / maxFrequency / decimation));
+            maxLag = size / 2 - 1;
+
+            // circular autocorrelation of the STFT's window on the same lag grid
+            std::vector<double> window(frame, 1.0);
+            HannWindow hann(frame, shiftToUse);
+            hann.Process(window.data());
+            inverseWindowCorrelation.resize(maxLag + 2);
+            for (int n = 0; n < (int)inverseWindowCorrelation.size(); n++)
+            {
+                const auto lag = n * decimation;
+                double sum = 0.0;
+                for (int i = 0; i < frame; i++)
+                    sum += window[i] * window[(i + lag) % frame];
+                inverseWindowCorrelation[n] = 1.0 / sum;
+            }
+        }
+
+        bool isPrepared() const { return size > 0; }
+
+        /** spectrum is the STFT output (frame + 2 values, half FFT in complex).
+            Returns the pitch in Hz, or 0 when the frame has no clear periodicity. */
+        double process(const double* spectrum, double clarityThreshold = 0.45)
+        {
+            const int numBins = size / 2;
+            for (int k = 0; k < numBins; k++)
+            {
+                buffer[2*k] = spectrum[2*k] * spectrum[2*k] + spectrum[2*k + 1] * spectrum[2*k + 1];
+                buffer[2*k + 1] = 0.0;
+            }
+            buffer[size] = spectrum[2*numBins] * spectrum[2*numBins] + spectrum[2*numBins + 1] * spectrum[2*numBins + 1];
+            buffer[size + 1] = 0.0;
+            fft->iFFT(buffer.data());
+
+            if (buffer[0] <= 0.0)
+                return 0.0;
+            const auto scale = 1.0 / (buffer[0] * inverseWindowCorrelation[0]);
+            for (int n = 1; n <= maxLag + 1; n++)
+                buffer[n] *= inverseWindowCorrelation[n] * scale;
+
+            // the lag 0 lobe ends where the correlation first drops below zero
+            int start = 1;
+            while (start <= maxLag && buffer[start] > 0.0)
+                start++;
+            start = std::max(start, minLag);
+            if (start > maxLag)
+                return 0.0;
+
+            double highest = 0.0;
+            for (int n = start; n <= maxLag; n++)
+                highest = std::max(highest, buffer[n]);
+            if (highest < clarityThreshold)
+                return 0.0;
+
+            for (int n = start; n <= maxLag; n++)
+            {
+                if (buffer[n] >= 0.8 * highest && buffer[n] >= buffer[n - 1] && buffer[n] >= buffer[n + 1])
+                {
+                    const auto curvature = buffer[n - 1] - 2.0 * buffer[n] + buffer[n + 1];
+                    const auto offset = curvature < 0.0 ? 0.5 * (buffer[n - 1] - buffer[n + 1]) / curvature : 0.0;
+                    return sampleRate / ((n + offset) * decimation);
+                }
+            }
+            return 0.0;
+        }
+
+    private:
+        int frame = 0;
+        int size = 0;
+        int decimation = 1;
+        int minLag = 0;
+        int maxLag = 0;
+        double sampleRate = 0.0;
+
+        std::unique_ptr<Ooura_FFT> fft;
+        std::vector<double> buffer;
+        std::vector<double> inverseWindowCorrelation;
+    };
+}
@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    VoicingDetector.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace DSP
+{
+    /** How unvoiced (noisy) a frame is, from the magnitudes the envelope is built from.
+
+        Two features, no extra transform: spectral flatness (geometric over arithmetic
+        mean of the power, near 0 for harmonics and about 0.56 for white noise) and the
+        share of the energy above splitFrequency. Sibilants and plosives score high on
+        both, vowels and voiced consonants low on at least one. Each is mapped onto 0..1
+        between a voiced and an unvoiced threshold and the result is their geometric mean.
+    */
+    class VoicingDetector
+    {
+    public:
+        VoicingDetector() {}
+
+        void prepare(int numBinsToUse, double sampleRate, double splitFrequency = 4000.0)
+        {
+            numBins = numBinsToUse;
+            const auto binWidth = sampleRate / (2.0 * (numBins - 1));
+            splitBin = std::max(1, std::min(numBins - 1, (int)std::lround(splitFrequency / binWidth)));
+        }
+
+        bool isPrepared() const { return numBins > 0; }
+
+        /** magnitude holds numBins values; returns 0 for voiced up to 1 for unvoiced. */
+        float process(const double* magnitude)
+        {
+            // DC and Nyquist say nothing about voicing
+            double lowEnergy = 0.0, highEnergy = 0.0;
+            for (int k = 1; k < splitBin; k++)
+                lowEnergy += magnitude[k] * magnitude[k];
+            for (int k = splitBin; k < numBins - 1; k++)
+                highEnergy += magnitude[k] * magnitude[k];
+            // four partial sums so several logs can be in flight at once
+            float log0 = 0.0f, log1 = 0.0f, log2 = 0.0f, log3 = 0.0f;
+            int k = 1;
+            for (; k + 4 <= numBins - 1; k += 4)
+            {
+                log0 += fastLog2((float)(magnitude[k] * magnitude[k]) + 1e-20f);
+                log1 += fastLog2((float)(magnitude[k + 1] * magnitude[k + 1]) + 1e-20f);
+                log2 += fastLog2((float)(magnitude[k + 2] * magnitude[k + 2]) + 1e-20f);
+                log3 += fastLog2((float)(magnitude[k + 3] * magnitude[k + 3]) + 1e-20f);
+            }
+            for (; k < numBins - 1; k++)
+                log0 += fastLog2((float)(magnitude[k] * magnitude[k]) + 1e-20f);
+            const auto logSum = (log0 + log1) + (log2 + log3);
+
+            const auto energy = (float)(lowEnergy + highEnergy);
+            if (energy <= 0.0f)
+            {
+                flatness = highFrequencyRatio = 0.0f;
+                return 0.0f;
+            }
+
+            const auto count = (float)(numBins - 2);
+            flatness = std::exp2(logSum / count) / (energy / count);
+            highFrequencyRatio = (float)highEnergy / energy;
+            return std::sqrt(ramp(flatness, 0.15f, 0.35f) * ramp(highFrequencyRatio, 0.25f, 0.6f));
+        }
+
+        float getFlatness() const { return flatness; }
+        float getHighFrequencyRatio() const { return highFrequencyRatio; }
+
+    private:
+        int numBins = 0;
+        int splitBin = 1;
+        float flatness = 0.0f;
+        float highFrequencyRatio = 0.0f;
+
+        static float ramp(float value, float low, float high)
+        {
+            return std::max(0.0f, std::min(1.0f, (value - low) / (high - low)));
+        }
+
+        /** log2 to about 0.01, from the float's exponent and a quadratic of its mantissa. */
+        static float fastLog2(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            const auto exponent = (float)((int)((bits >> 23) & 0xffu) - 128);
+            bits = (bits & 0x807fffffu) | 0x3f800000u;
+            float mantissa;
+            std::memcpy(&mantissa, &bits, sizeof(mantissa));
+            return exponent + mantissa * (-0.34484843f * mantissa + 2.02466578f) - 0.67487759f;
+        }
+    };
+}
@@ -15,7 +15,7 @@ VSTEmotionRendererAudioProcessorEditor::VSTEmotionRendererAudioProcessorEditor (
 {
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
-    setSize (200, 200);
+    setSize (380, 700);
     mixSlider.setSliderStyle(juce::Slider::LinearHorizontal);
     //mixSlider.setRange(0.0, 1.0, 0.01);
     addAndMakeVisible (&mixSlider);
@@ -24,11 +24,186 @@ VSTEmotionRendererAudioProcessorEditor::VSTEmotionRendererAudioProcessorEditor (
     mixLabel.setText("Mix", juce::dontSendNotification);
     mixLabel.attachToComponent(&mixSlider, false);
     mixLabel.setFont(juce::Font (11.0f));
-    
+
+    unvoicedSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&unvoicedSlider);
+    unvoicedAttachment.reset(new SliderAttachment(valueTreeState, "unvoiced", unvoicedSlider));
+
+    unvoicedLabel.setText("Unvoiced noise", juce::dontSendNotification);
+    unvoicedLabel.attachToComponent(&unvoicedSlider, false);
+    unvoicedLabel.setFont(juce::Font (11.0f));
+
+    engineBox.addItemList(juce::StringArray{"STFT", "Filter bank"}, 1);
+    addAndMakeVisible (&engineBox);
+    engineAttachment.reset(new ComboBoxAttachment(valueTreeState, "engine", engineBox));
+
+    engineLabel.setText("Engine", juce::dontSendNotification);
+    engineLabel.attachToComponent(&engineBox, false);
+    engineLabel.setFont(juce::Font (11.0f));
+
+    envelopeBox.addItemList(juce::StringArray{"Raw", "Mel", "Cepstrum", "LPC"}, 1);
+    addAndMakeVisible (&envelopeBox);
+    envelopeAttachment.reset(new ComboBoxAttachment(valueTreeState, "envelope", envelopeBox));
+
+    envelopeLabel.setText("Envelope", juce::dontSendNotification);
+    envelopeLabel.attachToComponent(&envelopeBox, false);
+    envelopeLabel.setFont(juce::Font (11.0f));
+
+    attackSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&attackSlider);
+    attackAttachment.reset(new SliderAttachment(valueTreeState, "attack", attackSlider));
+
+    attackLabel.setText("Attack (ms)", juce::dontSendNotification);
+    attackLabel.attachToComponent(&attackSlider, false);
+    attackLabel.setFont(juce::Font (11.0f));
+
+    releaseSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&releaseSlider);
+    releaseAttachment.reset(new SliderAttachment(valueTreeState, "release", releaseSlider));
+
+    releaseLabel.setText("Release (ms)", juce::dontSendNotification);
+    releaseLabel.attachToComponent(&releaseSlider, false);
+    releaseLabel.setFont(juce::Font (11.0f));
+
+    formantSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&formantSlider);
+    formantAttachment.reset(new SliderAttachment(valueTreeState, "formant", formantSlider));
+
+    formantLabel.setText("Formant (st)", juce::dontSendNotification);
+    formantLabel.attachToComponent(&formantSlider, false);
+    formantLabel.setFont(juce::Font (11.0f));
+
+    firstCarrierBox.addItemList(VSTEmotionRendererAudioProcessor::getCarrierNames(), 1);
+    addAndMakeVisible (&firstCarrierBox);
+    firstCarrierAttachment.reset(new ComboBoxAttachment(valueTreeState, "carrierA", firstCarrierBox));
+
+    firstCarrierLabel.setText("Carrier A", juce::dontSendNotification);
+    firstCarrierLabel.attachToComponent(&firstCarrierBox, false);
+    firstCarrierLabel.setFont(juce::Font (11.0f));
+
+    secondCarrierBox.addItemList(VSTEmotionRendererAudioProcessor::getCarrierNames(), 1);
+    addAndMakeVisible (&secondCarrierBox);
+    secondCarrierAttachment.reset(new ComboBoxAttachment(valueTreeState, "carrierB", secondCarrierBox));
+
+    secondCarrierLabel.setText("Carrier B", juce::dontSendNotification);
+    secondCarrierLabel.attachToComponent(&secondCarrierBox, false);
+    secondCarrierLabel.setFont(juce::Font (11.0f));
+
+    morphSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&morphSlider);
+    morphAttachment.reset(new SliderAttachment(valueTreeState, "morph", morphSlider));
+
+    morphLabel.setText("Morph", juce::dontSendNotification);
+    morphLabel.attachToComponent(&morphSlider, false);
+    morphLabel.setFont(juce::Font (11.0f));
+
+    pitchTrackButton.setButtonText("Pitch track");
+    addAndMakeVisible (&pitchTrackButton);
+    pitchTrackAttachment.reset(new ButtonAttachment(valueTreeState, "pitchTrack", pitchTrackButton));
+
+    pitchReferenceSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&pitchReferenceSlider);
+    pitchReferenceAttachment.reset(new SliderAttachment(valueTreeState, "pitchReference", pitchReferenceSlider));
+
+    pitchReferenceLabel.setText("Pitch reference (Hz)", juce::dontSendNotification);
+    pitchReferenceLabel.attachToComponent(&pitchReferenceSlider, false);
+    pitchReferenceLabel.setFont(juce::Font (11.0f));
+
+    interpolationBox.addItemList(juce::StringArray{"Linear", "Cubic", "Hermite"}, 1);
+    addAndMakeVisible (&interpolationBox);
+    interpolationAttachment.reset(new ComboBoxAttachment(valueTreeState, "interpolation", interpolationBox));
+
+    interpolationLabel.setText("Interpolation", juce::dontSendNotification);
+    interpolationLabel.attachToComponent(&interpolationBox, false);
+    interpolationLabel.setFont(juce::Font (11.0f));
+
+    scanSpeedSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&scanSpeedSlider);
+    scanSpeedAttachment.reset(new SliderAttachment(valueTreeState, "scanSpeed", scanSpeedSlider));
+
+    scanSpeedLabel.setText("Scan speed", juce::dontSendNotification);
+    scanSpeedLabel.attachToComponent(&scanSpeedSlider, false);
+    scanSpeedLabel.setFont(juce::Font (11.0f));
+
+    scanJitterSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&scanJitterSlider);
+    scanJitterAttachment.reset(new SliderAttachment(valueTreeState, "scanJitter", scanJitterSlider));
+
+    scanJitterLabel.setText("Scan jitter (ms)", juce::dontSendNotification);
+    scanJitterLabel.attachToComponent(&scanJitterSlider, false);
+    scanJitterLabel.setFont(juce::Font (11.0f));
+
+    freezeButton.setButtonText("Freeze");
+    addAndMakeVisible (&freezeButton);
+    freezeAttachment.reset(new ButtonAttachment(valueTreeState, "freeze", freezeButton));
+
+    voicesSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&voicesSlider);
+    voicesAttachment.reset(new SliderAttachment(valueTreeState, "voices", voicesSlider));
+
+    voicesLabel.setText("Voices", juce::dontSendNotification);
+    voicesLabel.attachToComponent(&voicesSlider, false);
+    voicesLabel.setFont(juce::Font (11.0f));
+
+    unisonSpreadSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&unisonSpreadSlider);
+    unisonSpreadAttachment.reset(new SliderAttachment(valueTreeState, "unisonSpread", unisonSpreadSlider));
+
+    unisonSpreadLabel.setText("Unison spread (ms)", juce::dontSendNotification);
+    unisonSpreadLabel.attachToComponent(&unisonSpreadSlider, false);
+    unisonSpreadLabel.setFont(juce::Font (11.0f));
+
+    unisonDetuneSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    addAndMakeVisible (&unisonDetuneSlider);
+    unisonDetuneAttachment.reset(new SliderAttachment(valueTreeState, "unisonDetune", unisonDetuneSlider));
+
+    unisonDetuneLabel.setText("Unison detune (cents)", juce::dontSendNotification);
+    unisonDetuneLabel.attachToComponent(&unisonDetuneSlider, false);
+    unisonDetuneLabel.setFont(juce::Font (11.0f));
+
+    userCarrierLabel.setFont(juce::Font (11.0f));
+    userCarrierLabel.setJustificationType(juce::Justification::centredLeft);
+    addAndMakeVisible (&userCarrierLabel);
+    timerCallback();
+    startTimerHz(4);
 }
 
 VSTEmotionRendererAudioProcessorEditor::~VSTEmotionRendererAudioProcessorEditor()
 {
+    stopTimer();
+}
+
+bool VSTEmotionRendererAudioProcessorEditor::isInterestedInFileDrag (const juce::StringArray& files)
+{
+    for (const auto& file : files)
+        if (VSTEmotionRendererAudioProcessor::isCarrierFile(file))
+            return true;
+    return false;
+}
+
+void VSTEmotionRendererAudioProcessorEditor::filesDropped (const juce::StringArray& files, int x, int y)
+{
+    for (const auto& file : files)
+    {
+        if (VSTEmotionRendererAudioProcessor::isCarrierFile(file))
+        {
+            audioProcessor.loadUserCarrier(juce::File(file));
+            // shown until the processor reports this file
+            userCarrierLabel.setText("Loading " + juce::File(file).getFileName(), juce::dontSendNotification);
+            return;
+        }
+    }
+}
+
+void VSTEmotionRendererAudioProcessorEditor::timerCallback()
+{
+    // the file loads in the background, so its name (or error) shows up when it is done
+    const auto status = audioProcessor.getUserCarrierStatus();
+    if (status.isEmpty())
+        userCarrierLabel.setText("Drop a file to add a carrier", juce::dontSendNotification);
+    else if (status != shownUserCarrierStatus)
+        userCarrierLabel.setText("User file: " + status, juce::dontSendNotification);
+    shownUserCarrierStatus = status;
 }
 
 //==============================================================================
@@ -41,7 +216,7 @@ void VSTEmotionRendererAudioProcessorEditor::paint (juce::Graphics& g)
 
     g.setColour (juce::Colours::black);
     g.setFont (15.0f);
-    g.drawFittedText ("This is Emothion Renderer:)", getLocalBounds(), juce::Justification::centred, 1);
+    g.drawFittedText ("This is Emothion Renderer:)", getLocalBounds().removeFromBottom(100), juce::Justification::centred, 1);
 }
 
 void VSTEmotionRendererAudioProcessorEditor::resized()
@@ -49,4 +224,23 @@ void VSTEmotionRendererAudioProcessorEditor::resized()
     // This is generally where you'll want to lay out the positions of any
     // subcomponents in your editor..
     mixSlider.setBounds(20, 20, 150, 40);
+    unvoicedSlider.setBounds(200, 20, 150, 40);
+    engineBox.setBounds(20, 90, 150, 24);
+    envelopeBox.setBounds(20, 140, 150, 24);
+    attackSlider.setBounds(20, 190, 150, 40);
+    releaseSlider.setBounds(20, 250, 150, 40);
+    formantSlider.setBounds(20, 310, 150, 40);
+    interpolationBox.setBounds(20, 380, 150, 24);
+    scanSpeedSlider.setBounds(20, 440, 150, 40);
+    voicesSlider.setBounds(20, 500, 150, 40);
+    unisonDetuneSlider.setBounds(20, 560, 150, 40);
+    firstCarrierBox.setBounds(200, 90, 150, 24);
+    secondCarrierBox.setBounds(200, 140, 150, 24);
+    morphSlider.setBounds(200, 190, 150, 40);
+    pitchTrackButton.setBounds(200, 240, 150, 24);
+    pitchReferenceSlider.setBounds(200, 290, 150, 40);
+    userCarrierLabel.setBounds(200, 330, 170, 24);
+    freezeButton.setBounds(200, 380, 150, 24);
+    scanJitterSlider.setBounds(200, 440, 150, 40);
+    unisonSpreadSlider.setBounds(200, 500, 150, 40);
 }
@@ -12,11 +12,15 @@
 #include "PluginProcessor.h"
 
 typedef juce::AudioProcessorValueTreeState::SliderAttachment SliderAttachment;
+typedef juce::AudioProcessorValueTreeState::ComboBoxAttachment ComboBoxAttachment;
+typedef juce::AudioProcessorValueTreeState::ButtonAttachment ButtonAttachment;
 
 //==============================================================================
 /**
 */
-class VSTEmotionRendererAudioProcessorEditor  : public juce::AudioProcessorEditor
+class VSTEmotionRendererAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                                public juce::FileDragAndDropTarget,
+                                                private juce::Timer
 {
 public:
     VSTEmotionRendererAudioProcessorEditor (VSTEmotionRendererAudioProcessor&, juce::AudioProcessorValueTreeState&);
@@ -26,6 +30,10 @@ public:
     void paint (juce::Graphics&) override;
     void resized() override;
 
+    // an audio or .carrier file dropped anywhere on the editor becomes the user carrier
+    bool isInterestedInFileDrag (const juce::StringArray& files) override;
+    void filesDropped (const juce::StringArray& files, int x, int y) override;
+
 
 private:
     // This reference is provided as a quick way for your editor to
@@ -38,6 +46,80 @@ private:
     juce::Slider mixSlider;
     std::unique_ptr<SliderAttachment> mixAttachment;
 
+    juce::Label unvoicedLabel;
+    juce::Slider unvoicedSlider;
+    std::unique_ptr<SliderAttachment> unvoicedAttachment;
+
+    juce::Label engineLabel;
+    juce::ComboBox engineBox;
+    std::unique_ptr<ComboBoxAttachment> engineAttachment;
+
+    juce::Label envelopeLabel;
+    juce::ComboBox envelopeBox;
+    std::unique_ptr<ComboBoxAttachment> envelopeAttachment;
+
+    juce::Label attackLabel;
+    juce::Slider attackSlider;
+    std::unique_ptr<SliderAttachment> attackAttachment;
+
+    juce::Label releaseLabel;
+    juce::Slider releaseSlider;
+    std::unique_ptr<SliderAttachment> releaseAttachment;
+
+    juce::Label formantLabel;
+    juce::Slider formantSlider;
+    std::unique_ptr<SliderAttachment> formantAttachment;
+
+    juce::Label firstCarrierLabel;
+    juce::ComboBox firstCarrierBox;
+    std::unique_ptr<ComboBoxAttachment> firstCarrierAttachment;
+
+    juce::Label secondCarrierLabel;
+    juce::ComboBox secondCarrierBox;
+    std::unique_ptr<ComboBoxAttachment> secondCarrierAttachment;
+
+    juce::Label morphLabel;
+    juce::Slider morphSlider;
+    std::unique_ptr<SliderAttachment> morphAttachment;
+
+    juce::ToggleButton pitchTrackButton;
+    std::unique_ptr<ButtonAttachment> pitchTrackAttachment;
+
+    juce::Label pitchReferenceLabel;
+    juce::Slider pitchReferenceSlider;
+    std::unique_ptr<SliderAttachment> pitchReferenceAttachment;
+
+    juce::Label interpolationLabel;
+    juce::ComboBox interpolationBox;
+    std::unique_ptr<ComboBoxAttachment> interpolationAttachment;
+
+    juce::Label scanSpeedLabel;
+    juce::Slider scanSpeedSlider;
+    std::unique_ptr<SliderAttachment> scanSpeedAttachment;
+
+    juce::Label scanJitterLabel;
+    juce::Slider scanJitterSlider;
+    std::unique_ptr<SliderAttachment> scanJitterAttachment;
+
+    juce::ToggleButton freezeButton;
+    std::unique_ptr<ButtonAttachment> freezeAttachment;
+
+    juce::Label voicesLabel;
+    juce::Slider voicesSlider;
+    std::unique_ptr<SliderAttachment> voicesAttachment;
+
+    juce::Label unisonSpreadLabel;
+    juce::Slider unisonSpreadSlider;
+    std::unique_ptr<SliderAttachment> unisonSpreadAttachment;
+
+    juce::Label unisonDetuneLabel;
+    juce::Slider unisonDetuneSlider;
+    std::unique_ptr<SliderAttachment> unisonDetuneAttachment;
+
+    juce::Label userCarrierLabel;
+    juce::String shownUserCarrierStatus;
+    void timerCallback() override;
+
     VSTEmotionRendererAudioProcessor* getProcessor() const
     {
         return static_cast <VSTEmotionRendererAudioProcessor*> (getAudioProcessor());
@@ -8,6 +8,13 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+// CarrierAssetTool output is only there when it has been added to the project as binary resources
+#if defined (__has_include)
+ #if __has_include ("BinaryData.h")
+  #include "BinaryData.h"
+  #define VSTEMOTIONRENDERER_LINKED_CARRIERS 1
+ #endif
+#endif
 
 //==============================================================================
 VSTEmotionRendererAudioProcessor::VSTEmotionRendererAudioProcessor()
@@ -16,6 +23,7 @@ VSTEmotionRendererAudioProcessor::VSTEmotionRendererAudioProcessor()
                      #if ! JucePlugin_IsMidiEffect
                       #if ! JucePlugin_IsSynth
                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
@@ -24,14 +32,280 @@ VSTEmotionRendererAudioProcessor::VSTEmotionRendererAudioProcessor()
 {
 
     mixParameter = parameters.getRawParameterValue("mix");//mixParameter is a pointer
+    engineParameter = parameters.getRawParameterValue("engine");
+    envelopeParameter = parameters.getRawParameterValue("envelope");
+    attackParameter = parameters.getRawParameterValue("attack");
+    releaseParameter = parameters.getRawParameterValue("release");
+    formantParameter = parameters.getRawParameterValue("formant");
+    firstCarrierParameter = parameters.getRawParameterValue("carrierA");
+    secondCarrierParameter = parameters.getRawParameterValue("carrierB");
+    morphParameter = parameters.getRawParameterValue("morph");
+    pitchTrackParameter = parameters.getRawParameterValue("pitchTrack");
+    pitchReferenceParameter = parameters.getRawParameterValue("pitchReference");
+    interpolationParameter = parameters.getRawParameterValue("interpolation");
+    unvoicedParameter = parameters.getRawParameterValue("unvoiced");
+    scanSpeedParameter = parameters.getRawParameterValue("scanSpeed");
+    scanJitterParameter = parameters.getRawParameterValue("scanJitter");
+    freezeParameter = parameters.getRawParameterValue("freeze");
+    voicesParameter = parameters.getRawParameterValue("voices");
+    unisonSpreadParameter = parameters.getRawParameterValue("unisonSpread");
+    unisonDetuneParameter = parameters.getRawParameterValue("unisonDetune");
     filterBuffer = juce::AudioSampleBuffer(1,1);
     tempBuffer = juce::AudioSampleBuffer(1,1);
-    myWaveTable = WaveTable::AllWaveTable();
-    
+
+    // carriers are built for the host rate in prepareToPlay
+    updateFormantShift();
+    startTimerHz(30);
 }
 
 VSTEmotionRendererAudioProcessor::~VSTEmotionRendererAudioProcessor()
 {
+    stopTimer();
+    // a file still loading finishes first, however long it takes, as it publishes into this
+    // instance; its analysis is bounded (see maxCarrierCacheBytes and the whitening pass)
+    userCarrierLoader.removeAllJobs(true, -1);
+}
+
+void VSTEmotionRendererAudioProcessor::timerCallback()
+{
+    updateEngine();
+    updateCarriers(false);
+    updateFormantShift();
+    // a user carrier that has been replaced is freed once no pair of any instance plays it
+    carrierRegistry->releaseUnusedTables();
+}
+
+juce::StringArray VSTEmotionRendererAudioProcessor::getCarrierNames()
+{
+    juce::StringArray names;
+    for (const auto& carrier : WaveTable::AllWaveTable::carriers)
+        names.add(carrier.name);
+    names.add("User file");
+    return names;
+}
+
+std::shared_ptr<const DSP::CarrierSpectrumCache> VSTEmotionRendererAudioProcessor::getCarrierCache (int index, bool waitForLoad)
+{
+    // "User file" before any file has loaded plays the first library carrier
+    if (index == userCarrierIndex && userCarrier.samples != nullptr)
+        return getCarrierCache(userCarrier.samples, userCarrier.length, userCarrier.sampleRate, carrierSampleRate, waitForLoad);
+
+    // library carriers are decoded the first time any instance plays them
+    const auto& carrier = WaveTable::AllWaveTable::carriers[(size_t)juce::jlimit(0, WaveTable::AllWaveTable::numCarriers - 1, index)];
+    if (auto asset = openLinkedCarrier(carrier.assetName, carrierSampleRate))
+    {
+        // already at this rate, and its spectra are used as they are, so nothing is decoded,
+        // resampled or analysed; the source keeps the asset alive with the registry
+        const auto frame = myUtils.getFrameSize();
+        const auto shift = myUtils.getShiftSize();
+        const auto whiten = carrierWhitening;
+        carrierRegistry->keepTable(asset);
+        carrierRegistry->addSpectrumSource(asset->getLoop(), asset->getLoopLength(), asset->getSampleRate(), carrierSampleRate,
+                                           frame, shift, getCarrierStorage(asset->getLoopLength()), whiten,
+                                           [asset, frame, shift, whiten] (std::shared_ptr<const DSP::CarrierMipmap> mipmap)
+                                           {
+                                               return asset->getSpectrumCache(asset->getSampleRate(), frame, shift, whiten, std::move(mipmap));
+                                           });
+        return getCarrierCache(asset->getLoop(), asset->getLoopLength(), asset->getSampleRate(), carrierSampleRate, waitForLoad);
+    }
+    const auto table = carrierRegistry->getDecodedTable(carrier.data, carrier.dataSize);
+    return getCarrierCache(table.samples, table.length, carrier.sampleRate, carrierSampleRate, waitForLoad);
+}
+
+std::shared_ptr<const DSP::CarrierSpectrumCache> VSTEmotionRendererAudioProcessor::getCarrierCache (const float* samples, int length, double tableRate,
+                                                                                                      double sampleRate, bool waitForLoad)
+{
+    // carrier tables and their spectra are shared by every instance in the process,
+    // resampled to the host rate once, then reused by every instance at that rate
+    const auto frame = myUtils.getFrameSize();
+    const auto shift = myUtils.getShiftSize();
+    const auto storage = getCarrierStorage(DSP::CarrierRegistry::getPlayedLength(length, tableRate, sampleRate));
+    if (waitForLoad)
+        return carrierRegistry->getSpectrumCache(samples, length, tableRate, sampleRate, frame, shift, storage, carrierWhitening);
+    return carrierRegistry->requestSpectrumCache(samples, length, tableRate, sampleRate, frame, shift, storage, carrierWhitening);
+}
+
+DSP::CarrierSpectrumCache::Storage VSTEmotionRendererAudioProcessor::getCarrierStorage (int playedLength) const
+{
+    const auto bytes = DSP::CarrierSpectrumCache::getFrameDataSizeFor(playedLength, myUtils.getFrameSize(), myUtils.getShiftSize(),
+                                                                       carrierCacheStorage);
+    return bytes > maxCarrierCacheBytes ? DSP::CarrierSpectrumCache::Storage::None : carrierCacheStorage;
+}
+
+std::shared_ptr<const CarrierAssetFile> VSTEmotionRendererAudioProcessor::openLinkedCarrier (const char* assetName, double sampleRate)
+{
+   #if VSTEMOTIONRENDERER_LINKED_CARRIERS
+    // Projucer names the resource for tableSaw_48000.carrier tableSaw_48000_carrier
+    const auto resourceName = juce::String(assetName) + "_" + juce::String(juce::roundToInt(sampleRate)) + "_carrier";
+    int size = 0;
+    if (const auto* data = BinaryData::getNamedResource(resourceName.toRawUTF8(), size))
+    {
+        juce::String error;
+        auto asset = CarrierAssetFile::openStatic(data, (size_t)size, resourceName, error);
+        // a damaged resource falls back to the compressed table; rebuild it with CarrierAssetTool
+        jassert(asset != nullptr);
+        if (asset != nullptr && asset->getSampleRate() == sampleRate)
+            return asset;
+    }
+   #else
+    juce::ignoreUnused(assetName, sampleRate);
+   #endif
+    return nullptr;
+}
+
+bool VSTEmotionRendererAudioProcessor::isCarrierFile (const juce::String& path)
+{
+    return path.endsWithIgnoreCase(".carrier") || path.endsWithIgnoreCase(".wav") || path.endsWithIgnoreCase(".aif")
+        || path.endsWithIgnoreCase(".aiff") || path.endsWithIgnoreCase(".flac") || path.endsWithIgnoreCase(".ogg");
+}
+
+void VSTEmotionRendererAudioProcessor::loadUserCarrier (const juce::File& file, bool select)
+{
+    if (select)
+    {
+        if (auto* parameter = parameters.getParameter("carrierA"))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1((float)userCarrierIndex));
+    }
+    // saved with the parameters, so the project reloads it
+    parameters.state.setProperty("userCarrier", file.getFullPathName(), nullptr);
+
+    userCarrierLoader.addJob([this, file]
+    {
+        UserCarrier loaded;
+        juce::String error;
+        const auto loadedOk = readUserCarrier(file, loaded, error);
+        double sampleRate;
+        {
+            const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+            sampleRate = carrierSampleRate;
+        }
+        // analysed here, before anyone can ask the registry for it, so it is built once
+        // and the pair below is published as soon as this returns
+        if (loadedOk && sampleRate > 0.0)
+            getCarrierCache(loaded.samples, loaded.length, loaded.sampleRate, sampleRate, true);
+
+        {
+            const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+            if (! loadedOk)
+            {
+                userCarrierStatus = error;
+                return;
+            }
+            loaded.generation = userCarrier.generation + 1;
+            userCarrier = loaded;
+            userCarrierStatus = file.getFileName();
+        }
+        updateCarriers(false);
+    });
+}
+
+juce::String VSTEmotionRendererAudioProcessor::getUserCarrierStatus()
+{
+    const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+    return userCarrierStatus;
+}
+
+bool VSTEmotionRendererAudioProcessor::readUserCarrier (const juce::File& file, UserCarrier& loaded, juce::String& error)
+{
+    loaded.path = file.getFullPathName();
+    if (file.hasFileExtension(".carrier"))
+    {
+        auto asset = CarrierAssetFile::open(file, error);
+        if (asset == nullptr)
+            return false;
+        loaded.samples = asset->getLoop();
+        loaded.length = asset->getLoopLength();
+        loaded.sampleRate = asset->getSampleRate();
+        loaded.handle = carrierRegistry->addTable(loaded.samples, asset);
+
+        // spectra stored in the file are used as they are when they fit this host
+        double sampleRate;
+        {
+            const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+            sampleRate = carrierSampleRate;
+        }
+        if (sampleRate != loaded.sampleRate)
+            return true;
+        auto mipmap = carrierRegistry->getMipmap(loaded.samples, loaded.length, loaded.sampleRate, sampleRate);
+        if (auto cache = asset->getSpectrumCache(sampleRate, myUtils.getFrameSize(), myUtils.getShiftSize(), carrierWhitening, mipmap))
+            carrierRegistry->addSpectrumCache(loaded.samples, loaded.length, loaded.sampleRate, sampleRate,
+                                              myUtils.getFrameSize(), myUtils.getShiftSize(), getCarrierStorage(loaded.length),
+                                              carrierWhitening, std::move(cache));
+        return true;
+    }
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+    if (reader == nullptr)
+    {
+        error = "cannot read " + file.getFileName();
+        return false;
+    }
+    const auto length = (int)juce::jmin(reader->lengthInSamples, (juce::int64)(maxUserCarrierSeconds * reader->sampleRate));
+    if (length < 2 * myUtils.getFrameSize())
+    {
+        error = file.getFileName() + " is too short";
+        return false;
+    }
+
+    // mixed down to mono: the carrier is one table whatever the file
+    juce::AudioBuffer<float> decoded((int)reader->numChannels, length);
+    reader->read(&decoded, 0, length, 0, true, true);
+    auto mono = std::make_shared<std::vector<float>>((size_t)length, 0.0f);
+    for (int channel = 0; channel < decoded.getNumChannels(); ++channel)
+    {
+        juce::FloatVectorOperations::addWithMultiply(mono->data(), decoded.getReadPointer(channel),
+                                                     1.0f / decoded.getNumChannels(), length);
+    }
+
+    loaded.samples = mono->data();
+    loaded.length = length;
+    loaded.sampleRate = reader->sampleRate;
+    loaded.handle = carrierRegistry->addTable(loaded.samples, mono);
+    return true;
+}
+
+void VSTEmotionRendererAudioProcessor::updateCarriers (bool waitForLoad)
+{
+    // the timer and prepareToPlay may be on different threads, and carrierPairs takes one publisher at a time
+    const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+    if (carrierSampleRate <= 0.0)
+        return;
+
+    const auto firstIndex = (int)firstCarrierParameter->load();
+    const auto secondIndex = (int)secondCarrierParameter->load();
+    const bool usesUserCarrier = firstIndex == userCarrierIndex || secondIndex == userCarrierIndex;
+    const auto* current = carrierPairs.get();
+    if (current != nullptr && current->firstIndex == firstIndex && current->secondIndex == secondIndex
+        && current->sampleRate == carrierSampleRate && (! usesUserCarrier || current->userGeneration == userCarrier.generation))
+    {
+        carrierPairs.collect();
+        return;
+    }
+
+    // a carrier still loading in the background keeps the current pair playing until it is ready
+    auto first = getCarrierCache(firstIndex, waitForLoad);
+    auto second = getCarrierCache(secondIndex, waitForLoad);
+    if (first == nullptr || second == nullptr)
+        return;
+
+    std::unique_ptr<CarrierPair> pair(new CarrierPair { firstIndex, secondIndex, carrierSampleRate, userCarrier.generation,
+                                                        std::move(first), std::move(second),
+                                                        usesUserCarrier ? userCarrier.handle : nullptr });
+    carrierPairs.publish(std::move(pair));
+}
+
+void VSTEmotionRendererAudioProcessor::updateFormantShift()
+{
+    // the remap table allocates, so it is built here on the message thread and
+    // handed to the audio thread ready to use
+    const auto semitones = formantParameter->load();
+    const auto* current = formantShifts.get();
+    if (current == nullptr || current->getSemitones() != semitones)
+        formantShifts.publish(std::make_unique<DSP::FormantShift>(myUtils.getFrameSize() / 2 + 1, semitones));
+    else
+        formantShifts.collect();
 }
 
 //==============================================================================
@@ -102,24 +376,162 @@ void VSTEmotionRendererAudioProcessor::prepareToPlay (double sampleRate, int sam
 {
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
-    const auto numChannels = getNumInputChannels();
-    /*
-    for (size_t ch = 0; ch < numChannels; ch++)
+    // the sidechain is a carrier, so only the main bus gets vocoders
+    const auto numChannels = getMainBusNumInputChannels();
+    currentSampleRate = sampleRate;
     {
-        filterMatrix.emplace_back(FilterArray());
-        for (size_t i = 0; i < 48; i++)
-        {
-            filterMatrix[ch][i].setCoefficients(sampleRate, freqList[i], 5.0f);
-        }
+        const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+        carrierSampleRate = sampleRate;
     }
-    */
-    currentSampleRate = sampleRate;
+    // the selected carriers are ready before the first block, any others load when picked
+    updateCarriers(true);
     tempBuffer.setSize(1, samplesPerBlock);
     tempBuffer.clear();
     filterBuffer.setSize(1, samplesPerBlock);
     filterBuffer.clear();
-    toProcess.resize(numChannels);
-    toPass.resize(numChannels);
+
+    // every channel runs its own STFT state and streams whole hops through it,
+    // so the output is delayed by exactly one hop whatever the host block size
+    shiftNum = myUtils.getShiftSize();
+    channelVocoders.clear();
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        channelVocoders.emplace_back(std::make_unique<DSP::MyUtils>());
+        channelVocoders.back()->prepare(sampleRate);
+    }
+    toProcess.assign(numChannels, std::vector<float>(shiftNum, 0.0f));
+    toPass.assign(numChannels, std::vector<float>(shiftNum, 0.0f));
+    dryDelay.assign(numChannels, std::vector<float>(shiftNum, 0.0f));
+    sidechainHop.assign(numChannels, std::vector<float>(shiftNum, 0.0f));
+    hopPosition = 0;
+    waveTablePosition = 0.0;
+    carrierHopCount = 0;
+
+    bandVocoders.clear();
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        bandVocoders.emplace_back(std::make_unique<DSP::BandVocoder>());
+        bandVocoders.back()->prepare(sampleRate);
+    }
+
+    currentEngine = (int)engineParameter->load();
+    requestedEngine = currentEngine;
+    setLatencySamples(currentEngine == stftEngine ? shiftNum : 0);
+}
+
+void VSTEmotionRendererAudioProcessor::updateEngine()
+{
+    // the host is told about the new latency here, off the audio thread, before the audio
+    // thread switches engines at its next block
+    const auto engine = (int)engineParameter->load();
+    if (engine == requestedEngine.load())
+        return;
+    setLatencySamples(engine == stftEngine ? shiftNum : 0);
+    requestedEngine = engine;
+}
+
+void VSTEmotionRendererAudioProcessor::setEngine (int engine)
+{
+    // the STFT engine is a hop late, the filter bank has no latency
+    for (auto& channelFifo : toProcess)
+        std::fill(channelFifo.begin(), channelFifo.end(), 0.0f);
+    for (auto& channelFifo : toPass)
+        std::fill(channelFifo.begin(), channelFifo.end(), 0.0f);
+    for (auto& channelFifo : dryDelay)
+        std::fill(channelFifo.begin(), channelFifo.end(), 0.0f);
+    for (auto& channelFifo : sidechainHop)
+        std::fill(channelFifo.begin(), channelFifo.end(), 0.0f);
+    for (auto& bandVocoder : bandVocoders)
+        bandVocoder->reset();
+
+    hopPosition = 0;
+    snapToCarrierGrid();
+    currentEngine = engine;
+}
+
+void VSTEmotionRendererAudioProcessor::snapToCarrierGrid()
+{
+    // back onto the carrier cache grid, where hops read whole frames
+    waveTablePosition -= std::fmod(waveTablePosition, (double)carriers->first->getGridSize());
+}
+
+double VSTEmotionRendererAudioProcessor::wrapCarrierPosition (double position, int tableLength)
+{
+    position = std::fmod(position, (double)tableLength);
+    return position < 0.0 ? position + tableLength : position;
+}
+
+double VSTEmotionRendererAudioProcessor::getHopJitter (uint64_t hop)
+{
+    // splitmix64 of the hop count, so every channel jitters its copy of a hop the same way
+    auto z = hop * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return (double)(z >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+void VSTEmotionRendererAudioProcessor::processFilterBank (juce::AudioBuffer<float>& buffer, int numChannels,
+                                                          const juce::AudioBuffer<float>* sidechain)
+{
+    const int numSamples = buffer.getNumSamples();
+    const auto& first = *carriers->first;
+    const auto& second = *carriers->second;
+    const auto* table = first.getTable();
+    const int tableLength = first.getTableLength();
+    int carrierPosition = (int)waveTablePosition;
+
+    // a morph is the same equal-power crossfade as the STFT engine's, done on the samples
+    const auto morph = morphParameter->load();
+    const bool morphing = &first != &second && morph > 0.0f;
+    const auto firstGain = (float)std::cos(morph * 0.5 * juce::MathConstants<double>::pi);
+    const auto secondGain = (float)std::sin(morph * 0.5 * juce::MathConstants<double>::pi);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto *data = buffer.getWritePointer (channel);
+        auto& bandVocoder = *bandVocoders[channel];
+        const float* sidechainData = sidechain != nullptr
+            ? sidechain->getReadPointer(juce::jmin(channel, sidechain->getNumChannels() - 1)) : nullptr;
+        carrierPosition = (int)waveTablePosition;
+
+        for (int start = 0; start < numSamples; start += (int)bandOutput.size())
+        {
+            const int num = juce::jmin((int)bandOutput.size(), numSamples - start);
+            if (sidechainData != nullptr)
+            {
+                // the block of sidechain samples is the carrier "table", read once from the start
+                bandVocoder.process(sidechainData + start, num, 0, data + start, bandOutput.data(), num);
+                carrierPosition = (carrierPosition + num) % tableLength;
+            }
+            else if (morphing)
+            {
+                // carrier B restarts whenever carrier A loops, as in the STFT engine
+                const DSP::CarrierOscillator firstOscillator(table, tableLength);
+                const DSP::CarrierOscillator secondOscillator(second.getTable(), second.getTableLength());
+                for (int done = 0; done < num;)
+                {
+                    const int run = juce::jmin(num - done, tableLength - carrierPosition);
+                    firstOscillator.process(carrierPosition, 1.0, bandCarrier.data() + done, run, firstGain);
+                    secondOscillator.process(carrierPosition, 1.0, bandCarrier.data() + done, run, secondGain, true);
+                    carrierPosition = (carrierPosition + run) % tableLength;
+                    done += run;
+                }
+                bandVocoder.process(bandCarrier.data(), num, 0, data + start, bandOutput.data(), num);
+            }
+            else
+            {
+                carrierPosition = bandVocoder.process(table, tableLength, carrierPosition, data + start, bandOutput.data(), num);
+            }
+            for (int i = 0; i < num; ++i)
+            {
+                auto mix = mixParameter->load();
+                data[start + i] = bandOutput[i] * mix + data[start + i] * (1 - mix);
+            }
+        }
+    }
+
+    waveTablePosition = carrierPosition;
 }
 
 void VSTEmotionRendererAudioProcessor::releaseResources()
@@ -149,6 +561,16 @@ bool VSTEmotionRendererAudioProcessor::isBusesLayoutSupported (const BusesLayout
         return false;
    #endif
 
+    // the optional sidechain carrier can be off, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechain = layouts.getChannelSet(true, 1);
+        if (! sidechain.isDisabled()
+         && sidechain != juce::AudioChannelSet::mono()
+         && sidechain != juce::AudioChannelSet::stereo())
+            return false;
+    }
+
     return true;
   #endif
 }
@@ -175,107 +597,143 @@ void VSTEmotionRendererAudioProcessor::processBlock (juce::AudioBuffer<float>& b
     // the samples and the outer loop is handling the channels.
     // Alternatively, you can process the samples with the channels
     // interleaved by keeping the same state.
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
+    const int numChannels = juce::jmin(getMainBusNumInputChannels(), (int)channelVocoders.size());
+    const int engine = requestedEngine.load();
+    // the pair may have changed since the last block, so the position is wrapped to its tables
+    carriers = carrierPairs.get();
+    if (carriers == nullptr)
     {
-        auto *data = buffer.getWritePointer (channel);
-        auto numSamples = buffer.getNumSamples();
-        int currentShiftNum = 1024;
-
-        // create input vector for stft
-        std::vector<double> inputVector;
-        std::vector<double> carrierVector;
+        // nothing published yet (not prepared, or no carrier ready): silence until there is
+        buffer.clear();
+        audioBlocksDone.fetch_add(1, std::memory_order_acq_rel);
+        return;
+    }
+    waveTablePosition = std::fmod(waveTablePosition, (double)carriers->first->getTableLength());
+    if (engine != currentEngine)
+        setEngine(engine);
+
+    // an enabled sidechain replaces the wave table as the carrier; its channels are
+    // read in place from the host buffer
+    auto* sidechainBus = getBus(true, 1);
+    const bool useSidechain = sidechainBus != nullptr && sidechainBus->isEnabled() && sidechainBus->getNumberOfChannels() > 0;
+    auto sidechain = getBusBuffer(buffer, true, 1);
+    const auto* sidechainBuffer = useSidechain && sidechain.getNumChannels() > 0 ? &sidechain : nullptr;
+
+    if (currentEngine == filterBankEngine)
+        processFilterBank(buffer, numChannels, sidechainBuffer);
+    else
+        processStft(buffer, numChannels, sidechainBuffer);
+
+    // anything read from a DeferredSwap during this block may be freed from now on
+    audioBlocksDone.fetch_add(1, std::memory_order_acq_rel);
+}
 
-        // output_signal would be equal to or larger than numSamples due to adding zero when applySTFT.
-        std::vector<double> output_signal;
+void VSTEmotionRendererAudioProcessor::processStft (juce::AudioBuffer<float>& buffer, int numChannels,
+                                                    const juce::AudioBuffer<float>* sidechain)
+{
+    const auto envelopeMode = (DSP::MyUtils::EnvelopeMode)(int)envelopeParameter->load();
+    const auto* formantShift = formantShifts.get();
+    const auto attackSeconds = attackParameter->load() * 0.001;
+    const auto releaseSeconds = releaseParameter->load() * 0.001;
+    const auto pitchTrack = pitchTrackParameter->load() >= 0.5f;
+    const auto pitchReference = (double)pitchReferenceParameter->load();
+    const auto interpolation = (DSP::CarrierOscillator::Interpolation)(int)interpolationParameter->load();
+    const auto unvoicedBlend = unvoicedParameter->load();
+    // scanning moves the carrier on scanSpeed hops per hop (none when frozen) and jitters
+    // each hop's read around that; hops between cached frames are read between them
+    const auto scanSpeed = freezeParameter->load() >= 0.5f ? 0.0 : (double)scanSpeedParameter->load();
+    const auto scanJitter = scanJitterParameter->load() * 0.001 * currentSampleRate;
+    const bool scanning = scanSpeed != 1.0 || scanJitter > 0.0;
+    if (! scanning)
+        snapToCarrierGrid();
+    const auto voices = (int)voicesParameter->load();
+    const auto unisonSpread = unisonSpreadParameter->load() * 0.001 * currentSampleRate;
+    const auto unisonDetune = (double)unisonDetuneParameter->load();
+    for (auto& vocoder : channelVocoders)
+    {
+        vocoder->setEnvelopeMode(envelopeMode);
+        vocoder->setSmoothing(attackSeconds, releaseSeconds);
+        vocoder->setFormantShift(formantShift);
+        vocoder->setPitchTracking(pitchTrack, pitchReference);
+        vocoder->setCarrierInterpolation(interpolation);
+        vocoder->setUnvoicedBlend(unvoicedBlend);
+        vocoder->setScanning(scanning);
+        vocoder->setUnison(voices, unisonSpread, unisonDetune);
+    }
 
-        waveTableIndex = currentTableIndex;
+    const auto morph = morphParameter->load();
+    const int numSamples = buffer.getNumSamples();
+    const int tableLength = carriers->first->getTableLength();
+    int position = hopPosition;
+    double carrierPosition = waveTablePosition;
+    uint64_t hopCount = carrierHopCount;
 
-        //make compatible for any buffer size, by compare buffer size to shift num
-        if (numSamples >= currentShiftNum)
-        {
-            
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                waveTableIndex = (waveTableIndex+1) % myWaveTable.tableSaw.size();
-                inputVector.emplace_back(data[i]);
-                carrierVector.emplace_back(myWaveTable.tableSaw[waveTableIndex]);
-            }
-            
-            auto rms = myUtils.calculateRMS(data, numSamples);
-            if (rms > 0.0)
-            {
-                myUtils.applyVocoder(carrierVector, inputVector, output_signal);
-            }
-            else
-            {
-                for (size_t i = 0; i < numSamples; ++i)
-                {
-                    output_signal.emplace_back(0.0);
-                }
-            }
-        }
-        else
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto *data = buffer.getWritePointer (channel);
+        auto& vocoder = *channelVocoders[channel];
+        auto& inputHop = toProcess[channel];
+        auto& outputHop = toPass[channel];
+        auto& dryHop = dryDelay[channel];
+        auto& carrierHop = sidechainHop[channel];
+        const float* sidechainData = sidechain != nullptr
+            ? sidechain->getReadPointer(juce::jmin(channel, sidechain->getNumChannels() - 1)) : nullptr;
+
+        // all channels see the same samples, so they all start from the shared hop position
+        position = hopPosition;
+        carrierPosition = waveTablePosition;
+        hopCount = carrierHopCount;
+
+        for (int i = 0; i < numSamples; ++i)
         {
-            for (size_t i = 0; i < numSamples; ++i)
-            {
-                toProcess[channel].emplace_back(data[i]);
-            }
-            
-            if (toProcess[channel].size() >= currentShiftNum)
+            // output lags the input by one hop; the dry signal is delayed to match
+            auto mix = mixParameter->load();
+            const auto input = data[i];
+            data[i] = outputHop[position] * mix + dryHop[position] * (1 - mix);
+            inputHop[position] = input;
+
+            if (++position == shiftNum)
             {
-                for (size_t i = 0; i < currentShiftNum; ++i)
+                auto rms = myUtils.calculateRMS(inputHop.data(), shiftNum);
+                if (rms > 0.0 && sidechainData != nullptr)
                 {
-                    waveTableIndex = (waveTableIndex+1) % myWaveTable.tableSaw.size();
-                    inputVector.emplace_back(toProcess[channel][i]);
-                    carrierVector.emplace_back(myWaveTable.tableSaw[waveTableIndex]);
+                    // a hop that started in this block is analysed straight from the host
+                    // buffer; only one that started in the last block needs its head from carrierHop
+                    const int hopStart = i + 1 - shiftNum;
+                    if (hopStart < 0)
+                        std::copy(sidechainData, sidechainData + i + 1, carrierHop.begin() - hopStart);
+                    vocoder.processHop<float>(hopStart < 0 ? carrierHop.data() : sidechainData + hopStart,
+                                              inputHop.data(), outputHop.data());
                 }
-                toProcess[channel].erase(toProcess[channel].begin(), toProcess[channel].begin()+currentShiftNum);
-                auto rms = myUtils.calculateRMS(inputVector, currentShiftNum);
-                if (rms > 0.0)
+                else if (rms > 0.0)
                 {
-                    myUtils.applyVocoder(carrierVector, inputVector, toPass[channel]);
+                    const auto hopCarrierPosition = scanJitter > 0.0 ? carrierPosition + scanJitter * getHopJitter(hopCount)
+                                                                     : carrierPosition;
+                    vocoder.processHop<float>(*carriers->first, *carriers->second, morph, hopCarrierPosition,
+                                              inputHop.data(), outputHop.data());
                 }
                 else
                 {
-                    for (size_t i = 0; i < currentShiftNum; ++i)
-                    {
-                        toPass[channel].emplace_back(0.0);
-                    }
-                        
-                }
-            }
-
-            if (toPass[channel].size() > 0)
-            {
-                for (size_t i = 0; i < numSamples; ++i)
-                {
-                    output_signal.emplace_back(toPass[channel][i]);
+                    std::fill(outputHop.begin(), outputHop.end(), 0.0f);
                 }
-                toPass[channel].erase(toPass[channel].begin(), toPass[channel].begin()+numSamples);
+                std::swap(inputHop, dryHop);
+                carrierPosition = wrapCarrierPosition(carrierPosition + scanSpeed * shiftNum, tableLength);
+                ++hopCount;
+                position = 0;
             }
-            else
-            {
-                for (size_t i = 0; i < numSamples; ++i)
-                {
-                    output_signal.emplace_back(0.0);
-                }
-            }
-            
         }
 
-        
-        
-        for (size_t i = 0; i < numSamples; ++i)
+        if (sidechainData != nullptr)
         {
-            auto mix = mixParameter->load();
-            //data[i] = outData[i] * mix + data[i] * (1 - mix);
-            data[i] = output_signal[i] * mix + data[i] * (1 - mix);
-
+            // keep the part of the unfinished hop that is in this block for the next one
+            const int fromHop = juce::jmax(0, position - numSamples);
+            std::copy(sidechainData + numSamples - (position - fromHop), sidechainData + numSamples, carrierHop.begin() + fromHop);
         }
-        //filterBuffer.clear(0, 0, filterBuffer.getNumSamples());
     }
 
-    currentTableIndex = waveTableIndex;
+    hopPosition = position;
+    waveTablePosition = carrierPosition;
+    carrierHopCount = hopCount;
 
 }
 
@@ -284,6 +742,24 @@ juce::AudioProcessorValueTreeState::ParameterLayout VSTEmotionRendererAudioProce
 {
     juce::AudioProcessorValueTreeState::ParameterLayout params;
     params.add(std::make_unique<juce::AudioParameterFloat>("mix", "Mix", juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f), 0.0f));//min max minimal_change default
+    params.add(std::make_unique<juce::AudioParameterChoice>("engine", "Engine", juce::StringArray{"STFT", "Filter bank"}, 0));//STFT vocoder or zero latency filter bank
+    params.add(std::make_unique<juce::AudioParameterChoice>("envelope", "Envelope", juce::StringArray{"Raw", "Mel", "Cepstrum", "LPC"}, 0));//modulator envelope of the STFT engine
+    params.add(std::make_unique<juce::AudioParameterFloat>("attack", "Attack", juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f), 5.0f));//envelope smoothing in ms
+    params.add(std::make_unique<juce::AudioParameterFloat>("release", "Release", juce::NormalisableRange<float>(0.0f, 500.0f, 1.0f), 50.0f));
+    params.add(std::make_unique<juce::AudioParameterChoice>("carrierA", "Carrier A", getCarrierNames(), 0));//carriers morphed between
+    params.add(std::make_unique<juce::AudioParameterChoice>("carrierB", "Carrier B", getCarrierNames(), 0));
+    params.add(std::make_unique<juce::AudioParameterFloat>("morph", "Morph", juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f), 0.0f));//0 is carrier A, 1 is carrier B
+    params.add(std::make_unique<juce::AudioParameterBool>("pitchTrack", "Pitch track", false));//carrier follows the modulator pitch (STFT engine)
+    params.add(std::make_unique<juce::AudioParameterFloat>("pitchReference", "Pitch reference", juce::NormalisableRange<float>(60.0f, 500.0f, 1.0f), 200.0f));//voice pitch in Hz that plays the carrier as recorded
+    params.add(std::make_unique<juce::AudioParameterChoice>("interpolation", "Interpolation", juce::StringArray{"Linear", "Cubic", "Hermite"}, 0));//carrier read between samples when pitch tracked
+    params.add(std::make_unique<juce::AudioParameterFloat>("scanSpeed", "Scan speed", juce::NormalisableRange<float>(-2.0f, 2.0f, 0.01f), 1.0f));//carrier hops read per hop (STFT engine), negative scans backwards
+    params.add(std::make_unique<juce::AudioParameterFloat>("scanJitter", "Scan jitter", juce::NormalisableRange<float>(0.0f, 1000.0f, 1.0f), 0.0f));//random offset of each hop's carrier read in ms
+    params.add(std::make_unique<juce::AudioParameterBool>("freeze", "Freeze", false));//carrier read position stops moving
+    params.add(std::make_unique<juce::AudioParameterInt>("voices", "Voices", 1, 8, 1));//unison copies of the carrier (STFT engine)
+    params.add(std::make_unique<juce::AudioParameterFloat>("unisonSpread", "Unison spread", juce::NormalisableRange<float>(0.0f, 500.0f, 1.0f), 50.0f));//ms between the first and last voice's read position
+    params.add(std::make_unique<juce::AudioParameterFloat>("unisonDetune", "Unison detune", juce::NormalisableRange<float>(0.0f, 50.0f, 0.1f), 10.0f));//cents of the outer voices
+    params.add(std::make_unique<juce::AudioParameterFloat>("unvoiced", "Unvoiced", juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f), 1.0f));//noise carrier on unvoiced hops (STFT engine)
+    params.add(std::make_unique<juce::AudioParameterFloat>("formant", "Formant", juce::NormalisableRange<float>(-12.0f, 12.0f, 0.1f), 0.0f));//semitones
 
     return params;
 }
@@ -312,6 +788,17 @@ void VSTEmotionRendererAudioProcessor::setStateInformation (const void* data, in
     if(xmlState.get() != nullptr)
         if(xmlState->hasTagName(parameters.state.getType()))
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+    // the carrier parameters already point at "User file" if it was selected; hosts may
+    // restore the same state more than once, and the file is only decoded again if it changed
+    const juce::File userCarrierFile(parameters.state.getProperty("userCarrier").toString());
+    bool alreadyLoaded;
+    {
+        const std::lock_guard<std::mutex> lock(carrierUpdateLock);
+        alreadyLoaded = userCarrier.path == userCarrierFile.getFullPathName();
+    }
+    if (userCarrierFile.existsAsFile() && ! alreadyLoaded)
+        loadUserCarrier(userCarrierFile, false);
 }
 
 //==============================================================================
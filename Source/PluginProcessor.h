@@ -10,13 +10,19 @@
 
 #include <JuceHeader.h>
 #include "EmotionDSP.h"
+#include "BandVocoder.h"
 #include "WaveTable.h"
+#include "Carrier/CarrierAssetFile.h"
+#include "Carrier/CarrierRegistry.h"
+#include "DeferredSwap.h"
+#include <mutex>
 #include <vector>
 
 //==============================================================================
 /**
 */
-class VSTEmotionRendererAudioProcessor  : public juce::AudioProcessor
+class VSTEmotionRendererAudioProcessor  : public juce::AudioProcessor,
+                                          private juce::Timer
                             #if JucePlugin_Enable_ARA
                              , public juce::AudioProcessorARAExtension
                             #endif
@@ -43,6 +49,19 @@ public:
     //==============================================================================
     const juce::String getName() const override;
 
+    /** Names of the carrier library, in the order of the carrier parameters; the last one is the user carrier. */
+    static juce::StringArray getCarrierNames();
+
+    /** True for files loadUserCarrier() can read: audio files and .carrier files. */
+    static bool isCarrierFile (const juce::String& path);
+
+    /** Decodes file as the user carrier on a background thread and, with select, picks it as
+        carrier A. Until it is ready the current carriers keep playing. Message thread. */
+    void loadUserCarrier (const juce::File& file, bool select = true);
+
+    /** File name of the user carrier, or why it failed to load; empty before any. */
+    juce::String getUserCarrierStatus();
+
 
     bool acceptsMidi() const override;
     bool producesMidi() const override;
@@ -67,69 +86,123 @@ private:
     juce::AudioProcessorValueTreeState parameters;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     std::atomic<float>* mixParameter = nullptr;
-    int waveTableIndex = 0;
-    int currentTableIndex = 0;
-    WaveTable::AllWaveTable myWaveTable;
+    std::atomic<float>* engineParameter = nullptr;
+    std::atomic<float>* envelopeParameter = nullptr;
+    std::atomic<float>* attackParameter = nullptr;
+    std::atomic<float>* releaseParameter = nullptr;
+    std::atomic<float>* formantParameter = nullptr;
+    std::atomic<float>* firstCarrierParameter = nullptr;
+    std::atomic<float>* secondCarrierParameter = nullptr;
+    std::atomic<float>* morphParameter = nullptr;
+    std::atomic<float>* pitchTrackParameter = nullptr;
+    std::atomic<float>* pitchReferenceParameter = nullptr;
+    std::atomic<float>* interpolationParameter = nullptr;
+    std::atomic<float>* unvoicedParameter = nullptr;
+    std::atomic<float>* scanSpeedParameter = nullptr;
+    std::atomic<float>* scanJitterParameter = nullptr;
+    std::atomic<float>* freezeParameter = nullptr;
+    std::atomic<float>* voicesParameter = nullptr;
+    std::atomic<float>* unisonSpreadParameter = nullptr;
+    std::atomic<float>* unisonDetuneParameter = nullptr;
+    enum Engine { stftEngine = 0, filterBankEngine };
+    int currentEngine = stftEngine;
+    // the engine the parameter asks for, set by the timer once the host knows its latency
+    std::atomic<int> requestedEngine { stftEngine };
+    void updateEngine();
+    // audio thread: switches to engine, clearing the state of the other one
+    void setEngine (int engine);
+    // sidechain is the carrier bus when it is enabled, nullptr to play the wave tables
+    void processFilterBank (juce::AudioBuffer<float>& buffer, int numChannels, const juce::AudioBuffer<float>* sidechain);
+    void processStft (juce::AudioBuffer<float>& buffer, int numChannels, const juce::AudioBuffer<float>* sidechain);
+
+    /** The two carriers being morphed, by library index, with their spectral caches at sampleRate. */
+    struct CarrierPair
+    {
+        int firstIndex;
+        int secondIndex;
+        double sampleRate;
+        // which user carrier a pair using it was built from
+        int userGeneration;
+        std::shared_ptr<const DSP::CarrierSpectrumCache> first;
+        std::shared_ptr<const DSP::CarrierSpectrumCache> second;
+        // the registry handle of the user carrier when the pair plays it, so it is kept until the pair goes
+        std::shared_ptr<const void> userTable;
+    };
+    // this block's pair, read once at the top of processBlock
+    const CarrierPair* carriers = nullptr;
+
+    // objects built on the message thread and read by the audio thread; freed only
+    // after the audio thread has finished the block that could still see them
+    std::atomic<uint64_t> audioBlocksDone { 0 };
+    DSP::DeferredSwap<DSP::FormantShift> formantShifts { audioBlocksDone };
+    DSP::DeferredSwap<CarrierPair> carrierPairs { audioBlocksDone };
+    void timerCallback() override;
+    void updateFormantShift();
+    void updateCarriers (bool waitForLoad);
+    std::mutex carrierUpdateLock;
+    // host rate the carriers are resampled to, 0 until prepareToPlay
+    double carrierSampleRate = 0.0;
+    std::shared_ptr<const DSP::CarrierSpectrumCache> getCarrierCache (int index, bool waitForLoad);
+    std::shared_ptr<const DSP::CarrierSpectrumCache> getCarrierCache (const float* samples, int length, double tableRate,
+                                                                      double sampleRate, bool waitForLoad);
+
+    /** A dropped file, mono at its own rate; the registry keeps the samples alive while
+        handle, or a copy of it in a pair, does. */
+    struct UserCarrier
+    {
+        juce::String path;
+        const float* samples = nullptr;
+        int length = 0;
+        double sampleRate = 0.0;
+        // counts loads, so pairs built from an older file are replaced
+        int generation = 0;
+        std::shared_ptr<const void> handle;
+    };
+    // guarded by carrierUpdateLock, like carrierSampleRate
+    UserCarrier userCarrier;
+    juce::String userCarrierStatus;
+    static constexpr int userCarrierIndex = WaveTable::AllWaveTable::numCarriers;
+    // longer files are cut, so a dropped file cannot take minutes to analyse
+    static constexpr double maxUserCarrierSeconds = 30.0;
+    // past this a carrier's frames are not cached and it is analysed live, as the
+    // cache of a table whose length shares few factors with the hop holds a frame every few samples
+    static constexpr size_t maxCarrierCacheBytes = 64 << 20;
+    bool readUserCarrier (const juce::File& file, UserCarrier& loaded, juce::String& error);
+    DSP::CarrierSpectrumCache::Storage getCarrierStorage (int playedLength) const;
+    /** The CarrierAssetTool file for assetName at sampleRate when the build links one, else nullptr. */
+    static std::shared_ptr<const CarrierAssetFile> openLinkedCarrier (const char* assetName, double sampleRate);
+    // carrier read position of the next hop; between samples only while scanning
+    double waveTablePosition = 0.0;
+    // hops since prepareToPlay, which seed the scan jitter
+    uint64_t carrierHopCount = 0;
+    void snapToCarrierGrid();
+    static double wrapCarrierPosition (double position, int tableLength);
+    /** A value in [-1, 1) for each hop, the same on every channel. */
+    static double getHopJitter (uint64_t hop);
+    int hopPosition = 0;
+    int shiftNum = 1024;
+    juce::SharedResourcePointer<DSP::CarrierRegistry> carrierRegistry;
+    // None analyses the carrier live (least memory), Half/Float/Double cache every carrier frame once
+    const DSP::CarrierSpectrumCache::Storage carrierCacheStorage = DSP::CarrierSpectrumCache::Storage::Float;
+    // flatten the carrier's long-term spectrum so its tilt does not colour the output
+    const bool carrierWhitening = true;
     juce::AudioSampleBuffer filterBuffer;
     juce::AudioSampleBuffer tempBuffer;
     DSP::MyUtils myUtils;
-    std::vector<std::vector<double> > toProcess;
-    std::vector<std::vector<double> > toPass;
+    std::vector<std::unique_ptr<DSP::MyUtils> > channelVocoders;
+    // per channel: input hop being filled, last vocoded hop, and the dry input delayed by one hop
+    std::vector<std::vector<float> > toProcess;
+    std::vector<std::vector<float> > toPass;
+    std::vector<std::vector<float> > dryDelay;
+    // head of a sidechain carrier hop that started in the previous block
+    std::vector<std::vector<float> > sidechainHop;
+    std::vector<std::unique_ptr<DSP::BandVocoder> > bandVocoders;
+    std::array<float, 256> bandOutput;
+    std::array<float, 256> bandCarrier;
     double currentSampleRate;
-    /*
-    using FilterArray = std::array<DSP::BandPassFilter, 48>;
-    std::vector<FilterArray> filterMatrix;
-    std::array<float, 48> freqList{
-        185.00f,
-        196.00f,
-        207.65f,
-        220.00f,
-        233.08f,
-        246.94f,
-        261.63f,
-        277.18f,
-        293.66f,
-        311.13f,
-        329.63f,
-        349.23f,
-        369.99f,
-        392.00f,
-        415.30f,
-        440.00f,
-        466.16f,
-        493.88f,
-        523.25f,
-        554.37f,
-        587.33f,
-        622.25f,
-        659.25f,
-        698.46f,
-        739.99f,
-        783.99f,
-        830.61f,
-        880.00f,
-        932.33f,
-        987.77f,
-        1046.50f,
-        1108.73f,
-        1174.66f,
-        1244.51f,
-        1318.51f,
-        1396.91f,
-        1479.98f,
-        1567.98f,
-        1661.22f,
-        1760.00f,
-        1864.66f,
-        1975.53f,
-        2093.00f,
-        2217.46f,
-        2349.32f,
-        2489.02f,
-        2637.02f,
-        2793.83f,
-    };
-    */
+    // decoding, resampling and analysis of dropped files, one at a time; last so its
+    // jobs are gone before anything they use
+    juce::ThreadPool userCarrierLoader { 1 };
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VSTEmotionRendererAudioProcessor)
 };
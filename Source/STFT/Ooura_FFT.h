@@ -32,6 +32,9 @@ public:
     inline void iFFT(double *);
     inline void SingleFFT(double *);
     inline void SingleiFFT(double *);
+    /* Cosine transform (dfct) of frame_size/2 + 1 points, e.g. a half spectrum,
+       on the same cos/sin tables as the FFT.  */
+    inline void DFCT(double *);
 };
 
 /*
@@ -355,6 +358,13 @@ inline Ooura_FFT::Ooura_FFT(int _frame_size, int _channels){
     ip = new int *[channels];
     for (int i = 0; i < channels; i++)
         ip[i] = new int[(int)(sqrt(frame_size / 2)) + 1];
+
+    // tables are built once here instead of on every transform. rdft(frame_size)
+    // needs nw = nc = frame_size/4, which also covers dfct(frame_size/2).
+    for (int i = 0; i < channels; i++) {
+        makewt(frame_size >> 2, ip[i], w[i]);
+        makect(frame_size >> 2, ip[i], w[i] + (frame_size >> 2));
+    }
 }
 
 inline Ooura_FFT::~Ooura_FFT() {
@@ -374,7 +384,6 @@ inline void Ooura_FFT::FFT(double **data) {
     for (j = 0; j < channels; j++) {
         double *t;
         t = data[j];
-        ip[j][0] = 0;
         for (int i = 0; i < frame_size; i++)
             a[j][i] = t[i];
 
@@ -396,7 +405,6 @@ void Ooura_FFT::FFT(double ** data, int target_channels){
     for (j = 0; j < target_channels; j++) {
         double *t;
         t = data[j];
-        ip[j][0] = 0;
         for (int i = 0; i < frame_size; i++)
             a[j][i] = t[i];
 
@@ -420,7 +428,6 @@ inline void Ooura_FFT::FFT(double *data) {
     for (j = 0; j < channels; j++) {
         double *t;
         t = &data[j*(frame_size+2)];
-        ip[j][0] = 0;
         for (int i = 0; i < frame_size; i++)
             a[j][i] = t[i];
 
@@ -438,7 +445,6 @@ inline void Ooura_FFT::FFT(double *data) {
 */
 
 inline void Ooura_FFT::FFT(double *data) {
-    ip[0][0] = 0;
     for (int i = 0; i < frame_size; i++)
         a[0][i] = data[i];
 
@@ -460,7 +466,6 @@ inline void Ooura_FFT::iFFT(double **data) {
     for (j = 0; j < channels; j++) {
         double *t;
         t = data[j];
-        ip[j][0] = 0;
         for (int i = 0; i < frame_size; i += 2) {
             a[j][i] = t[i];
             a[j][i + 1] = -t[i + 1];
@@ -482,7 +487,6 @@ inline void Ooura_FFT::iFFT(double **data) {
 inline void Ooura_FFT::iFFT(double *data) {
       double *t;
       t = &data[0*(frame_size+2)];
-      ip[0][0] = 0;
       for (int i = 0; i < frame_size; i += 2) {
           a[0][i] = t[i];
           a[0][i + 1] = -t[i + 1];
@@ -503,7 +507,6 @@ inline void Ooura_FFT::iFFT(double *data) {
 inline void Ooura_FFT::SingleFFT(double *data) {
     int i;
 
-    ip[0][0] = 0;
     for (i = 0; i < frame_size; i++)
         a[0][i] = data[i];
 
@@ -519,7 +522,6 @@ inline void Ooura_FFT::SingleFFT(double *data) {
 }
 inline void Ooura_FFT::SingleiFFT(double *data) {
     int i;
-    ip[0][0] = 0;
     for (i = 0; i < frame_size; i += 2) {
         a[0][i] = data[i];
         a[0][i + 1] = -data[i + 1];
@@ -536,6 +538,10 @@ inline void Ooura_FFT::SingleiFFT(double *data) {
         data[i] = a[0][i];
     }
 }
+inline void Ooura_FFT::DFCT(double *data) {
+    // a[0] is free between transforms and only frame_size/4 + 1 of it is needed
+    dfct(frame_size >> 1, data, a[0], ip[0], w[0]);
+}
 inline void cdft(int n, int isgn, double *a, int *ip, double *w) {
 
     if (n > (ip[0] << 2)) {
@@ -15,6 +15,7 @@
 #include "Ooura_FFT.h"
 #include "HannWindow.h"
 #include "PostProcessor.h"
+#include "SampleConverter.h"
 
 class STFT{
   private : 
@@ -69,6 +70,18 @@ class STFT{
     inline void istft(double* in, short* out);
     inline void istft(double* in, double* out);
 
+    /* Single-Channel STFT/ISTFT in any I/O precision (short, float, double).
+      Samples are converted straight into / out of the internal buffers,
+      so no intermediate double copy of the hop is needed.  */
+    template <typename SampleType>
+    inline void stft(const SampleType* in, double* out);
+    template <typename SampleType>
+    inline void istft(double* in, SampleType* out);
+
+    /* Cosine transform of a half spectrum (frame_size/2 + 1 real values, in place),
+      e.g. for cepstra. Shares the FFT's cos/sin tables.  */
+    inline void dfct(double* data);
+
     //for separated 3-channels wav
     inline void stft(short* in_1, short* in_2, short* in_3, int length, double** out);
 };
@@ -307,6 +320,47 @@ void STFT::istft(double* in, double* out) {
     out[i] = ap->Get_buf()[0][i];
 }
 
+template <typename SampleType>
+void STFT::stft(const SampleType* in, double* out) {
+    /*** Shfit & Convert ***/
+    memmove(buf[0], buf[0] + shift_size, sizeof(double) * ol);
+    SampleConverter<SampleType>::ToDouble(in, buf[0] + ol, shift_size);
+
+    memcpy(out, buf[0], sizeof(double) * frame_size);
+
+    // scaling for precision
+    if(opt_scale)
+      for (int j = 0; j < frame_size; j++)
+        out[j] /= MATLAB_scale;
+
+    /*** Window ***/
+    hw->Process(out);
+
+    /*** FFT ***/
+    fft->FFT(out);
+}
+
+template <typename SampleType>
+void STFT::istft(double* in, SampleType* out) {
+  /*** iFFT ***/
+  fft->iFFT(in);
+
+  /*** Window ***/
+  hw->Process(in);
+
+  if(opt_scale)
+    for (int j = 0; j < frame_size; j++)
+      in[j] *= MATLAB_scale;
+
+  /*** Output ***/
+  ap->Overlap(in);
+  SampleConverter<SampleType>::FromDouble(ap->Get_buf()[0], out, shift_size);
+}
+
+void STFT::dfct(double* data) {
+  fft->DFCT(data);
+}
+
 void STFT::istft(double**in,double**out){
   /*** iFFT ***/
   fft->iFFT(in);
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    SampleConverter.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#ifndef _H_SAMPLE_CONVERTER_
+#define _H_SAMPLE_CONVERTER_
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SAMPLE_CONVERTER_SSE2 1
+#include <emmintrin.h>
+#else
+#define SAMPLE_CONVERTER_SSE2 0
+#endif
+
+/* Converts I/O samples to and from the double precision the STFT works in.
+
+   Values are not rescaled, so short samples stay in [-32768, 32767] inside the STFT
+   (same as the existing short* overloads), and conversion back to short rounds to
+   nearest and saturates instead of wrapping.
+*/
+template <typename SampleType>
+struct SampleConverter;
+
+template <>
+struct SampleConverter<double> {
+  static void ToDouble(const double* in, double* out, int length) {
+    if (in != out)
+      memcpy(out, in, sizeof(double) * length);
+  }
+  static void FromDouble(const double* in, double* out, int length) {
+    if (in != out)
+      memcpy(out, in, sizeof(double) * length);
+  }
+};
+
+template <>
+struct SampleConverter<float> {
+  static void ToDouble(const float* in, double* out, int length) {
+    int i = 0;
+#if SAMPLE_CONVERTER_SSE2
+    for (; i + 4 <= length; i += 4) {
+      const __m128 x = _mm_loadu_ps(in + i);
+      _mm_storeu_pd(out + i, _mm_cvtps_pd(x));
+      _mm_storeu_pd(out + i + 2, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    }
+#endif
+    for (; i < length; i++)
+      out[i] = static_cast<double>(in[i]);
+  }
+  static void FromDouble(const double* in, float* out, int length) {
+    int i = 0;
+#if SAMPLE_CONVERTER_SSE2
+    for (; i + 4 <= length; i += 4) {
+      const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(in + i));
+      const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(in + i + 2));
+      _mm_storeu_ps(out + i, _mm_movelh_ps(lo, hi));
+    }
+#endif
+    for (; i < length; i++)
+      out[i] = static_cast<float>(in[i]);
+  }
+};
+
+template <>
+struct SampleConverter<short> {
+  static void ToDouble(const short* in, double* out, int length) {
+    int i = 0;
+#if SAMPLE_CONVERTER_SSE2
+    for (; i + 8 <= length; i += 8) {
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+      // sign extend 16 -> 32 bit
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+      _mm_storeu_pd(out + i, _mm_cvtepi32_pd(lo));
+      _mm_storeu_pd(out + i + 2, _mm_cvtepi32_pd(_mm_srli_si128(lo, 8)));
+      _mm_storeu_pd(out + i + 4, _mm_cvtepi32_pd(hi));
+      _mm_storeu_pd(out + i + 6, _mm_cvtepi32_pd(_mm_srli_si128(hi, 8)));
+    }
+#endif
+    for (; i < length; i++)
+      out[i] = static_cast<double>(in[i]);
+  }
+  static void FromDouble(const double* in, short* out, int length) {
+    int i = 0;
+#if SAMPLE_CONVERTER_SSE2
+    const __m128d max = _mm_set1_pd(32767.0);
+    const __m128d min = _mm_set1_pd(-32768.0);
+    for (; i + 8 <= length; i += 8) {
+      // clamp first so cvtpd_epi32 never sees out of range values
+      const __m128i a = _mm_cvtpd_epi32(_mm_max_pd(min, _mm_min_pd(max, _mm_loadu_pd(in + i))));
+      const __m128i b = _mm_cvtpd_epi32(_mm_max_pd(min, _mm_min_pd(max, _mm_loadu_pd(in + i + 2))));
+      const __m128i c = _mm_cvtpd_epi32(_mm_max_pd(min, _mm_min_pd(max, _mm_loadu_pd(in + i + 4))));
+      const __m128i d = _mm_cvtpd_epi32(_mm_max_pd(min, _mm_min_pd(max, _mm_loadu_pd(in + i + 6))));
+      const __m128i lo = _mm_unpacklo_epi64(a, b);
+      const __m128i hi = _mm_unpacklo_epi64(c, d);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    for (; i < length; i++) {
+      double x = in[i];
+      x = x > 32767.0 ? 32767.0 : (x < -32768.0 ? -32768.0 : x);
+      out[i] = static_cast<short>(std::lrint(x));
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,6279 @@
+/*
+  ==============================================================================
+
+    WaveTable.cpp
+    Written by CarrierAssetTool, edit the tool's command line rather than this file.
+
+  ==============================================================================
+*/
+
+#include "WaveTable.h"
+
+namespace WaveTable
+{
+    // CarrierCodec streams; only this file pays to compile them
+    namespace
+    {
+        const uint8_t tableSaw[] = {
+0,1,119,0,55,52,150,189,86,0,0,0,0,0,22,24,167,34,198,106,154,181,109,98,200,46,194,229,175,206,214,54,198,255,206,75,255,61,175,44,
+112,249,230,193,194,255,142,213,184,232,48,111,162,192,110,9,246,187,83,57,40,42,101,159,117,80,78,186,147,101,169,58,209,230,150,56,134,71,236,19,
+162,150,10,112,181,13,216,27,138,155,229,141,171,183,144,91,143,146,171,109,148,155,80,150,75,55,151,203,33,153,11,14,154,42,253,155,42,238,156,26,
+223,156,234,212,157,154,201,158,58,191,158,218,182,159,90,175,159,218,166,160,90,159,159,122,106,130,207,225,153,255,255,253,139,191,255,249,193,127,248,69,
+148,127,188,71,244,195,251,47,125,10,246,56,208,148,94,142,70,99,43,41,139,188,113,180,3,152,182,141,178,222,207,22,61,89,79,194,171,21,55,88,
+192,21,133,45,154,157,149,181,62,42,92,151,164,246,200,154,99,98,229,39,16,212,142,248,37,69,116,11,225,210,19,112,133,15,152,21,138,123,237,140,
+219,201,142,235,170,144,203,141,146,139,115,148,11,91,149,139,69,150,203,50,151,235,33,152,251,14,152,106,202,157,167,251,14,127,255,255,229,173,255,243,
+24,255,251,235,249,49,64,43,229,219,241,116,252,55,124,70,60,156,113,58,205,205,6,160,250,152,35,3,34,82,146,169,58,91,90,109,104,174,62,186,
+215,21,89,203,91,169,53,140,82,82,179,39,241,79,147,90,162,233,95,79,28,139,166,114,52,146,181,18,105,29,133,132,114,193,18,44,96,59,16,80,
+121,133,104,102,193,108,70,224,38,44,47,154,52,111,30,59,238,170,66,238,66,72,237,226,78,237,134,84,173,30,81,107,207,24,239,254,251,159,255,255,
+253,71,63,61,47,255,159,15,244,192,224,131,134,63,14,111,139,159,136,55,189,191,33,46,206,248,33,106,26,246,149,137,20,72,14,153,250,51,178,24,
+252,192,196,29,98,194,14,82,11,14,201,46,136,228,156,68,106,75,225,249,35,112,202,143,232,69,70,228,17,34,226,0,113,41,4,216,112,132,156,38,
+67,102,10,226,55,1,81,91,125,113,151,121,209,207,118,114,5,115,18,55,112,50,101,109,82,145,106,178,185,104,82,223,101,18,179,85,252,110,63,255,
+168,55,255,255,255,29,3,227,255,218,39,253,252,191,34,185,136,10,151,4,93,147,188,167,248,192,120,171,235,73,208,174,254,155,58,202,11,22,245,250,
+171,57,55,73,60,15,224,2,71,44,162,116,234,54,149,168,130,172,103,78,188,102,130,198,165,254,204,229,178,208,101,138,209,229,130,209,229,138,208,229,
+158,207,37,194,204,165,234,202,38,22,199,102,66,196,166,110,193,166,158,190,230,202,188,38,242,185,167,30,182,231,70,180,167,106,175,102,222,123,61,68,
+63,255,249,180,127,255,255,186,103,234,143,250,52,255,147,87,248,3,248,207,109,170,75,40,153,167,189,255,57,186,229,153,207,39,24,46,48,54,174,217,
+174,113,25,172,194,115,9,214,22,178,105,254,81,156,146,37,194,29,81,167,2,248,86,136,91,243,141,235,164,146,91,101,149,203,52,152,139,12,154,202,
+237,156,138,211,157,250,191,159,26,174,160,26,160,160,218,149,161,122,140,161,250,133,162,90,127,162,186,122,163,10,117,163,74,113,163,138,110,162,154,60,
+138,15,209,219,255,255,247,222,255,255,245,202,255,228,67,68,95,176,215,247,29,250,181,124,71,242,20,188,233,127,132,213,181,97,165,161,173,2,181,217,
+164,118,178,51,184,209,126,73,217,108,194,251,20,119,52,190,90,228,89,205,33,170,142,109,212,65,39,169,175,141,68,166,195,202,62,96,177,22,80,45,
+135,56,81,193,228,65,224,54,44,47,142,53,238,250,62,238,118,70,110,2,77,45,154,83,173,58,89,44,230,94,44,154,98,172,86,102,172,26,106,107,
+218,103,234,214,82,31,225,5,255,255,255,105,239,255,222,235,255,235,203,200,147,0,239,193,7,231,173,248,108,247,100,239,95,94,43,238,132,18,131,191,
+248,188,83,85,62,46,142,210,216,32,184,150,11,173,209,128,11,52,93,149,110,45,90,159,149,237,67,234,153,156,53,31,203,106,123,100,117,52,17,168,
+149,168,145,72,212,42,35,126,6,209,85,2,216,121,132,92,38,195,126,9,34,90,255,226,230,247,163,106,239,163,222,232,164,78,226,36,178,219,229,14,
+214,165,98,208,165,54,188,175,229,255,196,235,255,255,255,158,23,248,200,127,253,163,255,121,172,46,247,145,235,153,244,77,242,24,247,101,225,125,209,206,
+186,25,47,167,116,176,197,197,96,214,220,132,224,222,1,82,19,20,169,126,143,116,218,72,186,112,228,97,55,18,8,153,216,227,75,204,94,165,66,36,
+82,71,12,168,247,131,148,101,192,106,40,32,115,14,240,137,133,24,105,193,100,70,224,38,43,175,170,51,111,46,58,174,194,65,110,86,71,173,250,77,
+109,158,82,237,74,87,236,230,83,43,43,119,175,255,214,219,255,255,255,159,228,85,191,250,143,255,182,7,211,45,33,157,123,168,223,28,15,76,62,81,
+30,47,58,137,115,21,180,6,151,240,162,187,185,252,77,148,28,160,190,68,44,98,126,169,78,168,39,42,195,229,190,214,164,206,226,36,62,233,35,242,
+236,35,214,236,227,218,235,163,246,233,100,38,230,36,90,226,100,154,222,100,222,218,37,30,214,37,98,210,37,158,206,37,222,202,102,26,198,166,82,195,
+38,138,191,230,186,188,230,238,183,102,106,138,60,125,191,255,244,16,255,255,255,169,199,200,207,250,197,255,169,247,245,247,233,233,138,27,229,196,91,135,
+14,95,221,104,116,58,233,43,142,103,22,59,29,107,111,42,76,147,221,226,236,169,165,80,50,176,152,232,128,70,116,20,224,226,43,175,10,69,109,162,
+89,44,142,104,107,182,116,43,18,125,42,150,132,42,50,137,105,234,141,41,182,144,41,138,146,105,110,148,41,86,149,41,70,150,41,58,150,233,46,151,
+41,46,151,105,42,151,169,38,151,169,38,147,168,110,63,255,4,239,255,255,197,75,255,255,238,117,255,148,206,197,191,161,119,248,91,252,238,189,96,107,
+41,46,183,121,74,76,149,103,129,180,205,124,183,81,173,22,202,52,50,210,126,75,217,94,194,3,14,246,196,186,90,158,87,116,250,41,70,88,211,151,
+29,9,90,136,4,125,65,58,42,96,139,12,144,197,130,152,152,191,120,199,188,184,240,186,89,19,184,73,50,182,137,77,180,233,100,179,137,122,178,57,
+142,177,25,158,176,25,174,175,57,187,174,89,201,173,137,189,169,200,193,127,51,15,255,255,248,234,127,255,159,7,255,203,71,21,237,250,63,79,191,171,
+183,224,47,212,51,163,76,138,168,18,102,163,19,51,20,86,187,11,154,98,111,4,12,107,96,145,139,11,224,97,102,223,23,217,97,75,121,169,133,132,
+209,90,167,231,17,71,146,204,158,57,17,76,148,98,165,38,31,210,15,8,8,204,128,132,75,65,86,25,161,99,7,49,7,129,24,168,190,232,203,188,
+200,234,186,233,8,185,41,34,183,153,58,182,41,80,180,217,101,179,105,90,174,187,59,127,229,161,255,255,255,198,147,254,230,31,255,129,79,227,45,14,
+126,197,62,70,31,104,31,39,239,103,29,182,184,252,204,10,237,35,228,251,40,122,91,240,45,3,73,69,143,228,246,203,170,143,38,149,74,115,80,164,
+121,144,81,52,180,167,234,78,19,141,32,137,146,140,228,173,196,202,73,225,149,30,144,102,140,72,5,68,188,19,97,178,20,48,137,14,216,31,137,155,
+254,139,171,221,141,155,192,143,107,164,172,17,9,197,68,166,110,113,64,154,236,85,102,135,20,73,111,218,209,251,161,191,254,212,41,182,63,22,255,146,
+83,54,40,143,90,145,134,78,203,44,203,53,127,97,15,144,18,153,22,85,69,110,104,6,164,135,33,39,161,167,50,201,4,72,170,91,177,124,155,92,
+66,103,143,12,25,255,66,98,131,112,132,161,60,32,40,77,8,90,14,194,70,129,208,162,159,220,45,231,205,12,201,232,67,138,119,112,248,157,36,67,
+167,29,18,73,188,196,226,108,209,75,154,148,87,166,131,22,249,152,69,254,100,17,143,152,140,103,165,243,24,41,45,231,22,255,101,55,255,196,125,115,
+175,152,223,206,77,214,19,61,146,219,218,110,218,139,29,101,152,189,102,83,43,60,97,168,163,101,172,210,85,165,186,15,211,9,55,204,107,139,141,9,
+226,107,64,210,131,176,213,156,140,83,230,79,26,185,108,71,190,83,178,34,147,140,145,228,165,38,41,29,201,214,69,114,130,145,4,162,228,53,40,249,
+11,74,78,66,146,147,144,164,164,228,43,41,41,11,74,66,67,50,141,144,220,162,228,61,40,121,17,74,18,68,178,115,143,204,85,57,26,191,245,63,
+127,243,239,122,134,240,8,244,201,120,91,244,161,97,77,69,161,131,87,230,136,169,102,92,205,69,107,224,168,109,114,228,215,44,86,146,45,67,145,44,
+160,2,5,115,14,58,84,143,141,23,24,226,244,195,236,172,144,130,39,172,7,9,49,3,122,38,65,246,129,112,184,158,180,58,103,81,17,73,192,196,
+222,108,49,85,154,36,92,38,89,24,105,139,198,106,96,145,172,151,156,110,229,205,28,137,108,199,82,89,177,224,150,28,122,101,115,29,217,64,65,21,
+204,81,255,228,130,255,123,215,230,157,65,69,239,93,33,59,147,183,76,212,45,69,105,137,144,22,111,208,245,57,36,226,16,222,164,226,46,180,214,69,
+174,147,168,137,80,181,9,57,211,32,19,49,195,192,202,96,224,82,30,52,108,107,140,73,20,194,227,67,200,174,80,164,41,68,23,137,205,1,242,85,
+192,98,142,176,74,162,52,29,232,57,9,249,251,67,14,122,112,229,157,156,64,231,45,17,233,190,196,222,108,145,78,154,124,88,166,121,23,89,147,197,
+174,91,242,141,123,41,191,254,108,175,178,83,248,40,245,101,3,175,35,126,95,238,0,92,70,217,56,100,116,156,92,252,76,57,9,105,54,206,26,4,
+21,75,137,161,145,163,206,107,249,25,155,158,71,198,221,145,41,173,227,234,104,24,221,25,14,47,102,3,137,209,112,161,244,88,56,94,149,34,16,101,
+16,130,105,54,224,52,74,184,10,81,246,8,20,82,131,77,10,225,29,64,136,88,207,154,26,51,199,135,116,234,226,21,57,24,145,205,226,39,83,98,
+138,140,210,34,133,46,186,223,191,59,215,255,219,81,146,35,243,215,248,89,176,21,164,126,47,140,179,55,139,103,85,171,131,0,252,79,147,208,169,234,
+6,82,16,43,164,17,102,253,30,137,17,204,14,39,179,189,133,69,12,224,157,71,104,14,82,102,0,212,165,128,29,40,96,25,73,56,15,81,250,6,
+212,100,130,141,18,96,217,66,216,68,80,70,20,179,244,134,12,246,97,185,59,232,123,78,150,33,211,141,137,52,221,226,117,54,56,167,205,58,44,83,
+60,139,164,202,227,11,49,56,182,74,31,35,135,249,78,191,254,101,136,136,253,202,126,129,78,116,88,124,138,223,20,124,62,151,208,207,117,130,86,91,
+11,53,97,20,159,181,135,17,166,159,193,237,36,116,98,152,110,147,222,5,148,16,135,164,216,227,19,46,72,250,202,30,72,178,68,147,236,133,101,73,
+31,73,95,199,126,90,17,209,150,212,114,229,189,28,137,112,71,34,91,209,203,150,212,115,229,173,29,73,104,71,106,89,113,224,150,36,121,229,123,30,
+217,117,204,26,85,49,178,145,172,121,100,131,51,10,243,191,210,77,255,245,120,101,227,225,51,237,190,240,95,227,116,177,188,151,136,135,19,217,236,198,
+52,242,148,207,76,78,200,137,243,86,229,31,137,196,28,106,16,68,125,145,116,136,103,91,2,234,36,66,120,151,16,18,39,12,61,232,161,27,25,169,
+73,74,85,179,39,147,188,238,36,63,57,72,206,200,230,51,33,34,159,92,184,230,7,51,217,137,202,86,98,210,111,152,236,171,229,193,41,41,30,72,
+106,58,50,0,144,204,150,38,101,173,163,255,122,199,255,92,71,204,26,63,220,114,156,239,185,77,49,162,179,97,213,225,116,76,8,127,28,166,102,41,
+25,211,217,47,250,133,34,155,50,19,69,64,96,112,146,176,131,237,33,35,148,91,185,55,26,38,48,166,108,128,89,82,98,221,62,137,144,204,34,156,
+18,130,175,156,126,44,61,18,136,159,45,156,14,204,138,99,31,92,121,145,214,46,50,86,8,135,125,104,34,101,68,24,176,74,190,44,113,234,141,156,
+130,36,63,36,207,24,7,255,192,145,254,152,143,222,219,153,40,12,216,37,105,46,185,29,92,77,199,13,89,167,201,250,140,17,38,181,36,66,15,13,
+32,243,75,196,176,146,80,221,142,228,185,33,240,72,41,105,23,174,94,70,202,141,105,161,224,79,86,201,38,209,146,153,211,221,184,228,227,48,125,154,
+174,28,16,184,213,85,225,192,131,86,250,48,122,75,50,65,56,247,194,13,47,89,25,164,17,32,99,145,68,64,130,240,8,146,92,69,163,51,29,104,
+40,190,21,79,255,204,245,233,216,253,180,62,24,11,234,75,202,98,136,150,67,240,131,212,203,130,229,230,160,67,109,88,199,208,174,89,49,235,152,68,
+74,228,119,23,152,66,200,174,43,35,48,146,97,29,227,196,85,152,62,21,170,46,21,29,159,53,71,45,101,87,28,70,235,147,148,245,140,178,249,143,
+235,205,73,246,29,112,147,217,218,51,186,213,203,171,77,232,137,173,153,74,149,129,106,112,145,12,232,11,79,20,209,44,195,2,9,18,64,174,147,248,
+196,63,255,108,81,37,62,33,63,48,231,15,235,148,22,158,100,20,52,136,62,33,242,166,81,202,131,106,15,205,153,16,248,213,22,38,3,66,217,132,
+164,70,224,171,4,88,20,1,246,5,1,133,131,236,172,163,63,59,121,160,211,110,176,86,80,192,42,249,57,28,226,11,158,38,64,217,198,227,64,254,
+220,15,166,91,227,253,92,44,142,114,165,195,155,39,121,162,235,29,46,5,129,170,140,148,189,11,11,87,23,32,159,68,246,64,35,118,218,137,255,41,
+199,255,225,46,234,191,202,123,201,241,197,107,50,68,169,96,202,122,216,68,167,41,66,37,203,109,44,186,77,157,20,21,162,185,227,99,132,50,168,33,
+65,108,47,114,128,17,220,191,69,161,32,113,161,192,148,122,18,68,166,181,69,44,239,128,6,12,185,75,100,135,164,182,123,186,231,99,219,221,153,255,
+178,163,144,67,242,46,157,219,88,137,134,114,218,148,238,144,182,78,160,142,24,17,12,58,220,125,135,35,5,16,85,8,46,130,100,52,241,193,127,242,
+241,127,247,9,126,115,181,52,77,145,149,190,33,73,138,193,97,0,56,71,229,193,44,165,150,235,182,183,181,147,212,26,163,89,210,163,42,33,88,145,
+73,92,104,85,43,37,85,126,138,161,76,2,169,199,196,168,209,202,173,5,121,237,11,142,189,247,53,33,197,247,118,188,203,56,42,214,139,241,55,127,
+247,23,24,23,231,85,101,7,65,105,176,57,139,87,249,176,60,196,212,191,135,197,73,228,131,22,184,108,195,70,55,161,230,160,96,163,190,180,207,255,
+137,243,252,156,31,206,71,184,121,11,48,247,153,9,244,101,133,79,170,53,218,66,58,248,205,197,153,45,233,110,162,29,32,242,147,64,104,15,146,58,
+156,249,16,236,144,90,27,122,152,30,177,81,75,167,31,50,192,73,150,175,86,240,176,198,101,87,34,217,231,12,238,20,89,61,113,1,135,19,249,136,
+191,246,66,117,172,243,4,128,43,142,244,239,29,39,49,192,114,145,196,129,146,245,51,81,145,140,0,228,96,162,12,88,101,0,246,55,98,103,126,74,
+143,255,202,157,220,129,250,115,251,139,174,225,3,81,209,203,114,234,112,5,199,206,12,24,60,202,242,166,212,174,145,253,42,98,93,41,152,170,65,164,
+73,19,62,27,69,67,8,185,87,162,88,206,204,145,144,147,37,252,221,106,39,122,154,253,103,39,117,13,168,113,62,224,169,152,143,2,252,103,159,243,
+244,127,146,115,237,185,137,94,124,92,60,101,67,222,6,225,174,29,184,201,179,54,179,50,82,178,126,27,172,15,225,234,25,185,91,134,167,37,151,248,
+18,191,255,61,146,53,252,205,189,43,89,250,86,217,8,72,124,38,71,63,101,185,42,132,179,148,232,19,4,135,217,189,161,189,55,248,144,198,74,9,
+112,183,136,8,41,35,206,17,8,252,7,118,32,34,121,138,244,227,40,141,81,107,199,90,235,44,220,61,245,132,202,231,115,45,50,53,162,234,82,255,
+225,238,246,163,126,139,20,75,112,180,165,174,186,90,127,196,255,143,45,40,151,59,161,98,14,81,35,13,28,117,102,190,63,154,231,18,19,164,27,254,
+229,47,255,141,211,197,83,79,174,71,44,105,107,212,141,148,109,212,19,166,59,8,59,232,49,86,183,146,192,83,249,68,174,32,4,22,138,4,19,36,
+147,35,193,37,76,152,60,242,191,14,172,84,195,155,14,89,105,76,150,145,149,246,181,238,17,184,164,230,119,156,206,157,58,213,109,9,140,79,208,97,
+255,218,152,242,79,178,110,54,239,22,203,6,56,160,196,35,64,60,4,37,235,133,164,7,105,175,18,152,56,12,198,154,197,18,186,137,78,190,5,143,
+254,187,143,252,243,159,144,213,210,72,224,148,76,99,13,139,19,204,78,163,156,173,181,108,151,250,177,154,171,211,180,65,222,19,2,249,148,84,116,73,
+3,82,242,181,217,184,160,117,127,34,220,213,199,91,3,249,185,79,54,133,23,141,171,126,94,119,91,213,143,27,205,190,180,21,222,210,121,31,214,97,
+255,201,81,172,175,188,13,134,222,89,153,140,188,33,48,5,106,107,15,100,139,101,15,66,168,237,74,62,41,131,13,162,65,4,236,152,38,127,211,9,
+255,241,129,126,158,47,209,23,162,217,230,164,43,77,136,168,91,214,105,212,64,189,132,22,242,211,142,138,59,80,239,47,188,78,98,119,59,137,190,22,
+110,208,166,165,190,17,140,108,168,79,89,186,144,2,19,243,57,167,188,221,241,17,163,206,144,246,55,219,31,13,222,1,89,189,111,217,63,247,251,207,
+191,229,162,249,194,233,37,81,95,65,172,35,30,22,89,148,56,168,215,193,100,168,132,152,206,27,17,215,128,52,57,163,92,15,105,147,16,165,252,139,
+31,255,105,134,85,79,141,31,123,229,150,167,238,146,44,248,213,11,154,194,111,240,144,189,77,4,104,9,83,249,63,205,198,89,16,51,156,220,211,137,
+123,90,114,157,217,236,158,21,36,30,212,134,6,59,23,185,107,87,146,101,88,233,81,247,79,11,68,238,17,138,102,255,217,247,238,33,182,43,255,114,
+87,227,36,253,142,233,122,208,167,116,72,87,120,219,94,153,185,133,112,86,47,137,161,98,227,209,7,97,132,203,32,67,147,26,5,118,181,15,248,35,
+191,254,60,234,57,119,23,228,56,180,13,90,212,67,178,27,10,75,229,49,1,169,50,170,145,137,66,202,46,116,229,145,36,177,33,227,28,136,99,134,
+118,77,225,171,152,112,114,228,232,28,88,33,7,66,76,146,217,174,132,253,241,58,175,126,130,152,39,236,7,151,206,222,122,158,105,121,234,40,255,240,
+154,100,250,253,26,119,48,120,217,194,203,88,13,137,161,131,193,206,48,41,86,68,110,95,52,24,152,217,121,44,208,90,235,89,140,203,210,209,255,222,
+61,255,32,151,183,126,197,170,88,210,36,147,248,51,76,133,69,56,15,90,138,241,16,188,81,30,130,137,181,76,168,224,176,246,18,20,55,98,26,18,
+169,40,131,154,56,128,106,129,96,64,163,35,44,9,238,84,14,203,183,247,196,99,43,172,237,116,226,215,75,99,29,185,239,206,255,211,17,254,7,15,
+228,99,64,190,4,184,2,113,121,176,94,45,217,109,70,91,23,24,181,201,46,161,116,255,61,230,27,135,57,186,112,28,95,170,115,255,239,110,165,11,
+151,119,132,35,151,183,4,37,157,97,154,99,9,121,225,219,26,53,138,235,254,189,205,123,19,12,139,192,247,37,229,37,66,198,87,52,167,21,129,24,
+244,191,65,107,13,8,66,17,186,9,86,231,152,30,24,151,4,200,171,48,236,221,182,91,209,235,130,214,43,30,255,239,255,39,51,7,62,172,119,122,
+121,75,228,202,240,40,176,243,42,184,206,224,243,41,154,201,198,192,207,85,210,48,69,148,198,167,48,197,73,95,248,173,63,253,55,223,9,43,47,35,
+78,206,131,60,37,45,225,20,109,121,18,226,89,20,117,27,164,246,147,100,1,201,9,72,153,26,159,242,216,232,21,92,136,158,211,237,4,188,22,101,
+44,70,169,165,157,38,34,168,19,206,187,4,204,63,176,133,214,75,27,94,14,185,188,241,83,128,27,252,123,159,248,189,190,136,153,121,216,131,218,79,
+24,247,98,170,25,174,135,64,42,63,215,34,19,18,129,134,4,66,128,169,24,144,182,0,237,224,246,255,248,57,191,162,75,248,56,250,15,163,117,43,
+9,72,197,83,13,72,145,34,219,34,234,228,213,82,129,83,251,170,196,14,142,151,63,243,195,84,244,156,115,35,5,172,19,38,0,62,250,94,23,218,
+94,70,114,138,141,141,109,137,96,156,232,238,93,185,46,48,28,25,244,235,221,71,134,251,255,195,13,230,186,254,229,28,81,28,211,52,153,180,70,206,
+248,126,74,103,103,170,212,43,3,105,243,168,208,116,45,209,253,12,144,88,11,150,253,119,31,255,83,4,12,158,60,253,201,149,252,174,114,127,87,183,
+97,61,115,245,143,163,46,134,4,189,233,217,65,89,234,200,142,118,176,22,149,28,31,192,251,6,217,1,7,146,102,163,57,148,168,230,160,169,58,218,
+64,81,11,11,90,200,232,59,131,158,191,249,223,237,137,186,182,64,63,156,83,255,228,34,202,179,248,39,114,181,121,21,72,219,139,180,184,57,56,215,
+137,158,78,52,10,243,217,196,145,113,216,22,16,68,236,224,24,190,131,175,249,64,191,245,50,115,143,139,48,54,67,221,7,4,75,171,192,177,188,245,
+146,32,151,116,241,48,15,130,226,42,177,84,54,188,28,70,167,6,104,74,193,94,23,64,34,6,8,14,128,9,8,216,171,73,70,96,116,241,169,213,
+247,111,247,148,62,93,122,90,235,83,177,62,253,80,131,127,199,197,255,152,179,247,4,225,93,59,62,118,217,54,103,129,102,29,125,227,188,168,140,221,
+11,103,0,129,149,14,191,18,82,105,228,200,13,175,176,91,255,134,3,207,65,205,219,155,235,1,156,216,144,194,135,60,131,107,49,67,169,35,228,23,
+40,149,91,232,162,157,204,149,13,45,13,72,144,76,142,87,131,204,160,224,183,38,26,21,216,79,130,70,74,17,24,169,204,198,239,121,101,124,117,242,
+1,206,235,85,45,85,247,141,209,235,156,59,255,189,131,188,19,248,120,83,45,208,82,66,238,111,242,172,98,163,49,171,110,206,66,106,177,157,31,221,
+228,201,3,145,208,151,48,95,60,139,247,222,127,232,144,164,164,128,53,114,92,187,76,20,153,229,32,93,40,164,95,94,21,137,210,202,213,62,152,174,
+31,70,67,50,9,169,252,181,204,229,81,50,134,208,224,68,17,134,4,32,112,227,96,76,248,90,27,218,81,88,31,92,103,20,92,239,50,134,221,127,
+66,46,31,117,126,254,62,47,254,140,14,56,190,123,16,136,248,120,99,2,240,238,172,111,70,106,48,132,186,236,134,164,61,23,32,90,213,248,23,166,
+195,26,249,76,154,55,63,213,81,252,73,222,32,220,219,64,1,60,154,99,15,26,55,113,255,163,141,19,102,145,112,25,80,89,242,128,211,46,176,164,
+46,141,229,49,226,189,203,252,74,241,71,5,192,62,100,232,49,201,20,18,194,12,245,176,164,213,163,241,120,189,174,188,56,204,240,158,209,167,136,38,
+1,239,252,231,223,194,249,253,23,175,226,221,179,144,36,142,58,178,74,131,27,219,177,64,120,214,115,213,12,189,23,6,122,83,18,187,25,180,213,143,
+9,71,251,149,53,147,110,101,214,80,182,149,5,24,253,5,80,26,159,26,45,80,45,59,100,217,235,171,68,10,204,75,26,181,144,198,165,68,12,4,
+177,1,208,13,129,106,50,96,222,140,16,96,32,23,40,169,96,80,74,203,213,228,201,203,0,205,125,242,248,223,43,108,77,103,253,179,95,255,2,240,
+94,191,141,167,86,247,173,92,229,119,199,192,11,81,248,22,42,229,96,132,34,109,24,15,202,252,145,176,211,166,196,61,50,118,47,143,99,248,64,10,
+98,70,57,149,4,102,172,132,54,175,250,33,52,64,67,198,23,246,70,167,245,11,44,191,55,170,154,205,70,102,242,117,141,100,60,225,65,4,112,24,
+130,24,18,192,28,128,244,79,36,83,46,234,125,86,82,248,248,142,228,221,163,166,174,27,38,241,91,164,255,249,217,63,252,44,159,129,47,168,173,115,
+157,128,170,209,192,162,175,27,27,199,181,64,106,172,147,122,166,2,147,44,161,180,14,254,127,212,116,24,210,62,202,14,236,199,31,207,128,11,231,89,
+1,240,37,3,142,68,8,65,81,134,162,82,160,193,134,52,152,73,200,138,202,82,183,157,180,141,163,141,15,40,55,64,84,16,160,88,5,32,7,1,
+137,6,41,210,198,74,223,116,66,198,155,5,92,246,244,65,217,159,103,94,29,153,172,63,245,88,127,17,71,248,246,197,203,155,62,78,188,176,236,37,
+158,37,243,228,213,92,136,195,131,8,88,134,192,38,250,44,40,16,163,6,156,203,133,211,224,252,152,0,6,86,208,27,206,116,226,255,161,168,118,33,
+99,62,24,232,93,50,48,120,140,72,34,255,51,67,170,228,234,165,255,41,216,192,195,62,16,144,126,2,40,52,0,128,8,192,166,64,102,133,209,193,
+184,197,80,241,53,200,39,47,237,151,117,64,225,9,151,255,206,137,255,223,76,93,95,169,92,78,93,148,99,82,232,9,28,118,16,146,35,175,76,30,
+34,65,85,160,155,36,124,72,4,239,16,92,77,153,84,151,86,7,59,81,79,160,66,151,200,6,113,27,6,236,176,130,7,25,121,166,76,14,198,51,
+108,185,237,21,44,5,82,41,239,82,250,68,242,237,137,92,49,32,123,6,64,93,129,108,29,64,85,131,212,91,230,65,58,186,228,94,110,249,250,66,
+227,101,194,131,68,94,68,144,106,127,159,235,254,88,143,204,238,204,60,169,250,147,201,55,192,86,11,218,194,202,54,131,176,80,1,57,155,133,90,150,
+113,156,147,225,72,157,57,214,17,174,111,44,46,133,254,157,145,174,9,180,71,65,127,130,154,45,100,7,140,229,67,233,43,87,106,203,88,70,148,54,
+71,151,165,77,99,113,47,56,105,195,154,10,192,25,140,112,32,227,152,22,56,28,138,78,83,212,229,171,246,25,23,213,213,143,36,78,22,154,226,112,
+142,231,68,255,240,46,111,162,254,234,252,179,30,192,118,71,215,175,77,124,35,234,131,120,184,215,137,182,140,228,183,51,202,37,232,248,164,200,168,210,
+87,204,239,90,124,166,238,101,228,199,203,16,108,81,16,18,104,75,50,13,39,60,101,43,73,72,42,255,85,162,204,180,126,177,220,194,105,119,31,25,
+49,195,166,16,240,108,0,40,105,0,233,24,112,148,66,38,71,19,203,163,165,193,48,54,199,235,74,125,87,118,254,228,141,93,63,241,245,127,248,51,
+191,36,15,39,74,67,117,125,210,67,105,26,135,108,47,11,211,6,197,116,102,195,221,63,202,32,136,237,168,198,161,130,143,108,133,216,154,40,222,120,
+164,221,11,224,105,145,127,142,112,50,17,9,36,20,165,42,143,89,202,188,217,166,185,53,83,169,213,5,38,57,50,56,73,71,106,26,160,34,136,184,
+30,194,74,15,104,97,142,90,46,213,219,174,46,4,185,36,103,29,171,22,243,27,239,102,195,252,0,223,254,64,143,104,95,67,42,190,189,153,224,3,
+207,18,224,25,137,67,215,7,10,180,134,250,228,102,96,66,225,46,84,251,83,217,88,221,96,150,23,138,108,161,94,160,97,96,79,246,54,177,148,129,
+40,2,163,186,142,125,156,167,233,108,26,225,87,178,185,213,32,160,149,4,36,107,30,88,157,194,72,20,145,184,0,176,69,0,31,2,185,44,70,26,
+198,51,255,198,103,7,124,255,181,81,218,23,129,166,191,30,212,175,255,10,48,17,190,170,80,76,120,239,79,25,211,106,10,250,242,204,70,173,242,170,
+17,182,42,66,174,78,145,16,213,12,212,165,85,197,83,38,8,233,244,38,80,146,41,217,144,42,25,161,23,64,194,1,41,43,203,118,173,179,228,187,
+245,33,174,111,81,218,190,210,18,123,210,112,148,244,19,225,185,6,96,141,128,10,56,96,155,129,184,106,36,185,72,250,87,98,93,114,125,93,243,23,
+222,251,124,78,15,124,178,159,254,152,110,40,143,246,229,206,213,211,22,255,29,123,97,163,202,18,22,167,112,135,144,27,12,80,57,69,22,77,28,181,
+178,88,171,21,42,166,180,98,141,234,15,34,96,142,121,155,10,74,65,208,57,131,144,80,146,206,163,189,61,172,191,80,107,201,81,2,216,211,191,163,
+92,178,36,151,12,200,151,68,192,9,81,111,5,224,6,33,90,34,104,205,208,198,168,119,110,193,99,68,204,162,120,127,234,83,201,147,49,7,255,22,
+231,194,53,254,62,92,34,158,149,120,102,107,247,156,142,116,113,231,198,18,101,193,84,168,65,107,17,58,65,117,99,180,95,88,18,38,216,183,250,143,
+9,253,164,34,143,225,129,78,6,41,129,49,128,244,68,178,36,166,117,48,43,139,97,27,48,212,254,212,211,90,172,108,125,102,13,14,248,104,194,28,
+4,145,240,3,124,100,129,85,16,88,197,209,198,137,119,107,194,83,42,45,7,55,24,214,135,155,92,160,159,237,154,255,137,235,248,83,93,119,197,130,
+253,60,88,245,134,173,86,73,115,131,130,156,115,44,136,65,20,46,209,212,78,29,59,85,182,147,44,96,26,151,66,172,104,247,163,158,115,51,85,139,
+84,116,64,246,130,116,197,232,63,71,75,17,86,246,196,22,35,172,21,43,105,229,34,25,232,192,178,53,144,159,1,104,73,0,132,24,112,162,194,16,
+95,82,210,165,165,209,175,19,152,46,120,218,235,238,169,199,30,179,223,238,68,255,233,234,254,104,124,231,230,237,227,53,151,230,155,152,62,230,103,1,
+3,70,76,108,79,132,175,68,61,9,164,218,20,181,82,189,87,245,141,83,169,87,209,19,196,190,78,70,106,193,253,140,68,6,240,62,30,84,171,106,
+247,84,234,241,89,154,187,117,162,170,109,6,231,21,45,152,125,199,62,32,192,140,139,240,27,129,208,2,216,9,74,178,58,53,209,171,54,12,249,43,
+229,219,181,30,198,60,54,177,249,254,32,239,254,174,79,87,30,201,210,249,249,212,200,77,183,77,94,50,80,151,5,145,169,102,28,76,26,139,88,142,
+66,101,42,6,169,104,178,90,145,42,229,168,124,149,186,89,71,59,58,137,11,198,4,13,64,58,203,30,91,53,128,165,93,161,43,173,98,202,228,84,
+130,143,179,176,148,180,121,33,235,0,208,14,197,248,0,1,130,2,204,9,163,103,42,42,93,212,243,14,106,200,73,104,137,169,238,195,220,110,52,130,
+246,21,127,250,104,135,179,248,194,192,141,210,218,44,62,101,80,253,95,82,58,21,34,141,80,38,112,137,25,18,135,232,85,170,34,163,170,188,106,89,
+44,194,153,42,144,104,186,33,102,110,162,99,12,132,45,128,186,142,108,222,41,41,82,107,9,87,250,196,181,206,170,29,41,39,77,48,232,210,197,146,
+0,176,28,6,224,40,130,90,6,56,72,137,50,60,20,116,173,21,228,241,13,208,51,60,125,248,119,134,224,19,211,153,255,240,68,82,109,254,69,220,
+21,30,21,248,68,114,90,163,15,9,88,99,32,17,23,144,103,149,176,156,201,173,158,13,102,148,195,22,91,83,185,94,52,232,148,244,67,113,32,179,
+31,150,240,99,97,234,5,228,66,231,217,59,202,203,86,82,202,181,193,179,85,47,234,149,56,25,162,71,98,51,144,61,5,92,99,128,64,19,208,15,
+128,140,59,209,60,170,45,3,48,57,194,95,48,141,38,119,2,217,107,141,214,143,79,253,241,94,187,79,229,35,145,211,213,238,152,156,8,180,50,196,
+38,149,247,66,144,184,41,41,38,104,116,21,145,151,84,89,44,213,193,148,104,87,65,72,197,8,145,211,72,220,193,166,179,23,208,142,192,93,17,137,
+221,204,130,197,116,223,180,237,116,172,139,78,106,224,203,162,136,17,107,142,220,10,160,193,23,144,57,201,64,27,240,225,12,220,107,104,161,61,220,53,
+237,51,164,62,102,123,93,238,135,198,254,46,111,249,98,63,228,76,254,216,56,63,115,254,204,55,142,230,112,118,141,203,234,49,242,139,131,73,34,11,
+74,118,68,209,82,66,84,37,89,85,43,22,57,82,5,60,116,207,209,10,59,201,164,6,26,47,208,9,68,250,85,179,222,172,21,46,110,69,84,27,
+63,213,126,164,19,190,161,124,72,101,167,6,208,81,67,192,12,129,168,6,52,114,197,75,8,58,33,81,18,237,87,23,210,39,21,190,22,250,149,242,
+155,164,207,252,252,95,250,181,63,189,22,50,119,133,243,104,189,22,213,248,58,228,125,4,203,130,209,228,30,102,116,59,170,75,40,226,172,214,153,122,
+219,74,113,41,228,162,34,102,232,103,34,0,83,98,100,10,12,7,96,162,148,149,11,168,131,95,91,3,214,162,216,212,251,170,221,25,102,125,40,57,
+12,192,160,39,81,120,1,184,67,0,254,9,112,222,64,146,158,83,12,187,53,227,242,168,202,191,124,141,0,185,229,89,107,247,42,127,244,149,121,68,
+118,62,197,215,213,142,10,46,5,51,129,205,6,92,245,137,162,120,119,177,45,38,82,90,73,20,170,102,155,202,244,41,152,173,200,153,138,119,40,191,
+33,142,86,163,4,5,92,62,193,66,145,156,232,168,195,98,186,122,92,62,177,21,202,171,125,12,39,23,50,152,139,197,210,2,144,205,0,64,97,0,
+212,0,160,22,70,166,107,19,56,188,205,155,114,158,204,251,88,93,140,249,40,102,149,237,182,255,249,93,36,15,252,220,103,4,230,153,92,62,238,16,
+9,225,35,10,170,195,197,144,6,199,236,27,26,145,168,31,43,20,160,178,202,42,18,174,54,145,234,171,168,89,34,144,99,194,200,135,240,86,162,27,
+133,197,18,168,37,90,186,177,220,46,154,247,24,162,85,71,103,37,46,248,201,71,82,25,192,189,139,48,44,1,24,8,192,33,200,10,53,244,234,172,
+37,198,50,107,200,231,90,13,179,119,188,223,3,192,17,255,238,204,49,135,241,113,225,138,245,49,177,71,19,235,135,236,131,2,196,38,100,206,8,242,
+144,22,229,43,3,242,173,48,149,138,213,106,108,43,162,157,58,162,200,50,165,54,90,3,10,11,72,66,1,33,131,213,52,101,185,101,90,148,90,50,
+178,246,189,160,181,138,37,43,61,232,201,198,2,2,160,169,143,192,37,227,232,4,168,0,197,62,66,52,198,162,22,24,216,85,230,51,176,158,184,60,
+47,247,40,240,75,127,249,114,4,105,247,34,202,29,240,99,138,95,58,235,134,106,99,7,212,82,169,30,3,91,69,24,93,55,20,24,23,61,76,125,
+110,5,79,21,148,78,253,71,116,32,81,25,48,89,6,133,252,5,144,157,73,58,130,85,87,166,101,208,170,123,106,90,170,85,110,109,244,140,134,68,
+181,224,204,7,152,137,0,44,66,33,50,138,128,138,36,1,63,74,168,224,95,128,86,140,250,81,236,65,199,67,92,254,98,111,255,24,37,200,159,151,
+188,18,94,43,80,240,113,90,163,190,118,179,91,181,61,22,132,111,131,1,87,82,103,72,13,95,148,191,151,240,80,13,97,213,15,83,120,69,161,18,
+130,176,148,184,80,192,69,2,220,187,167,171,75,90,203,90,78,164,151,76,164,29,107,39,157,60,24,194,203,74,32,161,114,140,112,12,130,100,5,216,
+134,139,114,28,116,207,170,221,202,49,98,206,179,64,173,233,56,46,238,77,210,73,255,242,122,69,29,253,86,237,62,232,149,102,142,248,16,201,224,93,
+28,42,171,198,8,16,24,71,142,29,63,180,92,21,12,81,221,109,100,252,23,13,76,233,62,196,125,16,52,50,97,77,131,246,20,16,95,76,62,94,
+117,89,170,221,127,171,233,106,42,62,217,62,98,244,14,143,204,128,96,110,22,121,18,2,242,53,128,35,129,104,124,34,33,88,74,4,96,49,137,158,
+85,90,159,110,1,186,55,10,206,188,175,255,121,66,111,63,141,255,1,7,165,53,168,57,84,211,243,132,60,77,16,105,145,48,37,140,222,70,213,29,
+79,90,179,146,125,11,30,169,238,180,50,91,234,139,161,238,134,137,174,73,60,41,208,202,133,162,64,179,97,171,125,42,108,253,95,91,5,213,114,185,
+211,11,166,68,87,100,135,4,200,80,69,244,26,178,114,8,116,46,131,53,28,170,86,79,67,16,75,198,231,77,167,246,190,92,12,56,10,239,180,255,
+234,74,223,141,250,227,98,52,248,28,194,143,162,166,15,218,11,69,231,21,202,25,4,230,196,133,182,74,173,2,117,200,146,97,93,113,75,229,125,211,
+194,83,225,6,180,136,75,168,83,49,131,4,200,35,49,104,162,21,25,170,51,106,138,181,217,134,181,117,22,159,253,25,34,111,48,120,27,2,202,27,
+224,6,144,48,88,99,136,40,40,164,80,150,144,248,43,219,159,79,188,196,118,253,224,121,193,143,2,151,255,33,119,218,25,253,214,225,202,237,177,26,
+239,10,234,255,102,37,86,11,21,203,136,83,119,189,37,226,59,200,207,43,90,148,179,3,180,223,214,197,79,217,68,116,83,82,53,41,145,157,4,172,
+23,208,67,199,102,131,243,176,176,173,112,107,121,107,154,150,85,46,145,83,134,145,116,175,161,16,23,88,163,128,200,39,32,110,139,232,191,32,43,79,
+58,30,222,14,248,154,57,228,29,195,11,98,206,63,244,190,127,243,201,126,182,79,249,30,86,249,192,11,52,78,153,180,108,216,210,159,180,63,132,100,
+32,238,148,52,196,193,81,63,82,141,64,101,202,83,117,94,241,47,213,51,81,205,69,216,191,230,177,13,96,167,66,5,28,233,187,208,118,195,180,251,
+181,221,128,42,159,92,250,9,78,114,92,81,203,130,244,83,227,130,8,104,190,0,76,17,1,248,129,109,102,165,225,129,69,241,243,71,204,95,131,78,
+150,28,229,40,42,255,203,249,252,34,95,231,255,152,139,162,238,235,90,151,228,51,172,180,196,172,47,20,200,204,18,16,145,105,144,31,169,86,149,5,
+214,11,83,25,112,164,176,21,206,68,77,28,83,84,152,20,73,3,15,13,196,51,39,135,68,42,185,85,78,222,117,48,178,85,81,104,37,67,121,67,
+198,230,39,16,86,135,216,35,228,62,9,104,83,132,214,39,116,153,150,38,32,54,98,206,251,54,125,188,53,200,230,177,21,84,191,255,247,220,83,15,
+255,255,255,241,0,159,255,251,174,127,34,95,85,66,71,106,155,106,36,240,244,216,232,63,147,145,180,147,8,46,101,4,180,237,236,80,162,236,128,230,
+53,24,148,32,137,104,15,177,24,153,188,153,26,66,132,142,17,172,1,69,252,125,138,205,44,4,236,151,139,176,6,10,240,120,0,160,57,136,129,33,
+209,57,142,195,89,34,194,150,13,168,173,93,53,184,148,72,180,63,15,72,207,255,247,132,253,5,191,255,255,255,196,152,159,255,75,165,53,139,115,9,
+152,70,59,18,73,178,210,159,6,228,94,17,224,120,24,184,230,7,197,236,149,148,217,139,132,31,85,124,124,163,226,81,144,109,15,53,181,7,215,63,
+51,103,79,45,66,217,17,224,205,56,226,85,86,128,151,36,162,210,3,225,112,29,1,15,4,241,100,96,83,22,109,112,165,83,16,177,143,74,220,91,
+29,188,37,235,184,167,255,252,250,63,161,119,255,255,255,248,154,47,255,244,16,192,115,197,23,105,0,103,135,115,59,235,57,0,122,3,42,177,32,45,
+178,214,2,234,77,17,241,164,167,34,174,131,81,174,142,155,48,138,116,116,198,105,212,68,53,60,194,177,161,81,65,112,77,224,92,200,232,31,211,96,
+149,214,128,26,71,32,139,0,32,14,197,136,151,70,252,44,157,108,124,28,52,111,214,44,2,166,115,3,11,172,241,148,255,254,34,95,243,78,255,255,
+255,255,17,127,255,247,188,103,143,134,255,231,129,203,231,32,161,75,179,164,33,244,142,87,184,198,36,113,97,18,194,213,18,201,86,6,194,74,147,34,
+173,142,217,222,147,235,117,137,20,71,196,193,119,194,85,3,200,193,109,213,241,21,208,48,26,204,120,41,86,200,174,213,72,43,67,200,64,129,28,143,
+67,120,232,204,172,14,160,214,35,141,178,72,107,70,59,212,147,222,43,255,196,43,255,244,132,255,255,255,255,16,9,20,12,240,38,234,115,246,250,249,
+117,251,254,88,214,202,195,75,130,36,34,113,250,61,55,32,49,226,146,10,148,204,63,208,166,7,117,149,4,101,37,54,83,213,39,183,1,24,168,6,
+138,194,39,130,209,147,158,162,124,179,241,149,163,96,5,30,112,186,177,209,213,165,64,179,128,152,68,132,154,47,131,82,86,163,104,19,67,236,39,24,
+20,130,216,190,125,31,253,200,191,255,241,204,255,255,255,255,16,103,63,157,79,255,13,207,202,143,207,67,178,239,206,243,173,15,68,198,99,162,81,24,
+224,9,1,155,97,24,202,97,10,32,244,25,249,192,41,248,154,139,123,29,137,90,95,160,89,211,142,203,76,146,99,78,142,161,91,139,209,48,170,194,
+56,185,113,53,163,128,3,160,129,90,177,242,110,156,193,44,137,89,31,133,171,44,128,242,153,171,168,93,68,180,57,149,21,71,63,252,12,63,255,242,
+166,255,255,255,255,16,21,95,191,207,255,225,173,255,202,255,247,100,222,255,164,182,253,126,114,89,79,232,188,78,50,228,51,27,93,63,220,218,140,172,
+163,131,36,71,21,188,139,24,60,166,200,85,141,200,140,246,208,52,196,195,13,113,204,233,60,201,176,81,202,80,119,217,225,7,220,248,129,208,0,44,
+80,9,24,215,121,139,201,48,213,200,124,250,66,21,251,64,73,65,88,172,135,33,66,235,31,248,147,127,255,225,97,255,255,255,104,95,250,169,255,249,
+232,127,246,89,255,194,227,229,99,208,122,103,252,35,177,247,232,145,54,187,123,8,12,100,18,22,152,144,41,129,49,216,133,81,105,131,211,142,136,243,
+47,155,137,34,172,249,69,148,249,191,145,232,74,37,170,10,25,233,113,1,25,187,14,107,148,33,155,105,17,25,158,14,217,221,50,90,162,59,136,128,
+33,217,83,171,184,32,68,84,27,143,253,169,219,123,251,81,127,255,249,60,127,255,246,67,255,255,206,39,255,238,205,254,156,191,233,101,251,126,253,36,
+48,49,198,81,214,247,56,176,14,175,11,3,26,224,199,132,131,48,197,121,135,199,128,114,74,172,245,196,45,126,205,76,124,221,148,18,150,92,86,76,
+244,71,149,29,96,19,205,43,132,20,234,133,13,163,14,85,137,4,220,97,129,56,46,140,220,86,13,173,0,67,146,15,96,116,194,100,50,241,41,193,
+107,190,153,159,255,162,87,252,198,191,255,255,255,196,71,183,254,36,85,161,188,143,188,23,22,188,114,142,145,120,1,234,203,67,142,219,16,6,31,247,
+164,8,161,168,13,147,192,126,149,92,131,72,57,47,216,94,194,204,157,35,154,37,138,142,35,38,158,53,200,134,106,129,170,15,134,148,5,196,120,73,
+3,220,19,106,200,153,170,8,123,98,88,145,37,9,33,52,224,147,184,48,48,8,212,190,217,252,68,127,250,162,127,255,252,211,191,255,227,99,255,255,
+254,2,127,255,254,192,95,254,69,255,121,204,184,250,153,113,107,241,152,171,45,241,132,222,189,143,79,146,36,22,100,164,71,232,96,144,235,137,6,210,
+198,80,83,109,49,19,101,89,177,243,60,213,13,15,229,233,19,98,85,17,2,45,83,196,95,112,34,29,68,96,33,72,195,51,101,4,49,37,193,55,
+28,242,111,8,245,169,37,17,183,137,9,122,70,84,30,154,198,168,95,255,128,167,255,244,182,255,255,255,255,18,80,120,219,127,94,111,93,253,173,46,
+103,222,115,94,61,243,135,229,190,144,178,49,132,39,18,66,4,9,22,52,51,81,78,24,16,163,98,114,186,143,216,188,57,104,208,178,152,114,66,20,
+204,151,196,62,6,76,78,7,29,22,5,244,189,10,192,16,79,8,42,4,144,15,9,233,69,211,233,212,198,249,96,192,190,26,168,101,83,212,60,130,
+232,156,157,159,209,235,255,255,164,135,233,151,255,255,255,243,175,255,254,134,95,233,223,253,229,61,246,248,140,17,29,5,157,223,119,41,150,225,32,41,
+176,220,46,58,43,67,174,75,203,154,83,136,42,51,80,73,40,39,235,32,147,185,70,147,205,27,244,53,31,48,72,69,19,88,37,242,74,0,179,240,
+36,215,64,54,85,130,14,242,182,34,20,16,93,211,36,69,18,117,31,19,219,78,241,203,72,22,173,61,170,48,224,69,255,223,139,255,250,84,127,255,
+255,255,69,178,213,253,87,63,208,23,253,9,189,40,120,72,59,126,158,21,209,223,41,156,228,68,105,75,76,28,176,0,43,17,176,30,68,119,11,131,
+77,48,244,85,14,184,62,137,147,214,135,58,83,130,138,162,153,162,135,153,96,145,141,176,81,26,160,66,160,16,123,4,209,180,12,216,219,8,56,19,
+159,201,46,68,12,196,160,174,20,109,186,34,147,155,112,42,53,252,56,191,255,253,107,62,104,127,255,255,255,226,26,239,255,255,217,155,249,195,219,40,
+197,116,222,181,206,64,131,236,180,69,177,83,134,37,178,193,84,177,144,113,175,243,112,185,195,225,142,194,146,135,139,131,132,244,15,194,213,63,75,116,
+189,69,124,189,192,208,41,194,148,161,131,12,198,3,72,168,130,160,243,134,133,16,136,52,86,4,180,46,77,196,10,22,108,145,201,93,205,192,197,126,
+202,125,56,89,203,255,6,111,255,255,115,207,255,255,255,137,175,255,51,255,255,169,167,242,191,249,217,123,45,253,220,57,215,240,140,77,91,126,56,110,
+122,80,53,162,144,101,168,209,6,177,162,242,153,65,186,147,57,115,148,202,178,146,234,39,163,89,13,160,137,7,143,216,155,137,40,89,3,72,219,7,
+112,220,17,176,145,21,80,110,13,176,19,13,145,124,149,50,149,133,2,93,134,59,219,149,196,223,202,217,237,194,181,145,251,181,127,255,193,83,160,151,
+255,255,255,248,134,214,255,248,234,124,106,123,93,14,123,123,225,140,70,130,41,45,196,202,32,200,31,35,192,2,63,16,153,204,16,224,32,128,184,66,
+48,241,24,212,38,100,121,23,41,106,66,130,96,240,202,142,140,52,34,153,1,224,100,193,152,8,0,175,4,32,75,193,158,12,32,146,2,144,7,32,
+193,1,204,35,160,67,15,232,249,64,70,96,81,56,143,100,98,167,147,32,227,15,212,41,231,0,255,180,163,255,208,159,247,23,255,4,167,224,141,243,
+14,93,43,67,19,212,237,240,134,126,95,33,220,174,72,102,46,200,63,58,223,7,126,71,98,21,147,185,14,163,124,54,136,62,204,86,4,212,40,129,
+168,203,97,49,34,232,43,9,182,42,1,82,136,104,25,35,246,15,25,89,129,166,59,0,50,145,176,115,229,6,31,168,105,135,254,30,68,94,143,73,
+42,96,16,55,136,62,23,242,122,134,212,210,109,255,14,182,203,111,255,253,198,255,152,112,95,20,26,196,104,5,197,143,34,190,93,194,237,169,8,136,
+71,78,9,106,185,4,114,66,96,193,2,152,86,226,106,40,72,105,69,34,66,114,83,134,212,187,162,247,20,40,242,68,230,4,177,87,128,0,32,64,
+157,11,208,159,128,188,35,193,132,0,156,81,65,136,4,40,14,130,96,66,208,88,11,252,110,227,165,4,234,88,195,232,118,177,8,149,84,141,220,65,
+159,253,61,95,243,231,255,242,19,255,137,203,184,247,136,75,75,110,126,199,70,185,192,71,176,185,35,190,25,65,88,160,104,16,41,40,54,58,65,138,
+218,37,66,68,137,41,42,227,54,68,152,55,204,198,0,52,116,139,168,238,225,18,30,232,161,10,114,101,66,41,147,96,30,101,14,24,250,10,8,190,
+90,65,16,142,248,176,230,110,71,24,236,140,254,11,196,201,149,121,197,100,178,74,88,86,20,59,76,151,234,218,252,31,159,255,240,23,236,134,36,115,
+199,114,241,95,203,101,225,170,91,52,90,185,37,17,82,228,224,26,157,72,74,106,44,52,169,135,6,62,8,66,112,137,73,20,224,150,45,216,195,202,
+190,5,179,194,129,248,124,97,137,13,184,101,6,130,56,128,22,132,232,64,130,254,6,9,24,0,220,5,160,248,0,128,75,97,72,20,136,246,192,10,
+80,146,33,135,188,132,39,59,24,66,91,68,189,200,81,255,158,123,251,108,127,249,161,127,225,122,251,84,248,58,153,219,4,99,18,231,246,56,58,165,
+7,196,141,225,69,180,72,101,37,232,4,48,223,137,190,91,99,135,131,168,142,225,53,61,136,108,18,66,4,146,187,132,92,199,163,20,54,248,198,133,
+94,39,129,77,153,232,135,102,142,9,121,18,131,214,110,130,230,153,184,137,162,88,43,89,30,22,6,83,4,201,130,161,30,100,138,126,170,122,28,198,
+241,207,226,72,254,145,15,255,252,222,176,159,120,153,185,155,241,33,66,203,115,180,241,54,131,34,221,187,2,109,128,17,11,175,42,32,89,166,5,50,
+108,4,28,153,104,222,160,82,44,168,28,146,210,30,35,255,133,172,158,160,63,53,232,194,9,226,21,64,127,137,72,75,37,194,14,232,234,2,168,43,
+32,141,148,152,92,97,232,3,136,69,70,218,23,67,74,134,52,85,165,149,31,120,53,78,222,31,208,56,95,17,255,181,99,146,47,255,250,154,255,180,
+43,131,71,73,117,135,242,64,12,224,109,66,248,106,128,151,81,244,85,129,155,8,16,237,195,79,34,64,23,65,154,46,48,190,29,172,4,133,5,26,
+233,82,192,230,128,16,88,19,76,36,227,25,18,129,59,201,104,33,241,104,0,196,164,131,43,57,96,148,199,140,19,242,31,24,20,195,134,253,14,81,
+100,195,104,177,146,255,51,100,83,200,181,27,195,158,230,118,247,52,127,186,67,255,248,0,108,131,232,86,232,255,240,57,106,9,187,97,74,50,127,55,
+70,151,36,204,184,168,47,235,44,53,43,89,14,190,102,129,255,141,113,7,229,56,78,152,68,141,58,13,52,67,137,113,35,224,208,37,168,18,9,198,
+68,130,81,141,184,7,98,168,7,9,117,131,130,58,96,181,4,128,24,35,24,24,200,36,192,42,69,209,74,135,52,153,37,181,10,34,137,193,120,80,
+208,13,116,101,127,246,171,127,235,103,255,215,187,254,237,239,42,126,186,76,92,186,145,165,157,142,224,98,240,68,36,6,64,130,246,169,216,49,105,122,
+60,250,147,14,86,54,162,187,138,201,67,163,180,73,152,37,205,130,5,100,146,139,88,219,32,152,26,104,161,137,114,86,225,48,140,80,20,132,32,15,
+73,118,1,230,27,64,109,4,208,104,162,2,24,8,226,193,70,67,178,125,136,228,95,104,207,29,114,67,67,53,214,189,255,193,145,255,153,7,254,251,
+63,249,30,62,165,93,202,18,112,222,169,60,45,117,70,161,102,64,165,97,40,67,59,166,5,170,112,97,246,163,233,35,230,90,51,8,63,143,22,47,
+37,121,135,128,244,33,3,56,200,148,17,14,46,34,30,133,128,92,229,8,32,249,93,128,214,49,64,10,149,232,90,164,100,3,8,7,130,118,26,66,
+161,128,196,73,165,145,17,248,184,204,22,62,80,111,43,212,243,28,59,223,249,207,63,205,159,255,142,95,252,83,223,122,143,120,36,235,114,12,53,62,
+186,6,148,193,232,6,21,188,18,245,251,70,159,72,192,148,203,12,113,115,197,36,164,80,134,95,2,242,95,197,236,160,48,40,24,212,4,71,89,31,
+161,162,197,96,34,145,128,12,28,209,194,197,36,32,40,6,212,27,114,212,12,36,60,64,123,6,8,248,66,156,90,17,154,133,132,196,163,253,15,73,
+15,205,254,111,173,20,223,251,140,63,119,47,255,103,159,242,221,122,149,124,72,89,98,103,254,41,172,71,75,135,153,40,170,235,20,0,138,239,13,90,
+199,226,138,148,32,125,228,220,74,233,66,144,198,1,19,128,131,73,70,226,110,63,184,16,74,62,31,35,83,146,88,121,226,154,6,121,31,133,162,102,
+128,137,140,0,24,3,62,23,56,249,4,198,19,144,110,135,36,168,96,185,31,153,171,192,164,107,17,164,141,84,39,28,12,31,253,62,31,235,203,255,
+237,129,255,13,151,94,143,0,102,121,124,199,13,117,119,224,245,99,94,77,124,45,66,105,71,160,152,214,80,124,244,90,20,4,83,134,29,31,98,142,
+197,20,121,176,158,156,252,39,73,59,14,1,93,192,54,59,81,155,19,28,138,129,7,18,48,24,9,80,28,242,80,2,88,23,128,194,13,208,195,65,
+60,17,50,105,130,36,117,164,161,32,152,16,85,146,62,196,36,134,203,193,221,255,199,185,255,220,231,254,233,255,246,34,123,225,245,112,84,31,150,34,
+148,26,111,138,146,224,98,188,198,144,134,150,168,8,52,244,133,87,79,146,44,202,108,88,48,145,32,180,105,138,61,5,33,165,194,122,117,49,34,30,
+140,46,131,9,6,96,181,73,60,48,81,224,4,16,70,0,58,38,128,93,68,180,23,32,139,130,100,23,3,109,21,232,11,14,86,21,50,5,142,60,
+237,228,148,106,170,84,187,176,63,243,112,127,244,234,255,55,79,246,232,126,5,126,205,42,27,233,218,144,62,246,102,224,193,172,28,87,21,29,150,15,
+163,41,162,144,88,102,206,66,9,243,16,210,28,131,27,131,225,62,226,196,71,248,42,203,102,4,3,181,141,96,169,97,94,11,72,176,133,202,90,96,
+166,139,104,53,2,222,10,89,28,2,74,2,240,122,5,228,102,160,45,24,233,122,65,96,113,177,137,143,140,19,235,13,95,135,9,119,254,171,15,250,
+50,127,222,243,251,181,62,66,223,61,166,81,186,38,19,123,65,83,222,230,242,38,154,230,4,118,228,196,9,177,32,137,165,18,39,217,148,19,214,73,
+35,185,129,52,240,225,182,83,8,109,141,198,12,146,181,138,32,215,35,174,21,40,118,1,250,78,97,97,149,64,9,66,18,5,96,237,166,11,36,86,
+64,173,18,200,55,194,42,82,81,24,134,125,7,224,58,43,120,226,74,174,85,45,164,95,253,15,223,235,225,255,227,241,254,140,143,7,159,97,134,208,
+252,106,74,7,127,178,17,231,2,79,11,207,1,218,158,98,112,180,112,242,231,72,32,56,218,15,210,86,69,3,133,184,220,32,131,71,136,165,18,126,
+13,34,124,130,96,174,228,144,39,184,224,1,82,49,224,205,153,64,69,99,240,7,144,118,3,22,61,129,197,128,28,21,163,79,28,248,46,202,238,79,
+208,51,35,60,27,35,153,11,63,29,71,255,111,71,252,194,255,254,10,95,248,156,60,114,186,137,177,22,232,140,141,86,25,65,4,192,60,138,120,212,
+9,210,156,160,151,166,144,239,234,42,52,200,211,10,206,50,5,30,143,97,32,224,135,55,184,49,19,22,47,227,126,130,192,122,35,4,43,41,108,5,
+122,53,0,2,147,48,85,102,80,10,200,140,128,68,35,66,15,139,32,110,226,203,12,72,185,76,54,19,177,215,159,116,72,71,45,6,15,57,151,255,
+11,119,252,67,191,252,152,127,244,178,124,254,122,162,34,239,184,82,97,218,97,9,130,185,1,7,193,152,122,246,227,7,212,216,3,191,72,226,48,76,
+52,94,112,135,30,68,102,138,217,14,65,224,65,190,118,241,74,35,4,91,4,111,12,80,221,74,180,72,146,196,2,236,109,192,193,48,144,212,201,132,
+11,240,100,7,236,81,197,215,3,112,179,201,46,53,240,199,156,36,98,96,1,77,41,80,183,122,127,230,22,254,54,127,254,98,223,243,176,125,197,61,
+84,81,189,195,96,194,90,138,22,158,240,96,115,43,152,138,175,92,45,58,23,131,90,88,99,114,157,233,18,226,60,48,168,37,19,58,49,36,238,128,
+192,201,160,96,62,57,6,13,106,42,33,67,141,128,118,166,228,24,233,44,0,72,65,33,62,153,56,110,34,96,8,184,21,137,222,38,35,33,137,188,
+73,228,151,45,120,22,74,206,94,242,124,100,180,255,213,37,242,25,255,252,79,127,210,121,234,9,239,32,193,27,25,0,161,96,208,82,124,137,131,17,
+74,240,52,151,0,97,149,213,15,52,141,131,151,41,98,77,201,156,123,208,27,156,140,42,138,133,19,65,245,64,122,91,241,86,29,220,154,4,29,23,
+64,116,75,48,63,115,132,6,108,120,128,147,40,17,28,202,64,51,16,11,10,204,26,71,137,9,17,82,73,130,42,145,88,156,252,11,97,217,199,45,
+255,204,157,239,13,255,254,4,223,243,14,115,155,237,28,198,75,111,1,69,211,32,26,248,124,14,2,217,128,141,29,72,63,43,48,52,201,195,6,134,
+37,163,66,146,209,62,161,214,55,168,52,208,242,40,4,241,134,160,182,224,204,45,137,63,140,70,76,192,244,143,128,74,39,88,30,153,122,129,154,52,
+65,88,150,32,184,162,190,24,248,74,74,226,27,228,96,132,20,111,37,135,30,248,13,14,87,169,75,255,149,147,232,3,255,254,27,63,250,150,59,124,
+235,192,142,6,232,6,245,180,32,110,74,30,28,204,6,195,15,65,0,85,14,0,81,116,133,23,220,90,196,49,14,146,68,199,36,147,16,49,154,164,
+4,201,65,25,241,243,194,136,66,209,118,22,204,206,68,21,35,176,55,202,156,54,179,220,12,172,130,65,53,27,49,91,202,4,97,80,1,14,236,29,
+104,85,16,113,244,199,18,25,209,239,147,55,95,199,254,80,79,86,239,255,228,253,255,158,179,223,255,128,48,172,48,101,51,102,65,96,88,155,64,105,
+204,6,34,90,251,0,98,75,32,131,155,136,228,229,138,41,216,11,140,82,32,229,31,135,72,243,161,37,55,88,131,17,210,54,2,154,135,56,114,101,
+100,41,233,169,4,2,69,64,170,155,24,145,102,160,20,184,157,134,58,63,99,225,140,224,180,161,241,43,184,47,148,150,20,162,122,148,180,6,25,7,
+191,235,248,218,79,255,250,9,255,195,5,239,151,224,166,87,74,35,7,251,33,113,218,88,68,60,100,33,7,181,181,132,67,58,208,39,201,148,99,19,
+122,32,12,57,69,207,4,98,107,197,240,154,48,9,153,116,21,8,41,33,17,158,196,192,42,17,235,16,172,221,66,167,33,240,10,137,28,46,115,7,
+10,36,45,192,207,5,113,77,195,44,72,146,40,133,228,141,229,177,16,232,116,83,142,141,237,181,223,250,97,63,195,71,255,150,79,250,80,62,155,127,
+37,133,207,178,175,43,126,164,135,142,200,172,38,213,191,15,85,249,199,199,85,176,197,74,196,103,179,186,38,116,101,70,123,0,106,51,69,16,157,240,
+27,23,20,21,102,101,24,145,114,67,188,18,80,220,6,180,163,129,87,23,80,146,131,24,2,65,192,3,4,22,226,18,27,24,81,195,138,33,243,145,
+137,249,55,160,91,49,184,80,154,27,5,183,107,247,254,78,143,255,100,239,198,147,243,94,123,22,124,212,25,164,107,40,95,61,67,208,98,207,172,87,
+86,24,11,149,211,8,7,91,240,233,200,132,74,210,191,35,100,86,133,203,15,73,152,64,152,134,80,101,144,244,94,35,101,4,144,243,192,248,13,224,
+117,134,96,74,128,200,9,81,33,131,50,57,224,46,5,112,85,228,98,55,88,155,138,22,1,180,116,147,177,176,163,210,73,232,165,154,159,51,119,201,
+57,254,142,239,255,240,159,129,95,37,70,204,222,124,236,77,52,142,27,222,61,230,33,204,72,77,117,28,2,153,74,69,25,77,0,152,67,124,22,48,
+224,24,220,24,4,27,36,24,195,70,54,91,177,81,137,68,172,160,19,20,40,78,194,94,44,129,171,147,80,21,99,20,2,217,134,7,242,104,225,63,
+140,96,121,229,104,72,105,66,14,234,13,100,119,147,209,215,37,196,82,104,101,148,67,83,247,240,104,124,151,95,255,243,2,249,33,159,142,67,251,92,
+164,121,131,40,70,73,80,22,11,239,129,210,101,66,215,16,104,8,69,146,1,144,84,68,188,48,49,23,137,76,66,166,221,0,209,182,196,210,76,176,
+95,156,44,84,69,121,11,80,160,199,84,69,179,114,11,236,153,128,227,48,17,26,207,168,66,209,217,13,36,129,200,137,42,162,3,64,6,104,48,220,
+49,76,145,136,203,15,168,211,237,172,255,114,226,228,63,255,204,227,251,215,186,66,112,202,0,216,74,102,24,93,224,83,79,80,125,2,5,10,81,53,
+193,23,41,112,100,4,204,50,210,41,24,12,20,68,133,9,153,215,193,224,135,16,87,150,148,26,102,91,20,209,125,196,104,35,209,69,10,180,190,194,
+181,36,128,25,135,12,27,210,235,12,156,72,0,187,0,57,36,196,100,95,49,114,135,156,147,230,11,2,169,42,78,138,93,236,76,159,249,192,61,76,
+63,255,40,15,245,97,123,126,122,189,167,91,111,96,189,226,132,69,203,231,130,144,127,0,44,45,144,118,39,220,6,168,208,6,190,64,3,59,132,240,
+162,97,177,49,56,34,78,234,17,242,120,136,212,126,96,72,32,72,68,129,74,3,0,95,10,200,4,98,170,21,144,1,133,40,25,224,16,129,164,77,
+68,231,7,208,192,68,126,101,145,87,45,60,48,198,207,1,162,244,92,137,180,91,255,134,155,254,254,255,245,189,254,147,175,100,239,143,115,37,45,19,
+8,65,149,129,128,113,254,11,13,70,64,119,91,1,16,81,40,28,17,148,11,52,86,133,143,3,161,40,197,62,74,241,67,150,20,80,227,193,28,40,
+109,196,150,22,208,82,131,144,49,35,136,3,232,176,1,96,69,33,38,151,168,71,226,216,20,41,8,143,198,80,195,184,131,65,10,36,180,120,137,180,
+23,110,50,166,124,198,61,225,104,255,203,17,255,249,128,122,26,124,104,221,17,125,158,89,166,236,98,73,12,141,11,147,148,184,146,43,10,2,106,160,
+135,227,46,14,196,30,91,132,210,55,137,170,10,104,154,97,232,70,111,232,178,109,230,94,119,98,30,105,160,20,47,226,156,48,232,92,54,104,92,0,
+104,120,69,44,240,119,104,8,90,166,172,241,171,81,16,113,146,122,178,252,177,43,190,83,92,173,35,131,160,247,255,118,143,255,236,45,255,255,255,254,
+33,254,186,124,104,181,195,95,228,57,219,23,141,226,238,224,28,253,121,205,35,28,167,130,162,34,70,115,0,194,51,40,194,79,21,228,227,6,212,127,
+45,180,155,49,52,147,51,179,127,45,18,1,37,144,71,15,208,138,1,2,164,8,83,152,12,226,150,1,196,66,39,82,248,22,80,122,69,50,202,118,
+80,49,76,17,173,137,25,207,71,244,54,204,247,61,15,255,242,172,254,154,31,255,255,255,226,45,27,255,127,14,2,178,54,195,59,2,156,134,130,170,
+30,195,23,120,130,93,134,193,96,52,112,215,184,224,251,142,128,222,134,34,127,130,122,92,150,106,121,147,26,176,147,218,0,143,105,148,133,200,191,129,
+16,56,142,64,69,13,96,249,17,208,92,21,224,140,1,96,102,4,177,81,131,8,194,160,169,137,138,219,107,150,41,53,168,170,193,158,214,221,223,255,
+254,85,219,28,255,255,255,255,28,63,255,195,51,248,119,252,67,34,210,54,15,53,17,128,12,114,200,124,13,114,202,50,81,42,13,114,83,4,184,0,
+1,80,175,158,88,144,161,57,229,159,153,129,169,185,51,157,185,23,151,152,28,143,248,86,4,57,24,1,233,124,6,145,127,0,73,250,7,105,22,7,
+120,225,35,153,26,39,168,148,171,120,115,73,180,149,159,124,34,98,47,21,15,24,47,255,255,216,11,255,237,179,255,255,253,226,127,255,79,175,247,211,
+254,155,221,166,242,112,43,60,50,32,91,129,0,165,54,160,228,72,8,151,216,40,67,134,104,144,74,41,19,70,4,185,203,205,79,201,53,35,80,92,
+197,75,156,191,199,244,40,198,188,37,0,52,122,0,172,217,1,184,200,0,61,16,135,204,210,7,132,132,20,124,223,28,196,49,26,252,109,40,50,175,
+19,175,39,201,74,210,91,244,250,255,255,253,89,191,255,255,191,15,255,228,183,255,220,235,252,149,255,195,243,226,211,214,42,46,122,116,82,207,99,196,
+217,153,16,129,209,89,112,99,64,72,231,36,128,232,144,218,33,104,152,163,126,209,225,126,199,101,78,129,35,194,129,161,54,50,225,166,1,1,212,30,
+129,128,95,65,132,81,129,168,107,3,90,104,3,182,39,72,130,92,143,66,37,141,30,15,211,13,89,74,94,152,116,75,235,5,255,140,247,255,255,56,
+15,255,255,255,232,87,224,147,252,2,62,130,191,175,151,192,239,195,26,96,58,54,82,39,129,132,2,234,216,65,180,172,114,121,207,36,122,91,39,106,
+136,65,244,151,25,12,55,222,12,36,159,60,74,212,28,51,212,204,68,139,220,29,3,132,147,130,172,163,6,152,116,5,0,169,132,112,2,7,176,48,
+195,84,105,192,97,119,65,21,39,203,213,180,200,10,74,225,108,148,53,124,255,253,224,63,252,90,63,255,255,255,196,100,39,232,88,244,17,173,235,29,
+204,111,156,83,109,219,169,198,117,34,118,218,133,6,188,162,151,246,109,74,134,148,137,38,143,144,235,50,39,29,9,151,191,19,232,122,128,242,234,128,
+51,22,150,130,78,143,240,246,158,145,87,168,80,63,155,240,68,168,209,34,153,208,102,138,193,240,147,146,119,141,73,216,137,28,22,66,41,107,79,173,
+42,202,219,41,143,255,255,71,233,11,255,255,255,255,136,12,207,255,176,103,193,79,184,131,42,139,29,59,13,97,5,146,154,109,130,235,16,3,76,79,
+128,215,119,227,69,40,130,25,19,198,145,26,38,91,28,118,45,2,216,25,128,114,198,131,58,190,152,226,141,150,209,13,157,209,127,178,225,44,163,160,
+56,164,193,147,171,81,101,137,144,246,136,243,2,137,2,31,163,169,77,148,11,133,139,104,132,197,71,132,71,255,253,248,189,105,191,255,255,255,196,112,
+15,255,159,162,52,119,163,235,229,39,124,104,169,215,197,234,77,247,110,23,186,99,43,45,119,16,173,187,7,253,72,150,181,0,147,164,50,209,100,80,
+88,140,131,80,61,6,204,28,168,202,92,175,66,184,186,70,32,49,202,160,110,85,216,118,209,160,44,83,72,245,89,41,30,75,169,8,76,202,31,105,
+57,10,48,12,117,82,172,171,123,96,73,76,53,61,210,63,255,255,73,79,254,178,127,255,255,254,152,127,255,249,121,127,36,187,231,11,61,69,136,100,
+232,170,236,77,241,142,62,167,36,14,25,85,22,218,224,8,105,195,39,89,231,47,24,4,40,232,111,183,56,89,174,201,27,163,104,153,159,200,84,138,
+200,91,128,88,113,8,192,29,28,128,18,152,32,62,27,161,76,167,241,231,146,129,250,150,84,67,211,162,53,162,153,12,180,86,189,204,143,173,166,249,
+159,227,97,255,255,250,68,127,255,255,210,95,255,252,137,255,255,224,105,255,84,95,127,141,109,251,101,100,143,148,176,123,59,144,179,77,160,27,87,113,
+49,133,192,112,137,232,29,70,188,61,144,132,105,78,148,162,214,116,93,86,76,140,208,228,77,79,244,2,136,124,26,131,92,125,0,20,117,135,128,99,
+5,168,133,134,8,39,75,32,127,65,48,133,65,177,184,202,209,253,193,253,177,200,10,174,112,152,174,157,16,63,254,33,223,255,241,168,255,255,255,255,
+17,132,124,76,127,245,98,254,175,62,225,28,26,252,235,184,109,242,130,104,58,220,32,206,27,76,223,56,192,137,88,130,85,100,132,215,33,2,139,24,
+212,81,17,117,75,52,179,65,66,179,101,44,210,83,48,48,39,31,80,142,10,146,54,8,114,252,9,194,212,1,227,158,11,49,224,0,144,108,38,176,
+204,54,210,215,25,20,19,75,145,209,63,86,209,33,135,165,196,171,255,255,87,239,208,11,255,255,255,252,74,193,255,236,97,148,230,229,56,184,72,47,
+148,6,119,188,44,152,14,173,136,55,139,228,14,235,32,90,46,76,141,112,96,123,148,148,82,16,110,105,209,74,127,176,221,84,210,79,83,80,151,69,
+49,27,21,144,177,7,208,196,18,160,62,45,64,176,43,0,68,59,33,135,48,161,149,25,228,1,42,70,91,7,101,63,10,120,76,152,36,136,65,177,
+85,64,123,167,167,255,255,238,145,253,2,255,255,255,255,196,0,39,255,252,118,189,29,242,12,161,13,90,32,160,193,119,4,23,230,210,26,42,100,40,
+236,201,4,165,76,12,197,216,31,45,37,150,44,32,156,244,140,34,182,16,13,2,33,173,26,42,76,70,27,5,138,31,196,58,93,193,138,65,130,248,
+65,66,56,62,132,36,18,100,148,36,225,92,106,36,48,218,226,136,202,96,49,26,116,244,170,26,72,70,29,121,191,84,79,255,255,233,37,255,255,243,
+109,255,255,244,117,255,255,4,143,233,151,244,6,242,187,242,34,142,220,77,139,186,118,69,71,37,132,232,19,101,146,56,0,86,14,3,146,81,113,254,
+55,145,187,89,16,230,132,232,6,175,216,171,179,184,244,54,88,230,27,9,0,26,10,93,20,57,236,0,153,228,8,106,53,4,40,201,1,48,112,16,
+104,73,133,218,94,133,234,42,148,123,104,148,52,229,77,226,2,48,140,255,229,157,255,255,200,67,255,255,255,251,75,254,114,127,249,171,126,62,191,86,
+143,130,95,203,115,60,124,186,149,111,51,169,20,227,140,75,239,0,9,176,182,83,213,232,23,48,255,32,208,18,87,242,75,33,182,29,37,115,189,53,
+180,163,11,197,183,17,226,121,25,131,7,83,131,17,73,32,179,75,162,137,101,105,101,130,113,132,10,100,74,130,93,73,70,41,168,182,13,111,22,38,
+38,118,192,164,10,48,114,224,255,255,105,207,251,19,127,255,255,255,136,233,111,224,25,151,229,141,120,92,115,185,244,242,199,231,51,198,5,209,50,131,
+250,63,46,188,172,142,150,119,80,243,139,114,182,147,50,214,155,36,76,196,169,99,203,205,88,66,141,146,198,236,105,205,20,60,64,124,20,68,197,0,
+135,132,230,1,65,1,9,133,166,13,165,0,139,45,2,156,189,77,158,12,83,29,68,194,40,134,144,81,105,5,8,69,183,166,92,95,255,255,63,174,
+191,191,255,255,255,208,39,255,228,121,234,43,205,33,125,209,95,73,166,185,153,32,104,89,185,237,241,122,68,184,182,23,172,190,34,79,29,134,183,55,
+167,53,77,41,149,153,163,240,133,11,224,144,4,59,68,129,15,193,196,224,203,88,192,198,104,103,130,80,78,139,80,103,129,133,52,135,228,150,133,140,
+169,26,149,60,159,28,84,30,108,237,172,26,231,20,143,57,233,241,214,19,218,123,255,255,248,143,127,255,225,175,255,255,235,223,255,247,58,255,2,63,
+221,187,188,46,78,132,188,240,64,223,53,68,180,10,201,66,8,2,71,10,35,89,47,59,127,39,168,219,48,9,204,74,92,187,32,54,6,240,83,46,
+104,250,149,18,222,139,194,169,169,114,164,161,240,110,154,112,196,174,240,195,149,80,225,7,64,116,142,192,112,157,72,252,41,104,218,164,152,86,78,157,
+87,37,162,53,17,73,193,195,254,17,223,255,253,133,63,255,255,254,56,127,183,15,251,91,126,244,63,206,59,226,151,220,2,40,184,190,69,31,66,100,
+61,136,1,138,56,224,183,182,208,103,6,201,34,10,89,8,148,216,11,61,168,59,49,120,251,181,56,205,67,196,146,21,204,101,149,85,115,152,85,105,
+9,13,61,13,62,4,8,130,179,2,178,123,200,194,178,138,174,22,133,46,27,237,90,29,202,250,175,161,62,149,42,106,19,248,135,127,254,148,223,250,
+126,127,255,255,255,136,105,239,216,1,242,180,225,248,180,120,172,245,150,144,30,94,147,93,222,10,25,53,196,24,153,139,47,60,219,145,196,242,137,52,
+164,25,172,105,17,188,240,204,172,185,213,76,201,70,109,126,192,8,200,65,212,194,80,121,40,211,136,94,81,80,176,224,28,152,236,236,80,233,208,191,
+47,17,3,243,190,96,82,104,149,218,225,77,108,52,156,60,144,42,83,37,141,113,63,255,250,117,108,219,255,255,255,248,117,255,252,244,191,31,29,133,
+38,109,80,124,51,130,230,112,202,239,157,83,131,212,0,82,101,80,204,52,110,105,245,210,74,84,126,136,138,66,63,104,64,178,120,15,66,116,36,149,
+52,147,204,108,11,142,196,44,3,0,87,72,208,82,134,72,7,21,208,172,210,184,64,76,105,36,89,114,0,103,92,203,101,17,56,55,68,175,105,247,
+73,29,118,49,143,202,235,219,227,255,255,234,109,255,255,33,95,255,254,201,191,255,167,215,254,15,127,175,198,15,49,20,5,10,132,5,154,172,75,80,
+25,94,72,216,23,192,171,98,196,159,168,148,115,166,101,9,244,132,134,8,45,58,24,148,72,44,170,30,100,13,21,4,174,25,85,2,138,12,129,3,
+37,36,7,213,0,6,64,52,133,32,147,131,4,50,202,33,59,194,120,220,195,150,10,104,245,62,178,60,130,89,219,93,191,97,79,248,55,127,255,233,
+241,255,255,255,236,51,247,205,255,185,135,252,253,127,187,231,101,189,177,38,99,190,180,215,239,108,48,206,152,21,17,206,12,243,84,61,128,201,2,160,
+18,12,245,89,26,198,203,23,245,125,8,56,101,145,35,180,131,18,150,152,211,119,171,210,5,158,161,45,180,66,46,183,192,209,159,16,239,172,194,107,
+156,1,15,133,249,229,136,243,46,147,72,73,191,168,38,167,232,138,196,95,57,175,248,85,127,255,231,177,255,255,255,212,7,252,39,127,236,209,252,208,
+255,152,103,193,127,164,114,6,190,48,196,74,168,111,141,26,103,71,231,31,1,99,94,132,115,132,164,77,88,185,164,67,249,167,198,250,30,161,16,167,
+103,110,81,101,66,98,35,222,29,9,226,146,199,34,116,3,114,183,200,207,4,3,189,79,33,71,61,99,249,74,228,1,12,144,6,70,113,221,52,241,
+175,137,251,24,91,69,163,37,134,251,31,216,99,255,255,246,190,255,255,255,41,95,255,252,66,255,255,213,107,251,180,247,158,197,255,113,6,111,69,74,
+230,34,108,243,131,178,53,136,67,107,167,231,146,49,244,168,146,238,176,180,34,201,49,37,203,157,1,200,77,76,205,180,49,219,228,105,19,148,58,143,
+69,35,24,37,187,14,77,34,132,229,98,13,125,150,6,180,85,133,40,31,68,236,34,193,5,192,81,202,71,36,93,4,178,244,179,60,245,178,243,161,
+231,220,155,255,255,226,137,255,254,33,191,255,255,142,95,255,250,237,127,204,87,165,19,144,49,28,164,5,2,136,207,127,170,148,63,108,208,73,242,98,
+89,218,24,55,138,232,17,232,53,29,152,104,40,57,162,133,75,182,130,250,206,137,219,48,151,228,32,81,17,63,202,184,208,213,161,32,216,72,60,200,
+248,101,9,176,23,71,136,127,144,149,55,22,212,114,150,164,199,168,22,242,149,129,59,200,180,161,149,169,107,109,154,55,255,255,143,87,22,159,255,255,
+255,205,255,255,186,39,53,251,66,61,70,24,253,179,48,141,203,153,41,240,108,135,30,102,205,63,32,224,13,88,66,191,90,130,241,16,177,100,85,240,
+117,70,145,97,122,114,118,143,136,235,52,184,81,50,138,6,54,169,245,16,216,187,0,185,172,5,233,74,26,17,0,169,96,236,149,241,115,168,4,49,
+219,66,28,36,196,245,38,193,78,86,172,155,184,49,33,216,180,224,77,255,255,222,27,144,39,255,255,255,248,143,229,255,230,177,173,215,163,15,94,139,
+199,242,84,213,79,171,212,239,109,160,28,115,122,59,153,202,7,169,76,32,224,142,135,160,131,132,195,66,157,52,60,196,41,177,64,126,13,37,73,10,
+113,44,67,48,63,49,146,58,38,209,46,38,97,85,61,0,50,49,161,59,101,133,65,105,196,65,51,5,11,73,200,190,163,99,155,139,250,85,134,76,
+19,195,80,202,224,187,188,87,255,231,117,255,121,79,255,255,255,241,5,253,245,90,241,76,254,11,127,209,27,203,151,141,52,103,244,36,153,238,100,4,
+146,208,138,188,127,195,232,123,198,100,103,44,48,178,36,136,148,161,248,255,37,21,10,112,43,90,241,113,91,112,82,73,177,5,6,81,231,12,224,15,
+29,33,31,84,130,147,83,97,3,63,162,111,89,4,207,57,34,175,7,243,61,2,229,197,33,145,29,134,40,253,58,200,74,184,221,216,63,237,73,255,
+255,190,247,255,255,255,197,247,252,78,255,244,4,253,31,127,22,111,129,255,169,229,50,102,64,85,145,104,7,184,145,37,240,8,196,8,94,82,16,48,
+206,177,94,211,57,184,68,65,79,195,157,161,64,221,150,199,164,228,202,220,165,69,220,73,70,244,102,134,20,147,128,124,195,130,149,21,2,108,170,131,
+8,79,2,204,79,133,84,162,69,129,137,193,65,82,195,38,26,170,229,113,24,1,80,61,242,191,224,137,255,255,244,132,255,255,255,207,135,255,249,7,
+255,255,199,251,254,251,190,190,86,107,213,42,142,55,212,59,96,84,153,96,206,45,177,133,57,161,173,196,249,22,209,24,178,199,89,102,201,49,189,193,
+61,73,73,173,57,199,69,52,70,204,189,71,52,83,195,148,9,192,192,41,133,160,62,135,160,102,134,216,56,11,120,111,77,64,155,68,184,203,198,233,
+239,208,202,92,108,70,209,224,196,218,108,240,96,192,166,125,159,138,151,255,255,135,215,255,244,17,255,255,249,109,255,255,74,207,252,111,255,21,40,185,
+135,12,198,140,201,7,16,50,118,202,35,107,98,185,124,224,31,107,36,219,126,134,79,53,132,55,0,229,185,12,39,151,2,149,213,34,180,97,21,244,
+171,8,67,193,12,65,101,16,0,121,46,193,57,71,64,209,55,64,42,47,129,205,71,228,135,55,3,191,3,68,115,21,104,114,152,212,34,196,157,27,
+197,230,1,172,29,203,163,255,255,207,227,168,239,255,255,255,248,128,189,255,253,54,57,11,224,16,203,163,165,154,149,178,117,46,68,25,107,6,93,117,
+28,206,225,138,126,245,196,50,164,12,2,205,80,41,43,229,165,14,182,21,4,232,38,135,83,61,137,9,236,130,218,38,148,241,254,149,144,103,142,128,
+14,30,224,206,168,128,110,146,192,99,9,160,232,149,194,35,130,192,245,159,185,9,146,251,28,134,217,248,180,217,69,65,159,165,167,255,255,67,165,130,
+255,255,255,255,17,178,191,255,199,57,138,123,37,248,123,82,238,227,209,3,224,221,118,253,132,22,134,112,67,55,63,231,21,168,83,69,177,225,158,150,
+35,33,162,148,68,199,249,149,199,53,96,65,181,231,197,201,124,193,236,143,65,20,153,204,72,174,76,144,45,4,8,127,9,232,29,78,88,3,64,196,
+146,9,76,21,194,132,198,75,244,9,160,118,43,205,10,89,103,126,4,177,73,238,189,255,251,217,126,173,223,255,255,255,226,0,23,252,247,138,183,32,
+223,139,247,163,127,139,197,8,111,152,191,250,2,77,111,53,101,103,143,48,150,193,25,122,227,180,238,41,52,133,32,152,182,227,165,14,81,76,103,146,
+87,65,145,107,90,177,128,75,112,48,5,240,161,2,98,124,16,211,14,28,64,29,59,0,42,13,65,150,1,98,63,48,69,197,20,3,225,36,148,237,
+18,73,139,167,132,148,196,129,131,241,166,255,253,173,63,252,219,63,255,255,255,196,113,135,66,79,213,227,215,159,165,22,219,62,138,156,185,122,112,68,
+190,190,5,187,120,40,38,224,152,176,175,180,37,41,92,160,172,204,246,101,40,141,100,50,146,33,90,240,96,72,171,38,34,58,229,50,88,225,160,76,
+96,12,65,131,94,97,193,208,37,3,100,101,196,98,176,133,246,77,66,190,27,138,42,137,145,167,57,39,137,5,151,119,56,171,58,200,170,242,57,44,
+127,253,103,63,254,248,223,255,255,255,226,34,146,251,159,242,74,255,197,255,250,200,116,119,222,146,211,252,228,176,253,215,89,5,99,4,22,82,28,74,
+89,115,27,121,180,2,176,6,24,184,225,46,88,146,148,154,169,144,137,205,164,25,14,146,106,95,140,130,30,134,160,91,135,144,174,168,161,192,175,32,
+159,155,0,79,166,114,117,184,115,21,156,242,42,141,115,240,171,229,46,213,130,63,162,109,15,117,228,193,151,88,143,242,170,255,255,217,219,255,255,253,
+117,127,249,77,255,241,220,255,74,63,243,56,251,54,248,71,59,220,184,137,87,1,229,253,163,193,69,22,210,141,28,96,69,162,240,49,144,105,79,38,
+248,87,150,121,156,166,152,7,192,212,50,151,180,87,79,84,52,151,173,43,149,60,241,134,172,218,137,93,194,147,69,218,139,37,9,8,189,61,154,173,
+193,160,22,103,139,54,28,144,177,81,74,193,172,84,117,67,129,229,219,35,244,82,255,255,253,189,191,255,249,116,255,255,255,33,159,255,252,11,191,182,
+191,126,237,89,122,80,83,182,80,80,74,0,199,144,102,2,76,70,135,104,50,216,40,18,9,41,8,200,213,51,10,20,66,52,67,23,132,87,219,148,
+111,35,10,93,13,114,25,136,22,88,11,118,206,10,86,165,130,246,131,196,70,225,137,214,223,198,34,93,68,130,100,13,98,162,207,154,32,71,10,126,
+164,166,94,106,106,29,37,198,208,124,136,63,253,92,63,252,223,63,255,255,255,154,253,95,255,206,67,237,119,238,169,225,123,239,65,197,127,112,98,5,
+63,200,88,13,194,181,32,210,58,6,156,85,30,158,69,14,242,150,9,126,38,204,62,72,208,221,33,102,229,34,146,73,75,81,1,47,145,139,27,81,
+6,63,117,162,87,214,126,46,180,74,12,212,82,41,182,78,70,244,178,29,16,217,18,99,151,7,50,175,38,84,191,25,169,226,190,229,193,221,162,98,
+113,70,255,187,135,255,254,208,159,255,255,241,211,255,251,32,255,255,177,151,255,136,127,233,233,23,210,123,174,208,243,191,112,214,78,97,157,242,222,144,
+237,205,146,69,202,6,101,61,19,53,105,25,244,110,138,189,36,64,137,135,197,109,30,200,5,87,69,242,5,41,48,230,230,188,101,36,4,53,39,224,
+89,234,248,48,100,228,88,67,18,130,67,114,55,2,242,49,75,50,167,82,219,100,137,30,144,99,121,131,36,55,213,226,173,113,210,238,233,255,255,183,
+70,187,191,255,255,255,213,127,255,185,210,62,194,110,145,17,155,226,41,183,63,129,134,34,57,138,22,124,63,0,194,43,6,115,10,1,73,15,164,30,
+82,212,4,79,240,84,73,16,44,127,51,44,147,57,127,60,72,27,159,152,72,158,56,249,29,169,3,1,176,165,164,145,60,164,176,84,154,16,138,168,
+210,150,189,35,160,169,194,98,133,1,229,130,67,130,145,99,244,138,88,168,195,173,64,165,167,189,135,255,246,72,255,27,143,255,255,255,241,9,187,247,
+184,251,86,127,192,207,253,228,62,106,253,10,25,78,82,67,159,81,226,159,132,146,248,17,221,5,20,254,14,197,50,132,135,202,166,80,195,100,104,177,
+144,130,195,146,74,3,143,186,166,132,217,244,150,120,141,44,153,239,32,249,128,12,105,190,20,11,97,38,235,219,27,9,249,1,248,138,7,184,217,28,
+184,98,15,106,159,152,164,136,206,106,21,33,104,237,103,129,90,60,192,63,142,151,255,255,163,119,255,255,200,207,255,255,153,63,255,248,107,127,9,190,
+134,215,107,206,81,58,76,58,251,211,21,209,241,199,104,204,43,49,66,66,249,222,64,94,50,138,110,66,130,170,61,228,242,45,168,238,82,36,14,218,
+163,181,5,177,210,89,144,132,61,146,112,80,85,122,74,244,166,11,17,156,31,129,82,14,2,78,7,0,105,58,5,175,91,103,41,47,101,159,12,167,
+139,61,202,81,184,53,27,76,25,83,198,159,236,105,255,255,205,155,252,97,255,255,255,251,249,255,255,94,15,203,236,204,60,36,188,148,252,207,48,19,
+196,209,47,111,85,2,252,162,30,166,116,0,116,79,135,0,10,192,224,21,2,6,96,227,152,254,229,245,2,48,76,92,241,29,92,80,206,107,81,254,
+70,48,8,3,113,41,21,32,80,18,160,230,48,193,173,97,67,199,90,194,169,44,226,57,37,37,51,59,135,89,24,100,55,67,176,143,95,145,249,47,
+115,39,72,29,106,63,254,183,159,254,206,31,255,255,255,226,29,246,188,127,248,194,127,67,31,118,205,216,123,58,110,7,208,186,82,243,34,88,129,24,
+124,98,122,57,66,208,64,162,191,115,198,255,91,37,213,18,68,123,8,117,249,4,134,227,9,52,119,47,113,179,51,80,253,26,208,51,22,114,80,36,
+148,34,23,147,82,5,162,106,2,163,0,20,210,92,8,145,135,29,228,225,22,228,191,14,53,17,8,168,237,177,245,175,97,61,72,185,180,127,225,9,
+255,255,33,175,255,255,233,171,255,238,207,255,249,175,127,243,219,255,44,14,118,112,80,164,18,248,207,72,112,26,160,92,166,132,182,246,212,111,25,0,
+24,42,12,17,89,89,39,185,95,49,88,18,33,201,148,150,57,236,151,249,123,149,121,86,136,137,63,203,2,97,47,7,192,70,17,0,234,24,97,200,
+7,99,92,20,115,158,25,81,244,27,145,58,67,242,194,123,115,42,120,176,89,68,243,17,68,16,1,128,186,77,121,165,127,255,245,164,234,239,255,255,
+255,254,33,157,127,255,178,3,225,231,27,165,243,144,217,26,95,252,106,178,17,226,133,31,218,225,6,219,195,6,188,15,146,29,236,145,52,164,5,220,
+127,68,244,178,205,36,141,81,28,177,76,164,242,199,28,221,197,52,121,68,164,8,67,44,76,0,28,102,132,144,86,6,232,97,130,248,148,3,116,122,
+131,68,69,195,89,12,194,113,15,200,28,205,74,149,115,72,154,120,47,253,91,126,153,159,255,180,151,247,176,255,255,255,254,69,125,254,60,62,191,85,
+223,243,110,253,162,254,140,89,58,220,240,43,101,24,95,54,68,74,217,53,8,0,250,41,48,190,150,96,46,137,152,59,142,233,213,128,219,59,128,211,
+1,140,202,0,147,249,137,137,9,199,138,129,209,148,16,255,144,240,12,15,64,61,26,32,169,169,161,141,167,161,98,147,129,15,135,242,33,149,148,40,
+211,82,79,102,32,247,224,218,185,98,53,30,122,121,127,166,231,255,255,147,23,255,255,239,219,255,255,208,223,255,255,141,23,253,98,251,241,68,238,242,
+81,239,195,88,82,204,58,159,203,179,100,66,171,118,225,80,65,225,65,100,38,171,117,8,0,157,130,220,131,26,106,134,155,106,139,20,38,200,249,193,
+66,232,242,192,52,154,71,144,210,211,8,236,85,0,102,76,224,44,8,96,0,141,96,183,81,169,12,72,56,142,201,4,55,77,220,212,68,37,169,64,
+73,73,207,236,99,29,79,244,230,255,255,174,119,232,187,255,255,255,209,223,255,240,146,253,16,247,150,145,102,244,62,171,220,32,120,91,56,13,18,7,
+206,178,143,11,139,20,111,106,140,165,235,40,64,164,176,139,103,49,3,51,210,129,24,37,38,185,128,154,137,51,164,168,46,42,8,152,20,120,85,138,
+16,191,146,0,66,6,145,77,4,96,181,24,1,20,167,113,217,152,209,56,129,9,41,129,203,24,154,116,190,212,202,92,228,232,225,96,164,239,187,163,
+127,254,207,159,253,104,63,255,255,255,196,123,86,223,31,250,208,127,222,143,245,118,225,111,188,214,13,61,22,179,55,226,61,9,89,173,20,114,4,22,
+242,192,17,203,98,28,41,30,0,121,233,140,34,154,137,137,159,159,25,112,148,234,194,136,35,163,146,82,151,135,209,3,134,240,202,158,49,210,182,242,
+33,179,1,6,158,64,91,153,145,132,170,51,124,177,179,232,152,146,196,132,26,157,131,36,75,211,202,162,45,253,41,249,66,127,224,141,255,254,102,95,
+255,255,52,63,255,199,255,255,226,221,255,88,223,244,62,250,86,244,158,17,209,127,173,48,179,183,226,228,24,209,189,63,34,46,206,113,186,95,113,3,
+200,216,192,68,33,161,77,242,70,167,225,20,144,240,95,176,249,79,80,250,104,148,82,109,116,194,58,178,188,6,114,90,8,180,166,44,86,62,49,19,
+242,9,48,26,6,64,203,38,144,242,91,112,206,76,179,155,7,215,127,11,165,95,46,176,111,248,218,127,255,249,35,126,8,255,255,255,255,226,26,63,
+255,255,133,87,58,61,37,252,13,47,147,97,227,69,189,116,214,248,101,91,247,81,199,71,152,32,155,182,81,173,194,194,11,177,6,133,74,7,41,56,
+122,160,72,164,179,152,128,64,68,73,22,28,98,198,12,167,193,148,12,198,68,159,4,124,117,9,0,64,211,80,106,206,40,6,3,128,20,3,224,217,
+79,33,242,81,242,0,98,108,180,162,102,201,164,5,58,152,121,93,207,192,203,255,236,249,254,211,223,255,255,255,140,205,79,189,96,61,172,127,46,143,
+198,151,243,186,237,167,198,33,92,100,0,9,211,112,76,59,24,43,156,0,1,0,7,211,49,51,209,161,67,69,9,5,67,29,58,192,145,228,74,74,
+46,167,37,1,177,186,63,145,17,0,242,27,23,224,217,20,0,202,23,32,118,56,130,71,104,165,87,123,165,247,86,67,245,20,1,243,24,50,75,24,
+20,135,6,245,151,26,18,97,107,181,46,165,47,153,215,255,188,119,254,6,31,255,255,255,147,126,153,191,252,37,63,190,127,193,123,80,125,231,46,251,
+175,100,54,230,244,158,196,135,117,136,114,223,89,207,100,28,106,41,84,73,101,248,151,103,72,237,102,84,226,160,126,111,169,194,11,14,146,54,76,162,
+30,71,190,16,69,42,67,70,174,160,137,10,213,71,130,165,1,18,45,197,116,48,38,236,67,227,112,54,32,0,90,225,156,215,168,45,55,22,208,168,
+42,206,70,28,73,144,212,137,191,213,83,255,253,225,191,255,20,31,255,255,162,15,255,219,155,246,85,235,192,115,49,59,235,85,207,247,206,187,83,93,
+183,153,166,58,68,12,149,196,40,157,193,166,148,2,170,19,3,52,176,169,177,23,244,228,137,120,248,52,40,118,164,200,166,165,56,64,41,249,7,32,
+40,162,1,200,192,161,17,205,177,1,157,169,192,185,155,160,102,153,65,87,164,18,220,170,51,119,151,2,58,148,40,19,186,137,25,65,76,80,152,60,
+17,215,127,107,143,255,228,41,255,87,239,255,255,255,241,15,177,208,155,255,11,175,255,28,223,252,204,190,224,252,125,0,76,66,104,136,61,48,180,35,
+198,52,13,136,117,39,29,30,162,51,59,104,26,177,82,41,128,112,217,151,217,7,151,9,216,145,121,225,153,104,138,174,41,99,60,122,114,51,90,22,
+24,233,57,2,200,251,1,33,146,7,186,14,10,89,72,6,32,229,161,67,41,173,163,251,159,83,92,134,50,189,129,219,114,146,228,157,217,170,136,49,
+148,252,59,63,255,248,11,127,177,191,255,255,255,236,239,255,255,27,237,98,248,132,250,180,110,239,170,20,26,112,16,134,62,126,147,141,205,105,232,230,
+48,23,66,188,201,7,94,193,7,222,82,198,10,2,200,14,15,205,246,77,209,73,49,232,66,137,162,121,140,200,171,149,152,33,12,24,33,2,80,74,
+4,1,88,12,202,242,34,123,210,40,43,10,26,41,60,10,216,34,140,216,76,158,200,16,42,88,149,151,75,15,154,37,28,226,193,111,94,193,95,254,
+97,159,251,228,127,255,255,235,123,248,226,255,233,61,251,116,252,98,58,239,248,5,99,243,133,81,43,17,142,42,82,153,203,57,255,232,168,87,236,172,
+34,168,220,108,169,180,195,231,240,191,224,116,95,169,2,2,206,22,27,140,210,3,40,194,20,166,90,21,71,38,105,200,186,165,7,42,143,129,126,60,
+68,136,11,102,144,26,228,40,14,225,36,44,97,236,153,38,233,19,21,160,153,106,61,67,44,20,17,60,187,73,12,31,127,134,103,255,254,187,95,252,
+140,127,255,255,235,51,255,253,198,63,118,57,174,113,172,244,213,251,103,120,104,246,234,157,77,52,5,1,114,11,49,134,0,225,130,0,44,129,139,128,
+254,86,137,240,84,57,231,71,33,101,196,213,19,72,5,30,67,253,56,192,24,250,65,44,75,70,164,122,9,228,227,7,28,218,129,92,172,1,32,171,
+131,12,224,10,228,245,15,12,134,10,132,109,65,37,82,195,113,155,64,109,86,69,165,44,193,90,8,186,135,127,251,93,127,254,109,95,255,255,255,223,
+103,235,103,255,254,43,31,255,58,191,241,246,218,101,169,35,112,83,177,4,38,229,238,35,72,127,28,45,93,159,222,169,206,127,0,163,147,31,65,39,
+23,145,123,35,115,3,35,147,155,47,242,129,69,144,179,78,144,88,61,208,90,30,112,52,3,176,158,8,129,112,12,33,226,17,193,64,30,160,91,43,
+9,100,18,80,5,186,35,5,214,20,166,106,41,41,94,4,110,42,59,80,127,40,102,65,57,79,217,19,255,254,26,31,188,159,255,255,255,184,95,255,
+198,201,121,116,61,222,242,112,247,168,138,190,162,215,19,226,49,100,92,220,151,174,29,68,104,43,73,168,32,101,184,24,96,16,36,34,42,98,33,38,
+167,96,50,188,33,106,153,35,130,100,164,74,58,227,70,28,97,162,5,0,134,42,0,20,66,1,4,60,194,132,31,3,128,0,98,208,18,224,96,27,
+34,138,45,99,234,95,34,70,180,34,9,6,83,38,139,121,224,64,63,159,247,255,235,189,250,217,127,255,255,248,136,134,47,233,145,249,103,254,206,223,
+125,191,191,215,88,30,3,69,154,71,212,150,89,154,232,28,60,40,0,5,31,0,16,248,140,197,61,25,237,51,29,108,155,151,236,41,80,220,165,76,
+196,187,75,60,142,74,4,70,72,108,16,6,252,106,5,164,170,3,44,179,128,112,144,130,208,112,0,232,118,133,204,154,14,52,158,147,12,72,144,244,
+102,201,245,18,196,101,76,197,12,221,206,28,170,191,208,123,255,255,112,143,255,244,203,255,255,254,234,127,255,254,74,159,252,99,122,219,99,13,224,103,
+242,250,235,167,212,250,120,246,154,33,121,30,21,13,15,26,182,177,208,45,148,34,214,162,64,240,138,72,2,158,216,94,158,41,80,149,90,0,142,185,
+254,142,9,83,145,40,80,147,248,158,17,249,34,9,185,35,2,80,207,11,96,155,9,80,237,7,105,193,32,154,123,51,218,81,54,185,47,45,72,36,
+165,88,165,171,136,70,64,221,60,40,19,211,123,255,234,29,255,212,179,255,255,255,252,64,125,122,240,255,255,29,79,255,97,191,240,108,229,207,129,193,
+175,207,113,89,239,116,190,116,96,7,99,50,132,50,113,207,249,228,99,96,192,169,112,117,225,96,101,97,38,156,33,4,237,164,125,14,178,246,129,153,
+23,45,216,109,23,184,26,9,184,124,8,105,121,16,122,142,25,27,5,24,58,94,11,8,222,4,0,135,135,113,21,133,184,190,155,184,47,170,88,89,
+162,185,188,131,107,200,164,227,6,255,157,119,255,248,31,127,180,79,255,255,254,40,127,254,197,26,173,153,97,205,0,141,52,169,167,207,19,106,94,253,
+89,242,240,10,144,77,61,7,149,102,2,24,225,7,117,30,22,157,75,30,116,224,154,20,18,77,245,5,195,181,109,64,221,47,68,4,149,199,108,20,
+197,148,3,131,120,84,208,72,205,217,145,0,217,248,202,210,112,107,201,56,76,196,240,178,200,97,139,208,138,54,42,253,49,148,144,139,120,218,48,24,
+98,163,190,130,31,255,181,7,252,20,191,255,255,254,220,39,51,254,194,31,248,133,255,230,9,254,17,63,150,6,214,181,164,101,227,69,175,145,199,198,
+200,91,16,32,236,8,200,68,144,161,22,91,250,28,175,41,32,245,20,130,72,174,46,168,150,164,216,155,169,72,114,52,121,201,57,42,121,45,138,29,
+20,185,53,3,16,145,13,0,172,5,225,84,10,137,215,22,217,122,20,248,1,5,74,0,139,51,104,141,243,131,128,146,129,146,57,63,154,40,143,255,
+17,111,255,253,222,191,224,199,255,255,255,253,63,255,255,252,75,62,196,122,65,254,110,159,93,159,140,102,164,249,196,39,253,11,15,6,216,16,77,198,
+162,82,247,150,128,156,63,12,220,124,128,24,138,192,36,177,73,252,93,211,252,33,213,252,82,205,188,224,64,17,96,75,1,102,206,8,237,203,8,73,
+199,144,24,8,176,9,207,136,156,88,57,66,91,241,139,214,81,92,202,33,2,193,4,234,68,29,82,194,242,14,231,237,52,150,184,153,222,184,223,254,
+24,223,255,49,15,255,255,252,114,127,249,204,255,255,148,199,253,195,254,12,87,105,194,250,78,57,177,69,230,210,64,60,95,210,194,114,60,41,166,191,
+132,164,192,233,4,255,237,36,131,225,64,23,104,26,45,141,170,69,143,78,56,205,214,25,10,134,6,102,182,23,227,94,21,160,238,3,224,156,18,129,
+172,32,2,196,25,196,40,4,101,220,54,103,96,110,168,0,154,230,224,169,35,116,140,162,66,68,105,170,38,144,191,79,73,244,193,226,170,125,84,191,
+252,191,191,253,77,191,255,255,254,22,127,241,191,255,255,230,121,255,252,89,255,210,123,20,215,183,236,173,212,215,209,115,128,95,40,9,236,216,240,84,
+210,249,58,3,205,193,13,237,142,144,93,2,15,148,105,14,204,9,207,76,67,208,220,79,81,236,67,209,12,59,204,244,76,197,132,122,68,32,184,78,
+16,239,213,145,2,88,104,220,213,64,121,76,48,26,129,36,189,15,181,66,28,29,128,161,158,174,144,211,53,167,9,1,3,215,59,16,16,111,179,192,
+74,127,235,137,255,251,16,116,129,255,255,255,245,217,255,47,207,168,7,249,252,255,63,175,43,253,200,17,5,26,28,136,15,225,120,1,143,16,17,76,
+236,7,44,36,63,171,200,124,234,140,164,39,112,163,98,80,121,100,22,49,234,138,31,143,126,98,208,213,66,104,20,159,18,233,147,33,39,128,240,199,
+17,218,111,32,27,113,38,11,154,34,186,238,23,233,162,9,56,12,4,113,114,141,82,142,143,115,33,139,83,41,131,130,206,131,170,68,133,186,101,228,
+101,255,240,178,255,206,251,255,255,249,20,255,225,235,255,224,117,251,94,246,24,146,203,81,48,129,252,221,178,63,121,227,78,183,50,168,193,218,57,54,
+94,192,38,1,153,81,150,206,2,17,143,131,180,175,90,74,47,38,60,208,97,210,91,168,226,16,77,114,93,142,158,128,204,162,125,200,98,96,67,58,
+55,1,132,16,132,200,10,38,28,24,101,160,31,100,4,41,162,40,62,96,208,97,160,100,141,224,192,182,161,64,201,97,4,179,160,178,108,36,103,248,
+107,127,255,208,3,153,175,255,255,255,244,99,255,248,180,26,103,229,163,254,188,95,214,63,246,238,240,181,225,112,113,162,113,108,105,163,235,193,105,157,
+47,40,75,110,199,35,119,225,251,9,33,220,72,19,184,116,147,190,127,114,118,113,176,172,87,16,235,57,177,215,32,241,237,14,177,93,2,16,133,8,
+192,30,21,128,52,37,32,91,54,33,119,67,162,173,70,67,129,56,195,125,23,130,99,27,48,67,88,50,118,137,90,137,79,13,179,168,218,230,82,119,
+192,211,255,16,175,255,238,205,255,255,225,3,255,255,245,55,255,255,252,20,191,247,203,195,131,175,71,200,47,242,52,245,25,243,72,197,103,12,129,39,
+64,135,168,37,121,31,34,92,65,16,21,134,140,164,197,10,204,50,139,116,37,77,228,75,208,36,94,80,52,115,204,228,155,198,12,212,66,241,12,76,
+1,42,210,161,24,84,168,197,209,24,58,72,128,114,3,101,25,143,181,142,153,85,169,157,173,90,27,164,167,147,188,73,199,245,69,196,202,10,39,225,
+32,149,154,130,15,213,219,255,242,172,224,29,255,255,255,220,116,255,127,249,147,127,217,215,241,198,200,141,207,31,8,235,231,204,92,114,42,14,24,67,
+4,139,247,13,43,205,24,75,85,30,74,76,27,56,183,15,169,37,128,162,231,144,116,19,205,82,37,230,237,3,50,104,89,176,114,32,17,213,27,131,
+193,75,164,199,102,4,157,102,131,97,79,193,111,40,192,158,3,114,52,42,242,234,70,178,162,83,177,142,83,112,20,74,209,59,63,209,233,54,177,145,
+66,248,49,127,233,77,255,250,130,127,255,217,103,255,254,200,255,255,23,47,154,237,157,148,202,19,122,11,96,171,196,147,12,93,212,168,59,135,34,117,
+193,208,151,1,89,248,23,134,83,209,95,147,52,132,222,210,16,50,206,17,102,67,212,152,82,172,21,27,148,128,157,116,164,25,44,141,16,180,86,134,
+196,28,130,48,11,200,96,25,203,48,21,203,8,12,200,216,17,197,240,48,195,96,107,65,96,178,64,76,237,194,172,255,198,180,205,205,60,74,85,188,
+136,33,131,230,213,255,253,4,190,244,223,255,255,255,226,12,203,217,75,254,170,159,254,95,255,252,141,63,166,63,193,154,113,99,97,142,6,17,189,4,
+51,249,228,233,121,92,202,161,31,39,66,15,44,130,100,43,84,100,93,20,80,110,82,226,104,208,236,87,48,219,65,241,255,46,178,81,31,49,253,18,
+17,69,5,176,131,7,64,8,20,224,60,32,160,48,38,192,6,35,96,0,20,32,62,6,144,202,41,113,128,76,178,12,103,210,26,113,145,82,99,208,
+101,60,178,203,4,32,1,255,79,239,255,241,224,255,157,255,255,255,255,224,243,255,255,146,70,113,191,102,95,248,37,127,123,95,223,107,195,103,141,115,
+6,174,244,7,12,46,147,202,131,59,228,119,132,241,127,169,81,4,146,208,248,131,145,63,133,57,167,137,153,250,139,186,13,141,25,213,141,249,92,141,
+248,193,140,120,36,137,8,86,3,136,157,2,240,173,8,176,152,11,160,117,10,0,92,3,32,94,8,168,122,23,72,162,37,152,188,48,120,179,53,24,
+121,49,232,18,38,184,108,148,143,5,111,255,179,103,245,136,255,255,254,208,255,245,109,255,253,82,63,209,247,158,80,251,57,62,6,144,13,172,241,183,
+201,48,68,98,8,38,240,224,40,24,82,30,107,204,35,202,204,34,185,112,28,104,13,146,217,112,136,90,128,128,227,33,136,67,75,141,51,10,144,34,
+127,145,193,203,146,129,19,146,192,112,146,0,12,15,240,97,11,224,139,5,208,145,2,8,120,10,216,68,19,88,2,154,56,88,158,56,173,159,8,238,
+156,233,5,151,185,42,131,247,248,124,127,255,162,39,254,21,127,255,255,232,179,255,224,121,146,60,158,121,145,115,185,243,158,232,155,226,141,172,159,19,
+137,237,220,184,147,214,161,76,135,230,60,142,107,60,169,12,205,106,95,241,62,147,27,28,67,52,190,26,220,4,146,28,136,73,220,224,194,173,2,67,
+8,246,199,56,202,73,240,140,203,48,74,203,24,19,73,240,15,136,0,23,133,176,0,3,136,53,193,240,133,65,56,226,193,129,64,194,161,143,196,105,
+191,198,33,186,199,217,177,241,222,255,250,133,127,248,26,127,255,255,246,27,255,160,207,255,254,145,223,255,213,55,255,56,111,67,184,100,103,49,197,143,
+219,203,191,47,177,7,28,190,166,152,17,229,48,231,113,44,11,113,248,49,194,233,74,69,193,71,198,251,53,7,17,28,70,107,4,197,95,11,212,57,
+18,179,39,15,114,75,3,113,181,14,97,105,34,65,89,51,193,107,63,1,143,65,65,157,55,225,121,35,33,17,3,160,89,34,240,168,77,17,230,117,
+51,58,139,26,63,74,197,98,37,214,207,14,67,249,224,127,255,114,101,159,255,255,255,255,16,16,191,243,136,255,34,79,255,91,255,254,226,223,224,51,
+243,152,189,188,3,162,212,209,184,167,69,55,9,39,77,165,98,55,193,104,151,211,40,100,73,56,121,195,128,191,65,25,22,64,217,97,193,177,141,194,
+169,138,195,17,84,66,96,238,192,120,101,66,172,55,6,164,208,138,245,83,143,29,174,146,117,212,20,141,190,20,245,110,19,172,239,144,196,83,140,180,
+81,199,204,235,66,149,100,194,97,176,70,249,192,200,162,41,159,254,56,31,253,30,191,255,244,11,255,255,134,175,255,231,233,239,182,22,186,138,99,131,
+167,20,121,108,156,134,179,136,45,185,164,28,220,216,146,158,83,138,59,9,228,189,89,99,161,31,66,3,29,48,37,83,145,168,125,211,52,139,218,38,
+71,173,53,34,118,160,206,242,135,138,82,99,69,2,54,192,64,8,68,188,34,39,248,68,169,148,92,169,132,104,103,228,105,101,28,98,97,172,85,161,
+214,71,228,198,61,38,162,55,230,246,60,101,86,78,226,155,200,171,255,234,5,250,230,127,255,252,78,127,253,251,255,255,210,211,252,3,82,139,210,99,
+239,11,251,182,124,217,126,40,27,196,234,176,150,42,21,6,133,181,187,180,222,113,160,171,190,9,84,231,166,84,178,224,124,255,103,32,161,33,46,77,
+39,138,10,43,130,35,205,10,60,204,90,68,138,6,63,134,174,50,195,6,35,192,72,22,194,172,15,67,192,15,3,100,22,1,160,34,129,54,49,4,
+166,62,200,42,70,139,14,69,76,206,55,140,226,27,139,18,13,167,38,62,160,13,97,15,255,45,47,255,21,111,255,255,187,207,255,254,24,255,255,255,
+170,183,255,209,111,211,75,17,15,103,191,214,203,237,55,247,110,239,19,217,82,198,118,206,21,244,10,95,130,43,134,66,125,193,225,102,89,65,63,77,
+136,248,193,224,178,199,116,125,205,68,100,206,244,102,204,220,125,199,180,160,192,196,196,70,208,224,77,136,232,210,56,217,83,248,176,82,112,110,205,128,
+26,197,184,66,3,244,156,142,92,235,152,53,34,32,14,157,81,63,75,232,197,160,164,54,203,241,203,199,57,102,233,41,255,226,85,255,241,48,255,255,
+250,109,255,255,40,255,255,237,253,254,48,122,168,66,114,222,187,96,87,207,7,4,67,121,195,178,25,71,156,17,183,236,21,21,202,1,242,92,25,129,
+105,51,68,211,69,39,95,75,136,100,163,20,60,205,121,252,199,113,127,64,88,215,198,244,29,205,108,149,146,69,43,149,5,148,149,125,194,147,173,181,
+144,37,112,11,109,0,6,108,116,129,196,29,193,192,163,195,201,13,196,25,77,66,209,93,64,65,60,194,244,240,69,164,213,227,65,255,171,39,255,171,
+39,255,219,15,255,255,201,183,255,65,75,134,126,192,255,214,131,232,171,225,53,31,179,122,173,165,40,120,31,100,19,198,75,15,29,100,169,79,113,103,
+91,127,2,83,20,161,186,66,52,120,127,245,220,145,91,9,75,21,86,36,2,128,16,59,38,69,215,12,227,59,7,208,201,21,145,56,27,146,150,25,
+211,54,18,147,32,7,210,110,3,33,80,11,96,10,14,1,37,9,130,1,2,210,89,22,210,9,48,145,21,77,112,120,105,178,118,128,10,73,2,143,
+251,126,127,254,94,159,194,119,255,255,255,235,43,255,249,117,109,113,255,161,111,255,154,151,254,31,191,223,219,204,39,101,128,12,51,188,133,172,163,189,
+166,11,251,11,87,135,16,136,222,203,185,105,212,168,154,65,224,22,203,36,34,18,132,33,148,196,6,210,236,64,206,92,119,72,140,153,194,204,157,193,
+208,128,196,128,66,68,200,19,130,192,117,129,76,213,6,181,35,12,133,82,17,221,88,21,165,46,151,44,216,149,244,90,145,196,62,202,228,226,66,5,
+125,72,41,244,210,73,141,127,198,235,255,252,212,63,142,191,255,255,255,203,79,255,243,88,50,223,171,15,244,208,252,128,126,81,219,140,228,224,81,168,
+104,232,2,147,24,1,181,122,224,9,68,33,234,11,195,52,33,83,112,60,242,162,70,81,4,63,17,23,42,243,81,14,149,79,16,166,197,45,167,121,
+67,231,83,80,38,89,81,36,177,70,98,139,49,96,51,21,2,4,10,211,220,42,181,18,70,53,136,90,149,52,101,116,40,102,18,152,93,80,196,76,
+145,13,54,178,147,30,83,99,16,145,245,253,234,191,255,167,103,146,79,255,255,250,236,242,0,254,64,95,197,111,212,242,29,38,215,160,246,79,252,173,
+177,125,216,10,66,245,112,27,116,192,82,194,107,141,147,191,207,2,78,115,164,155,204,119,37,214,223,145,47,57,38,177,2,169,103,198,89,34,50,159,
+162,160,199,166,84,208,104,160,189,41,128,148,233,16,96,39,156,41,37,120,6,131,12,40,128,176,54,193,66,48,66,154,22,67,54,18,163,30,66,226,
+118,112,225,138,148,160,142,164,160,20,151,32,106,27,255,12,207,255,201,147,132,135,255,255,254,162,190,101,63,255,240,224,255,254,2,127,242,108,223,109,
+35,251,145,121,121,253,82,189,18,253,243,185,39,243,214,177,253,231,16,77,101,11,176,101,91,17,130,223,242,8,174,157,12,53,116,128,217,143,53,248,
+106,40,168,131,155,89,24,143,217,76,135,25,34,129,168,175,128,208,20,128,224,143,0,169,24,2,233,107,4,201,112,5,137,33,4,168,130,1,216,94,
+130,145,99,136,66,108,142,115,85,148,35,249,152,116,30,77,57,255,205,201,115,123,130,127,254,248,31,176,135,255,255,255,230,27,142,47,255,243,88,255,
+254,13,63,251,117,124,254,114,196,116,10,49,240,228,202,151,136,133,159,242,230,127,25,234,19,106,251,7,208,241,18,16,65,143,48,205,131,240,225,139,
+56,173,154,56,88,165,232,1,172,152,70,45,40,112,39,248,121,29,232,101,16,200,56,2,136,1,10,144,57,148,224,108,154,176,141,155,96,154,150,176,
+144,141,96,113,128,176,70,141,104,21,155,24,25,38,152,67,46,40,96,48,200,112,45,56,120,46,223,46,175,255,211,227,245,88,255,255,255,130,127,228,
+27,255,204,219,245,231,210,153,122,39,63,162,53,11,110,168,101,108,120,184,66,227,58,134,99,177,164,50,107,253,20,89,237,65,214,17,141,206,153,74,
+6,35,134,54,65,162,186,142,224,40,190,162,96,209,99,224,201,36,184,172,37,12,129,228,248,81,228,156,36,164,32,0,35,132,23,194,212,32,2,36,
+25,193,84,8,64,104,17,32,146,45,97,170,69,226,214,85,228,2,90,37,14,80,101,234,53,166,142,33,249,115,127,249,146,127,212,195,255,255,62,95,
+255,249,178,255,255,147,103,180,175,27,63,236,105,254,58,127,229,33,248,126,252,180,54,151,203,192,106,199,202,106,16,51,198,146,167,185,159,91,127,29,
+43,57,218,202,157,114,224,151,123,133,67,92,233,155,140,61,148,148,57,206,148,126,73,140,147,197,92,133,193,244,94,192,192,44,66,184,8,3,224,52,
+132,56,82,131,184,94,130,72,90,0,0,72,131,36,47,6,220,22,11,12,4,143,84,0,147,100,15,150,212,51,25,116,110,154,52,216,153,59,255,138,
+119,255,227,105,255,255,140,191,255,255,233,95,255,255,245,214,255,167,104,77,126,5,159,215,87,253,94,63,132,111,234,77,229,87,223,194,228,55,142,34,
+245,26,76,32,183,117,163,121,115,36,103,88,36,87,50,35,203,11,67,17,23,18,77,49,17,141,65,112,213,72,16,41,69,240,114,60,144,250,46,113,
+98,29,113,158,11,241,166,4,1,110,17,96,238,27,32,46,32,224,205,35,97,251,35,35,61,33,4,123,30,165,159,29,6,131,28,231,25,31,167,79,
+37,102,231,33,1,180,255,227,201,255,249,209,127,255,194,199,255,255,181,159,255,238,181,240,219,36,126,33,156,22,121,66,88,126,205,2,122,135,205,232,
+43,178,60,53,185,3,25,171,223,15,250,57,3,168,107,8,113,75,146,178,196,154,195,234,161,4,90,210,242,72,106,97,38,149,140,143,186,230,68,5,
+123,30,221,122,152,229,110,146,197,84,140,253,44,7,244,245,4,20,176,129,108,99,128,12,17,0,40,64,64,132,137,65,212,194,195,116,231,69,12,242,
+70,92,223,199,28,167,75,141,150,63,223,243,255,241,160,255,194,31,255,255,245,81,254,71,31,128,135,252,255,127,216,195,230,23,196,144,29,160,39,196,
+123,118,31,33,238,97,190,62,92,50,122,158,104,75,181,229,194,239,217,37,184,202,51,233,213,27,24,40,136,185,190,129,194,158,133,34,208,130,162,114,
+131,89,174,139,56,167,147,120,118,26,201,136,32,90,108,35,203,13,37,11,91,35,251,76,32,234,231,28,154,61,23,201,107,19,168,141,16,152,63,143,
+24,225,143,57,70,144,217,94,147,217,37,151,56,147,156,123,146,126,46,223,255,214,187,149,79,255,255,255,218,15,250,133,127,220,187,255,247,145,255,251,
+101,127,206,87,240,190,198,13,151,165,157,4,220,36,157,142,120,65,202,128,11,108,94,114,48,124,122,8,73,70,116,18,229,140,116,132,90,50,10,102,
+140,197,160,136,127,228,34,67,166,234,22,167,190,4,198,206,16,68,122,12,1,46,4,98,128,29,166,24,60,233,48,94,235,108,126,236,120,153,44,72,
+171,234,232,180,40,124,177,37,100,165,34,32,146,32,226,122,35,66,95,228,182,65,229,50,62,184,248,127,242,4,255,219,211,255,250,47,255,255,252,22,
+127,255,180,52,192,255,169,47,255,98,47,254,65,127,248,156,126,252,127,49,140,211,234,252,110,4,31,77,39,7,171,83,2,197,232,163,207,192,78,133,
+197,14,23,21,127,161,78,208,210,11,96,137,14,166,148,70,76,217,212,198,49,72,192,88,185,67,188,58,69,148,37,133,52,94,2,228,110,0,176,87,
+5,8,27,137,160,59,77,168,161,80,225,13,210,193,112,83,49,191,210,17,238,207,113,247,203,201,219,71,177,156,67,185,56,65,60,175,126,128,223,255,
+187,81,88,127,255,255,20,31,98,191,255,101,111,239,43,84,238,221,159,136,191,247,150,254,20,255,195,219,224,243,235,81,161,206,91,136,78,166,139,48,
+86,49,134,94,216,161,48,171,61,36,57,73,18,56,184,128,10,115,143,83,182,154,84,53,80,74,35,232,153,6,212,12,111,19,118,79,146,174,45,113,
+222,13,177,42,11,0,170,26,64,100,30,160,86,24,64,128,7,192,214,16,17,76,44,209,220,75,50,114,103,51,2,125,147,122,133,153,229,67,92,251,
+32,22,101,64,171,255,144,119,255,234,109,255,243,229,255,255,249,54,255,233,236,217,94,171,62,196,24,168,158,22,57,219,52,249,220,118,221,245,192,231,
+27,219,211,49,125,59,35,211,49,2,97,49,98,140,37,180,202,85,148,212,100,243,92,92,177,14,69,17,123,37,83,205,3,53,149,28,102,171,55,7,
+3,73,230,165,84,69,179,85,132,91,78,194,211,65,1,89,47,160,45,28,224,140,11,32,186,3,80,94,13,80,121,17,145,179,15,83,41,6,212,177,
+7,230,29,26,231,61,49,231,173,78,202,126,127,254,164,95,240,230,255,255,255,165,159,253,239,127,255,223,171,255,155,31,198,48,132,101,231,168,68,255,
+104,40,80,4,47,115,169,229,235,53,122,189,137,46,83,150,37,8,106,189,2,183,116,69,210,24,22,18,19,7,228,193,20,37,239,17,101,207,4,228,
+173,13,114,213,32,240,167,50,177,154,64,243,166,73,181,62,77,22,70,75,22,152,68,54,60,58,117,70,47,19,214,36,114,50,28,112,138,24,48,233,
+24,49,249,28,18,137,35,82,129,45,17,217,55,176,131,67,118,92,249,9,127,255,114,230,191,255,255,255,252,69,253,149,191,252,56,63,255,165,63,255,
+199,155,252,116,253,121,32,18,24,119,74,147,126,24,76,75,25,161,202,19,72,60,42,221,16,34,139,81,201,99,206,202,78,112,204,135,122,160,54,152,
+220,36,136,164,148,89,175,135,250,51,128,10,52,131,129,196,131,49,2,128,40,16,133,232,241,13,9,222,20,170,154,27,235,19,34,91,62,39,11,17,
+41,106,152,41,137,226,39,121,12,35,232,54,31,72,133,154,41,13,148,233,84,143,121,74,144,237,175,63,242,126,255,241,226,255,249,37,255,255,255,55,
+159,255,215,146,8,95,245,195,255,247,96,255,232,131,255,99,105,127,142,207,158,5,1,220,98,17,75,107,113,232,8,213,241,80,224,112,28,164,92,98,
+6,58,184,13,246,223,17,67,109,169,2,173,244,98,208,42,4,36,52,195,224,148,125,34,58,58,35,214,3,100,42,34,3,74,52,1,126,50,0,228,
+30,67,136,4,102,8,49,168,32,99,169,140,149,42,40,192,41,228,222,232,196,238,38,240,235,36,176,215,98,88,181,160,80,133,33,226,85,126,180,159,
+255,160,166,191,223,255,255,151,191,248,33,255,254,13,31,198,4,0,126,145,223,207,31,253,138,63,155,15,240,126,245,193,241,128,187,45,122,2,16,73,
+161,212,165,115,68,110,56,209,46,234,246,28,200,192,8,41,85,138,3,2,151,148,16,79,226,41,232,197,20,20,62,129,249,221,52,121,123,35,201,14,
+18,168,173,3,184,103,7,96,61,13,160,51,14,112,67,10,48,101,1,160,147,10,8,199,23,136,251,37,41,43,49,73,80,58,57,101,62,169,102,61,
+201,88,54,56,236,6,207,252,89,191,255,144,151,254,203,127,255,255,165,223,249,36,114,192,251,156,251,17,77,21,66,249,104,118,83,248,227,121,121,251,
+247,116,27,236,125,139,126,86,142,167,7,128,42,13,228,130,61,85,240,96,21,50,100,83,28,84,48,106,56,114,79,23,116,165,9,70,85,38,167,65,
+61,231,103,77,166,219,85,69,193,84,196,83,77,34,193,63,225,83,47,224,59,30,224,104,14,128,140,0,128,50,10,16,141,16,145,157,17,210,207,14,
+116,1,6,21,5,5,165,181,21,69,191,37,169,205,127,253,36,63,248,15,127,255,255,114,223,255,85,159,255,245,114,255,155,63,3,41,87,99,215,182,
+196,135,223,97,249,159,87,76,44,48,248,243,102,91,196,3,21,157,33,170,223,103,168,134,193,97,75,76,16,147,195,252,39,206,28,0,146,156,10,82,
+124,51,78,228,105,73,4,158,66,4,200,69,24,226,75,112,234,80,88,225,211,80,203,212,48,173,82,216,139,79,176,108,203,40,86,197,240,76,192,184,
+80,195,244,95,199,132,118,201,180,144,74,36,169,200,212,187,69,100,196,78,195,214,131,255,250,40,93,219,255,255,255,243,117,198,243,255,233,205,255,252,
+173,255,251,62,126,89,251,148,33,180,117,117,32,171,238,49,74,106,237,201,180,76,244,120,140,94,20,149,181,198,194,235,248,57,92,254,184,149,243,147,
+84,255,219,202,55,103,168,239,226,192,175,32,134,120,98,70,75,34,170,39,226,22,12,160,230,6,128,124,19,1,204,24,2,196,23,131,40,17,66,252,
+6,130,48,6,224,228,22,96,170,38,98,78,53,99,190,65,228,206,74,37,70,77,165,18,73,228,18,86,52,90,255,148,7,255,202,11,255,101,31,255,
+255,250,40,255,252,171,57,125,127,242,249,255,249,206,127,240,241,255,92,47,109,29,253,3,108,179,240,194,161,126,125,19,81,187,82,254,191,192,39,1,
+242,228,51,76,112,38,251,65,235,113,212,91,11,26,120,98,51,63,140,18,228,229,104,120,80,80,93,175,162,162,161,13,2,113,135,174,74,130,238,41,
+128,248,14,67,232,9,229,224,33,38,220,55,166,240,77,230,68,98,165,8,116,227,92,129,161,140,136,160,50,135,97,166,126,162,162,109,98,214,91,99,
+191,222,211,255,237,205,240,202,255,255,249,79,255,240,133,255,253,79,190,202,184,97,255,61,47,246,199,255,161,103,245,21,253,177,60,110,122,4,68,237,
+232,26,25,17,107,109,18,123,70,69,102,111,13,222,205,134,202,25,0,188,146,167,157,17,246,174,164,124,55,173,135,37,139,221,204,146,241,243,72,178,
+220,178,40,167,28,72,228,193,129,194,91,1,24,83,248,126,76,168,1,5,64,99,130,20,167,8,244,203,143,28,214,148,84,203,152,60,177,154,140,142,
+153,196,107,24,116,51,19,188,3,143,212,48,62,173,159,255,103,169,115,127,255,254,96,127,225,123,255,254,224,95,250,23,226,61,237,61,253,113,127,229,
+85,253,208,127,136,151,155,15,67,40,138,186,82,221,18,28,109,141,93,181,128,4,65,145,113,46,93,250,16,240,56,141,59,69,65,124,203,21,212,62,
+198,221,68,200,98,14,42,185,41,87,158,153,172,35,36,115,0,199,223,103,4,195,67,1,121,27,129,136,10,243,242,44,117,134,69,246,34,85,53,190,
+88,244,110,81,242,132,68,16,100,50,241,159,32,83,77,14,84,117,2,4,229,18,131,253,202,51,255,190,119,255,148,55,255,255,239,183,255,245,155,255,
+253,240,62,165,109,51,214,155,81,89,26,88,139,131,79,204,99,230,95,250,103,125,20,254,234,94,79,254,65,218,124,231,121,19,152,45,12,56,130,16,
+145,84,148,65,218,136,209,150,136,200,255,152,232,114,162,168,32,164,24,24,157,216,73,145,232,157,131,24,244,139,209,58,152,81,93,160,177,82,163,65,
+22,160,0,189,152,96,93,141,160,7,129,96,55,10,184,85,21,120,84,29,168,52,34,72,6,162,216,75,159,200,142,153,8,173,154,43,255,127,175,183,
+255,177,71,226,43,255,255,255,11,127,106,111,254,162,95,255,195,247,255,204,75,246,17,212,242,91,217,200,246,206,214,119,97,166,75,70,41,121,77,167,
+113,173,85,122,71,113,35,232,29,191,254,232,89,199,224,41,91,152,80,64,188,145,14,220,156,194,5,94,70,41,187,202,137,199,76,9,148,75,113,53,
+73,128,194,71,32,81,196,248,12,3,40,82,129,152,123,128,56,136,129,36,124,130,156,90,3,244,39,133,76,18,198,132,75,199,148,124,72,76,159,200,
+108,177,199,236,175,70,60,139,192,227,203,75,255,252,1,43,121,255,255,255,199,156,175,127,238,125,250,204,207,107,130,23,146,31,187,119,7,220,97,13,
+18,20,252,90,56,54,249,40,115,111,238,173,170,222,171,83,37,136,16,76,148,156,5,39,103,94,172,105,112,172,209,47,8,204,245,235,241,134,108,114,
+168,142,165,78,138,27,132,250,84,99,64,163,233,156,209,109,204,221,111,156,202,47,0,157,172,104,100,40,156,43,100,72,5,128,22,41,132,6,61,71,
+62,66,9,122,56,74,138,34,10,74,4,73,6,25,39,2,45,36,210,78,59,33,127,240,88,255,203,107,255,249,210,255,255,253,31,255,255,225,161,140,
+223,242,189,255,230,57,255,154,159,250,159,124,40,121,54,37,57,34,68,104,137,90,217,21,139,6,183,84,199,212,115,58,190,1,218,235,236,13,156,46,
+8,22,71,132,243,223,133,128,148,179,10,75,79,38,28,151,21,155,166,3,180,26,182,156,182,39,79,4,103,119,81,131,9,29,65,14,18,116,104,57,
+150,186,85,87,218,100,23,186,100,214,106,89,20,64,70,17,186,48,112,203,27,19,1,7,244,181,7,229,185,19,69,235,28,165,131,110,207,239,121,255,
+254,52,95,251,117,255,255,254,194,255,213,179,204,3,241,97,233,125,0,14,212,255,170,247,237,103,253,40,190,251,63,95,46,146,188,112,164,39,28,129,
+86,20,69,8,12,83,22,20,33,221,80,71,135,133,69,16,101,253,110,217,163,91,254,46,20,189,98,104,121,145,162,53,141,168,20,40,122,25,59,171,
+162,66,214,34,80,179,139,83,186,193,97,85,89,8,183,78,160,30,195,144,97,6,228,188,143,204,237,150,84,240,25,204,198,25,236,121,23,36,29,18,
+76,59,204,60,122,71,212,2,190,15,159,254,191,95,72,143,255,255,248,126,255,191,79,255,255,83,143,255,196,55,238,253,5,78,248,255,78,175,36,94,
+171,81,109,66,42,136,84,103,132,86,118,60,126,178,141,212,178,175,181,202,121,182,138,47,177,56,10,49,167,6,210,101,26,241,173,57,240,45,88,49,
+120,109,18,198,114,85,130,33,67,201,82,83,234,120,84,255,162,189,25,232,191,53,217,248,200,90,101,144,206,146,4,15,130,185,13,160,90,67,136,15,
+48,72,6,124,59,227,129,43,137,163,211,194,168,215,105,188,126,61,24,245,232,69,159,198,197,149,210,253,11,223,251,160,158,53,248,76,218,106,158,190,
+154,16,5,101,85,141,204,244,184,35,87,189,128,46,62,233,97,100,232,55,220,104,134,252,133,242,31,72,23,41,8,126,37,135,79,60,176,25,202,20,
+140,50,226,67,101,48,56,248,232,72,16,28,240,146,0,70,42,17,197,153,116,199,168,191,63,122,111,209,14,151,148,7,160,164,215,38,43,38,168,250,
+69,146,28,208,127,129,4,4,0,104,2,48,3,65,134,27,209,130,146,124,204,232,129,85,91,68,94,227,15,44,136,115,61,209,11,86,252,101,57,194,
+191,232,138,254,162,47,224,247,219,227,83,167,197,134,186,141,111,240,4,191,214,83,211,134,171,92,219,164,144,62,172,82,198,173,177,192,90,56,89,134,
+37,135,73,49,23,129,59,218,163,40,154,36,68,142,33,188,81,53,30,65,239,1,192,89,192,201,204,124,108,208,149,36,68,107,106,11,54,42,118,81,
+178,138,84,197,154,197,32,36,83,60,72,121,203,18,2,1,182,133,152,53,225,170,6,24,51,1,242,20,49,58,145,196,166,104,139,71,219,80,90,255,
+17,60,73,243,98,205,139,84,221,87,169,8,255,36,39,252,9,154,2,126,71,210,238,90,231,197,82,169,206,179,246,27,104,137,15,100,42,101,35,3,
+17,43,213,44,29,103,124,44,193,249,146,58,59,58,186,166,130,95,128,176,108,10,73,40,181,200,242,147,226,24,106,6,226,59,34,32,84,192,244,6,
+97,99,193,222,167,209,45,182,12,108,46,125,32,11,97,72,110,176,209,253,158,212,108,164,27,21,88,53,68,42,25,128,246,139,32,77,226,114,29,216,
+30,139,182,48,116,101,158,197,141,109,19,129,222,41,249,35,231,181,161,14,183,147,246,249,166,191,248,239,53,28,127,158,46,36,10,180,121,78,71,165,
+184,140,250,114,142,196,130,46,248,103,76,4,141,212,174,11,209,83,205,250,95,36,187,141,244,167,26,8,138,124,162,232,156,130,69,104,143,164,90,97,
+196,88,133,232,125,112,2,150,184,75,83,25,31,204,27,201,173,31,90,128,207,66,146,84,252,157,85,91,228,235,83,88,147,209,206,0,195,85,134,232,
+134,34,112,16,168,132,129,170,8,192,101,136,116,67,229,199,38,90,141,81,62,240,182,161,199,179,18,29,4,179,110,216,95,53,206,172,207,251,209,62,
+255,239,116,111,116,60,118,221,150,48,206,176,247,120,107,92,184,55,98,72,196,122,231,167,169,170,120,33,137,214,101,51,0,35,128,125,180,207,145,181,
+77,53,47,68,153,83,51,67,165,37,3,145,32,206,83,210,227,13,100,89,65,145,1,76,0,165,129,20,202,90,72,246,187,114,210,177,12,195,171,55,
+47,90,61,202,82,96,82,4,139,180,91,160,51,15,120,107,3,34,37,32,252,134,24,105,32,207,44,89,31,81,102,146,246,73,185,190,13,152,240,229,
+21,161,254,141,154,94,205,173,252,67,223,251,153,184,238,127,7,190,51,174,245,248,142,98,189,194,66,178,248,230,225,17,0,220,164,239,92,140,222,138,
+166,19,217,88,37,219,61,15,25,90,83,221,40,206,145,74,94,169,129,162,166,147,169,224,16,209,43,249,157,70,198,60,64,164,132,104,21,113,58,146,
+196,192,103,57,65,250,46,82,50,146,20,91,161,252,235,39,9,42,217,68,70,86,47,48,156,132,148,3,64,5,3,208,7,0,150,15,49,34,140,252,
+172,102,173,75,122,189,220,34,252,56,183,228,149,157,30,140,123,13,215,223,241,146,127,227,150,212,21,250,16,104,237,74,23,181,190,25,206,72,51,71,
+198,51,44,136,25,163,211,44,241,171,199,172,151,128,151,78,64,10,203,236,134,17,138,48,247,152,22,26,69,88,164,41,18,64,70,100,219,8,167,142,
+184,252,64,254,44,176,67,37,120,38,136,21,76,242,84,243,162,163,164,233,234,221,53,218,201,75,102,158,146,59,158,36,101,164,163,15,184,118,194,22,
+4,224,81,133,152,29,225,42,16,152,34,200,42,58,83,123,159,61,83,236,169,118,76,55,49,144,204,243,56,109,66,115,191,195,221,255,34,39,249,154,
+189,34,190,1,115,3,100,187,211,186,73,46,98,244,79,100,155,15,91,89,81,190,45,67,51,167,144,103,202,232,122,178,95,169,242,65,22,10,132,10,
+98,90,77,213,228,204,66,162,193,202,16,83,60,41,12,14,22,7,98,220,137,214,117,132,77,136,225,67,162,247,79,201,211,209,90,163,211,86,173,244,
+140,235,17,18,58,73,193,102,99,48,22,11,252,11,192,71,0,232,87,130,174,25,33,163,128,120,187,34,253,71,105,222,88,218,204,88,14,98,71,144,
+62,117,89,224,234,249,111,159,25,167,255,13,87,167,171,250,50,215,138,125,62,61,23,8,198,199,150,116,161,26,22,85,153,88,41,232,146,86,73,34,
+176,23,249,182,203,162,130,202,48,200,19,169,174,115,149,179,76,134,182,209,109,84,241,43,242,52,197,75,45,89,54,131,72,64,128,242,75,44,144,113,
+38,47,108,49,44,81,41,186,190,80,30,135,116,214,149,141,61,226,81,71,72,12,13,158,26,66,13,135,200,50,161,46,0,240,35,65,16,50,144,75,
+153,196,106,42,41,59,235,129,217,95,14,252,71,50,193,206,159,71,45,75,163,124,251,86,63,248,2,128,139,253,196,184,28,181,212,230,139,46,222,80,
+247,231,173,86,198,148,54,89,239,7,212,105,49,15,20,246,10,227,226,64,137,4,180,56,210,100,72,177,41,212,211,81,154,78,196,255,105,119,25,9,
+15,98,85,24,96,103,66,202,15,64,28,225,86,51,88,63,84,146,51,182,6,149,53,121,38,225,79,185,235,206,86,122,17,253,155,28,32,37,85,9,
+192,227,196,124,30,16,248,3,92,12,192,225,18,56,140,203,186,77,213,9,162,229,209,109,123,139,126,42,57,176,103,87,171,22,109,92,3,159,230,136,
+255,74,183,138,255,237,5,220,193,236,193,64,140,161,120,193,74,167,75,10,202,200,103,16,251,102,34,77,159,17,116,181,138,3,182,160,5,8,79,21,
+18,180,167,147,107,70,161,61,84,47,82,196,61,34,22,70,55,48,209,26,70,222,36,176,129,128,72,31,209,250,148,12,231,38,249,74,89,251,211,226,
+128,116,159,157,108,239,230,29,40,249,33,69,54,45,208,56,133,212,30,64,151,9,144,33,192,96,24,17,8,142,100,173,102,193,76,250,177,92,142,245,
+88,190,228,3,156,214,130,58,248,220,31,232,154,255,187,203,197,245,249,142,245,5,212,165,242,207,194,145,185,93,223,109,61,162,204,78,174,115,32,56,
+189,143,31,21,209,249,108,238,31,30,12,129,197,94,176,189,234,195,34,158,150,210,103,232,16,167,50,89,164,158,134,202,129,128,101,202,66,2,112,241,
+132,58,33,114,13,154,228,178,233,195,51,234,197,205,134,172,115,60,164,116,181,102,161,35,120,247,198,14,21,80,222,130,16,27,225,88,5,184,57,2,
+226,14,145,155,143,164,193,39,227,77,251,31,220,31,10,172,82,242,245,205,147,77,77,86,34,248,254,125,15,250,30,159,203,247,91,138,53,110,190,50,
+25,48,59,108,206,249,128,253,34,40,195,100,8,115,8,62,59,164,171,10,130,98,161,17,93,228,62,12,70,136,12,192,96,211,74,175,161,142,142,130,
+63,70,18,71,224,84,8,94,0,166,205,162,13,154,208,196,224,60,55,169,95,205,194,156,83,26,176,204,165,44,171,32,58,209,86,12,77,14,98,79,
+39,232,110,67,74,22,48,121,5,196,73,194,3,16,192,204,64,92,80,81,164,158,100,251,234,231,104,203,175,226,109,139,86,116,217,164,234,225,151,30,
+229,47,252,64,95,183,83,229,29,228,113,44,38,164,156,117,34,114,232,55,124,214,221,148,184,79,198,19,130,81,129,36,213,5,58,89,179,149,151,217,
+59,2,214,45,166,89,69,242,204,38,180,25,186,147,156,60,185,244,143,116,61,35,144,0,172,183,162,174,156,225,26,97,238,80,200,216,211,114,125,52,
+28,171,84,194,44,23,29,234,228,195,98,151,112,43,153,4,9,2,213,1,224,2,128,238,28,128,234,135,232,122,224,108,50,248,184,210,162,121,150,85,
+180,70,5,56,174,100,11,159,94,118,90,193,84,191,226,210,255,232,76,207,109,252,209,160,192,137,191,125,75,52,102,21,198,114,89,13,97,176,100,98,
+15,129,74,15,118,49,1,37,90,11,100,103,116,50,208,173,71,21,48,36,92,20,141,66,29,74,243,200,38,130,106,196,38,75,134,83,178,92,6,208,
+110,225,123,143,192,249,224,128,84,104,199,214,114,101,85,30,162,133,4,41,183,43,42,98,69,58,131,16,38,151,196,35,3,79,11,208,63,65,180,6,
+160,93,130,16,102,96,229,51,24,246,212,30,130,182,249,181,126,30,56,180,101,159,158,246,146,218,76,84,133,251,34,191,246,59,99,213,253,168,249,80,
+58,35,106,115,102,46,34,183,133,177,206,173,84,131,92,151,38,164,236,243,229,40,94,94,130,17,70,216,244,104,139,166,2,136,146,136,72,160,167,176,
+137,138,73,72,70,32,64,114,98,229,20,64,112,226,144,11,208,0,32,147,36,136,222,207,246,91,212,235,157,37,67,232,11,72,121,252,206,22,113,114,
+67,150,164,64,163,233,0,24,138,194,44,13,112,139,1,60,2,96,229,18,248,173,203,78,91,244,213,167,37,194,238,133,138,30,55,89,165,103,223,171,
+214,59,125,96,223,240,89,127,86,183,217,207,228,217,208,97,241,217,147,171,9,237,43,42,105,155,133,83,165,13,129,37,162,144,235,209,252,207,59,98,
+6,3,99,210,24,40,234,135,226,77,106,10,161,18,170,9,185,148,168,43,218,83,228,55,60,240,189,136,144,25,80,142,0,124,50,145,72,156,172,159,
+41,159,53,202,158,207,86,158,211,216,161,100,219,102,33,43,8,236,199,50,23,144,240,128,160,19,160,222,1,8,29,129,98,17,241,54,143,84,169,103,
+131,72,234,247,219,39,4,108,72,242,140,205,79,71,237,117,40,5,249,172,191,238,192,220,105,252,43,242,16,177,75,227,59,160,227,165,52,87,179,154,
+193,214,103,150,49,141,52,54,132,223,130,168,171,53,192,9,55,1,145,17,47,66,97,149,91,209,147,73,197,61,19,166,40,250,70,132,228,196,28,137,
+216,25,203,190,10,137,23,133,126,39,113,222,159,188,140,107,141,38,11,69,73,206,200,82,119,169,12,150,167,11,33,72,227,198,202,7,81,75,134,248,
+64,98,160,14,232,123,4,190,5,49,228,143,100,199,40,81,76,219,82,219,99,18,188,68,115,119,204,175,85,13,58,109,8,255,47,119,250,165,49,39,
+253,117,41,68,166,143,166,238,48,143,13,220,4,90,113,193,233,3,9,143,66,66,40,146,122,30,48,199,81,101,25,138,182,67,214,94,104,173,43,132,
+157,201,74,212,78,145,80,72,220,180,9,15,136,189,13,128,73,89,212,75,51,70,25,180,5,38,219,48,233,153,213,38,86,150,138,144,213,174,163,33,
+94,72,154,209,50,31,210,102,134,252,37,225,185,12,160,128,197,240,43,113,82,15,116,14,197,143,26,137,252,208,110,177,22,212,187,6,50,56,173,104,
+3,153,110,185,56,227,246,116,127,235,132,248,207,190,197,93,69,37,10,224,229,169,228,132,252,155,240,158,113,9,193,37,113,105,223,17,42,38,67,3,
+18,25,161,139,96,121,164,97,79,158,160,194,7,74,77,34,34,153,170,62,40,73,164,154,87,132,108,197,58,125,224,73,147,136,18,241,92,9,100,130,
+98,219,76,56,204,217,178,59,150,200,146,189,122,101,185,68,89,150,73,86,101,48,129,150,76,53,68,47,22,128,156,196,156,16,144,56,2,84,79,161,
+121,48,248,249,84,58,124,151,9,179,78,29,88,146,101,75,157,62,136,122,91,72,25,247,205,127,241,183,51,183,248,56,102,94,201,171,157,213,71,117,
+237,215,210,26,205,33,49,48,100,95,142,194,52,247,1,1,221,50,141,182,73,164,182,140,36,162,10,5,73,251,163,170,151,2,73,168,206,162,190,130,
+145,213,77,202,75,82,152,8,52,99,0,43,133,192,113,163,77,44,41,214,76,234,162,51,78,173,36,203,42,161,47,26,31,74,118,88,82,46,137,156,
+107,32,56,18,184,115,130,254,31,96,139,130,136,48,97,243,24,57,97,203,110,156,20,188,184,237,193,177,68,197,247,50,252,239,181,49,202,135,127,55,
+249,85,191,224,82,246,189,252,105,185,232,188,206,44,17,144,78,250,86,71,189,134,113,51,158,89,235,39,20,225,179,147,33,174,50,99,232,57,178,75,
+165,212,88,172,180,171,162,25,93,97,67,172,166,242,125,116,25,78,198,86,3,1,138,172,126,96,104,12,80,86,97,167,42,105,98,206,50,130,116,11,
+165,85,7,233,49,61,9,253,204,186,96,82,84,143,76,89,161,203,9,24,17,192,18,6,192,28,0,96,18,97,89,20,8,247,202,254,117,180,172,174,
+21,184,48,3,196,167,36,12,208,116,47,214,182,189,127,53,199,253,108,30,245,239,225,91,200,211,75,87,200,166,240,13,97,176,131,183,6,88,180,111,
+155,109,176,42,250,123,60,206,73,163,164,96,66,211,3,60,50,16,106,97,25,45,123,98,123,176,5,37,162,186,133,47,72,92,179,5,223,43,112,121,
+201,14,21,73,116,142,10,23,68,134,141,21,41,231,77,67,106,125,205,214,175,50,151,168,244,115,104,7,19,137,62,195,66,30,48,146,130,48,34,33,
+214,11,200,102,132,218,4,146,5,142,108,207,39,239,77,219,52,91,75,14,12,62,51,32,204,39,78,237,75,165,130,254,58,143,249,45,131,73,251,146,
+199,40,148,127,60,109,2,29,187,100,192,178,173,148,103,149,100,88,80,193,190,26,54,129,5,150,103,129,145,82,148,179,233,193,36,28,136,178,177,38,
+126,92,152,143,171,55,14,49,55,177,183,156,252,112,66,183,26,136,85,165,62,69,184,167,151,214,18,22,32,148,189,82,232,129,62,186,157,201,142,171,
+177,8,165,44,9,38,107,3,48,192,64,120,0,64,72,135,168,61,34,48,29,72,35,11,106,47,52,16,159,13,98,237,59,116,124,86,177,45,207,27,
+47,221,102,179,9,224,190,255,177,123,246,14,120,81,125,49,240,101,106,63,211,150,169,174,232,88,130,54,54,145,114,30,210,218,129,72,162,168,152,25,
+2,187,26,184,188,169,63,27,237,63,100,55,211,68,75,173,18,229,19,205,48,163,33,17,146,201,21,241,232,131,212,59,32,180,129,10,29,227,151,130,
+49,116,161,107,106,25,3,88,130,105,244,199,161,188,194,41,21,20,202,26,192,68,104,48,201,15,20,53,1,15,5,80,51,2,82,20,1,207,128,12,
+207,35,31,75,249,241,217,110,212,88,8,226,227,142,150,126,25,179,106,221,99,79,148,195,255,142,219,66,199,228,141,156,52,14,252,204,174,173,115,30,
+202,86,200,111,227,129,170,224,51,231,30,196,32,73,58,4,116,84,5,96,152,97,139,211,28,68,241,42,84,177,82,69,74,61,30,228,62,209,81,53,
+26,3,68,44,48,160,132,134,196,7,80,55,130,222,74,49,142,163,180,139,235,97,43,202,197,214,153,197,67,231,1,59,73,187,200,126,98,208,164,147,
+84,27,67,19,13,192,85,194,156,4,16,31,129,20,88,161,169,48,41,31,211,102,138,150,198,182,198,22,152,188,229,19,158,166,135,26,27,76,5,251,
+69,191,247,68,100,183,251,239,96,44,198,123,163,172,203,184,75,101,91,33,126,56,247,50,96,185,132,194,11,213,247,9,88,210,144,225,18,234,176,99,
+80,92,108,176,43,39,31,173,67,164,92,145,208,70,124,238,168,64,21,16,205,131,63,30,136,88,2,80,6,24,145,199,242,91,179,74,159,133,10,40,
+201,71,218,38,209,18,121,115,147,152,36,164,36,55,23,88,154,193,234,15,16,43,0,84,20,192,17,1,120,71,68,86,52,50,153,153,213,33,170,129,
+107,59,196,225,223,142,246,96,153,247,106,73,139,71,26,103,251,211,191,206,229,248,226,122,200,234,106,240,222,178,238,53,60,56,168,23,148,38,3,144,
+84,76,118,241,104,91,226,168,32,187,232,151,8,177,138,30,16,37,128,200,247,24,120,148,1,113,3,93,167,70,128,25,239,144,72,32,129,217,130,0,
+87,160,151,75,8,78,80,51,152,156,179,230,157,75,41,161,214,174,97,245,176,150,77,53,164,243,55,41,8,199,126,50,144,116,136,180,35,129,105,15,
+32,68,66,104,22,240,108,139,44,129,37,63,64,138,45,217,34,207,152,72,225,171,149,110,98,186,58,235,47,59,143,173,11,254,250,47,33,39,248,4,
+88,150,104,79,79,26,195,52,246,194,218,188,218,58,198,122,213,210,211,141,128,235,111,104,22,204,120,6,248,137,138,37,167,75,87,120,175,12,24,201,
+8,192,176,152,74,184,22,145,20,211,46,19,40,204,160,175,44,32,156,167,92,67,232,134,18,246,56,116,102,161,52,229,235,111,42,43,33,71,30,183,
+81,62,162,68,64,228,205,15,24,73,67,222,26,65,17,139,216,80,162,110,25,56,0,136,170,61,83,46,162,101,42,109,187,104,252,86,112,190,205,247,
+46,189,78,244,240,178,203,249,246,191,225,112,64,159,242,115,204,69,101,95,67,155,189,186,54,69,157,88,59,148,72,11,9,105,89,144,74,109,2,105,
+27,193,231,73,168,144,233,232,82,39,75,149,11,149,93,205,176,179,97,86,213,63,37,122,69,196,133,48,201,24,3,174,62,64,240,75,112,144,17,42,
+45,116,65,235,43,51,10,84,211,98,106,149,180,143,141,104,225,169,74,40,30,75,214,3,17,33,130,44,25,129,95,20,112,163,69,8,63,208,59,22,
+188,108,103,223,67,26,174,91,206,227,24,210,226,27,159,174,94,218,232,228,249,214,153,255,108,151,225,118,242,122,250,213,107,248,233,249,167,180,71,252,
+155,107,224,208,90,26,103,122,163,164,159,138,139,124,1,11,98,236,46,100,97,78,246,139,234,70,200,255,165,176,150,10,60,9,148,32,22,149,57,131,
+208,235,34,241,136,6,8,44,160,238,130,26,24,227,74,130,245,70,35,81,91,105,125,85,74,128,180,65,164,164,182,169,17,23,57,240,193,102,86,144,
+61,10,124,22,0,47,0,64,79,130,194,19,193,183,129,228,190,227,227,70,250,36,216,110,222,119,241,198,139,29,124,254,243,129,214,62,167,159,139,67,
+255,119,181,25,95,121,253,42,229,36,240,50,135,14,185,188,9,163,118,207,10,166,74,61,200,8,57,81,114,184,216,146,52,98,2,102,198,195,115,86,
+92,237,9,254,36,60,146,170,98,136,109,164,214,119,100,36,75,236,96,226,29,141,164,71,33,3,0,176,60,99,213,38,153,194,205,150,144,51,243,166,
+45,6,232,197,62,57,193,77,90,75,242,140,137,180,104,224,143,12,8,31,0,106,9,0,29,1,156,14,226,103,19,73,83,203,38,142,116,225,179,197,
+209,48,149,198,199,41,220,246,52,89,207,38,137,47,234,170,255,194,101,181,87,227,7,15,228,84,189,32,233,30,220,42,158,55,69,209,110,33,104,189,
+194,240,11,210,134,195,100,132,187,68,137,15,121,65,86,170,172,129,154,68,74,39,157,89,97,98,196,42,178,77,52,159,73,118,106,50,57,11,60,114,
+160,100,144,192,169,96,56,61,25,4,80,166,121,212,2,167,28,228,234,73,48,90,76,73,234,109,113,246,143,236,91,97,83,14,200,38,130,34,22,32,
+89,131,40,33,97,17,19,8,254,73,162,122,84,37,175,21,146,239,255,133,54,64,217,114,231,147,167,198,11,28,75,223,244,228,127,87,135,228,157,223,
+178,152,45,132,184,169,67,101,199,82,107,140,36,102,33,75,219,1,197,16,71,81,171,41,0,9,19,249,1,198,242,130,24,92,160,204,10,25,37,90,
+131,170,176,69,51,88,24,102,137,248,10,192,252,194,224,26,32,188,129,223,39,66,0,68,172,175,240,221,171,236,196,233,43,77,9,169,86,190,67,181,
+129,138,93,18,97,237,39,104,117,66,110,31,16,205,8,92,92,2,53,17,64,155,192,202,52,114,25,148,125,23,40,33,107,59,14,225,187,132,118,86,
+217,124,232,139,170,20,182,254,60,47,253,30,222,12,79,241,13,141,100,234,60,170,45,143,126,158,163,116,214,106,237,82,5,13,98,42,37,200,24,204,
+100,91,4,138,64,4,137,234,65,18,93,101,51,54,170,98,137,34,70,137,195,154,145,72,209,206,39,12,30,132,22,66,238,64,0,196,1,154,47,227,
+248,135,113,132,96,211,102,73,41,85,158,131,179,199,170,60,132,234,253,12,74,80,192,174,92,240,46,135,140,32,161,96,15,120,199,133,174,43,225,205,
+128,144,145,228,15,49,218,70,81,202,228,182,76,197,255,9,140,215,50,243,211,207,74,139,23,191,70,7,254,18,96,213,255,124,190,10,140,221,122,118,
+202,251,122,173,41,96,74,207,87,3,198,30,248,5,159,186,157,224,252,29,177,159,138,138,133,162,9,40,132,37,226,135,186,124,168,162,165,202,142,106,
+16,72,255,22,105,19,241,134,28,156,44,195,239,4,24,20,192,0,46,232,61,84,238,39,182,36,147,21,108,103,45,70,74,55,75,2,148,177,58,160,
+188,13,165,157,2,64,152,192,0,7,64,115,136,104,70,33,252,29,40,12,74,138,65,147,175,164,21,71,46,71,110,124,103,177,1,206,139,49,221,97,
+50,166,231,4,255,76,7,247,104,118,40,254,19,157,219,158,93,248,7,221,119,139,85,128,173,93,171,149,93,152,33,230,6,157,62,70,2,216,185,209,
+89,74,218,150,1,99,212,252,56,98,154,136,104,38,190,141,242,52,200,164,160,6,122,3,50,149,12,147,66,201,20,0,40,192,102,16,57,1,72,186,
+121,210,246,167,12,224,106,33,61,106,62,207,134,109,51,147,145,28,187,33,243,31,136,23,67,150,5,0,2,128,112,27,0,233,3,80,170,195,6,80,
+114,112,159,221,40,107,121,113,27,217,226,245,142,22,114,25,208,107,89,103,175,167,3,254,195,239,50,215,224,27,228,251,199,29,242,212,170,27,29,172,
+245,42,85,149,157,166,160,187,150,198,27,73,110,232,218,84,252,192,197,152,127,100,130,11,52,180,137,52,215,225,44,250,201,7,59,76,73,5,211,196,
+160,182,69,163,140,7,88,152,192,23,14,208,69,161,245,31,217,157,202,226,149,19,72,169,124,233,169,195,59,202,1,77,214,91,178,212,141,108,126,33,
+85,16,168,0,1,2,8,0,39,0,96,2,1,67,11,40,225,200,42,105,147,232,169,61,135,110,115,131,118,43,89,82,102,149,163,78,158,240,205,127,
+8,247,253,15,131,124,252,155,44,165,50,151,191,238,143,14,135,209,212,201,163,17,121,174,212,74,130,83,115,45,230,70,100,21,209,24,40,169,88,31,
+168,248,170,186,21,53,131,9,18,152,3,21,199,251,141,149,58,176,206,183,195,241,91,80,39,39,240,127,45,0,183,32,106,185,172,194,167,178,209,74,
+250,105,164,237,10,84,126,45,43,78,183,171,102,67,170,30,21,7,126,63,131,250,55,64,250,7,0,16,69,161,170,165,230,155,7,151,81,158,237,21,
+110,203,140,254,95,251,61,236,155,199,239,95,30,0,31,255,251,20,127,255,34,207,227,71,255,79,216,121,114,125,254,34,186,89,127,138,189,117,189,37,
+85,254,82,243,51,5,130,255,24,201,13,11,134,123,10,197,181,229,88,180,50,217,122,234,221,64,166,1,219,138,38,156,188,164,57,151,100,242,162,253,
+72,192,210,154,82,181,187,116,15,69,138,7,42,30,216,114,81,79,58,169,157,13,93,77,142,90,167,238,212,233,54,72,105,150,41,136,154,101,198,34,
+94,67,46,31,65,130,68,98,98,188,38,135,28,23,15,170,237,13,112,179,199,95,62,29,193,118,195,228,183,92,31,215,203,255,255,239,105,254,130,95,
+254,53,62,148,43,65,247,233,234,150,52,95,198,135,51,111,187,108,64,52,239,56,240,74,97,185,90,3,165,102,36,205,98,76,145,47,229,170,246,115,
+90,20,110,249,132,215,24,42,117,111,237,42,172,168,163,117,48,232,139,24,51,230,30,58,148,64,44,53,162,174,136,240,145,134,155,97,207,53,51,105,
+22,110,242,195,49,151,47,51,179,7,54,48,158,52,146,228,44,211,40,32,145,110,26,177,179,37,53,179,69,153,2,190,221,137,233,87,142,174,66,250,
+137,238,63,192,55,138,56,15,127,240,248,255,255,253,62,130,171,255,230,18,95,88,198,254,47,49,255,212,55,215,14,61,95,91,28,16,186,203,186,163,
+13,138,221,15,12,23,94,65,254,224,177,36,237,184,177,190,212,3,88,108,251,53,120,204,203,42,172,116,173,57,110,169,70,73,121,190,147,64,246,2,
+252,57,149,52,138,96,22,169,48,239,127,120,49,198,173,190,100,18,168,176,227,61,54,103,44,211,87,33,80,125,25,209,122,22,114,6,23,48,224,32,
+81,185,55,85,93,95,24,210,197,238,194,117,229,200,247,44,29,120,119,55,227,11,174,78,184,31,255,206,91,255,255,190,231,248,53,255,235,247,198,235,
+238,55,225,254,233,190,104,120,98,191,223,123,153,197,117,131,173,229,37,91,137,233,2,51,112,224,169,237,52,120,29,160,39,69,199,139,46,45,19,182,
+234,187,182,226,211,204,207,26,38,86,10,112,39,140,71,65,154,22,99,41,29,246,119,79,120,35,186,252,55,225,95,8,152,97,188,43,224,176,26,252,
+162,9,231,148,8,226,135,248,32,128,56,57,1,48,15,5,72,169,148,73,234,171,107,159,196,158,106,53,111,189,206,60,122,11,236,7,191,47,42,123,
+71,254,122,31,255,250,190,127,254,30,159,255,116,95,172,158,234,223,231,75,21,60,241,252,176,211,247,128,157,53,201,183,45,121,112,82,134,139,132,212,
+249,25,79,27,119,98,226,248,242,50,119,78,218,86,148,222,75,75,139,207,111,113,14,77,171,17,211,25,66,128,142,192,228,13,192,141,41,88,16,199,
+84,137,103,118,154,179,31,118,24,128,195,213,145,226,90,116,111,234,53,42,242,20,100,246,10,96,52,18,163,64,42,35,56,78,160,90,129,167,10,202,
+111,195,22,58,94,212,183,24,188,94,245,201,215,23,137,175,43,49,171,255,224,241,255,255,211,35,241,62,255,255,16,146,13,18,127,244,157,125,175,92,
+29,117,89,255,174,248,161,98,118,82,32,26,131,242,170,32,10,130,85,98,86,220,45,32,65,222,250,11,157,255,40,81,201,203,19,12,137,180,238,141,
+150,181,198,25,148,64,68,206,192,90,76,200,70,211,36,51,101,126,40,53,173,46,218,154,171,188,152,222,229,162,97,210,88,176,155,0,38,149,16,131,
+61,5,128,58,17,18,124,39,178,154,55,48,48,67,19,255,88,88,119,191,237,112,231,171,142,62,27,58,111,235,215,187,79,27,152,139,255,1,111,255,
+255,180,23,249,156,127,250,199,249,55,171,199,207,7,205,174,20,95,212,47,27,239,135,136,127,202,230,173,172,137,36,57,5,12,116,86,40,137,56,76,
+42,49,176,191,135,6,74,254,115,96,178,7,9,236,54,177,226,206,34,68,89,238,33,86,1,195,105,8,1,174,2,146,26,119,17,90,155,104,203,205,
+133,127,97,167,31,21,147,159,169,141,204,116,152,222,76,189,204,12,237,67,208,246,76,120,186,202,248,84,65,200,15,75,84,39,89,60,193,226,182,239,
+180,7,168,109,179,114,161,199,223,116,93,86,121,117,233,159,238,45,255,255,55,15,255,225,93,246,241,255,248,158,253,41,191,149,255,55,183,241,241,247,
+205,140,182,125,133,242,30,243,203,199,50,252,176,32,79,226,182,198,169,54,53,220,157,54,166,153,37,104,13,169,70,130,154,13,104,213,135,86,103,149,
+166,187,196,203,35,101,17,67,100,103,193,203,41,68,181,38,53,175,114,245,159,148,186,186,206,133,122,228,50,216,46,22,230,103,78,214,33,242,156,224,
+124,70,32,92,11,65,66,58,67,142,47,133,222,28,168,138,152,236,143,22,88,161,216,30,169,249,12,228,63,171,62,215,60,32,246,217,140,103,255,206,
+147,255,255,229,221,209,103,255,165,200,156,201,31,249,186,149,71,130,239,38,241,55,240,187,20,106,123,203,94,103,153,31,241,24,168,127,22,161,204,203,
+107,14,74,158,114,90,156,103,76,170,201,113,104,195,139,58,204,151,44,113,135,100,118,41,212,208,14,224,113,68,28,12,68,170,91,106,234,184,46,194,
+248,240,87,132,236,33,96,146,254,110,42,213,106,206,154,167,62,88,100,6,28,225,126,10,192,10,19,64,6,7,33,214,66,165,190,154,235,183,4,56,
+223,208,126,195,248,24,229,35,161,142,207,187,206,242,131,118,63,253,124,63,255,248,134,127,63,15,255,136,191,196,63,179,183,254,72,239,189,222,151,147,
+76,54,244,171,187,8,128,107,251,83,170,214,204,65,46,141,59,103,97,45,240,16,33,14,225,211,184,222,187,90,139,206,115,118,144,167,50,232,57,105,
+249,23,234,14,73,64,235,162,128,80,43,92,176,96,36,194,171,58,182,177,207,86,25,207,172,252,177,217,150,4,173,186,158,108,250,67,170,38,10,229,
+142,6,192,222,2,162,40,29,98,92,67,96,234,115,231,66,184,111,123,11,154,29,210,23,8,220,62,116,91,213,175,119,222,55,181,223,247,194,255,255,
+233,177,255,248,80,127,249,23,253,231,88,91,200,7,238,159,109,47,234,103,65,239,41,87,21,139,124,192,200,68,45,145,30,232,72,15,176,130,31,103,
+169,136,53,104,186,30,67,35,196,66,27,93,93,170,229,164,86,81,210,176,211,112,200,50,106,2,249,142,0,0,238,8,195,43,137,244,221,194,230,140,
+169,91,34,88,92,181,252,206,78,238,102,100,107,6,114,69,66,18,227,0,115,63,42,66,219,48,33,185,19,0,205,30,177,7,88,147,1,135,251,120,
+208,38,134,118,249,198,255,33,157,168,117,69,228,111,186,254,155,31,255,230,33,255,254,139,151,139,255,252,134,247,22,229,163,251,125,195,19,228,243,131,
+59,7,248,228,200,123,151,235,254,67,28,191,21,145,90,164,253,96,41,58,109,61,48,142,57,23,42,219,131,82,140,47,184,222,75,99,143,100,3,52,
+90,131,196,212,163,120,63,145,164,80,54,162,126,80,160,117,54,39,85,153,191,157,109,115,206,70,138,170,39,4,246,205,58,151,137,1,6,137,27,67,
+189,19,224,109,5,177,252,36,50,116,61,144,98,80,19,197,102,216,117,194,246,194,244,67,201,245,94,30,250,219,235,199,193,159,136,72,214,127,224,189,
+255,255,248,124,108,209,255,247,235,76,248,114,254,18,249,161,184,143,229,11,132,167,212,141,234,49,209,117,213,60,154,253,218,15,255,4,231,194,184,150,
+13,24,77,102,197,163,70,81,219,191,98,9,184,166,20,217,110,98,1,71,204,37,24,210,185,4,49,0,0,100,12,32,31,95,48,197,147,73,76,205,
+237,109,227,151,13,22,223,149,10,7,201,44,157,94,60,143,206,68,166,192,232,181,202,144,158,203,72,99,67,160,57,201,36,90,87,228,231,227,6,246,
+180,161,168,13,232,114,131,202,255,115,253,115,249,116,227,31,250,33,127,255,236,133,255,222,179,251,60,255,238,131,240,190,255,6,124,250,101,39,232,67,
+71,121,44,246,67,172,135,136,222,101,25,5,209,32,127,24,251,0,102,126,215,170,118,27,20,99,165,165,118,160,218,4,104,157,159,150,32,217,113,84,
+242,239,210,64,143,163,253,28,82,211,16,249,46,44,185,15,182,43,99,180,44,151,215,94,123,171,71,43,86,27,122,150,139,63,182,77,13,116,245,13,
+130,137,14,160,6,1,17,174,24,241,170,50,80,123,75,116,99,107,120,157,198,30,197,245,83,202,63,31,157,125,118,153,226,51,183,189,68,191,254,38,
+223,255,255,35,46,120,63,254,72,111,197,157,143,229,198,144,124,107,124,21,84,51,217,5,207,177,231,88,87,50,175,238,209,18,213,226,152,52,90,85,
+92,35,4,237,220,46,25,199,51,4,141,228,49,232,205,147,25,203,174,91,34,122,18,62,130,82,172,34,16,150,1,216,248,164,122,28,190,219,11,197,
+149,238,226,103,13,87,207,135,250,243,191,170,19,173,121,114,150,152,255,129,152,168,139,208,97,141,64,58,130,160,109,145,57,44,171,26,144,195,230,38,
+52,161,176,14,10,249,117,232,3,185,94,230,252,178,98,223,255,155,71,255,255,76,111,222,131,255,185,31,229,111,232,49,255,164,60,23,59,192,241,179,
+146,254,47,121,133,176,7,45,188,192,178,117,192,168,62,157,67,61,1,150,237,156,94,221,239,37,121,198,195,55,76,147,56,91,82,147,134,228,114,52,
+14,137,101,35,33,64,162,77,164,27,230,236,148,34,38,202,235,34,223,48,215,114,25,44,185,12,124,220,22,3,45,14,178,234,226,98,231,166,34,227,
+214,2,128,110,14,1,116,0,65,20,37,161,238,99,103,130,185,46,243,19,153,222,212,239,2,60,99,244,67,214,199,123,254,67,118,247,248,33,127,255,
+232,33,255,253,14,191,252,234,255,52,153,105,123,97,252,129,225,165,251,24,171,183,69,121,190,175,93,16,198,148,154,25,63,47,135,155,229,96,16,91,
+235,88,227,5,174,85,145,248,241,0,129,151,110,169,193,109,37,129,133,39,50,186,68,172,79,129,158,103,66,194,89,129,182,163,225,79,41,145,215,163,
+170,91,204,29,253,224,27,33,212,239,146,105,96,192,180,127,81,252,129,66,220,138,200,0,129,75,88,92,198,40,66,196,236,100,211,44,227,97,26,229,
+180,17,160,205,217,241,113,202,239,100,189,119,248,239,239,35,134,71,255,250,23,127,255,171,86,19,63,255,40,121,119,88,111,252,124,113,148,252,94,227,
+239,64,94,98,231,57,158,233,1,25,8,81,193,113,42,165,69,125,104,45,114,36,122,174,184,84,2,227,161,153,230,65,92,82,164,229,203,153,138,54,
+54,97,74,125,61,209,109,66,1,80,90,154,41,99,1,18,85,39,110,217,108,164,157,118,77,238,164,104,139,21,181,203,72,22,189,3,214,69,34,36,
+11,34,32,239,9,65,146,25,114,94,59,16,190,85,83,53,111,120,55,196,246,188,180,137,202,223,14,253,144,245,185,226,15,198,132,151,63,240,202,255,
+255,250,64,118,230,255,254,71,229,213,81,255,182,46,127,44,83,249,215,230,117,247,217,152,102,115,106,218,128,17,65,168,112,109,212,130,81,149,30,195,
+171,18,140,90,54,188,190,151,20,76,3,54,114,201,107,0,205,21,162,145,153,146,161,85,129,32,147,113,54,13,29,3,32,214,16,145,65,80,247,109,
+145,234,141,211,245,4,232,10,159,176,35,104,19,125,113,240,26,93,177,92,43,112,148,10,224,251,44,130,99,39,67,11,7,243,141,79,20,231,141,203,
+230,215,134,141,120,137,227,215,158,30,223,59,19,242,37,175,79,247,36,255,255,241,108,255,129,199,252,92,255,231,7,240,128,255,72,155,188,206,55,207,
+54,131,48,177,240,111,195,51,204,71,58,44,12,97,132,209,194,21,165,33,37,112,88,145,86,185,217,43,102,85,176,214,80,90,179,101,57,146,118,45,
+151,2,175,101,15,33,165,21,99,200,85,64,48,3,225,249,77,83,107,132,218,131,199,229,200,226,79,15,183,47,141,138,149,194,84,252,215,20,219,73,
+124,191,65,208,141,71,32,59,69,64,13,129,148,22,10,244,71,212,221,27,222,246,31,114,169,175,77,140,242,117,201,135,96,61,163,248,192,232,239,184,
+7,255,238,129,255,255,223,123,245,67,255,214,61,238,50,41,254,25,236,245,234,195,161,154,194,243,253,38,184,18,220,30,244,154,110,241,202,149,126,149,
+80,56,155,247,0,70,182,237,241,14,206,144,23,188,213,235,85,139,120,109,77,45,140,203,34,129,72,104,29,44,243,15,0,177,77,27,216,233,171,90,
+241,180,188,38,93,142,52,111,195,17,87,219,121,23,15,90,53,133,58,243,129,31,209,123,10,112,10,2,224,192,5,64,106,5,240,255,32,211,93,75,
+54,141,129,140,149,232,139,103,60,35,114,151,210,143,100,157,254,121,9,162,239,255,46,239,255,253,132,63,137,23,255,217,87,201,39,138,103,252,231,193,
+67,111,63,22,243,59,223,134,149,227,255,135,90,241,34,24,36,92,233,128,122,40,23,239,69,104,206,104,69,187,164,239,187,212,65,19,181,244,200,54,
+92,192,218,134,25,121,33,230,29,129,85,30,224,168,18,1,68,100,80,138,146,153,55,201,197,174,96,195,34,245,255,155,154,67,199,117,25,217,21,43,
+201,109,28,66,72,203,198,128,68,195,248,48,130,52,85,9,148,1,208,172,214,216,133,244,97,143,73,58,47,225,207,134,222,141,186,186,238,119,197,246,
+229,126,53,95,255,253,19,191,255,2,207,249,160,255,137,203,16,106,119,253,116,248,47,127,92,213,76,224,59,136,249,46,220,76,68,64,56,212,101,188,
+86,83,134,188,83,164,115,44,93,238,204,147,116,225,125,163,213,237,57,166,66,59,157,51,102,104,205,21,40,208,79,192,9,103,16,183,172,208,198,35,
+94,133,177,49,38,250,195,150,205,78,86,166,48,240,201,80,25,35,141,12,61,66,173,66,69,180,33,73,228,177,11,36,224,135,164,98,3,44,123,195,
+37,111,202,246,32,237,243,58,26,70,216,231,34,156,84,246,187,211,199,143,127,10,154,68,127,251,132,127,255,241,206,201,187,255,252,170,242,210,210,255,
+238,207,96,89,186,253,230,113,238,252,9,105,93,176,9,80,135,243,21,200,24,125,165,113,71,9,233,99,77,136,134,30,27,230,89,91,152,229,141,184,
+21,98,29,135,118,129,17,20,207,241,4,45,156,99,140,32,126,69,158,128,16,229,21,73,45,160,44,27,227,22,179,52,245,60,250,88,161,236,63,215,
+45,5,91,44,1,152,92,117,141,60,78,128,144,33,74,56,148,74,184,216,192,0,255,81,253,77,99,14,249,182,11,161,14,46,56,202,232,55,182,30,
+204,252,110,233,239,253,155,63,255,253,122,191,201,107,254,121,255,234,231,229,5,253,219,115,243,116,223,130,27,209,210,215,168,205,167,60,137,116,76,199,
+86,102,199,204,128,216,240,39,198,202,19,174,151,23,34,155,18,33,148,22,144,18,5,3,89,27,68,83,0,209,213,66,49,248,120,243,208,117,81,224,
+54,242,85,25,230,5,79,134,165,73,99,123,19,193,72,40,85,26,70,213,238,50,83,132,3,96,45,55,3,21,76,35,179,52,1,255,0,96,102,49,
+145,238,75,17,134,65,80,147,34,179,1,4,84,131,8,164,53,1,35,139,82,111,182,215,255,69,79,124,15,255,255,252,186,253,103,127,254,66,31,32,
+157,222,127,42,143,20,247,202,222,203,186,175,145,197,115,64,171,136,199,135,31,213,195,215,95,203,3,18,120,77,56,53,9,243,220,203,207,32,234,99,
+183,209,42,156,106,67,66,173,107,32,22,75,8,142,56,98,2,128,224,180,129,32,28,82,33,154,31,226,62,3,33,94,6,192,40,11,129,76,20,193,
+160,34,1,84,42,193,8,38,1,4,19,65,36,4,224,232,25,160,10,36,225,162,39,163,86,41,36,154,46,100,250,57,36,126,67,99,122,66,162,38,
+72,58,179,127,248,252,127,36,239,255,120,223,255,253,254,127,195,83,253,55,63,254,214,255,251,48,120,175,139,126,199,21,97,66,44,122,182,93,236,81,
+136,44,161,164,105,144,127,136,119,129,191,146,38,224,247,124,27,183,5,192,51,76,61,93,52,49,168,212,55,195,84,223,39,115,38,75,124,196,90,66,
+100,8,60,234,146,148,17,19,108,39,173,65,226,167,6,82,146,61,149,148,71,117,42,33,146,72,21,32,227,61,34,189,66,194,119,35,224,185,8,240,
+254,45,49,162,58,176,168,46,177,77,24,115,35,7,83,253,4,179,123,14,146,23,34,121,152,126,62,223,255,183,135,182,79,255,255,251,188,240,142,254,
+254,156,197,253,121,255,243,246,255,216,247,253,110,188,99,231,141,27,135,113,132,3,125,69,199,67,74,217,214,48,26,151,239,50,77,143,121,143,109,139,
+141,116,43,67,70,13,152,93,228,245,174,13,237,171,238,111,1,143,23,56,227,96,203,70,234,239,179,146,96,149,170,92,70,46,61,18,111,131,50,153,
+147,65,11,29,171,189,53,156,22,19,229,39,129,68,43,80,73,42,215,89,93,207,144,198,192,220,10,144,108,150,151,244,134,20,28,21,201,140,205,64,
+185,58,198,73,59,69,99,213,155,255,187,231,192,227,255,252,126,255,255,245,19,255,255,211,251,213,119,191,15,197,217,165,249,188,255,41,111,235,87,252,
+217,60,240,246,30,2,82,177,153,193,103,155,163,89,39,204,79,139,180,62,155,226,90,247,74,193,38,181,82,171,45,224,242,142,156,187,49,23,167,69,
+153,87,25,41,210,245,101,41,15,45,202,146,193,81,161,195,128,151,25,62,25,145,75,140,67,30,166,112,24,11,219,0,46,220,15,23,229,105,137,68,
+29,136,153,17,211,65,149,208,33,55,65,184,100,78,124,83,152,132,138,151,68,35,12,228,126,192,252,176,108,53,255,14,79,255,163,103,255,206,71,255,
+254,207,185,59,127,241,56,255,212,95,193,155,112,79,155,47,204,226,234,238,55,231,241,243,33,252,219,189,119,123,121,74,165,25,162,4,251,180,120,101,
+118,28,5,240,12,24,160,83,30,50,242,101,84,176,110,113,220,46,147,241,42,72,127,174,180,103,208,49,77,196,148,71,24,245,118,160,42,201,138,102,
+86,0,128,64,234,80,161,45,252,142,105,168,29,33,64,97,70,54,167,8,254,136,5,246,28,0,98,89,163,244,161,228,84,155,32,92,89,229,26,15,
+233,26,26,137,106,21,72,78,166,223,143,151,255,36,47,45,111,255,255,249,238,253,172,127,255,130,55,241,229,139,207,188,119,5,176,77,240,4,248,26,
+252,220,54,215,132,70,61,92,212,126,63,158,155,62,133,26,38,211,104,140,28,174,229,22,255,186,100,219,91,176,218,70,108,123,23,4,177,150,228,37,
+12,220,123,70,84,170,197,212,124,71,116,67,198,124,59,193,236,85,67,72,86,69,48,25,194,232,71,0,204,147,2,108,149,128,52,79,4,8,14,198,
+232,77,69,168,77,192,80,38,198,12,7,202,100,21,202,212,83,72,68,154,197,60,194,195,204,171,196,100,172,221,99,235,33,255,233,73,170,151,255,255,
+254,137,245,81,255,169,132,159,255,136,159,254,128,95,224,163,230,100,27,112,81,156,211,182,100,19,234,113,232,15,234,201,157,44,93,166,141,155,63,115,
+238,169,252,234,48,187,122,99,70,155,174,5,25,150,221,234,169,232,224,54,238,38,218,212,153,128,228,128,202,248,189,79,124,203,30,13,82,153,44,190,
+135,68,55,202,80,220,82,144,203,78,56,35,195,136,145,5,124,235,135,228,182,131,60,39,131,24,99,70,88,167,67,160,143,67,84,77,202,60,31,205,
+188,40,204,76,98,71,228,153,195,4,165,193,111,160,103,255,174,55,193,131,255,231,179,255,255,202,95,255,212,203,162,135,254,39,127,227,149,116,61,79,
+254,143,222,170,189,2,19,236,88,230,16,10,102,179,159,38,197,253,109,52,239,193,56,72,93,215,57,109,245,120,243,107,71,90,133,105,87,121,123,101,
+135,137,198,87,49,252,120,51,75,81,138,178,205,226,207,240,54,109,144,147,46,136,14,195,170,57,239,220,154,99,244,77,71,250,237,140,146,234,199,30,
+93,2,208,70,42,84,159,106,156,126,99,192,20,228,222,69,138,98,83,201,230,10,69,6,91,160,28,159,98,60,151,224,120,87,227,71,137,199,243,134,
+255,252,211,63,242,253,255,255,252,122,254,207,159,193,155,226,11,148,31,251,90,127,225,19,254,109,157,150,210,59,92,45,245,249,170,82,94,25,72,140,
+31,40,52,196,15,115,129,213,144,236,240,223,161,196,235,21,253,196,155,49,58,241,74,212,38,12,66,152,180,174,199,22,114,211,65,26,64,116,136,108,
+98,43,127,39,200,166,157,144,7,37,172,0,162,111,30,198,203,83,32,16,26,246,96,99,216,45,45,42,107,8,136,124,157,66,182,171,131,1,151,177,
+128,141,72,92,43,217,81,50,216,178,32,72,224,133,90,56,142,178,190,168,135,233,21,255,229,168,16,159,255,252,13,127,252,119,255,255,250,4,127,204,
+220,95,123,145,72,167,72,159,220,251,251,195,255,124,239,117,189,125,19,138,157,188,82,51,19,205,169,201,213,40,183,2,76,149,9,0,202,85,25,59,
+73,160,35,83,141,110,37,78,241,209,125,39,2,133,90,20,244,152,219,213,70,244,231,11,84,213,210,66,8,239,228,242,170,140,62,32,242,141,10,54,
+245,139,6,186,67,82,28,198,84,115,107,168,160,104,236,88,160,160,23,135,146,94,203,38,71,200,110,25,162,186,127,97,204,173,162,60,134,224,238,65,
+225,93,202,51,255,115,207,252,173,191,255,253,36,255,253,27,127,170,231,225,37,255,180,239,248,50,90,95,10,190,250,151,71,43,95,7,143,154,63,237,
+21,241,237,241,56,141,184,115,228,81,159,239,22,204,137,237,116,162,161,48,152,77,50,207,140,142,83,69,130,47,225,206,84,163,58,55,37,198,33,165,
+114,57,225,242,104,161,196,117,162,88,66,32,114,20,195,234,91,4,230,98,1,230,45,2,240,21,166,148,55,166,124,33,98,192,19,129,234,59,68,242,
+53,4,214,1,34,146,68,160,106,113,96,42,112,98,42,75,36,214,31,38,58,1,231,223,89,143,250,105,127,219,211,219,111,255,255,252,179,247,16,255,
+245,184,255,233,211,227,237,155,183,131,255,30,129,178,193,135,179,198,125,179,158,166,102,240,255,7,239,88,127,82,173,26,101,40,226,150,177,224,45,191,
+14,195,215,3,108,192,60,128,204,149,45,43,42,41,134,153,113,109,167,105,189,67,221,63,165,187,200,243,21,121,31,141,18,71,155,177,238,147,64,130,
+129,80,233,11,73,159,11,121,93,0,104,137,11,208,57,145,96,142,140,144,100,128,224,20,138,216,14,17,232,46,146,24,177,142,121,48,138,249,110,138,
+73,76,139,184,226,143,171,47,122,255,127,254,168,1,25,255,255,250,167,251,81,255,209,250,10,159,247,219,255,246,110,255,154,15,188,16,170,200,214,254,
+128,38,212,58,203,98,43,137,208,51,184,222,252,28,176,252,24,56,14,227,76,127,235,179,128,22,187,187,108,106,75,78,103,61,60,151,116,191,93,129,
+176,239,136,115,240,142,41,138,74,22,42,84,33,121,230,53,12,1,252,90,23,120,121,215,84,64,210,176,27,226,109,96,100,223,100,99,63,44,64,130,
+25,243,146,69,179,228,63,241,60,24,178,81,12,228,193,23,100,199,1,146,209,39,208,133,65,240,224,66,176,9,235,157,255,192,43,249,143,127,250,245,
+255,255,254,136,191,255,225,128,59,191,103,94,109,91,87,126,242,63,241,90,254,113,63,49,10,223,148,100,201,145,101,33,32,192,243,245,142,82,82,160,
+138,5,103,116,222,207,119,22,41,45,141,82,222,89,183,11,45,21,236,225,71,81,194,20,201,185,205,251,16,121,220,78,60,192,1,229,200,97,85,67,
+57,73,67,109,53,1,148,194,92,209,244,227,48,206,43,72,17,225,162,168,75,26,238,11,126,145,131,250,25,228,176,167,40,156,199,164,236,119,163,42,
+7,42,66,62,76,62,42,72,30,35,161,222,80,180,250,254,234,159,255,150,247,254,218,127,255,251,0,145,143,255,155,231,251,193,174,247,213,187,243,159,
+243,214,24,78,56,255,137,119,220,159,234,85,192,198,209,198,220,140,115,66,65,84,178,45,225,123,60,96,160,47,23,60,143,108,107,34,190,120,67,78,
+198,109,213,83,56,207,79,28,255,142,13,69,213,58,109,241,4,147,202,158,26,89,10,165,195,215,195,33,236,89,240,149,66,49,9,18,149,241,23,45,
+142,137,164,78,137,96,233,84,249,102,80,232,238,192,224,15,79,228,146,152,12,131,19,68,43,71,92,238,67,17,73,198,137,67,83,99,242,130,255,224,
+49,227,125,255,255,251,175,255,208,47,255,253,142,191,132,173,63,252,198,36,223,155,159,226,149,249,50,253,8,175,214,83,125,47,60,160,126,95,221,210,
+248,191,61,88,170,73,186,87,53,250,139,155,154,20,184,21,136,209,70,128,80,174,147,136,58,150,248,245,134,186,72,139,34,210,138,33,206,138,56,19,
+33,105,151,39,185,167,20,152,101,10,97,15,162,65,163,163,224,209,144,96,176,7,233,220,21,249,225,17,56,185,0,232,197,140,241,198,141,145,195,128,
+217,0,147,248,49,160,232,23,32,24,86,147,104,253,132,232,76,234,117,255,228,73,254,54,159,255,240,111,255,252,149,254,132,31,247,174,255,253,50,127,
+248,125,120,253,128,110,15,131,247,69,191,74,175,130,175,207,195,138,221,95,37,153,162,239,151,135,130,95,125,236,162,100,80,101,81,253,193,179,28,155,
+213,80,253,64,134,221,95,213,138,71,44,29,4,49,154,48,211,75,17,5,161,37,4,175,15,1,215,16,144,180,32,81,232,24,113,164,0,240,188,20,
+160,22,30,96,6,25,224,102,13,64,188,0,96,180,8,48,44,12,80,155,14,209,95,18,49,227,24,18,23,30,82,11,34,81,227,34,49,145,29,50,
+177,178,55,248,239,127,241,112,228,99,255,255,255,207,127,243,34,255,17,15,201,14,36,255,201,171,252,146,255,114,141,244,215,210,95,135,74,20,58,9,
+112,217,243,24,227,167,169,241,106,180,62,195,92,132,123,52,112,75,196,249,152,79,158,115,217,85,229,77,154,156,214,160,98,74,168,193,76,153,98,89,
+197,244,30,4,32,198,89,235,221,66,45,45,88,155,162,88,64,72,66,206,203,18,188,132,138,53,132,240,79,106,164,121,104,172,54,225,108,44,133,134,
+97,200,14,61,133,70,33,224,202,119,33,176,144,224,28,100,227,222,34,103,14,13,199,130,15,124,199,63,245,40,254,234,223,251,162,255,255,255,101,159,
+255,203,82,208,31,130,173,167,190,4,159,232,75,255,55,111,206,167,173,48,155,168,45,5,0,40,154,236,77,23,249,37,22,84,3,116,26,213,31,111,
+107,164,188,33,134,81,63,31,205,116,241,168,178,57,176,12,37,15,234,53,148,45,22,167,2,44,2,125,31,249,36,87,126,54,143,118,48,132,164,216,
+177,52,138,108,34,145,140,132,140,185,26,96,28,206,237,224,93,34,224,80,135,234,182,203,146,136,70,122,12,33,104,149,165,224,192,99,96,122,227,146,
+17,41,150,47,10,142,31,198,214,24,59,11,127,138,23,255,204,19,255,228,215,255,255,225,39,252,60,63,41,143,193,173,56,127,139,215,250,217,255,32,
+173,72,214,23,193,123,201,71,208,203,49,122,66,20,48,111,169,177,201,28,60,131,25,221,116,134,49,147,104,53,110,58,200,76,156,214,131,130,61,243,
+22,193,150,98,146,245,20,224,150,141,76,88,171,215,18,136,39,137,144,213,57,236,53,164,11,7,37,11,31,34,238,75,216,36,55,11,182,24,136,232,
+22,209,233,179,242,224,169,33,130,130,16,164,35,105,225,47,249,51,30,40,191,130,122,122,142,2,225,135,81,192,140,248,45,150,60,165,191,191,135,255,
+200,131,252,193,255,255,236,75,234,59,255,253,4,191,238,99,18,143,39,78,162,234,193,223,163,241,19,254,136,159,76,158,253,140,50,99,56,148,84,14,
+225,136,254,121,134,68,4,1,16,151,204,10,249,77,46,91,128,108,211,175,237,74,56,89,69,100,69,128,118,16,175,109,77,247,226,130,72,99,6,163,
+157,190,116,136,95,1,95,70,144,154,19,173,255,28,77,220,12,212,128,139,208,233,91,193,103,215,48,176,67,96,116,16,53,32,151,44,201,14,60,66,
+192,33,57,200,161,128,68,160,244,199,132,34,81,164,112,21,141,127,63,109,207,254,77,18,126,255,255,242,163,255,220,87,255,255,38,79,242,199,90,190,
+154,70,43,208,71,248,224,127,14,31,187,86,18,38,43,209,67,191,239,174,119,4,156,135,135,148,103,99,168,218,111,92,75,34,48,36,193,162,36,227,
+240,171,231,48,178,160,152,33,171,106,130,209,79,75,166,193,0,16,79,96,53,52,131,234,197,40,8,123,11,66,33,177,211,3,176,225,99,142,113,68,
+22,171,12,35,186,171,16,24,153,15,129,128,162,82,74,152,209,100,132,152,25,32,152,245,41,168,115,28,72,238,134,234,32,134,114,71,132,113,214,161,
+87,194,195,255,124,207,229,173,255,255,254,96,63,223,47,255,110,6,102,255,15,255,242,182,231,158,155,188,250,50,241,79,46,25,158,196,255,164,135,201,
+47,200,122,60,228,203,168,150,253,253,64,180,143,184,177,210,148,108,52,38,27,37,72,126,158,1,67,151,104,175,43,56,154,33,136,132,144,233,52,138,
+169,14,140,104,147,140,72,92,133,56,126,133,32,145,138,64,47,134,192,130,0,89,23,3,153,23,1,0,136,9,48,39,141,208,139,137,80,110,130,56,
+30,142,40,4,20,24,76,145,248,227,140,105,100,136,153,129,137,185,30,141,24,172,144,199,47,79,255,146,215,201,179,255,255,122,223,254,194,127,209,171,
+249,120,127,253,204,255,252,10,62,126,43,105,139,4,31,73,47,133,7,52,30,207,20,51,15,173,115,186,112,251,149,119,21,226,60,252,229,119,130,150,
+180,188,30,180,207,170,146,219,161,124,34,46,75,76,171,5,175,34,84,162,170,14,73,189,187,34,66,96,133,170,91,38,20,198,170,69,45,60,75,104,
+39,67,84,214,12,13,40,136,212,181,130,16,0,203,160,120,205,88,109,198,64,10,67,164,73,10,84,70,10,188,26,70,148,147,66,156,219,194,44,205,
+69,156,130,201,100,45,202,132,31,249,147,127,248,190,125,75,63,251,211,255,255,252,74,127,253,130,186,207,127,194,143,235,245,17,111,146,175,241,168,249,
+6,242,186,31,114,63,125,38,36,150,31,12,173,100,118,72,124,208,55,190,214,182,125,0,56,4,227,140,231,231,127,64,204,246,243,188,207,158,89,12,
+238,164,239,157,129,45,77,174,82,215,9,102,140,236,33,59,185,20,73,13,98,8,116,155,215,209,228,97,184,200,106,68,7,34,38,176,202,78,229,136,
+210,120,192,94,45,103,120,156,40,236,144,162,220,46,101,134,45,138,202,60,137,198,11,36,110,105,32,180,154,98,132,133,224,179,201,27,254,58,159,251,
+22,127,249,119,255,255,254,147,191,254,118,26,2,124,8,197,71,248,2,127,216,47,254,149,159,78,156,150,40,5,150,47,29,106,159,199,192,217,131,173,
+24,150,33,211,239,77,89,154,155,42,152,162,197,194,244,120,191,99,111,44,134,95,68,215,184,192,206,190,216,30,188,146,194,165,187,59,86,38,110,212,
+117,100,227,47,51,118,142,141,156,151,160,178,192,193,194,51,173,28,215,240,254,91,244,250,2,177,121,82,133,209,102,165,63,43,65,33,42,210,190,98,
+147,116,89,144,112,34,243,157,16,229,243,29,164,235,0,2,9,20,124,158,63,211,179,255,233,1,255,248,138,255,255,206,103,87,239,253,149,191,235,203,
+164,7,136,167,210,191,195,0,239,186,119,254,171,31,152,207,220,155,121,25,175,65,98,77,184,180,71,38,38,64,254,21,197,4,27,196,54,158,204,70,
+146,7,50,60,230,69,19,247,114,149,58,40,37,41,212,155,228,142,222,10,64,40,84,105,37,226,141,80,33,125,71,47,75,33,21,21,245,74,89,215,
+170,76,116,140,0,96,217,76,4,153,96,68,45,45,224,163,29,242,190,81,115,88,76,112,148,30,211,47,12,229,119,22,100,197,8,50,5,46,240,192,
+65,186,6,127,209,131,255,132,151,246,189,255,255,231,223,165,95,255,251,166,127,253,204,126,95,210,146,196,140,168,187,15,125,82,127,111,207,84,253,115,
+158,131,77,223,98,15,42,127,28,44,85,226,8,184,209,221,191,37,92,230,200,194,34,212,38,200,226,92,73,90,13,68,246,65,99,42,69,164,254,32,
+38,126,21,36,138,56,224,38,100,35,40,92,162,124,22,224,254,62,67,226,106,67,30,76,129,0,8,69,60,44,230,136,44,35,164,2,1,14,46,196,
+158,49,196,250,0,66,210,66,160,150,111,96,98,107,162,134,67,229,58,25,230,74,4,231,195,53,207,241,134,255,208,113,128,255,255,255,244,93,161,151,
+255,75,47,223,214,121,255,178,39,227,11,212,88,196,43,127,151,48,10,83,47,205,203,217,79,229,53,200,126,237,140,197,128,159,81,174,136,188,193,48,
+73,113,3,172,156,77,224,177,177,168,228,157,70,104,40,32,254,226,19,109,91,198,231,6,80,75,89,243,190,108,19,88,58,16,36,10,34,159,52,195,
+13,50,193,5,18,161,150,11,19,18,19,50,162,3,48,234,17,160,189,26,97,127,14,129,45,10,16,141,32,80,89,42,112,237,37,145,237,27,18,177,
+19,114,189,17,242,11,33,249,2,125,107,191,255,0,74,20,255,255,255,159,107,20,255,177,209,99,255,170,127,255,157,103,253,158,254,137,201,63,16,28,
+3,130,197,126,244,146,187,45,154,12,250,101,188,201,186,8,246,132,204,238,78,8,113,91,253,130,184,71,234,125,121,116,194,31,138,58,216,155,50,154,
+132,79,236,96,3,26,64,241,134,175,92,56,32,50,33,66,212,214,239,205,15,183,110,69,209,166,43,68,9,115,5,145,99,34,23,22,2,212,50,213,
+132,70,243,248,31,240,49,21,131,223,46,164,209,21,34,217,31,144,61,73,16,254,76,240,21,44,18,47,3,19,75,49,47,131,119,255,214,160,191,191,
+255,202,119,255,246,73,255,255,14,173,58,255,12,95,221,130,204,60,50,255,131,71,240,85,252,68,54,157,140,195,181,28,218,159,58,67,157,214,241,120,
+76,186,26,213,153,210,107,49,123,194,60,200,237,197,51,20,188,113,50,239,148,147,102,165,187,196,96,83,88,11,193,183,226,75,166,219,123,83,14,102,
+82,223,91,33,161,54,23,80,135,92,126,27,53,67,129,240,144,219,217,161,224,56,152,102,232,20,197,94,162,140,46,165,73,86,30,129,18,127,165,80,
+204,228,208,155,33,198,41,40,202,46,139,58,52,72,114,13,221,58,191,226,53,255,213,51,255,253,113,255,255,240,173,255,213,235,158,247,231,151,103,15,
+115,175,235,135,253,68,186,200,145,231,91,175,94,159,165,247,87,61,81,137,4,67,99,144,133,42,76,71,66,166,119,0,200,91,238,13,26,88,113,64,
+108,124,1,210,8,112,102,171,92,14,161,150,0,129,221,17,248,20,80,149,210,26,12,5,73,233,212,96,189,13,119,4,55,48,164,63,69,43,129,67,
+6,177,112,208,131,209,244,35,107,59,41,10,0,13,200,134,146,50,134,157,226,186,138,241,77,149,120,77,44,24,223,41,232,1,19,89,84,133,33,246,
+204,243,254,41,95,253,48,63,173,143,255,254,245,253,189,255,255,230,245,255,243,137,244,138,180,134,17,227,215,232,149,249,110,255,37,143,100,29,64,33,
+161,170,207,169,103,129,255,102,235,5,181,163,69,67,70,171,17,231,125,67,57,0,33,32,45,80,84,26,242,39,12,114,123,37,16,113,75,209,56,78,
+144,24,33,18,229,25,101,9,50,99,227,21,224,39,27,243,116,55,180,106,33,82,50,20,32,239,63,162,153,64,161,137,23,96,242,25,178,172,51,50,
+24,38,144,107,8,83,13,11,132,41,2,35,47,28,113,87,55,208,11,59,112,11,56,54,176,251,103,127,243,148,244,156,255,255,255,191,143,120,159,252,
+186,15,119,251,59,255,218,211,240,181,192,34,176,84,229,91,205,11,188,30,126,239,94,204,253,202,28,197,110,120,163,116,201,241,124,222,207,1,130,89,
+98,187,18,98,111,128,21,70,214,80,123,215,13,118,37,78,196,79,174,24,131,198,143,164,76,200,100,216,132,32,0,20,164,102,54,69,50,64,66,58,
+28,129,180,5,36,24,11,100,0,9,130,64,34,64,112,42,128,134,26,128,150,3,32,126,31,160,226,49,225,250,55,99,82,54,228,94,55,36,166,58,
+100,42,58,163,26,46,224,119,199,227,255,223,27,225,117,255,248,51,255,255,211,15,254,161,223,174,199,255,141,31,251,113,89,15,83,31,104,142,30,244,
+50,138,212,134,231,228,185,86,15,238,117,217,15,189,22,11,237,57,50,236,219,122,30,114,143,215,74,123,161,157,0,204,49,114,14,206,254,128,16,153,
+38,116,226,171,44,202,44,46,214,203,50,88,103,225,23,248,25,67,213,63,137,172,92,209,161,116,92,161,64,81,192,14,193,221,25,143,13,113,12,252,
+196,128,0,66,75,184,238,205,64,222,67,40,74,202,20,54,145,236,61,15,252,59,199,188,202,192,93,9,65,184,212,197,135,54,143,239,201,255,231,93,
+254,64,255,255,255,231,191,253,234,62,198,94,48,60,164,255,236,45,255,167,63,249,229,116,87,51,172,211,48,145,191,112,10,16,108,151,5,76,62,237,
+93,136,254,235,88,126,208,128,16,96,255,137,246,181,122,56,97,134,219,0,183,44,90,185,103,79,102,74,214,151,192,3,72,134,82,23,129,149,148,95,
+199,72,102,30,158,49,146,205,86,153,114,51,129,170,128,200,196,88,225,70,33,39,246,78,225,192,109,102,252,77,37,80,0,0,114,53,6,138,26,202,
+102,96,172,175,6,152,15,214,94,114,184,169,225,123,158,30,193,122,220,241,155,205,103,197,171,255,254,208,159,255,147,247,61,95,255,189,127,108,79,10,
+31,177,89,202,236,119,236,43,111,47,185,61,171,54,17,41,82,206,119,185,185,11,84,179,168,77,68,43,246,101,101,105,142,15,22,178,223,67,44,44,
+114,183,86,154,118,237,145,36,194,202,92,141,221,69,64,253,141,1,198,144,129,19,179,104,83,207,84,135,231,138,214,176,49,153,74,67,210,52,216,227,
+14,153,168,146,200,224,108,184,163,160,83,33,76,40,2,142,111,4,162,79,67,254,37,227,154,181,102,143,23,87,75,160,29,62,108,155,148,158,41,123,
+86,234,95,198,55,114,27,2,127,246,218,255,255,248,171,14,31,255,192,213,254,193,139,247,205,174,12,62,126,123,40,117,191,78,59,241,76,237,251,172,
+38,85,116,150,70,3,54,205,72,242,182,146,159,134,118,217,184,100,105,172,86,100,89,221,103,53,138,166,38,87,214,163,21,131,158,146,64,137,156,125,
+6,116,72,162,92,196,165,86,222,46,166,198,178,195,92,25,157,181,236,51,96,78,171,240,107,44,118,115,32,50,207,35,112,168,34,82,96,16,241,178,
+6,192,111,14,194,223,9,212,217,69,182,181,137,44,83,107,151,82,124,93,242,7,209,23,106,29,163,248,163,196,39,254,208,31,255,252,150,63,194,115,
+255,47,63,245,163,250,66,127,196,54,111,54,21,237,211,139,41,160,248,199,204,251,88,144,63,100,171,16,241,52,162,143,12,132,198,180,54,191,143,201,
+214,210,57,92,166,177,40,204,251,103,106,221,108,137,59,172,61,167,41,34,73,26,36,147,81,7,176,203,11,89,145,157,123,52,176,12,4,223,174,18,
+112,207,131,76,32,222,213,208,217,189,98,210,164,237,74,196,124,195,204,27,64,200,37,130,104,52,128,224,0,67,236,121,76,37,42,215,222,2,113,173,
+158,189,117,111,139,144,30,117,58,215,238,47,199,190,214,191,11,207,255,247,226,255,255,109,15,252,91,255,200,173,61,46,31,254,21,122,108,126,106,46,
+39,107,188,213,226,34,65,57,22,218,210,189,116,236,92,193,250,226,156,94,253,230,150,99,126,173,22,42,177,217,130,12,93,114,167,125,163,118,55,82,
+10,208,0,241,47,56,100,77,4,142,132,118,128,142,142,2,143,118,186,236,107,40,213,49,160,11,2,199,165,242,89,158,18,102,218,231,164,82,125,228,
+42,12,100,6,59,194,98,62,128,72,12,65,148,58,32,102,126,166,118,192,175,31,9,218,19,208,191,3,60,45,115,123,213,31,98,254,20,187,36,212,
+67,255,250,60,127,255,191,162,192,127,254,6,38,30,118,95,231,54,53,26,160,251,50,193,67,208,140,50,168,27,1,176,10,7,2,21,185,81,46,232,
+109,2,75,61,110,32,235,29,247,159,155,162,182,20,88,221,113,108,131,135,51,198,56,205,234,62,207,85,85,161,191,157,98,92,158,161,87,172,200,45,
+207,204,75,232,246,183,240,215,149,42,104,210,188,203,100,110,140,170,30,192,224,150,189,227,156,100,97,228,22,1,230,101,132,110,86,4,66,20,99,218,
+161,166,83,16,118,199,158,93,15,108,71,142,238,32,123,30,233,119,196,7,136,216,219,127,198,123,255,255,213,83,246,234,255,252,78,118,115,48,239,126,
+127,127,59,88,127,65,249,62,114,37,197,53,31,183,181,147,180,90,212,41,116,23,130,88,150,92,147,70,173,149,66,212,19,72,43,220,114,240,158,103,
+39,10,190,101,89,142,148,64,51,148,45,235,104,21,50,140,38,82,48,167,212,82,193,250,13,173,102,168,52,121,53,186,213,167,12,127,224,86,153,242,
+15,20,24,47,136,89,207,148,120,153,27,185,202,18,41,57,2,0,73,142,145,197,133,146,154,155,187,26,195,182,2,53,237,158,126,41,248,153,231,35,
+179,206,176,124,132,241,233,250,84,127,255,220,235,255,233,253,241,177,255,250,69,252,134,190,234,254,91,241,23,209,71,215,174,218,223,97,218,128,101,122,
+230,177,134,185,222,120,11,11,122,137,17,78,91,49,202,215,105,41,148,54,110,154,89,103,129,149,54,149,215,20,204,26,162,21,178,163,147,105,75,216,
+102,25,96,17,66,36,30,219,92,91,99,178,150,177,9,135,123,88,206,133,72,101,230,178,110,158,215,38,38,215,160,182,142,96,34,24,225,234,71,131,
+38,94,66,54,30,64,198,76,33,206,182,167,75,3,216,54,202,22,184,245,121,201,151,25,61,96,118,29,223,239,110,114,18,255,232,237,255,255,238,13,
+108,143,253,173,126,140,189,252,63,233,114,12,58,123,246,53,162,251,235,247,173,193,179,183,125,60,23,236,185,242,150,140,191,56,0,85,214,10,243,21,
+156,227,249,55,78,99,23,50,215,27,55,236,8,180,2,165,150,12,18,238,149,228,46,150,121,72,6,200,49,133,204,196,209,133,110,219,213,212,97,19,
+4,56,95,194,181,247,224,150,208,109,166,165,169,26,123,164,74,77,96,182,24,160,220,20,64,188,37,192,126,11,66,158,58,230,22,158,107,111,7,216,
+181,208,86,185,247,183,200,215,53,253,124,246,201,228,27,114,191,149,247,255,250,88,127,255,194,243,255,2,31,245,27,128,246,53,127,214,103,20,143,187,
+140,145,105,79,159,76,127,64,103,76,124,70,47,235,94,197,62,28,110,44,134,171,221,241,102,183,132,209,162,168,93,126,161,229,211,194,146,89,231,100,
+57,35,12,233,18,234,217,8,116,193,9,232,61,39,108,200,161,74,215,236,122,187,178,75,89,185,157,182,92,80,96,134,202,176,127,63,214,189,47,83,
+137,41,48,113,31,113,94,11,209,90,8,224,38,14,161,139,6,19,79,54,213,93,118,216,27,206,110,130,55,99,194,143,44,93,65,245,193,224,187,194,
+220,183,63,253,21,191,255,240,76,252,107,63,255,132,62,50,114,254,254,80,57,60,145,239,229,171,41,47,8,54,199,119,25,15,154,10,78,60,222,31,
+68,11,118,106,249,56,103,73,99,188,238,157,54,45,162,183,38,159,71,93,135,54,228,5,41,11,99,94,232,243,48,156,25,25,34,4,200,13,15,4,
+21,70,186,107,229,219,18,216,135,173,61,59,207,190,135,106,130,249,238,222,93,175,234,3,42,234,6,34,74,46,228,216,68,102,188,41,98,164,0,100,
+42,1,234,162,83,239,22,238,49,131,167,77,18,113,151,193,215,75,157,83,118,219,226,71,112,31,56,143,255,254,74,159,255,9,207,197,151,255,144,126,
+65,219,108,255,19,185,81,122,138,240,53,72,15,129,253,34,183,1,11,1,61,38,118,58,111,37,220,193,66,46,152,162,101,217,76,174,111,146,204,231,
+33,120,172,240,54,124,149,55,18,134,116,205,154,15,80,140,156,144,157,203,57,81,207,216,237,212,236,70,103,226,40,52,225,86,216,151,201,157,50,105,
+102,90,50,79,64,212,243,94,208,10,96,18,38,50,81,12,13,161,29,54,130,117,44,2,61,13,241,221,87,147,25,139,11,120,207,166,147,246,19,201,
+47,15,125,157,244,221,226,59,192,253,139,63,240,70,255,255,249,20,118,106,255,248,178,236,46,192,223,125,30,167,41,77,249,180,160,246,142,59,69,202,
+91,172,253,255,169,230,217,204,228,110,150,246,138,181,235,48,234,193,227,54,77,29,49,60,224,57,117,141,171,176,156,193,179,44,232,161,99,248,174,19,
+200,87,194,222,97,132,143,62,231,61,32,117,243,133,234,1,211,21,15,101,189,250,116,7,72,243,175,243,42,192,121,53,208,168,48,135,29,108,21,5,
+143,143,92,137,1,216,191,79,33,103,77,129,10,65,92,44,81,76,113,151,124,79,144,36,101,67,53,8,198,73,77,217,179,247,160,255,224,165,26,47,
+255,255,23,95,252,235,255,255,232,129,253,60,225,167,211,176,101,122,112,254,248,223,154,255,186,3,209,204,7,198,251,200,143,209,171,67,218,122,22,178,
+137,206,153,201,91,192,80,65,64,81,128,252,132,75,9,92,202,208,238,72,164,102,31,141,74,33,150,85,199,62,116,230,69,9,54,30,120,18,218,21,
+115,19,79,70,179,109,164,187,51,96,248,33,213,228,78,182,110,46,178,120,26,34,95,79,164,165,69,194,227,6,96,156,59,210,208,85,17,188,56,113,
+161,8,116,167,19,165,55,6,35,9,30,16,43,36,59,60,127,224,117,255,188,103,255,31,127,255,249,130,187,159,255,243,208,255,251,203,254,41,12,65,
+134,218,143,115,144,250,81,255,15,111,137,79,37,3,58,196,55,203,195,193,23,192,27,5,184,81,42,68,40,235,181,48,184,115,33,56,41,9,97,182,
+136,81,68,140,120,151,147,121,22,134,122,35,133,194,58,129,184,237,151,88,195,38,25,107,27,104,127,1,224,247,156,145,168,161,0,202,141,176,225,10,
+26,19,19,201,216,8,8,114,11,192,254,150,113,135,141,128,240,136,24,3,155,40,102,31,232,37,149,57,42,135,25,229,128,1,192,131,217,92,165,231,
+166,199,255,132,151,221,251,255,255,250,220,255,7,223,243,168,240,76,255,230,75,255,199,227,237,207,42,235,43,52,234,156,247,10,246,57,250,116,115,197,
+187,36,128,180,243,243,190,240,127,236,29,111,84,232,134,69,209,115,212,202,134,170,143,90,28,168,121,41,120,80,76,21,20,146,188,181,69,169,192,205,
+201,143,68,240,148,200,28,73,142,52,148,9,220,80,0,44,17,199,136,56,201,120,13,70,48,62,129,216,110,0,164,97,0,100,35,128,184,30,192,184,
+76,65,92,90,68,188,89,71,204,91,201,92,108,72,252,128,199,148,135,197,156,119,73,223,21,79,249,67,127,215,139,220,167,255,255,255,69,31,235,105,
+253,36,191,60,184,4,255,67,207,245,11,254,19,219,161,167,36,165,131,221,63,247,218,226,175,216,34,234,173,53,84,13,80,123,249,116,91,223,130,87,
+224,215,63,140,242,245,248,212,246,157,14,34,141,176,26,192,254,172,215,29,98,196,89,84,182,2,160,172,67,35,106,117,130,218,124,235,172,249,46,224,
+165,102,92,32,4,130,186,201,130,197,69,58,75,3,84,64,41,32,125,103,196,74,224,192,17,198,70,71,200,238,38,134,38,51,97,142,129,225,8,144,
+160,102,91,35,226,16,229,202,84,158,187,31,255,94,72,23,127,255,122,31,255,229,223,255,252,102,31,183,249,7,255,32,138,69,243,23,254,12,31,168,
+95,206,115,15,181,212,129,176,175,134,117,31,39,91,129,195,6,137,213,5,177,53,221,139,69,187,121,44,202,102,209,99,59,188,180,50,105,133,18,6,
+189,188,133,177,179,172,101,135,82,72,111,222,78,32,85,165,149,132,71,204,224,67,22,230,29,145,91,137,50,119,149,161,116,33,236,11,154,101,199,11,
+172,83,11,41,19,215,225,123,80,80,186,67,228,82,149,60,208,24,84,83,141,4,166,192,233,93,199,25,75,65,232,164,69,71,28,111,236,41,255,248,
+235,127,248,126,255,255,238,175,133,119,254,137,95,212,108,206,127,81,47,220,111,200,153,190,59,234,254,147,31,94,159,112,139,181,175,132,83,26,110,57,
+64,238,20,74,80,31,96,100,199,144,249,155,68,160,215,232,126,215,182,16,22,125,153,52,251,204,64,83,96,143,4,203,6,197,58,46,163,12,23,15,
+19,8,137,112,193,185,116,71,56,167,148,222,16,78,250,251,134,190,66,134,52,122,174,112,187,172,0,92,33,180,59,136,102,147,203,234,102,71,78,34,
+160,12,160,100,96,194,226,76,123,99,210,17,40,214,56,74,214,202,95,195,195,255,149,3,46,127,255,251,229,255,215,175,255,255,47,111,248,100,138,95,
+85,135,47,219,15,245,186,253,187,254,239,216,180,148,79,80,175,34,95,136,119,60,189,58,141,84,126,103,145,34,121,186,47,169,196,0,32,177,132,224,
+111,146,248,101,30,88,58,140,186,34,143,83,129,149,162,184,131,168,91,166,137,203,53,138,12,31,232,92,8,193,163,168,82,84,168,161,6,141,129,32,
+16,138,148,27,122,66,12,40,141,13,33,55,155,241,235,147,145,60,133,120,9,157,88,165,37,136,53,26,136,246,136,169,245,130,226,15,129,177,199,171,
+215,207,235,255,146,247,218,35,255,255,254,104,191,80,95,253,101,3,23,251,79,255,198,59,224,90,244,89,218,96,38,210,154,127,121,15,254,58,95,19,
+191,38,137,85,144,238,184,220,122,123,225,111,51,139,34,115,151,172,163,44,51,91,138,36,175,129,195,156,25,142,64,165,11,27,140,47,11,28,188,192,
+233,20,195,144,204,64,140,71,68,84,23,4,92,53,129,20,45,130,112,40,132,64,50,132,72,62,3,152,57,131,8,34,2,72,3,128,176,21,65,188,
+40,68,108,59,198,156,87,199,132,119,199,148,142,199,84,146,199,44,122,198,164,100,77,83,175,151,255,218,179,167,247,255,255,88,223,252,214,127,213,115,
+232,241,255,240,109,255,243,0,252,183,102,5,138,133,106,89,186,231,153,193,241,224,150,72,252,103,21,201,231,213,19,177,79,14,104,28,148,158,13,219,
+60,241,156,217,14,204,76,190,142,49,110,195,70,212,215,227,114,5,51,75,53,56,160,204,50,165,138,133,70,94,102,40,68,244,109,152,200,103,152,26,
+34,70,137,72,94,191,70,134,113,128,192,10,103,80,92,40,184,82,164,28,9,162,118,54,198,218,59,134,194,2,227,126,83,32,94,131,160,28,119,162,
+66,66,101,38,9,38,70,12,93,186,191,253,21,189,27,191,254,62,127,255,254,10,255,255,161,212,216,63,190,15,218,121,101,62,43,63,214,163,241,203,
+243,158,135,56,137,66,144,128,18,159,37,172,18,242,248,107,176,108,175,182,110,252,113,182,139,195,145,203,78,62,113,153,199,230,241,159,204,182,26,149,
+75,223,227,9,90,223,94,237,201,147,125,31,218,2,138,242,242,151,11,4,17,169,69,179,212,10,227,68,218,107,44,9,162,106,191,203,122,250,201,226,
+131,64,138,51,168,48,173,105,232,160,35,76,49,101,246,54,203,198,73,74,146,5,228,134,110,225,64,166,35,68,145,224,161,214,131,254,149,159,248,202,
+127,254,116,255,255,254,230,191,255,75,72,242,124,27,92,227,237,49,255,6,63,250,19,125,219,245,56,155,134,173,253,230,52,153,196,40,112,69,97,69,
+9,8,163,100,193,18,217,24,34,88,95,187,117,67,109,65,119,184,158,47,137,253,180,213,180,232,241,113,86,212,84,212,125,94,138,95,202,234,121,171,
+248,96,230,6,201,145,55,144,19,248,175,0,98,139,187,51,51,156,49,22,29,56,0,148,90,84,9,106,216,225,73,202,80,74,74,180,166,24,92,210,
+150,60,22,136,236,230,67,201,119,199,1,53,192,28,133,67,7,73,111,249,25,127,251,29,127,255,120,95,255,241,233,238,93,255,137,7,254,180,126,116,
+153,174,122,116,247,84,27,46,74,191,164,71,233,15,249,34,114,225,171,196,27,41,239,175,5,211,236,168,137,164,136,97,3,138,54,1,28,76,163,200,
+85,226,194,37,77,38,142,16,37,41,132,19,50,242,30,130,154,193,65,20,198,139,148,160,77,233,173,217,218,90,247,160,16,103,136,26,78,36,171,88,
+31,58,7,1,80,73,161,129,238,170,1,203,147,224,76,141,169,36,36,153,94,35,8,37,15,137,133,131,130,137,135,194,60,133,121,2,150,24,64,29,
+61,127,63,241,216,255,201,59,254,55,127,255,252,185,201,231,255,250,135,127,254,93,127,165,2,24,99,11,16,45,80,61,64,255,25,15,48,157,121,26,
+243,70,191,110,15,74,63,69,76,240,100,172,188,147,193,204,19,22,91,128,67,84,161,134,121,161,87,138,6,230,240,149,226,134,34,231,218,0,39,138,
+26,164,134,54,98,122,46,98,46,16,225,246,3,0,146,0,129,184,9,99,100,2,227,28,24,129,108,54,128,62,62,192,146,37,0,96,6,33,84,42,
+96,244,54,33,14,43,227,162,31,37,110,33,101,130,53,36,54,75,98,166,79,225,158,107,245,118,255,87,15,252,135,179,135,255,255,255,214,39,195,203,
+255,23,15,227,78,215,63,178,71,240,89,248,47,64,141,116,239,188,35,112,201,237,17,227,227,239,101,195,150,236,11,189,124,158,168,93,74,122,18,99,
+6,245,7,101,73,220,75,51,239,184,245,4,200,200,57,163,155,15,74,213,189,196,19,64,128,7,27,45,96,161,66,162,73,90,18,2,44,114,233,164,
+145,105,28,57,98,232,64,3,10,137,68,210,118,1,178,34,130,212,47,101,40,80,163,88,54,161,42,10,37,86,11,198,246,11,101,122,61,162,242,101,
+161,70,106,161,78,74,99,247,62,239,196,195,255,241,94,234,147,255,255,254,67,239,229,254,149,84,201,254,93,255,254,4,95,248,189,254,71,208,235,134,
+46,144,80,93,45,234,113,73,126,144,132,193,8,29,230,56,97,243,248,199,214,65,199,137,82,125,85,56,34,234,49,124,244,218,30,10,96,218,123,62,
+250,223,82,92,112,3,162,82,50,102,183,60,117,33,102,42,67,88,232,112,216,143,124,25,19,204,129,11,81,26,95,217,155,92,144,179,199,104,173,141,
+165,132,20,253,51,11,44,17,132,89,4,77,65,101,72,64,233,197,252,34,82,196,85,149,204,39,13,196,105,65,252,196,88,219,240,32,255,252,228,186,
+65,255,255,227,35,255,51,63,255,233,133,241,97,242,137,254,168,158,102,225,171,239,201,249,188,254,234,158,92,58,233,0,25,54,197,240,9,129,190,56,
+140,110,236,131,108,188,182,46,193,71,10,74,69,168,224,172,74,62,174,89,74,214,178,149,164,128,18,210,209,150,230,8,114,182,145,24,183,10,100,36,
+99,105,65,88,185,52,57,7,22,2,218,196,194,7,240,132,61,18,64,51,68,35,123,6,93,103,99,39,15,193,240,70,84,246,100,211,136,61,176,251,
+1,101,43,39,6,95,22,100,7,29,176,127,73,113,238,87,244,108,252,88,191,250,52,106,229,255,255,196,223,255,236,23,255,255,183,71,241,209,171,207,
+73,68,68,245,235,255,35,143,235,151,248,131,96,130,107,188,215,58,165,248,243,104,87,110,128,103,17,87,90,48,179,88,23,97,155,35,32,95,48,52,
+154,130,235,16,58,232,122,5,251,118,174,84,205,217,129,248,193,176,4,91,29,149,35,98,212,139,102,40,67,56,151,238,12,218,173,200,103,228,20,85,
+198,90,213,74,14,187,132,174,42,196,16,104,233,92,160,230,240,97,161,6,8,8,158,70,75,42,37,71,122,58,97,166,142,162,24,154,225,144,120,231,
+1,237,241,255,174,247,248,184,127,255,255,79,191,249,103,255,239,137,27,47,240,181,254,166,153,174,210,247,196,107,77,116,126,228,217,239,103,250,191,124,
+156,124,117,163,78,67,249,254,108,55,202,243,38,218,190,24,105,18,186,180,60,223,129,184,200,232,128,74,84,6,142,156,50,201,252,141,198,228,133,73,
+68,45,204,76,12,9,156,25,65,92,110,199,16,146,201,88,63,196,120,81,130,76,195,5,84,195,1,180,86,132,240,43,73,88,115,199,88,89,192,36,
+17,72,52,28,12,124,4,203,4,98,198,164,190,67,28,223,67,12,170,69,124,108,204,83,174,167,255,194,51,232,225,255,255,242,155,255,150,111,245,250,
+251,243,127,252,4,255,252,103,63,44,154,134,83,177,173,203,135,150,87,133,239,189,198,253,53,122,147,246,148,62,115,94,35,253,242,177,125,121,6,178,
+179,158,146,90,146,225,241,60,18,132,30,136,255,198,178,183,111,173,5,80,6,4,214,195,74,40,76,161,130,140,129,48,7,27,249,190,34,233,206,16,
+152,168,9,192,126,155,16,222,154,176,72,140,64,160,3,89,40,11,72,237,8,184,26,1,184,194,129,241,66,129,201,53,139,120,222,148,200,151,152,152,
+150,148,216,200,140,120,237,159,199,141,23,255,230,221,45,15,255,254,67,127,248,178,255,233,173,184,103,255,37,127,254,238,223,170,141,67,180,154,222,15,
+85,97,55,81,188,14,26,132,171,47,17,167,223,126,238,71,187,104,62,217,1,222,59,97,62,59,155,171,223,33,242,206,182,47,152,255,225,85,147,188,
+101,28,84,245,86,26,177,179,38,172,11,97,40,41,39,163,196,60,226,1,11,214,44,39,80,83,72,165,77,125,197,109,89,65,29,6,67,192,61,21,
+220,71,19,186,26,80,161,27,36,51,48,228,245,20,194,227,32,240,61,74,209,10,79,208,18,47,177,255,5,211,31,68,239,154,183,255,228,113,54,127,
+255,250,141,255,245,223,255,254,113,156,189,254,226,191,226,217,225,166,158,255,29,111,198,247,242,156,234,67,136,225,40,15,43,60,39,2,224,218,170,59,
+113,122,19,166,189,192,91,46,156,228,174,162,237,0,135,27,218,194,103,47,120,43,127,165,32,197,196,254,67,24,68,208,18,133,167,136,30,237,115,10,
+10,7,202,2,11,232,148,16,199,175,0,200,13,197,169,95,81,80,71,9,149,167,24,221,208,146,180,181,128,48,181,207,241,139,208,249,79,66,176,102,
+207,36,101,153,44,132,21,4,24,71,220,214,68,201,56,87,243,246,92,255,247,144,197,255,255,255,35,255,254,53,191,255,251,241,127,199,228,213,252,155,
+170,3,151,223,238,17,253,229,255,187,39,175,206,130,140,229,85,126,1,88,43,222,184,229,202,192,235,128,240,1,20,33,110,218,17,43,65,168,160,33,
+15,12,106,47,185,99,158,138,249,3,72,158,11,212,141,106,166,151,16,18,106,130,60,15,163,130,221,200,146,18,6,212,174,48,52,107,182,234,39,49,
+102,55,163,221,110,229,93,86,194,99,8,97,238,65,148,84,90,50,220,55,177,37,1,180,209,30,133,227,16,35,221,28,176,191,66,113,136,83,248,15,
+127,123,175,254,70,149,3,255,255,249,234,254,206,191,255,248,88,127,240,137,177,215,20,203,44,201,151,230,213,249,141,254,93,220,101,219,227,86,206,206,
+63,32,143,11,254,121,17,227,40,9,8,77,126,218,82,131,123,34,221,8,177,146,54,112,194,35,81,219,17,50,121,36,80,185,71,112,232,76,80,28,
+36,82,137,19,164,177,49,100,1,29,128,173,16,146,248,49,180,134,38,242,242,7,96,17,53,226,77,67,194,37,37,64,19,11,209,248,48,114,80,51,
+48,120,26,50,55,0,132,19,6,196,1,13,82,103,42,16,151,57,144,102,68,185,72,127,145,103,254,106,77,235,255,255,255,17,245,105,255,249,199,127,
+161,248,105,124,43,60,206,238,157,122,46,13,124,250,156,237,195,251,231,122,182,253,70,187,207,237,248,73,174,147,169,150,213,60,34,49,59,148,224,253,
+167,92,40,168,27,22,232,184,150,97,86,159,152,233,53,41,18,41,40,40,144,233,56,129,121,98,129,80,210,129,232,43,130,88,42,1,224,58,75,14,
+64,154,16,193,8,11,97,128,4,193,118,4,0,192,8,64,77,10,161,31,3,33,81,13,113,21,31,208,229,42,177,49,40,209,229,30,146,139,19,210,
+143,14,115,51,156,55,244,4,255,222,184,86,255,255,255,245,5,176,119,253,208,189,107,249,102,255,127,79,221,95,198,152,87,97,167,100,227,142,176,191,
+146,215,150,143,172,246,155,114,250,139,102,49,189,61,185,121,240,214,177,90,158,37,36,251,238,29,135,205,1,163,106,32,1,69,4,86,98,150,10,132,
+52,40,65,132,106,135,152,18,251,150,113,161,129,224,43,15,25,74,17,89,84,5,8,167,10,64,3,18,192,46,144,176,15,7,208,95,1,24,112,6,
+88,38,7,136,86,135,136,197,136,233,8,140,25,20,143,217,5,145,216,239,145,88,204,142,73,53,204,227,244,40,255,244,196,99,191,255,255,252,157,234,
+141,254,124,23,173,253,25,127,247,240,255,150,31,221,234,73,230,71,49,132,98,161,159,83,110,71,124,162,33,126,28,185,252,113,185,241,140,230,119,168,
+211,206,152,77,94,180,57,213,155,69,250,15,55,233,244,182,245,185,232,121,108,118,166,91,243,89,60,233,22,191,180,111,83,104,215,69,180,222,23,101,
+170,150,5,46,4,116,18,142,88,197,214,192,207,207,240,34,65,104,157,10,124,230,141,4,125,134,132,68,193,112,226,68,97,6,64,100,178,200,228,65,
+207,60,4,207,68,24,73,172,121,105,117,249,55,127,254,142,31,37,223,255,255,232,123,62,47,245,176,208,23,242,219,255,232,13,255,142,159,234,165,55,
+120,109,240,84,184,108,186,22,209,100,229,200,33,202,63,154,22,155,188,87,177,81,151,224,194,74,143,47,77,196,117,16,196,229,186,2,126,86,117,50,
+207,62,216,86,159,66,65,115,133,236,95,174,63,51,201,98,157,240,54,172,220,14,36,119,29,134,223,68,32,246,47,55,108,107,248,56,36,217,234,7,
+193,23,172,50,209,175,34,59,143,112,67,152,89,99,47,201,125,41,24,7,143,169,225,135,18,224,139,194,84,130,72,235,144,45,122,63,141,247,255,236,
+117,255,99,255,255,254,171,160,187,255,206,155,246,11,183,15,246,62,254,128,126,157,136,165,207,143,239,233,241,133,244,126,183,107,191,51,65,97,172,145,
+235,27,204,54,16,212,162,147,130,43,181,168,183,140,227,32,110,13,168,125,78,26,63,97,3,24,168,89,139,201,143,78,254,81,85,251,130,115,95,131,
+233,187,66,14,56,210,5,128,242,6,136,114,14,43,252,63,27,213,214,138,92,86,13,209,20,91,129,127,84,136,190,192,12,92,19,52,249,25,76,155,
+144,4,100,65,149,74,71,65,130,68,88,239,197,196,33,201,126,179,223,240,78,255,247,172,255,237,31,255,255,57,119,193,255,252,251,63,252,75,252,138,
+180,10,234,155,128,150,117,95,23,63,234,77,250,128,253,5,49,39,55,236,50,178,169,225,141,123,26,133,19,104,71,33,193,66,144,128,23,16,56,162,
+16,25,20,141,83,104,160,243,191,140,225,141,160,185,90,66,53,82,158,204,152,136,148,197,207,169,179,217,113,98,206,152,24,68,253,52,18,61,168,142,
+204,251,1,56,38,208,184,243,212,192,229,73,248,45,198,116,134,18,12,170,17,252,25,136,220,182,64,177,61,195,177,39,193,228,147,73,228,13,139,118,
+240,159,250,239,127,226,1,255,211,239,255,254,255,112,240,255,253,39,63,255,114,223,240,42,83,155,76,209,34,244,94,34,127,148,151,197,7,191,34,66,
+200,239,190,23,144,15,179,71,23,156,100,133,109,128,238,149,131,142,10,212,3,97,33,217,65,20,90,128,106,23,49,24,22,19,25,145,130,217,240,131,
+121,90,138,88,175,139,104,108,133,88,98,129,96,46,131,80,69,1,64,195,0,88,235,3,64,165,9,48,47,13,160,45,139,176,52,131,48,9,135,56,
+17,14,232,33,144,184,155,142,57,34,139,25,114,138,185,94,141,120,249,143,120,120,131,14,253,95,254,252,95,136,55,255,247,243,255,254,53,255,209,43,
+252,230,191,255,16,223,254,92,94,136,160,3,166,228,147,193,207,105,238,28,125,51,166,234,49,26,65,115,109,246,120,239,195,205,138,110,98,57,73,204,
+216,119,224,218,255,12,41,58,130,130,53,83,54,133,87,219,137,4,60,192,212,35,32,114,205,82,117,93,134,67,12,64,48,66,116,192,92,181,54,52,
+178,60,15,225,51,67,162,213,74,225,191,39,96,202,6,242,192,36,82,220,35,16,252,13,17,121,6,163,49,8,3,99,11,242,89,38,241,35,56,48,
+145,53,176,213,34,114,7,150,87,221,91,255,244,180,232,99,255,255,254,25,103,213,254,204,214,15,254,30,191,253,214,191,243,33,253,160,171,154,151,185,
+96,65,237,7,168,141,54,155,243,22,217,58,228,153,176,207,81,237,201,241,250,91,52,57,177,198,164,59,57,107,131,86,104,4,157,107,195,97,103,109,
+204,124,99,85,1,114,31,63,105,215,202,218,164,112,92,98,16,86,50,198,213,136,4,35,224,36,125,100,128,92,71,58,237,139,182,220,198,114,72,2,
+232,90,169,120,172,104,188,131,161,108,26,102,234,57,139,134,61,9,230,16,164,94,110,96,204,159,98,208,141,224,33,212,227,254,249,95,243,176,255,250,
+67,255,255,254,20,255,255,193,96,106,61,220,105,149,238,233,254,152,255,247,246,254,69,62,133,8,2,243,250,129,85,142,158,64,236,7,173,128,17,131,
+67,49,202,96,224,241,77,216,59,11,123,73,206,131,24,219,223,95,213,202,144,229,161,96,25,127,90,81,90,237,162,18,253,10,216,34,122,242,242,154,
+59,142,27,120,136,171,131,189,199,209,246,221,184,147,195,97,28,19,150,1,76,122,195,197,114,20,4,76,144,105,232,203,167,44,132,97,98,12,41,178,
+68,204,242,54,137,98,36,34,162,125,99,28,167,236,205,252,78,191,253,38,49,91,255,255,225,63,255,137,143,255,255,28,239,252,255,91,243,173,5,142,
+107,231,249,8,127,81,63,240,164,248,243,241,2,44,74,18,241,236,211,31,87,72,142,179,65,49,9,121,168,4,80,213,156,226,0,140,176,72,166,42,
+112,71,61,144,32,218,41,131,154,196,169,245,43,86,208,132,89,50,12,138,25,169,180,12,222,33,155,80,112,29,198,37,90,21,101,227,146,101,46,0,
+236,20,208,249,10,87,121,28,205,184,99,195,244,112,146,84,199,149,92,87,12,236,130,193,149,54,68,193,86,65,208,213,70,44,48,68,39,50,111,253,
+243,63,244,254,255,255,61,223,255,223,255,177,151,255,29,111,255,175,111,251,7,84,230,191,122,103,21,118,195,191,128,167,228,107,249,132,117,91,189,84,
+60,177,145,237,61,203,207,146,117,143,95,56,160,26,150,75,82,133,128,147,39,137,144,141,155,104,78,32,232,75,149,217,18,142,137,18,145,216,116,150,
+232,3,18,72,44,131,120,185,140,145,2,146,224,136,139,192,122,0,217,97,8,249,145,5,104,229,5,208,25,143,96,213,143,32,232,131,80,120,140,120,
+10,152,8,5,153,152,138,146,153,57,138,9,166,133,137,125,134,185,110,185,39,215,195,255,200,115,146,247,255,255,254,126,248,240,255,221,130,50,63,198,
+47,255,36,239,231,223,216,144,222,36,119,51,72,246,106,155,240,66,245,187,245,106,200,189,194,43,149,172,63,128,231,79,126,57,22,77,76,133,120,168,
+254,13,217,70,214,50,99,227,244,2,208,101,113,138,11,181,84,13,67,96,89,83,124,226,28,85,22,147,76,102,1,196,105,204,64,200,208,64,128,202,
+8,38,0,216,176,4,252,210,149,139,72,73,5,48,78,14,80,21,11,144,82,132,9,9,156,138,57,185,219,247,204,70,138,118,225,196,7,42,125,84,
+246,39,225,83,202,5,91,255,235,21,255,255,156,55,254,71,159,255,185,143,102,122,231,126,126,60,240,77,227,243,235,132,119,78,216,125,172,188,99,76,
+125,166,160,115,161,209,241,231,237,52,105,198,115,10,84,207,29,8,17,116,82,198,203,22,78,61,144,112,230,64,190,25,204,66,234,8,83,112,21,185,
+35,46,105,243,41,186,75,153,220,208,202,246,178,42,71,53,88,107,186,108,205,207,214,82,165,174,217,102,190,63,167,166,54,198,10,92,129,122,55,3,
+24,14,164,172,80,225,52,127,230,218,177,112,107,128,173,77,232,55,135,238,41,121,246,236,175,179,47,29,125,134,244,200,255,255,95,207,255,238,21,82,
+255,255,191,45,141,44,67,253,2,213,155,166,239,114,152,23,124,0,101,173,158,232,57,128,144,127,174,180,104,147,203,53,168,50,104,133,143,165,191,57,
+211,73,243,179,21,14,56,1,100,125,91,237,180,149,211,84,131,38,165,66,159,13,83,144,54,218,170,70,148,71,94,150,24,41,47,94,147,113,177,10,
+191,200,14,20,41,139,34,209,15,131,152,50,158,184,203,136,129,84,160,17,31,157,32,51,134,48,138,22,200,77,46,249,93,190,252,9,227,175,95,218,
+95,229,183,136,238,191,123,13,240,29,227,46,232,191,209,11,255,255,231,157,252,233,63,246,51,253,135,244,168,252,4,252,136,216,211,240,95,31,218,207,
+243,127,178,23,103,124,56,40,2,242,142,124,146,87,226,145,102,28,24,209,98,101,164,182,137,89,69,111,205,117,109,236,45,73,146,133,249,164,241,129,
+161,240,82,144,82,20,32,92,141,124,99,162,166,25,50,161,92,56,71,203,21,116,106,138,148,179,183,91,23,69,114,178,129,115,240,128,77,112,206,13,
+112,87,41,225,115,61,161,141,32,225,3,26,177,69,93,211,109,139,75,244,208,126,180,54,205,204,167,33,157,210,117,253,228,235,180,94,184,223,255,60,
+143,255,255,31,174,83,191,254,246,50,192,193,39,243,211,104,124,135,125,122,94,155,193,20,244,198,23,85,93,63,181,71,219,48,234,234,193,115,199,136,
+226,81,23,110,50,88,18,107,21,169,118,78,218,204,98,65,147,149,245,44,97,76,233,67,64,41,207,140,0,212,131,20,89,204,109,130,82,214,38,109,
+19,31,88,78,195,110,65,110,27,30,53,165,123,20,237,69,52,71,17,115,19,14,129,17,20,1,2,8,194,26,9,145,108,28,145,61,52,85,29,90,
+88,175,197,6,170,181,255,195,103,48,29,9,119,71,220,103,152,141,54,127,206,155,255,255,17,239,254,203,223,252,24,255,216,111,217,187,251,236,232,19,
+3,191,45,26,172,185,127,63,247,34,195,148,116,97,41,88,30,78,147,101,229,16,159,152,66,108,213,10,174,239,80,138,234,237,113,173,76,181,98,171,
+134,219,17,56,201,178,16,18,154,129,193,149,49,128,250,143,98,46,155,58,176,190,59,32,200,133,218,100,103,8,152,104,195,61,188,95,101,72,86,204,
+231,76,52,140,194,172,53,67,144,23,5,96,64,3,24,42,130,132,57,75,20,235,214,109,214,226,63,56,58,149,223,15,23,156,240,117,137,220,135,134,
+62,202,176,88,255,254,48,159,255,248,74,44,127,255,138,30,55,248,90,127,226,119,134,71,165,126,215,42,11,187,108,25,75,78,199,111,24,115,229,69,
+125,36,87,233,172,32,60,209,169,165,139,247,47,136,153,120,157,65,171,162,69,156,177,90,209,137,214,181,58,39,43,122,23,130,109,36,194,25,160,180,
+69,64,182,34,108,246,221,51,143,83,90,161,171,236,192,220,213,180,96,178,93,47,34,26,168,234,21,97,10,36,164,232,39,230,132,20,163,136,8,98,
+74,30,233,102,105,112,71,118,57,205,210,110,222,56,252,228,239,181,30,192,188,129,249,27,159,135,255,148,103,255,254,182,94,241,31,255,226,78,55,135,
+155,252,243,84,223,37,127,118,217,19,123,148,185,134,34,101,58,20,1,94,163,83,22,56,45,148,149,27,137,165,91,180,140,223,26,178,221,174,34,205,
+216,50,86,27,5,91,50,106,88,210,16,246,9,197,51,25,226,171,3,33,9,130,184,32,213,156,127,107,42,195,50,93,145,219,26,209,148,195,230,182,
+68,46,130,88,228,66,113,100,44,108,167,252,59,230,56,7,0,236,44,197,158,20,11,166,84,240,61,126,57,80,215,6,179,249,147,226,255,185,78,189,
+188,127,120,248,165,183,254,161,159,255,254,220,221,153,63,255,168,10,129,83,215,236,55,165,233,159,254,157,250,100,125,133,100,5,134,42,187,171,227,193,
+213,104,106,170,161,74,170,233,100,109,146,22,62,91,252,94,163,148,5,206,183,106,196,155,6,236,199,33,105,147,145,174,85,48,109,19,184,124,142,172,
+121,163,190,5,243,213,74,121,25,198,21,202,233,122,146,180,219,60,216,203,163,250,87,170,24,11,167,233,85,24,169,104,1,184,150,16,160,150,148,161,
+176,132,2,134,158,235,100,197,38,42,118,171,168,142,98,248,251,236,115,183,159,12,190,37,160,81,255,155,151,255,255,226,49,95,111,255,60,124,238,84,
+107,249,30,207,134,114,191,53,24,92,120,42,165,89,26,231,179,150,230,117,251,143,43,110,40,211,54,165,6,175,21,12,224,205,134,70,216,90,15,104,
+121,161,182,79,88,142,97,153,73,106,221,66,26,22,139,4,83,5,244,98,96,24,216,167,159,1,55,217,124,217,110,183,188,245,218,38,72,237,74,225,
+237,50,109,171,138,17,231,146,24,194,10,24,194,220,0,197,52,31,227,156,65,98,6,110,170,58,184,177,179,138,29,133,235,215,142,254,98,122,145,239,
+99,190,223,24,53,89,255,232,81,255,255,233,81,186,87,255,36,223,138,239,73,15,252,30,224,165,217,23,144,219,199,227,119,140,28,3,57,184,237,105,
+156,254,103,129,209,18,13,17,140,99,181,50,130,118,116,169,39,0,109,70,177,96,225,105,81,13,192,166,181,137,52,171,36,25,15,67,206,89,224,205,
+16,227,197,58,149,203,117,119,83,139,140,25,227,227,13,120,148,193,157,232,220,69,109,84,92,233,75,100,108,195,84,4,194,80,60,4,160,70,130,248,
+12,2,204,115,76,157,50,89,246,17,178,135,166,77,187,241,37,205,71,84,93,201,120,74,242,187,79,255,254,149,223,255,251,145,126,49,223,255,50,159,
+53,126,107,95,248,8,184,87,75,94,119,107,15,168,93,40,67,123,30,217,135,57,107,106,81,16,54,250,16,17,143,132,195,36,114,120,203,67,19,174,
+137,82,104,237,113,12,78,37,83,88,187,37,123,151,114,183,193,151,25,131,111,37,195,139,80,147,77,147,73,247,210,13,126,102,187,6,184,73,199,101,
+101,226,242,108,174,30,75,230,230,61,96,6,47,164,128,25,165,76,0,66,148,6,194,98,26,168,146,110,175,26,243,178,233,164,237,160,113,167,201,119,
+97,93,139,120,178,242,213,59,223,251,146,127,255,240,18,255,113,111,255,234,175,136,43,61,127,10,188,29,94,191,235,199,27,143,40,240,187,146,219,230,
+140,224,60,6,213,223,5,239,138,33,191,112,144,184,38,54,156,166,165,225,224,253,14,46,177,148,88,209,35,17,104,237,102,80,63,152,32,8,252,25,
+130,204,61,193,66,20,224,59,73,51,5,161,43,180,197,46,96,108,35,68,243,237,148,41,192,179,41,234,142,185,235,141,65,114,152,96,121,146,32,122,
+1,208,212,18,104,53,37,249,132,184,171,248,199,94,169,53,83,200,231,25,213,147,11,204,67,71,221,80,39,105,233,102,255,196,149,240,68,126,225,59,
+95,67,153,154,239,54,250,219,186,216,224,18,200,14,42,212,54,166,172,75,64,165,17,99,22,134,105,20,194,185,32,216,151,225,131,23,27,40,2,235,
+70,164,79,161,23,67,138,166,162,48,36,171,66,78,112,240,170,136,32,63,34,142,142,185,87,32,90,92,57,85,82,126,171,211,35,183,4,139,237,33,
+35,202,78,203,42,66,211,24,128,160,171,162,106,22,24,144,128,240,11,193,100,4,188,97,130,205,5,97,3,71,114,91,116,123,161,189,193,172,133,136,
+198,27,121,85,230,219,159,78,167,23,58,235,148,255,200,209,244,5,123,153,123,131,219,101,140,231,125,204,24,93,66,167,200,162,69,232,226,184,142,69,
+66,71,103,61,1,193,143,220,221,199,101,54,210,120,198,30,87,184,228,170,69,163,112,135,170,129,229,57,81,108,100,232,199,12,156,151,163,216,1,148,
+246,199,103,35,82,101,68,42,130,84,130,150,157,186,36,33,117,217,52,215,46,109,179,73,161,124,57,104,19,8,129,84,66,200,18,144,34,10,32,36,
+164,74,15,232,203,132,66,6,113,67,148,188,133,42,13,60,203,135,217,155,10,108,85,242,11,207,211,52,253,109,177,124,237,146,255,168,139,239,248,233,
+131,250,201,242,203,115,40,221,34,16,60,237,235,101,50,46,7,120,109,48,34,198,140,213,181,31,26,208,185,144,223,36,82,71,231,249,71,145,39,20,
+125,82,148,74,225,15,212,198,206,48,143,17,125,205,220,86,241,150,19,0,6,147,31,17,84,18,197,97,46,153,67,85,250,77,150,163,151,165,129,167,
+233,69,42,91,201,150,149,240,246,156,68,27,35,35,7,136,51,130,158,54,128,165,142,160,22,225,144,2,248,123,66,114,94,81,236,166,101,12,172,215,
+112,28,0,49,203,198,191,64,236,216,245,239,198,179,189,155,253,97,95,202,213,224,155,251,146,246,141,119,144,202,170,181,123,80,100,197,7,166,83,56,
+163,45,57,101,81,49,64,85,10,193,69,235,252,1,197,99,203,208,149,194,89,104,75,169,180,126,85,9,208,19,71,16,254,71,33,53,193,54,73,20,
+46,1,0,3,196,8,145,16,143,196,189,166,65,70,25,248,211,246,144,148,205,166,5,3,232,253,49,121,210,200,190,74,17,111,134,220,50,32,182,3,
+88,127,129,20,29,64,120,1,168,9,1,235,13,185,54,74,82,130,180,210,175,117,209,175,229,140,254,65,153,200,103,241,172,238,29,221,26,31,230,202,
+255,64,199,204,199,230,29,154,27,89,158,91,241,24,105,101,71,122,236,231,91,29,163,154,194,222,125,69,84,211,100,167,219,106,3,209,53,36,64,13,
+250,181,249,43,152,32,149,97,89,35,221,34,58,139,129,64,81,63,18,65,183,66,76,49,0,89,130,202,1,227,127,136,253,57,37,161,80,26,53,81,
+226,170,243,193,170,140,201,104,163,43,41,98,72,198,37,113,130,128,160,42,97,116,3,0,97,130,208,10,64,157,3,228,14,35,45,28,201,127,79,126,
+151,214,44,182,86,14,120,131,100,251,153,86,132,154,155,96,229,186,171,254,54,207,238,194,248,89,123,143,200,161,41,143,92,140,201,93,109,38,90,161,
+245,159,164,177,68,233,56,208,156,134,217,9,133,3,31,18,248,153,217,84,33,191,49,25,29,178,247,167,16,76,61,44,18,253,41,0,40,4,194,3,
+58,106,65,36,5,176,90,34,221,145,81,71,32,59,82,25,154,80,50,184,242,231,183,156,154,172,141,44,58,32,205,34,60,211,89,128,28,167,33,178,
+17,152,95,2,0,4,225,133,4,100,94,66,55,3,0,210,71,194,81,20,103,160,61,176,236,117,133,214,28,57,43,102,217,157,102,166,88,221,109,144,
+255,162,59,247,233,115,147,252,81,45,20,157,167,174,78,80,46,161,50,38,78,74,247,208,6,63,244,186,131,85,35,242,141,11,133,8,147,39,33,2,
+152,57,184,22,195,45,58,245,38,28,85,68,248,8,136,162,132,71,36,99,129,112,126,224,157,209,104,50,144,9,137,253,1,225,243,107,184,163,222,66,
+77,22,147,158,213,38,41,213,38,106,146,194,118,137,240,78,20,20,24,192,213,0,96,165,129,254,67,224,250,141,224,85,160,80,29,57,23,75,2,154,
+244,72,187,133,156,177,162,196,83,53,76,233,116,185,213,138,30,159,95,87,255,11,85,171,31,205,190,8,134,160,238,251,134,53,25,59,229,226,212,223,
+135,8,37,18,100,110,5,88,103,218,76,30,200,108,21,37,15,68,79,81,39,75,201,36,20,150,83,153,65,229,65,51,70,165,136,86,51,218,19,64,
+119,228,66,1,4,204,70,7,19,114,43,197,254,140,180,47,158,21,137,229,245,110,121,65,216,178,80,244,83,149,140,131,165,87,0,1,31,197,88,43,
+49,164,1,180,68,129,74,1,8,104,6,10,1,67,4,142,53,31,40,185,96,171,161,95,19,32,140,106,52,75,206,15,98,156,143,123,193,63,225,172,
+253,122,30,28,95,170,167,111,199,154,213,191,45,135,196,190,153,117,244,210,178,218,171,194,232,60,145,46,76,32,153,182,209,234,10,44,162,249,106,149,
+164,61,50,146,136,199,37,120,144,202,32,232,135,30,4,220,197,225,34,168,246,67,240,22,96,8,132,154,44,211,96,148,165,53,103,59,84,234,58,83,
+190,156,180,3,166,84,183,168,21,29,73,91,68,50,36,176,128,130,32,10,226,94,0,104,170,128,86,19,224,126,134,76,90,37,101,46,74,111,211,186,
+226,151,96,196,171,30,220,193,244,42,210,135,67,73,27,63,130,3,255,46,245,166,255,69,121,111,206,47,223,62,164,205,16,47,215,57,157,80,98,160,
+102,153,9,82,148,183,250,117,149,23,120,128,12,106,230,108,212,126,84,77,57,194,222,133,239,89,248,193,233,199,154,152,245,70,154,31,145,96,65,228,
+54,208,143,194,204,75,146,1,153,53,6,231,93,85,90,1,86,118,132,149,9,159,228,252,102,233,41,249,75,197,86,48,176,72,131,132,25,64,202,10,
+96,97,1,192,16,160,65,131,4,91,99,211,48,153,246,84,10,199,55,55,194,99,23,204,180,115,143,210,139,95,10,214,252,83,95,243,211,125,73,159,
+203,111,140,22,76,47,50,152,215,229,231,192,226,32,26,42,207,194,50,22,235,170,32,242,171,178,61,225,169,167,146,21,22,20,226,0,97,214,87,245,
+107,81,173,69,1,73,98,164,170,74,44,36,190,3,248,107,161,11,7,220,66,130,41,139,113,58,224,49,94,201,38,214,26,141,116,112,174,116,204,236,
+57,35,138,155,70,214,108,177,124,138,140,82,96,244,15,216,200,130,66,53,224,33,135,16,1,225,29,8,185,49,199,70,140,19,219,178,165,156,176,55,
+196,195,32,188,235,51,168,213,155,56,108,165,95,240,153,127,102,182,250,31,148,61,28,82,67,247,20,207,217,220,54,147,170,245,85,218,60,86,49,139,
+40,8,225,172,105,48,194,35,192,82,20,97,18,68,58,170,211,197,99,96,136,82,101,153,77,28,145,74,7,5,60,67,204,31,39,245,13,5,60,196,
+177,12,33,5,77,70,49,150,84,139,141,232,36,53,112,41,167,84,150,139,146,223,166,28,54,40,127,6,161,97,194,224,26,16,104,7,56,13,35,190,
+14,56,220,133,242,10,194,26,143,108,195,105,61,71,251,170,217,255,27,60,61,243,130,205,211,79,61,90,224,136,248,21,191,245,251,94,165,253,216,168,
+236,134,135,119,27,182,88,199,176,238,11,173,231,113,26,85,114,115,65,194,133,113,75,132,182,121,51,68,159,117,36,36,21,83,166,71,33,42,116,227,
+80,79,81,240,189,169,199,149,196,35,17,136,7,66,217,227,128,209,145,25,252,205,163,214,56,178,37,116,88,69,206,181,151,235,174,150,117,13,67,88,
+204,163,186,117,165,72,53,162,41,102,24,25,240,8,73,110,5,112,57,9,225,97,128,51,23,153,252,91,224,147,73,187,18,223,207,62,124,224,120,87,
+237,219,209,127,63,159,196,155,255,255,129,87,255,132,167,249,93,255,235,23,241,128,255,56,156,43,100,7,237,186,136,56,147,232,171,28,46,130,59,123,
+104,127,177,145,141,224,157,76,10,132,108,81,94,142,36,24,146,111,181,159,230,160,90,25,100,169,139,5,247,41,21,78,231,64,134,65,103,27,144,56,
+146,25,91,186,74,65,202,101,147,103,27,1,153,59,197,118,3,241,157,85,120,68,151,75,7,138,201,100,132,56,44,1,233,66,2,169,139,5,152,221,
+12,24,162,153,58,174,175,12,127,99,111,105,219,62,229,151,157,30,203,252,15,248,203,240,19,129,23,255,221,131,255,255,225,41,233,107,255,201,236,230,
+177,125,253,175,207,99,205,87,65,178,175,238,6,246,152,218,134,18,144,62,254,235,145,25,238,32,40,253,54,166,93,180,246,186,216,133,115,120,174,71,
+56,74,102,109,205,78,44,0,168,41,17,104,205,25,114,204,10,120,92,35,74,4,180,155,217,192,46,58,240,219,147,76,59,99,47,3,87,209,107,181,
+145,75,19,55,39,113,23,7,80,124,14,161,70,21,129,24,10,96,43,19,114,141,66,149,243,127,185,13,209,118,213,248,124,230,143,171,30,235,124,68,
+121,250,204,111,254,26,31,255,251,182,127,225,29,255,247,251,248,2,243,34,255,175,42,70,116,201,229,146,200,250,147,203,92,0,177,49,178,212,223,111,
+116,129,18,10,211,137,41,60,21,15,219,203,250,36,157,111,48,202,212,115,107,170,89,112,162,104,109,104,14,66,201,197,200,171,5,24,91,98,225,13,
+48,233,157,170,59,206,142,3,241,219,149,43,182,205,133,71,100,30,111,237,238,81,230,82,60,160,156,41,101,60,22,166,112,7,99,240,11,97,98,50,
+40,158,131,48,113,127,122,82,211,159,10,252,141,116,127,220,95,124,126,83,122,220,236,21,255,255,163,135,255,245,12,254,147,191,242,213,87,173,67,255,
+166,174,245,159,221,190,124,29,172,223,253,140,99,246,25,4,12,16,247,240,4,13,187,29,155,94,44,144,176,150,232,33,52,143,14,72,140,118,148,151,
+6,209,86,30,163,6,4,6,1,115,67,121,148,2,253,150,210,221,169,122,69,206,76,235,237,218,129,118,141,91,185,159,188,155,90,194,20,148,223,220,
+50,150,180,125,136,212,100,132,88,19,12,136,87,204,192,195,195,97,43,205,221,175,97,171,25,123,51,213,119,54,252,124,247,87,218,183,146,191,47,50,
+122,255,217,83,255,255,213,227,195,27,255,253,29,236,73,153,47,226,107,29,220,128,125,176,105,49,244,87,196,227,151,12,26,147,164,203,33,60,214,213,
+48,185,245,98,54,202,179,231,20,172,116,182,154,216,155,15,142,32,147,28,224,128,235,153,102,49,180,145,152,136,74,22,145,154,78,90,89,33,59,55,
+53,243,141,188,169,220,62,173,105,91,86,51,125,147,137,191,174,153,233,136,137,234,148,193,144,161,176,207,155,208,5,136,48,81,19,72,36,177,153,147,
+199,69,250,106,75,91,124,27,115,149,207,31,132,174,220,125,11,243,27,252,170,191,255,251,112,127,237,117,254,199,255,245,75,242,136,254,197,122,153,169,
+127,209,164,130,55,113,178,106,77,111,159,160,86,82,250,253,29,254,53,147,22,184,86,131,24,13,110,17,153,54,195,218,187,103,205,167,182,62,88,174,
+96,113,61,42,241,48,52,131,133,241,34,5,132,108,204,77,214,208,230,104,170,255,73,23,45,154,236,45,97,63,22,117,85,134,121,53,182,216,61,158,
+152,104,6,232,161,10,240,103,18,224,73,142,113,103,131,138,224,162,92,81,226,159,83,219,115,226,223,163,158,176,60,79,248,115,243,45,68,255,255,46,
+143,255,255,195,170,232,191,254,48,102,29,180,47,224,182,105,190,0,58,232,138,239,150,110,20,29,173,115,192,183,189,232,141,10,99,153,11,68,139,154,
+164,123,59,127,81,195,176,117,211,184,255,98,5,164,150,18,86,222,175,212,87,35,148,137,137,128,5,32,170,124,233,118,218,175,215,14,24,211,199,134,
+62,241,207,136,108,46,92,253,179,211,229,24,202,148,121,194,148,12,2,200,93,132,112,104,1,176,30,5,164,131,81,85,111,224,99,36,218,87,221,71,
+23,29,18,118,7,225,55,198,199,159,9,163,255,253,84,63,255,252,137,164,195,255,210,70,62,43,139,254,76,183,42,252,123,210,55,23,252,226,202,75,
+25,151,216,63,117,160,164,177,63,114,34,28,47,31,164,58,243,126,138,23,125,75,92,113,100,202,67,32,172,246,37,193,147,50,77,90,64,21,225,216,
+119,100,232,188,39,54,228,112,103,122,217,186,188,173,39,91,230,124,236,15,26,20,217,103,19,119,48,178,11,0,208,217,32,128,33,45,32,35,33,33,
+11,3,82,253,60,86,5,130,76,124,234,179,103,220,157,243,63,220,143,121,158,91,61,3,67,99,255,238,1,255,255,191,65,217,127,252,212,72,109,102,
+127,226,11,199,171,251,75,193,139,173,156,22,93,14,36,226,12,47,67,77,118,224,234,229,116,78,158,5,206,161,222,50,190,92,178,52,18,207,227,128,
+37,46,56,113,49,230,204,130,173,134,48,207,196,96,201,196,8,251,88,197,19,103,46,144,54,167,75,91,145,168,125,76,85,126,53,42,162,173,233,158,
+42,39,202,63,197,150,126,67,110,132,1,254,81,194,66,15,164,218,148,234,3,24,120,96,218,174,172,185,198,229,23,190,14,235,252,207,249,239,170,215,
+255,196,99,255,255,154,212,37,63,255,176,174,168,220,141,255,139,45,184,191,106,18,168,226,19,71,18,197,176,107,112,39,156,61,30,250,39,153,31,76,
+171,123,235,173,112,56,209,243,81,206,25,24,19,114,200,150,231,25,166,116,211,224,227,171,104,56,138,180,16,197,94,16,241,79,26,218,218,152,93,217,
+82,214,204,108,159,55,87,83,119,183,125,52,54,197,7,101,81,48,195,91,64,129,93,54,32,1,21,96,40,29,177,33,94,115,239,147,108,8,237,255,
+86,60,210,115,1,220,95,128,223,39,222,104,42,153,255,224,89,255,255,240,238,5,175,255,238,79,224,173,241,255,247,181,49,159,84,26,175,201,135,142,
+44,93,184,173,226,177,106,188,119,1,103,6,169,239,97,61,153,54,94,90,201,108,61,163,167,7,172,89,56,88,87,75,95,73,84,97,36,255,145,142,
+89,98,20,52,4,185,12,232,246,142,157,54,210,150,170,110,103,61,152,123,196,70,51,235,75,17,114,57,119,144,142,79,242,50,34,242,154,3,97,216,
+25,96,4,23,226,189,3,246,51,58,89,8,193,214,195,246,23,200,191,61,93,129,120,115,241,95,230,14,54,127,251,235,127,255,254,108,66,151,255,248,
+57,223,211,194,135,224,59,33,254,75,188,128,198,99,210,47,30,78,248,250,161,97,119,145,32,27,92,218,167,215,24,210,243,21,77,216,52,70,218,139,
+99,141,5,181,234,195,179,47,106,221,87,58,82,142,204,235,129,156,126,201,222,10,145,1,55,89,128,183,124,202,99,35,29,153,125,188,140,190,83,110,
+50,228,142,224,160,162,120,161,180,19,226,104,56,1,92,90,193,110,73,5,210,1,171,134,129,113,43,137,189,67,109,223,137,126,147,58,159,241,121,225,
+71,208,46,46,191,250,161,127,255,254,66,82,34,255,244,35,132,60,241,255,72,53,215,226,243,215,85,117,190,0,249,166,44,187,254,36,102,45,179,16,
+192,73,40,141,25,37,21,60,47,130,200,39,200,85,213,19,196,234,81,154,70,49,10,195,177,26,168,167,132,2,24,192,76,129,232,21,8,143,204,222,
+95,212,96,163,173,51,234,183,73,170,202,207,182,164,50,251,160,132,126,37,55,16,120,135,193,18,8,192,49,9,32,17,2,178,1,200,98,131,218,19,
+18,72,148,237,3,106,39,98,171,222,224,231,146,198,86,218,72,233,47,179,141,72,63,89,23,254,110,72,216,62,255,249,249,78,197,231,169,95,230,153,
+119,143,158,214,179,51,149,70,214,118,0,253,139,169,240,0,16,176,0,30,88,130,10,117,136,1,107,22,228,65,149,62,52,122,144,175,71,228,180,232,
+88,11,220,203,192,185,27,64,65,224,172,38,137,43,205,202,138,180,28,171,253,23,171,159,67,154,172,78,226,137,18,238,151,12,125,34,215,15,56,17,
+192,110,23,224,104,8,152,29,1,124,0,232,34,68,182,60,114,220,159,237,63,172,207,118,76,58,49,214,205,19,64,109,75,182,100,156,15,237,82,255,
+180,227,7,215,238,79,134,77,69,31,10,125,50,93,20,160,63,150,117,208,100,5,77,184,49,201,200,42,121,3,134,159,115,0,3,240,231,27,122,246,
+71,114,83,89,43,244,88,20,149,47,218,149,35,24,76,0,31,135,219,2,132,250,130,71,0,152,220,205,178,69,149,222,148,77,202,101,173,115,169,138,
+216,230,101,84,136,151,180,164,36,247,10,136,231,195,116,34,145,194,3,140,118,0,43,18,32,29,65,18,32,18,58,147,101,36,104,213,113,43,106,99,
+1,139,134,117,25,236,234,223,178,68,99,127,66,7,254,5,236,211,223,226,157,51,178,94,252,122,176,149,113,181,141,38,53,216,30,194,182,207,81,200,
+0,68,105,13,170,31,36,218,71,240,167,169,210,84,22,75,29,29,5,89,206,24,179,161,31,149,148,21,42,89,97,156,53,232,65,4,146,8,240,237,
+192,44,164,208,157,185,204,93,239,189,39,187,150,205,150,179,51,239,156,108,255,34,225,56,200,49,138,210,51,129,151,144,56,31,163,84,3,160,81,1,
+72,30,144,89,151,156,116,42,89,63,219,182,218,195,24,220,99,115,117,208,159,81,189,128,161,129,248,195,63,247,26,78,97,254,76,217,232,46,225,221,
+138,27,60,85,113,3,150,102,216,181,211,83,131,2,163,26,94,72,43,6,242,56,33,237,145,231,70,125,38,228,239,209,116,84,160,250,74,148,152,225,
+55,82,125,32,186,63,146,65,140,20,17,161,250,23,124,48,10,245,11,11,97,201,34,217,51,186,174,237,46,40,179,81,121,72,211,54,27,179,230,131,
+168,161,226,92,16,8,166,1,32,27,97,0,0,180,60,194,239,0,97,149,199,6,161,244,65,184,101,200,241,15,200,55,47,157,38,180,162,214,218,58,
+127,158,235,255,154,136,91,255,191,37,212,23,129,233,109,74,141,71,53,88,140,227,50,108,136,216,109,103,96,135,238,54,224,14,190,9,188,206,94,153,
+25,248,20,192,68,77,71,196,126,211,22,71,237,19,20,51,142,98,105,98,155,14,232,104,0,184,10,112,125,225,59,63,57,56,84,54,127,21,81,168,
+37,56,106,225,63,26,153,202,238,139,81,131,152,28,32,34,239,3,48,5,194,28,30,96,105,10,120,11,97,196,19,136,47,202,166,76,52,115,167,61,
+161,47,85,133,174,76,89,107,233,107,164,142,189,210,203,254,71,239,253,160,139,121,251,150,73,82,229,30,113,145,32,99,253,136,84,133,183,163,182,146,
+171,88,31,21,146,198,131,162,32,106,91,163,60,92,212,123,236,40,202,248,189,17,213,21,28,65,245,32,4,32,77,172,117,241,239,149,100,40,34,206,
+7,84,8,69,51,36,41,233,80,50,146,149,20,166,197,86,105,65,78,233,253,80,74,97,242,196,142,188,89,97,77,3,56,36,2,100,24,160,213,5,
+72,26,0,59,11,88,198,201,218,113,244,182,175,205,208,176,145,199,111,49,125,12,245,53,218,202,236,191,54,167,254,6,207,0,7,240,148,214,182,243,
+175,139,46,120,174,123,48,117,203,6,247,144,93,186,204,253,132,139,80,178,40,147,225,37,178,96,45,152,75,86,39,196,208,99,90,78,214,9,132,234,
+86,12,146,8,243,15,8,190,130,143,16,184,71,194,181,5,138,15,198,154,193,146,162,184,68,205,110,41,53,171,38,204,86,157,146,121,153,196,106,34,
+241,13,72,7,128,190,36,0,25,12,96,7,162,110,14,120,11,9,6,56,148,25,161,125,147,237,219,133,158,55,25,132,104,131,168,62,206,182,218,245,
+171,127,231,254,245,174,127,152,196,169,97,71,244,123,197,21,204,222,2,234,53,214,14,100,148,130,135,200,31,68,190,106,81,110,168,38,53,229,240,136,
+98,197,52,169,44,49,12,170,180,201,189,211,86,55,201,222,76,164,55,66,141,129,86,111,227,143,141,177,125,224,29,118,8,210,94,242,91,151,45,156,
+133,122,103,111,66,201,178,200,234,88,16,89,143,196,76,2,133,34,128,103,73,128,24,49,190,9,204,19,196,135,29,25,238,209,206,188,215,90,192,183,
+35,252,157,180,210,209,171,104,60,4,124,208,95,252,205,157,117,95,222,78,40,168,160,120,245,70,71,138,14,24,212,206,208,166,83,136,215,214,132,123,
+214,119,21,81,176,80,47,58,50,121,232,21,170,170,137,130,159,200,248,166,106,145,18,14,40,205,20,157,5,128,226,25,224,42,212,39,30,172,103,139,
+1,13,91,39,203,150,202,20,91,172,229,71,168,187,83,9,98,210,174,34,83,189,131,216,166,227,70,23,201,23,130,134,65,0,68,137,56,35,32,215,
+24,57,74,76,122,165,117,56,191,181,232,50,179,200,83,81,93,12,54,244,198,167,216,133,255,197,149,198,97,249,205,226,235,72,79,19,122,228,230,47,
+190,180,159,89,178,98,254,192,219,57,228,90,243,103,14,182,86,100,145,73,161,15,84,164,19,60,75,93,58,148,183,82,161,73,97,9,84,74,139,226,
+117,33,144,147,188,15,194,64,13,220,26,166,201,44,90,52,82,78,152,21,172,163,213,129,103,97,90,137,71,210,218,41,147,96,129,36,121,97,118,9,
+72,149,129,80,33,96,161,2,104,13,194,37,14,233,128,74,250,171,21,17,191,53,236,50,107,201,95,74,61,38,246,224,199,111,221,105,255,145,163,195,
+105,247,91,234,75,124,135,154,228,101,152,29,233,7,2,230,58,120,5,173,187,143,249,239,177,123,0,162,19,38,177,64,121,53,36,3,149,221,64,125,
+104,51,255,43,56,119,20,226,76,192,133,169,51,11,26,45,17,55,130,148,11,113,117,148,244,207,168,113,72,58,139,212,158,167,245,35,166,45,33,231,
+165,55,137,75,200,170,41,208,221,129,124,12,129,28,13,0,97,3,68,10,64,33,6,68,79,165,7,51,154,92,214,162,231,56,38,99,147,151,30,131,
+218,138,109,19,137,23,162,3,254,199,15,167,75,247,93,233,67,166,171,230,197,148,195,138,244,242,48,52,199,110,11,167,149,152,88,77,38,146,94,65,
+141,167,180,52,53,247,199,168,199,16,147,12,105,202,158,190,177,108,84,215,43,250,38,132,169,42,240,211,131,92,26,96,200,64,70,132,177,155,175,60,
+179,109,135,56,155,94,79,22,190,51,132,164,228,182,165,247,31,40,168,196,6,4,0,61,136,248,10,2,252,0,160,143,130,166,0,177,246,142,236,243,
+40,127,96,139,121,224,239,141,166,91,186,26,233,209,178,110,24,29,184,223,249,45,191,13,183,248,106,98,17,56,7,168,189,185,155,223,79,23,23,75,
+232,200,206,155,16,53,11,184,46,80,31,8,202,173,130,1,97,54,56,36,190,127,156,25,118,66,204,134,197,84,75,88,101,73,37,241,2,134,43,6,
+84,214,50,87,143,155,213,243,231,117,97,217,62,75,198,7,14,14,175,134,2,86,1,68,2,199,56,69,43,104,125,237,160,164,173,204,183,108,16,182,
+40,184,163,164,128,135,224,32,103,35,214,68,231,10,34,233,42,2,169,242,31,8,219,16,15,238,101,255,254,180,159,253,252,127,255,255,221,47,255,224,
+164,168,223,69,95,166,166,92,98,225,178,151,30,255,74,110,118,253,145,176,1,191,112,240,146,100,26,153,222,151,17,155,156,116,16,90,201,14,64,120,
+54,26,61,110,168,103,25,108,2,231,229,141,125,32,176,243,154,53,138,97,125,33,53,144,86,210,62,13,80,207,51,99,91,102,5,61,131,131,48,197,
+17,173,225,152,199,110,84,165,233,164,123,228,56,80,33,34,40,101,234,6,233,182,19,204,46,38,13,34,48,12,106,56,203,82,240,159,237,61,255,252,
+196,63,252,16,127,255,254,49,191,197,203,219,203,246,195,244,214,7,173,250,127,35,111,217,7,252,14,63,92,255,218,59,216,199,208,27,63,156,169,25,
+53,177,131,200,46,10,232,59,195,152,4,138,204,141,154,29,21,35,6,180,82,233,91,105,66,164,244,39,75,17,109,194,64,148,198,108,67,141,213,2,
+147,61,149,22,53,234,22,85,248,19,181,192,143,29,85,137,196,204,4,156,53,128,68,92,66,224,219,196,193,62,197,105,122,196,185,139,67,57,110,193,
+17,41,64,53,21,220,19,254,6,223,255,51,111,242,5,255,255,252,147,250,2,127,235,141,255,231,183,255,15,238,68,170,15,233,97,243,245,253,222,190,
+178,63,100,14,184,60,223,166,199,30,162,160,39,89,74,69,102,168,19,221,161,196,225,98,53,26,21,64,115,17,164,79,80,251,53,210,97,38,242,175,
+31,178,39,29,49,21,28,48,46,26,177,98,22,178,68,15,242,182,7,18,170,2,2,54,9,161,112,14,96,112,15,160,167,13,65,187,7,162,163,0,
+243,73,10,211,157,20,147,147,28,83,57,32,242,133,31,146,147,120,143,240,72,255,249,98,122,16,255,255,255,241,241,252,19,191,248,246,127,255,30,63,
+255,129,23,244,153,235,140,80,146,211,222,34,226,56,168,19,200,233,83,2,152,187,255,109,7,213,123,150,47,85,46,76,60,71,54,149,201,99,16,57,
+118,76,221,12,24,68,75,199,173,62,68,185,206,77,50,2,169,24,249,170,20,211,169,196,153,232,116,89,38,172,28,36,172,21,194,164,57,64,164,76,
+193,66,80,130,250,69,196,106,47,133,122,16,198,18,16,230,58,48,38,6,71,229,102,86,164,102,88,162,218,82,47,41,251,9,127,255,89,47,140,79,
+255,255,255,214,247,255,126,47,174,87,254,197,63,247,104,251,29,240,20,25,37,69,184,194,135,181,212,3,160,71,174,198,149,61,160,57,172,248,48,115,
+185,232,101,186,14,135,216,32,203,130,20,35,176,51,171,150,132,19,119,130,69,190,229,145,130,60,230,174,255,46,10,120,195,186,40,172,188,167,39,84,
+42,98,48,65,2,62,147,133,222,201,8,122,221,201,246,211,10,82,171,137,166,112,8,78,43,70,162,24,36,226,82,227,38,127,161,122,155,96,24,162,
+33,196,143,235,193,251,220,127,255,190,103,249,220,255,255,255,216,231,254,59,221,161,63,40,255,65,163,63,184,79,159,23,152,127,196,75,160,63,54,169,
+126,199,73,32,142,94,173,146,39,184,196,162,102,160,219,105,0,41,102,90,142,210,49,138,149,225,105,49,148,157,125,179,25,170,86,36,114,230,170,203,
+195,66,116,246,142,140,22,4,8,169,83,153,60,223,9,156,226,200,226,241,176,109,152,85,46,219,80,35,154,1,23,152,155,12,72,188,130,169,228,132,
+194,195,137,211,70,140,99,100,137,3,40,141,98,211,188,103,251,118,127,255,150,7,255,221,95,255,255,241,193,255,241,96,52,255,3,95,117,109,121,103,
+25,24,10,154,243,110,219,127,184,118,180,60,137,46,119,141,163,208,195,80,63,68,192,238,146,21,148,160,58,224,145,203,100,104,237,164,180,47,201,233,
+179,65,17,22,71,4,105,205,204,65,18,228,224,22,85,103,24,53,205,152,214,7,204,55,9,197,209,130,146,177,187,98,114,176,66,50,162,129,246,147,
+145,193,132,209,141,136,217,83,148,57,15,156,184,188,161,184,89,162,56,13,14,95,133,87,255,199,219,251,197,127,255,255,243,83,254,227,191,255,252,164,
+63,255,127,127,237,32,208,250,129,252,251,62,65,63,112,111,17,191,16,204,75,241,122,61,85,160,72,129,205,130,194,206,195,49,187,92,193,175,82,73,
+112,70,201,27,195,140,197,75,140,118,80,124,52,82,68,2,81,52,33,141,244,57,137,68,69,3,220,69,1,104,58,134,0,37,9,128,3,139,160,37,
+204,48,86,203,96,137,201,88,187,198,112,229,195,1,3,64,109,16,195,117,13,69,148,244,198,196,198,198,44,221,100,45,255,152,71,255,167,215,255,154,
+15,255,255,187,175,250,201,124,84,191,237,135,255,106,175,201,55,166,241,44,90,23,206,163,209,95,240,104,248,200,253,230,61,87,253,244,58,167,245,154,
+210,239,56,202,163,203,97,224,79,184,217,68,204,41,210,212,67,155,100,132,159,100,170,31,204,191,157,124,205,25,92,214,148,28,219,14,108,217,136,228,
+208,132,44,191,0,148,164,1,152,126,2,128,78,2,32,22,128,192,36,65,60,94,67,140,145,197,172,186,199,68,209,200,36,215,200,12,199,198,84,157,
+194,31,202,75,255,252,236,172,29,255,255,255,231,219,60,15,250,216,127,188,207,213,34,136,161,247,132,68,231,240,40,48,52,52,146,164,58,245,146,204,
+79,164,103,21,158,233,221,8,251,84,116,45,231,13,200,175,109,13,181,241,116,203,158,133,150,195,118,73,90,154,227,114,129,97,178,145,120,37,158,105,
+49,38,90,71,42,59,26,43,75,162,42,91,222,40,91,207,37,187,120,34,218,227,32,42,38,30,9,83,28,40,125,26,120,72,152,120,241,149,153,111,
+145,185,188,140,105,206,133,121,178,220,83,254,98,159,255,139,119,255,220,143,255,255,254,4,127,255,246,138,197,167,248,153,255,243,8,255,214,71,254,157,
+31,152,175,189,214,23,180,220,47,96,15,142,241,155,195,56,73,79,40,192,10,53,215,161,107,48,170,237,214,131,25,187,137,103,179,120,13,38,238,13,
+159,157,116,50,25,160,165,213,100,29,64,151,252,132,106,249,40,218,2,15,137,26,6,64,65,23,192,138,164,81,71,171,241,245,174,210,141,173,115,9,
+168,163,98,161,83,142,152,115,137,143,51,82,134,242,239,128,114,97,130,137,247,133,7,222,35,255,248,148,76,95,255,255,250,60,230,23,255,218,203,252,
+180,246,144,218,11,229,95,253,115,63,143,223,246,44,251,205,253,180,186,246,244,216,173,189,113,136,132,209,145,136,183,90,209,103,88,81,125,206,137,52,
+65,120,180,204,68,26,216,180,131,161,78,140,210,95,103,73,160,192,82,107,49,54,149,252,112,163,31,27,7,245,136,35,22,191,2,55,178,225,112,164,
+128,202,148,208,77,132,176,7,10,184,59,24,216,87,36,136,101,45,56,109,50,8,119,51,8,142,47,184,204,41,189,183,63,250,25,127,253,184,63,255,
+254,226,191,255,218,7,255,252,155,191,139,11,6,112,186,227,107,203,50,78,110,49,29,72,177,236,165,141,63,38,108,211,248,84,98,43,158,21,76,235,
+101,17,87,186,88,82,158,45,241,65,19,83,195,6,116,249,3,245,25,7,180,95,14,83,15,21,145,101,27,240,96,32,210,20,36,83,138,38,212,162,
+40,213,68,42,149,102,44,149,10,88,19,49,132,0,12,98,192,19,13,144,100,66,78,70,242,167,161,245,77,237,89,128,62,40,57,105,103,103,169,222,
+188,58,99,103,108,255,77,183,251,204,62,117,191,96,174,142,47,153,21,35,217,62,230,159,35,157,228,234,6,162,109,230,75,253,131,208,41,144,246,50,
+114,44,41,55,163,68,167,42,48,138,225,33,194,169,193,233,83,139,46,242,34,3,177,48,224,85,70,20,15,88,20,139,210,71,180,119,159,205,86,233,
+221,89,58,142,212,162,147,212,54,156,228,187,100,165,24,136,128,193,34,2,96,153,5,144,58,65,96,8,144,4,66,74,47,18,93,156,61,44,108,19,
+117,156,47,178,16,205,131,72,61,100,183,26,171,47,238,136,255,204,28,149,175,200,206,104,24,50,121,230,76,105,189,188,36,179,207,171,12,43,174,167,
+120,163,43,233,202,55,45,249,0,118,196,80,120,76,57,13,8,188,250,5,170,191,33,88,149,178,3,7,128,53,105,6,137,106,12,145,64,136,198,12,
+68,159,139,61,148,37,89,115,25,168,220,254,107,54,141,150,205,82,99,241,59,24,116,72,46,2,224,153,134,88,25,66,4,12,16,75,129,128,16,176,
+196,146,84,166,41,53,79,43,161,222,95,32,60,143,244,143,210,43,103,109,29,180,199,127,228,218,254,59,111,225,191,179,252,87,158,6,113,19,103,231,
+102,44,38,112,41,145,117,64,34,14,7,129,97,153,40,125,169,168,19,65,111,98,180,49,5,44,211,23,98,169,48,109,36,106,197,99,86,76,52,56,
+199,119,0,80,242,195,75,5,241,137,74,14,130,20,171,163,237,127,104,165,103,121,203,216,190,78,21,81,136,85,6,32,184,44,56,195,134,98,71,64,
+209,146,80,39,99,60,17,152,26,137,46,59,244,25,163,205,150,238,185,134,166,72,153,158,233,183,170,190,217,17,162,253,97,31,250,222,144,69,254,10,
+218,247,51,128,240,71,178,179,185,238,62,109,219,45,238,164,229,27,6,147,64,81,194,149,144,254,199,162,73,189,30,180,211,211,167,75,141,72,4,91,
+212,85,57,162,102,196,122,69,52,49,70,223,10,125,13,7,153,25,130,217,66,198,219,114,111,185,228,224,237,181,62,122,231,206,186,137,83,1,148,36,
+133,161,135,18,200,92,1,254,54,64,70,143,224,40,98,248,26,72,24,141,30,58,85,106,163,13,248,46,121,147,86,67,26,96,233,23,183,182,143,125,
+86,223,249,20,190,111,111,169,55,90,217,0,185,219,217,7,45,78,3,49,177,100,159,129,82,221,89,125,33,207,160,136,152,244,119,27,42,145,39,202,
+81,109,40,36,246,147,142,75,157,49,212,93,209,121,60,145,190,138,182,64,1,128,131,168,23,193,240,137,189,18,165,99,94,233,201,91,14,122,54,200,
+155,221,132,165,95,77,40,205,205,26,15,17,182,132,0,25,226,42,6,176,140,130,84,14,64,0,7,68,84,101,207,52,138,177,86,219,2,44,22,178,
+227,203,183,84,237,62,246,144,145,207,245,130,127,242,103,106,201,252,83,120,51,188,27,110,113,149,30,245,115,26,209,46,60,180,247,141,180,151,1,129,
+130,56,70,84,115,26,226,222,37,123,95,172,224,235,201,30,249,97,211,197,39,152,103,228,56,201,134,91,97,76,10,56,9,64,77,142,228,169,103,57,
+68,234,99,84,210,168,149,85,168,189,50,168,179,59,185,154,73,142,60,145,1,133,68,9,192,136,13,176,86,3,192,13,64,77,4,108,68,100,105,49,
+74,53,214,66,223,184,36,227,89,151,206,132,186,162,109,5,146,127,127,215,253,178,95,136,187,248,54,243,241,204,149,242,158,201,249,201,198,74,120,171,
+98,193,25,196,113,46,230,97,204,145,1,189,155,233,21,147,210,66,109,56,116,224,82,170,83,173,19,213,59,78,150,157,225,60,81,163,18,217,190,0,
+125,65,81,80,69,52,148,49,42,176,204,185,237,191,61,123,115,207,238,200,19,113,168,124,154,231,25,18,168,254,64,44,20,208,241,1,184,82,192,216,
+15,16,18,64,174,47,178,2,156,53,28,44,33,115,172,54,50,26,206,71,75,45,120,247,80,162,23,241,31,127,228,112,15,207,227,99,13,133,208,122,
+173,71,35,168,4,38,117,82,139,173,51,98,187,42,48,12,97,36,29,85,61,71,164,190,161,87,88,160,24,165,138,129,132,24,22,20,89,96,225,175,
+38,120,18,116,2,130,143,76,209,207,71,80,178,208,156,183,188,149,175,65,52,59,196,205,150,216,114,221,171,172,119,103,183,10,105,29,194,4,27,81,
+82,0,64,101,0,120,18,16,43,192,82,54,178,3,158,13,33,44,153,117,220,68,178,68,207,15,77,189,133,55,67,136,135,246,189,127,218,189,25,255,
+220,42,98,172,150,121,98,202,251,166,108,35,214,144,133,121,162,33,240,15,49,3,28,148,114,105,235,148,137,111,243,34,176,166,53,155,14,35,37,175,
+192,81,5,118,134,82,152,224,51,207,244,27,42,102,16,66,60,70,5,131,245,215,164,83,127,137,132,95,66,99,246,249,148,133,103,163,25,63,152,44,
+73,70,24,192,238,140,88,3,163,124,2,16,156,1,230,2,17,221,144,132,251,169,63,103,187,192,226,123,147,110,124,218,128,108,111,185,156,116,31,207,
+165,255,59,182,64,31,165,77,107,154,227,239,213,61,158,147,49,213,96,35,50,100,44,103,124,20,26,82,20,172,186,41,24,155,181,90,211,207,47,56,
+122,54,2,198,224,93,12,171,74,178,12,221,44,64,89,30,240,61,116,165,34,212,116,76,171,7,187,212,200,79,3,169,112,224,13,46,187,144,201,78,
+183,17,75,160,92,6,36,189,15,240,125,70,216,3,177,217,0,80,80,1,51,1,185,3,72,186,131,244,203,181,133,237,241,114,202,155,65,61,76,246,
+114,218,231,7,199,250,135,63,202,77,224,139,244,210,185,91,153,158,54,248,37,241,138,137,131,6,26,173,38,61,119,194,89,97,240,22,132,137,204,246,
+151,178,70,73,153,40,220,149,186,166,232,186,41,98,119,148,198,9,226,133,216,133,203,230,12,153,140,141,170,16,37,136,140,149,189,37,231,121,73,199,
+221,166,109,214,140,149,125,75,99,27,56,168,35,199,190,27,32,160,140,144,8,195,90,3,16,133,2,58,11,178,21,147,213,17,42,63,110,44,3,49,
+171,203,215,68,157,92,182,193,213,175,142,59,254,171,47,208,1,244,176,241,166,167,187,181,108,213,182,71,207,222,70,186,229,211,213,50,76,82,12,249,
+160,152,91,181,229,24,202,220,102,148,92,37,12,117,147,81,165,82,221,20,100,153,15,196,120,98,224,145,132,103,129,62,5,72,102,35,71,62,41,181,
+213,202,144,118,49,166,221,136,104,249,85,249,197,208,122,71,178,157,134,212,73,96,180,0,0,144,2,104,40,0,125,4,240,26,161,147,33,57,114,209,
+118,176,151,16,193,155,30,60,207,116,126,214,151,113,12,194,189,25,223,249,83,188,154,95,162,222,187,144,145,246,215,136,219,61,58,194,221,163,13,88,
+236,160,195,130,41,106,180,174,16,142,242,193,114,98,116,68,70,54,102,15,98,38,107,85,221,140,134,168,41,57,82,0,23,1,171,193,12,53,240,233,
+193,128,124,82,15,171,52,240,236,117,74,43,40,82,206,182,180,20,164,116,189,166,45,25,200,199,65,62,7,240,172,4,184,70,65,136,13,0,21,128,
+254,38,210,12,154,77,29,43,187,115,188,44,50,26,205,211,75,109,114,247,76,186,207,223,125,255,161,130,223,111,219,86,99,152,71,249,197,201,253,187,
+220,9,148,247,149,236,197,102,225,76,97,33,101,68,1,141,175,196,118,197,36,132,76,152,10,126,200,152,173,12,48,201,68,179,120,196,211,114,7,194,
+3,133,130,195,76,49,212,198,212,178,208,202,183,132,163,47,39,55,187,187,206,118,213,83,17,170,188,130,103,113,12,169,8,193,144,21,145,60,1,200,
+96,192,222,17,32,18,192,142,48,210,20,156,197,38,44,83,119,124,61,50,98,206,179,79,237,127,247,101,145,207,243,128,127,226,180,77,159,232,63,81,
+38,50,93,79,160,216,224,19,57,118,36,146,236,64,246,77,224,10,151,65,170,8,26,157,113,85,215,8,50,91,12,179,76,177,19,48,219,1,18,105,
+172,8,46,68,207,65,16,128,128,125,169,174,68,232,242,152,234,16,23,134,145,118,2,115,13,190,228,200,237,239,41,42,198,198,58,123,208,89,145,124,
+48,65,143,24,0,12,134,168,8,193,27,2,204,14,35,137,36,57,238,83,110,205,215,196,196,211,43,44,247,181,67,216,211,113,26,65,191,180,123,254,
+61,13,217,63,74,204,98,28,118,117,22,165,191,81,25,228,50,139,179,234,127,23,127,37,38,9,66,0,68,124,235,104,230,166,94,144,130,173,232,215,
+172,90,132,146,178,134,193,79,144,140,72,183,6,180,209,65,19,156,168,230,161,196,90,104,165,220,22,88,215,157,155,205,219,102,217,104,233,96,84,178,
+53,83,135,131,116,121,225,92,9,24,179,128,228,49,0,79,7,96,25,32,233,30,25,67,208,34,164,150,162,192,51,22,140,188,244,10,213,207,103,61,
+131,52,201,127,192,181,253,126,222,225,159,27,60,98,93,241,105,179,158,110,228,240,139,97,37,109,213,62,114,57,59,126,136,33,177,214,64,105,235,33,
+28,117,100,68,96,149,129,73,245,63,68,138,209,181,67,24,221,198,157,30,249,1,193,156,21,224,252,68,38,135,18,238,174,13,9,44,247,73,123,52,
+81,70,180,83,116,162,212,141,229,161,13,200,166,193,88,3,17,27,4,152,80,65,12,10,112,40,66,234,61,82,207,161,85,90,237,173,130,118,53,25,
+149,104,149,172,222,217,90,20,246,98,127,221,213,246,35,126,79,221,53,42,54,242,13,141,3,48,91,212,84,231,56,73,254,37,97,142,241,212,245,172,
+24,175,1,32,123,177,86,33,179,24,227,40,176,198,57,130,226,70,226,82,88,179,8,198,14,108,199,33,62,23,80,74,32,39,52,121,65,83,134,134,
+85,202,168,125,125,106,55,86,202,58,209,82,105,178,230,143,60,89,97,21,1,152,64,2,244,31,160,236,6,40,21,128,121,16,168,254,204,118,139,181,
+180,185,6,17,184,255,102,181,164,254,183,59,147,98,69,241,8,127,231,58,230,192,254,20,151,229,151,55,192,30,155,142,13,176,107,207,126,147,209,75,
+172,173,162,8,89,160,168,102,119,207,9,91,31,209,188,50,202,39,91,37,82,173,176,198,38,98,202,99,101,76,248,44,231,216,7,5,29,6,67,21,
+242,135,196,146,205,242,234,184,236,247,46,25,63,251,38,205,198,160,242,103,155,156,72,163,171,1,32,58,195,212,13,161,72,5,8,57,128,26,4,40,
+168,72,150,108,20,157,175,149,220,112,190,201,95,55,157,60,245,204,221,98,152,95,162,211,255,62,35,133,191,136,36,202,21,11,241,249,159,139,147,221,
+36,88,186,200,192,236,16,227,10,72,73,16,10,19,18,157,227,234,96,44,82,214,52,101,202,99,116,89,102,17,196,143,89,124,90,169,187,130,141,3,
+0,222,211,128,128,145,218,47,60,39,238,103,37,219,226,205,50,242,211,111,181,204,186,42,179,30,137,215,194,214,64,112,107,4,212,76,192,146,22,160,
+62,131,168,3,112,89,139,244,149,103,35,78,11,16,223,7,14,140,170,179,152,212,255,94,189,205,226,20,253,236,95,247,175,85,71,249,227,229,22,221,
+139,137,4,63,188,30,43,220,208,250,224,10,39,219,180,132,215,38,23,97,242,16,115,65,241,68,212,56,214,128,66,213,114,83,231,172,222,102,37,49,
+72,36,144,208,86,14,10,23,185,244,16,98,35,70,56,136,229,232,165,27,129,228,201,240,3,151,173,196,228,65,90,8,114,79,194,14,130,82,140,216,
+67,228,146,6,153,36,2,46,47,1,134,129,68,211,165,3,91,154,174,97,19,131,118,109,121,177,107,245,175,14,228,243,197,127,89,119,253,129,157,90,
+255,66,253,65,157,243,238,3,148,206,248,208,127,218,98,127,40,174,90,104,103,248,97,9,77,42,67,96,40,28,142,42,151,233,169,169,20,155,194,109,
+9,49,34,220,130,161,181,75,68,62,81,85,3,196,6,177,181,149,116,242,168,253,81,234,192,214,118,181,245,80,168,229,22,103,245,47,41,68,197,150,
+34,240,0,128,136,61,1,86,19,224,69,2,236,13,144,157,145,116,174,41,55,86,43,186,224,171,147,126,103,218,149,235,87,190,190,53,191,131,75,255,
+165,248,44,95,162,166,55,206,156,120,69,231,85,188,100,109,119,178,163,42,136,184,72,157,119,58,209,32,235,242,36,85,221,139,126,192,28,254,11,205,
+33,148,177,154,12,41,248,155,181,16,146,93,23,32,68,66,125,3,220,33,37,153,47,106,69,210,150,177,117,121,173,245,93,106,101,75,138,8,205,230,
+83,17,255,136,140,38,160,106,6,192,125,3,84,32,224,121,2,0,46,34,177,42,217,210,212,254,205,248,20,226,211,152,206,135,186,210,236,221,170,54,
+109,207,250,149,191,194,189,252,111,250,233,100,116,248,223,225,242,228,81,27,236,152,46,87,7,195,180,222,40,151,218,20,4,7,113,225,80,48,194,43,
+179,19,51,147,48,131,60,194,217,230,225,81,20,167,8,147,139,180,184,128,90,19,144,136,224,253,67,233,102,86,210,137,150,102,167,93,147,41,115,87,
+185,237,208,162,81,178,147,136,236,66,32,80,2,176,125,3,32,36,0,160,3,192,23,162,3,34,201,155,210,130,190,183,124,195,207,39,12,247,53,26,
+217,79,123,233,75,255,139,123,255,11,38,127,63,125,153,194,57,21,221,155,113,92,79,112,144,186,124,200,104,45,31,32,63,218,56,93,201,51,151,61,
+83,179,235,45,190,134,130,232,104,88,44,232,120,133,39,203,8,144,64,187,142,0,1,145,242,10,150,33,36,252,138,61,171,101,179,121,73,203,94,154,
+112,86,248,149,245,109,227,7,66,56,12,202,50,38,65,59,144,160,29,100,164,6,200,227,4,230,12,194,214,141,229,72,232,227,126,91,186,229,159,147,
+158,176,218,123,239,43,154,175,128,115,255,174,179,183,211,253,140,48,242,91,135,210,30,250,207,6,140,145,27,232,223,137,80,187,4,13,190,181,36,54,
+50,170,58,199,90,86,53,2,5,224,80,67,95,116,242,107,110,152,69,76,161,240,163,242,20,99,100,133,198,115,131,247,134,49,127,226,231,117,105,114,
+95,118,111,151,152,154,69,168,36,229,82,184,155,77,250,3,225,229,138,0,42,227,210,1,8,241,0,250,33,161,67,132,188,197,37,223,88,106,227,96,
+177,134,158,103,57,222,235,133,178,102,226,23,122,127,164,59,253,11,222,107,255,32,234,175,58,8,219,99,81,76,222,106,121,139,28,47,105,127,44,128,
+38,151,240,154,40,102,160,170,151,178,84,106,26,39,74,163,50,108,169,196,164,14,142,17,241,206,146,79,82,55,135,180,49,32,250,136,164,220,102,71,
+83,202,58,216,214,158,150,87,165,69,110,167,107,72,217,42,76,74,26,49,151,132,72,26,98,228,3,96,215,128,88,35,192,219,130,76,167,36,221,80,
+106,145,223,115,1,252,179,179,15,214,7,87,125,251,176,54,253,23,95,253,207,209,36,254,196,220,86,30,107,213,24,208,31,136,116,77,25,116,95,209,
+117,252,231,145,185,215,160,121,251,183,133,141,130,57,87,152,45,159,157,121,52,61,213,236,66,181,55,243,164,160,246,81,194,149,138,20,176,119,0,53,
+18,41,53,206,42,133,85,43,169,85,123,106,185,93,106,104,84,34,117,243,187,145,196,141,161,113,12,152,67,1,0,39,160,169,9,224,18,0,202,14,
+216,161,75,166,115,149,126,179,142,13,24,185,230,171,162,70,187,155,82,105,117,196,37,255,113,167,236,200,253,247,121,166,85,197,232,151,69,22,205,83,
+233,196,110,226,48,18,174,221,122,68,229,144,16,99,212,204,41,90,206,103,211,92,5,20,69,158,17,113,83,193,7,116,164,141,40,121,242,11,145,164,
+43,97,66,10,12,97,102,229,58,186,125,212,22,183,85,132,173,93,77,169,207,68,25,207,203,146,67,49,105,132,252,7,161,2,11,80,133,3,100,26,
+0,47,2,4,83,100,55,56,58,77,88,250,239,152,154,228,229,160,166,162,219,61,239,89,14,159,248,30,63,238,40,241,63,248,53,213,117,225,87,6,
+150,182,212,9,206,158,176,211,73,164,252,224,68,139,135,40,40,212,246,27,58,246,133,134,98,54,107,54,38,134,205,96,56,93,245,128,136,42,153,112,
+109,15,232,14,250,87,14,6,54,69,176,133,205,207,100,197,128,36,204,111,249,50,219,156,73,222,188,209,75,162,52,4,69,75,20,224,167,72,140,16,
+146,84,3,212,111,66,141,5,33,112,199,98,165,180,146,191,109,230,114,209,202,99,88,45,70,183,102,198,39,208,93,255,208,221,201,149,254,179,119,229,
+86,139,211,226,239,238,226,152,75,181,161,174,218,90,244,65,13,13,23,138,248,88,196,166,78,0,175,2,3,171,187,161,0,188,105,254,214,88,52,178,
+131,164,121,68,200,61,5,242,6,76,175,70,149,1,138,168,73,50,212,147,180,185,85,15,237,201,63,202,246,204,98,143,81,208,150,132,28,34,127,11,
+160,8,69,156,15,193,99,2,16,35,129,165,17,105,88,205,190,166,86,68,192,67,20,220,190,180,48,214,23,108,125,187,114,224,127,207,133,252,165,95,
+49,46,208,146,29,241,200,167,31,20,250,233,229,197,59,26,196,193,46,18,211,84,31,145,167,79,152,137,114,86,41,101,40,214,154,114,157,137,91,168,
+118,137,2,81,70,191,64,108,123,165,67,6,144,150,196,27,4,58,58,73,86,197,83,169,184,93,10,174,43,62,59,48,203,218,164,17,160,156,180,10,
+36,33,18,16,109,199,220,7,50,31,2,180,94,2,149,0,25,133,200,226,174,116,250,193,18,255,249,151,101,227,174,166,170,155,232,88,191,247,97,127,
+247,138,93,223,252,8,251,6,61,137,232,245,149,31,48,57,226,52,246,200,45,133,70,154,233,24,236,178,58,189,211,67,208,190,41,133,23,159,66,177,
+107,164,110,21,9,69,129,41,227,244,158,160,181,68,106,24,32,76,64,174,27,57,2,80,10,121,85,139,166,133,142,42,19,96,250,66,84,206,109,179,
+219,144,12,148,161,25,14,40,82,0,152,41,224,141,10,8,10,128,192,16,216,167,204,38,118,21,156,180,62,16,88,195,230,211,162,206,188,219,115,232,
+115,220,145,255,143,251,226,212,253,101,182,31,145,191,167,44,66,121,124,84,143,19,90,191,200,214,93,50,231,7,153,180,9,204,142,2,6,169,218,164,
+242,164,210,112,106,51,38,158,153,98,64,8,136,159,76,203,69,26,26,168,139,128,180,9,105,34,203,154,137,84,134,172,53,85,235,215,85,106,195,82,
+114,143,243,95,152,140,120,163,23,7,8,28,194,156,19,225,38,6,32,56,64,52,3,152,178,72,122,115,148,165,178,213,227,177,81,202,31,66,237,74,
+182,134,221,186,32,111,245,122,127,215,57,244,168,243,120,193,217,238,11,109,215,40,120,111,105,213,85,185,25,216,82,181,164,89,205,116,48,59,167,5,
+209,141,232,246,153,98,149,69,148,1,107,88,136,147,221,106,225,174,39,58,18,36,12,194,191,76,145,232,198,200,188,80,228,187,140,173,176,6,157,109,
+236,39,145,105,9,150,83,130,66,210,238,134,196,67,224,118,6,48,107,4,148,23,129,6,1,172,2,99,255,31,202,65,82,138,240,23,176,202,159,44,
+141,101,117,110,222,195,48,255,24,151,255,73,135,69,87,250,26,213,53,100,143,26,104,166,183,142,134,178,191,176,7,172,100,111,192,238,86,34,61,163,
+22,111,133,75,80,55,94,145,5,134,20,167,120,96,80,91,245,149,198,208,156,16,47,208,15,15,85,28,136,147,17,131,10,198,154,227,179,143,186,77,
+34,109,63,74,10,160,208,2,109,178,235,139,156,108,224,170,10,232,207,128,162,68,128,88,141,248,87,32,198,50,216,235,86,162,151,24,70,95,207,56,
+108,200,246,51,215,91,126,200,132,255,128,235,255,35,86,221,95,151,197,130,92,201,175,25,187,29,219,115,65,149,29,229,100,22,44,58,205,138,117,1,
+211,208,35,94,156,114,75,202,252,164,90,181,218,36,234,243,157,153,60,34,138,33,102,39,18,149,0,202,51,66,138,140,157,20,40,29,85,74,210,86,
+6,200,212,224,176,52,230,106,43,30,217,222,192,174,74,17,85,9,60,146,1,15,38,224,84,70,152,52,16,17,155,84,165,171,187,90,220,45,177,0,
+206,127,66,221,137,55,17,218,7,144,67,255,70,231,198,205,250,153,86,27,128,111,39,154,247,244,222,143,27,61,171,205,175,67,153,178,47,154,173,11,
+151,104,129,127,174,4,119,85,181,82,41,87,189,49,69,18,146,103,71,217,7,83,145,22,160,130,34,118,8,128,43,163,29,54,73,197,213,122,150,246,
+116,168,37,167,41,3,94,249,174,210,154,59,83,13,130,100,94,161,240,4,56,214,1,52,50,160,11,4,192,70,226,143,49,153,241,214,234,223,184,90,
+228,123,157,118,167,155,21,240,42,196,83,245,243,127,246,11,87,239,248,129,240,79,123,242,197,233,151,238,98,146,255,222,14,206,170,193,230,226,129,206,
+191,162,18,220,224,111,107,200,30,169,113,212,138,149,219,75,213,61,52,143,81,31,65,92,191,37,171,21,80,171,0,245,3,137,147,74,150,163,52,87,
+177,101,75,44,171,82,10,214,81,90,140,115,8,150,28,97,34,67,2,24,23,131,60,28,129,12,6,72,28,64,115,16,233,13,77,98,150,22,52,189,
+182,42,153,105,104,179,172,182,216,251,185,77,65,255,45,199,252,194,31,196,215,177,134,70,239,155,214,84,78,144,240,87,82,162,147,18,22,158,213,14,
+0,20,126,162,114,164,6,138,146,94,106,70,165,190,178,10,59,75,51,31,237,82,98,184,165,164,39,227,232,2,50,145,163,88,139,137,101,162,85,112,
+249,130,222,146,127,215,85,160,189,144,102,237,73,233,45,202,238,34,80,236,128,96,30,65,102,19,0,83,4,36,7,144,13,143,204,128,232,223,74,187,
+177,222,231,40,44,180,245,108,213,247,120,108,200,188,52,159,252,192,29,177,31,229,141,40,69,28,60,131,33,24,217,46,20,58,100,196,34,161,81,122,
+2,73,109,7,176,145,185,136,21,255,58,195,7,83,201,177,94,54,243,11,162,172,45,122,51,52,238,193,110,128,248,116,104,194,65,152,119,151,110,59,
+246,223,158,157,195,41,165,102,106,116,212,62,136,83,66,153,44,83,227,197,7,96,104,198,232,7,210,60,3,12,116,66,177,7,1,143,199,66,178,84,
+186,193,202,255,89,182,230,99,176,222,189,187,255,69,243,251,230,63,241,236,107,155,249,25,210,213,202,194,229,60,31,44,117,163,172,116,240,28,144,224,
+162,234,22,54,3,150,33,88,132,218,149,72,170,173,252,138,106,241,232,63,173,2,111,69,9,137,164,135,32,150,74,98,2,200,193,9,178,56,84,34,
+162,93,70,235,211,84,27,70,210,118,201,115,86,170,164,107,103,231,0,241,62,70,32,40,242,113,4,236,163,11,2,210,55,33,165,128,76,218,37,51,
+93,138,220,97,95,136,142,114,186,33,236,53,185,70,215,220,68,31,250,108,190,89,143,216,14,144,124,21,185,164,209,115,182,44,236,218,171,97,64,192,
+175,52,148,75,116,182,16,94,176,100,14,87,165,7,181,117,147,6,84,129,59,180,237,18,214,70,105,11,3,125,22,224,130,130,100,9,192,54,162,153,
+58,41,155,86,166,138,246,196,165,21,187,104,69,99,249,131,83,198,50,19,80,128,140,109,34,72,7,40,228,0,172,52,128,12,132,232,73,226,147,49,
+169,245,214,194,225,24,81,228,145,156,182,169,59,6,112,43,197,207,244,103,127,247,137,79,235,249,218,242,40,123,251,192,53,134,30,177,48,217,226,121,
+120,101,137,51,129,64,47,86,192,185,108,192,68,37,172,208,104,89,125,44,101,84,147,100,78,9,39,228,65,80,109,48,121,102,197,206,39,208,17,66,
+2,87,146,255,165,77,47,107,121,89,106,247,86,42,170,52,186,160,196,216,37,17,28,248,122,65,110,9,192,167,7,200,61,193,172,6,192,25,68,14,
+67,51,64,165,157,132,239,125,137,110,91,250,24,235,81,180,222,237,242,171,127,194,241,255,87,215,237,171,227,233,162,11,231,15,137,99,148,100,116,50,
+233,176,44,81,40,173,67,160,30,29,188,174,232,170,36,8,146,42,166,169,41,45,146,139,218,216,39,205,85,76,174,9,105,138,140,245,96,74,162,72,
+192,162,42,83,104,201,218,182,110,55,72,163,45,192,168,235,95,153,226,209,142,82,242,140,137,228,50,96,25,9,48,85,132,252,21,161,15,1,84,4,
+35,187,32,250,39,82,250,231,247,212,201,119,47,61,82,117,162,221,183,53,63,3,215,255,22,167,133,227,252,71,224,53,152,159,144,4,31,250,116,72,
+11,59,152,220,211,22,50,0,26,178,144,196,211,22,41,202,220,230,123,98,136,109,166,63,198,87,98,74,80,101,188,134,40,158,0,48,80,1,13,69,
+10,199,185,10,194,201,200,158,210,116,25,182,13,68,236,65,82,42,104,81,210,97,179,77,137,36,128,97,40,14,120,231,1,50,72,160,103,142,128,85,
+160,206,49,104,239,214,14,153,152,46,224,29,154,174,104,123,0,236,3,192,30,63,95,221,229,255,141,195,79,95,197,6,118,142,82,182,90,227,113,79,
+61,94,34,105,130,124,120,68,5,67,34,44,152,21,28,179,179,171,120,130,18,252,40,59,176,53,63,98,221,134,160,81,120,150,168,122,9,152,164,128,
+1,10,240,138,99,233,61,58,67,211,38,197,84,241,182,133,21,45,27,49,138,201,69,238,133,144,52,21,116,104,130,221,40,0,92,74,68,24,49,184,
+13,44,3,38,189,41,218,226,86,243,9,60,69,115,117,209,35,95,125,203,54,224,224,6,255,212,105,244,35,126,223,51,159,224,99,210,66,79,222,26,
+21,100,109,79,138,51,6,140,188,16,149,206,236,32,154,40,148,173,76,132,95,84,232,79,81,71,117,19,211,79,76,193,23,20,54,14,4,91,98,32,
+137,0,47,193,25,135,188,252,229,183,96,89,255,92,154,137,183,77,158,189,166,37,141,83,232,174,78,54,2,193,223,138,16,35,35,188,2,0,218,0,
+34,20,225,26,138,44,192,231,219,89,107,136,97,13,146,190,111,90,174,235,231,192,211,29,15,202,197,255,225,150,140,191,246,158,231,64,247,137,143,62,
+201,92,2,162,50,202,159,3,213,153,115,68,60,94,149,224,157,213,248,164,170,241,34,90,174,2,106,170,118,39,116,154,178,83,104,134,32,176,99,226,
+175,140,204,68,96,62,7,108,147,230,239,67,106,155,85,58,193,21,135,175,133,61,106,31,60,153,209,201,34,63,208,195,131,204,28,65,48,16,224,123,
+3,116,14,128,55,135,156,138,38,87,76,186,253,223,119,17,60,192,180,23,215,63,103,205,221,228,56,255,104,231,253,241,223,179,151,147,30,17,175,90,
+249,31,181,12,164,158,94,146,18,184,165,57,10,41,159,112,172,184,116,130,33,153,65,10,89,118,157,5,135,82,35,106,219,162,234,142,130,13,37,162,
+50,96,100,199,36,31,168,89,18,214,60,214,103,158,245,193,41,233,106,26,141,85,186,141,243,176,153,188,111,163,143,0,48,64,68,236,9,33,159,2,
+176,65,1,5,9,153,35,76,102,154,22,58,190,206,52,121,130,105,205,174,182,239,219,111,230,134,255,218,29,251,135,191,206,118,190,21,232,245,162,131,
+119,61,58,44,99,227,43,106,108,205,8,73,185,13,0,215,119,65,40,178,52,41,203,37,99,230,176,105,69,193,80,180,117,80,209,67,236,137,71,29,
+0,61,37,199,95,28,195,37,195,134,245,51,14,190,173,26,237,239,78,26,165,82,26,101,19,147,135,140,150,225,226,19,105,17,129,222,75,96,94,139,
+208,71,160,229,43,249,160,84,142,212,120,2,228,115,152,86,178,58,216,112,40,209,223,195,69,255,223,249,192,197,254,139,216,40,180,31,229,147,110,109,
+187,110,191,97,122,244,64,150,26,51,9,45,129,61,147,98,53,98,220,232,56,175,206,143,58,214,73,82,39,162,147,65,248,17,43,28,17,198,1,105,
+71,146,30,70,136,213,81,18,190,164,207,111,147,73,139,90,212,54,155,116,179,148,204,241,96,173,41,40,192,133,198,82,64,177,148,176,37,226,244,21,
+120,85,75,226,117,21,89,185,110,6,153,105,102,89,177,30,183,60,35,176,137,252,66,95,254,31,135,244,255,30,205,97,157,107,177,61,214,167,16,188,
+214,98,173,142,85,79,139,29,137,24,27,147,10,50,218,125,137,91,168,182,166,178,139,106,94,167,128,150,154,77,103,163,65,144,121,197,212,0,108,191,
+6,195,2,98,223,201,110,223,20,50,184,101,75,236,65,84,170,57,210,146,75,243,127,130,100,138,226,190,16,25,34,129,50,69,32,83,135,216,79,226,
+99,48,234,22,86,90,244,88,70,102,95,156,142,203,91,10,112,78,148,231,249,92,191,247,197,121,248,126,3,152,209,60,13,168,91,198,78,164,122,211,
+199,21,64,124,58,80,169,214,112,108,219,222,9,233,128,145,218,215,101,74,25,96,100,226,148,14,74,177,24,244,22,77,84,82,65,201,134,144,18,65,
+153,144,181,8,168,75,91,10,179,216,190,184,181,175,170,117,25,232,101,42,169,92,195,106,39,80,162,0,116,93,64,254,22,0,26,1,44,33,17,190,
+153,53,36,107,229,125,220,70,115,63,208,223,99,221,172,247,76,175,219,254,109,79,244,119,126,229,189,17,161,163,231,249,76,94,32,21,17,210,2,46,
+169,112,98,66,131,6,216,68,19,226,254,20,54,59,166,54,97,82,142,18,205,9,188,38,224,154,178,0,200,212,17,196,220,128,254,28,136,128,160,114,
+69,41,82,87,46,149,22,92,173,45,130,107,61,79,58,95,205,114,106,113,148,141,196,0,192,159,17,112,71,5,124,19,128,181,2,92,59,36,77,54,
+138,101,90,6,253,120,237,230,79,168,110,192,59,186,106,211,199,13,255,191,219,226,158,254,220,51,208,213,191,156,142,54,250,47,225,93,123,233,52,88,
+34,180,4,79,208,236,38,187,255,140,5,136,129,205,88,10,164,224,173,66,133,9,37,40,108,102,244,176,133,10,129,32,66,233,164,62,56,165,151,62,
+59,182,192,161,213,174,235,35,93,138,238,209,42,168,50,94,160,28,27,164,253,18,32,136,71,252,3,17,245,0,176,59,65,91,17,25,50,79,126,157,
+23,49,191,110,85,89,137,235,177,174,159,1,44,143,126,20,143,254,170,201,50,63,150,69,82,27,197,101,167,191,229,128,246,17,136,102,10,177,27,2,
+116,148,78,62,66,21,9,205,146,179,138,50,235,48,39,140,164,2,153,232,179,40,240,90,84,180,67,140,128,216,108,233,104,151,145,60,190,172,194,255,
+209,101,73,228,21,21,224,210,22,148,206,57,23,136,79,248,98,45,28,30,150,5,181,147,101,21,143,212,95,140,68,79,200,244,229,70,5,77,67,125,
+127,65,53,117,193,209,18,117,164,255,251,1,127,219,75,255,255,255,129,143,233,251,255,236,1,254,83,127,73,206,170,62,192,158,74,255,96,207,75,95,
+151,151,64,30,203,214,161,192,232,247,216,72,82,4,56,87,0,152,121,71,9,163,209,114,95,173,141,96,216,28,91,238,6,149,157,109,73,59,165,99,
+46,146,49,5,128,32,241,14,234,122,25,123,108,31,139,183,32,187,88,29,218,118,25,89,80,21,40,30,18,56,244,144,185,194,144,58,56,143,218,77,
+142,233,255,138,184,180,249,83,127,255,144,69,208,63,255,255,254,24,61,13,63,59,143,181,191,184,71,63,159,104,175,71,255,203,195,233,31,250,220,124,
+67,126,150,29,91,251,43,97,203,135,243,216,187,1,111,142,80,221,132,73,122,133,186,150,129,99,151,137,164,8,199,25,234,70,185,122,68,88,214,192,
+248,32,194,124,135,5,93,7,135,85,80,8,37,86,7,205,30,6,228,186,134,52,68,134,116,44,71,188,133,201,228,188,76,84,201,78,116,174,207,116,
+111,205,244,193,63,75,111,255,248,244,127,65,63,255,255,252,224,127,247,128,79,120,26,209,249,140,115,72,204,175,209,243,197,159,236,65,233,159,243,28,
+236,31,224,13,154,174,97,17,107,125,66,129,1,113,4,74,17,196,101,112,188,97,49,9,75,146,151,50,115,67,29,210,223,17,49,147,12,16,62,12,
+114,42,16,51,200,20,212,186,23,212,200,24,19,246,22,178,124,22,16,182,24,17,5,29,50,105,37,19,59,46,115,93,54,242,215,58,241,183,55,55,
+180,255,166,55,255,246,30,255,255,92,127,255,254,144,191,255,132,247,225,243,223,59,93,94,60,211,187,151,212,21,32,59,193,147,47,222,157,89,178,239,
+209,88,251,58,48,58,74,2,193,175,162,84,29,214,178,84,105,245,37,179,2,131,184,99,47,184,103,157,152,167,144,88,94,137,8,84,7,73,57,9,
+138,21,13,218,169,17,154,197,19,10,91,17,249,131,15,88,102,11,232,201,136,217,214,134,154,153,133,138,240,133,202,206,134,90,46,134,189,110,191,253,
+251,63,249,163,127,255,255,127,159,251,98,255,249,192,127,139,95,239,113,247,23,253,60,190,13,127,15,109,95,116,72,22,211,114,144,34,33,207,129,36,
+93,232,67,66,32,213,24,213,171,38,47,2,202,185,189,245,80,215,26,98,166,93,0,48,252,79,80,75,39,208,115,14,48,90,3,145,208,5,83,106,
+14,212,168,26,21,14,32,212,88,32,146,160,25,240,42,14,50,161,0,165,85,15,199,117,28,40,82,145,164,37,72,249,202,200,219,132,151,255,247,92,
+243,140,255,255,255,237,202,164,223,183,39,227,75,250,152,126,94,255,217,91,246,111,254,95,223,29,223,140,102,196,123,47,52,172,87,3,184,220,6,56,
+169,135,237,30,27,221,179,38,199,5,42,253,193,98,197,237,157,67,148,90,135,216,238,43,8,6,144,168,140,131,128,151,143,128,65,147,80,80,16,32,
+227,9,49,53,2,17,27,3,8,140,4,200,105,130,153,161,130,210,228,138,67,249,145,212,78,75,106,38,230,8,252,40,153,242,140,255,255,157,23,150,
+15,255,255,255,36,159,249,193,36,220,81,120,154,118,185,252,81,190,251,127,202,43,236,91,248,158,119,187,240,98,192,159,22,69,149,123,161,29,52,33,
+115,39,164,123,56,232,24,167,164,192,86,98,125,41,225,43,147,66,127,209,32,71,16,233,12,114,121,38,67,79,73,227,91,90,162,189,88,129,179,71,
+32,177,46,64,39,21,96,81,1,65,51,10,146,177,12,180,123,6,54,49,5,71,211,11,71,19,7,37,133,112,175,254,252,223,255,207,219,255,255,252,
+245,255,254,166,255,255,252,134,63,255,218,31,255,211,19,243,87,227,24,51,195,32,179,83,22,134,191,13,172,234,250,139,104,107,183,37,96,104,220,205,
+167,192,87,97,34,89,162,154,163,32,54,235,225,192,244,224,172,174,99,46,49,232,14,88,11,230,196,204,206,238,201,194,207,4,10,127,193,252,34,70,
+96,47,39,236,98,230,72,114,162,52,108,226,54,105,101,54,114,101,242,135,164,110,156,161,114,155,48,48,255,196,155,255,252,28,191,255,252,124,255,255,
+182,239,255,238,121,255,203,71,255,102,47,243,253,253,238,56,132,222,97,112,2,6,53,72,116,27,55,8,162,238,182,24,234,233,21,128,77,83,165,6,
+156,10,226,42,37,118,133,100,218,130,103,14,77,104,214,30,167,142,21,34,218,49,227,240,97,106,160,136,110,196,136,174,112,88,169,248,13,35,16,61,
+132,62,110,74,22,115,141,10,71,76,178,4,106,78,78,103,74,124,228,186,123,162,186,95,223,240,126,255,255,175,183,255,250,192,255,255,254,17,127,255,
+225,225,250,252,249,5,117,137,249,92,121,61,250,134,97,151,123,194,198,31,200,72,10,145,106,61,83,109,216,18,202,120,5,96,219,73,74,184,175,164,
+26,66,4,246,83,28,66,216,156,9,212,60,31,75,12,50,67,44,8,64,24,102,1,164,247,6,117,113,138,221,145,139,77,50,7,20,108,0,36,139,
+71,1,117,75,146,7,165,133,9,177,46,112,81,35,67,179,33,22,241,153,255,153,39,255,254,209,95,255,233,43,255,255,255,100,31,255,255,145,183,252,
+24,238,189,62,33,115,29,29,104,49,209,232,81,103,156,139,11,5,145,16,176,83,11,176,181,141,157,196,164,219,36,75,77,200,18,200,108,105,38,144,
+240,85,147,151,13,214,37,32,70,69,48,68,95,42,33,183,32,96,92,30,193,38,40,0,150,54,64,203,62,130,23,51,98,129,17,65,219,33,240,105,
+89,209,70,131,121,55,69,244,145,160,98,29,10,210,41,159,239,161,255,255,161,39,255,249,218,255,255,255,138,79,255,255,217,243,255,229,255,247,26,75,
+108,193,123,12,84,142,97,17,220,125,61,104,41,235,154,132,2,100,180,54,38,36,10,129,36,71,227,196,227,233,45,55,118,66,167,122,168,75,60,139,
+153,116,100,69,61,36,203,193,124,85,161,81,214,216,193,82,16,27,203,176,85,6,136,114,131,184,58,130,200,47,65,152,143,66,84,182,73,172,146,83,
+84,47,220,164,73,32,254,81,207,202,190,31,204,171,255,255,13,239,255,129,175,255,255,243,179,255,255,39,143,252,171,255,170,215,58,119,66,213,115,96,
+126,250,151,223,195,72,146,4,14,232,210,217,200,130,119,53,14,122,21,160,62,112,124,49,241,27,79,112,2,125,210,28,142,169,168,69,52,165,152,220,
+26,134,212,141,203,145,19,89,49,67,222,105,4,90,88,122,208,168,17,5,136,103,131,220,111,9,204,40,11,252,73,204,116,169,205,132,201,80,68,150,
+84,60,26,214,85,45,190,240,31,255,251,29,127,166,159,255,255,255,31,63,255,130,215,25,220,44,173,179,172,98,129,143,70,87,87,133,229,241,102,60,
+133,138,180,227,33,168,254,54,120,167,237,83,168,22,246,208,97,28,197,87,29,116,57,41,148,203,19,181,237,13,38,51,31,196,165,26,97,135,1,130,
+76,31,85,176,58,23,144,66,23,50,50,244,216,23,49,116,3,225,247,20,164,163,21,70,3,5,69,243,19,244,247,40,211,177,45,242,141,27,159,193,
+211,255,255,167,135,238,23,255,255,255,253,165,127,255,180,116,2,251,133,249,165,79,213,123,35,116,8,137,93,58,135,67,205,122,85,183,234,84,117,208,
+47,68,183,136,52,227,229,33,85,55,182,151,233,110,59,8,149,164,9,129,152,169,82,150,72,116,150,76,176,236,34,49,212,8,81,144,26,224,104,61,
+97,31,83,130,91,83,34,199,58,34,97,15,65,127,34,16,121,80,80,104,112,112,190,120,208,70,102,48,191,64,210,61,252,72,191,255,249,95,126,252,
+63,255,255,255,213,191,255,255,79,79,136,142,243,127,199,227,242,111,250,21,100,23,90,68,176,34,102,192,92,64,235,158,35,79,207,33,127,215,48,89,
+73,60,225,161,218,198,19,241,89,201,135,149,115,250,131,42,93,144,169,60,144,8,167,133,136,101,135,112,37,143,240,70,17,112,192,13,65,26,5,241,
+40,1,248,220,9,24,71,14,232,117,146,233,65,147,106,15,142,250,203,134,27,60,131,19,1,140,55,198,147,255,255,34,239,104,63,255,255,255,132,31,
+255,227,77,244,233,140,231,80,239,155,127,242,8,249,218,252,96,50,123,196,48,57,15,217,134,10,144,117,152,137,1,94,65,135,81,249,12,68,196,39,
+218,124,142,35,70,95,81,115,27,38,243,1,212,7,15,209,231,7,208,211,14,64,101,36,160,1,46,64,166,41,161,46,29,225,18,19,0,24,12,33,
+135,6,3,23,6,211,227,28,147,201,51,147,57,63,146,193,54,114,113,2,223,30,47,255,249,249,20,255,255,255,255,215,103,251,125,66,234,13,116,188,
+169,111,135,103,139,47,216,147,197,7,207,195,18,252,127,9,61,92,14,224,87,7,40,169,13,5,22,25,228,199,24,68,45,205,69,62,193,77,232,69,
+25,229,68,49,84,64,40,166,64,244,54,195,32,30,74,168,59,81,104,83,83,8,59,78,160,12,71,160,2,66,24,68,64,104,206,65,225,100,66,177,
+169,193,29,110,73,84,202,82,4,4,23,247,200,59,255,254,115,156,60,63,255,255,255,196,63,167,249,97,126,153,95,213,191,236,37,154,30,75,146,43,
+226,13,167,175,145,118,255,125,113,46,227,137,242,111,177,32,105,6,64,46,4,97,210,145,163,152,146,99,200,128,234,138,156,168,209,176,200,117,50,152,
+205,34,24,120,11,56,66,2,240,179,2,145,186,9,58,205,22,139,57,27,90,145,21,185,52,14,136,26,142,248,187,155,120,126,175,152,47,62,24,113,
+57,40,48,158,42,48,248,45,127,255,215,227,136,199,255,255,255,248,141,238,255,238,165,233,197,255,133,79,254,152,95,191,63,193,26,218,56,16,40,14,
+55,83,253,225,149,138,159,3,43,34,223,49,202,216,200,123,192,152,71,69,20,247,192,241,211,70,42,10,161,84,199,99,206,76,40,226,38,74,174,96,
+135,230,88,194,82,58,193,252,57,66,80,100,65,98,167,134,234,212,202,226,190,203,6,100,72,130,10,230,34,86,166,86,92,169,138,34,237,150,34,78,
+14,31,156,80,63,255,226,65,205,99,255,255,255,251,131,255,165,37,57,191,17,31,250,47,127,191,47,249,206,124,50,252,75,165,179,92,97,165,161,147,
+19,226,109,72,60,184,170,247,95,200,178,176,162,81,130,121,52,151,89,175,144,90,252,128,211,195,135,179,36,129,153,96,146,152,170,31,26,22,29,90,
+96,13,121,202,4,129,46,10,113,42,1,41,201,25,138,142,49,250,177,60,41,184,52,216,8,36,249,122,152,218,7,152,153,75,161,24,127,101,157,255,
+253,216,63,42,47,255,255,255,127,246,246,251,75,122,175,252,222,62,159,127,204,211,241,191,252,219,59,22,244,128,137,109,25,130,30,8,133,171,48,8,
+124,214,90,143,179,162,152,154,236,56,232,20,158,201,201,151,137,199,161,104,162,173,168,115,42,248,157,21,152,19,137,161,5,164,177,130,175,193,40,168,
+16,69,152,16,70,13,48,34,142,65,129,152,99,65,161,52,54,206,58,20,162,0,201,164,78,106,232,62,35,167,251,143,119,255,241,230,255,192,139,255,
+255,255,245,59,235,215,255,241,30,255,169,15,225,61,195,79,180,55,41,95,134,199,132,15,187,166,210,60,3,156,70,62,192,14,183,133,118,249,208,41,
+131,164,71,207,41,76,76,228,27,96,58,52,16,125,5,37,167,23,83,71,12,211,61,37,100,155,90,132,211,100,2,73,61,193,130,9,196,18,21,51,
+210,19,17,106,11,176,117,34,112,25,90,177,248,138,185,162,71,252,96,154,220,149,197,117,152,250,189,127,255,198,147,227,21,255,255,255,254,34,133,191,
+169,71,209,51,224,155,192,137,46,109,93,89,254,219,27,49,244,228,154,29,40,14,0,20,226,60,106,106,128,15,224,230,6,195,90,118,34,129,19,244,
+110,160,74,34,71,204,64,149,220,120,72,52,132,68,148,16,6,124,160,3,84,144,8,64,20,86,96,205,93,81,9,86,216,178,72,120,87,66,220,117,
+197,85,14,65,253,145,67,61,84,78,180,69,223,101,29,29,143,253,22,63,255,237,229,255,226,187,255,255,255,8,223,255,231,221,252,210,127,86,239,191,
+63,225,81,194,167,31,3,90,45,165,224,136,226,182,229,65,85,28,195,38,207,46,165,115,47,66,237,2,165,49,24,40,105,149,148,83,66,145,108,205,
+140,44,89,92,168,24,68,185,140,68,117,129,92,130,0,5,6,134,253,155,141,53,151,10,4,199,0,12,91,72,65,47,199,105,88,66,61,27,74,101,
+31,71,197,167,197,210,40,170,112,150,31,255,151,167,255,56,143,255,255,255,5,222,58,63,226,145,254,102,63,249,81,127,205,183,253,91,61,237,123,100,
+64,142,164,69,227,126,105,46,233,117,83,156,12,158,117,112,129,236,178,73,113,103,64,113,8,205,100,193,206,253,42,66,181,237,205,18,37,169,184,222,
+38,184,79,34,60,37,192,208,71,131,88,36,134,48,12,132,112,49,2,118,123,138,218,166,79,70,113,205,82,9,104,174,111,230,46,127,167,170,59,169,
+206,2,30,161,95,255,251,84,115,53,255,255,255,254,209,127,255,240,100,254,22,234,157,231,133,235,95,235,85,81,56,161,70,40,106,227,140,129,1,229,
+12,129,155,69,163,4,73,120,34,75,166,20,210,253,62,199,101,16,52,233,40,21,67,9,86,227,29,166,135,28,226,247,8,17,238,46,117,108,52,181,
+200,21,179,240,8,194,140,3,194,218,37,244,4,82,179,152,88,16,66,50,116,141,0,56,25,140,148,33,66,73,114,197,252,27,191,243,102,255,255,206,
+91,255,255,236,191,255,255,222,95,255,255,244,164,255,254,137,127,230,213,164,205,115,155,135,133,230,181,126,78,26,158,240,226,131,60,208,2,93,127,9,
+253,253,33,99,34,233,210,185,212,51,66,48,244,212,132,45,219,44,56,83,44,151,201,172,122,72,236,79,15,165,81,148,237,206,15,157,112,2,60,169,
+8,240,20,138,64,4,194,32,23,6,44,47,197,181,14,67,98,17,230,153,45,211,44,136,8,30,33,202,16,226,133,255,253,196,191,244,122,255,255,255,
+255,16,245,242,23,255,242,204,255,213,71,247,30,220,15,123,44,136,124,165,57,238,250,51,103,167,170,146,41,179,193,240,6,225,32,18,65,130,154,18,
+93,130,136,237,178,169,26,74,60,239,164,122,57,77,66,23,38,162,34,100,90,33,5,70,115,4,198,127,128,14,59,134,200,37,235,132,99,170,220,92,
+165,104,61,32,22,69,98,14,136,32,122,217,224,192,227,34,162,124,234,10,53,80,65,252,226,191,255,242,28,242,21,255,255,255,254,212,127,255,147,22,
+190,115,180,176,239,20,200,254,188,197,40,155,86,253,193,106,120,18,220,111,251,97,66,62,47,136,226,82,4,250,1,137,238,50,209,9,54,73,57,146,
+67,234,135,41,210,154,136,70,154,152,59,10,184,51,5,32,127,8,97,88,0,154,76,12,154,152,15,249,201,8,216,53,1,33,101,132,178,85,131,202,
+91,146,170,27,151,90,116,134,251,130,155,96,112,203,255,235,17,255,252,226,191,255,255,9,255,255,179,47,255,195,171,253,210,255,225,205,254,81,63,226,
+209,238,99,219,169,237,231,160,30,117,218,132,190,129,213,155,199,170,61,112,242,63,177,114,32,16,233,68,112,10,111,112,46,105,113,231,59,20,93,10,
+245,21,12,3,151,12,129,55,12,224,128,22,33,62,33,129,96,37,193,58,30,224,250,10,224,228,22,177,32,62,209,40,87,144,51,79,18,223,47,149,
+61,22,85,71,22,50,157,225,97,255,254,232,221,222,191,255,255,255,175,175,252,34,152,215,102,255,213,67,246,75,253,158,58,161,239,124,96,241,20,9,
+170,29,51,205,253,160,99,45,3,19,30,129,156,57,241,106,62,146,43,38,212,99,46,243,91,79,176,253,96,112,60,74,176,5,34,112,13,6,208,248,
+3,66,54,11,66,118,23,225,236,25,225,168,6,33,200,23,49,72,39,208,127,42,82,49,58,81,193,103,144,246,141,57,180,71,4,163,145,103,252,6,
+191,255,249,151,127,254,170,191,255,255,242,169,255,255,249,98,127,252,201,127,64,196,5,82,90,122,41,129,208,228,204,239,117,98,21,67,100,91,33,136,
+14,229,114,96,151,124,131,74,24,49,8,86,163,41,31,172,200,65,189,24,171,58,184,128,35,232,1,143,104,83,11,41,122,14,250,82,10,42,13,2,
+225,87,6,129,54,8,89,172,29,185,148,35,184,66,26,233,71,151,153,144,167,168,106,187,104,86,47,41,91,201,75,255,228,77,255,253,37,191,255,255,
+255,173,239,232,175,255,254,150,223,255,105,191,247,26,236,251,193,114,222,189,111,55,83,241,22,199,79,74,133,3,136,224,65,185,162,125,200,66,65,241,
+114,139,169,236,47,40,143,165,24,213,181,104,92,65,252,109,154,220,6,11,140,81,65,236,0,3,36,189,6,13,8,0,20,150,10,160,3,206,72,31,
+197,160,41,5,12,0,68,236,237,196,129,252,74,34,28,161,48,202,227,178,153,224,29,6,255,105,79,255,249,78,114,210,255,255,255,255,18,33,159,254,
+87,218,36,120,91,238,188,106,50,148,122,222,32,217,5,242,116,149,93,110,2,137,15,11,73,8,11,29,191,155,21,51,19,140,84,197,109,101,67,229,
+60,207,28,140,212,100,121,73,221,3,70,241,86,78,200,213,74,96,0,71,112,48,15,24,104,90,249,11,220,192,250,80,128,142,68,112,180,68,217,167,
+78,90,75,232,29,28,240,190,94,242,157,53,209,109,23,31,248,19,127,255,221,19,255,246,151,255,255,254,154,127,255,226,193,252,210,126,197,94,245,127,
+62,109,226,242,164,44,98,118,118,230,106,26,154,211,58,61,6,17,77,26,130,108,12,138,92,110,159,245,22,165,178,105,80,179,5,181,115,27,53,11,
+14,198,225,73,103,55,85,4,17,54,224,103,39,192,86,67,129,219,104,35,123,90,66,45,28,64,17,24,208,131,25,83,243,1,6,95,14,148,87,84,
+48,128,137,89,219,63,14,90,31,255,133,39,254,137,95,255,255,255,47,21,79,251,185,125,89,127,163,215,242,133,254,120,30,109,189,93,31,198,167,198,
+35,125,201,13,232,13,66,251,115,54,42,250,21,40,210,35,249,117,68,149,28,36,170,61,142,30,67,103,54,105,102,110,20,105,110,74,136,6,68,0,
+142,2,102,196,31,103,180,26,195,84,82,129,84,30,196,204,103,169,4,204,39,76,189,96,4,140,227,206,186,97,65,36,117,104,170,139,149,71,47,241,
+250,255,255,208,211,242,127,255,255,255,249,141,255,255,201,211,254,6,189,47,172,181,190,143,122,42,66,207,145,91,140,49,55,161,160,112,180,142,75,246,
+238,4,65,39,52,228,91,8,226,111,64,209,63,75,179,207,24,55,95,24,39,215,20,132,153,5,177,177,7,129,227,64,3,207,113,132,17,106,129,169,
+64,160,30,45,225,105,68,5,53,89,38,255,39,132,109,45,114,51,72,243,247,38,213,97,52,112,43,141,239,135,183,255,248,135,126,50,159,255,255,255,
+226,37,147,254,126,66,227,36,228,125,2,189,103,172,95,145,65,107,0,45,134,11,94,8,5,172,95,128,148,199,143,75,17,201,18,165,83,73,135,202,
+146,138,43,216,136,84,11,192,228,240,206,148,52,16,76,94,4,28,61,128,232,223,8,69,200,143,21,181,6,212,198,1,0,69,6,100,122,146,52,47,
+141,117,35,66,146,36,227,153,3,176,217,85,208,99,111,191,212,35,255,255,89,79,198,175,255,255,255,244,65,255,254,148,159,130,239,206,243,222,7,222,
+74,209,179,174,59,104,228,37,158,133,211,207,200,225,129,96,68,41,104,228,156,44,229,19,148,176,111,113,213,41,21,197,33,180,81,63,82,185,35,148,
+167,41,198,165,81,68,93,55,192,127,42,160,3,77,2,7,94,65,109,38,33,214,36,242,244,55,240,16,43,177,169,86,49,58,149,74,68,78,204,143,
+25,92,153,67,75,254,129,95,255,252,140,63,255,252,45,255,255,252,39,255,255,207,139,252,153,255,76,143,195,255,248,177,122,140,247,158,131,13,110,13,
+247,24,201,131,231,77,14,216,243,8,8,127,2,240,29,33,104,137,40,73,170,133,252,49,72,26,26,160,32,167,98,66,137,227,240,193,42,196,159,232,
+124,10,226,200,83,194,204,44,134,56,9,66,112,87,135,234,170,77,186,105,138,194,20,105,246,15,112,161,46,137,116,144,178,219,164,92,105,191,252,27,
+63,255,225,253,255,255,255,241,207,255,135,191,255,185,87,241,11,248,168,122,28,254,82,94,183,190,137,19,253,171,16,125,74,9,12,109,8,201,176,86,
+5,97,209,71,5,43,14,227,41,41,84,137,6,24,159,152,228,161,71,233,157,195,76,205,64,120,232,77,240,229,206,72,25,129,41,40,133,173,38,128,
+152,146,128,168,179,143,157,87,30,245,28,154,84,29,79,196,198,84,44,58,94,220,0,208,245,142,243,130,255,253,83,191,253,60,191,255,255,255,196,94,
+254,112,223,205,75,205,127,85,202,246,247,196,228,167,222,226,71,178,180,103,98,66,76,198,138,15,213,22,32,131,201,112,200,146,169,3,130,130,74,173,
+135,124,11,72,250,72,228,192,215,226,14,56,36,122,12,96,240,33,164,44,43,192,214,186,70,146,225,68,186,130,1,58,72,133,118,121,141,134,124,205,
+42,29,37,78,189,97,222,183,166,106,103,164,198,225,61,195,63,255,228,109,245,94,255,255,255,255,18,137,31,253,113,35,89,1,145,21,155,131,125,56,
+254,134,200,134,215,147,66,76,58,148,14,58,151,9,209,183,34,171,169,73,213,191,34,126,33,139,2,74,107,134,16,111,182,26,203,130,53,225,6,129,
+228,212,79,99,136,10,4,112,10,170,240,100,110,220,103,105,124,22,226,16,13,224,224,111,226,28,154,228,90,47,239,234,73,146,19,22,70,197,11,22,
+61,250,26,127,255,244,30,230,35,255,255,255,254,34,221,191,255,242,16,243,129,199,91,57,191,4,139,235,213,25,130,14,120,182,171,197,6,188,133,158,
+38,59,131,166,129,199,34,176,145,15,96,232,147,135,178,142,157,9,199,154,138,124,139,58,27,146,104,18,162,73,159,28,201,157,5,9,56,4,241,209,
+6,106,156,13,105,218,0,0,35,141,113,124,131,49,109,144,217,217,137,187,251,150,84,234,79,106,30,32,30,102,255,204,203,255,255,219,123,255,235,231,
+255,255,255,229,187,255,255,224,113,254,104,190,151,93,126,254,117,93,175,250,145,51,204,189,0,42,196,80,123,203,218,53,179,248,54,212,4,39,51,52,
+108,147,234,126,112,32,75,84,43,43,148,137,55,50,179,52,18,89,11,18,235,29,162,51,39,32,7,31,33,180,28,1,240,32,97,38,25,192,250,12,
+242,12,67,146,92,152,87,240,10,146,44,73,37,101,4,122,44,196,40,127,112,164,136,147,218,85,255,145,59,255,192,127,255,26,15,252,201,95,3,126,
+214,203,196,246,54,99,109,202,176,232,184,5,2,234,206,67,64,194,204,151,246,40,16,36,119,65,165,12,65,75,68,156,111,48,62,146,92,130,99,1,
+33,72,236,196,230,53,16,253,132,236,52,224,66,1,72,48,130,140,21,193,3,5,120,91,192,104,23,208,3,130,196,2,48,28,9,68,24,68,241,2,
+137,4,72,118,26,82,255,138,140,102,100,29,31,218,87,63,24,151,251,133,63,255,199,179,203,31,252,43,158,170,61,117,212,34,228,112,187,175,46,196,
+49,177,69,6,165,87,3,103,115,177,254,215,72,65,81,168,4,60,10,196,69,12,1,173,65,82,73,178,11,140,116,120,228,67,13,104,241,67,98,16,
+144,214,128,208,17,64,11,16,112,85,130,136,46,32,144,6,248,70,192,76,5,240,81,5,98,23,97,192,134,28,89,98,135,48,72,81,21,114,56,100,
+183,131,136,221,113,11,127,98,231,224,106,255,255,214,235,150,83,175,99,150,167,11,83,11,102,196,142,182,255,39,242,196,168,9,211,232,1,225,82,69,
+141,82,80,237,197,32,0,144,186,138,188,5,6,41,8,9,16,73,186,31,210,115,141,108,64,99,125,15,248,2,6,94,35,224,146,133,32,43,66,28,
+0,65,65,131,170,78,64,71,136,104,18,98,102,38,41,32,143,78,39,66,255,131,132,213,161,172,96,137,152,154,102,69,100,55,217,69,255,44,21,161,
+159,255,251,193,127,120,16,133,167,209,135,120,73,198,124,34,28,163,202,29,124,112,109,8,52,86,162,142,5,100,238,66,89,9,144,101,136,70,3,1,
+83,145,60,71,99,95,49,56,0,14,210,11,209,252,136,84,90,97,54,38,137,52,135,198,61,224,43,140,192,23,38,54,30,233,231,6,238,67,64,222,
+137,232,153,100,232,74,9,35,144,18,2,114,242,129,205,53,164,216,103,9,47,15,43,168,11,255,70,7,38,239,255,251,91,255,236,36,224,111,62,224,
+55,160,44,74,59,37,142,56,14,213,58,20,8,4,138,190,11,121,35,5,184,3,96,85,141,32,223,227,188,53,40,74,72,202,35,179,135,133,129,49,
+98,10,51,232,10,199,54,25,130,131,151,104,174,229,228,14,88,245,128,202,87,161,182,159,112,142,101,12,16,72,95,134,46,43,195,234,143,113,1,160,
+163,34,8,241,202,78,4,68,151,137,48,134,189,104,159,251,215,191,212,23,255,236,105,255,209,17,241,158,226,242,109,157,70,146,111,214,12,111,212,220,
+16,97,11,2,181,116,97,191,84,184,36,49,156,9,68,126,72,79,46,162,110,67,104,103,80,185,155,236,38,201,235,26,194,1,194,80,61,112,136,15,
+44,159,197,35,51,0,144,71,152,10,65,208,5,108,197,131,171,37,48,102,64,10,9,240,90,146,108,39,198,129,15,168,153,78,66,2,242,194,142,212,
+59,33,122,248,25,63,242,73,127,252,215,255,204,19,255,37,231,224,205,228,12,154,6,222,106,74,113,136,66,71,21,240,104,85,76,54,247,177,38,37,
+189,198,33,44,160,208,198,184,123,242,223,43,124,102,71,177,10,153,128,192,170,135,241,104,32,76,49,131,123,0,88,105,69,156,51,178,181,6,196,102,
+66,10,9,240,104,134,80,23,145,143,2,108,51,161,204,35,104,38,196,250,63,113,217,131,93,52,99,236,87,136,134,13,38,151,143,208,189,254,86,143,
+255,247,172,208,91,249,210,62,132,222,134,233,255,106,198,149,143,23,4,154,51,228,20,237,106,194,1,105,34,36,92,180,124,83,77,13,20,52,197,119,
+27,178,112,69,204,124,80,236,145,220,88,37,185,5,97,171,65,220,41,176,182,131,112,4,32,55,26,0,15,68,100,54,32,120,146,160,9,161,110,7,
+208,38,133,194,55,195,177,139,160,208,32,255,53,120,107,153,182,104,134,87,137,216,207,57,42,63,239,112,144,87,255,254,9,223,239,140,224,143,219,37,
+145,118,222,226,20,164,112,61,178,9,45,110,51,129,201,164,184,56,170,186,69,106,190,14,118,46,129,240,128,176,235,161,164,62,248,161,69,242,93,177,
+23,140,140,94,98,219,13,97,97,202,24,54,49,190,2,92,158,2,251,64,64,221,202,68,3,176,241,6,164,101,4,171,4,128,98,75,206,8,131,31,
+139,44,168,224,2,95,58,23,157,223,89,55,250,52,184,193,191,255,245,32,254,252,7,11,204,143,74,144,49,128,194,121,133,76,4,213,8,73,144,28,
+75,39,130,138,81,128,46,152,32,248,232,54,71,136,151,139,166,5,244,58,136,145,58,224,5,40,88,203,69,246,10,81,220,130,48,14,2,101,37,176,
+113,199,32,10,194,22,8,180,244,68,179,45,208,155,195,228,59,145,171,32,4,78,133,167,31,72,136,201,206,78,145,38,138,37,27,175,238,249,217,191,
+220,45,255,252,204,182,169,241,144,100,139,226,114,214,179,154,33,99,44,148,7,204,12,134,187,111,96,106,3,204,101,96,83,2,136,38,192,222,47,121,
+26,146,30,15,227,37,133,181,0,226,0,81,232,129,140,10,11,81,141,134,88,130,99,192,7,216,53,135,40,0,33,96,8,64,73,192,241,46,145,81,
+202,100,66,16,152,20,36,86,202,99,33,50,90,66,170,74,177,103,155,4,55,132,119,244,165,127,239,52,255,242,200,255,177,143,254,96,15,161,63,127,
+213,132,186,82,47,219,195,180,168,247,80,10,94,7,68,100,191,32,122,36,232,8,160,114,134,230,41,34,2,142,156,11,135,231,6,121,97,69,130,100,
+176,163,36,76,107,197,235,10,96,166,198,140,63,83,42,9,164,118,65,238,13,80,79,6,176,6,112,74,11,80,160,227,132,40,88,22,74,178,20,101,
+176,149,113,139,33,158,53,120,5,205,227,194,141,255,66,183,112,63,255,218,39,254,108,15,175,31,199,45,85,108,0,133,107,157,202,7,58,52,12,134,
+189,96,144,180,1,11,110,122,56,153,109,5,118,29,131,48,140,232,252,97,91,26,153,115,197,86,60,18,16,142,4,0,70,117,29,161,41,68,228,21,
+209,241,12,28,240,195,95,44,240,9,5,104,7,114,2,13,148,68,64,235,32,72,65,138,90,37,210,57,132,53,77,165,150,110,233,51,18,123,69,231,
+252,59,92,8,31,255,252,151,127,150,208,182,228,126,74,27,191,140,148,37,181,35,36,240,120,239,52,8,201,177,131,40,120,3,10,169,152,250,36,74,
+37,136,46,143,54,42,100,228,128,208,186,227,117,32,120,105,201,226,6,240,178,139,60,91,130,71,20,176,27,6,132,17,115,78,12,156,189,1,47,20,
+144,96,198,56,84,209,97,17,172,91,161,105,41,88,241,70,70,56,211,232,148,121,183,241,207,126,169,175,217,85,255,255,12,46,81,139,189,57,142,249,
+222,40,133,131,8,100,177,98,40,158,36,96,13,147,48,207,131,160,6,129,31,130,132,45,242,59,24,132,24,4,97,13,121,178,65,56,143,112,10,24,
+84,62,164,19,2,9,16,195,4,28,16,41,7,112,2,194,104,13,144,149,1,108,71,1,26,147,64,72,33,190,17,136,71,11,214,35,227,135,134,180,
+110,229,11,32,216,122,202,238,68,178,255,120,191,191,246,200,127,248,251,127,174,63,246,36,117,122,244,40,112,145,239,76,144,14,49,2,160,199,244,177,
+248,234,137,30,135,192,40,25,176,140,102,96,33,56,7,195,2,50,177,233,137,124,151,100,109,18,169,110,67,178,60,16,248,137,84,4,161,193,11,80,
+11,195,24,29,128,150,11,80,42,66,78,7,192,161,131,150,55,97,236,133,88,111,96,157,49,56,98,146,154,3,226,214,143,244,127,32,41,54,15,53,
+7,254,200,111,232,219,255,245,146,255,225,238,151,255,203,223,228,137,123,126,111,90,244,244,68,118,154,22,2,221,169,29,134,238,8,142,223,67,238,184,
+13,166,180,77,138,11,138,54,37,46,98,13,109,122,69,168,230,62,104,38,6,101,78,8,65,118,51,128,110,89,129,168,91,1,116,125,129,182,113,193,
+170,55,197,90,88,140,238,70,140,26,28,173,238,56,19,211,60,232,121,133,90,139,245,146,255,255,161,23,10,207,255,255,255,241,14,145,255,245,106,250,
+52,249,5,37,105,202,215,17,81,2,70,111,201,212,84,77,48,204,66,246,246,65,42,42,192,238,50,11,186,60,75,134,71,41,206,56,174,198,11,107,
+254,59,39,174,0,40,210,72,4,138,54,192,154,117,130,222,165,128,150,109,64,4,139,134,174,153,71,10,45,72,58,73,17,49,60,40,152,128,132,8,
+203,162,202,176,248,176,238,48,31,255,211,115,255,211,219,255,255,255,252,76,1,127,11,143,160,87,197,63,142,180,96,120,17,100,119,197,97,81,101,48,
+32,84,140,81,249,222,9,137,174,0,105,188,43,41,77,32,25,129,153,105,57,180,120,219,163,250,74,145,169,70,157,56,38,134,8,242,145,48,29,6,
+1,26,22,192,64,166,160,9,14,128,92,19,145,253,158,210,93,130,122,15,131,116,123,207,234,82,160,160,245,102,197,108,252,228,63,216,163,255,255,146,
+55,255,255,255,94,159,225,227,255,75,15,248,139,255,176,199,180,175,58,41,170,241,110,194,143,134,51,87,209,208,157,107,93,7,250,74,43,106,90,37,
+186,123,71,133,27,32,30,26,109,114,13,209,205,29,71,11,15,84,29,23,37,183,65,130,181,30,128,112,59,65,195,92,0,49,33,225,222,32,193,255,
+49,97,237,34,80,26,51,180,97,22,19,221,114,177,62,128,233,25,155,56,34,125,236,63,255,255,176,71,255,252,185,255,255,255,222,103,255,254,168,159,
+218,183,232,221,232,251,238,69,111,251,76,9,78,16,80,95,198,192,189,224,116,28,49,98,119,24,141,47,9,42,43,89,116,73,180,219,33,194,25,46,
+74,32,145,227,54,231,73,19,196,43,60,133,243,109,131,161,73,96,219,96,3,207,129,49,158,161,192,199,158,211,18,171,211,103,131,146,71,130,124,92,
+204,194,46,227,218,106,36,146,213,62,234,159,255,252,128,60,87,127,255,255,255,136,79,255,253,25,63,208,31,99,102,136,80,67,87,178,177,187,18,196,
+56,153,152,4,34,0,59,195,140,78,69,184,138,102,232,128,227,238,115,226,19,2,208,142,111,82,123,77,208,65,115,210,242,80,209,92,32,19,208,65,
+87,30,43,148,214,7,213,202,66,152,8,37,170,18,27,57,214,66,101,141,36,42,58,15,58,54,85,3,119,139,32,158,180,16,242,148,255,253,253,63,
+252,135,191,255,255,255,196,142,207,240,16,168,2,36,225,97,160,207,101,233,72,209,136,108,41,216,163,246,188,18,181,126,29,133,34,65,117,34,51,17,
+113,30,49,209,98,208,255,79,244,227,39,211,209,72,241,69,35,83,69,23,65,139,3,1,100,34,192,235,85,192,131,46,193,72,51,130,217,87,196,85,
+27,35,25,16,200,51,163,180,164,195,241,231,197,154,170,177,210,194,110,217,31,253,192,191,255,237,53,255,255,255,254,33,155,185,115,255,238,157,255,62,
+95,196,91,81,94,150,219,70,247,176,161,77,247,136,78,217,79,175,125,37,81,113,194,137,93,135,235,97,167,109,3,5,135,4,120,126,138,131,219,142,
+138,63,133,186,252,146,241,239,133,96,6,143,64,175,166,128,25,146,49,86,14,176,16,156,64,90,133,200,191,22,9,34,136,73,164,175,200,121,65,196,
+117,209,100,93,99,155,51,15,191,247,255,255,215,227,255,255,75,191,255,254,8,255,255,98,175,249,230,255,180,7,200,63,162,67,216,231,109,75,30,0,
+78,167,69,224,157,155,51,111,213,121,135,213,129,35,211,50,59,40,189,1,80,245,113,176,120,139,120,30,42,153,32,157,248,124,29,248,86,10,0,79,
+142,193,37,16,80,3,46,96,239,158,96,72,154,162,178,173,227,156,141,179,54,147,69,20,85,2,103,160,221,9,148,224,180,223,130,199,255,254,208,150,
+152,255,255,255,255,18,39,159,255,245,220,245,109,65,160,79,201,49,86,221,121,236,161,20,80,119,18,18,247,38,5,72,131,56,220,46,21,172,153,154,
+45,3,37,226,73,207,162,37,48,75,29,232,141,133,18,28,129,153,251,155,17,90,141,96,253,11,48,122,27,209,20,3,234,119,11,104,218,11,233,103,
+59,122,37,60,104,21,65,20,242,173,14,181,18,197,29,137,76,242,202,255,253,2,191,238,137,255,255,255,254,35,67,63,250,81,115,33,1,62,4,16,
+247,95,232,132,58,48,50,69,193,234,131,102,41,131,212,106,194,34,221,78,142,137,10,10,12,144,85,52,105,97,132,163,160,130,108,58,77,17,241,197,
+48,210,73,193,16,85,88,102,202,8,110,13,184,30,207,88,119,4,132,186,131,100,40,75,140,148,33,222,74,206,158,17,178,89,97,75,236,178,228,168,
+107,57,255,243,120,255,255,59,175,255,255,255,241,35,253,214,227,161,68,224,246,34,216,247,158,18,87,193,128,182,42,8,61,240,70,98,32,174,59,195,
+16,11,2,219,67,102,165,3,68,231,11,56,166,145,196,83,66,117,159,68,210,20,104,104,182,228,120,87,234,44,137,44,184,22,166,148,11,74,88,67,
+166,156,31,194,214,4,160,126,86,105,6,52,145,49,1,86,137,1,218,58,195,243,0,154,166,127,249,127,127,255,229,229,255,255,255,254,35,184,108,179,
+255,42,239,216,143,192,123,8,94,223,89,205,236,16,34,50,76,23,59,40,19,43,10,29,208,216,6,137,67,8,250,48,138,66,211,149,186,137,135,204,
+79,68,209,205,67,85,107,75,193,221,82,176,225,77,136,167,220,112,254,217,144,22,79,208,111,88,48,226,72,112,32,196,204,232,192,113,4,215,212,45,
+160,38,74,107,122,61,150,51,196,59,253,96,191,255,252,34,63,255,255,253,105,255,63,223,252,98,191,235,95,253,116,185,28,240,58,189,255,89,42,117,
+225,8,0,243,136,70,58,122,20,57,234,5,145,17,33,216,135,18,234,170,138,234,72,162,90,152,133,140,12,193,225,59,64,165,52,210,57,109,83,104,
+111,210,112,182,96,92,113,171,108,24,232,228,133,171,224,150,97,76,81,33,30,219,32,36,147,45,146,15,43,138,118,170,174,199,31,154,183,255,255,241,
+196,255,255,251,2,255,255,202,167,255,224,45,254,58,63,229,5,245,99,241,236,150,46,182,85,163,225,196,233,180,116,15,249,232,51,44,139,139,228,125,
+10,76,137,154,28,40,77,13,90,205,220,217,210,117,64,192,21,154,192,224,179,68,136,253,215,40,243,83,72,45,86,168,220,224,140,106,233,60,64,233,
+88,211,42,4,181,33,46,157,97,9,20,208,43,68,246,179,26,82,169,65,127,206,123,255,255,251,163,127,255,231,27,255,255,254,54,63,255,249,163,127,
+170,207,212,187,211,95,230,73,159,174,112,73,227,162,148,191,115,60,60,184,201,25,12,194,30,133,180,15,60,46,22,156,120,158,204,128,79,93,39,211,
+84,137,207,205,24,195,25,10,193,144,69,202,176,204,217,232,141,82,144,34,217,25,19,93,240,225,205,88,243,81,250,18,167,36,202,163,14,219,226,237,
+36,16,203,44,54,55,2,31,173,167,255,255,195,131,255,222,215,255,255,253,237,255,255,242,40,255,225,163,246,62,195,47,152,6,144,124,199,153,142,173,
+6,67,142,3,255,214,32,146,92,145,69,97,104,249,230,152,151,160,110,241,225,236,241,101,210,128,38,154,162,98,70,80,38,158,47,3,166,29,64,48,
+126,68,194,202,18,196,45,10,4,37,133,20,77,116,143,228,118,22,44,237,163,102,56,76,186,76,111,30,56,145,65,30,48,136,241,34,255,255,248,97,
+127,94,191,255,255,254,249,127,255,186,119,251,248,255,72,174,139,249,116,48,94,205,148,151,207,8,126,230,156,110,55,24,110,56,187,22,106,132,54,43,
+10,64,60,42,22,28,62,224,114,4,13,74,100,38,234,63,104,102,8,161,86,69,164,172,2,35,92,19,9,212,67,235,136,23,230,252,73,171,28,199,
+40,0,154,161,108,240,230,193,41,16,118,96,210,77,128,73,133,66,55,205,203,255,255,246,6,254,202,63,255,255,255,226,4,199,255,255,97,79,214,159,
+222,131,197,127,197,162,23,244,250,68,29,75,34,255,124,225,37,146,50,207,214,25,241,90,177,32,208,2,42,169,209,14,144,161,103,48,103,136,104,79,
+45,185,60,150,216,10,28,24,116,8,208,156,150,208,185,16,112,39,46,1,87,166,144,143,151,146,94,173,20,0,74,49,142,68,66,88,169,181,60,16,
+124,104,209,22,147,159,167,167,255,255,81,77,188,255,255,255,255,196,42,191,255,255,66,143,238,31,159,66,115,236,93,91,60,28,9,250,55,70,119,142,
+162,193,201,208,44,225,164,241,242,172,122,51,144,99,179,142,153,233,205,67,36,73,93,140,78,162,146,42,72,218,30,101,170,86,5,186,60,4,156,4,
+68,104,89,68,16,17,171,96,94,229,236,59,229,16,239,42,189,18,49,38,125,82,180,176,107,89,80,20,99,31,231,149,199,255,248,165,126,177,159,255,
+255,255,226,47,143,255,231,37,245,165,220,234,3,7,14,110,22,194,18,246,254,106,200,53,21,109,76,137,85,118,6,37,199,33,70,220,14,50,33,207,
+142,99,211,169,33,39,235,13,151,209,45,136,39,143,1,124,136,113,114,166,32,237,146,225,99,12,96,120,26,80,236,14,26,74,23,168,89,24,233,41,
+71,77,28,162,178,7,17,161,86,204,39,225,33,67,220,7,191,255,177,215,255,173,135,255,255,255,248,153,91,255,23,42,12,1,242,199,65,47,91,131,
+33,84,72,149,49,33,19,55,131,152,17,124,5,2,36,148,12,117,69,161,190,97,205,34,15,112,221,43,105,102,135,3,89,129,227,211,161,163,63,147,
+144,228,153,193,124,176,16,108,148,17,35,22,32,83,150,224,177,23,185,68,22,56,180,165,249,42,77,76,198,161,170,10,19,175,138,6,73,121,217,127,
+253,117,63,255,129,151,255,255,255,248,149,69,252,20,62,126,159,83,30,123,78,103,161,85,105,116,202,3,150,172,65,136,227,3,154,188,41,224,195,151,
+144,16,2,106,93,150,52,12,193,37,130,196,70,37,228,145,14,144,70,86,241,236,111,85,44,69,19,36,19,53,66,49,182,90,3,178,130,11,67,174,
+38,145,176,7,227,181,5,18,99,48,246,101,38,201,195,140,99,228,143,69,119,116,110,255,157,103,255,254,239,223,255,255,255,194,191,34,191,210,107,249,
+128,255,32,142,103,122,123,67,175,129,244,234,112,232,16,200,5,3,124,171,8,20,219,137,224,47,70,116,4,200,85,118,65,153,177,202,181,96,67,78,
+18,227,188,204,224,184,137,167,156,186,171,72,75,103,232,45,109,168,106,107,188,10,229,44,56,104,92,132,32,124,29,103,58,113,227,158,125,47,106,79,
+18,61,3,166,223,106,175,238,137,255,255,252,7,63,255,255,245,85,255,247,211,255,235,37,251,24,255,4,111,162,63,172,148,250,242,132,141,222,239,208,
+71,168,112,50,68,57,14,99,80,100,163,4,24,224,20,164,97,158,101,236,58,58,233,202,125,105,198,1,238,74,47,199,138,35,134,234,175,200,214,179,
+65,238,154,4,186,246,71,82,154,194,162,92,73,146,134,11,38,35,101,198,79,109,130,36,231,191,5,50,84,119,240,56,254,197,95,255,255,202,163,255,
+255,250,242,255,255,230,155,255,255,6,15,248,17,253,104,60,219,254,104,89,252,230,216,129,185,146,59,173,114,136,233,45,131,17,94,0,216,171,206,121,
+67,194,237,118,69,10,82,98,92,247,162,3,1,50,86,116,144,132,36,209,24,38,114,212,24,96,107,68,160,230,50,193,15,106,36,155,74,35,83,49,
+231,245,73,199,245,19,85,197,8,120,112,146,168,60,200,5,100,191,196,67,255,255,243,210,255,255,255,217,7,255,216,151,255,247,208,255,180,63,211,67,
+135,143,170,230,204,123,43,10,93,61,142,206,190,130,224,81,74,32,68,1,80,70,233,37,0,81,192,100,144,62,146,185,74,69,68,62,218,20,69,29,
+156,88,135,252,44,65,36,135,132,168,30,215,120,82,208,240,39,216,9,92,217,193,23,200,97,135,207,138,31,33,14,133,168,14,200,164,142,47,115,119,
+163,151,249,163,127,255,252,144,63,255,255,254,6,127,207,39,255,153,87,253,0,255,16,76,145,121,66,100,115,193,96,111,224,140,84,18,210,17,34,130,
+125,194,77,50,162,33,61,104,153,162,100,0,65,86,25,100,85,38,240,27,88,49,43,91,177,100,37,17,161,35,0,1,27,224,13,101,67,79,102,97,
+49,79,132,185,116,102,3,35,228,61,23,136,48,130,114,14,183,8,253,165,169,7,202,22,241,159,235,105,255,255,234,57,255,255,255,250,189,244,251,254,
+80,31,209,199,243,106,199,39,17,200,84,235,176,100,174,28,254,138,124,96,70,73,0,69,53,105,3,127,43,200,28,168,212,121,192,209,207,192,50,55,
+33,28,178,101,182,97,32,74,72,226,242,114,68,254,114,128,22,177,71,31,1,66,167,72,34,229,96,6,145,49,3,77,26,21,119,8,52,177,124,145,
+214,138,88,27,196,142,198,31,245,116,255,255,241,186,255,255,255,255,16,90,247,227,241,110,244,53,250,168,104,31,86,33,4,183,33,45,192,210,57,0,
+208,215,5,116,211,74,131,9,101,151,40,70,85,56,169,24,136,51,100,144,251,188,129,122,241,152,216,152,147,24,149,135,169,138,25,202,162,6,10,62,
+14,139,188,26,234,86,9,9,110,35,137,85,25,169,233,139,58,0,158,187,174,154,101,112,81,26,61,115,214,255,232,245,255,255,193,155,255,255,255,252,
+70,181,232,181,158,5,68,123,50,102,71,104,166,26,112,161,136,136,84,34,5,6,61,194,36,172,134,191,0,134,165,47,69,31,19,200,94,135,35,123,
+152,74,186,143,58,184,148,168,151,155,8,13,7,184,237,14,234,140,9,73,253,2,242,89,14,26,28,2,24,8,5,152,1,148,106,52,137,68,24,66,
+197,224,72,130,216,176,80,169,173,22,63,255,25,79,255,240,238,255,255,255,255,18,241,95,118,138,120,5,117,37,167,211,128,243,31,16,3,95,63,179,
+80,2,60,204,2,205,77,6,101,145,25,156,208,147,108,12,220,132,0,155,244,184,212,28,175,211,132,137,200,204,156,192,52,51,195,144,18,11,72,18,
+12,200,114,135,120,96,7,248,40,132,244,140,143,140,9,83,36,79,37,22,92,209,121,11,138,22,193,211,1,28,73,191,255,210,179,255,182,7,255,255,
+255,248,157,23,255,195,144,244,148,120,64,193,30,201,200,100,24,19,40,82,165,206,25,137,109,16,10,229,5,202,88,45,201,170,40,40,83,180,24,45,
+185,25,58,172,57,30,170,56,199,153,104,104,142,24,77,0,232,226,3,241,124,10,49,116,3,50,20,9,153,81,14,217,106,49,105,101,50,8,49,70,
+85,2,167,186,29,144,163,66,171,83,238,213,255,255,134,23,238,113,255,255,255,254,38,122,63,255,11,10,165,176,51,136,205,210,4,70,172,62,85,156,
+24,230,198,47,136,237,23,123,125,6,89,223,43,73,238,46,88,69,180,8,8,64,68,104,216,180,79,90,244,0,208,252,20,13,196,185,38,7,180,93,
+192,175,41,32,86,73,112,4,50,110,12,172,161,131,23,18,177,119,72,16,131,112,52,29,4,55,76,7,16,97,188,66,194,133,90,169,191,230,236,139,
+3,255,255,1,239,247,194,100,237,83,33,222,99,84,4,153,111,135,24,223,192,239,165,240,97,136,172,27,106,50,132,38,54,98,137,146,88,235,32,64,
+52,232,30,147,10,0,19,132,131,28,248,225,238,47,8,74,136,10,71,34,4,146,8,34,101,132,22,57,173,130,130,71,33,119,152,120,150,226,88,33,
+152,163,17,106,20,2,253,135,157,34,33,202,56,249,44,193,131,74,167,253,141,202,117,255,255,62,239,249,246,58,225,229,174,54,188,192,8,221,93,160,
+214,25,244,63,54,163,4,136,255,131,27,82,241,28,72,60,74,50,93,36,124,63,135,23,1,194,138,67,136,135,144,64,158,156,94,7,163,18,240,248,
+72,156,79,243,19,6,220,156,130,79,60,160,163,72,176,23,82,124,20,252,97,3,43,1,41,186,194,192,97,242,52,146,116,36,39,7,40,232,237,166,
+98,255,203,165,141,215,255,248,113,255,200,81,234,67,204,36,157,121,67,155,15,25,144,1,152,40,62,184,25,4,190,139,65,24,170,104,217,230,12,37,
+152,247,19,82,60,68,44,128,181,46,226,96,79,248,12,141,202,35,196,22,142,128,128,99,62,32,169,173,5,38,72,0,85,153,224,93,164,206,3,72,
+172,135,238,51,193,161,136,164,122,224,89,50,217,56,194,142,91,18,110,146,44,131,82,198,127,241,242,119,101,255,254,12,191,236,170,246,191,242,165,68,
+199,33,195,110,233,10,46,155,76,133,59,9,161,122,86,108,30,244,183,30,181,8,5,229,23,98,43,72,188,158,112,16,32,244,43,74,127,9,225,167,
+65,136,113,178,10,18,68,80,2,63,45,144,183,201,124,9,226,46,7,140,162,0,73,6,16,93,196,48,57,81,99,132,164,113,37,65,36,72,1,211,
+222,7,114,204,138,10,166,143,255,14,55,225,121,255,248,48,255,159,227,207,75,218,41,109,124,216,139,83,169,153,101,240,90,7,173,248,71,85,112,240,
+200,208,56,107,20,157,30,236,95,199,65,27,66,175,66,64,123,208,34,166,148,59,71,21,1,137,81,70,184,79,177,81,3,28,121,130,27,41,0,59,
+132,240,4,2,42,2,100,0,96,234,2,232,192,69,46,1,195,113,137,244,157,224,101,97,25,32,18,122,33,12,170,223,254,160,239,246,66,255,245,20,
+255,67,71,128,55,172,155,49,45,165,138,3,160,41,173,178,128,12,245,186,198,61,125,177,86,79,192,78,84,40,35,180,127,198,123,12,98,135,67,212,
+130,16,194,159,52,42,135,153,1,232,231,195,44,70,241,136,0,252,60,192,51,37,128,44,131,24,40,33,49,1,76,1,194,68,25,216,67,197,118,0,
+68,123,132,64,225,160,199,95,217,237,156,146,80,142,38,15,255,77,119,255,77,191,253,8,127,210,185,217,171,198,97,158,159,33,242,254,100,194,93,60,
+240,6,23,105,176,240,221,196,111,212,115,14,188,197,8,137,39,193,175,192,38,131,240,197,35,12,58,101,247,3,25,210,64,88,45,208,48,138,236,92,
+0,99,6,144,130,134,68,12,192,198,15,224,4,33,32,0,208,150,138,110,27,66,14,129,141,40,35,180,83,88,16,21,138,127,136,136,86,33,217,225,
+255,222,145,255,246,172,254,207,63,227,0,239,15,215,13,135,39,59,196,10,113,197,30,206,106,4,59,185,160,58,172,60,54,122,139,7,126,64,35,71,
+147,8,239,224,187,49,56,12,209,94,23,242,121,138,28,184,96,42,23,24,106,192,226,25,96,45,130,208,118,64,220,15,160,108,8,152,33,177,187,3,
+92,63,69,203,32,113,171,64,48,136,146,52,54,76,96,10,121,48,212,86,48,185,120,190,191,248,50,63,255,149,207,183,15,240,105,120,122,116,88,81,
+183,144,234,46,249,31,7,199,21,177,192,220,8,5,164,51,13,196,241,65,91,2,16,171,193,32,63,242,113,136,108,152,36,59,50,8,17,77,218,16,
+210,89,138,72,196,35,230,20,57,66,8,86,124,161,20,151,8,97,168,58,34,249,29,135,54,77,131,212,136,160,159,96,145,70,248,15,10,54,97,17,
+247,135,116,76,243,59,127,246,120,119,244,255,254,170,95,235,68,243,150,245,154,86,55,54,211,88,235,190,81,28,9,195,117,135,240,236,172,174,21,202,
+84,15,66,122,98,190,135,64,248,162,104,62,40,159,76,62,19,147,126,139,164,81,34,139,23,56,63,67,48,37,241,67,1,192,139,194,87,52,80,60,
+201,164,58,147,181,21,172,117,198,43,43,114,181,69,236,137,81,64,55,36,143,9,77,0,106,107,232,240,255,134,147,33,183,255,254,98,159,229,90,183,
+37,129,138,201,138,56,45,8,22,9,28,22,1,33,77,32,12,89,168,81,180,35,12,36,211,8,145,41,161,191,66,36,154,113,46,36,132,39,167,167,
+8,65,248,64,66,55,144,123,14,244,73,64,164,7,128,66,134,40,43,224,55,145,40,9,194,118,27,25,65,11,34,24,35,131,145,73,133,226,176,80,
+25,2,160,95,65,227,9,87,85,249,156,191,206,165,255,255,119,206,82,193,26,32,38,145,4,83,159,56,150,139,178,13,161,81,147,24,55,66,54,7,
+200,242,131,147,30,144,183,69,244,134,49,41,28,180,13,233,161,13,210,56,65,58,116,113,50,29,60,61,67,49,26,208,237,73,64,1,97,133,0,116,
+150,192,226,5,112,122,129,228,4,145,151,137,216,182,160,213,57,56,201,25,214,42,133,53,152,34,43,56,51,189,104,31,251,144,191,255,213,31,154,63,
+222,157,193,115,129,98,109,220,14,11,139,120,32,139,97,28,24,10,81,133,244,114,160,164,143,184,53,129,41,13,104,96,194,170,103,240,203,149,180,82,
+103,177,0,193,164,193,146,86,209,95,20,236,90,130,25,37,96,193,75,112,5,146,46,6,36,179,129,81,12,240,82,67,232,60,49,23,132,228,127,228,
+135,42,216,49,21,158,8,99,240,154,202,205,143,255,41,119,249,145,127,244,146,255,12,183,188,87,176,10,157,186,190,162,67,175,56,243,111,196,40,28,
+61,4,195,80,160,142,210,68,90,178,75,14,116,41,198,171,0,169,81,198,254,89,177,81,146,252,136,226,71,22,184,104,68,146,28,224,240,137,200,3,
+228,96,11,57,74,128,106,66,97,47,148,152,100,33,180,33,200,169,14,66,14,18,145,131,189,35,97,139,23,185,77,202,75,57,7,254,217,38,232,255,
+255,208,43,253,247,154,108,110,62,148,158,46,160,82,51,200,145,111,4,14,66,94,2,190,182,32,156,149,200,79,37,138,40,120,76,9,158,0,99,145,
+134,116,186,162,193,48,40,135,72,142,36,241,39,131,228,24,224,59,14,32,0,133,152,14,1,250,3,20,150,64,205,27,80,224,201,12,82,208,192,27,
+156,112,74,115,7,130,59,198,204,230,18,45,32,109,150,31,162,123,250,116,63,255,239,239,231,212,9,28,68,181,54,19,157,112,4,107,130,112,44,7,
+246,17,82,157,2,180,68,192,246,16,96,47,160,36,10,40,87,72,178,46,241,251,143,236,165,227,117,34,8,190,71,122,21,209,37,129,32,46,33,226,
+0,152,216,128,226,69,32,26,17,64,64,36,242,20,56,194,11,106,72,3,204,134,41,53,229,2,107,56,194,24,214,145,136,251,216,193,227,136,255,239,
+130,255,254,107,191,110,95,210,37,192,219,178,91,12,221,245,202,7,149,25,81,177,237,10,229,160,196,147,102,192,198,77,84,75,211,20,23,140,43,198,
+131,8,65,243,66,246,112,208,102,157,52,37,229,67,3,193,44,66,140,35,177,147,8,84,125,192,13,37,208,91,73,244,7,82,0,14,36,137,147,7,
+62,26,99,155,141,169,6,160,36,84,121,74,154,166,46,70,90,182,242,69,15,255,1,55,241,26,255,245,38,255,115,151,180,63,94,20,103,118,160,60,
+78,33,128,223,192,236,77,246,104,1,249,53,131,181,61,176,122,70,224,88,49,71,20,116,39,166,253,5,89,158,69,238,98,208,116,148,116,55,99,49,
+8,208,145,65,184,3,225,147,0,44,81,130,6,26,32,13,68,88,18,128,113,10,84,5,193,125,21,25,94,194,98,67,178,108,155,84,26,134,95,32,
+202,224,63,244,180,78,189,255,255,130,159,242,93,90,75,65,176,215,66,124,116,100,128,22,120,83,8,228,50,17,47,131,208,102,128,247,5,64,39,98,
+60,23,72,145,200,142,17,19,10,142,204,168,33,173,50,248,138,199,70,2,226,42,133,0,31,162,218,16,169,25,1,4,65,224,204,150,8,22,99,22,
+28,89,36,8,202,11,3,84,140,177,28,96,171,71,152,249,153,94,20,227,236,189,179,239,12,255,38,199,255,253,169,56,202,174,18,202,103,103,34,251,
+105,132,108,204,87,2,101,131,176,196,174,30,10,154,168,11,178,146,162,21,146,128,254,164,112,60,168,28,18,206,30,36,137,130,109,13,162,64,63,200,
+89,11,30,74,162,206,146,128,85,38,214,32,201,185,3,194,114,2,140,156,168,129,37,70,66,121,139,144,130,50,70,39,154,81,161,35,128,123,218,228,
+162,143,71,167,27,23,255,173,43,255,225,245,253,249,127,98,151,77,79,64,86,7,186,195,154,43,86,226,173,225,32,29,204,41,6,129,94,96,203,83,
+208,122,19,71,23,28,118,137,195,21,18,3,192,48,161,144,185,32,68,2,167,241,24,145,127,196,80,70,114,219,14,132,150,129,199,57,240,199,75,72,
+26,211,44,20,204,148,4,29,29,242,67,198,212,123,16,214,51,60,155,203,13,24,51,252,92,185,29,87,255,103,7,217,99,255,243,95,255,156,59,192,
+51,133,242,78,218,227,140,210,195,161,7,192,56,1,244,40,4,169,66,1,49,33,48,37,72,28,72,208,9,141,180,27,166,235,19,233,45,197,234,106,
+176,246,142,20,67,99,221,5,64,50,192,56,6,145,161,4,208,48,65,150,30,48,57,1,96,18,224,220,7,20,57,224,197,13,73,66,71,242,34,146,
+15,156,116,92,225,151,35,121,65,191,229,130,240,103,127,255,225,165,248,205,41,175,98,115,14,7,102,115,161,229,53,104,17,104,184,31,146,115,130,30,
+104,64,145,18,176,130,162,204,24,56,3,206,38,0,50,251,137,212,247,96,81,50,40,105,203,142,30,98,63,132,232,83,36,204,20,185,4,129,38,100,
+161,76,148,104,36,101,74,41,57,19,136,98,45,132,156,141,241,2,161,26,101,105,85,22,162,37,166,246,195,121,244,183,127,205,81,255,255,91,184,127,
+186,44,180,143,220,225,45,109,254,12,113,136,112,214,50,117,23,45,161,67,77,109,225,138,80,28,77,115,145,35,172,115,71,111,17,242,177,66,192,135,
+48,68,40,100,71,71,41,14,161,204,74,44,75,242,55,16,116,251,3,107,49,112,185,209,16,74,210,251,17,188,225,136,133,37,129,244,74,20,213,178,
+109,45,180,169,209,4,168,113,223,42,62,196,93,255,237,32,255,223,115,254,86,159,199,245,230,239,232,168,165,6,171,232,74,233,252,49,187,248,139,163,
+11,176,224,84,8,67,21,90,22,188,146,69,243,37,50,42,65,52,120,176,126,39,68,12,167,1,3,146,9,194,240,71,177,30,19,244,148,1,213,33,
+176,156,77,88,16,242,59,8,180,203,131,39,21,193,11,72,132,115,16,68,27,132,83,203,129,6,114,44,72,120,252,147,172,72,13,255,217,121,217,63,
+255,253,17,255,225,184,224,61,192,189,40,44,89,65,46,94,32,143,87,132,77,131,171,2,177,0,66,152,21,64,60,70,68,24,49,0,141,252,33,100,
+169,36,137,50,196,234,89,209,232,142,108,26,35,217,6,56,48,196,4,22,49,46,5,192,122,64,161,29,160,75,6,104,40,81,104,6,140,25,198,75,
+11,97,97,66,54,161,81,68,35,228,14,77,109,93,20,30,159,253,33,158,95,159,255,207,127,254,112,14,203,60,31,18,249,214,48,88,86,223,17,54,
+17,64,20,167,224,49,107,186,13,169,98,135,6,98,226,189,132,48,204,97,200,66,216,89,207,10,5,4,79,130,228,192,33,194,51,216,142,134,46,71,
+193,252,149,80,34,102,40,26,57,169,3,94,89,98,181,151,200,159,35,116,75,153,64,146,242,35,134,216,156,105,192,164,250,134,38,34,108,26,95,254,
+117,175,253,238,255,239,133,254,151,111,41,62,183,235,130,241,234,54,166,60,68,105,203,180,80,118,190,17,213,211,5,41,63,113,104,80,4,128,177,117,
+32,4,101,10,75,2,34,46,66,220,160,16,109,27,212,89,7,139,30,0,254,74,180,77,115,86,8,20,219,68,33,62,96,179,76,48,99,115,119,24,
+236,125,10,33,47,146,177,69,84,222,179,239,60,52,162,144,28,198,201,222,225,255,199,125,255,254,19,253,82,190,244,14,97,60,159,20,144,226,46,109,
+92,102,135,135,149,120,172,237,20,29,91,119,10,194,118,226,125,156,113,1,162,110,58,120,140,19,234,2,51,244,130,25,43,224,140,48,88,119,141,70,
+54,33,129,145,72,121,38,32,8,249,100,133,202,109,224,240,145,208,150,101,138,40,232,117,15,238,62,4,130,128,93,78,164,132,93,248,33,146,171,4,
+231,233,238,254,164,47,255,253,45,60,4,84,43,79,135,15,2,119,103,172,51,107,45,1,231,0,16,98,82,8,8,36,238,10,132,137,65,213,29,177,
+107,192,94,73,208,101,158,148,75,101,89,17,137,185,194,234,56,16,89,144,20,44,192,129,13,80,63,71,196,22,1,83,0,72,133,192,180,8,192,82,
+196,80,33,113,22,142,172,16,36,251,41,121,21,67,166,86,179,130,131,225,202,223,243,218,96,102,255,255,191,71,247,49,84,22,155,66,195,166,233,25,
+132,164,25,2,23,143,224,75,97,123,25,248,128,65,204,2,40,167,2,14,32,177,241,131,156,154,36,69,43,184,127,75,102,57,18,26,129,52,126,224,
+155,10,104,164,131,26,39,32,125,17,144,26,35,174,6,144,243,5,134,42,224,236,133,184,211,97,42,44,40,26,85,50,35,4,82,132,233,205,43,16,
+139,123,255,175,27,214,143,255,249,251,127,205,129,213,31,139,114,134,122,173,9,202,239,130,216,194,32,2,5,89,10,149,129,65,155,48,49,29,77,84,
+87,240,177,28,188,75,136,121,9,74,11,193,208,140,176,72,154,44,75,70,181,18,160,225,74,28,67,146,176,5,148,214,195,141,52,208,119,204,44,90,
+210,227,19,244,125,201,195,37,210,80,69,84,226,51,91,53,132,170,209,51,194,249,143,35,255,208,157,255,200,115,254,245,63,233,20,241,35,236,92,192,
+171,142,105,150,242,77,41,38,96,162,78,184,8,180,47,22,40,26,16,141,58,139,36,12,140,121,25,163,232,83,248,26,18,182,34,229,40,131,216,237,
+227,120,63,56,244,8,146,95,66,156,154,224,70,103,92,35,233,241,133,162,103,195,69,155,56,193,228,42,83,105,107,148,162,44,103,35,157,225,196,164,
+242,131,118,43,143,28,23,255,19,55,255,249,54,245,45,251,181,56,160,114,93,85,247,136,1,140,113,198,35,86,89,226,105,181,48,151,110,104,41,73,
+224,139,174,124,196,6,137,152,254,98,234,80,248,12,208,162,18,228,204,129,200,198,162,100,55,8,208,5,242,74,129,253,151,168,28,101,170,24,9,163,
+2,230,68,194,81,148,32,141,33,94,61,136,200,15,210,15,148,235,141,105,60,97,33,65,107,255,63,147,243,244,184,127,255,233,175,233,192,128,193,229,
+44,252,61,92,201,62,6,122,173,96,12,186,208,7,199,186,8,114,69,2,222,51,0,171,140,184,153,97,51,32,56,78,205,198,53,18,75,138,196,196,
+162,105,20,88,89,70,90,5,192,82,2,208,0,34,172,21,192,83,130,168,42,225,39,2,180,11,128,64,0,153,30,66,178,49,17,27,161,28,29,37,
+135,10,106,227,204,225,6,151,254,223,107,109,127,255,194,51,253,122,155,17,233,66,131,230,48,128,105,44,200,70,237,36,27,98,36,0,250,154,32,107,
+18,56,92,229,8,28,56,13,140,26,19,67,120,136,220,236,32,8,61,104,99,204,2,27,2,250,133,184,100,36,144,29,217,40,2,26,102,161,156,152,
+56,48,37,242,43,185,94,9,62,62,100,211,146,105,29,226,164,112,217,169,26,82,84,104,159,97,98,196,53,255,232,64,255,218,255,255,44,143,244,243,
+120,119,117,197,95,59,138,217,133,114,5,38,246,86,194,18,182,176,164,110,168,36,26,4,140,90,134,195,206,139,249,14,99,178,80,168,16,146,78,32,
+5,8,131,24,236,163,82,62,152,230,8,178,93,226,164,154,56,73,39,92,36,201,239,133,198,105,195,85,155,184,195,36,102,84,185,125,20,206,48,231,
+65,159,89,203,165,54,132,214,49,111,18,183,255,28,183,255,249,6,246,11,251,234,184,205,242,101,86,7,135,121,143,113,182,34,214,86,226,92,181,8,
+145,110,78,39,137,228,139,74,124,195,232,138,32,251,163,0,79,216,6,80,198,20,132,206,129,232,206,34,134,56,184,209,6,166,77,194,42,152,16,41,
+38,12,27,201,181,131,170,78,2,153,150,64,153,226,38,67,152,253,16,250,0,101,126,146,57,92,224,68,81,252,20,159,180,179,250,50,191,255,245,180,
+238,58,165,170,80,56,72,23,59,61,97,77,217,68,33,88,17,1,190,144,32,35,169,160,70,228,76,19,57,29,138,254,3,50,131,128,0,245,226,111,
+45,152,92,78,94,25,177,225,128,124,142,225,52,5,56,135,3,14,59,96,179,11,216,13,100,16,7,160,84,131,130,34,128,206,136,100,129,224,117,34,
+57,85,201,138,27,50,60,158,164,6,14,216,255,171,162,223,15,255,252,46,191,179,154,136,246,3,26,125,2,9,48,45,176,180,14,152,134,162,162,11,
+72,185,4,174,17,16,24,68,92,4,16,242,143,244,37,100,11,34,169,105,68,70,80,241,235,145,212,12,35,129,8,104,101,69,72,21,80,255,2,216,
+148,0,181,25,240,42,136,128,44,145,46,7,140,66,134,199,7,65,92,64,200,176,176,247,33,220,70,207,101,83,20,128,159,253,208,94,229,63,255,210,
+139,254,86,174,134,220,143,84,212,210,84,65,183,225,24,102,0,64,113,44,80,91,107,100,6,41,141,137,38,100,162,79,133,160,234,226,56,61,168,84,
+208,198,13,196,25,131,156,219,34,112,50,232,120,7,174,84,34,10,147,144,52,103,22,28,185,141,3,250,106,66,238,150,0,158,100,162,81,41,36,18,
+46,55,103,101,154,41,160,166,46,142,134,14,204,181,31,254,162,175,254,114,255,248,58,127,160,155,190,63,105,38,24,60,69,75,145,148,73,88,50,142,
+14,189,198,5,215,116,1,4,208,148,108,20,55,28,236,97,8,237,30,114,110,192,80,152,177,29,39,44,18,71,171,28,177,230,70,164,72,211,28,20,
+164,198,194,93,61,241,37,78,176,45,147,134,27,76,209,5,235,38,146,183,203,0,159,241,189,60,44,236,13,147,44,68,69,241,36,121,120,63,248,221,
+63,255,206,55,179,215,221,177,190,143,39,165,139,56,60,22,51,30,34,93,100,240,30,187,85,138,34,225,66,35,157,232,193,167,188,58,24,147,16,86,
+49,36,197,129,165,18,225,112,74,24,6,141,22,43,227,106,139,96,106,37,30,33,89,98,130,74,101,1,183,153,96,50,101,28,42,89,67,136,210,38,
+4,90,140,120,238,224,85,86,184,146,142,246,28,244,174,184,219,253,163,158,232,79,255,254,55,255,135,193,62,107,202,10,16,47,80,228,144,34,192,16,
+144,202,137,22,25,161,21,132,208,97,160,176,133,200,80,226,44,48,104,88,76,98,1,244,54,135,100,221,224,156,62,184,33,10,34,57,130,197,144,88,
+84,166,168,32,25,166,4,2,123,226,132,154,208,131,102,148,69,201,80,143,254,78,38,186,146,241,114,37,118,134,245,4,12,237,110,23,152,251,255,103,
+39,255,251,175,199,71,178,219,95,142,19,198,146,210,168,192,248,64,130,15,0,96,217,85,172,15,132,168,11,140,154,65,23,21,225,68,193,74,57,113,
+12,153,212,116,163,225,30,201,74,70,230,23,17,90,134,220,42,98,86,6,248,121,128,136,81,224,84,142,64,18,101,158,26,216,191,8,10,72,68,23,
+135,25,18,36,128,109,72,201,25,98,147,200,252,212,5,158,163,255,228,98,255,233,5,255,133,15,244,152,117,208,243,195,96,53,173,121,183,117,161,38,
+182,18,34,116,196,124,86,85,142,17,93,95,134,177,40,145,168,73,136,144,176,62,32,164,35,201,123,8,121,198,65,184,116,80,39,15,4,87,67,175,
+21,16,12,200,176,17,17,192,6,8,116,128,227,13,80,54,0,188,43,49,19,130,28,132,36,29,48,232,31,16,178,31,212,206,165,153,176,31,252,184,
+92,245,127,255,181,175,252,206,29,253,248,149,38,107,180,177,3,240,5,25,30,50,161,13,177,128,123,237,176,26,121,239,12,22,128,163,108,139,153,31,
+163,160,76,8,8,20,10,35,68,185,129,225,8,35,198,56,8,193,138,10,104,98,26,149,216,84,40,10,26,57,112,5,118,113,130,137,142,120,159,228,
+98,66,184,39,14,170,34,37,94,132,196,215,33,224,83,121,216,191,217,229,242,239,127,255,235,207,247,181,80,98,223,68,54,8,200,67,7,166,71,97,
+149,133,132,130,2,190,22,200,6,101,148,3,80,146,9,82,30,130,58,131,165,2,32,35,55,232,104,209,54,12,35,57,130,0,212,163,244,33,120,245,
+136,78,114,225,76,152,56,112,104,134,28,201,119,11,82,122,35,146,143,225,52,166,100,93,72,177,26,202,123,199,178,146,177,223,241,99,123,196,191,242,
+39,127,255,215,170,17,190,77,108,119,181,87,69,115,90,129,169,222,28,71,184,58,128,42,152,128,164,168,24,17,99,162,21,248,224,6,142,29,82,107,
+133,44,159,164,215,39,56,187,71,218,75,177,27,134,236,20,162,183,13,192,17,133,136,20,146,90,2,128,136,66,83,42,192,114,198,228,97,114,60,25,
+20,64,203,31,37,194,194,70,5,1,202,131,31,110,141,236,17,223,255,18,23,255,21,111,248,197,255,12,231,150,183,153,202,134,155,91,162,213,165,0,
+186,177,84,31,126,14,97,100,176,0,208,170,40,36,217,98,16,198,67,227,151,130,153,55,32,226,62,72,71,209,10,12,194,207,128,32,164,34,226,16,
+184,135,131,6,75,32,67,10,216,6,196,64,5,224,35,0,234,20,128,122,142,212,61,226,181,17,74,25,194,50,97,80,67,54,52,212,81,178,127,248,
+5,60,77,255,255,203,43,254,46,142,110,61,79,149,238,207,128,98,217,65,144,70,253,160,144,189,216,163,107,110,19,138,120,14,58,101,34,246,146,9,
+65,98,64,67,248,89,22,46,16,196,40,133,249,44,162,204,45,200,244,140,114,91,1,97,152,48,126,103,90,13,57,136,8,110,104,161,148,142,240,216,
+36,0,47,232,26,147,14,31,35,196,135,157,60,162,52,38,89,201,191,202,221,238,250,255,255,198,95,246,147,93,46,85,67,31,40,24,105,67,134,53,
+130,149,135,144,89,66,7,33,176,12,195,160,3,233,29,136,202,4,34,125,131,225,0,225,163,57,152,5,145,142,10,51,51,136,136,223,226,146,31,25,
+89,137,111,48,186,66,21,60,129,18,206,60,44,211,172,26,220,197,5,247,44,50,197,201,124,158,50,61,62,20,182,140,109,54,68,101,174,24,250,73,
+63,244,58,127,255,222,230,159,125,214,148,199,224,82,151,70,83,66,3,197,172,88,118,156,5,153,126,194,17,59,176,44,138,180,55,240,196,8,68,16,
+229,173,22,184,239,71,174,92,210,24,138,92,126,99,59,21,248,49,132,58,9,160,73,145,64,26,227,106,0,89,126,4,34,61,161,37,149,152,193,98,
+168,52,105,25,150,182,37,133,124,152,226,15,83,52,58,126,2,140,19,95,254,154,175,255,2,239,241,86,254,145,79,54,94,204,234,112,113,192,65,151,
+37,241,215,101,238,51,107,125,135,94,228,2,201,159,72,161,103,74,62,72,142,142,146,34,36,173,131,228,241,160,38,66,152,60,202,58,18,162,139,132,
+168,42,99,38,13,24,188,131,28,58,96,9,137,144,67,1,98,7,120,48,193,196,47,81,90,148,20,15,7,183,19,58,56,201,100,206,17,75,70,61,
+255,232,104,246,211,255,254,103,159,230,250,237,205,227,160,159,118,96,134,36,208,140,88,183,153,18,222,20,193,167,170,168,152,171,48,45,89,85,142,242,
+89,36,100,132,89,45,226,66,79,8,18,209,146,35,196,24,132,224,184,100,100,39,232,242,4,210,102,225,83,148,0,27,38,64,22,40,230,131,138,57,
+98,130,129,0,117,224,31,58,8,199,71,90,49,19,79,150,92,102,141,74,255,188,56,192,223,255,238,3,254,131,45,123,50,78,54,214,64,64,71,173,
+112,85,174,228,13,178,137,3,186,182,32,113,154,40,152,230,180,41,104,142,16,130,45,4,50,129,77,54,225,172,70,120,9,16,158,54,227,91,139,72,
+170,166,104,33,25,91,134,50,131,161,174,151,224,105,103,154,42,41,7,139,118,84,100,96,133,145,13,163,116,92,216,1,209,46,64,102,18,157,27,252,
+26,159,172,67,255,255,92,239,129,241,184,37,74,114,96,92,74,12,71,5,158,19,0,138,134,100,55,177,53,1,212,72,32,201,7,16,121,161,46,28,
+40,83,78,218,11,179,37,136,5,7,32,52,47,200,6,140,234,54,97,237,141,232,131,166,190,18,185,115,135,2,131,225,167,151,8,180,231,144,54,201,
+3,19,118,104,69,185,140,17,185,104,34,124,9,79,32,49,140,115,207,205,255,183,59,255,254,50,120,221,123,202,180,120,220,197,48,237,162,136,5,130,
+64,194,112,240,3,93,85,2,85,87,64,66,201,72,56,18,44,14,172,29,165,135,4,41,89,200,50,90,17,37,145,196,132,227,11,9,152,79,196,130,
+13,192,98,8,160,25,227,222,9,160,239,131,154,73,224,137,140,16,174,227,200,43,120,106,21,6,64,5,17,138,105,247,169,50,118,154,30,43,132,255,
+248,123,63,240,66,255,201,151,250,21,61,20,124,205,148,49,219,177,25,61,27,133,217,140,73,3,176,115,11,77,145,70,185,83,65,41,204,84,138,50,
+78,29,60,40,138,25,9,242,3,193,42,145,48,143,24,60,15,133,209,25,112,167,69,44,36,178,141,0,20,105,64,145,38,144,13,2,164,20,113,9,
+6,4,88,34,229,13,168,182,78,130,39,50,100,129,253,132,100,126,135,115,255,170,211,107,191,255,248,198,127,192,237,198,3,158,178,145,185,56,9,67,
+30,177,178,220,252,5,119,121,17,5,87,65,227,77,241,160,203,244,88,114,73,38,156,65,200,67,12,2,188,193,200,132,144,202,37,220,84,5,221,31,
+97,158,203,44,48,83,33,17,68,237,65,243,52,65,41,77,164,55,146,50,29,44,144,198,107,10,242,151,69,124,132,48,71,173,140,111,70,39,62,167,
+246,25,125,235,31,255,249,103,126,52,73,99,67,62,161,99,94,25,128,32,72,48,69,241,97,136,100,81,35,194,6,200,88,0,92,31,48,212,192,186,
+68,176,73,28,196,70,38,181,2,74,12,66,114,97,144,221,26,132,64,3,193,40,113,30,74,156,31,211,175,16,92,216,66,175,58,193,160,75,240,93,
+210,222,43,220,150,73,229,39,147,235,203,164,204,243,221,72,22,222,47,132,131,255,139,3,255,254,94,91,4,250,3,47,155,201,137,68,172,215,6,7,
+146,120,215,238,26,1,211,80,133,174,132,32,11,154,16,130,162,78,21,104,31,140,98,35,18,39,139,228,205,35,173,25,216,208,199,218,37,208,10,6,
+20,4,224,59,29,32,15,69,100,5,130,179,5,116,102,129,207,39,177,79,68,24,95,242,4,42,4,53,138,113,46,212,4,37,148,114,187,246,172,30,
+255,245,14,127,238,251,255,49,31,240,124,122,59,246,131,85,167,143,154,10,57,43,15,227,50,17,151,220,88,66,55,99,22,85,7,69,111,63,161,247,
+197,104,123,177,107,38,116,16,40,41,6,210,52,193,10,94,144,238,23,28,50,194,61,31,80,157,70,244,9,34,80,3,236,99,193,22,21,96,125,192,
+116,3,208,162,143,228,120,224,241,44,153,14,78,178,43,36,249,128,213,183,95,253,244,217,143,127,255,193,99,252,228,157,104,251,202,34,209,138,241,83,
+242,229,12,37,184,195,241,128,96,56,170,18,35,42,176,9,82,83,163,182,150,81,6,33,54,78,8,162,19,118,0,244,190,138,193,14,161,142,54,185,
+71,139,62,69,161,231,158,88,114,229,248,20,138,2,8,10,81,65,244,152,160,217,162,94,52,168,225,20,10,1,244,5,137,153,106,160,253,34,91,153,
+63,193,137,238,252,255,255,215,67,245,214,49,252,3,0,102,43,98,192,7,232,59,195,178,32,96,195,2,40,53,96,231,7,232,30,241,185,6,244,12,
+198,65,3,1,112,67,126,135,144,32,155,108,32,39,191,15,129,83,67,236,84,242,186,12,140,161,3,139,63,224,172,76,92,68,52,30,20,36,161,71,
+135,55,210,84,70,124,187,115,95,54,180,110,206,255,85,180,40,104,166,245,222,127,242,254,127,255,178,70,71,189,63,25,61,116,100,66,115,30,226,161,
+229,126,19,251,51,133,26,220,160,0,28,160,64,167,18,15,184,77,136,66,18,34,63,141,76,174,34,65,39,201,54,200,82,38,113,90,142,140,20,160,
+141,7,32,104,198,32,14,97,200,5,20,160,64,11,31,64,236,73,120,57,113,68,33,12,129,8,91,15,83,88,204,100,207,114,170,69,187,6,198,85,
+47,255,102,39,255,110,191,250,163,255,142,11,181,143,112,182,35,156,43,139,133,155,89,114,50,47,13,101,239,198,131,108,32,210,209,244,116,147,143,23,
+180,98,201,77,18,97,245,64,202,152,240,65,28,92,21,39,53,13,177,5,66,112,55,209,252,3,20,91,0,161,39,16,47,132,104,2,81,155,0,156,
+34,33,133,3,56,125,203,74,37,242,11,135,53,71,160,224,56,88,224,17,205,255,210,25,156,143,255,248,112,255,173,19,203,115,161,193,224,116,193,52,
+150,21,192,245,195,56,81,118,152,3,189,147,69,77,68,208,241,206,24,132,49,235,28,196,83,138,157,8,130,38,66,28,166,144,180,28,180,78,71,217,
+31,241,12,202,20,78,147,74,7,236,206,67,209,57,80,139,74,172,85,210,181,18,92,76,8,101,23,161,205,64,230,168,49,10,28,236,66,104,249,112,
+23,251,132,61,139,31,255,252,98,63,23,130,183,216,108,12,96,77,160,217,35,5,86,33,33,146,146,68,52,34,45,9,248,198,193,59,11,240,150,196,
+124,93,48,177,152,36,3,40,69,15,105,182,193,16,124,16,42,20,52,109,197,129,30,192,169,76,232,62,211,45,7,204,242,132,225,52,48,253,204,240,
+135,146,143,31,28,153,77,41,36,178,212,202,149,11,89,248,153,102,216,47,57,215,254,185,111,255,247,194,135,255,92,198,185,28,29,77,9,164,153,133,
+112,124,4,46,1,105,131,129,87,80,64,18,244,46,242,127,4,28,95,133,29,3,136,225,195,202,104,81,189,143,180,117,165,83,27,8,99,197,74,30,
+240,169,136,160,26,33,162,2,81,61,129,50,53,224,63,150,0,102,34,210,30,233,29,143,246,27,68,47,145,193,173,35,6,100,58,73,35,201,78,230,
+134,15,255,143,195,255,171,63,253,240,127,162,107,174,95,158,27,4,141,110,205,243,173,209,64,176,164,20,54,40,2,207,173,104,141,235,92,54,217,86,
+141,74,82,4,151,131,9,7,225,120,77,184,54,206,126,17,99,200,129,176,128,34,232,32,88,173,0,238,72,32,180,142,96,41,67,220,9,88,117,1,
+112,10,1,114,135,172,19,227,209,34,73,121,192,220,129,241,18,165,237,42,13,244,255,230,22,233,189,255,253,137,255,230,210,240,113,226,224,156,30,219,
+132,103,192,184,106,248,232,133,54,203,130,21,184,232,118,40,32,49,202,37,142,82,53,68,151,144,185,58,160,122,81,232,170,19,182,12,4,74,144,144,
+239,163,54,43,9,180,137,110,90,33,127,161,136,120,101,248,23,249,221,138,226,62,98,153,147,89,21,96,242,59,216,163,22,14,14,179,111,136,201,88,
+39,186,255,109,55,200,177,255,255,177,15,224,212,166,45,227,199,70,22,48,87,16,192,130,99,102,8,209,27,68,222,49,176,39,76,172,1,113,110,20,
+36,86,196,245,2,234,27,65,40,120,176,147,164,84,45,71,29,7,17,204,73,8,78,114,23,18,252,248,67,85,51,97,2,82,64,67,211,37,24,109,
+10,199,189,35,194,129,78,60,195,145,161,54,253,13,15,249,40,115,210,227,92,247,193,127,227,34,255,255,182,36,68,220,77,88,160,105,104,134,6,162,
+162,252,184,160,110,111,246,4,226,51,128,122,147,0,27,12,0,52,162,180,20,24,155,71,134,33,242,30,150,28,123,99,217,26,41,94,66,138,43,176,
+6,142,36,85,64,205,26,192,132,203,80,7,18,114,12,84,205,2,221,33,65,175,203,36,116,209,97,46,204,187,76,25,29,52,19,171,4,131,13,42,
+153,156,191,253,246,223,254,47,159,224,149,249,254,59,245,248,233,166,239,172,242,12,249,251,137,163,8,113,139,95,88,27,85,72,19,29,28,195,105,33,
+65,164,197,228,95,16,94,159,76,18,102,125,20,249,164,193,174,69,16,208,140,116,32,192,191,2,80,40,5,56,31,128,95,10,88,61,194,98,12,136,
+146,130,162,15,195,3,133,104,183,224,42,88,136,190,147,198,53,8,44,88,169,87,87,255,162,115,252,30,255,254,22,31,236,142,235,39,217,169,125,61,
+152,73,29,152,33,63,241,9,8,229,238,197,171,99,32,171,82,200,109,179,76,22,92,117,137,47,16,81,240,192,112,156,144,50,29,68,1,103,187,13,
+65,32,67,172,67,82,7,5,52,114,129,119,41,160,10,134,76,16,241,232,3,4,3,194,149,4,0,173,200,102,60,113,109,139,125,14,225,63,42,40,
+127,15,29,255,190,241,194,63,255,222,211,253,16,30,3,28,74,139,125,156,57,81,46,188,4,28,19,67,177,94,112,4,216,108,69,147,232,12,164,224,
+135,157,26,241,177,69,108,163,144,91,33,164,38,10,77,8,161,204,197,40,127,177,219,17,132,167,197,53,51,96,142,205,156,66,211,154,9,204,189,197,
+203,45,145,58,198,120,144,81,191,30,244,23,75,149,23,162,14,192,162,176,150,242,127,150,11,237,254,255,255,228,213,243,78,9,140,204,197,188,36,10,
+153,13,236,120,97,39,29,209,0,68,182,25,208,217,139,28,1,80,96,6,124,59,132,235,15,217,92,192,214,121,113,64,153,220,6,135,73,2,73,53,
+198,56,83,113,161,10,28,198,195,185,46,240,118,79,4,75,19,27,15,116,211,136,77,39,177,238,74,84,210,82,73,45,236,190,208,231,160,89,172,238,
+98,239,244,255,227,148,255,255,63,108,35,60,167,28,13,120,169,30,143,88,163,60,225,46,15,252,34,3,173,87,80,37,148,84,45,82,115,4,140,112,
+196,225,5,120,221,67,18,99,209,245,143,28,112,37,15,32,72,85,197,74,26,209,20,137,216,28,97,234,5,153,93,1,98,59,96,201,152,216,104,35,
+58,40,169,93,15,254,33,132,231,150,217,169,99,54,114,42,180,35,55,72,70,212,79,255,135,11,255,221,71,252,35,63,67,247,81,159,50,165,127,53,
+12,61,198,169,67,173,192,204,90,88,100,6,190,164,162,58,169,120,149,100,20,50,137,6,13,242,11,211,209,129,80,237,34,163,51,56,12,74,74,26,
+209,122,133,240,47,96,58,6,160,186,130,188,10,193,111,8,120,61,129,165,21,176,83,65,100,98,176,250,23,212,1,203,97,31,66,161,70,213,9,171,
+129,171,204,255,246,27,127,194,27,255,205,55,253,233,29,236,187,181,177,41,223,184,174,57,196,23,27,30,64,205,224,40,53,219,99,6,170,157,227,207,
+157,160,193,100,8,78,120,169,16,26,7,101,34,131,56,237,224,26,64,248,124,8,230,30,34,62,144,176,34,35,132,13,105,73,1,64,46,128,150,142,
+24,0,224,87,20,184,4,195,30,79,49,210,143,60,31,105,173,7,105,184,203,144,158,15,254,95,173,123,63,255,187,55,252,5,158,88,156,160,80,209,
+216,204,193,24,19,135,183,25,241,26,89,104,35,246,239,19,29,7,68,171,65,49,246,198,232,124,241,199,41,28,17,201,5,14,194,136,193,104,118,113,
+137,30,100,98,4,53,44,49,39,202,192,26,243,100,13,116,178,193,117,44,65,44,70,180,52,113,47,29,140,2,132,243,6,122,60,68,194,49,241,145,
+156,109,55,31,248,210,179,216,127,255,228,203,252,150,25,214,109,182,38,106,47,134,202,232,193,140,37,208,10,172,74,14,241,248,4,102,136,225,18,144,
+48,193,100,56,51,72,33,18,18,26,4,72,130,37,42,226,6,62,40,78,142,86,75,162,162,144,208,141,231,132,26,249,132,134,210,134,161,240,149,232,
+159,231,12,54,24,193,144,50,79,197,29,131,33,76,228,184,95,168,11,16,243,0,55,243,234,126,102,143,255,254,19,95,52,49,1,136,250,84,33,58,
+186,24,113,198,16,27,242,108,140,124,57,66,36,18,216,139,192,253,14,48,53,65,220,90,176,122,148,4,38,168,59,11,153,143,193,2,125,16,103,19,
+28,78,5,161,35,16,165,203,20,64,147,129,7,252,216,68,229,58,193,4,75,96,133,51,10,31,196,125,140,207,45,66,229,72,9,4,250,64,154,78,
+169,15,110,71,254,136,15,255,249,33,78,153,127,118,79,252,5,74,111,147,137,79,48,80,2,161,177,194,59,83,112,154,15,20,26,114,55,0,240,42,
+195,205,8,168,150,198,214,82,242,31,139,76,165,163,253,34,56,32,72,94,9,81,43,140,184,76,35,4,6,137,127,132,86,77,0,210,154,48,151,164,
+90,40,105,100,147,10,52,196,196,150,25,219,100,146,107,122,119,164,187,90,87,82,183,255,168,115,255,246,134,252,112,126,234,174,2,30,20,139,50,105,
+2,94,205,42,72,11,124,16,217,96,148,29,122,95,5,118,149,226,98,141,104,153,227,12,55,40,88,204,110,11,147,152,140,188,160,97,65,38,168,136,
+195,30,5,96,139,128,196,70,65,168,14,48,16,136,128,10,129,45,8,52,132,2,253,9,65,159,199,0,127,144,76,45,252,183,13,21,31,244,20,240,
+116,94,49,255,234,228,255,220,235,255,28,175,243,237,120,137,118,85,96,253,198,4,202,89,116,22,135,44,0,254,222,52,102,87,57,14,237,28,71,41,
+62,241,144,70,40,146,145,106,32,100,14,105,115,6,177,215,65,150,113,176,231,17,44,31,3,83,31,16,55,197,8,5,146,83,3,88,56,128,94,22,
+48,14,3,82,11,153,129,23,10,25,161,66,90,83,144,78,174,132,85,200,235,44,3,10,63,252,73,30,156,31,255,171,167,250,250,189,95,123,118,35,
+217,181,178,5,217,5,8,219,30,81,186,221,120,39,23,0,25,165,49,68,185,64,34,60,72,196,123,145,159,43,188,40,72,205,11,98,158,66,140,113,
+17,65,30,148,111,67,195,38,17,28,203,68,18,114,223,11,236,181,192,215,33,49,1,198,132,39,176,66,25,20,6,99,209,27,9,196,197,194,22,115,
+153,142,93,177,159,252,36,194,118,255,255,172,39,248,113,54,191,230,8,117,187,71,10,99,23,112,99,86,140,21,23,116,4,45,30,2,211,82,113,19,
+73,144,102,146,185,32,68,34,9,43,20,50,119,192,42,148,17,86,35,44,51,6,227,41,17,134,72,236,63,147,209,16,44,198,130,199,65,161,27,74,
+228,65,51,51,28,124,90,6,193,30,146,147,192,152,131,81,75,46,12,24,100,101,116,23,248,133,189,146,31,255,251,5,254,225,7,122,137,32,48,166,
+170,77,97,83,5,4,132,3,146,29,16,36,199,124,22,193,69,5,158,67,97,45,133,216,227,33,26,50,152,48,210,158,5,67,175,128,141,20,98,110,
+46,88,173,140,106,92,225,193,150,176,141,104,60,23,9,171,138,10,133,130,116,149,121,4,102,226,69,168,206,152,14,98,166,20,138,169,214,105,0,108,
+170,8,62,217,15,250,134,191,255,240,15,217,148,204,201,183,107,246,51,187,134,140,26,246,225,129,37,176,14,137,132,32,209,27,128,216,57,64,204,5,
+28,62,33,229,9,169,106,70,230,79,176,228,156,164,73,100,237,3,49,123,194,36,47,17,251,16,12,149,1,103,52,176,236,204,200,35,115,122,24,244,
+190,5,145,45,82,182,201,216,158,82,151,63,204,203,13,97,67,180,160,174,94,243,72,127,247,46,127,255,162,15,140,31,199,217,152,255,69,229,98,244,
+23,30,102,93,99,191,186,168,15,174,4,24,186,37,128,202,113,66,8,137,200,88,96,234,48,184,143,200,142,44,83,32,143,228,100,227,55,30,104,183,
+192,128,26,16,1,3,156,126,0,101,23,112,28,203,204,24,113,198,10,236,182,133,91,19,129,196,202,24,169,81,4,47,28,230,80,10,150,146,0,216,
+152,177,83,127,250,73,63,253,0,63,193,199,250,197,188,89,186,156,172,155,198,184,226,185,6,145,175,44,17,31,90,240,69,118,249,15,44,234,5,59,
+56,161,130,195,28,115,80,238,30,196,61,103,101,2,25,179,68,118,79,16,73,14,116,15,97,15,19,176,7,66,0,32,129,126,6,152,5,2,230,6,
+240,68,6,178,33,65,170,129,77,9,34,26,63,120,26,154,238,110,102,70,151,226,14,111,255,106,23,235,29,255,242,81,255,34,199,168,15,144,162,99,
+187,3,161,145,155,240,149,241,45,28,165,255,2,35,99,81,131,83,236,66,115,37,32,140,139,6,247,11,98,113,193,220,125,112,67,163,220,23,69,245,
+3,113,117,69,104,40,49,61,9,84,147,64,56,25,80,34,72,180,10,160,153,4,148,50,192,197,23,120,174,196,146,28,115,207,137,108,179,97,34,102,
+248,249,162,126,255,239,104,231,43,255,254,185,191,235,198,228,11,213,253,67,236,125,70,139,148,192,192,237,232,10,187,228,6,190,161,129,38,168,24,175,
+165,50,44,25,37,16,250,16,195,242,132,225,53,96,99,61,8,63,144,30,16,34,116,139,240,155,227,138,13,73,57,132,190,77,128,7,146,216,70,227,
+152,6,136,125,8,62,5,161,72,136,20,192,35,11,18,217,109,73,174,89,210,61,44,75,255,38,17,225,127,255,199,119,253,87,92,145,244,25,57,222,
+112,194,14,176,72,95,112,48,0,97,79,129,217,98,16,106,205,168,71,147,154,21,220,77,199,205,24,2,27,64,154,147,48,188,34,196,3,39,203,22,
+225,159,68,140,75,114,187,14,212,148,66,67,55,208,165,73,224,33,19,4,15,212,88,3,237,25,177,173,193,42,91,80,55,33,140,105,36,57,8,121,
+179,78,1,255,102,55,21,183,255,254,38,191,195,173,167,62,149,0,99,168,56,139,44,4,36,226,161,129,210,173,65,113,35,8,85,39,168,10,41,54,
+12,254,58,98,209,132,233,49,97,40,63,24,3,19,254,25,227,157,134,192,254,164,80,38,89,38,138,186,115,65,114,153,216,139,232,56,26,105,123,140,
+2,112,35,2,142,25,39,101,18,74,24,80,151,190,78,165,80,130,17,96,239,210,254,183,15,210,93,255,255,202,7,225,16,43,48,30,204,52,81,150,
+154,21,72,218,2,82,69,209,223,8,16,57,194,11,22,8,22,97,90,9,248,129,11,6,20,178,172,128,181,8,161,205,52,232,28,16,30,6,34,152,
+141,104,193,163,236,23,249,158,9,10,104,161,42,159,88,173,102,232,34,25,187,145,182,89,195,254,149,145,175,165,10,91,249,117,33,169,63,51,38,92,
+153,235,104,255,203,29,255,255,55,218,171,178,48,102,175,177,145,78,179,119,39,141,208,192,152,116,32,103,82,8,42,68,20,4,52,106,64,176,14,128,
+208,68,38,28,49,141,146,244,167,98,53,40,56,235,202,166,1,130,19,129,172,110,99,206,19,56,199,3,234,107,161,18,147,120,88,103,120,36,249,25,
+12,86,107,4,158,140,217,87,166,226,115,105,13,157,234,187,9,2,83,177,204,225,255,236,76,255,252,238,255,23,223,170,35,140,79,136,210,154,154,0,
+154,211,70,193,132,93,208,64,152,7,132,70,142,225,114,164,24,109,98,202,37,232,178,11,94,32,115,7,131,252,196,99,241,39,24,99,199,206,48,240,
+186,128,16,7,225,59,18,144,89,5,56,13,50,54,2,48,103,195,45,34,240,184,196,68,123,209,228,30,132,52,76,255,47,35,21,202,65,23,60,7,
+216,84,191,253,198,159,251,219,255,234,107,254,118,142,222,189,206,88,149,112,25,44,182,108,69,166,199,48,47,119,194,24,85,161,66,189,72,177,175,77,
+144,83,241,147,34,252,60,135,27,4,90,71,64,38,103,16,134,155,156,27,195,105,4,144,208,69,236,0,129,5,1,68,121,65,216,10,144,23,4,28,
+22,129,7,131,44,54,32,40,55,40,95,75,118,17,230,8,135,41,42,232,132,95,231,255,121,151,179,167,255,232,53,254,247,79,76,190,148,169,57,238,
+180,113,252,63,133,19,144,32,168,109,90,20,251,132,9,250,135,66,74,160,24,244,163,106,59,136,207,19,182,5,4,60,133,33,50,32,62,54,56,147,
+141,234,38,33,188,146,16,122,228,126,6,121,103,4,214,72,224,46,144,200,110,226,34,14,216,50,139,142,22,241,135,139,116,216,164,121,3,233,137,72,
+18,164,207,253,249,8,220,255,255,162,39,247,35,112,140,229,54,86,171,69,13,127,10,160,37,22,180,30,214,219,2,49,30,3,1,75,32,183,73,108,
+102,178,95,27,28,28,201,31,14,226,46,64,194,148,177,5,31,68,36,134,251,35,209,75,199,212,66,83,140,12,148,178,194,229,62,80,219,73,168,67,
+115,30,24,4,68,70,235,30,178,65,193,22,138,49,120,40,28,67,37,111,120,39,249,125,61,126,223,255,251,204,126,140,133,56,148,160,56,98,252,82,
+113,175,6,76,96,195,194,32,16,60,5,234,26,129,103,132,66,48,32,231,135,128,206,160,0,45,200,30,209,170,11,51,105,128,5,9,33,84,42,24,
+176,140,18,75,161,125,150,168,137,39,44,17,249,176,9,246,118,98,14,150,9,3,229,244,61,136,224,24,122,83,101,111,140,73,236,167,208,92,10,109,
+190,172,175,249,177,63,255,239,29,193,60,248,170,183,233,164,45,220,26,199,85,112,112,185,22,172,5,180,101,15,240,190,128,43,25,144,98,128,52,40,
+49,11,132,212,143,51,8,18,82,16,235,152,140,95,229,29,2,161,72,64,144,50,113,238,13,28,120,129,151,52,192,192,203,4,37,19,141,21,220,160,
+5,145,48,146,133,199,196,157,82,236,60,196,158,77,95,77,196,146,43,130,242,157,127,248,35,63,255,196,35,204,87,223,185,160,191,98,21,56,115,83,
+38,214,117,163,74,184,56,60,175,28,19,154,20,2,214,130,65,204,137,64,112,161,228,45,216,150,201,250,29,115,10,144,180,122,34,113,30,24,203,64,
+234,14,16,11,133,36,105,192,88,22,96,53,202,180,10,49,181,12,140,170,132,79,18,145,227,201,148,148,144,234,50,44,227,14,115,41,148,48,113,45,
+102,2,255,245,24,127,250,188,127,153,71,246,173,119,117,235,72,192,71,138,41,142,242,163,42,190,79,97,198,185,200,180,45,200,24,186,10,12,110,113,
+226,185,137,65,4,162,8,57,184,83,208,178,1,147,57,135,12,192,32,192,26,232,9,196,86,42,160,15,5,24,27,195,86,15,112,27,3,132,22,0,
+187,12,68,27,130,151,1,194,6,193,112,111,112,150,54,52,160,139,23,61,131,244,191,253,43,159,169,199,255,196,59,253,7,30,203,254,11,105,149,111,
+12,135,158,85,130,176,200,156,119,119,153,10,197,193,6,101,76,241,37,79,172,137,242,32,29,76,91,202,107,7,130,16,193,180,157,176,97,25,204,54,
+198,237,22,0,196,71,148,58,82,96,1,76,146,193,247,37,16,13,5,180,44,81,8,4,140,32,36,167,13,88,133,74,166,78,210,117,132,17,64,224,
+151,120,87,255,97,229,184,255,255,234,151,254,127,46,86,61,139,210,9,194,64,131,185,90,7,198,209,1,95,192,84,36,116,249,14,53,97,132,247,43,
+49,173,75,184,134,48,184,36,236,86,73,253,0,82,73,197,52,140,112,190,26,180,154,133,245,33,48,232,78,64,60,50,218,8,228,240,67,233,38,16,
+207,74,252,100,112,241,22,28,82,9,1,8,137,151,193,76,151,17,134,133,29,183,223,239,198,223,229,255,255,148,231,246,86,88,62,184,196,27,176,0,
+170,72,136,2,154,180,9,184,144,224,64,164,144,44,6,76,30,249,91,6,186,38,35,232,136,32,225,224,19,78,136,66,15,234,5,68,129,139,152,200,
+34,242,51,201,132,135,194,91,98,69,161,72,98,230,144,39,170,17,137,194,81,35,226,154,97,10,226,168,89,201,96,150,150,24,38,143,157,233,119,167,
+80,253,100,159,229,56,255,255,204,179,199,172,53,22,22,201,152,22,116,216,9,173,143,133,104,55,192,171,143,52,92,129,88,8,176,68,194,246,20,216,
+29,70,18,0,83,98,136,148,190,160,203,65,72,73,203,182,19,131,113,136,16,121,228,154,39,89,93,132,110,113,226,65,156,112,92,103,98,54,249,165,
+140,14,96,5,162,149,217,66,165,70,128,12,209,141,21,63,100,140,110,118,248,149,191,248,61,191,255,233,115,153,127,144,10,211,60,79,83,115,202,24,
+78,88,202,10,190,204,160,174,48,64,43,167,26,9,177,93,132,254,19,32,162,130,28,147,35,103,23,9,10,201,182,81,240,237,146,148,79,164,13,11,
+128,197,194,124,33,146,138,7,124,132,65,157,56,112,190,73,140,61,19,113,26,236,118,136,19,50,18,251,70,164,203,52,43,66,174,107,200,38,227,128,
+212,205,255,229,132,255,252,63,127,20,175,219,133,218,163,158,50,165,188,49,77,1,139,112,238,114,16,13,149,138,130,251,101,0,167,204,100,60,146,222,
+19,28,13,133,181,3,209,152,198,58,93,176,224,149,228,112,163,103,8,40,146,195,194,8,64,96,4,240,15,99,168,9,160,196,130,198,74,128,128,138,
+136,159,100,8,42,120,90,148,10,68,197,14,137,145,237,41,100,120,26,9,165,174,255,248,145,63,214,219,255,165,103,246,168,122,52,249,48,167,59,177,
+154,26,153,195,9,139,15,241,165,94,228,26,213,223,20,69,34,131,89,43,49,183,198,96,93,208,36,33,4,15,38,135,14,249,208,193,226,70,80,154,
+143,188,24,64,185,4,80,14,196,168,36,224,114,7,88,54,131,38,11,152,100,130,242,36,163,10,130,24,190,162,36,91,168,104,148,110,103,232,120,80,
+185,78,103,255,193,193,253,185,255,254,112,31,229,168,236,63,227,248,179,198,131,69,230,209,12,116,87,184,14,134,9,65,158,169,0,101,233,244,36,153,
+33,138,222,60,227,124,128,164,228,32,5,61,40,133,204,114,11,146,201,132,204,95,160,212,16,24,47,129,132,35,160,114,5,112,92,65,126,12,128,47,
+69,196,30,112,53,20,44,70,198,165,2,90,129,72,76,184,49,104,61,157,211,212,63,127,249,214,191,207,231,255,202,87,253,112,157,210,58,155,46,249,
+187,217,66,114,104,39,150,48,97,52,187,16,169,108,200,19,154,54,12,58,105,34,138,140,105,6,225,162,56,120,35,209,66,7,83,59,132,132,205,96,
+90,27,168,25,5,78,36,128,8,7,16,13,130,252,16,64,56,130,192,17,32,229,10,180,17,2,233,6,145,246,192,172,118,49,28,54,108,140,11,157,
+81,228,82,95,254,138,79,236,47,255,226,237,254,140,111,96,126,222,170,56,113,7,66,119,35,209,210,101,246,54,27,163,7,218,242,162,212,163,224,172,
+40,168,62,72,222,143,146,55,4,193,128,9,14,161,42,70,168,26,204,198,28,162,231,133,48,87,227,154,18,152,186,0,172,66,160,57,137,144,40,66,
+46,7,8,51,65,24,31,209,32,149,172,16,198,183,13,234,143,74,104,190,177,159,66,109,255,234,250,250,46,127,254,139,159,230,192,243,174,242,204,78,
+235,81,116,47,52,56,21,206,31,227,221,194,196,45,22,109,26,229,109,132,197,57,2,53,203,132,122,17,51,42,92,69,72,163,2,226,121,67,92,110,
+144,154,27,164,110,195,137,25,64,217,202,124,12,17,242,5,244,159,64,23,15,176,118,196,100,20,113,18,140,220,57,98,3,56,56,166,74,238,20,70,
+99,143,90,56,15,255,32,135,140,143,255,249,186,255,189,67,165,135,127,101,128,243,44,38,174,127,4,9,189,224,111,240,222,19,77,109,131,243,96,1,
+162,204,180,109,83,56,37,132,65,201,25,23,18,158,192,164,140,177,54,35,148,45,134,17,33,177,108,71,96,43,243,6,12,84,153,64,239,46,240,172,
+70,172,22,49,153,17,60,7,226,189,5,233,120,200,146,33,50,50,145,77,11,166,52,115,87,254,243,11,244,127,255,195,187,254,63,14,113,92,0,83,
+204,210,28,81,152,41,14,235,10,32,42,91,56,77,54,128,8,109,40,70,199,63,161,107,72,208,155,145,211,33,204,40,74,243,15,178,39,66,44,151,
+145,146,24,244,98,198,89,44,224,207,74,68,60,179,130,6,220,164,3,115,48,0,163,69,36,82,209,136,18,44,42,38,235,0,33,58,202,54,89,80,
+248,128,4,240,95,248,47,161,126,255,255,129,127,249,191,58,14,233,32,75,44,183,6,199,93,176,53,224,150,14,122,169,1,114,206,1,147,157,152,122,
+40,4,54,8,205,14,238,61,68,215,129,249,37,162,56,80,72,41,16,18,55,163,240,139,224,164,38,8,40,201,88,133,110,121,1,237,151,48,79,102,
+182,41,8,240,136,146,62,195,232,130,40,195,97,34,76,104,133,201,94,8,148,9,158,251,254,189,238,101,79,255,252,194,255,132,235,67,141,54,1,95,
+76,129,23,217,32,65,69,74,4,101,107,194,110,72,112,181,80,108,26,50,155,26,92,131,197,239,12,178,106,67,12,130,208,40,40,116,56,199,117,14,
+146,6,72,160,78,210,72,21,148,223,194,215,50,113,18,207,184,47,114,202,22,156,203,133,61,23,66,36,72,0,124,240,13,42,140,93,7,215,14,90,
+63,92,185,254,238,143,78,231,255,255,31,28,191,253,141,45,99,109,161,209,22,197,172,150,49,217,46,2,44,74,224,135,151,200,61,159,96,127,204,64,
+233,207,153,156,192,17,208,197,122,28,161,187,2,17,180,131,136,122,50,234,37,49,58,7,30,251,143,34,203,23,22,156,5,19,29,122,17,13,179,30,
+132,242,28,205,42,166,86,55,209,71,64,42,160,139,147,110,219,115,255,244,108,255,245,246,255,255,255,255,18,230,255,250,166,18,219,110,164,160,192,84,
+200,150,19,185,113,162,4,187,5,152,192,8,136,140,66,254,105,130,106,36,12,6,10,202,206,32,112,147,6,150,193,7,120,22,140,98,177,146,163,0,
+167,65,153,170,82,30,186,177,55,179,98,104,188,146,29,169,179,229,176,179,215,152,196,234,84,186,85,228,149,100,215,66,150,220,43,63,252,249,63,255,
+230,37,255,255,255,254,36,141,255,119,227,206,203,199,78,65,235,168,178,66,207,81,67,162,68,48,206,68,182,8,164,44,131,152,96,194,110,36,38,182,
+4,203,70,89,108,162,19,110,98,60,236,134,46,140,54,38,200,134,155,72,66,144,5,54,238,7,98,192,198,94,249,75,198,168,12,90,209,18,15,58,
+136,252,175,37,148,78,186,141,176,160,199,22,41,95,253,148,63,255,252,154,63,255,255,255,196,129,229,249,56,112,104,203,220,226,192,118,90,68,124,112,
+2,30,39,67,49,49,226,6,71,1,122,76,192,56,17,144,235,16,18,67,87,210,133,71,50,201,113,241,127,76,176,161,96,81,184,49,50,226,65,245,
+76,26,245,146,59,87,40,39,181,252,95,214,222,92,20,170,146,90,255,72,44,245,173,214,237,85,117,95,236,169,112,180,255,197,115,255,255,234,249,255,
+255,255,254,35,136,248,228,254,225,221,141,251,68,109,195,185,146,46,226,200,184,245,234,29,41,138,12,171,239,12,194,102,20,8,222,7,104,134,163,249,
+131,148,202,83,165,154,114,141,106,142,146,169,252,140,161,206,139,113,12,169,17,47,162,208,211,184,177,186,168,113,232,182,243,144,160,35,251,177,53,12,
+78,74,136,239,185,137,235,71,92,183,42,239,228,21,255,255,252,36,191,255,255,255,196,12,207,206,215,253,137,191,43,31,20,205,90,251,53,75,239,9,
+229,83,202,8,129,101,64,45,51,68,20,116,164,38,84,128,54,145,9,69,208,187,78,148,141,72,210,241,62,149,3,33,146,73,10,147,115,28,64,153,
+46,226,55,78,160,65,77,67,67,94,226,137,72,102,251,85,198,217,56,74,17,173,100,224,210,187,24,185,61,94,78,102,31,83,207,255,255,249,48,127,
+255,255,248,113,255,204,7,254,121,159,213,231,236,101,165,79,73,76,62,117,104,63,188,122,151,206,185,193,55,49,4,57,117,33,245,70,133,209,22,4,
+45,13,55,11,36,244,143,49,181,229,45,178,65,40,146,135,20,241,140,15,113,50,0,164,172,12,83,68,13,53,180,52,83,28,68,149,42,127,210,48,
+136,42,195,85,236,222,43,87,41,108,243,226,245,243,34,255,255,255,204,187,255,255,254,42,255,255,197,223,255,159,135,242,99,253,133,58,92,241,202,184,
+15,34,199,107,192,113,74,241,58,48,185,14,30,124,133,144,60,250,22,36,239,24,220,67,91,100,15,90,140,205,86,212,64,81,164,161,201,60,27,2,
+196,54,70,16,111,9,88,34,79,0,58,12,184,188,207,96,160,201,65,232,77,73,208,200,90,165,170,205,63,21,222,206,78,225,158,136,31,255,255,248,
+82,127,255,254,224,63,255,251,49,255,254,108,223,206,167,240,114,242,185,236,229,52,190,1,147,49,201,200,189,240,76,92,186,10,19,204,100,25,37,115,
+18,228,216,160,98,25,204,202,17,48,129,21,53,137,20,182,61,9,82,79,1,98,121,19,225,100,21,160,148,28,195,142,6,129,114,4,83,144,50,208,
+128,71,146,248,129,168,7,194,229,32,42,214,91,212,91,170,21,246,191,255,255,200,179,255,226,35,255,255,254,176,255,255,226,9,255,23,127,132,214,245,
+126,0,213,147,197,249,119,116,22,74,90,108,21,29,123,145,182,5,72,151,0,7,59,54,103,23,52,72,212,131,244,20,197,114,57,161,68,224,164,204,
+244,38,20,133,233,168,160,107,104,63,108,172,128,173,76,67,107,68,180,42,244,143,230,109,14,211,170,119,113,10,159,41,210,66,124,38,168,239,99,207,
+255,231,141,255,247,56,255,255,255,255,19,60,223,217,178,85,7,31,66,105,10,220,56,159,165,24,23,114,152,79,135,10,20,38,42,52,66,10,9,16,
+250,1,178,239,48,115,33,37,213,237,56,84,147,31,149,247,22,51,97,11,196,49,35,225,91,61,34,189,82,224,189,85,131,151,97,194,195,75,70,255,
+87,198,213,54,73,239,174,212,221,80,219,16,249,119,96,99,27,142,158,159,255,255,249,68,127,255,252,107,127,255,233,167,255,233,41,254,214,255,169,70,
+252,124,248,49,197,222,105,65,241,70,103,27,230,13,204,198,146,206,50,6,186,160,204,210,124,140,50,6,143,218,12,78,106,56,110,114,0,203,130,26,
+104,158,61,5,162,44,130,2,126,1,26,82,1,112,130,1,34,45,128,12,61,197,122,51,35,154,39,42,102,149,228,102,112,170,186,222,39,57,56,175,
+255,254,52,156,2,63,255,255,255,196,94,135,255,238,153,224,231,68,103,157,160,130,180,51,144,223,69,225,133,154,64,139,157,96,197,15,104,53,78,56,
+98,64,65,35,192,49,82,201,77,166,68,69,160,71,157,123,66,105,76,195,64,228,78,240,207,207,128,106,216,56,178,213,64,132,89,65,67,82,193,55,
+83,218,41,230,237,9,180,76,176,10,38,77,93,188,50,129,158,103,254,159,95,255,255,51,175,255,255,255,241,16,151,229,39,249,150,118,175,244,62,221,
+23,83,70,159,209,9,134,235,84,5,181,56,34,152,56,0,235,95,25,137,109,20,56,102,42,72,206,162,41,121,173,121,176,156,121,210,156,105,49,133,
+9,35,128,112,49,149,160,132,152,0,50,36,0,248,159,80,169,160,242,176,153,18,130,151,164,148,76,18,36,167,193,124,87,38,168,92,146,175,185,255,
+255,255,31,143,255,204,135,255,255,248,240,255,254,168,95,242,205,251,45,105,139,210,218,254,121,161,28,254,60,10,219,87,160,213,159,50,32,193,112,171,
+87,241,154,205,105,104,68,234,13,224,136,226,33,135,4,80,48,95,48,36,94,18,108,53,50,118,48,52,240,20,115,234,27,85,206,24,83,48,46,52,
+146,64,176,182,89,114,162,115,177,169,121,242,68,134,201,86,172,157,148,191,255,189,183,255,14,143,255,255,255,241,46,171,255,153,32,158,34,42,183,27,
+221,212,133,249,220,136,10,100,8,60,175,70,16,208,197,0,41,1,188,35,193,134,104,99,110,104,101,238,192,164,154,160,101,14,191,160,110,133,32,104,
+131,102,176,77,230,188,80,108,128,66,42,0,99,238,104,139,105,28,199,237,81,12,211,112,149,155,133,88,37,26,46,67,64,173,7,227,169,239,133,255,
+255,255,154,231,255,255,248,27,255,255,139,255,255,110,239,233,215,251,18,116,7,226,117,107,254,34,13,155,120,196,129,193,96,165,99,232,96,241,148,60,
+84,62,77,19,134,99,208,89,102,144,77,115,82,53,92,208,251,90,241,49,48,16,160,43,49,32,3,194,96,5,50,124,30,130,76,2,209,146,20,0,
+23,34,209,23,9,211,147,71,115,189,16,246,153,70,85,27,64,6,196,255,255,226,81,211,139,255,255,255,252,69,63,127,255,10,47,135,252,245,141,14,
+178,197,184,143,72,33,31,229,50,83,3,228,118,34,184,47,192,164,53,1,155,7,83,77,5,149,73,42,53,141,26,150,123,33,117,35,1,213,69,12,
+195,5,46,99,83,150,130,66,166,167,197,206,187,3,186,177,74,78,180,201,210,137,145,127,79,200,140,157,149,157,91,10,155,45,13,156,29,254,63,210,
+27,255,255,250,14,127,255,255,255,136,34,127,241,87,255,166,199,206,207,224,157,215,15,157,196,86,117,148,138,142,32,67,115,100,36,31,150,144,171,190,
+34,69,166,65,212,142,83,39,128,74,187,144,11,76,144,170,117,149,218,54,138,105,18,138,120,101,133,0,138,0,209,26,12,17,92,3,169,143,0,25,
+14,27,201,28,27,120,53,62,88,217,57,56,39,81,5,70,36,230,138,77,101,255,255,253,71,61,49,127,255,255,255,91,191,255,212,51,252,6,253,149,
+38,135,149,148,86,108,116,62,148,90,19,25,9,24,4,18,3,221,113,128,240,214,14,164,75,141,116,54,216,156,105,213,132,160,217,132,99,211,28,80,
+81,100,58,10,68,94,7,4,240,131,148,222,2,221,66,134,36,216,136,253,20,18,180,109,22,68,195,33,222,15,144,183,61,202,93,143,180,81,237,113,
+255,198,155,255,255,38,111,255,255,255,241,32,37,212,115,220,235,202,31,133,70,0,60,171,162,75,117,4,97,198,232,138,229,172,48,243,106,32,117,164,
+45,213,24,70,48,118,80,144,18,97,178,195,86,178,47,86,19,15,51,177,173,38,177,89,6,192,41,16,32,46,55,96,28,46,32,83,71,2,45,41,
+163,77,61,6,167,24,135,137,61,169,245,147,196,234,224,149,146,140,18,56,75,127,255,255,227,205,255,252,242,127,255,255,226,195,255,251,58,127,102,95,
+211,3,161,110,217,83,147,222,105,146,108,76,92,183,204,36,184,184,17,124,97,14,173,16,145,244,238,25,100,2,218,44,2,30,84,109,217,116,34,217,
+84,31,207,204,78,142,68,136,132,60,210,133,148,252,129,8,233,134,20,234,131,172,116,143,220,114,142,140,57,220,124,25,150,252,163,97,150,49,9,10,
+175,31,255,192,19,255,225,17,255,255,255,254,36,100,255,235,121,33,217,169,226,0,15,244,50,76,26,102,27,244,145,128,118,41,198,160,202,1,46,145,
+192,196,37,198,62,10,37,98,97,169,150,105,39,98,150,39,206,109,227,226,120,97,134,54,34,148,64,101,180,8,39,196,52,233,244,32,40,224,125,170,
+64,137,102,189,5,84,200,135,73,115,85,245,196,43,58,196,153,146,227,1,240,156,255,255,255,154,39,255,255,252,71,255,255,185,127,255,219,195,250,41,
+253,63,60,108,252,2,166,147,174,52,173,243,28,42,59,77,40,173,32,136,102,11,138,182,201,72,242,82,14,94,43,204,250,36,111,58,24,108,114,56,
+43,66,1,7,126,3,36,102,68,65,154,55,1,40,106,193,20,54,194,104,72,129,22,17,160,110,17,166,30,123,227,70,108,233,82,211,96,4,163,102,
+222,153,223,255,254,75,159,32,207,255,255,255,241,31,19,255,239,185,236,35,176,193,17,40,160,14,64,66,3,75,168,115,13,244,208,201,20,65,72,44,
+77,194,32,54,32,152,66,228,150,156,228,54,154,166,194,183,163,114,154,99,94,133,98,4,98,99,0,60,232,88,56,168,28,35,235,156,87,105,40,94,
+42,240,202,167,44,214,105,61,53,211,82,149,203,19,97,110,216,85,123,192,227,246,128,255,255,254,74,31,255,255,255,182,239,221,127,254,89,31,200,255,
+218,123,103,190,255,151,33,204,33,134,243,216,78,250,103,17,189,39,142,93,195,12,181,116,149,108,98,149,4,31,27,100,121,214,244,126,216,52,150,206,
+196,101,76,68,40,192,204,0,193,128,70,10,144,31,8,240,59,141,120,95,71,104,101,72,233,95,65,177,75,197,106,66,225,77,4,116,14,186,75,4,
+91,27,255,255,252,14,62,253,255,255,255,255,226,2,171,255,252,101,191,9,223,101,76,236,109,52,80,248,54,12,236,93,9,250,109,193,196,207,195,20,
+207,194,130,72,131,146,47,73,234,46,232,58,66,235,122,91,104,230,86,233,158,39,166,90,20,36,242,60,67,34,72,193,46,139,2,210,129,193,114,148,
+6,250,126,134,18,90,13,246,93,204,90,14,81,235,49,104,50,131,140,182,96,120,229,31,255,251,92,118,234,255,255,255,255,17,60,31,255,103,109,253,
+80,222,43,130,209,93,70,175,176,176,108,83,200,212,104,232,1,80,252,54,56,11,21,105,222,40,137,116,43,136,84,176,248,98,178,201,56,169,120,220,
+166,24,178,148,152,49,143,8,150,0,136,195,2,17,165,2,161,59,0,105,228,18,57,18,23,105,137,58,25,11,57,185,161,84,245,66,167,82,222,89,
+245,222,179,238,21,255,255,254,229,159,255,255,240,135,255,255,54,31,255,202,91,250,71,252,248,60,15,250,240,66,15,15,166,203,190,208,120,68,160,6,
+97,232,58,134,116,8,69,84,16,35,190,51,36,94,98,105,90,93,104,122,119,40,182,79,230,70,76,34,250,29,32,134,10,163,172,5,196,148,17,71,
+52,23,38,16,22,37,204,114,163,208,104,224,232,219,161,12,170,164,31,5,241,2,82,147,249,45,207,255,251,58,127,236,109,255,255,255,254,36,134,63,
+183,65,151,49,255,0,236,157,115,90,90,157,15,34,11,132,193,38,219,209,120,232,176,86,240,198,99,150,192,78,114,176,116,49,182,103,113,91,110,176,
+241,93,210,71,72,144,219,52,80,171,19,176,202,6,209,174,14,194,34,11,2,250,4,130,22,14,114,190,53,209,68,73,178,68,134,168,232,67,148,254,
+174,22,223,213,13,149,167,9,175,255,255,247,144,255,255,137,15,255,255,183,95,255,223,235,254,59,127,121,236,128,246,134,165,238,23,195,33,36,224,65,
+138,130,163,31,49,60,26,145,251,15,120,172,17,88,126,50,56,52,172,232,127,189,136,102,175,24,114,174,232,51,28,24,83,18,8,244,2,136,237,7,
+96,245,13,208,148,16,64,52,142,144,202,136,82,39,134,226,124,133,123,215,134,83,136,138,236,52,212,41,251,63,255,226,17,250,97,127,255,255,255,136,
+82,223,251,175,15,110,7,56,49,42,206,111,82,83,194,48,142,240,90,94,187,23,14,140,229,22,102,50,199,150,181,13,190,133,139,234,15,206,218,4,
+76,170,69,171,182,42,232,126,66,100,254,21,97,170,14,97,196,16,67,204,24,68,144,22,132,116,14,193,96,9,160,6,29,102,150,31,39,146,43,176,
+65,22,7,213,22,42,168,211,67,253,157,191,255,254,249,95,255,255,255,143,223,251,50,255,243,38,253,223,126,44,30,26,62,81,213,135,208,2,77,250,
+121,31,189,29,13,206,167,68,158,197,132,150,191,135,114,16,134,126,3,74,150,96,39,114,96,41,254,112,37,34,94,37,166,45,96,230,29,32,50,40,
+1,248,37,2,96,86,0,100,60,0,36,64,5,134,40,69,226,4,205,62,34,12,166,31,177,107,60,104,167,128,188,19,191,255,254,165,86,180,255,255,
+255,255,17,146,159,255,11,238,151,122,10,13,2,86,201,192,243,165,148,108,117,72,27,73,19,25,156,232,134,141,175,148,197,235,22,252,170,157,148,234,
+33,62,3,143,246,49,144,231,3,6,77,27,166,185,36,227,125,51,67,219,76,33,135,66,66,51,91,226,3,58,194,251,79,69,57,38,229,161,56,136,
+248,148,196,61,80,58,231,111,49,73,88,187,125,51,63,255,255,211,99,255,255,253,216,127,254,73,127,252,222,63,220,255,248,45,114,213,230,205,154,111,
+37,103,35,190,179,37,227,56,96,241,202,47,249,91,31,170,29,28,26,22,49,120,25,165,88,59,185,105,8,163,137,25,173,216,151,148,40,173,149,88,
+157,1,184,47,2,33,123,6,32,146,10,209,84,4,136,34,2,80,25,26,248,185,141,185,114,175,40,239,152,26,100,178,249,38,76,58,103,250,54,58,
+80,63,255,236,221,251,61,157,166,179,182,112,2,149,231,200,165,120,208,31,154,128,73,54,233,1,189,49,196,163,82,80,247,202,16,107,50,255,30,172,
+44,72,65,22,162,103,64,120,126,113,19,36,12,58,5,179,27,17,166,201,116,52,242,131,17,220,226,194,173,43,145,7,207,0,75,210,54,23,236,205,
+137,7,26,242,58,75,92,226,178,133,47,181,5,82,25,184,91,71,199,255,164,91,255,131,135,254,215,159,235,202,239,37,217,17,136,38,248,36,247,195,
+216,145,120,183,131,126,178,33,78,178,208,46,229,230,17,9,167,8,46,17,193,206,132,224,206,97,241,35,136,118,77,74,35,17,178,136,212,138,96,77,
+7,136,57,65,238,32,32,141,0,216,50,130,158,10,224,24,68,100,12,0,55,138,44,41,130,237,21,201,58,193,124,108,209,187,149,60,70,10,67,52,
+55,247,63,127,3,183,255,254,126,29,18,12,18,83,157,56,81,240,198,128,72,56,156,144,211,0,192,65,90,188,85,22,108,9,93,5,70,31,67,113,
+121,70,208,129,50,66,36,36,21,136,191,20,146,120,65,208,118,145,145,33,228,111,196,223,39,1,135,76,252,49,115,13,19,125,5,131,171,45,1,104,
+79,140,108,178,0,32,4,210,75,123,26,178,165,205,181,4,249,182,153,170,183,200,76,63,252,151,223,171,127,255,194,31,252,191,30,180,253,229,144,156,
+202,252,215,216,148,0,98,182,1,42,178,240,60,198,136,1,105,237,128,158,27,224,187,137,168,117,226,49,24,104,108,202,234,62,177,127,141,44,148,98,
+225,8,72,171,195,94,8,80,214,5,188,49,1,46,25,160,85,198,188,9,65,83,13,4,111,66,119,5,1,149,70,36,108,112,101,163,188,143,75,29,
+4,194,45,96,108,251,51,63,207,121,255,255,89,44,249,90,23,181,198,221,157,4,109,140,144,52,199,24,74,152,169,15,158,247,1,28,177,160,206,43,
+36,33,249,162,143,166,105,3,194,136,65,37,99,112,76,88,22,17,58,43,68,145,134,88,199,228,6,56,153,29,135,6,89,162,132,155,104,75,229,212,
+37,137,221,7,206,68,131,30,153,80,241,34,50,68,121,86,152,2,34,133,35,156,162,18,19,194,74,197,255,225,126,244,213,255,255,22,223,248,25,184,
+86,240,202,76,119,8,96,74,149,96,32,53,40,23,0,196,194,4,57,177,20,3,220,21,161,104,2,128,78,32,189,12,120,172,74,166,29,82,24,142,
+108,179,96,199,35,72,122,71,42,29,65,154,132,200,37,36,80,19,120,242,128,154,79,129,189,146,240,65,35,172,52,9,36,11,178,28,133,13,149,9,
+79,33,198,102,170,102,159,234,124,143,118,183,255,14,7,255,248,184,246,29,246,77,107,121,224,22,188,38,152,230,23,210,144,187,248,100,7,43,5,177,
+183,218,56,45,53,3,28,61,11,5,81,33,50,37,200,112,127,16,59,36,4,71,8,175,0,249,209,69,60,115,208,232,16,196,135,196,241,35,176,108,
+74,112,57,82,243,5,132,137,4,41,43,64,230,67,148,97,145,241,28,204,14,39,197,28,34,189,192,152,127,179,124,27,155,255,58,32,237,255,255,195,
+143,252,47,220,199,178,150,5,201,36,65,57,40,34,125,8,240,74,66,73,37,64,49,132,154,17,1,115,5,14,36,128,217,133,240,200,32,36,39,56,
+78,207,214,1,19,0,132,212,219,161,226,40,248,65,136,122,75,225,228,143,40,68,166,148,30,57,89,132,114,100,131,0,150,32,153,228,110,78,25,95,
+17,214,50,6,203,159,193,181,229,14,129,70,54,14,124,143,254,101,15,255,213,163,230,249,251,195,188,94,122,118,43,113,199,109,19,204,133,135,91,149,
+121,2,46,170,20,11,117,140,198,161,129,168,156,112,245,165,120,47,88,111,17,202,37,3,208,131,117,4,97,136,56,184,30,74,142,43,162,89,133,216,
+32,162,204,14,8,160,4,156,7,160,150,5,120,92,131,129,26,240,178,67,176,125,242,167,36,188,62,11,19,64,148,23,103,26,106,59,147,49,41,127,
+248,140,191,243,208,255,166,247,243,214,122,133,121,164,166,121,139,49,84,49,230,8,188,239,195,180,75,176,127,7,16,108,160,179,9,232,15,100,232,43,
+56,132,9,86,27,228,166,137,32,250,32,96,75,200,223,145,138,26,195,93,147,80,237,164,134,27,89,77,137,158,105,64,213,143,56,69,229,136,16,24,
+47,0,174,15,225,153,139,60,32,133,221,17,137,122,198,56,212,178,32,34,181,93,94,63,239,253,82,159,255,185,79,133,223,195,1,213,175,204,77,95,
+204,245,13,237,162,209,25,45,174,6,59,85,134,34,144,128,224,20,8,48,164,12,2,8,93,66,186,20,49,83,148,148,32,101,29,22,105,103,64,124,
+103,16,6,144,196,73,133,143,32,80,179,200,56,59,243,118,12,148,160,2,247,55,33,90,201,128,63,145,250,31,244,124,70,91,1,226,46,70,188,141,
+208,201,150,244,103,134,98,255,78,71,82,23,255,249,90,250,137,17,18,118,58,78,158,86,249,34,147,197,236,131,55,177,5,165,160,132,219,102,16,154,
+206,188,65,115,204,21,92,84,68,189,16,17,214,192,66,83,80,228,153,188,26,164,91,20,216,193,192,126,34,240,148,132,64,0,96,168,2,160,236,130,
+134,48,64,25,142,224,128,228,112,30,8,154,14,226,86,132,200,137,153,69,166,234,128,244,237,12,173,84,117,3,95,254,51,47,230,5,255,233,53,253,
+155,30,33,30,1,104,100,87,4,54,55,18,6,16,104,72,136,40,49,85,129,156,162,224,238,150,80,76,39,48,59,169,37,12,10,48,229,17,142,169,
+19,96,200,74,200,222,17,178,19,226,250,141,248,209,99,72,17,120,196,5,238,74,0,3,133,216,11,131,2,0,128,87,196,216,29,16,76,146,108,108,
+136,149,6,193,242,201,124,249,83,220,46,245,56,156,171,223,253,183,95,255,19,159,225,73,249,156,188,13,189,56,23,182,206,36,186,185,193,17,114,203,
+128,180,44,0,51,104,12,30,96,171,1,212,43,0,229,14,148,50,67,49,3,201,208,67,216,121,176,71,158,188,85,137,21,15,225,134,71,216,124,82,
+209,17,12,154,4,229,61,144,234,201,100,40,147,53,18,36,104,129,175,14,65,80,65,148,30,242,43,142,84,67,33,231,77,120,195,12,138,90,79,174,
+171,254,116,207,255,244,65,183,239,103,118,173,126,24,11,225,233,66,101,77,26,204,145,133,192,76,173,238,42,75,33,129,162,97,97,50,153,0,82,96,
+6,12,248,20,200,58,57,176,155,148,204,97,36,201,0,17,196,193,68,69,145,9,24,164,162,131,231,34,209,18,79,220,75,178,240,13,148,237,198,177,
+48,129,32,200,68,135,210,149,28,60,4,8,11,28,162,85,195,210,62,48,149,9,195,252,217,31,31,87,255,253,48,188,220,1,3,95,205,225,147,94,
+201,132,132,121,111,24,7,21,80,219,220,180,103,215,99,14,189,4,4,121,69,1,124,197,240,68,80,248,28,116,14,100,39,22,185,95,195,162,47,50,
+65,133,76,65,160,91,29,168,222,4,218,44,97,44,154,32,128,165,104,21,121,170,141,162,109,98,195,146,121,48,231,40,80,232,183,149,118,115,199,122,
+146,185,61,231,88,44,135,254,204,65,164,255,255,144,223,241,115,104,65,144,168,239,136,1,89,64,45,155,196,109,248,2,130,170,188,194,99,185,192,143,
+232,92,37,250,79,15,210,77,227,3,141,97,45,98,86,55,88,40,207,118,17,67,10,134,108,115,96,160,26,232,27,193,244,2,48,48,2,72,126,2,
+21,29,192,42,200,156,82,178,236,19,140,106,72,133,55,194,198,71,56,177,148,15,67,86,138,134,175,170,106,38,15,255,35,116,191,255,34,63,255,255,
+250,168,255,254,21,95,222,103,234,41,105,151,254,0,249,177,28,112,178,73,144,213,154,128,5,102,16,85,108,160,86,46,184,241,105,176,193,101,217,29,
+19,132,131,136,62,67,84,189,33,6,28,10,242,90,140,26,91,67,142,77,4,166,129,192,212,28,2,44,74,65,76,61,38,96,84,96,124,169,40,121,
+24,145,230,133,138,209,97,59,14,234,132,200,67,229,249,255,255,254,160,223,255,255,198,87,255,251,246,255,248,202,127,149,47,240,174,234,99,162,36,57,
+244,42,94,152,255,31,100,41,131,41,115,23,184,54,11,56,59,142,33,65,203,145,22,194,202,4,229,73,2,208,3,129,73,116,68,172,124,24,84,235,
+29,133,67,143,5,13,16,173,177,138,220,239,133,229,78,140,204,127,1,92,27,14,196,47,65,101,124,71,29,1,192,98,119,234,125,12,118,142,255,181,
+151,255,255,194,115,255,255,255,249,63,252,216,127,171,135,229,231,250,191,120,180,241,192,164,239,6,201,241,224,236,40,52,200,64,121,157,5,82,94,7,
+186,116,8,104,177,129,120,209,149,106,128,129,3,52,143,26,248,136,148,2,197,161,74,75,41,180,214,1,16,82,105,30,223,169,33,86,80,194,91,249,
+127,84,232,225,204,137,206,78,217,89,70,77,138,197,209,187,82,60,68,72,68,193,191,255,135,103,255,218,99,255,255,255,252,70,92,124,30,47,125,179,
+127,174,39,52,221,232,164,95,184,37,59,243,50,57,187,44,50,141,165,13,5,232,143,38,0,10,94,71,70,186,35,12,102,42,166,90,122,41,10,89,
+163,250,176,160,198,96,97,4,147,232,144,103,231,0,98,110,80,146,43,184,97,109,240,222,237,208,173,104,241,18,182,174,139,25,5,70,181,124,170,182,
+89,15,146,151,71,137,255,255,227,89,211,75,255,255,255,252,68,91,255,246,138,229,251,34,171,112,87,6,237,69,39,131,116,62,241,186,41,154,98,43,
+189,196,19,134,20,201,127,20,7,197,75,197,167,47,104,119,143,35,47,138,27,134,131,2,181,147,25,103,130,9,75,138,40,229,8,104,156,2,10,92,
+23,74,71,11,58,127,46,75,68,43,153,236,67,109,211,166,158,120,147,13,126,140,81,224,49,74,88,164,84,19,255,255,251,183,127,140,127,255,255,255,
+167,255,255,221,19,248,48,250,245,65,132,162,145,161,228,27,88,97,105,208,38,208,136,27,186,72,31,43,184,28,124,14,32,90,173,140,190,103,17,247,
+57,232,49,130,180,40,74,194,6,96,204,158,228,104,174,228,60,32,35,8,47,102,84,43,0,82,69,66,148,55,6,2,140,199,134,44,76,170,172,82,
+165,48,136,219,181,22,51,49,230,175,204,141,60,105,191,255,255,225,105,255,255,214,215,255,255,172,175,255,199,115,252,154,127,94,238,58,56,83,44,142,
+31,133,242,231,140,224,202,134,24,118,207,212,26,168,232,17,106,12,199,104,12,169,99,101,15,211,90,133,104,54,66,44,200,162,134,59,12,6,111,78,
+70,145,198,110,113,135,6,189,131,114,85,64,202,132,3,206,19,66,80,32,36,42,77,163,20,248,160,52,190,164,113,95,247,140,153,203,227,127,142,55,
+255,255,237,57,255,255,255,240,65,255,139,191,253,9,63,134,47,238,209,227,91,195,178,105,251,100,72,222,217,64,225,49,66,57,140,177,32,26,80,81,
+27,96,51,20,136,132,22,40,196,175,24,113,56,216,149,180,200,190,65,100,103,149,172,180,154,197,74,144,5,18,16,37,206,14,253,52,136,205,125,146,
+196,253,8,244,117,22,108,127,142,124,210,80,244,47,210,53,189,69,169,60,208,171,255,234,13,255,254,43,31,255,255,255,226,38,211,36,14,200,29,130,
+126,59,157,129,248,151,75,7,112,170,132,230,180,109,181,206,91,155,45,24,171,165,25,75,212,41,25,35,24,88,93,48,168,177,151,122,71,152,217,175,
+141,219,42,142,130,164,138,66,68,168,50,225,169,113,77,168,17,251,181,193,76,152,64,166,155,33,163,130,160,40,29,216,159,157,40,96,74,141,61,164,
+134,101,85,75,197,35,214,115,255,255,233,177,255,255,114,255,255,252,66,255,253,58,63,198,31,216,202,14,238,248,26,240,228,109,33,125,161,64,96,67,
+136,127,233,112,154,176,96,48,119,2,114,181,232,88,80,240,96,17,114,108,50,25,50,179,69,61,146,181,4,149,129,30,195,61,37,164,117,104,68,183,
+83,130,205,107,133,179,110,99,71,51,164,91,72,197,71,12,113,93,41,180,73,58,209,192,159,170,79,66,197,244,191,171,7,255,255,234,9,255,255,255,
+152,223,255,154,15,255,1,111,226,143,250,45,120,171,235,244,127,244,140,57,185,21,51,16,140,61,161,117,55,17,112,199,201,15,85,129,48,88,90,17,
+39,72,198,33,80,248,162,160,200,164,186,113,35,18,112,164,206,36,199,202,59,68,10,131,73,78,214,198,134,158,199,154,234,75,74,143,198,66,92,140,
+98,80,6,182,126,35,246,90,36,223,20,23,80,174,43,134,127,193,219,255,255,244,154,255,255,255,242,195,255,247,201,255,250,9,127,45,127,144,231,131,
+159,86,199,59,129,80,192,72,104,212,134,2,102,129,66,233,194,163,33,103,3,129,34,126,166,20,22,86,114,4,161,44,200,33,132,243,97,226,97,230,
+222,77,227,114,6,73,114,128,70,190,111,71,42,235,74,222,201,69,254,189,12,14,212,200,162,48,135,166,70,202,186,93,32,220,209,35,42,202,234,181,
+138,77,181,191,206,187,255,255,234,77,255,255,255,218,7,255,194,231,255,242,244,255,129,111,179,6,171,252,171,40,15,32,38,2,75,4,36,66,105,45,
+26,156,147,132,213,234,150,166,46,205,50,134,75,194,127,208,181,25,197,115,26,149,205,13,19,213,66,80,99,51,16,73,56,52,24,77,116,86,41,85,
+138,78,87,54,52,84,34,52,85,88,75,241,86,19,209,75,60,82,3,3,72,211,152,36,4,75,74,219,57,221,126,120,159,255,255,81,47,255,255,245,
+237,255,246,63,255,249,3,127,224,43,248,24,98,199,140,52,139,238,24,96,68,8,255,72,192,209,1,75,50,226,247,111,66,121,111,70,177,83,69,25,
+21,70,105,22,166,63,32,20,3,36,52,49,44,112,213,64,48,60,39,210,42,59,244,92,36,51,164,34,213,108,43,243,58,12,18,44,46,145,36,8,
+116,21,2,211,165,9,152,180,176,101,28,207,218,107,118,224,248,252,127,255,255,19,239,255,255,185,15,255,248,173,255,250,1,127,182,175,240,2,227,111,
+104,130,243,174,1,11,175,244,73,5,129,158,11,194,0,69,231,7,66,39,68,35,247,76,6,11,22,132,199,3,246,53,12,84,181,44,147,137,36,18,
+99,44,176,41,33,112,178,25,18,144,19,210,114,1,178,238,15,242,76,9,96,79,1,208,95,3,212,253,40,198,159,3,199,219,84,139,141,191,245,4,
+95,187,235,49,255,255,254,94,159,255,255,40,159,255,254,179,127,255,136,103,242,209,252,0,60,51,246,28,18,183,142,6,153,41,38,64,160,68,96,156,
+20,32,39,158,64,213,83,0,140,73,41,71,73,33,98,195,101,52,69,69,97,198,149,0,73,60,180,70,28,114,195,28,26,193,52,61,129,136,54,134,
+200,52,132,40,51,135,168,146,74,88,167,66,145,65,206,194,46,165,217,0,179,70,178,140,192,176,127,128,247,231,57,255,255,254,20,95,255,255,135,47,
+255,255,153,31,255,250,116,127,128,31,154,23,24,62,119,80,55,110,164,202,129,128,158,48,99,255,3,83,30,21,114,5,12,186,198,25,88,188,22,72,
+81,46,56,38,41,137,8,166,56,157,171,216,114,156,72,161,147,152,87,19,88,201,3,248,200,4,89,225,75,27,179,96,10,178,188,54,180,224,86,146,
+122,82,51,76,149,74,253,73,212,165,38,83,20,236,193,235,233,247,170,255,255,253,12,191,255,252,224,127,255,249,232,255,255,182,183,254,20,190,175,86,
+131,213,42,154,53,214,65,67,240,62,104,60,27,17,41,62,224,114,24,240,200,26,113,199,153,17,154,133,250,24,131,147,119,131,170,127,142,250,201,133,
+242,241,131,65,139,136,225,237,161,49,148,153,128,150,163,209,209,177,177,132,157,65,174,172,51,220,170,131,46,146,116,72,90,50,170,41,101,25,180,216,
+192,183,21,111,46,239,255,255,195,35,255,252,229,127,255,253,189,127,255,131,87,254,98,255,152,214,0,179,232,103,220,53,8,173,89,30,49,72,9,105,
+149,22,24,24,86,184,70,132,192,87,77,169,87,67,120,233,196,165,163,197,41,213,67,101,66,193,17,199,203,233,78,70,56,214,81,233,79,215,56,165,
+208,240,203,93,57,105,215,104,223,208,161,197,91,242,31,230,96,229,231,213,83,247,184,160,201,134,74,230,99,157,37,63,255,255,149,71,255,210,167,255,
+255,253,109,255,255,45,143,241,115,253,45,57,77,211,240,102,164,96,105,50,96,94,161,198,103,229,184,44,225,190,110,129,239,46,128,51,21,197,55,49,
+101,233,13,181,31,6,232,81,140,131,49,131,74,234,153,51,160,156,129,213,153,226,64,184,98,116,171,33,29,173,34,196,190,130,182,159,178,111,170,244,
+130,215,106,4,227,61,26,54,186,184,75,30,70,20,240,188,101,63,255,255,203,59,255,237,139,255,255,255,206,247,255,252,157,191,82,127,74,174,105,58,
+159,3,241,152,26,244,132,8,80,219,162,224,45,200,180,118,73,144,85,171,220,76,97,208,104,229,32,248,163,28,183,34,2,231,36,93,8,145,6,84,
+17,126,108,245,30,90,51,130,47,53,138,86,151,104,55,52,166,54,119,20,113,54,22,77,114,252,123,182,86,150,185,136,59,201,81,85,62,36,149,163,
+63,111,119,47,255,255,229,85,255,248,225,255,255,255,239,43,255,255,131,87,245,241,223,138,181,122,136,49,106,71,68,104,245,140,81,172,29,192,47,96,
+224,56,6,212,16,108,120,161,102,136,98,225,56,215,101,221,0,144,33,95,144,142,133,233,121,54,152,130,39,186,13,53,250,178,27,154,5,29,27,191,
+42,187,12,20,202,98,45,251,166,55,233,165,42,201,205,75,29,114,34,230,26,80,183,100,203,236,201,75,200,179,255,255,231,185,255,208,231,255,255,255,
+13,223,255,248,111,127,203,55,168,97,75,198,73,91,100,44,235,65,155,13,229,28,78,1,84,144,225,2,173,96,60,32,146,111,173,50,197,135,98,137,
+142,100,72,200,185,198,193,213,192,75,2,17,101,112,155,164,204,178,108,132,173,41,152,73,234,240,157,239,108,133,40,112,108,171,64,251,171,24,190,162,
+164,240,105,237,61,211,38,114,241,56,159,12,228,183,60,255,255,248,189,127,51,223,255,255,254,226,127,255,168,39,249,169,252,3,153,236,30,145,74,27,
+133,76,41,212,120,2,86,182,57,167,168,46,88,136,14,233,188,21,154,141,60,41,183,44,104,23,60,233,108,69,36,57,152,252,63,32,54,138,13,150,
+81,71,226,152,11,226,215,6,198,140,133,206,227,11,150,197,70,118,107,11,150,194,208,87,39,69,123,24,73,75,173,36,146,65,145,165,82,131,57,207,
+255,255,204,195,229,183,255,255,255,252,206,255,255,18,239,166,239,145,85,212,78,178,116,0,152,138,74,133,31,98,187,155,240,180,48,48,55,197,177,49,
+215,216,150,203,193,152,211,105,245,195,177,138,68,90,45,229,144,246,96,172,196,38,96,249,40,116,135,230,56,131,173,108,163,43,44,61,169,124,141,174,
+88,160,230,204,109,167,25,3,180,188,111,48,75,105,147,88,161,106,43,47,25,123,240,6,255,255,247,66,148,159,255,255,255,248,138,115,255,254,44,147,
+29,204,63,43,198,147,195,226,247,60,131,166,175,117,3,19,183,51,238,224,28,153,48,6,29,23,16,95,246,16,63,16,105,38,208,189,85,209,103,41,
+117,191,9,212,93,31,147,235,29,6,141,62,195,233,43,131,51,99,101,171,112,67,13,71,3,81,108,70,153,89,227,223,19,196,171,51,136,12,135,65,
+160,164,137,169,130,219,48,146,222,186,95,255,169,119,251,231,127,255,255,255,136,54,175,231,44,236,221,250,254,225,158,32,124,97,164,139,160,5,88,118,
+74,111,121,217,3,28,165,16,214,69,67,10,88,65,20,57,6,110,24,67,2,147,224,98,141,165,82,140,160,82,239,227,116,177,160,192,136,230,212,195,
+170,88,111,230,248,76,107,172,149,172,120,79,165,188,71,40,12,173,166,4,97,227,162,90,160,174,200,98,214,46,47,6,25,136,155,63,47,255,233,193,
+255,197,99,255,255,255,252,67,158,239,149,243,220,236,87,197,251,119,159,4,108,189,114,216,63,250,209,46,158,7,7,239,15,33,36,99,226,37,106,194,
+23,13,160,66,20,18,193,16,82,109,82,48,9,89,209,213,65,80,85,102,242,196,87,49,176,49,243,146,80,246,84,61,212,54,29,245,20,75,118,122,
+63,210,110,39,50,96,100,243,16,77,146,187,32,18,59,98,144,129,23,216,162,237,61,255,253,105,191,212,163,255,255,255,252,69,3,127,145,215,12,239,
+204,87,236,217,188,30,183,87,213,230,137,119,60,146,138,198,105,7,95,94,36,23,115,1,118,44,33,71,56,2,1,34,81,92,77,17,69,58,49,9,
+118,114,88,124,112,158,84,50,8,119,149,128,98,243,146,48,212,206,81,215,26,56,179,122,14,147,150,64,116,76,38,49,135,3,161,243,56,113,207,2,
+120,199,164,4,46,65,161,211,112,136,255,194,99,255,255,48,175,255,255,255,210,151,221,199,251,117,126,67,127,175,119,201,63,193,106,95,182,112,108,92,
+105,147,86,34,200,204,137,4,116,180,68,68,17,43,8,101,163,248,83,227,44,229,166,228,248,96,204,199,162,53,11,243,48,113,48,224,68,18,102,88,
+116,70,43,113,104,2,66,146,27,51,44,15,193,137,49,161,75,0,17,251,47,40,76,169,163,250,138,52,29,218,107,17,57,207,91,102,31,31,234,101,
+255,255,249,224,127,255,255,242,177,255,253,155,127,255,189,87,251,92,250,113,110,219,211,42,230,180,108,70,195,214,59,199,72,73,64,172,142,112,210,175,
+128,48,169,210,159,179,147,4,145,178,149,142,212,19,201,177,192,67,125,64,192,81,145,68,8,194,198,116,23,64,168,77,66,240,160,138,189,34,133,12,
+160,7,221,115,28,101,176,23,116,195,156,189,179,43,78,254,146,247,52,137,193,201,3,64,28,39,190,37,95,255,255,19,47,255,236,115,255,255,244,209,
+255,254,174,31,248,148,252,150,27,76,140,10,81,251,143,176,23,107,32,83,241,102,19,104,64,24,252,143,14,149,92,9,181,3,22,196,228,20,172,35,
+208,140,55,214,252,76,205,100,248,70,52,158,199,172,143,199,25,21,206,8,138,75,8,158,89,97,96,91,24,219,208,201,49,92,202,37,172,192,209,164,
+36,253,235,241,83,21,98,125,208,75,124,247,4,199,147,255,255,226,117,156,79,255,255,255,248,131,45,255,251,211,115,223,197,177,40,81,135,67,201,148,
+215,192,59,103,80,150,55,106,63,184,204,2,155,194,26,11,149,23,137,32,15,56,81,31,248,77,150,217,242,144,41,217,149,154,19,128,26,220,137,1,
+215,136,241,219,163,226,110,166,129,20,157,145,113,179,194,129,168,17,24,143,33,236,162,99,127,140,161,96,153,154,1,133,227,197,143,40,126,71,47,125,
+239,255,253,16,60,155,63,255,255,255,196,136,199,255,177,84,182,200,242,193,235,93,72,28,113,173,103,195,90,104,246,220,24,89,199,29,237,40,9,237,
+167,1,169,7,7,188,194,6,244,71,196,92,156,74,60,219,70,45,88,195,253,36,68,165,38,68,137,55,70,24,153,198,16,150,207,240,162,203,224,21,
+134,16,45,77,48,124,65,64,85,12,28,35,68,116,152,85,60,208,164,78,64,139,166,6,18,15,224,105,255,213,219,255,243,52,255,255,255,255,16,22,
+152,177,121,16,125,69,255,105,175,110,62,135,210,101,197,234,83,122,18,48,204,182,133,65,249,4,46,4,0,234,89,2,196,17,130,2,8,226,158,106,
+161,242,129,164,82,136,98,234,157,162,66,113,162,30,96,97,64,72,160,212,7,64,176,7,195,176,21,128,70,105,67,106,59,65,110,40,9,66,146,207,
+98,76,11,162,49,146,205,129,181,212,219,234,83,241,198,255,155,87,255,255,209,227,255,255,255,230,79,255,211,215,255,233,61,253,33,254,38,158,74,126,
+174,25,169,222,160,40,101,12,94,52,208,0,213,74,75,99,70,22,163,162,16,128,219,32,130,119,10,114,143,21,116,157,16,244,167,33,179,247,26,83,
+181,20,114,13,18,17,13,0,0,32,8,50,80,11,178,38,0,162,164,38,212,180,63,18,208,52,210,112,119,149,152,143,105,127,60,73,92,82,230,74,
+88,94,203,131,249,41,127,255,252,144,191,255,254,142,127,255,247,141,255,255,122,239,254,75,255,80,10,137,215,194,60,56,146,11,217,230,66,144,196,15,
+137,110,19,232,18,94,16,78,76,144,26,200,105,10,202,41,59,193,213,12,68,173,97,194,229,54,199,12,214,197,100,170,195,44,57,67,20,21,128,4,
+89,130,148,200,4,116,170,3,36,180,13,149,19,19,36,125,144,4,93,31,173,26,163,14,39,75,238,34,210,211,144,183,53,111,255,255,110,175,224,231,
+255,255,255,233,247,255,247,6,253,155,125,184,42,30,36,182,238,50,246,152,56,169,25,35,13,161,137,142,0,128,160,252,72,255,7,228,79,54,131,63,
+34,230,47,32,165,225,16,84,141,22,213,45,16,51,181,31,81,237,20,81,17,13,144,220,15,49,182,2,210,90,18,19,176,27,50,98,18,241,240,60,
+242,246,75,112,65,47,209,29,103,209,198,108,50,193,12,52,223,215,203,255,255,207,73,239,191,255,255,255,196,132,143,255,227,116,98,184,125,211,201,28,
+241,224,195,47,132,244,60,234,64,67,182,90,115,155,148,32,91,247,13,251,146,45,59,59,37,152,166,28,184,37,46,72,10,165,121,92,153,153,65,154,
+248,255,139,233,71,128,32,181,133,144,140,147,48,137,147,0,7,146,176,151,152,48,190,133,0,60,131,57,124,129,49,117,161,216,28,43,137,98,148,216,
+138,195,159,132,151,255,232,141,255,76,79,255,255,255,241,13,75,253,116,45,197,244,153,253,26,59,236,238,233,54,157,184,48,3,219,49,171,103,132,46,
+244,50,88,153,159,18,154,30,6,201,188,34,57,35,24,9,34,145,105,69,159,105,92,147,58,70,137,73,186,137,249,90,133,49,91,139,144,133,141,32,
+99,150,64,63,141,64,105,7,48,54,135,144,38,148,104,177,31,200,124,157,40,27,68,173,60,165,2,73,207,103,66,47,252,188,191,255,249,166,127,255,
+255,254,183,255,197,71,254,239,223,147,143,222,147,229,239,240,8,199,78,249,201,39,133,196,9,110,48,12,107,208,77,13,36,50,233,232,31,194,30,42,
+2,74,63,36,126,22,107,78,12,233,178,62,233,26,11,42,182,11,198,194,4,68,194,55,3,170,51,192,120,40,0,168,56,193,168,13,36,184,52,33,
+168,62,162,196,200,103,60,241,162,44,222,38,153,85,248,209,90,190,33,159,236,213,255,255,243,132,255,255,255,203,151,255,244,231,255,255,83,207,253,23,
+126,56,217,168,241,32,200,183,60,96,97,41,72,17,27,114,14,30,67,210,29,60,182,17,197,126,138,53,3,23,157,65,28,116,89,145,172,99,210,60,
+63,82,244,142,199,20,248,65,116,167,64,36,138,200,96,161,74,232,47,71,56,0,9,32,25,68,40,99,8,180,141,10,196,42,145,44,183,34,126,158,
+81,57,26,103,91,56,234,99,205,59,121,79,255,254,204,92,170,255,255,255,255,62,127,254,227,92,192,235,84,141,215,195,236,213,161,94,145,203,139,99,
+231,71,203,74,18,245,8,16,117,166,5,149,232,50,19,6,0,3,47,21,3,227,19,212,11,4,247,1,22,134,151,3,84,69,1,148,61,22,162,197,
+3,128,88,4,209,0,7,97,246,19,148,26,39,115,38,27,146,26,58,115,30,82,16,88,35,115,107,38,18,41,59,244,227,61,106,197,231,1,255,211,
+35,255,249,79,127,255,255,253,197,251,134,255,223,27,255,41,63,242,100,241,25,203,49,78,236,156,216,52,126,61,32,75,156,32,145,183,192,99,58,146,
+158,201,145,202,86,249,20,201,137,147,205,201,244,194,129,16,75,196,201,72,20,221,73,172,3,82,76,137,12,116,107,7,164,221,12,61,35,134,92,145,
+0,120,110,4,52,75,128,136,201,74,25,71,195,97,73,199,42,67,45,5,72,212,126,128,217,69,120,19,127,255,254,91,95,231,75,255,255,255,252,2,
+127,255,193,211,151,108,201,240,228,95,218,207,84,103,149,134,21,250,22,39,28,254,16,94,213,78,15,43,32,217,35,97,34,25,162,49,0,64,96,103,
+211,40,117,80,88,93,16,236,132,234,10,65,212,134,144,236,64,143,148,222,141,236,121,133,32,73,74,160,0,6,200,89,83,145,123,88,41,91,202,225,
+82,79,34,52,234,105,5,176,97,60,145,109,103,18,44,163,119,255,231,125,255,200,139,255,255,255,250,78,133,79,224,37,227,235,224,209,216,135,199,171,
+27,219,154,3,92,37,2,70,68,195,96,85,144,128,31,54,152,8,148,90,65,150,220,125,116,172,89,80,162,91,49,124,121,176,152,67,115,83,21,242,
+183,30,145,211,19,68,235,82,36,167,63,226,75,73,36,147,120,101,113,75,225,225,24,34,229,46,228,217,6,144,88,115,242,96,100,48,107,117,118,190,
+198,207,104,239,241,178,255,255,210,171,255,255,253,7,255,248,203,255,244,168,255,161,31,244,116,235,167,83,99,2,68,129,186,107,6,144,32,122,189,28,
+220,85,129,53,192,12,214,8,137,230,142,4,254,15,70,50,4,200,106,62,164,26,145,226,158,127,99,14,125,96,228,143,98,160,78,225,80,34,99,128,
+32,163,60,42,129,182,92,2,22,54,195,106,101,203,226,165,77,234,72,11,62,64,81,161,95,233,181,148,226,69,150,127,62,15,255,255,54,140,29,127,
+255,255,255,196,59,55,255,244,40,161,111,99,255,46,108,136,113,122,161,63,8,12,48,117,118,92,89,71,4,12,148,14,142,53,1,230,81,132,196,4,
+96,66,1,34,18,109,161,152,179,224,170,143,35,70,142,33,70,147,32,254,87,97,246,38,224,218,4,160,174,42,192,206,54,0,36,58,1,142,75,194,
+150,15,0,76,59,97,74,49,100,6,126,227,129,24,116,84,134,216,241,64,230,118,31,234,5,255,255,240,178,255,255,255,197,207,255,245,141,255,253,27,
+63,172,111,192,43,192,63,197,26,236,49,142,109,160,200,92,5,196,67,129,14,150,34,83,198,216,134,210,208,148,212,241,159,212,201,134,195,217,17,66,
+109,98,64,249,110,67,236,214,200,100,144,67,252,131,192,40,61,192,232,13,130,104,31,5,208,19,201,224,82,200,136,77,195,200,149,71,89,96,202,121,
+111,193,212,245,196,53,183,77,26,29,36,185,217,131,255,254,138,130,129,255,255,255,251,104,255,241,30,234,14,105,220,46,165,247,135,241,158,192,151,4,
+38,37,200,114,118,186,52,58,140,196,1,189,214,12,78,28,201,162,140,130,6,29,98,90,20,103,250,34,165,126,141,33,126,149,35,162,85,163,214,87,
+32,192,102,162,196,47,161,120,4,194,88,11,165,96,40,36,248,17,97,140,20,34,16,119,101,172,188,162,204,151,160,158,215,168,21,77,152,43,83,6,
+94,223,251,106,127,255,230,93,255,255,255,240,129,255,148,15,255,240,26,255,240,125,254,14,218,187,224,53,41,157,7,33,143,34,230,60,0,248,24,27,
+17,154,25,51,32,30,172,41,146,108,247,138,108,114,23,68,251,32,254,75,140,86,21,42,130,17,206,2,75,203,182,30,197,138,22,5,34,100,198,198,
+124,3,22,67,0,38,73,3,250,126,199,14,76,131,190,19,228,134,13,12,10,58,11,122,76,98,182,141,102,170,18,219,185,127,255,246,38,116,239,255,
+255,255,241,28,67,255,241,166,26,11,192,207,177,196,245,56,213,15,167,181,133,112,10,47,154,93,52,30,32,144,83,159,33,63,170,177,53,176,211,81,
+172,50,159,128,105,74,142,42,91,128,162,218,140,41,25,160,8,104,144,137,13,129,104,42,144,105,142,20,25,80,0,168,179,4,169,231,32,122,147,32,
+57,22,22,136,201,52,234,160,74,141,48,160,118,40,80,7,94,11,193,235,25,254,145,159,255,249,169,127,255,255,187,79,255,31,159,254,34,223,231,175,
+254,15,95,117,159,2,104,24,191,32,0,80,177,18,101,224,107,194,81,3,192,180,53,35,10,32,97,239,89,230,41,59,68,67,3,116,153,21,72,69,
+154,100,7,195,25,68,193,129,127,79,201,212,82,17,4,201,192,135,80,105,21,90,177,18,208,192,77,199,152,157,208,25,125,206,161,1,198,20,107,71,
+141,104,71,17,200,198,124,8,30,223,215,11,255,255,150,87,30,223,255,255,255,241,2,97,255,254,247,222,240,180,125,241,206,219,79,25,101,55,185,100,
+226,247,48,158,110,3,133,83,24,2,225,161,35,208,204,233,71,81,224,172,203,73,146,81,169,240,196,129,16,201,116,252,66,45,127,66,32,226,73,108,
+13,9,4,33,67,16,43,192,204,210,12,61,32,6,52,122,130,148,185,147,245,137,29,132,244,20,100,71,156,213,84,170,251,5,74,37,160,84,56,229,
+129,255,114,175,255,255,72,239,255,255,255,132,255,255,162,47,255,246,218,255,146,31,190,151,24,159,1,13,230,118,148,58,85,138,80,198,154,0,248,146,
+13,80,237,56,192,244,161,16,56,3,32,223,150,179,126,156,163,63,128,234,95,129,91,184,153,212,46,74,89,81,195,177,16,79,73,153,88,241,48,207,
+144,99,205,224,205,217,121,86,212,160,166,196,0,127,71,81,138,206,33,142,197,4,102,209,44,223,194,185,239,200,235,185,183,255,253,28,148,91,255,255,
+255,251,183,255,239,173,192,38,136,13,73,146,175,114,108,248,243,58,69,154,39,46,110,74,17,223,189,145,245,192,16,116,96,4,211,113,26,110,179,184,
+57,112,68,84,50,8,125,113,44,79,50,145,40,145,199,65,144,198,50,209,5,19,98,143,28,96,26,4,128,142,46,163,49,88,195,157,46,161,195,28,
+5,21,87,104,219,171,51,238,138,211,150,161,117,126,102,169,134,78,20,95,251,111,127,255,191,71,255,255,255,172,63,239,131,255,228,177,255,214,151,253,
+84,188,65,242,164,108,124,45,165,79,138,81,0,169,211,104,21,129,131,48,160,102,14,98,147,31,42,68,21,152,2,20,56,89,56,217,156,64,180,55,
+149,92,32,216,28,184,160,114,137,11,38,69,5,210,110,73,138,216,74,102,167,67,170,89,4,82,155,11,98,172,9,2,18,195,226,21,170,190,80,207,
+190,1,4,198,181,96,182,86,61,31,191,255,253,161,50,57,255,255,255,255,17,132,223,255,219,128,242,252,150,124,207,50,203,200,2,140,123,238,99,255,
+193,170,60,52,70,16,5,150,23,70,222,24,21,52,20,161,255,87,37,219,59,100,129,7,68,211,24,168,53,160,20,80,201,41,102,194,60,217,65,153,
+16,74,16,206,195,16,91,9,236,255,136,36,169,130,60,169,140,141,134,157,141,202,155,188,208,17,228,75,26,45,0,36,222,148,14,242,63,224,116,221,
+62,80,95,255,249,78,29,111,255,255,255,248,128,190,255,250,20,83,207,197,255,245,188,249,124,248,154,87,110,228,77,187,140,20,105,240,106,46,245,234,
+89,64,48,81,1,106,26,96,52,52,197,181,101,104,66,160,131,30,131,50,186,135,179,227,151,211,215,137,1,169,143,136,70,137,136,142,133,240,15,136,
+154,29,35,171,46,31,106,23,17,41,166,34,234,247,64,229,147,28,20,82,140,252,113,81,60,50,158,4,77,139,213,138,251,205,127,254,124,31,196,163,
+255,255,255,248,248,248,3,113,54,234,227,239,165,241,187,250,38,114,209,211,240,216,222,200,62,35,92,56,240,156,45,224,7,136,98,69,186,33,93,152,
+225,146,157,227,216,174,100,84,204,73,131,67,141,16,194,109,104,68,185,54,194,196,8,207,52,174,11,204,120,131,172,154,138,133,136,23,149,223,19,253,
+10,138,44,142,16,229,6,157,252,240,149,68,149,192,1,144,192,148,225,203,108,224,242,232,255,251,149,127,252,91,63,255,255,255,196,74,165,172,255,242,
+124,254,217,62,229,220,9,122,149,110,247,202,218,73,113,86,96,96,108,119,162,244,60,98,132,101,4,53,146,51,184,187,98,114,148,210,44,147,3,195,
+158,4,11,195,193,12,75,244,114,202,156,168,67,68,105,73,172,184,21,29,88,144,156,246,135,20,225,140,125,146,24,53,175,146,180,147,133,204,38,202,
+28,47,149,12,0,200,189,185,210,162,112,170,189,19,91,159,127,254,34,95,255,73,175,255,255,255,241,14,89,125,191,254,154,223,253,80,255,192,59,164,
+222,8,74,99,88,70,171,165,160,214,6,69,22,19,166,104,67,42,202,130,90,226,12,155,21,104,53,173,242,143,131,241,220,128,234,242,136,2,233,140,
+120,188,169,136,153,35,248,45,18,88,138,27,186,132,47,107,106,35,58,38,12,25,118,19,186,91,39,170,35,24,120,144,135,194,92,130,129,175,145,106,
+12,141,36,222,228,57,134,222,193,159,252,32,63,255,118,239,255,255,253,249,127,127,95,252,203,191,232,131,254,140,159,58,190,20,65,110,8,112,116,42,
+228,12,64,104,18,30,109,162,157,118,119,199,34,187,196,166,164,11,242,198,78,170,84,7,182,75,35,234,95,38,186,56,166,6,112,225,192,198,102,108,
+160,164,84,79,100,156,94,170,24,146,171,136,88,37,8,6,64,244,16,162,200,78,224,80,6,170,242,126,16,221,50,230,241,10,231,61,81,11,56,233,
+173,253,130,63,255,249,174,127,255,254,58,191,255,239,239,255,249,188,127,29,127,87,238,141,60,220,35,246,122,21,70,129,61,201,138,134,19,192,225,21,
+68,155,168,3,182,199,160,255,79,0,132,71,129,27,73,161,107,192,28,190,79,188,55,209,236,98,76,60,87,205,220,83,19,4,192,141,180,132,132,92,
+113,3,252,197,6,172,169,128,104,39,73,48,159,197,88,131,192,132,242,201,18,30,43,173,50,84,76,127,49,142,126,152,81,127,106,175,255,255,161,55,
+255,255,215,87,255,255,229,251,255,255,211,219,254,197,188,43,128,200,212,2,141,216,20,104,233,113,124,143,206,20,200,191,20,96,97,118,131,77,137,99,
+9,183,113,255,141,16,249,134,233,134,133,154,32,140,105,123,156,104,164,158,152,141,149,40,105,144,8,47,12,232,115,0,248,35,9,160,37,8,160,75,
+9,128,134,151,194,3,203,61,228,197,28,195,231,7,69,213,49,201,46,176,100,191,77,177,135,73,251,252,114,63,255,248,176,127,255,218,223,255,255,210,
+63,255,254,58,223,252,96,126,129,6,91,42,28,214,30,174,52,2,85,9,195,23,184,147,212,218,41,17,224,36,15,169,32,55,169,208,147,104,60,144,
+97,88,93,99,202,90,36,66,116,163,118,112,99,190,78,99,178,47,162,114,24,32,206,8,33,92,14,35,252,28,164,208,19,163,64,14,226,196,69,165,
+100,162,38,224,187,98,172,142,225,82,162,98,185,17,213,206,153,236,254,191,192,35,255,254,36,95,255,226,15,255,255,197,151,255,200,219,243,75,248,23,
+116,29,207,88,12,13,126,207,137,219,30,162,24,84,98,132,122,162,119,146,82,41,187,129,25,151,192,180,139,129,208,144,194,239,140,114,190,132,201,249,
+143,25,183,137,169,240,130,49,236,136,1,72,134,80,116,134,48,44,142,208,168,155,193,68,157,209,36,144,112,201,135,33,126,145,179,75,161,244,36,204,
+33,162,192,101,63,68,98,36,52,180,255,108,207,255,254,248,159,255,255,209,231,255,255,69,63,255,252,149,191,232,31,225,161,109,220,255,47,119,153,178,
+8,155,180,197,145,110,112,128,28,163,71,4,122,0,210,240,203,131,1,37,195,59,35,83,3,131,199,15,103,9,48,232,59,146,83,24,128,89,233,128,
+218,18,149,18,219,166,114,123,158,177,12,145,160,120,152,113,128,172,50,175,173,18,65,146,113,55,128,193,215,143,147,250,165,244,114,76,65,126,69,196,
+194,202,211,254,85,159,255,253,35,191,255,255,66,31,255,252,124,127,255,249,155,127,252,176,255,79,137,62,140,28,18,13,48,11,225,40,104,192,69,78,
+166,65,170,129,151,183,48,96,29,48,178,174,243,81,187,19,244,160,178,176,129,82,55,129,227,122,152,132,68,78,233,199,69,216,241,194,120,212,204,201,
+81,216,33,90,212,160,153,73,168,35,201,56,170,210,249,112,212,153,74,196,248,135,200,76,154,65,197,171,204,194,29,228,172,136,96,161,254,47,223,255,
+245,242,255,252,32,255,255,255,11,191,255,217,123,254,93,255,174,231,19,245,30,192,130,199,57,49,35,123,243,20,179,182,17,141,99,158,158,184,11,50,
+243,67,154,112,133,226,149,78,250,203,17,23,61,38,123,0,100,175,3,182,63,41,8,15,159,3,46,143,65,91,133,16,219,149,17,195,170,146,26,164,
+176,205,138,128,63,2,128,170,146,114,86,152,18,77,133,168,135,166,72,20,157,9,254,135,67,97,149,215,220,115,255,255,87,239,204,215,255,255,255,246,
+57,255,253,150,57,193,184,98,107,190,178,236,71,31,126,140,61,117,132,115,185,139,1,76,37,140,174,146,80,55,166,115,136,184,1,174,147,161,216,151,
+179,194,166,116,77,76,81,159,65,252,252,195,229,46,199,57,152,206,41,56,71,40,70,64,24,17,133,184,98,207,160,177,76,240,37,194,12,114,137,84,
+18,2,116,209,65,248,226,203,204,40,31,68,193,156,172,18,74,119,224,113,255,255,226,161,240,143,255,255,255,255,17,19,63,255,251,122,116,79,224,43,
+230,57,162,29,184,18,78,197,19,109,222,178,237,58,120,60,76,208,3,213,222,139,150,64,143,131,41,167,167,88,164,21,12,35,137,12,166,165,47,40,
+54,145,130,227,136,185,67,142,249,72,134,114,23,151,129,148,139,96,75,7,249,43,2,104,53,16,32,183,140,16,31,21,9,141,42,169,17,30,104,201,
+144,57,29,167,217,81,74,221,200,38,139,241,238,255,255,180,197,66,255,255,255,255,156,95,255,216,27,199,206,119,63,37,143,158,159,191,230,144,120,177,
+40,189,121,32,203,159,149,3,114,38,105,56,203,6,74,136,15,155,68,52,59,190,58,153,190,32,56,151,149,120,191,167,200,112,53,216,139,34,248,221,
+129,73,235,142,1,124,137,96,107,133,144,62,148,113,121,175,50,237,186,227,0,169,97,221,142,49,53,133,82,32,147,67,194,158,148,1,69,0,221,210,
+244,175,29,87,243,54,255,255,114,175,33,223,255,255,255,1,95,254,12,91,102,130,30,171,93,249,254,109,30,110,62,61,216,53,220,208,62,89,152,128,
+28,176,71,225,76,58,170,12,66,195,198,198,12,146,190,12,30,78,200,138,1,105,10,22,206,14,100,144,209,60,167,47,24,163,71,14,112,155,13,176,
+151,17,129,97,33,0,63,0,19,50,59,181,254,89,21,92,71,210,140,51,241,40,77,19,18,135,203,28,79,37,143,162,234,58,7,214,55,31,235,17,
+255,255,20,111,255,220,71,255,255,227,111,255,249,112,127,138,255,188,165,4,215,135,145,183,36,94,239,217,14,230,12,163,50,0,15,56,217,31,156,254,
+152,246,64,7,18,108,66,120,79,101,184,129,33,128,93,99,62,92,34,38,173,35,237,4,212,44,129,249,167,41,152,153,18,248,106,15,249,91,25,186,
+63,25,121,180,3,40,42,151,241,168,157,49,179,140,49,38,129,137,175,139,147,231,174,21,36,96,189,77,246,66,136,61,45,191,250,10,127,254,152,95,
+255,255,227,255,255,177,175,255,168,7,254,51,255,229,5,241,183,217,80,198,162,203,168,117,32,240,160,66,152,181,2,108,57,14,142,139,16,3,166,115,
+200,189,177,174,139,192,86,138,216,212,134,137,253,130,106,1,146,248,112,175,57,74,58,233,163,44,72,241,23,24,172,18,105,155,31,122,236,41,171,18,
+29,89,143,3,88,44,136,64,166,132,120,28,150,104,50,144,138,33,147,164,133,219,250,150,238,113,43,254,33,159,255,167,247,250,160,127,255,255,254,29,
+108,109,251,101,127,158,191,251,200,127,22,63,154,38,63,176,254,114,34,173,144,0,84,42,113,215,38,16,17,68,121,138,104,101,9,216,210,49,74,18,
+26,184,92,28,232,114,48,89,16,56,120,142,36,105,43,131,154,115,141,18,40,136,241,3,132,0,147,145,49,126,171,194,193,186,98,202,172,65,145,145,
+176,178,133,241,83,143,82,205,152,35,54,133,1,99,169,25,86,69,37,43,160,231,238,245,255,255,47,195,5,255,255,255,253,176,127,244,238,111,190,198,
+191,173,247,236,135,249,60,118,47,218,9,53,219,240,171,26,24,1,226,32,36,108,72,100,66,79,2,230,69,131,51,24,164,2,8,136,225,255,136,163,
+70,152,116,48,78,65,229,196,96,242,199,20,57,200,124,38,193,4,80,196,8,11,193,212,203,142,157,137,149,5,120,16,44,207,10,12,102,14,68,180,
+156,101,73,163,78,151,143,122,6,5,62,138,160,68,86,255,198,11,255,255,92,207,254,66,63,255,255,247,173,255,255,53,15,240,77,199,131,60,79,34,
+255,148,71,101,62,103,210,207,164,208,230,200,120,217,233,164,189,115,198,54,85,84,30,193,51,68,99,121,38,130,171,6,146,125,12,244,175,20,103,125,
+48,71,219,35,5,87,2,98,167,6,209,233,17,34,127,41,226,11,30,0,158,15,243,172,51,52,70,48,114,118,32,112,248,48,146,40,108,245,56,148,
+171,63,73,244,234,154,28,16,208,61,81,63,240,86,255,255,165,199,255,255,222,215,255,252,205,255,255,223,155,255,207,47,250,52,101,66,141,123,139,102,
+215,179,228,73,104,56,38,49,32,38,122,35,53,13,113,156,6,56,198,114,113,192,62,4,96,190,20,228,218,16,38,138,62,35,130,145,32,216,186,161,
+244,151,96,92,90,224,18,66,34,128,80,37,184,79,37,148,21,161,92,57,2,170,80,3,46,36,129,234,7,227,186,23,139,6,127,145,227,101,105,142,
+167,180,20,199,81,155,238,121,255,242,202,255,248,230,127,255,255,254,61,62,60,127,254,138,95,254,236,255,249,227,75,252,40,120,67,0,89,99,206,104,
+117,90,152,248,15,72,194,156,0,153,229,168,190,178,32,80,53,184,41,113,190,31,112,68,52,208,74,73,16,53,65,81,217,37,147,55,17,243,23,12,
+242,27,6,145,149,13,33,215,36,97,225,40,0,177,17,192,254,5,177,90,8,80,3,1,1,123,10,16,209,63,50,68,131,42,136,73,77,39,160,154,
+62,12,247,208,43,255,253,38,190,139,95,255,255,255,226,34,3,253,161,61,52,191,230,155,255,137,215,244,171,249,100,100,23,68,192,108,103,128,12,144,
+225,109,201,80,50,84,41,6,3,69,152,140,21,39,137,100,88,6,100,42,201,4,63,78,124,47,81,28,64,78,180,102,202,108,112,198,148,95,66,140,
+83,194,160,91,71,96,81,199,248,18,195,248,51,0,40,44,128,184,61,68,16,176,66,232,165,72,92,8,25,68,193,33,30,99,77,206,12,135,199,244,
+164,255,255,221,35,216,71,255,255,255,252,64,222,127,255,222,243,202,215,142,175,237,245,249,235,253,60,184,87,231,124,178,114,234,52,154,173,54,205,219,
+28,150,127,6,34,177,1,200,30,131,24,11,96,234,0,133,146,2,71,138,28,102,170,71,36,206,93,99,146,83,227,38,50,227,58,4,35,166,43,131,
+218,73,194,242,67,192,178,35,65,28,12,128,48,26,131,198,63,200,62,71,201,46,3,132,234,117,32,136,191,97,100,144,100,178,54,31,226,221,255,255,
+205,27,255,252,108,127,255,255,226,91,255,255,240,242,255,233,71,208,106,243,92,223,252,39,179,79,198,241,8,98,72,32,51,44,88,187,182,67,118,222,
+206,103,28,67,79,68,1,45,22,1,241,18,36,73,28,230,29,27,134,43,7,132,191,16,115,25,26,18,49,14,178,53,12,98,199,41,195,33,57,98,
+143,49,193,43,28,224,27,15,96,147,23,34,193,46,165,119,60,102,163,38,133,53,12,210,177,50,81,241,31,53,67,146,87,255,31,15,255,248,175,127,
+255,255,235,139,255,244,255,255,255,232,165,255,252,53,255,212,227,103,113,198,167,147,61,196,120,188,137,129,128,144,160,52,36,104,173,117,14,111,89,40,
+36,74,152,15,248,189,14,248,85,32,168,224,53,25,81,60,24,255,50,8,44,32,248,106,148,200,72,146,200,137,24,121,151,29,234,51,26,217,252,15,
+185,66,5,216,176,7,104,204,23,249,141,48,26,69,63,250,15,59,120,207,41,232,101,159,168,30,183,206,184,159,255,160,183,255,82,47,255,255,255,241,
+16,31,48,63,255,135,119,255,227,27,255,175,87,218,239,135,66,139,182,144,82,204,233,101,108,212,149,177,148,31,225,116,120,195,49,122,34,249,60,160,
+219,2,80,43,24,18,7,4,245,21,23,102,231,28,102,77,8,132,43,13,146,59,16,17,153,6,162,69,42,99,69,67,195,81,66,2,45,42,192,205,
+18,160,145,14,2,63,34,133,85,63,199,249,70,200,32,149,3,45,129,18,53,130,171,14,250,23,127,255,205,107,119,47,255,255,255,241,33,183,255,233,
+61,223,179,254,135,63,243,248,252,208,252,179,173,59,102,134,35,191,68,155,116,64,158,14,48,140,195,21,96,106,39,131,12,4,97,4,22,2,179,40,
+36,213,23,164,27,24,177,193,68,176,61,76,240,131,51,113,191,15,178,111,4,97,137,1,176,178,23,18,214,35,51,88,25,50,26,2,144,48,10,128,
+211,5,240,7,52,210,2,103,115,56,120,210,30,94,208,141,50,114,109,29,95,214,163,255,255,139,71,247,223,255,255,255,255,16,72,31,255,254,154,223,
+12,253,199,254,193,94,175,189,130,169,207,82,228,53,174,132,52,115,244,169,174,146,210,219,178,162,98,183,80,99,151,160,150,151,34,52,162,67,167,162,
+163,200,144,82,176,136,25,133,148,25,32,141,185,128,131,242,3,147,65,243,149,128,243,138,192,55,3,121,51,13,137,142,16,57,60,13,56,131,9,216,
+30,141,72,46,155,248,142,52,217,229,71,253,157,168,22,251,18,233,222,35,255,190,55,255,163,247,255,255,252,18,127,252,252,255,255,216,219,254,238,254,
+63,76,122,62,135,144,110,4,192,123,139,232,44,180,138,122,252,66,165,143,133,212,96,104,52,176,235,192,51,161,100,14,4,66,9,5,126,38,164,102,
+86,35,114,98,36,22,62,230,118,7,201,114,85,139,94,137,138,226,145,135,238,115,3,226,69,128,154,34,128,120,26,65,34,42,4,94,60,135,82,52,
+71,174,8,164,46,122,34,157,0,117,2,152,107,180,71,199,237,205,255,252,32,167,37,255,255,255,237,175,213,203,242,36,252,61,253,29,183,119,225,61,
+151,255,13,108,33,244,116,129,76,160,10,240,8,37,168,200,53,92,122,121,147,47,75,101,28,41,101,18,120,69,22,56,19,34,152,100,46,136,178,49,
+232,150,40,232,2,149,200,222,128,81,139,145,81,184,152,193,95,151,0,188,144,160,58,139,240,60,141,160,237,150,162,38,162,115,98,168,147,252,161,35,
+129,138,34,12,148,24,74,170,248,178,0,175,252,220,191,255,166,23,255,208,87,255,255,235,191,255,237,161,237,15,116,33,45,70,124,131,51,189,236,217,
+194,119,176,214,73,186,92,58,12,103,135,48,117,151,192,93,214,144,106,76,80,58,194,16,58,194,172,143,65,13,27,68,49,158,73,33,218,74,185,179,
+72,41,56,195,96,161,192,196,37,66,4,25,128,8,22,4,64,20,199,168,56,71,48,37,192,168,54,11,60,194,24,213,56,33,46,167,16,235,60,7,
+87,21,36,249,6,52,167,196,75,255,232,113,255,194,131,255,255,255,109,63,199,7,255,154,55,254,5,63,230,21,246,139,239,101,9,208,133,198,43,4,
+158,48,216,69,234,145,26,186,156,22,171,95,4,145,205,3,97,123,12,153,138,27,217,58,32,24,74,24,41,8,137,122,66,132,82,236,139,98,218,139,
+82,57,135,129,97,132,32,172,132,240,92,139,48,138,149,193,19,159,209,163,163,129,215,155,113,106,135,0,123,146,248,120,40,56,234,48,152,163,43,24,
+21,158,216,142,160,255,179,7,255,252,179,143,163,255,255,255,252,65,10,127,244,168,182,151,242,49,255,146,199,248,235,254,229,157,245,245,80,27,176,94,
+159,66,224,212,104,245,98,96,17,107,12,17,8,72,33,41,40,123,106,132,195,169,180,213,165,240,177,160,128,114,228,82,59,102,226,27,102,214,18,100,
+242,20,226,86,21,224,50,10,96,148,18,0,94,62,66,242,110,198,38,143,72,130,138,136,234,92,135,122,22,133,130,37,164,218,55,38,174,20,106,74,
+49,77,238,171,95,218,243,255,255,124,79,255,193,183,255,255,255,151,255,255,255,174,215,251,38,133,103,192,51,240,171,252,153,60,185,122,201,81,206,134,
+192,108,169,6,20,160,2,188,191,64,82,158,64,208,47,5,44,94,105,88,202,42,56,236,231,60,207,162,84,150,225,242,100,164,6,72,227,170,64,225,
+194,64,32,144,58,226,68,42,34,196,13,33,232,22,128,18,58,2,154,79,132,186,76,133,202,46,133,194,3,69,150,27,38,166,16,42,50,51,143,238,
+166,83,81,208,243,255,151,7,255,246,74,255,255,255,224,27,255,247,77,255,255,243,20,255,251,212,254,128,140,31,67,30,22,89,11,232,93,2,249,232,
+15,12,70,135,214,85,9,199,68,38,177,152,34,202,180,209,28,134,176,156,30,57,107,47,25,41,45,248,79,36,104,114,155,184,179,151,248,103,152,8,
+41,23,200,173,20,88,235,13,72,224,4,248,166,2,0,88,5,176,8,5,144,61,129,112,104,134,136,111,144,168,102,152,136,146,151,201,66,136,234,148,
+150,3,200,251,102,75,255,253,223,190,146,31,255,255,255,226,11,19,185,87,254,128,31,252,7,127,181,23,120,60,101,140,141,136,2,9,235,2,93,241,
+135,40,204,156,240,219,104,85,5,122,196,69,110,84,206,22,175,199,134,21,195,30,68,98,90,90,35,246,74,165,130,58,165,50,61,226,194,79,224,152,
+93,35,68,85,164,72,56,227,212,22,226,216,0,65,220,7,0,236,0,192,34,14,97,34,40,33,106,84,32,54,145,226,80,208,228,228,239,165,204,197,
+51,248,255,163,135,255,235,169,255,254,1,255,255,254,155,127,255,157,7,163,216,62,214,250,31,242,172,55,185,24,41,221,193,35,31,148,4,178,112,230,
+118,89,97,11,169,169,28,81,20,171,146,58,162,226,43,142,209,187,130,9,151,135,57,250,129,10,150,137,98,243,144,50,183,143,113,227,136,112,205,128,
+176,27,3,136,156,3,168,176,1,56,114,1,224,2,132,32,138,131,240,246,128,185,13,140,40,152,158,248,103,53,73,155,66,205,58,158,239,229,53,255,
+252,67,48,172,255,255,255,242,185,210,99,243,232,251,240,250,13,113,39,230,45,172,255,35,44,40,114,178,83,86,92,115,132,109,182,84,87,239,1,11,
+57,185,42,235,12,19,233,26,13,232,87,23,88,104,37,104,150,43,136,71,35,104,162,143,105,200,135,34,147,150,98,157,154,65,251,149,161,19,142,128,
+88,138,48,27,139,0,100,143,161,8,148,209,193,150,130,55,144,242,45,131,81,149,144,8,163,162,152,68,44,24,123,1,55,252,26,191,255,192,51,255,
+224,215,255,255,248,193,255,251,131,123,190,220,136,67,162,47,189,231,30,31,57,174,154,254,19,153,203,233,52,205,112,30,55,96,46,118,162,131,103,65,
+239,53,128,213,13,129,49,5,163,101,27,38,111,57,40,91,164,4,60,206,177,188,69,240,240,195,12,55,71,244,50,135,44,68,130,148,37,130,8,11,
+131,48,31,128,228,107,137,140,210,147,141,33,27,13,38,156,228,209,24,252,67,145,252,64,75,220,105,79,94,231,159,255,40,175,254,202,159,255,255,250,
+82,255,45,127,255,64,143,253,250,127,221,211,238,203,212,129,25,87,7,101,13,39,250,92,102,47,183,20,179,107,172,103,174,48,7,8,144,11,232,164,
+94,233,236,162,232,136,164,99,4,93,165,58,11,204,222,97,80,87,62,167,219,50,37,189,26,195,79,11,129,199,15,161,155,36,226,119,62,67,107,74,
+99,135,60,98,75,19,32,9,35,82,48,82,19,74,104,114,204,99,177,50,78,176,105,59,144,163,80,223,82,207,255,248,64,91,67,255,255,255,252,66,
+74,255,234,113,203,235,253,150,255,242,200,255,99,191,223,131,182,94,101,128,88,45,116,242,103,186,161,30,124,58,128,221,81,2,233,24,134,5,114,21,
+109,231,33,59,0,40,206,176,211,254,147,82,103,139,88,228,158,200,10,161,232,17,24,88,55,138,216,93,131,88,11,7,9,14,21,42,91,38,155,89,
+49,203,117,47,202,137,34,88,255,18,8,114,136,137,55,139,25,23,151,232,91,165,168,99,42,121,85,127,103,47,255,253,82,191,252,51,127,255,255,254,
+44,191,255,254,178,159,212,198,70,127,128,39,234,163,249,252,121,135,244,200,159,60,241,128,53,116,135,209,146,128,229,239,7,237,182,4,228,194,6,168,
+148,84,1,194,91,74,41,172,89,13,51,176,106,240,216,70,80,237,49,208,245,49,144,110,60,146,50,65,243,28,51,82,100,13,112,30,36,226,191,78,
+228,221,93,133,111,77,68,171,42,99,133,9,227,47,0,116,97,19,38,243,60,168,229,181,36,232,114,184,255,225,181,255,253,215,63,255,255,226,159,255,
+254,74,191,255,255,22,111,255,163,255,215,48,78,237,211,196,83,23,92,175,28,30,87,2,215,13,226,61,153,66,223,213,202,5,116,240,122,24,133,40,
+41,144,2,89,70,152,227,96,167,212,54,84,98,26,103,132,227,99,24,140,161,166,47,165,106,30,135,122,81,135,146,101,6,34,95,67,242,74,1,226,
+48,128,170,27,0,134,10,193,74,3,34,90,22,98,226,55,34,30,105,224,68,171,164,44,241,41,37,37,60,135,63,249,241,127,254,196,159,255,255,238,
+135,255,240,169,255,255,125,175,255,9,63,214,58,228,173,71,201,35,166,207,162,135,62,30,189,216,121,227,112,136,107,104,187,198,103,59,72,12,212,202,
+42,243,50,126,183,24,81,178,76,32,114,3,7,37,11,29,230,115,34,198,91,26,37,43,11,163,127,1,209,207,9,144,129,10,16,80,5,176,186,1,
+16,240,1,17,50,9,241,166,27,178,56,50,146,180,72,50,194,83,209,250,77,48,32,48,50,201,2,134,97,71,201,79,250,44,127,254,196,31,209,179,
+255,255,255,252,66,225,242,34,255,235,165,255,247,59,255,230,73,251,241,245,78,21,56,188,240,198,218,79,174,118,145,188,2,40,159,105,35,81,87,227,
+148,19,247,88,82,56,16,52,11,83,48,121,249,37,136,131,25,88,174,143,121,108,137,121,174,134,153,148,132,217,76,130,41,7,130,208,227,138,0,231,
+145,160,250,150,160,249,150,48,193,142,64,61,129,88,138,22,137,116,45,10,60,63,26,156,67,133,42,160,42,80,202,130,30,96,246,91,63,193,67,255,
+253,58,58,181,255,255,255,255,136,95,159,255,240,32,175,7,252,68,127,245,84,255,77,127,206,235,145,237,160,17,9,137,113,230,166,78,127,147,111,192,
+129,186,228,132,71,41,104,35,193,16,85,68,2,85,70,106,55,7,26,16,7,26,13,167,18,25,167,66,19,39,102,3,167,2,10,69,162,11,2,254,
+7,96,188,43,36,232,87,232,148,127,42,164,145,170,56,132,102,228,83,96,248,5,102,134,84,78,14,165,17,239,106,137,147,180,148,139,83,153,171,104,
+13,255,105,111,255,228,113,255,254,70,191,255,255,230,239,255,255,229,29,252,222,228,187,245,82,252,88,127,1,79,8,254,90,146,133,137,129,205,1,220,
+103,13,198,73,198,179,6,66,45,92,33,67,55,65,25,29,97,159,13,98,105,1,98,239,11,178,207,29,113,229,50,208,95,72,17,102,87,50,224,89,
+211,146,75,115,40,44,49,164,0,176,173,46,35,61,85,69,95,106,6,121,101,70,43,69,36,109,14,225,161,50,145,152,113,52,122,143,107,44,76,5,
+184,162,191,223,219,255,220,43,253,212,63,255,255,234,115,255,70,191,255,244,200,255,222,223,214,16,19,235,51,192,163,43,157,85,165,167,90,131,73,128,
+64,108,41,33,21,30,161,4,23,0,204,12,16,192,3,200,243,22,153,68,39,249,125,51,41,105,52,168,231,43,24,1,152,73,41,128,90,73,151,3,
+22,168,19,81,174,98,216,168,49,191,151,16,61,129,25,82,26,42,140,46,27,34,56,122,238,55,57,247,43,72,123,24,41,49,130,122,174,144,243,156,
+155,242,105,255,0,175,255,222,155,55,63,255,255,254,26,190,169,31,180,135,245,191,250,216,111,115,100,161,205,51,228,130,21,229,208,16,166,158,1,23,
+186,29,152,74,27,220,26,16,213,180,142,204,248,8,60,4,128,232,243,73,233,187,208,50,20,40,229,8,83,126,106,177,112,56,177,55,1,131,197,54,
+101,143,89,134,25,99,229,75,85,99,107,50,224,245,5,225,106,38,147,34,72,243,208,91,211,100,93,114,22,81,80,92,61,49,63,39,178,37,37,247,
+48,255,208,131,255,240,36,255,254,237,127,255,252,89,255,252,101,185,4,160,221,243,171,255,141,69,4,241,12,144,189,233,156,126,138,69,134,233,132,100,
+54,141,28,103,113,80,105,56,245,62,204,18,156,85,61,19,44,45,7,4,221,68,185,168,205,2,92,12,208,49,252,78,25,136,72,0,212,64,0,15,
+199,132,150,140,148,253,14,69,24,12,188,236,8,228,142,4,108,28,128,188,77,64,248,155,64,168,200,193,12,218,194,212,227,66,252,238,192,53,101,248,
+76,127,254,68,31,228,141,255,255,255,177,255,174,223,254,144,95,230,15,247,200,232,219,149,1,175,129,141,37,37,163,162,101,146,245,38,163,238,39,207,
+79,44,225,211,60,227,82,35,150,180,101,55,218,129,107,117,63,154,55,49,216,159,30,72,230,138,202,2,132,2,133,140,50,108,141,177,217,138,97,4,
+132,192,47,128,168,121,4,152,211,6,56,221,6,200,173,7,136,99,9,216,26,14,40,25,148,8,53,153,120,80,155,152,137,151,88,239,140,41,200,253,
+188,191,255,225,201,146,159,255,255,255,232,99,255,153,165,129,63,58,63,239,101,252,63,127,38,143,14,126,42,15,98,144,17,222,128,190,86,85,53,209,
+186,157,248,178,70,86,124,10,78,185,2,38,13,67,136,110,102,60,179,166,52,199,100,76,181,225,132,142,225,26,97,162,226,56,99,134,24,99,38,3,
+34,26,10,0,226,17,192,20,20,192,164,19,64,184,10,192,140,6,224,104,36,96,144,75,161,36,120,33,236,158,98,136,179,162,108,170,33,112,135,39,
+173,255,38,79,255,248,195,127,255,32,63,255,255,249,127,255,255,248,226,127,192,173,103,189,10,191,42,127,228,93,248,60,253,66,58,52,240,188,132,75,
+254,42,113,86,210,105,250,109,73,19,186,148,64,230,56,140,110,185,72,50,67,68,214,24,34,178,83,225,178,111,225,130,115,33,166,101,33,198,77,161,
+158,51,97,46,26,96,150,4,160,4,10,192,116,19,64,180,17,192,204,5,64,232,21,33,72,59,226,4,108,227,32,160,164,116,206,229,168,235,230,60,
+235,166,56,204,120,187,127,251,71,127,252,25,191,255,255,243,61,255,249,21,255,255,252,110,63,255,179,175,249,38,88,110,205,254,126,30,174,255,49,47,
+11,191,24,204,254,116,206,125,249,5,5,145,73,43,160,235,184,209,250,181,18,78,167,226,58,151,81,255,135,225,192,131,201,144,138,153,112,140,121,90,
+138,105,72,133,89,50,129,1,23,135,128,244,140,224,206,144,16,163,144,64,116,140,224,59,133,128,12,5,104,100,19,104,209,35,25,74,50,185,201,64,
+45,29,34,82,161,81,93,87,102,245,246,206,255,254,54,30,148,159,255,255,255,216,118,60,159,255,118,15,255,229,111,255,214,235,245,29,227,32,31,17,
+61,217,59,39,254,35,216,11,233,17,36,187,36,39,44,46,132,197,38,2,128,122,3,184,20,129,24,32,195,68,59,71,148,73,202,140,87,203,116,104,
+202,20,127,198,124,157,65,68,188,196,192,219,202,200,245,79,217,6,83,57,9,212,48,252,82,104,219,205,224,168,70,232,98,193,252,13,203,204,79,21,
+124,171,29,204,255,33,230,161,209,139,93,99,1,255,64,15,255,226,221,252,127,127,255,255,253,92,127,253,23,53,230,255,77,255,249,16,127,2,191,142,
+102,154,182,40,4,65,56,131,209,52,198,192,128,96,40,21,43,180,7,7,228,6,133,100,21,228,44,68,163,224,121,100,24,168,100,108,200,164,136,210,
+228,44,197,35,60,159,161,172,102,160,102,33,34,218,40,133,102,109,135,210,165,9,202,199,139,14,208,139,126,191,10,254,149,9,150,87,199,126,16,4,
+218,58,97,246,125,160,244,178,99,188,208,101,129,35,207,255,52,143,254,45,223,255,251,170,255,255,203,87,255,250,75,125,186,71,87,137,199,28,222,89,
+88,40,225,184,208,242,126,28,152,16,4,219,216,8,75,199,14,59,111,17,138,172,16,57,139,10,152,45,1,153,62,136,226,137,147,99,141,156,52,21,
+81,2,20,169,1,0,180,60,105,179,114,73,18,68,32,48,188,4,192,247,40,130,159,68,196,17,86,197,43,93,5,209,87,5,249,70,133,159,45,132,
+201,14,227,141,16,242,13,46,208,95,68,208,218,61,95,231,5,255,254,69,223,129,15,255,255,254,124,191,231,197,160,215,198,191,221,195,140,46,61,9,
+110,109,12,44,67,113,62,36,152,26,1,26,177,19,209,18,36,208,96,174,81,119,175,146,33,169,18,90,156,178,48,140,81,178,133,168,249,151,24,34,
+165,248,182,48,169,117,54,26,1,53,234,73,48,42,64,37,169,233,23,185,70,7,168,106,8,144,150,151,113,162,163,114,153,171,3,94,173,211,224,171,
+132,3,82,25,229,76,105,151,69,73,26,65,196,163,88,235,255,139,23,255,237,33,255,255,179,143,255,255,116,159,255,251,79,127,172,62,9,152,19,114,
+121,241,90,228,215,202,178,233,56,8,38,107,220,16,113,80,42,240,17,48,80,82,167,224,61,152,64,5,6,112,67,9,184,96,21,232,82,28,184,21,
+29,152,73,153,40,192,144,41,61,132,105,173,136,82,3,148,34,46,157,2,41,161,209,241,161,113,136,155,160,245,144,144,68,129,96,123,16,137,57,35,
+89,227,52,154,101,65,53,90,162,190,178,81,153,83,8,100,164,51,94,241,242,255,252,71,191,229,65,255,255,255,240,69,253,26,255,255,235,77,255,253,
+18,255,240,4,242,229,113,108,30,182,43,239,69,198,207,172,118,101,186,222,74,142,172,198,178,208,67,68,50,8,164,51,106,68,106,41,32,125,230,76,
+122,98,192,105,32,182,82,99,122,59,229,50,41,165,178,30,164,250,27,35,70,30,224,238,40,33,172,52,228,24,65,165,224,74,230,172,77,166,76,72,
+100,168,57,97,220,32,33,226,2,6,46,43,10,166,88,78,178,132,80,237,85,168,220,179,114,239,254,137,95,255,199,152,2,255,255,255,255,196,8,167,
+250,136,127,210,75,255,244,29,255,249,75,127,202,255,239,133,143,25,227,90,235,8,254,96,154,198,243,168,203,119,108,170,161,224,20,235,113,72,37,243,
+116,19,129,17,53,164,47,67,5,247,64,38,157,50,134,87,30,229,105,10,4,21,8,18,163,20,241,67,27,80,39,26,176,150,20,112,230,9,176,202,
+2,160,88,14,32,83,22,129,23,25,161,197,22,34,55,11,66,73,6,49,237,29,49,17,55,208,64,83,145,254,107,147,188,68,47,252,153,191,254,72,
+31,253,145,127,255,255,241,251,255,255,94,73,187,255,18,223,252,150,63,232,75,254,36,31,40,126,205,17,251,73,9,71,71,15,69,139,195,237,109,127,
+61,37,170,251,128,148,113,229,48,186,170,64,73,224,144,15,199,26,78,12,110,113,15,82,124,15,238,115,142,170,93,203,246,64,8,98,32,4,138,2,
+192,234,21,162,12,38,36,0,46,164,216,47,228,136,43,163,72,36,33,72,27,161,2,21,163,54,20,36,230,24,229,186,37,37,106,56,99,170,86,224,
+227,196,99,255,234,169,251,167,127,255,253,57,127,253,157,255,255,213,67,253,60,227,49,214,203,229,207,249,21,124,77,253,178,55,223,213,81,172,218,169,
+112,141,118,163,145,35,192,170,115,120,3,78,230,182,82,75,144,83,249,174,146,154,140,209,55,145,56,10,41,25,19,57,9,206,64,61,28,160,2,149,
+14,42,138,11,14,111,199,42,75,195,22,33,128,176,9,227,196,49,165,192,82,230,144,106,166,44,119,164,192,121,34,152,113,32,16,96,162,102,74,164,
+102,51,37,62,48,160,247,251,36,127,255,50,110,218,127,255,255,235,127,148,71,249,57,127,142,255,200,154,186,162,191,137,118,64,252,84,50,81,216,210,
+130,183,36,72,119,160,32,225,30,108,227,209,140,67,142,201,178,27,113,196,137,219,248,65,237,87,27,124,154,18,196,33,200,252,201,192,217,78,201,153,
+164,208,129,201,101,169,243,120,173,51,7,170,194,83,163,49,121,151,112,144,136,224,73,6,232,255,22,25,125,35,57,189,44,249,188,50,73,128,50,185,
+23,46,72,145,37,72,28,34,60,12,191,246,170,255,251,252,127,255,176,143,255,254,178,191,254,88,155,215,208,111,138,118,169,57,184,65,93,223,12,40,
+21,226,60,114,242,206,60,88,210,18,59,112,1,57,183,15,160,4,156,225,137,165,34,177,167,163,105,164,211,169,157,147,119,146,242,225,134,114,0,134,
+120,244,146,136,35,28,105,37,35,89,243,38,202,120,38,138,163,34,202,111,27,233,228,19,25,19,8,248,17,1,65,3,138,210,12,146,146,234,152,51,
+133,155,35,202,155,99,167,154,67,162,241,164,255,253,8,191,200,67,255,255,255,161,223,204,183,255,226,189,255,167,255,234,77,186,91,231,59,148,30,239,
+205,29,27,82,47,108,156,133,181,143,7,168,191,14,168,55,143,192,16,76,88,42,70,32,37,65,76,15,200,148,10,142,132,33,146,124,49,147,252,52,
+146,244,43,143,188,23,10,188,7,68,212,42,65,80,80,70,200,113,202,224,139,205,8,154,204,232,154,202,128,140,69,248,107,192,68,61,199,92,5,206,
+164,59,21,76,124,154,108,187,28,244,247,151,47,241,90,255,255,87,42,154,255,255,255,255,90,223,250,109,125,75,63,247,45,255,224,205,254,132,191,146,
+231,44,220,24,1,152,125,234,53,14,252,45,163,119,120,231,215,162,242,159,194,136,187,212,112,82,200,200,27,192,16,14,69,196,30,72,244,64,73,220,
+102,73,28,133,199,52,152,196,180,153,66,44,136,64,0,105,65,152,63,194,88,20,194,80,17,129,128,45,0,40,55,1,84,43,130,172,9,131,116,43,
+67,140,112,66,132,190,192,101,14,194,225,88,199,57,136,77,104,123,63,233,133,255,253,63,191,254,35,63,255,255,252,177,127,255,251,41,124,33,125,32,
+255,227,101,255,97,95,249,82,127,12,191,185,23,57,61,121,151,37,71,156,193,16,106,205,9,91,144,71,94,197,81,119,158,84,22,225,176,224,171,180,
+183,38,96,147,162,8,118,33,26,94,99,10,74,163,234,57,99,226,42,35,58,27,162,46,14,224,254,4,96,20,3,192,224,7,65,92,5,193,112,0,
+225,44,13,224,184,32,96,60,56,96,26,83,96,30,111,224,72,139,97,68,164,227,12,185,39,1,137,167,255,197,75,254,197,223,255,255,167,191,255,244,
+167,255,255,248,156,127,251,46,246,208,216,59,237,31,253,115,63,143,175,242,74,250,73,252,131,57,91,241,120,156,141,17,130,244,184,24,32,212,227,60,
+227,178,230,137,140,169,36,39,22,233,15,190,20,103,87,210,23,232,136,243,165,168,203,35,112,160,97,232,118,32,252,78,32,140,42,224,108,13,224,116,
+7,192,112,20,192,88,25,0,12,20,192,98,8,128,242,10,33,118,33,97,230,58,98,6,84,33,186,107,160,238,127,96,180,155,169,13,243,78,255,254,
+53,9,191,255,255,255,132,44,74,255,255,1,79,255,164,79,251,235,117,43,27,237,197,187,19,252,84,189,36,254,48,29,234,124,156,55,49,226,229,108,
+28,54,30,190,45,68,170,109,2,192,40,167,128,151,170,32,228,235,61,10,85,176,138,234,186,69,181,70,33,242,150,16,25,68,134,243,62,165,167,56,
+196,79,50,163,11,43,225,241,35,193,13,25,224,105,14,192,15,2,160,10,9,240,19,21,240,89,32,48,181,39,145,23,42,209,115,41,81,173,32,146,
+229,133,39,253,209,191,254,158,223,254,244,255,255,255,15,127,250,70,108,45,252,174,255,172,23,209,255,183,68,168,76,130,124,148,17,218,75,31,62,49,
+217,68,240,66,194,79,77,10,208,224,241,40,217,248,61,235,209,42,105,223,26,40,55,12,169,33,129,90,40,136,98,224,144,211,77,151,243,101,157,163,
+52,158,130,180,155,177,253,150,33,45,142,128,94,133,208,85,2,248,221,11,41,42,17,201,55,22,121,9,24,184,166,24,136,35,22,40,107,146,56,235,
+141,121,69,136,9,101,142,110,179,223,255,92,143,231,217,255,255,229,219,255,232,111,255,219,122,246,126,243,63,227,9,253,248,127,132,199,163,207,14,164,
+211,19,220,13,47,111,197,243,67,222,66,89,53,235,89,90,27,156,64,206,20,198,254,97,64,62,36,35,148,120,100,208,159,100,12,161,33,248,134,32,
+198,89,99,134,37,229,182,11,71,6,49,199,58,73,134,110,80,68,198,70,2,138,44,192,2,7,194,108,35,164,136,81,166,24,124,231,0,161,39,28,
+185,38,128,195,37,64,189,35,148,168,97,204,132,96,50,103,126,239,95,255,202,114,54,31,255,255,218,87,200,47,255,130,151,226,6,30,94,118,95,141,
+191,241,96,252,28,126,139,28,251,246,232,108,148,218,129,19,55,222,242,108,56,171,78,198,221,209,87,147,178,242,170,209,52,132,144,64,26,89,67,47,
+201,209,59,25,239,61,9,183,55,73,68,43,168,177,29,8,33,13,232,84,128,168,155,136,176,172,141,64,135,140,128,52,134,224,60,2,200,190,15,89,
+65,29,105,187,43,90,25,55,58,83,63,154,95,65,133,29,32,62,123,78,14,80,6,91,253,129,63,255,159,199,229,215,255,255,253,185,251,96,127,8,
+175,228,115,220,80,168,183,25,248,170,124,186,255,2,15,104,255,100,78,20,251,206,72,142,75,193,228,30,14,212,138,113,162,98,56,89,44,202,234,29,
+233,13,10,184,216,136,50,122,151,211,172,162,164,43,212,18,30,170,25,4,116,140,109,211,168,79,146,140,47,113,122,18,144,156,2,224,10,14,224,41,
+15,160,1,6,0,116,12,145,44,38,18,12,67,19,0,96,19,226,120,212,148,132,202,122,67,189,62,160,158,120,65,65,255,181,103,255,217,211,255,242,
+79,255,255,241,31,255,187,20,221,62,121,255,37,237,110,210,139,14,110,22,254,175,158,95,255,15,47,2,95,41,77,209,248,62,85,54,204,73,202,200,
+1,84,27,6,152,64,167,8,91,36,36,73,32,146,28,229,226,27,74,202,82,142,142,128,144,97,80,40,82,171,164,6,85,105,183,83,1,75,79,56,
+213,202,224,106,198,176,23,67,16,26,128,128,38,0,220,11,0,236,49,64,80,135,66,168,235,69,209,78,201,57,162,76,113,215,79,17,214,204,162,61,
+95,255,94,175,252,3,191,255,254,81,63,255,11,95,255,72,78,241,118,23,242,16,236,187,189,35,0,145,14,71,218,47,247,146,231,135,229,85,204,63,
+184,70,188,124,3,46,59,129,100,48,226,72,127,103,144,35,32,136,1,131,22,5,99,250,40,162,214,90,160,106,142,162,144,186,101,148,215,168,24,226,
+105,204,217,42,104,189,105,228,148,168,132,103,102,136,58,228,44,21,97,192,4,192,110,16,194,54,15,67,106,0,35,222,25,227,150,58,98,158,91,225,
+42,120,32,196,134,33,209,199,35,255,251,158,120,165,127,255,255,226,31,221,103,255,140,135,242,61,199,250,148,219,124,244,188,206,31,3,225,135,21,123,
+127,89,175,135,230,160,253,20,54,37,229,57,156,254,185,151,61,189,132,162,99,92,206,233,40,110,97,136,51,163,70,26,101,134,27,165,146,47,35,242,
+76,33,70,106,225,216,132,100,216,148,39,60,150,232,160,139,104,216,116,231,248,87,38,40,54,35,156,21,224,168,6,66,98,27,5,50,39,135,122,43,
+137,6,39,201,166,29,73,70,14,199,166,0,226,155,247,128,255,255,103,238,88,63,255,255,253,36,254,135,95,148,119,244,11,247,114,151,202,206,233,233,
+165,143,13,11,124,220,0,142,201,114,54,207,223,141,165,144,245,50,194,190,94,152,152,6,227,57,88,154,131,72,206,2,77,178,113,135,226,3,227,118,
+85,96,150,130,32,212,140,33,0,121,160,64,82,33,14,31,98,154,21,132,2,67,68,250,98,69,90,110,133,10,102,4,38,75,2,206,32,65,22,21,
+160,204,80,162,176,138,36,116,188,101,236,224,231,4,244,167,180,237,39,164,42,63,241,4,255,254,249,159,253,104,255,255,255,222,159,255,226,248,147,190,
+151,255,28,238,61,52,82,100,137,223,237,17,148,158,238,214,23,193,105,79,219,200,226,6,22,65,79,43,87,169,107,215,242,116,52,56,148,204,68,32,
+250,170,11,202,51,134,138,50,33,242,125,97,168,170,100,16,184,229,80,173,37,108,139,100,164,92,227,56,41,97,128,5,64,34,40,1,118,57,66,58,
+55,2,106,34,129,250,2,224,234,52,96,160,108,34,140,163,164,164,212,230,196,249,168,193,2,85,32,66,175,255,28,47,255,141,151,255,255,112,127,255,
+252,140,127,255,226,181,252,158,202,187,132,119,27,189,142,156,148,70,42,29,87,125,198,178,3,223,162,243,185,157,71,206,137,199,110,171,194,232,9,233,
+152,133,108,72,196,171,140,208,168,100,182,163,228,132,160,250,71,37,106,7,232,238,48,139,42,93,140,6,122,139,154,135,138,26,131,199,210,113,197,54,
+86,194,194,55,64,210,24,64,80,1,224,132,21,32,46,30,33,190,28,227,218,17,38,78,3,200,190,32,10,210,66,203,202,123,88,56,127,254,184,31,
+231,133,255,255,255,162,191,249,246,255,255,159,215,255,97,255,159,66,152,202,167,61,10,113,204,208,133,142,191,1,43,40,239,153,151,63,23,236,178,247,
+0,191,30,70,211,209,164,227,220,186,50,45,151,17,8,129,200,114,144,88,80,150,8,126,148,168,216,142,105,61,133,121,148,132,97,206,141,145,227,148,
+209,208,153,65,156,154,129,80,152,128,247,147,224,167,141,128,105,134,96,72,128,168,72,134,184,102,139,8,158,141,56,228,141,25,46,138,73,114,132,89,
+133,150,55,142,199,255,249,67,88,155,255,255,255,241,123,206,219,255,160,167,255,170,15,252,60,61,24,235,16,187,16,33,173,226,119,173,115,50,44,238,
+32,214,163,223,115,62,222,80,218,225,241,204,212,31,107,12,167,114,46,186,61,73,39,131,5,232,69,162,114,236,137,65,221,136,73,16,146,216,124,151,
+104,19,151,104,51,20,72,99,15,104,125,10,8,137,5,40,133,1,104,114,0,128,84,0,176,43,0,232,5,131,152,65,134,200,126,138,8,186,140,104,
+240,141,137,25,140,249,43,137,169,11,170,39,234,133,255,254,197,159,163,159,255,255,255,211,23,255,197,115,176,215,253,196,255,240,202,254,72,190,198,22,
+179,92,231,14,70,217,9,9,233,239,55,50,109,220,26,149,250,124,100,127,192,43,83,222,12,26,241,236,229,164,190,91,152,243,217,154,207,241,194,150,
+186,181,58,56,214,31,248,169,136,249,196,138,82,128,153,178,232,164,243,7,171,226,238,174,178,172,173,162,83,169,1,236,161,113,137,152,49,54,142,0,
+245,131,208,201,133,168,167,142,8,141,148,136,115,152,232,84,154,88,27,150,77,13,63,226,33,255,253,42,63,255,155,239,255,255,250,48,255,255,233,109,
+234,43,228,223,254,17,95,217,231,245,170,241,141,221,105,142,206,249,206,12,22,48,67,62,178,198,200,22,113,8,112,186,210,80,183,7,107,194,226,149,
+135,158,9,88,74,215,106,218,242,148,161,123,122,68,4,217,22,148,11,9,92,162,194,193,42,205,81,140,85,201,199,91,201,224,223,57,220,224,0,224,
+111,20,199,236,252,170,106,32,139,102,200,109,163,80,82,224,18,59,35,18,37,165,146,17,39,98,2,8,62,22,70,47,181,135,255,68,79,255,30,175,
+255,255,229,95,255,253,87,127,255,251,246,127,231,3,53,238,172,158,115,61,127,35,126,82,58,176,113,67,243,210,237,107,229,117,193,231,138,37,114,107,
+224,132,42,80,46,193,56,86,64,126,24,194,112,86,231,44,202,107,73,14,86,126,141,74,223,66,44,236,24,44,59,11,76,125,66,25,29,205,201,141,
+86,33,187,89,225,159,88,121,65,82,232,190,202,232,53,194,32,68,6,68,158,141,52,207,17,244,209,147,244,165,18,252,86,15,228,6,75,132,93,70,
+148,154,67,36,21,61,33,63,253,250,63,105,15,255,255,254,197,127,140,159,255,252,231,63,254,58,127,114,96,239,195,175,104,8,201,133,102,72,220,29,
+125,168,189,87,254,156,94,170,126,245,29,41,122,9,97,183,122,38,135,90,64,108,14,83,222,68,52,142,84,147,126,77,113,160,59,144,67,41,17,147,
+28,178,19,23,145,221,23,177,33,26,176,43,29,112,194,29,81,104,25,81,166,17,81,122,7,112,250,1,224,72,9,96,133,13,129,77,13,129,243,9,
+34,95,0,194,133,9,178,105,20,82,33,28,209,165,32,81,115,63,143,172,55,255,230,65,29,207,255,255,255,197,127,133,215,255,137,23,255,192,87,252,
+182,55,193,7,251,205,76,13,250,160,169,99,126,191,93,212,254,59,158,165,191,29,15,7,223,11,237,110,243,222,141,235,158,4,1,125,189,212,126,231,
+93,91,122,86,90,30,103,20,239,128,132,115,81,33,138,194,240,174,200,52,7,143,188,143,147,132,227,19,197,2,145,4,239,12,12,183,134,100,111,1,
+60,34,130,192,38,197,64,101,198,24,148,197,56,175,194,248,182,64,60,170,67,156,147,70,132,116,200,68,76,73,198,29,223,190,103,255,242,10,250,213,
+255,255,255,252,187,127,247,222,249,99,127,228,11,254,160,94,109,114,66,155,37,163,242,124,113,51,236,154,21,96,249,7,111,231,221,115,134,79,53,172,
+145,241,158,130,170,251,14,114,110,200,122,166,247,126,201,23,24,236,238,240,72,199,6,137,21,91,111,167,245,25,34,143,50,82,34,106,85,170,133,171,
+228,68,238,10,208,53,117,102,3,84,195,81,44,128,169,3,193,146,32,179,36,61,19,236,78,243,220,84,178,254,78,17,140,63,48,21,44,17,153,23,
+242,177,4,211,31,181,167,250,31,127,255,10,239,255,145,79,255,255,252,159,255,255,202,10,122,191,118,95,225,165,232,207,115,40,162,100,143,212,27,119,
+158,23,212,17,149,17,78,19,109,33,162,111,112,72,150,204,185,22,206,232,159,146,198,37,84,9,176,102,30,56,29,101,63,115,108,55,102,245,74,54,
+68,115,16,194,25,180,41,53,199,241,114,73,20,197,66,83,177,168,138,60,15,26,125,107,141,188,169,129,44,24,201,112,195,80,217,65,212,89,138,83,
+185,147,79,9,98,71,217,14,64,28,169,199,116,68,76,204,19,11,255,81,47,252,191,63,254,110,159,255,254,122,255,255,250,16,255,255,230,65,251,240,
+200,39,210,227,179,14,20,205,153,150,175,151,55,152,47,197,179,194,55,197,139,76,253,9,32,27,6,128,170,24,227,212,5,210,134,17,97,89,65,165,
+233,112,200,208,195,2,110,112,124,151,59,44,65,212,194,19,132,42,195,181,6,74,233,174,214,74,7,46,117,5,151,108,113,22,58,76,244,40,34,241,
+184,5,32,187,38,66,221,60,68,113,68,133,73,62,165,83,43,228,161,17,131,133,9,210,59,34,144,231,50,240,42,24,190,125,31,254,111,95,247,92,
+255,255,255,197,191,255,4,95,255,248,211,127,228,203,172,213,223,53,219,198,168,87,170,59,224,9,232,195,247,134,249,108,253,187,61,14,253,3,55,73,
+215,178,80,177,206,22,177,172,53,98,139,72,99,211,54,3,91,18,226,51,16,81,39,40,48,177,47,208,225,40,49,137,22,146,91,0,19,23,21,99,
+117,36,163,83,86,137,45,234,144,108,78,140,233,206,132,39,34,124,101,14,124,100,46,137,229,14,169,103,230,220,236,183,18,184,204,208,30,173,55,77,
+197,207,43,125,78,117,239,210,198,230,31,255,229,101,255,255,237,237,254,143,63,245,193,233,245,252,249,241,249,206,55,199,254,183,250,234,236,14,97,125,
+23,231,1,205,183,50,12,230,116,230,126,156,230,144,99,23,75,20,94,35,83,75,10,112,248,167,231,26,202,1,111,145,47,108,249,163,89,110,7,234,
+140,82,220,35,225,162,0,240,109,26,88,164,172,201,123,182,42,12,183,74,85,178,58,88,169,154,47,159,233,244,151,233,202,147,185,211,149,74,38,157,
+218,213,173,219,226,194,54,82,115,255,175,45,243,113,125,206,103,77,253,187,113,185,232,77,255,255,206,155,255,254,26,31,254,136,191,99,188,39,191,169,
+220,230,247,225,241,69,137,95,82,185,194,213,127,19,242,142,203,134,172,214,115,201,41,97,114,238,81,108,84,45,245,109,173,167,40,197,204,218,72,29,
+35,161,73,203,57,230,182,116,111,12,33,152,202,65,202,92,123,71,208,48,100,236,179,225,241,3,176,127,138,24,238,195,108,193,93,212,244,86,61,18,
+78,109,34,200,13,50,196,133,76,196,245,123,201,253,199,211,150,27,240,53,153,237,9,236,63,131,30,41,250,61,232,195,189,125,115,126,160,95,255,255,
+124,207,255,2,111,255,214,79,15,80,251,254,6,241,91,229,123,224,138,177,254,126,33,127,197,44,222,100,74,194,102,12,157,51,148,4,75,200,62,246,
+7,215,216,183,214,209,212,214,229,201,40,206,137,208,162,229,72,236,219,35,53,86,7,12,21,24,69,74,48,4,86,42,19,50,110,145,228,140,56,57,
+73,92,71,99,38,81,175,134,118,106,230,144,38,74,162,34,158,176,224,162,193,96,246,215,227,230,249,105,71,21,184,33,206,22,143,246,53,195,223,19,
+157,74,244,45,223,246,31,63,228,53,255,255,252,230,191,18,143,255,223,133,81,179,91,251,237,198,223,169,239,90,20,247,247,67,108,239,43,24,96,108,
+98,222,208,7,92,35,192,115,9,192,76,10,239,87,236,194,75,72,139,229,111,105,95,238,23,19,234,220,250,65,89,193,65,162,200,13,205,5,5,110,
+39,67,244,42,210,122,105,49,4,135,136,58,198,124,122,97,186,100,174,82,129,233,250,149,101,182,161,226,110,172,224,210,187,161,126,209,228,186,244,234,
+71,21,56,101,206,118,160,118,107,197,183,24,93,97,116,123,222,116,179,255,249,116,127,255,255,69,33,26,255,250,105,227,253,229,127,237,171,46,159,5,
+30,7,48,201,244,219,130,103,175,237,225,58,181,224,45,127,155,17,19,45,53,160,217,82,235,210,91,51,55,44,54,52,124,201,179,56,12,185,49,60,
+199,122,202,23,84,153,116,230,160,40,230,202,84,86,197,32,42,224,172,145,226,234,212,37,182,238,39,174,229,40,210,195,41,50,147,169,22,99,232,210,
+63,232,214,49,233,126,65,235,22,116,45,222,198,48,253,140,108,235,234,223,109,156,97,242,55,213,79,84,61,149,86,75,255,245,230,255,255,252,28,190,
+82,127,252,3,116,240,250,139,247,3,160,47,161,174,6,248,146,244,77,39,239,24,187,58,117,89,202,43,37,124,117,19,246,245,142,145,94,76,46,42,
+5,181,197,54,56,180,83,227,137,149,62,54,172,164,86,82,83,94,174,36,87,33,184,215,8,148,120,128,192,27,197,94,52,233,150,114,235,214,154,44,
+94,169,235,150,165,169,250,147,232,22,125,230,122,108,229,174,105,166,38,123,40,50,165,107,234,233,240,149,145,108,245,235,51,119,220,81,243,47,211,15,
+100,253,20,241,56,255,255,193,75,255,255,128,55,253,88,255,179,109,237,191,34,222,34,181,61,248,2,186,31,68,27,173,196,247,100,22,4,214,230,170,
+20,211,163,176,161,64,242,231,73,21,197,232,224,187,27,46,215,82,9,87,112,28,188,182,51,89,104,77,3,55,230,20,197,160,173,41,148,36,141,152,
+17,129,172,7,72,30,6,238,170,32,48,169,36,24,14,157,171,53,166,250,39,172,73,49,173,8,148,169,232,126,164,200,248,161,121,227,163,219,35,173,
+220,77,224,11,69,89,168,221,166,233,185,48,230,163,169,14,237,239,107,252,165,191,255,254,21,95,252,169,191,255,159,13,167,202,235,248,110,208,207,47,
+255,131,88,239,124,7,192,79,117,215,231,104,248,218,146,225,129,160,180,20,138,211,54,97,244,229,44,133,92,253,163,1,194,74,249,153,93,105,237,70,
+173,224,156,163,106,35,250,200,160,196,38,172,105,71,244,117,133,10,112,142,90,78,17,91,3,136,130,148,219,137,169,122,63,183,169,8,189,8,56,184,
+248,12,173,120,130,160,137,103,152,26,146,152,75,222,163,124,149,221,54,153,115,85,185,173,249,113,175,209,15,66,61,212,98,147,252,136,191,255,255,83,
+207,244,114,255,249,160,231,222,52,127,111,30,14,235,103,250,239,220,195,244,141,152,119,132,152,53,208,245,106,192,128,157,212,209,108,26,170,199,80,24,
+206,146,106,154,109,95,251,44,13,36,173,225,188,36,191,183,162,130,22,137,206,109,102,7,22,118,71,8,11,230,100,71,52,182,117,241,200,125,17,207,
+105,53,35,72,183,133,39,88,75,135,220,9,66,125,154,197,85,15,202,212,156,81,228,103,89,124,141,224,114,141,241,247,128,44,246,104,199,96,252,60,
+240,165,212,63,52,30,1,115,237,255,42,111,255,255,193,227,249,253,127,239,171,241,123,189,151,243,153,186,157,24,127,7,152,254,125,184,211,35,143,91,
+199,165,13,126,97,229,61,155,97,30,237,238,151,162,233,149,178,190,150,60,216,184,101,165,153,182,50,153,249,93,219,43,234,177,94,10,113,82,228,142,
+2,225,61,176,134,41,113,55,144,18,39,139,106,107,164,26,60,182,9,214,190,169,116,188,233,72,178,25,92,163,41,153,149,105,244,141,26,99,141,138,
+227,152,219,122,173,252,34,226,131,43,58,154,213,191,19,60,41,116,187,207,119,131,12,247,127,225,33,255,255,230,221,254,228,159,251,182,254,193,190,78,
+31,248,87,174,7,132,63,92,215,89,237,231,29,90,69,231,194,216,28,23,242,80,207,15,80,72,9,228,88,168,86,132,191,245,23,182,134,160,183,12,
+138,144,111,17,104,237,2,174,81,124,171,30,78,82,123,143,117,7,100,86,74,1,114,15,97,5,32,51,11,65,52,139,83,53,103,88,85,155,84,53,
+57,74,116,117,63,115,147,54,50,229,50,50,177,53,211,53,67,52,141,91,150,181,127,88,195,203,78,155,54,39,193,143,27,60,239,117,5,224,35,26,
+95,246,162,255,255,233,5,255,195,51,255,230,119,241,113,237,137,255,153,44,212,61,212,246,109,178,207,10,251,108,194,159,101,151,248,223,175,3,43,229,
+223,8,117,102,185,71,199,22,221,177,73,58,151,49,215,85,200,244,113,42,177,102,98,24,145,83,27,30,135,84,193,16,214,168,196,34,206,20,0,227,
+20,20,102,70,36,172,218,55,240,7,41,87,235,57,182,153,71,20,193,78,210,245,80,17,173,76,209,73,71,81,249,69,83,153,77,85,249,98,248,113,
+193,230,131,51,157,186,237,216,242,125,204,231,85,125,227,220,255,251,112,127,255,250,60,127,243,110,255,254,169,119,233,115,207,238,158,155,252,119,124,131,
+77,255,205,37,8,115,147,153,121,184,209,245,64,149,85,136,26,168,250,178,164,34,46,93,6,81,213,153,233,57,66,86,235,74,172,198,44,1,177,116,
+5,182,28,64,108,166,9,58,140,68,76,168,4,240,42,165,16,202,163,209,17,112,76,87,21,178,19,124,84,113,85,54,53,45,23,21,14,214,241,2,
+213,231,12,84,137,37,243,147,74,179,139,117,116,197,145,43,173,211,102,100,119,111,188,94,63,185,238,232,247,185,235,214,255,45,143,255,255,208,19,253,
+178,63,255,49,90,117,162,207,223,55,88,248,170,254,74,116,52,252,153,227,181,224,102,10,116,165,80,208,175,22,243,252,114,101,10,192,129,133,181,210,
+138,70,220,86,72,209,51,55,139,228,110,81,48,206,2,78,245,171,194,240,95,33,108,33,76,188,67,44,182,200,90,148,15,126,74,16,177,15,151,147,
+68,181,105,110,19,5,130,40,142,193,12,18,91,148,46,83,84,132,75,220,251,199,221,132,73,46,7,104,111,36,23,163,162,28,254,108,239,132,254,30,
+250,115,230,243,189,76,184,127,200,83,255,255,244,60,254,9,31,253,109,252,12,95,67,246,71,203,230,51,191,154,93,81,63,42,24,109,117,251,55,88,
+55,200,221,104,161,59,65,1,87,174,243,196,89,34,208,215,132,199,243,28,140,143,180,22,193,227,83,43,4,104,53,63,172,40,36,245,56,104,154,46,
+179,221,4,210,217,26,105,111,42,120,70,173,73,237,167,123,56,157,187,242,148,92,0,199,165,180,200,13,58,74,148,192,78,116,110,83,44,98,216,84,
+176,93,197,88,98,15,15,249,137,212,126,180,184,167,225,87,168,14,118,60,26,231,43,255,28,143,255,255,129,167,246,66,255,217,63,241,235,234,1,255,
+54,241,18,232,39,228,6,89,126,109,234,111,133,189,248,205,203,87,220,19,50,105,210,146,11,185,138,31,246,2,150,54,177,214,145,85,242,219,186,213,
+91,19,93,227,53,107,181,94,234,189,148,16,152,212,38,157,217,87,142,160,150,1,32,29,73,36,185,79,173,49,210,221,122,211,109,143,82,109,113,80,
+229,49,79,84,231,206,60,173,78,28,151,79,124,182,210,157,19,216,29,167,224,31,26,57,92,212,94,189,56,87,226,211,159,254,151,188,10,99,123,255,
+39,143,255,254,191,31,248,31,127,250,165,253,71,124,105,63,245,197,173,247,196,63,86,219,81,240,205,180,92,56,118,109,132,23,17,252,133,50,71,202,
+49,51,236,173,25,72,231,105,244,231,156,227,157,99,167,52,119,56,223,85,83,68,43,235,89,11,7,168,100,92,33,26,167,92,47,141,232,6,227,228,
+40,228,214,64,235,50,84,174,174,103,175,46,123,173,78,139,42,58,145,103,2,143,164,130,137,163,110,132,100,74,135,231,6,158,235,94,206,176,125,134,
+92,238,103,191,113,219,192,228,215,153,158,173,123,217,184,143,249,206,127,255,248,147,127,241,112,255,254,104,186,0,211,107,253,147,201,11,194,71,161,252,
+33,251,126,191,126,2,118,129,2,59,210,192,186,6,176,230,70,37,252,196,208,208,185,68,24,167,100,198,98,232,133,62,141,169,177,50,190,118,146,81,
+98,212,113,32,178,116,30,42,125,9,35,29,9,192,32,138,194,183,136,100,39,64,10,46,35,155,4,19,209,96,21,111,56,22,89,22,246,117,5,117,
+205,9,20,191,31,51,251,66,84,5,110,21,43,142,251,200,211,102,99,247,171,187,14,75,185,207,233,219,186,219,58,255,79,47,255,255,193,147,254,68,
+223,255,199,166,2,105,187,249,85,225,187,103,95,170,91,246,125,174,92,235,177,152,185,206,197,93,193,68,84,79,25,246,144,179,23,36,132,223,1,205,
+184,126,80,227,98,12,115,49,8,216,130,113,27,236,56,182,196,9,117,135,242,32,71,217,36,10,193,49,13,253,15,158,164,167,34,102,5,176,99,53,
+118,59,96,51,169,122,241,109,128,200,21,185,104,34,171,40,191,156,185,181,148,26,222,149,12,11,81,14,79,174,223,74,217,211,219,183,4,188,85,244,
+165,207,7,117,184,158,255,99,143,255,255,192,227,252,81,63,245,21,252,15,242,240,252,242,250,46,138,87,238,2,238,94,106,117,29,105,94,81,240,178,
+221,222,65,209,245,99,35,108,90,233,106,71,178,164,215,214,174,6,115,87,94,206,59,35,44,36,52,178,165,166,156,18,34,197,218,48,211,116,141,162,
+106,69,0,34,220,8,206,74,160,216,73,180,152,218,188,95,225,210,54,176,117,51,86,27,80,147,65,100,145,21,101,176,123,81,145,141,54,51,141,36,
+181,199,41,119,189,75,152,158,193,134,88,52,181,166,62,29,55,139,209,63,45,93,228,113,73,248,212,127,255,185,7,255,252,41,191,84,223,255,40,223,
+165,135,242,81,226,11,62,30,231,188,58,75,23,229,211,89,79,95,56,36,96,222,124,233,129,35,124,68,157,7,62,66,108,197,10,150,150,194,204,218,
+205,26,164,94,123,65,140,52,177,130,193,210,222,86,36,164,180,166,164,0,221,13,124,122,133,236,48,1,138,10,39,122,64,170,174,121,43,38,170,105,
+218,199,231,250,199,230,162,168,102,78,120,166,182,77,167,110,57,168,58,74,105,34,128,106,206,208,237,227,24,88,173,210,110,148,247,141,193,215,37,61,
+5,116,253,206,150,29,31,255,170,71,255,255,175,150,146,255,250,236,205,173,29,63,224,103,107,79,165,94,55,117,25,230,139,35,249,127,234,75,21,46,
+74,121,90,99,67,115,96,99,117,171,242,18,71,27,162,254,230,189,18,13,187,176,138,196,19,87,42,42,108,165,30,108,196,35,5,84,8,186,57,148,
+27,8,249,130,131,220,157,137,220,90,204,53,35,77,117,152,78,237,175,81,5,120,210,205,33,83,28,205,209,204,152,207,60,147,76,212,184,204,93,1,
+207,53,104,85,221,231,96,43,31,249,169,211,30,218,247,227,201,31,48,93,78,119,75,45,31,253,19,191,255,249,103,127,201,147,255,244,177,226,211,153,
+71,251,34,146,142,234,254,128,230,167,221,22,104,243,89,203,116,3,233,2,46,38,116,229,57,15,65,247,133,80,159,235,157,49,139,123,109,5,16,238,
+154,206,81,207,234,64,26,172,90,58,159,152,206,46,198,41,131,141,78,161,30,95,161,252,14,178,148,95,113,210,128,120,94,186,26,12,168,187,108,151,
+12,5,70,149,213,199,109,72,75,212,171,208,220,67,84,132,61,213,220,171,214,101,102,217,14,33,111,219,70,217,109,221,62,218,56,225,229,243,159,206,
+206,179,193,248,126,127,255,250,231,127,252,60,191,242,47,253,146,98,9,217,135,243,165,203,131,252,120,231,97,234,155,58,153,202,229,126,114,113,211,80,
+242,192,71,152,183,23,4,72,44,56,194,155,223,41,103,50,136,156,111,77,129,182,23,91,52,71,243,134,179,26,107,96,206,22,42,132,66,195,72,0,
+101,98,72,169,42,56,167,161,130,105,108,98,41,113,149,9,24,242,142,91,186,160,105,254,176,56,131,182,200,37,48,104,68,161,185,97,149,42,185,146,
+171,244,159,108,108,93,190,99,115,245,166,94,17,119,41,209,135,34,125,214,244,107,227,93,255,253,117,63,255,238,141,45,223,255,224,175,232,9,235,127,
+242,195,55,126,255,61,64,197,51,235,195,89,207,84,54,110,193,84,175,192,44,217,220,112,206,33,137,54,105,19,96,121,95,108,39,51,64,179,86,233,
+84,124,221,202,152,217,169,90,26,157,23,232,104,107,151,18,36,205,132,9,59,133,192,99,200,1,157,69,186,13,225,230,237,232,130,158,110,30,77,240,
+87,16,183,129,22,85,9,45,50,89,71,16,149,89,240,159,95,242,183,96,118,23,104,216,247,192,182,175,243,55,193,78,236,249,66,231,115,165,94,174,
+36,221,255,196,211,255,255,244,188,173,103,255,131,126,1,232,69,252,191,225,251,140,31,203,61,87,189,225,81,46,194,122,60,191,199,22,92,38,48,171,
+87,96,129,85,137,4,218,31,51,35,137,52,103,237,107,172,194,177,236,199,195,37,204,84,176,102,194,10,171,150,120,148,20,184,160,128,202,76,144,58,
+72,16,48,226,36,102,228,138,116,42,110,110,110,18,106,238,126,119,171,250,141,40,42,157,164,174,158,226,234,140,163,158,114,166,66,102,170,10,121,174,
+66,182,49,57,134,172,216,105,95,93,60,40,240,169,208,87,57,157,240,102,79,254,120,95,255,252,2,63,252,9,191,246,107,255,47,255,156,199,253,35,
+211,71,95,159,1,91,79,222,127,176,11,18,121,92,204,91,76,146,174,5,70,127,196,186,24,188,36,9,95,108,104,128,98,205,151,165,69,184,46,77,
+251,132,21,34,180,124,178,213,194,173,173,32,138,162,49,180,114,14,225,76,135,200,51,128,248,165,70,29,44,205,37,97,210,253,95,86,53,64,86,109,
+23,84,20,240,80,84,211,76,188,195,202,204,200,203,92,234,79,29,49,85,221,163,95,70,31,242,173,159,237,119,238,167,137,62,84,250,25,236,43,117,
+254,97,31,255,247,88,255,255,188,55,250,140,255,152,90,195,103,63,252,200,241,94,254,42,33,251,199,231,63,24,201,223,134,130,34,17,146,125,193,48,
+5,198,176,214,232,53,73,133,112,226,0,86,157,117,152,131,147,245,98,179,46,209,66,127,27,191,58,70,181,204,101,118,167,66,122,72,18,6,67,185,
+28,250,67,39,136,8,161,218,71,151,203,211,145,108,38,201,229,212,206,141,57,83,60,159,85,164,63,212,148,63,208,180,149,77,77,24,205,101,172,210,
+198,29,47,15,47,153,176,212,190,241,119,199,205,119,41,157,151,118,13,148,7,255,228,205,255,255,169,182,209,95,255,186,74,159,25,111,249,166,196,147,
+215,23,139,90,141,250,37,128,70,231,46,122,211,177,31,12,0,173,2,58,16,17,190,176,193,85,183,68,83,50,74,205,226,130,220,180,160,17,208,242,
+14,155,139,80,90,212,215,166,101,140,45,130,178,185,1,254,233,0,28,4,35,52,196,228,37,19,112,110,133,201,112,176,123,23,152,12,13,67,150,4,
+161,82,193,35,254,102,167,186,32,234,250,14,172,182,65,173,30,169,237,227,20,120,28,212,174,89,120,46,218,183,43,124,191,116,195,217,244,179,255,199,
+163,255,255,243,26,254,107,31,255,46,61,75,72,107,233,139,218,141,1,191,165,190,31,159,109,144,149,201,54,243,224,159,124,20,142,92,179,226,80,229,
+78,150,20,198,166,241,148,52,163,55,116,156,86,230,87,40,203,43,53,234,108,107,125,0,13,14,152,186,208,141,136,220,143,124,6,174,232,155,105,124,
+190,160,26,147,234,26,82,112,167,19,56,218,140,11,253,153,138,103,168,168,221,177,248,6,48,216,30,166,105,31,155,122,132,152,75,238,162,92,138,221,
+222,124,243,223,173,62,16,247,217,210,55,38,253,246,112,79,252,18,63,255,245,112,255,251,187,126,173,191,253,202,126,189,223,216,15,115,248,150,250,158,
+226,67,27,191,93,58,42,124,18,236,141,191,42,98,27,249,10,201,56,90,240,10,78,76,38,168,245,129,6,41,216,126,100,221,149,22,37,217,174,93,
+163,28,171,19,88,26,165,145,42,157,82,87,67,0,114,17,96,26,1,252,11,210,116,52,219,244,139,92,133,8,86,253,121,207,85,180,201,69,156,199,
+125,56,73,196,190,77,252,105,82,124,99,214,20,200,89,13,126,221,142,48,113,71,169,29,9,112,95,191,62,96,57,226,235,171,151,142,66,31,255,159,
+39,255,255,201,27,218,135,255,134,108,45,50,57,253,114,199,51,204,31,141,74,87,250,31,129,222,142,116,71,44,45,119,241,236,206,183,67,166,127,180,
+84,65,33,249,161,243,165,113,6,142,6,253,22,120,207,99,33,75,221,101,225,73,108,61,164,97,72,136,112,62,195,129,31,2,32,8,16,130,7,248,
+238,149,9,234,160,10,111,167,138,152,169,218,141,167,106,94,162,26,17,156,137,179,152,201,102,151,137,77,153,41,141,158,90,42,168,27,24,183,92,34,
+99,7,51,122,78,216,126,253,56,147,229,231,160,30,222,240,169,254,160,31,255,248,99,127,254,198,95,254,86,127,166,62,127,31,12,127,135,187,241,126,
+90,232,119,176,78,195,176,107,176,205,251,215,59,107,59,214,86,158,64,11,52,1,91,16,28,63,55,35,196,214,131,2,138,141,113,98,129,247,46,200,
+219,105,161,104,106,50,99,100,191,216,55,30,52,161,18,56,205,149,0,157,207,217,52,64,193,16,80,236,186,93,36,149,223,84,210,216,69,56,206,157,
+119,199,189,96,70,252,249,202,236,145,207,252,107,83,188,176,213,197,82,88,214,12,239,191,54,217,101,215,238,211,248,39,228,247,148,190,174,186,73,207,
+35,255,245,104,255,255,194,91,139,151,255,232,66,100,234,225,254,55,99,23,165,63,196,165,94,61,233,76,231,23,250,172,173,251,108,190,11,185,71,22,
+219,67,83,56,202,123,37,215,18,34,160,231,61,18,141,58,51,66,160,151,33,230,248,226,125,7,12,76,42,8,240,151,200,12,170,197,3,187,47,13,
+80,215,156,67,145,148,163,248,140,218,173,178,249,42,196,188,69,97,14,78,106,126,152,227,130,199,224,20,183,33,158,117,38,110,59,235,110,58,46,130,
+135,111,183,3,216,85,209,238,84,119,221,177,222,65,57,69,231,103,175,172,134,254,189,223,255,254,165,223,253,213,191,188,207,252,156,245,64,239,227,249,
+115,211,67,241,91,160,236,152,125,52,224,25,225,2,88,85,27,80,48,15,31,50,180,120,163,42,176,4,13,171,145,136,68,149,184,25,69,107,131,245,
+100,50,144,206,122,101,27,111,54,198,123,79,73,60,233,62,25,68,231,137,38,12,5,86,49,128,206,167,226,177,16,240,76,130,169,183,167,171,158,141,
+156,56,194,173,205,200,244,232,210,60,33,87,180,23,21,124,97,206,253,48,75,93,244,79,214,54,238,251,43,154,23,208,15,10,27,58,231,107,144,174,
+190,58,75,210,227,255,160,199,255,255,221,138,163,31,255,29,246,119,7,191,206,199,43,213,137,252,180,93,43,199,222,225,99,235,221,254,173,28,127,98,
+216,233,226,192,243,129,93,89,6,168,176,53,100,45,33,133,118,39,152,31,103,213,115,108,230,47,69,127,204,46,38,49,130,179,200,82,185,163,154,153,
+164,2,169,106,139,252,153,13,220,150,201,117,159,70,70,6,228,242,222,169,78,136,237,10,62,237,142,44,234,14,80,165,26,131,97,214,163,98,126,162,
+167,38,155,109,142,176,241,219,125,154,18,206,246,191,120,14,224,27,159,14,81,123,167,216,159,243,204,255,255,145,23,255,246,224,254,181,63,252,156,253,
+183,63,14,159,13,246,165,236,239,207,228,11,253,250,75,187,76,26,254,174,23,17,92,173,178,85,180,16,1,44,85,242,136,67,106,230,56,212,170,198,
+152,129,103,209,104,77,72,44,149,148,85,180,173,65,96,41,154,77,154,14,15,140,186,8,120,92,130,204,3,225,166,83,37,134,129,168,238,147,43,66,
+148,107,202,147,234,102,148,40,10,142,165,230,126,100,254,101,101,126,83,230,242,89,40,242,128,235,90,200,46,163,17,56,206,208,86,148,246,251,192,159,
+27,124,221,244,19,211,228,119,191,253,229,63,255,250,0,121,38,127,246,237,246,141,241,162,255,197,29,102,185,133,247,47,146,174,139,59,234,128,39,41,
+17,76,137,252,135,232,89,135,110,199,209,43,197,217,250,32,65,181,49,173,116,68,111,109,251,47,29,128,118,200,210,58,221,162,29,153,45,75,154,89,
+212,88,70,137,135,8,162,182,128,9,160,180,12,131,247,1,166,45,32,245,217,76,148,125,106,147,91,109,243,55,86,147,203,54,52,79,30,20,65,25,
+179,147,41,51,3,66,147,75,94,116,231,120,151,191,138,204,204,103,99,105,251,95,227,51,145,126,129,122,249,208,31,196,219,255,255,103,79,255,238,93,
+253,239,255,213,244,161,160,63,254,219,60,108,63,135,107,83,228,27,198,133,218,111,39,93,16,153,169,201,20,0,241,242,224,24,224,59,126,4,214,75,
+150,160,143,215,36,5,116,234,49,14,45,165,48,160,168,198,204,12,117,175,194,151,91,106,0,139,53,37,97,129,137,17,239,157,81,42,152,152,20,191,
+120,29,67,196,137,218,29,100,204,253,245,68,189,225,198,13,56,77,52,119,211,212,14,213,140,66,82,52,235,79,53,180,209,142,45,174,15,49,185,152,
+210,126,244,118,193,205,31,27,221,115,117,243,92,47,252,208,191,255,252,209,63,149,7,255,241,247,128,232,159,252,140,252,110,98,133,253,202,111,241,240,
+241,133,44,180,116,165,1,122,139,144,8,48,141,90,163,52,18,18,97,220,117,90,188,69,99,36,44,170,40,45,199,66,20,28,116,38,45,150,102,10,
+81,226,206,24,239,177,46,49,8,189,44,16,94,58,2,161,171,211,24,128,9,216,176,56,123,198,172,29,98,74,90,235,70,191,35,198,246,96,26,214,
+34,26,118,230,238,30,235,34,6,108,110,72,107,94,192,171,19,30,246,251,166,204,165,109,39,117,252,4,243,213,199,175,114,124,81,125,116,191,255,227,
+45,255,253,214,184,149,255,254,79,126,250,223,9,159,106,88,123,235,147,240,91,160,71,230,195,61,174,151,173,238,81,120,66,197,154,95,241,54,23,231,
+32,146,212,113,42,77,116,138,206,101,161,120,204,133,179,18,182,6,174,212,34,206,242,136,86,40,172,243,195,86,120,183,164,72,56,71,176,80,132,242,
+88,204,158,23,76,198,105,168,142,226,164,103,11,145,229,116,115,123,66,21,87,20,182,17,5,84,235,25,242,227,62,113,153,95,114,65,112,149,41,121,
+88,149,194,230,162,243,53,192,30,229,57,0,230,207,158,78,163,230,155,255,150,215,255,255,198,219,233,121,255,132,47,241,7,246,132,255,139,107,116,227,
+67,228,47,112,249,88,250,81,211,131,219,38,88,152,152,161,123,60,82,31,39,199,217,198,145,75,40,185,130,164,142,53,58,162,166,146,216,24,99,213,
+145,85,252,49,56,181,117,153,42,9,52,105,15,66,129,151,24,128,181,12,128,25,129,52,66,205,164,136,213,60,223,86,77,63,211,53,130,207,77,130,
+77,149,53,206,84,203,207,156,124,79,196,117,78,100,185,205,181,43,80,45,170,215,174,18,112,245,148,205,33,106,35,128,14,3,249,110,230,211,176,141,
+228,122,6,127,255,104,47,255,254,170,95,160,111,253,133,64,85,10,255,207,206,231,159,65,28,107,233,195,194,22,233,231,227,209,22,161,156,101,229,108,
+194,226,27,105,71,251,225,236,101,59,34,71,242,204,90,224,68,131,149,20,106,183,132,179,102,22,89,44,74,243,40,135,188,178,243,180,64,105,210,138,
+1,113,3,244,156,136,228,103,73,229,53,203,101,152,207,13,137,83,189,64,214,84,245,213,108,203,81,52,196,204,60,206,73,36,218,201,172,236,206,21,
+24,85,69,114,222,46,1,114,11,152,77,48,108,187,123,92,105,114,161,209,231,106,212,65,255,133,135,255,254,100,223,254,59,159,255,21,191,129,78,18,
+223,102,159,14,210,170,252,123,197,199,143,174,87,177,83,185,125,37,72,19,41,250,164,81,54,89,72,80,91,217,210,5,255,32,100,188,216,106,235,214,
+220,222,218,69,156,102,37,49,165,85,132,170,149,130,67,170,91,177,35,163,152,136,7,0,126,195,2,74,199,226,28,231,190,144,102,158,211,39,54,205,
+41,138,158,171,34,116,42,122,100,103,202,102,101,30,102,163,242,95,228,198,94,38,226,114,233,174,165,237,30,241,48,197,146,76,225,106,103,106,28,12,
+113,169,204,23,64,253,6,86,75,255,203,155,255,254,169,95,188,39,255,118,127,124,29,128,191,109,61,235,207,55,229,190,236,57,209,235,211,12,121,211,
+227,166,234,218,130,203,153,120,195,170,191,76,19,186,144,34,100,213,104,233,23,112,214,125,46,33,21,64,200,75,59,105,212,106,161,27,236,40,38,157,
+26,137,249,35,164,85,10,33,3,8,168,62,68,104,245,197,189,25,81,165,8,89,21,12,217,133,51,212,245,79,79,213,58,76,172,243,75,196,166,203,
+116,126,75,44,143,203,156,209,78,117,50,212,165,170,222,54,29,242,113,157,77,96,237,135,132,94,60,249,162,233,51,153,139,240,127,254,22,31,255,249,
+11,119,214,255,247,223,231,139,193,243,253,3,101,91,17,63,172,248,83,115,89,195,166,15,182,125,166,202,49,103,39,84,136,102,169,84,252,19,151,140,
+1,78,237,61,63,9,245,113,158,90,238,148,145,218,210,59,43,233,90,110,240,202,25,185,67,74,65,20,88,31,105,223,5,74,203,8,48,251,147,243,
+80,133,211,61,158,217,246,190,137,29,194,108,201,216,53,88,75,77,161,196,237,80,72,12,163,206,100,38,81,140,57,79,92,207,77,5,131,208,110,5,
+238,35,25,25,147,205,38,224,182,39,199,7,31,156,231,245,139,172,159,69,79,255,252,52,191,255,151,182,227,63,254,118,47,200,140,127,224,66,95,27,
+124,252,78,98,245,242,221,4,220,91,106,98,156,109,46,220,235,76,157,47,112,240,4,57,165,240,105,110,45,36,107,180,109,180,249,221,31,33,57,180,
+150,15,20,0,218,225,76,180,192,102,105,154,75,200,87,168,152,93,109,220,27,227,114,73,80,3,32,40,49,150,42,88,192,44,90,99,222,52,174,58,
+148,101,70,224,224,24,202,225,170,96,230,222,2,106,122,3,137,174,89,103,50,211,167,131,22,54,173,148,140,219,231,67,128,61,128,242,243,199,191,73,
+29,103,210,87,247,62,255,255,247,212,255,190,103,249,39,255,204,151,155,71,170,239,209,188,254,188,182,250,108,179,167,224,207,74,174,152,171,90,104,117,
+101,88,229,63,66,5,136,93,136,133,85,10,21,89,106,79,107,24,204,187,169,149,192,170,97,154,250,91,66,201,217,168,58,150,93,75,233,60,200,83,
+22,196,141,138,77,168,136,116,49,66,121,201,197,66,22,164,82,182,174,10,69,113,127,22,23,141,59,179,75,100,16,35,101,176,79,57,178,205,10,85,
+15,0,101,93,40,180,105,104,52,97,142,123,110,205,166,111,244,121,193,30,208,57,196,228,11,173,46,129,49,122,255,215,147,255,255,238,1,183,119,255,
+0,127,131,223,41,143,236,207,133,124,64,253,84,112,111,74,223,147,158,3,94,132,167,20,233,245,149,165,165,145,109,28,14,176,86,164,227,126,99,21,
+57,12,61,176,170,194,107,31,76,123,176,146,201,26,239,215,184,187,100,221,44,221,4,9,73,57,98,117,52,80,13,32,224,219,131,232,181,168,72,164,
+185,41,135,176,250,240,159,203,208,150,139,99,156,154,5,166,232,197,168,104,122,156,41,33,141,57,250,136,250,107,151,26,122,176,122,205,197,5,245,231,
+43,59,122,181,223,230,245,57,174,229,79,180,62,2,61,112,63,255,65,207,255,255,18,239,82,31,253,37,97,227,14,175,247,205,130,23,108,190,128,51,
+47,194,167,167,28,60,60,174,97,157,75,184,46,211,43,16,93,107,153,246,181,84,18,78,109,237,19,219,120,234,152,98,121,166,117,52,182,138,167,6,
+78,22,246,167,197,198,162,69,66,5,110,164,234,11,172,95,198,224,2,64,140,53,229,70,99,105,10,140,234,170,170,106,238,177,170,138,164,41,150,139,
+232,14,115,38,78,94,164,238,79,228,146,75,101,86,88,231,38,126,233,246,188,237,223,6,120,186,204,222,144,182,39,190,94,36,57,105,231,207,182,124,
+36,127,131,167,255,252,230,63,255,176,135,255,6,95,230,43,7,204,7,127,192,79,81,239,206,246,80,247,191,218,150,210,105,71,192,133,161,173,26,59,
+111,181,75,189,150,161,67,147,52,73,28,51,136,1,14,116,70,137,150,125,154,56,75,19,145,36,8,182,4,162,197,44,176,138,83,139,211,26,148,57,
+148,56,66,151,80,239,203,248,253,201,172,145,219,148,106,224,30,111,108,30,194,230,250,232,228,190,188,230,70,101,40,126,34,40,162,30,102,54,79,227,
+230,139,36,118,178,233,10,204,175,206,249,179,57,148,77,115,108,223,127,92,151,242,43,213,135,93,20,32,255,223,179,255,255,87,111,249,92,127,255,3,
+93,62,217,179,211,223,233,215,147,135,247,19,114,206,111,121,241,175,142,64,240,171,50,120,255,138,176,255,32,254,16,73,115,153,3,125,76,227,95,36,
+86,233,32,242,219,59,100,65,65,14,62,77,29,192,10,54,214,8,188,66,28,97,212,19,146,156,51,65,12,97,229,179,76,6,49,21,210,227,121,144,
+117,143,104,232,186,74,207,152,204,17,195,61,213,71,204,229,209,124,15,86,4,19,144,156,131,72,45,68,197,253,185,79,157,207,224,90,250,52,87,144,
+189,192,108,191,132,62,95,121,1,236,191,152,126,236,95,255,190,215,255,253,10,176,44,255,254,209,184,95,85,63,233,211,192,228,205,63,161,238,19,222,
+245,50,175,91,62,39,170,17,124,48,6,14,48,135,69,103,176,67,75,107,65,122,204,152,184,72,227,130,244,133,54,164,192,210,225,155,85,66,211,109,
+8,119,92,162,164,75,89,114,192,108,149,224,192,15,226,54,43,42,43,57,120,85,161,235,116,136,204,135,69,46,4,233,110,119,111,162,19,239,90,35,
+40,90,116,224,226,174,33,124,150,226,238,83,105,210,53,238,206,118,240,23,129,12,31,233,131,38,27,239,217,215,22,124,204,114,153,217,174,181,63,140,
+215,255,254,61,95,255,96,15,93,191,255,161,95,199,139,228,19,234,31,54,28,11,254,165,181,146,250,114,134,156,228,248,1,207,131,138,44,220,28,212,
+123,161,252,12,86,128,113,234,226,89,58,205,152,78,99,53,128,118,106,88,63,98,145,145,181,82,50,86,151,117,152,166,45,1,41,157,23,52,26,5,
+112,162,135,216,210,198,233,129,197,37,67,214,108,192,96,190,79,47,86,135,169,58,200,227,182,207,162,190,135,37,166,44,232,146,4,40,166,48,38,130,
+138,165,174,222,169,7,7,56,32,198,70,144,243,139,191,205,196,114,19,204,207,59,253,51,80,175,255,26,143,255,254,221,223,217,123,254,119,63,240,227,
+251,140,127,158,222,50,51,91,237,23,195,220,37,253,197,204,227,34,156,45,100,101,204,127,41,202,205,189,52,38,136,183,89,160,47,211,130,96,214,150,
+209,218,117,27,109,87,27,53,140,76,174,49,142,69,40,174,17,55,41,105,70,177,202,154,161,21,140,176,111,129,24,60,71,52,210,77,197,40,83,141,
+64,215,117,58,215,157,55,211,237,52,78,229,26,75,84,220,74,132,150,75,76,116,76,84,152,205,148,250,80,229,124,215,246,3,48,203,146,237,8,106,
+3,118,220,9,242,53,205,127,79,60,83,102,61,255,249,242,127,255,241,28,92,175,254,67,190,28,189,238,63,240,101,64,141,176,252,134,225,79,153,222,
+255,227,191,159,220,44,75,131,79,60,143,175,67,77,197,62,5,141,205,141,103,146,243,118,99,1,166,84,73,185,198,65,187,102,139,233,82,243,83,39,
+140,200,218,45,81,170,161,113,117,73,80,105,15,8,193,9,204,160,146,156,89,77,213,113,201,181,223,78,141,123,215,180,236,219,60,190,212,204,245,202,
+213,29,69,108,231,199,180,129,204,188,87,79,140,168,208,21,70,211,5,226,220,38,45,50,135,154,189,131,236,51,134,94,50,57,103,233,27,147,92,237,
+63,255,16,15,255,249,147,124,249,63,255,70,92,36,101,89,245,45,245,67,184,247,244,137,84,46,19,122,159,181,253,184,105,138,34,113,131,54,183,148,
+145,222,44,195,207,34,236,34,130,67,152,50,21,105,85,147,180,84,186,21,54,54,248,23,8,160,70,208,138,21,159,163,232,69,34,160,128,197,68,0,
+125,64,99,70,70,212,106,110,112,109,58,246,237,11,152,189,145,43,65,178,9,46,193,140,81,88,52,227,199,141,103,192,201,45,69,100,115,208,52,14,
+84,172,129,81,133,113,80,158,28,173,7,35,57,127,204,198,233,117,169,199,15,27,220,190,245,39,183,95,87,143,255,247,94,255,254,128,5,129,255,252,
+22,112,184,153,159,214,167,137,187,134,127,88,187,27,120,85,228,210,2,60,186,200,42,97,42,46,8,128,52,5,17,186,45,169,84,86,17,129,54,96,
+121,204,247,49,144,156,87,27,72,70,109,153,107,74,77,106,144,176,217,167,59,100,79,40,192,5,212,2,16,211,250,46,36,201,72,71,129,3,211,245,
+114,16,105,144,40,214,182,27,28,144,44,51,194,181,150,205,116,107,87,220,46,148,148,71,199,109,24,64,81,112,199,109,45,216,117,7,99,42,206,114,
+191,154,140,214,111,231,90,92,150,113,231,205,79,79,184,206,254,127,159,255,251,197,127,249,101,121,252,255,252,249,125,211,60,222,253,227,108,182,252,63,
+155,173,87,189,17,237,30,62,30,55,53,18,207,84,2,74,121,176,102,24,16,17,72,145,212,129,170,189,112,42,217,99,41,133,21,223,52,134,170,182,
+120,151,32,177,6,61,80,212,193,2,12,209,72,146,209,31,69,112,6,141,32,118,14,92,159,153,68,75,80,253,158,71,6,28,37,42,208,171,202,88,
+239,150,46,107,166,104,228,10,166,96,32,145,226,146,64,39,230,17,234,154,73,105,166,193,233,135,21,183,25,151,28,228,103,243,126,187,47,228,231,146,
+78,126,249,221,144,223,253,150,191,255,251,23,127,140,55,249,208,255,228,183,247,12,254,9,253,52,93,103,137,255,138,9,146,120,238,204,92,42,124,73,
+241,40,224,118,132,70,157,40,60,199,27,150,236,209,66,119,141,11,158,123,69,235,76,96,45,157,5,158,51,72,188,166,1,215,192,172,85,93,167,113,
+35,136,140,60,210,192,41,161,49,16,48,71,11,232,104,158,233,113,162,186,160,160,107,63,162,234,225,170,170,16,173,201,143,164,169,166,149,73,214,139,
+137,157,142,169,29,152,216,245,161,153,163,166,234,239,175,188,38,224,183,44,249,241,211,182,239,119,161,200,215,45,189,44,241,37,132,231,255,201,235,255,
+255,135,183,59,111,254,10,191,134,111,183,151,250,37,225,74,175,254,255,180,59,168,175,30,184,153,179,95,27,26,181,109,114,192,69,17,35,93,129,36,
+43,153,164,12,154,67,130,193,72,113,112,159,54,1,91,77,69,235,131,132,228,177,50,195,186,51,24,243,57,85,19,161,104,162,16,222,13,229,20,8,
+224,143,12,164,103,14,180,237,67,115,241,105,243,169,105,84,189,77,181,179,53,85,71,49,19,139,55,49,243,54,145,157,42,210,121,34,83,161,44,84,
+145,76,21,163,117,151,133,142,220,158,232,95,94,187,93,226,35,141,62,112,58,157,211,111,114,207,255,245,96,255,255,108,105,16,255,247,253,176,222,46,
+31,233,102,217,48,169,252,28,214,179,180,26,187,90,198,102,165,181,213,52,107,193,167,0,132,47,222,100,207,139,155,243,233,61,7,12,33,186,230,137,
+42,236,33,183,148,117,78,96,209,56,200,67,20,39,94,209,217,8,43,125,1,195,112,151,177,32,183,208,96,138,105,30,56,184,158,53,42,8,152,252,
+36,70,38,12,231,182,147,109,190,47,110,2,56,103,158,126,225,46,158,160,114,108,165,30,44,233,238,50,107,78,147,171,3,7,118,171,153,44,142,105,
+11,108,59,27,228,171,137,222,136,186,174,181,159,199,155,255,255,155,7,255,194,43,230,191,255,203,142,227,148,41,254,51,164,67,115,127,194,182,245,95,
+60,51,151,159,46,79,226,147,25,84,187,20,64,45,10,201,255,5,30,10,16,162,145,102,182,10,149,197,98,111,24,149,108,213,7,174,69,81,58,200,
+107,10,39,68,208,248,216,43,160,238,133,241,48,99,89,117,65,139,25,114,102,128,232,243,59,185,248,151,140,81,194,158,37,102,170,144,174,110,19,47,
+102,32,231,214,129,160,24,180,32,248,121,101,30,36,235,82,34,172,178,148,171,83,18,182,115,160,60,145,105,243,117,251,24,230,91,137,110,161,186,87,
+142,103,248,59,127,255,252,54,191,195,171,252,246,127,230,51,227,65,242,177,246,1,62,125,166,126,37,119,134,252,56,208,138,222,186,99,193,83,80,22,
+96,57,80,129,121,163,12,136,84,173,37,25,83,76,21,167,249,162,5,135,49,146,206,122,140,219,17,78,115,18,75,173,68,211,20,133,56,162,211,131,
+29,180,67,8,29,122,5,220,92,68,249,201,67,9,194,208,36,222,225,18,46,176,147,56,52,163,106,241,35,113,113,71,61,83,197,5,85,41,2,3,
+175,40,145,129,86,145,143,100,212,221,96,24,144,184,13,2,101,75,84,91,187,218,199,50,156,99,245,125,203,222,84,223,249,207,127,255,251,238,119,132,
+255,158,79,241,121,242,136,254,80,122,244,199,71,148,223,119,215,10,249,242,161,38,10,249,137,197,187,116,57,27,44,184,28,72,184,32,235,160,250,84,
+10,181,133,102,176,12,196,147,1,172,111,49,252,185,182,104,85,158,193,98,209,210,196,183,35,117,76,1,178,17,65,205,2,245,23,133,92,93,192,29,
+143,194,157,171,81,117,12,95,172,162,224,14,125,41,182,199,35,162,205,227,50,117,166,210,20,168,254,2,230,162,73,35,34,155,99,114,189,41,130,191,
+176,203,114,185,227,202,222,169,183,93,183,110,98,248,228,235,23,150,204,129,63,239,85,255,255,230,253,237,193,254,253,255,208,103,171,55,228,155,209,37,
+253,120,179,248,220,193,203,231,230,115,23,225,200,77,221,180,13,124,131,201,12,40,83,22,196,194,36,245,57,75,33,95,250,181,89,236,91,123,33,140,
+204,170,189,171,196,250,49,16,181,196,92,48,96,80,73,233,49,113,182,64,16,162,212,200,151,199,156,19,158,196,10,159,45,21,208,126,26,227,115,15,
+243,119,78,118,159,16,151,35,13,243,203,54,16,3,79,48,178,56,114,13,18,213,49,17,150,67,72,53,237,136,203,107,209,30,82,117,139,189,125,184,
+115,165,198,239,96,92,228,102,97,255,165,119,255,255,205,235,153,183,254,34,191,184,175,166,135,246,185,207,198,41,189,11,123,78,193,211,236,222,247,88,
+255,228,155,60,110,52,246,30,112,17,134,160,128,253,226,84,209,213,146,190,53,47,50,122,190,214,45,152,249,98,161,132,214,57,86,122,190,21,119,166,
+121,84,199,80,143,3,14,33,50,216,4,185,137,14,152,240,137,139,10,142,59,98,165,218,104,188,201,164,189,106,12,167,154,224,145,138,229,141,121,183,
+151,184,106,158,184,34,152,41,14,142,90,59,145,106,227,168,11,49,195,53,250,231,31,49,26,150,221,150,225,57,68,228,87,165,158,54,105,141,255,205,
+3,255,255,130,135,234,165,255,75,223,247,101,247,254,251,72,251,185,154,167,137,207,2,215,215,203,87,142,236,93,187,243,157,81,94,228,255,158,198,2,
+115,110,134,65,182,239,116,2,152,189,96,173,0,142,23,81,230,206,139,41,170,88,107,173,68,108,56,46,237,46,203,155,67,42,75,144,184,83,230,216,
+41,130,192,22,0,253,7,242,245,49,51,209,79,212,171,90,53,123,87,245,173,83,21,35,75,116,75,62,211,121,48,114,177,37,114,11,31,241,205,31,
+178,45,38,115,21,56,84,111,85,150,65,122,56,87,200,174,114,180,227,180,173,245,241,83,202,151,56,157,52,68,223,255,11,47,255,248,101,127,250,147,
+127,247,79,253,80,218,33,166,127,224,75,178,151,194,87,119,86,235,218,167,31,148,163,185,77,33,222,19,73,185,201,16,74,46,233,137,15,253,24,34,
+104,179,220,167,136,43,129,213,218,166,185,203,65,210,182,210,188,100,205,181,242,101,108,56,37,116,206,21,224,22,104,90,29,208,7,171,210,31,138,113,
+44,169,184,69,190,89,135,170,251,152,151,28,6,207,77,68,216,132,138,216,28,147,76,52,247,66,52,243,195,220,115,203,164,38,79,100,135,205,221,71,
+207,181,216,218,238,17,114,173,146,93,114,235,131,122,156,111,241,125,210,167,89,49,229,253,196,191,255,244,246,255,248,68,127,131,175,252,116,206,32,22,
+63,200,76,49,41,119,248,201,211,35,206,54,119,174,115,134,27,170,150,108,2,196,229,153,28,174,235,3,112,233,217,195,1,39,7,200,243,85,187,136,
+2,202,114,136,167,149,156,183,210,95,141,169,36,253,39,140,109,135,186,223,201,16,119,209,140,62,86,174,29,210,171,39,72,67,132,99,0,178,248,185,
+200,100,127,219,21,169,199,142,21,34,246,160,41,114,13,44,10,0,69,230,95,160,232,149,32,38,96,231,130,45,236,254,107,237,34,255,237,107,59,88,
+222,211,230,216,54,9,202,95,16,61,8,116,219,122,63,140,199,255,254,128,223,255,13,12,102,127,255,36,222,5,24,67,252,169,249,144,199,35,249,169,
+179,246,111,189,217,100,117,217,164,12,213,222,71,231,132,67,100,24,199,78,96,183,215,104,128,133,170,177,172,139,6,241,211,222,199,99,78,40,232,111,
+181,46,235,180,99,168,192,217,57,47,20,67,37,252,9,114,132,11,177,184,58,134,75,54,38,5,58,241,97,140,216,87,192,117,106,203,174,48,226,138,
+226,169,74,56,174,98,3,9,86,85,96,82,161,33,228,109,228,138,17,234,194,29,170,162,164,168,175,20,54,51,148,204,202,230,7,124,90,203,227,55,
+146,30,68,186,237,219,231,222,235,255,248,97,127,255,198,226,91,127,255,38,240,61,78,143,213,127,62,20,73,244,145,212,5,41,190,226,244,80,214,22,
+249,178,126,224,59,52,100,1,26,58,76,10,77,83,34,253,37,139,208,84,218,247,88,110,97,37,130,134,91,214,248,198,83,5,138,116,98,93,35,138,
+118,76,225,145,166,12,100,75,116,132,194,2,126,134,250,25,35,114,200,162,14,234,104,170,142,48,7,41,247,165,71,179,241,108,17,133,89,242,175,31,
+148,119,1,3,163,22,145,19,59,208,77,65,114,223,51,118,75,65,24,6,190,76,46,232,39,43,251,84,219,158,255,121,132,227,179,179,29,235,249,190,
+127,252,19,191,255,252,105,159,39,255,10,63,162,15,192,67,254,21,115,1,155,79,82,222,48,160,29,224,147,26,80,6,240,125,194,83,56,145,155,150,
+245,225,116,148,44,24,36,98,208,33,91,93,69,154,228,218,57,75,27,98,75,67,97,73,150,117,57,177,168,168,85,57,169,245,19,137,24,58,147,16,
+41,161,125,17,162,176,176,9,113,155,39,179,169,63,84,187,85,21,3,95,85,69,86,213,135,71,53,21,62,115,187,59,18,103,49,81,253,32,18,71,
+22,18,127,32,50,153,56,83,91,81,213,103,106,88,26,194,230,93,243,197,170,205,202,239,219,144,14,89,186,99,223,134,68,159,255,59,143,255,252,22,
+61,217,63,250,227,253,181,250,190,125,172,254,20,244,190,251,216,204,6,177,186,71,228,78,18,92,14,192,144,109,113,51,201,226,193,178,28,150,34,157,
+241,220,12,124,85,50,80,82,46,127,79,177,159,134,136,81,140,226,89,29,12,83,48,196,126,108,145,153,74,88,209,198,39,232,200,2,177,147,18,65,
+176,143,66,115,149,73,125,184,9,64,186,10,135,165,155,172,154,43,58,162,137,198,170,184,229,161,41,46,141,153,165,132,185,101,142,40,214,156,120,250,
+163,154,45,167,235,171,182,28,99,100,99,53,90,241,215,135,9,220,87,114,111,209,31,65,118,24,255,230,177,255,255,62,15,252,71,191,254,184,126,130,
+170,245,98,191,243,137,224,61,244,15,221,92,1,188,150,85,206,134,181,139,125,48,24,163,235,78,0,41,110,228,24,169,248,239,75,217,82,185,65,24,
+86,228,152,96,72,155,158,195,110,108,221,131,244,103,183,94,83,108,51,166,200,151,215,94,0,104,101,33,224,213,183,146,205,139,240,242,180,248,111,67,
+252,178,83,150,12,35,19,17,211,123,73,151,27,14,214,221,31,146,155,75,48,134,72,176,181,23,83,177,4,68,139,31,243,61,94,83,69,128,171,93,
+193,190,109,177,211,179,141,116,239,55,147,110,34,186,179,233,230,131,31,223,243,255,255,192,179,254,179,159,238,11,254,250,249,219,106,91,250,15,153,125,
+24,127,55,220,135,62,21,241,103,58,30,24,102,133,43,212,85,16,192,166,11,168,177,39,116,11,176,98,78,237,37,168,141,86,109,224,160,81,192,26,
+210,85,226,220,217,201,180,252,156,132,105,49,146,36,234,240,42,17,108,70,176,250,215,208,83,205,252,177,161,98,3,138,254,225,161,251,36,82,53,100,
+119,49,21,184,103,140,122,70,169,104,13,49,104,4,148,169,182,135,2,113,129,89,102,161,200,147,182,105,197,179,204,32,90,54,130,113,247,167,173,208,
+107,227,151,110,38,122,31,232,178,160,63,189,167,255,255,10,175,254,90,222,122,191,255,68,223,70,238,152,127,23,124,141,70,63,242,163,43,172,95,252,
+116,110,93,230,98,97,72,115,113,185,247,69,125,174,154,64,206,169,85,17,106,30,89,178,220,150,106,202,122,228,24,163,101,225,84,205,3,42,181,106,
+204,27,160,205,119,231,174,130,68,126,133,122,7,65,72,33,5,224,161,99,60,155,232,122,59,48,153,32,55,31,97,19,53,133,57,37,177,154,120,143,
+139,59,133,185,247,151,88,41,163,136,27,22,249,69,134,26,122,140,250,120,171,170,78,195,253,184,100,187,56,57,168,222,102,198,248,182,229,31,146,190,
+189,180,25,253,2,63,255,176,71,255,250,133,124,124,127,249,131,143,18,205,127,139,248,203,229,11,219,175,40,113,13,248,120,194,91,48,156,93,235,53,
+204,22,187,7,134,130,248,253,53,190,51,208,182,129,102,150,143,133,159,149,235,45,149,163,149,131,50,140,193,18,220,24,16,84,66,163,147,166,144,4,
+49,158,97,94,146,96,202,3,248,73,134,44,109,73,237,36,205,45,105,212,37,63,218,69,27,216,189,64,81,101,94,75,253,23,204,84,148,77,140,75,
+74,132,113,197,172,185,69,172,213,77,12,230,214,173,70,222,14,6,49,39,156,236,236,108,139,116,156,23,242,165,202,191,100,26,47,249,70,127,254,236,
+31,255,250,139,115,249,255,192,255,185,207,143,215,253,51,82,222,96,254,193,51,17,164,126,234,180,175,3,142,129,240,68,130,141,61,242,100,192,102,128,
+81,190,88,222,33,129,45,92,45,50,12,235,140,244,242,172,25,191,4,21,53,178,186,52,219,180,96,129,245,161,168,232,194,148,220,69,166,10,102,192,
+43,72,128,165,21,144,114,79,209,205,66,245,191,50,22,221,75,84,247,105,115,179,93,116,121,55,116,245,37,211,107,46,209,125,48,49,73,30,50,95,
+20,19,3,39,115,29,72,244,39,98,246,199,121,184,223,200,14,129,181,99,177,174,14,248,120,229,23,158,158,44,175,57,255,226,129,255,254,204,31,247,
+170,255,248,209,252,40,208,105,34,255,225,83,153,167,99,127,54,244,160,236,167,79,216,81,206,110,198,36,237,25,52,211,155,84,243,108,100,191,1,131,
+192,184,47,113,130,202,32,246,57,254,67,27,6,45,240,24,115,134,101,40,39,85,174,146,105,97,217,47,132,154,184,176,125,58,67,28,20,219,115,25,
+104,149,138,211,211,130,66,198,178,184,186,196,204,200,212,237,234,198,213,227,78,52,186,89,36,32,81,252,171,193,253,29,64,112,158,75,44,12,81,212,
+111,77,133,97,205,29,225,90,213,235,102,19,22,250,146,215,46,195,56,225,225,27,155,94,139,51,59,230,241,255,254,3,159,255,201,187,134,247,255,241,
+135,54,241,170,234,135,250,30,231,221,243,5,226,247,9,47,156,72,172,81,95,30,208,26,134,42,79,131,65,63,15,172,183,18,81,119,50,102,49,76,
+172,46,145,5,206,55,16,164,203,19,77,231,216,225,149,43,138,196,104,20,141,88,241,66,249,90,173,4,19,112,102,71,226,189,116,37,7,3,208,120,
+131,24,162,56,122,217,139,188,138,199,149,137,93,100,66,225,6,76,102,134,203,32,248,171,163,186,15,233,214,33,134,130,79,224,22,169,34,62,131,235,
+138,100,176,151,104,24,43,206,206,43,54,63,175,61,164,242,149,193,151,73,220,242,197,127,245,158,255,255,222,11,255,147,39,46,31,255,192,159,164,246,
+34,255,30,94,85,236,73,246,51,169,104,250,125,153,233,65,164,110,16,241,4,208,61,57,1,40,232,98,140,98,207,37,40,105,125,75,242,246,149,226,
+175,166,122,84,110,203,83,24,138,43,106,13,54,107,122,96,184,229,152,1,60,243,153,77,144,39,159,152,169,132,77,74,147,116,11,5,101,193,192,241,
+220,82,244,184,226,94,64,237,122,197,99,238,254,35,234,125,234,130,0,170,118,39,226,118,133,225,144,114,35,242,27,170,18,42,41,150,175,167,255,12,
+214,179,137,236,233,228,59,108,27,7,221,223,41,220,56,245,147,197,166,179,95,249,199,127,255,248,95,124,140,63,192,143,255,50,31,168,247,204,127,219,
+77,153,240,77,244,167,102,120,213,251,29,219,155,154,12,110,99,125,199,14,198,8,58,135,56,121,40,221,124,166,64,189,89,182,71,26,249,152,202,85,
+227,43,107,245,96,53,135,53,210,45,173,102,42,141,77,114,118,208,164,129,35,198,30,162,166,16,96,93,13,49,94,135,25,101,166,185,56,178,26,72,
+164,251,130,157,139,38,169,137,208,176,249,91,160,185,243,139,201,254,139,8,240,150,232,55,152,24,227,143,58,6,146,122,116,169,186,162,193,21,222,99,
+183,54,57,177,218,134,210,56,40,228,155,143,14,189,180,143,241,220,255,251,34,127,255,239,105,42,127,251,52,253,214,254,42,95,222,31,130,168,71,121,
+229,231,67,14,252,152,120,97,191,7,54,210,217,69,141,208,242,28,132,248,16,228,97,12,156,245,161,48,179,220,4,19,43,57,236,113,36,137,190,20,
+252,49,36,203,130,93,25,88,80,74,125,214,24,119,201,106,59,50,140,52,224,254,22,16,158,9,168,45,151,121,141,155,234,131,163,204,176,229,2,48,
+74,6,208,130,2,32,58,8,0,82,6,160,112,6,128,60,7,32,22,1,96,52,6,48,1,6,208,171,4,145,31,11,112,237,22,208,205,25,145,73,
+18,49,209,15,209,127,21,16,173,42,187,142,127,67,111,247,38,104,143,255,255,210,167,128,159,228,153,249,47,127,249,88,255,89,229,86,246,109,243,92,
+126,213,23,79,11,160,110,219,193,88,126,111,227,228,245,207,86,235,18,158,220,47,178,54,26,229,85,123,237,63,115,134,108,181,51,181,101,250,99,56,
+27,112,141,151,68,174,74,128,119,33,206,220,140,234,40,229,152,239,231,132,100,37,158,95,138,146,59,129,106,90,37,200,95,97,184,28,132,62,81,194,
+74,10,67,72,44,99,212,3,160,70,50,130,14,31,64,56,23,33,200,35,32,54,7,34,182,2,34,190,33,225,118,57,225,182,48,99,34,32,99,154,
+33,162,122,35,34,75,163,87,252,36,63,160,38,209,127,255,255,209,255,16,111,216,227,80,79,254,1,255,245,190,192,79,187,79,215,19,131,58,26,65,
+248,219,40,167,168,147,157,180,79,52,46,95,250,60,26,70,64,61,145,181,143,134,52,227,53,21,222,34,139,226,187,99,108,204,109,12,157,111,15,81,
+235,147,181,176,2,200,150,78,18,135,19,66,242,145,11,196,48,184,251,164,244,28,212,48,144,205,125,87,23,236,195,130,136,234,213,16,228,69,184,153,
+13,253,25,6,228,4,76,8,208,203,120,40,197,228,169,12,100,67,128,212,168,198,200,186,66,84,7,205,60,44,9,220,108,64,24,209,64,160,106,198,
+36,145,186,198,127,238,25,234,113,254,28,255,255,255,156,95,252,21,62,42,23,3,254,29,127,248,140,123,220,223,175,245,136,252,28,121,18,28,196,136,
+227,220,123,71,30,95,147,222,183,206,46,68,239,4,189,154,179,185,164,178,133,96,67,180,213,235,77,210,79,153,113,226,221,21,84,93,165,86,58,178,
+202,54,24,164,209,178,203,105,144,44,211,69,150,164,110,65,41,54,165,191,9,68,243,41,86,238,135,171,11,6,218,22,188,179,54,156,17,7,39,123,
+115,32,120,125,28,146,152,168,225,29,138,217,234,41,41,101,8,25,157,153,130,90,132,48,28,162,153,29,30,152,147,131,210,55,140,113,95,135,124,38,
+62,161,31,253,193,152,135,255,229,99,255,254,246,255,255,192,16,148,189,80,224,135,251,175,126,22,173,109,243,112,254,123,255,135,149,0,106,51,215,19,
+73,89,183,37,17,246,170,193,177,6,216,176,60,115,242,195,144,3,88,246,166,19,137,87,100,2,159,141,86,163,194,12,46,225,100,121,47,47,122,185,
+197,34,175,236,176,47,176,133,141,100,162,74,32,161,34,223,14,6,137,7,85,116,133,123,156,20,169,74,183,227,128,167,128,72,32,59,127,40,169,40,
+19,242,121,173,145,180,130,89,153,43,25,205,16,217,67,152,82,166,139,32,135,159,201,57,36,72,45,128,74,46,144,113,232,137,150,56,95,218,3,255,
+130,199,244,183,255,254,138,191,238,79,255,254,249,159,85,222,220,125,165,41,129,228,171,170,22,164,95,143,159,241,6,231,202,118,190,91,94,170,253,79,
+13,30,73,251,21,90,102,23,8,124,177,176,6,31,16,202,33,96,64,14,81,178,5,18,143,57,196,167,10,1,28,99,180,118,76,177,233,48,135,191,
+59,226,227,65,52,138,114,50,92,2,245,43,85,5,35,14,34,88,83,85,50,42,176,121,64,164,145,67,32,131,27,84,150,59,242,134,14,66,215,64,
+35,3,8,129,110,59,50,162,38,81,93,22,68,31,17,1,197,43,81,36,62,16,41,15,19,31,18,132,13,82,14,194,223,246,104,254,219,223,255,154,
+239,255,220,108,220,255,255,51,15,249,247,209,255,244,220,235,114,79,52,198,157,231,134,191,175,180,107,115,243,250,99,121,215,217,227,47,78,238,62,5,
+81,125,129,223,7,13,2,101,132,202,213,77,185,243,71,142,252,46,34,130,153,128,164,172,105,156,134,34,42,44,136,150,20,194,230,80,160,68,71,98,
+98,24,227,66,26,225,202,29,33,174,9,161,94,13,96,116,22,32,208,7,64,206,34,64,82,9,194,24,14,34,4,12,0,138,37,0,242,5,193,20,
+30,160,232,16,161,218,6,66,226,20,97,54,57,32,242,48,35,26,21,100,2,32,226,54,56,33,30,79,173,225,198,51,255,151,39,133,199,252,117,127,
+255,249,67,252,78,191,182,101,232,127,209,143,255,147,103,210,229,77,121,119,78,4,232,227,177,14,45,149,122,156,67,222,118,62,61,221,78,110,13,85,
+238,76,253,138,167,130,191,251,174,109,123,84,228,134,192,39,51,105,159,141,60,223,175,27,17,1,11,139,108,166,163,82,3,169,41,39,213,224,48,181,
+87,94,199,81,15,129,192,103,148,140,44,82,61,64,228,187,33,129,12,53,212,14,29,208,51,49,162,231,40,0,140,27,147,44,27,16,86,28,2,101,
+27,192,139,25,81,152,36,240,65,1,66,175,8,33,185,30,16,50,44,80,179,14,82,139,2,1,247,18,179,22,228,137,255,167,55,173,103,227,179,255,
+255,249,211,254,13,31,145,113,1,127,185,79,249,118,26,31,227,15,253,169,60,0,66,251,44,137,36,145,147,109,31,52,160,114,206,106,180,239,217,243,
+77,58,144,63,230,106,60,28,167,98,108,121,93,106,43,82,97,228,183,126,81,213,37,11,25,93,98,147,43,130,175,144,221,29,40,142,37,10,125,77,
+184,96,34,218,231,194,154,60,101,208,84,80,121,124,68,27,34,246,136,113,244,44,22,164,251,108,163,139,0,36,178,83,244,52,2,3,41,80,163,173,
+7,226,108,73,115,4,23,210,181,45,100,57,1,32,80,69,113,186,41,210,85,20,68,15,2,224,145,50,113,134,237,165,253,221,191,232,113,255,140,159,
+255,251,109,218,207,255,215,243,220,119,154,110,104,30,183,95,236,187,252,31,20,215,199,55,241,136,233,170,176,152,74,89,182,70,133,128,15,33,24,241,
+69,162,3,51,16,152,28,55,141,186,99,183,186,136,248,159,207,42,246,178,32,6,217,143,215,186,123,32,52,239,86,197,139,81,212,192,214,84,147,151,
+31,4,16,156,44,48,18,157,33,96,161,24,19,214,36,199,177,130,18,42,138,107,71,57,42,116,8,82,95,184,226,13,131,18,58,45,186,63,4,105,
+175,168,18,67,132,64,251,41,217,143,17,249,116,150,2,115,129,208,2,37,41,7,23,169,10,141,162,129,149,215,49,207,226,249,255,203,35,255,125,95,
+255,170,143,247,239,255,255,136,119,230,195,195,223,88,205,195,189,134,107,113,228,69,252,48,127,12,8,12,240,25,249,185,117,97,142,197,219,51,79,200,
+96,149,77,110,56,71,74,70,197,68,17,65,62,86,0,168,92,234,124,137,32,118,129,207,126,148,3,62,187,173,8,241,96,20,96,16,251,84,227,71,
+77,213,252,124,17,144,30,199,65,93,227,117,38,53,112,100,179,58,21,132,185,95,227,19,3,212,128,76,243,218,7,131,5,80,35,49,7,226,190,67,
+211,26,16,82,139,49,131,215,2,64,170,67,17,206,37,178,103,22,100,19,1,48,137,56,145,100,53,18,128,195,91,253,239,63,204,83,225,211,255,255,
+155,175,174,63,255,86,196,140,255,166,79,247,112,148,77,17,68,47,185,215,142,93,105,184,196,124,253,126,77,82,61,196,47,218,147,174,173,84,42,189,
+177,222,247,206,198,138,247,180,166,203,160,25,99,186,193,56,255,196,36,230,146,126,88,182,4,185,69,131,144,236,139,40,127,138,88,222,136,88,128,145,
+152,9,140,216,195,132,33,37,128,224,0,15,216,196,8,200,55,141,48,217,139,32,71,8,185,36,6,136,46,13,112,182,140,176,15,7,136,220,11,24,
+10,4,160,247,133,176,136,139,248,54,18,40,85,133,121,56,129,40,239,141,152,40,146,168,76,135,200,74,220,75,254,8,159,194,200,3,255,255,255,148,
+92,8,255,18,79,207,187,255,225,99,253,245,159,59,218,167,169,32,4,182,153,63,240,254,226,251,85,44,85,60,17,252,226,166,71,50,31,11,174,139,
+183,40,145,134,200,60,123,38,174,120,184,238,101,119,49,226,4,161,109,150,35,130,28,174,249,64,246,158,31,86,223,113,39,187,0,18,108,122,20,6,
+44,83,145,60,165,63,14,96,232,66,243,56,30,241,21,44,2,239,28,160,184,28,242,226,17,240,62,32,193,183,28,96,66,15,241,236,20,48,34,12,
+33,197,12,64,219,21,176,114,32,48,167,9,242,59,4,81,187,26,144,123,35,176,199,15,113,185,24,124,143,63,114,15,252,123,177,139,255,255,224,183,
+249,238,255,200,211,168,199,248,59,201,179,249,135,127,204,191,233,208,85,91,28,233,248,48,229,238,41,214,170,186,108,206,36,49,165,15,41,105,10,175,
+95,9,205,235,236,248,201,217,118,239,69,77,178,77,192,75,64,122,60,0,61,65,112,8,166,216,4,64,186,234,49,146,56,88,29,201,74,99,227,76,
+120,18,185,124,132,63,67,23,52,130,233,151,15,83,76,183,65,207,136,218,185,46,122,4,7,129,226,174,113,152,131,17,208,35,137,203,3,9,77,159,
+17,195,130,192,181,32,249,29,15,41,56,142,225,255,128,232,37,158,152,154,20,120,243,135,145,232,128,142,42,31,46,175,255,101,207,76,127,255,143,143,
+255,232,11,255,252,125,26,79,172,110,114,255,235,41,252,163,97,201,243,68,253,200,125,134,134,47,1,253,141,158,4,77,149,8,247,17,229,206,145,50,
+46,247,238,112,81,229,184,230,7,179,40,42,138,161,227,5,56,176,223,155,70,32,242,220,29,185,110,214,146,150,225,184,205,150,97,140,210,52,185,60,
+132,166,194,88,198,185,38,248,105,38,57,170,190,132,52,209,200,117,26,94,2,72,146,15,235,224,210,234,4,16,136,50,208,200,114,20,7,60,175,104,
+64,37,230,66,134,137,110,14,130,76,162,37,84,85,37,110,69,73,166,8,128,174,134,100,32,107,96,15,37,239,202,147,255,87,197,241,255,253,63,127,
+255,11,127,255,6,46,100,31,202,22,78,221,153,171,239,214,23,251,100,126,34,115,236,239,253,244,195,244,202,88,58,173,241,174,181,250,245,61,210,244,
+176,160,206,2,0,70,34,145,23,132,34,170,55,138,187,0,99,57,194,113,219,192,253,80,37,70,205,69,58,217,111,253,19,176,212,51,200,243,181,65,
+247,164,75,103,65,132,168,7,233,205,219,120,242,198,213,117,153,237,3,4,177,32,217,216,221,192,177,26,148,85,10,128,36,194,211,168,241,66,48,145,
+18,132,194,134,172,171,203,57,23,64,144,14,17,148,116,10,228,146,197,81,8,193,88,41,203,45,225,191,93,143,241,196,249,66,127,255,243,249,255,133,
+31,107,143,254,77,223,254,113,62,7,216,216,64,223,82,95,59,9,86,239,27,249,144,124,42,236,9,188,215,165,31,149,132,19,100,167,199,203,44,24,
+171,60,68,205,233,40,106,162,206,204,72,134,67,65,224,49,96,200,3,98,2,45,161,200,94,33,62,12,200,238,51,132,118,103,36,236,155,96,56,19,
+137,238,95,133,14,68,38,108,143,35,116,26,135,34,129,4,66,12,38,188,110,101,160,20,132,114,128,3,214,1,5,172,95,35,168,22,197,98,82,195,
+26,47,100,4,98,224,22,12,134,214,29,66,250,85,34,8,92,162,142,8,198,126,4,193,198,61,178,10,254,18,95,206,131,216,251,255,255,168,95,242,
+241,179,71,255,148,7,254,220,42,5,243,122,231,142,56,178,254,170,39,114,62,182,197,161,214,183,229,121,163,91,68,248,125,117,139,181,5,40,54,45,
+216,209,1,224,243,141,84,193,201,66,9,145,217,105,128,112,84,149,132,53,113,129,36,3,157,1,80,97,38,144,125,20,145,133,21,176,219,24,17,129,
+2,49,255,10,208,10,35,144,156,7,81,165,25,129,63,4,241,180,27,145,56,14,225,113,35,224,67,7,210,80,21,48,180,22,1,183,24,64,29,22,
+81,150,24,240,163,12,130,103,1,64,135,39,16,100,29,49,209,2,66,155,14,80,135,40,176,1,25,241,42,172,231,251,15,126,162,14,117,255,255,246,
+5,222,151,214,35,253,228,191,252,204,124,143,188,67,62,31,55,38,137,96,59,100,11,211,25,251,241,89,247,84,231,138,150,156,184,188,51,247,210,77,
+237,90,250,49,80,117,34,244,34,199,126,5,14,109,97,154,92,27,59,47,201,18,16,32,192,143,208,109,60,160,241,87,19,218,65,82,11,31,4,165,
+4,128,57,55,49,46,25,145,167,15,193,217,2,80,108,20,144,176,0,32,111,14,192,27,4,96,200,0,0,156,8,0,42,9,32,56,2,128,74,0,
+176,9,1,208,79,6,80,133,9,240,197,13,176,247,17,113,21,19,241,67,19,113,97,20,17,53,19,177,21,29,149,238,213,35,255,104,143,23,175,85,
+223,255,255,200,175,194,91,239,69,207,171,255,159,95,247,194,152,247,231,7,244,74,130,140,2,88,98,90,208,209,27,125,234,55,241,169,181,183,185,155,
+244,10,70,59,152,245,198,206,76,162,178,180,220,254,250,197,133,129,238,115,146,45,74,155,55,95,45,95,18,234,186,178,122,72,119,75,141,84,124,192,
+17,53,36,218,163,193,254,222,237,80,169,163,178,156,205,102,84,67,4,167,41,252,56,228,6,154,135,86,43,69,152,116,167,12,4,4,54,124,196,30,
+0,229,52,97,35,48,13,5,98,68,3,114,50,34,236,97,160,158,0,102,122,15,131,46,79,97,44,85,34,78,4,5,254,24,245,214,242,202,255,241,
+240,138,159,254,75,63,255,250,145,255,245,186,226,241,109,31,216,79,253,241,178,69,248,160,255,130,103,159,232,17,240,192,197,157,157,23,136,111,149,14,
+70,133,165,48,220,230,160,42,136,250,44,100,111,8,233,76,102,199,146,49,194,205,151,54,139,74,132,5,4,178,9,146,0,101,86,118,189,17,33,76,
+217,105,87,180,253,142,58,144,241,42,65,246,165,138,228,65,66,49,94,163,62,193,128,18,200,240,8,73,177,11,101,102,129,59,34,112,85,246,46,27,
+178,51,91,196,119,20,195,0,79,51,154,9,19,119,62,227,131,16,242,82,77,49,20,4,212,69,32,194,185,39,145,160,64,112,69,5,196,45,23,174,
+43,95,137,55,255,115,79,242,67,255,248,0,255,245,15,255,255,15,237,27,251,26,184,95,229,221,230,247,122,159,232,209,251,101,230,165,195,75,212,47,
+166,192,127,205,111,14,4,103,6,164,212,39,1,115,40,102,42,114,247,76,38,40,69,208,105,102,207,14,118,20,35,64,5,114,169,140,131,13,94,15,
+51,42,147,136,103,183,213,51,216,48,2,99,175,19,6,129,56,119,182,141,233,138,24,84,44,93,56,149,209,77,242,152,20,70,19,233,172,213,24,38,
+145,181,172,141,44,43,212,145,78,74,232,110,18,237,26,135,212,162,207,129,29,192,88,99,148,36,126,5,116,242,201,130,89,210,140,200,171,35,136,80,
+3,121,209,167,167,197,243,249,203,127,193,43,255,249,254,255,244,225,231,131,255,254,1,31,234,171,103,222,120,83,24,233,162,242,222,165,31,168,223,156,
+36,161,189,194,254,161,152,31,201,55,183,70,208,48,202,158,101,146,233,116,9,72,170,252,132,74,10,4,220,2,32,242,17,66,176,101,163,164,2,168,
+174,118,134,222,87,103,140,203,225,60,44,141,230,117,132,154,150,41,104,172,225,134,102,204,186,96,0,84,150,233,240,90,226,190,145,8,226,68,196,112,
+127,104,192,21,227,186,145,69,202,24,5,164,115,101,100,4,197,130,101,196,162,33,228,44,117,97,32,1,7,50,45,4,34,77,226,84,108,97,174,2,
+134,230,18,66,242,24,242,8,254,180,223,205,35,173,215,255,255,179,175,226,211,195,203,255,175,119,255,156,78,168,94,144,221,62,192,22,175,209,58,238,
+47,231,112,172,60,65,254,165,156,255,67,83,180,215,137,222,167,143,121,175,47,34,8,130,174,254,86,150,167,89,231,82,157,60,97,134,117,98,94,17,
+108,66,92,200,150,204,101,2,116,241,197,128,155,71,140,11,9,252,54,195,12,109,66,124,57,195,180,41,65,180,32,193,212,11,1,172,4,129,240,23,
+194,208,25,128,156,71,0,40,14,132,64,22,66,96,35,2,52,46,128,236,35,65,232,63,65,188,9,69,212,23,195,180,100,65,228,101,69,116,48,71,
+148,64,196,52,107,194,132,121,80,251,38,79,252,124,62,47,91,165,255,255,254,142,118,226,251,213,124,108,63,252,94,127,132,70,103,95,150,127,162,192,
+230,185,72,94,226,165,31,245,237,234,113,202,6,110,153,114,118,41,231,204,57,56,245,246,156,200,76,10,180,34,218,182,188,201,49,132,190,75,16,61,
+92,219,10,88,180,246,21,82,159,240,218,51,119,105,132,164,25,195,189,38,162,114,120,64,198,207,234,216,133,164,94,135,203,26,54,195,48,144,103,220,
+35,99,222,129,197,122,27,5,36,92,101,116,14,131,146,101,194,206,6,36,116,75,98,44,15,132,138,49,2,154,48,226,28,80,33,50,3,101,162,1,
+66,198,73,224,88,72,98,158,2,37,42,35,243,110,237,245,255,224,52,114,31,240,5,255,255,240,41,255,188,199,146,82,245,255,138,207,251,236,72,239,
+237,127,253,105,186,117,161,158,195,210,209,25,37,90,107,169,67,207,185,89,175,15,180,195,220,185,158,240,25,168,185,165,76,181,57,200,216,115,106,167,
+162,5,114,196,134,173,25,14,196,168,143,44,191,88,103,239,94,217,146,85,4,180,17,138,144,176,84,49,151,55,136,212,11,193,69,112,162,102,166,1,
+76,205,47,4,122,227,38,201,139,234,96,5,168,167,43,52,35,164,226,176,7,206,25,198,84,149,38,52,4,230,250,115,134,14,43,100,152,143,33,88,
+2,104,86,54,196,190,83,226,252,118,225,42,14,72,10,25,90,242,125,100,63,252,102,191,41,191,255,80,127,255,174,207,255,243,60,113,126,179,185,58,
+255,33,175,3,221,222,255,191,135,230,183,86,206,99,158,58,59,147,17,180,103,231,164,0,224,62,48,13,248,125,34,237,27,105,66,193,9,14,167,63,
+100,197,135,92,27,20,85,92,213,157,154,223,178,142,37,121,21,209,178,78,163,207,6,106,205,174,0,135,75,238,51,140,10,146,48,148,143,57,61,31,
+116,84,220,248,109,212,118,7,11,186,15,75,56,222,170,0,38,73,230,218,5,234,39,43,32,167,228,196,71,10,22,140,67,46,94,232,64,139,160,122,
+61,138,90,58,130,10,131,36,240,111,35,206,50,72,242,13,192,58,129,167,241,233,137,252,97,63,240,124,255,250,227,255,249,118,253,49,255,255,207,147,
+248,162,235,91,171,150,181,221,101,207,207,240,210,252,142,240,28,240,16,250,204,246,12,130,247,47,62,143,74,91,24,188,165,30,92,5,161,68,130,164,
+64,88,128,88,7,34,192,66,70,234,89,2,12,166,233,172,63,41,122,189,202,218,74,234,92,251,97,204,90,16,117,61,192,113,112,245,162,57,116,49,
+92,197,201,10,180,118,104,82,142,35,69,189,76,192,91,60,53,168,40,177,51,81,3,227,20,67,100,67,83,14,18,131,147,61,193,29,36,243,150,46,
+112,215,38,131,235,7,96,180,64,145,72,16,179,107,24,226,121,36,145,66,51,176,221,12,36,133,92,14,139,159,226,249,253,97,191,192,151,255,251,199,
+248,57,255,224,253,201,251,255,145,79,237,40,183,87,133,117,189,197,128,211,178,15,206,226,242,57,196,253,36,58,142,131,151,109,110,210,182,220,174,182,
+220,185,222,5,181,29,113,92,100,51,195,155,115,249,138,98,178,52,185,116,7,226,29,145,192,163,146,216,86,14,120,185,133,88,176,139,24,160,133,168,
+223,136,24,38,144,120,26,130,72,254,133,192,75,139,72,180,8,8,58,141,0,165,132,176,176,10,168,185,5,208,133,143,32,13,132,136,235,7,40,6,
+138,64,189,130,208,51,14,24,66,4,216,223,131,96,193,139,216,8,16,232,139,131,73,40,133,72,109,144,136,24,140,152,164,86,219,252,203,63,64,234,
+245,127,255,250,103,251,146,248,161,127,203,187,253,206,110,175,254,232,223,147,106,139,101,12,123,48,91,98,204,133,185,72,227,249,96,46,219,61,158,132,
+47,95,191,27,203,97,189,175,57,141,99,84,235,9,45,79,234,124,160,215,255,189,98,9,195,190,181,81,107,36,216,131,76,100,162,14,202,61,170,32,
+29,174,50,177,136,42,119,41,4,176,33,66,86,10,198,52,193,136,133,101,220,26,36,190,103,67,158,16,37,120,68,162,12,56,195,222,62,129,80,43,
+228,112,12,225,94,60,66,122,2,162,52,55,160,144,3,3,194,11,65,202,56,96,88,53,98,238,5,164,58,33,97,54,69,33,22,28,35,142,52,246,
+80,243,2,255,231,36,59,255,245,163,255,255,205,55,254,44,30,93,132,77,255,16,95,241,254,91,239,225,79,251,48,78,119,0,125,14,8,84,151,193,
+246,192,208,149,34,29,77,50,169,111,44,72,183,71,196,225,151,180,63,219,185,93,104,39,179,101,144,72,207,10,44,138,89,34,5,88,153,206,0,31,
+105,99,79,71,83,104,25,131,76,228,21,91,170,126,232,240,65,210,3,115,98,93,101,87,188,86,242,9,101,230,191,29,99,224,101,148,144,15,164,153,
+92,97,157,34,181,116,54,48,64,63,36,41,34,33,198,63,19,32,8,114,255,50,98,117,27,50,74,58,112,107,14,132,5,9,64,157,57,113,34,30,
+146,137,20,194,235,8,116,62,239,137,254,236,31,125,143,243,17,255,255,87,156,22,127,252,97,56,106,244,73,95,127,236,125,252,140,86,11,240,212,253,
+68,119,34,197,51,151,142,100,132,252,201,172,92,116,1,136,102,114,120,39,20,177,184,52,88,64,14,192,150,187,111,72,25,95,134,149,128,13,74,251,
+135,61,235,83,213,250,158,32,89,13,171,83,175,161,89,83,118,45,70,159,9,121,15,62,9,149,193,18,59,164,8,154,81,133,93,224,204,113,215,196,
+44,147,135,121,69,43,3,197,182,96,243,86,45,197,117,82,64,53,60,149,120,45,49,163,70,132,125,6,162,104,80,113,228,0,132,127,40,226,31,51,
+242,98,58,49,157,24,68,57,1,0,120,71,178,114,225,201,248,39,127,239,245,251,55,255,249,12,255,250,9,255,252,110,177,46,253,103,218,27,138,114,
+133,125,195,255,86,232,146,249,199,254,171,146,248,137,197,47,200,59,128,139,38,91,170,180,112,166,70,3,163,63,162,68,16,97,103,75,32,64,61,151,
+146,58,114,197,130,179,241,133,115,28,73,125,44,7,202,66,239,24,96,46,187,6,7,45,49,246,236,139,184,175,31,4,95,211,232,8,29,141,187,13,
+20,253,91,225,98,192,125,88,153,68,205,11,33,98,213,48,4,206,157,121,138,44,80,212,33,7,195,248,198,146,132,167,2,153,5,205,8,107,203,148,
+189,13,212,88,199,97,22,64,24,21,145,44,68,132,164,217,70,216,177,192,193,188,63,40,47,232,149,244,62,255,255,30,95,251,213,192,95,255,241,218,
+255,100,121,56,241,224,145,214,243,98,215,241,230,250,134,222,59,173,199,205,143,172,51,248,114,219,234,52,182,50,1,207,210,26,224,65,30,229,203,46,
+163,110,23,49,20,19,224,244,32,210,8,9,132,27,61,1,211,65,52,236,78,50,43,71,7,49,11,98,104,125,179,120,8,118,165,83,99,117,63,213,
+116,88,144,165,68,70,73,39,226,34,88,244,182,5,115,167,89,66,123,18,149,12,61,177,74,54,132,53,49,129,38,57,51,230,18,18,87,58,130,247,
+13,114,118,64,16,122,12,36,43,21,193,15,56,113,170,40,210,89,22,3,93,13,240,218,73,21,26,229,73,253,115,191,200,219,248,144,255,255,41,191,
+189,239,254,43,157,172,191,244,233,250,5,69,154,18,184,240,244,148,31,111,48,127,181,229,224,244,107,250,18,115,159,0,206,153,156,201,233,201,70,108,
+174,111,216,39,81,41,165,33,210,147,27,142,31,120,58,20,49,32,129,240,12,5,72,181,129,248,32,151,216,80,8,153,192,141,145,72,150,25,27,31,
+200,136,142,178,86,135,192,91,34,201,89,6,73,129,156,209,18,136,153,195,23,200,120,20,177,139,148,96,143,19,249,179,4,8,180,154,144,238,129,153,
+57,21,232,108,8,1,121,139,96,76,148,232,188,15,248,243,136,1,116,136,72,28,25,184,27,133,25,106,131,240,220,129,36,172,63,169,231,238,37,220,
+163,255,255,175,255,236,11,124,207,254,225,223,239,215,161,143,248,85,122,0,142,108,155,168,113,153,202,146,115,116,243,137,210,203,18,15,52,95,10,192,
+155,219,215,198,226,192,111,59,199,219,54,52,132,182,134,64,243,4,70,74,104,208,208,190,91,94,58,205,138,61,235,188,242,162,68,61,204,234,75,193,
+254,144,36,160,84,100,254,49,134,30,27,225,72,84,96,100,1,35,134,23,192,186,25,225,212,12,32,2,27,64,110,16,1,100,0,33,96,15,128,68,
+19,64,120,4,0,172,1,96,22,0,160,182,10,160,222,20,161,90,25,161,218,31,162,42,36,98,102,39,34,134,39,226,122,36,226,42,31,229,15,53,
+78,233,223,251,153,96,9,254,142,127,255,252,52,255,31,47,163,54,9,95,251,106,255,147,212,84,191,64,159,151,98,80,203,45,160,34,112,98,177,95,
+225,161,86,85,49,232,153,191,235,190,104,205,204,7,45,103,44,215,215,128,18,188,209,247,104,43,1,146,94,2,216,164,174,51,207,95,174,74,192,247,
+56,25,165,52,58,242,197,82,56,97,22,180,146,53,55,161,134,131,42,215,16,74,159,176,146,50,141,138,125,42,72,182,24,98,108,156,160,110,27,90,
+65,8,168,196,162,1,54,130,81,135,24,56,210,10,225,117,146,80,55,146,121,27,15,184,184,139,225,120,132,136,47,26,24,11,6,73,124,131,176,221,
+145,168,82,19,72,99,149,231,32,239,245,190,253,69,190,126,63,255,247,105,234,71,255,183,240,25,250,124,224,11,255,28,111,232,170,90,223,113,143,172,
+46,37,22,186,193,238,28,201,68,31,200,187,13,196,142,159,221,192,134,250,183,121,160,29,76,230,116,174,137,75,174,230,197,86,146,115,192,90,253,164,
+89,58,140,42,215,161,181,175,163,8,66,40,173,156,125,7,134,90,50,94,80,215,127,142,227,151,160,172,39,160,154,28,45,229,8,145,224,80,136,2,
+160,49,130,55,58,186,8,162,183,177,64,85,158,171,25,17,57,32,172,241,167,134,170,75,32,232,40,25,242,69,137,80,224,36,232,215,2,66,44,143,
+112,132,158,152,253,16,169,137,142,161,95,145,8,220,27,200,12,38,151,158,199,246,36,254,51,95,250,149,255,250,236,254,169,255,255,192,19,154,207,43,
+152,25,252,204,167,83,242,219,254,197,90,91,244,131,252,106,54,135,143,255,90,139,242,128,29,110,153,188,120,18,8,110,131,60,65,26,233,63,197,42,
+12,144,201,55,167,96,153,219,22,36,180,254,224,224,30,147,53,142,241,99,197,14,73,139,254,210,113,192,130,249,189,193,130,55,32,202,207,210,19,38,
+36,86,139,250,80,16,228,9,88,184,2,25,61,193,7,13,15,92,128,203,200,149,164,16,188,15,85,225,49,197,65,1,147,244,155,137,105,52,204,64,
+41,17,140,209,131,220,239,76,120,148,75,204,170,141,52,132,72,32,247,196,148,86,16,4,9,195,89,45,77,195,69,207,208,115,253,195,49,231,255,253,
+247,255,226,159,238,145,255,174,151,254,101,173,241,179,164,65,184,190,130,199,202,27,231,235,5,239,102,143,160,254,66,27,196,121,6,234,97,37,109,104,
+114,174,36,233,168,213,216,67,209,253,241,133,108,67,76,24,8,192,236,10,197,176,67,199,68,172,138,188,136,77,57,25,69,212,203,22,220,13,201,233,
+155,196,240,90,25,188,168,0,137,111,206,248,71,82,45,29,8,180,193,82,208,190,69,125,31,13,220,12,143,136,234,198,24,189,142,108,160,7,72,210,
+204,32,37,139,100,202,2,124,149,203,192,110,199,28,153,10,116,78,70,160,205,194,212,54,13,244,14,64,64,220,64,208,36,76,52,44,4,156,135,224,
+77,245,74,254,70,31,153,7,255,203,87,255,205,214,145,255,250,20,58,23,254,154,255,210,1,9,54,33,37,202,243,52,231,77,94,174,12,65,227,239,
+235,104,106,252,146,253,95,39,63,114,254,244,215,209,86,125,226,176,99,21,171,193,90,141,63,161,125,60,150,48,57,232,89,173,240,25,48,90,62,14,
+89,253,151,145,86,148,40,193,22,72,199,131,33,50,136,8,34,142,56,88,132,56,139,132,24,57,131,200,49,129,72,2,2,88,29,2,160,25,132,176,
+59,1,8,110,3,16,7,135,144,23,0,120,113,1,72,13,133,48,70,129,168,36,7,120,44,129,72,162,131,248,76,140,8,79,135,216,204,133,152,157,
+140,104,88,138,56,162,132,137,26,173,150,17,159,242,104,247,60,31,191,255,255,44,126,14,62,235,31,210,35,247,193,239,251,255,128,135,206,14,93,189,
+222,37,66,117,34,125,126,41,82,178,79,66,204,247,71,47,166,247,24,54,14,220,163,149,157,52,45,217,193,39,13,70,166,207,39,33,32,79,180,238,
+37,74,239,24,251,97,66,253,71,231,21,38,17,131,128,228,171,196,201,56,163,246,98,4,49,8,244,50,1,214,187,75,193,181,75,212,204,43,114,199,
+71,195,57,15,179,224,53,16,126,49,163,37,25,130,56,44,146,70,20,66,85,41,0,76,29,210,126,9,177,113,33,225,99,17,177,144,32,144,205,13,
+226,121,9,16,44,42,208,95,7,50,165,2,176,237,38,16,28,18,241,191,19,28,40,188,224,63,248,167,71,135,252,208,255,255,245,123,255,62,239,98,
+100,142,254,160,61,69,62,222,31,237,163,47,192,251,126,143,95,93,32,30,10,47,167,92,170,137,113,24,57,54,60,22,6,248,78,30,230,36,186,103,
+17,157,149,118,42,129,172,99,244,202,166,122,31,226,201,121,16,172,167,70,17,105,89,0,139,243,188,17,169,87,238,37,1,143,51,248,227,32,28,5,
+227,0,200,41,147,7,199,131,26,119,2,126,49,18,84,103,141,52,3,106,106,52,196,25,69,89,89,96,31,62,85,192,25,82,119,85,98,195,18,116,
+112,57,208,17,51,196,35,11,193,224,69,49,70,8,4,49,24,224,193,60,49,164,28,51,31,25,98,113,36,49,138,49,48,83,52,79,3,15,230,197,
+254,51,95,240,235,255,247,17,255,89,223,255,213,130,222,60,130,243,41,252,7,23,247,241,235,254,190,215,15,239,227,246,242,197,6,120,188,133,37,178,
+45,50,74,27,48,84,27,134,2,42,48,249,147,211,133,128,164,225,165,218,94,145,226,170,187,21,52,101,128,97,180,76,21,13,148,128,231,203,150,102,
+10,230,254,114,190,129,74,78,197,162,57,98,138,239,210,93,28,5,72,143,202,31,23,148,47,88,24,46,27,205,195,4,229,57,93,72,179,75,21,184,
+143,220,50,87,121,44,195,113,30,20,52,134,139,57,64,75,112,68,18,124,202,130,85,1,204,120,128,205,12,177,12,92,151,200,200,239,197,180,98,143,
+220,25,68,41,39,74,19,12,175,187,55,252,76,138,55,255,237,151,255,193,71,141,23,255,100,143,247,85,58,252,21,182,82,236,2,202,63,144,55,207,
+252,193,62,43,31,17,154,127,112,120,235,3,124,41,137,97,155,77,227,182,113,119,150,20,1,91,35,225,190,13,33,215,55,128,106,66,85,58,23,212,
+201,102,67,239,65,246,176,99,178,137,97,71,231,7,212,200,133,216,209,24,164,43,206,32,76,31,37,63,2,141,145,87,152,141,209,133,142,141,196,147,
+215,185,14,65,77,74,18,132,89,144,9,41,202,200,167,145,116,225,4,80,243,207,72,26,76,148,237,7,28,153,76,208,184,70,140,155,142,140,58,70,
+25,2,64,236,38,144,36,23,0,204,234,67,248,56,76,109,91,61,3,63,93,15,243,244,255,192,23,255,211,127,245,149,255,219,179,147,103,253,118,252,
+118,170,28,73,59,153,232,217,155,103,205,103,192,130,149,158,216,126,106,130,193,199,55,183,162,235,213,79,110,168,7,164,253,163,27,196,5,95,1,22,
+196,160,200,134,156,21,2,80,24,133,204,18,197,152,213,192,20,94,19,76,57,3,65,103,72,48,20,86,84,198,134,109,54,79,128,178,206,69,15,142,
+228,124,80,169,17,64,236,237,17,188,87,139,201,16,202,184,123,142,252,228,131,40,194,208,8,24,200,244,254,5,236,92,206,32,155,66,220,175,12,140,
+5,198,232,228,65,128,42,14,212,45,129,124,227,67,184,79,76,124,67,7,84,154,196,224,184,198,218,27,159,194,3,243,226,248,114,127,255,203,199,252,
+77,229,163,255,242,10,250,11,253,163,127,124,232,121,202,69,149,121,58,59,143,12,191,151,230,19,249,168,252,174,55,57,120,191,28,78,2,228,109,182,
+38,155,47,93,81,11,220,197,41,120,36,247,4,65,94,100,53,248,15,115,103,53,129,191,29,48,254,24,241,71,10,208,239,22,113,147,3,17,221,27,
+240,110,38,17,85,13,34,189,8,144,242,45,144,108,13,226,181,21,224,150,36,146,32,2,193,181,41,224,81,16,210,200,13,112,105,41,193,87,2,98,
+28,27,208,132,22,194,15,11,160,150,36,16,200,4,146,75,11,1,23,35,16,134,27,145,245,5,34,35,25,16,30,35,208,251,1,195,161,122,205,207,
+191,222,163,207,18,202,255,255,253,62,106,19,197,163,254,155,159,227,239,208,79,253,235,59,171,214,7,42,164,2,58,122,38,240,134,36,125,209,252,59,
+17,47,124,159,32,134,183,208,111,187,36,30,238,227,204,170,46,179,39,218,2,56,239,111,144,68,106,212,158,193,17,67,53,217,80,66,196,136,223,74,
+0,98,154,179,78,138,22,39,200,206,224,118,85,11,58,4,195,160,152,33,4,40,199,206,27,65,232,98,162,76,25,68,170,44,1,112,54,163,24,20,
+130,102,51,1,28,27,99,20,12,193,82,44,0,80,19,34,56,4,97,78,24,64,234,25,224,200,25,161,250,1,2,58,37,32,142,43,162,130,16,162,
+250,40,161,74,47,226,70,17,226,214,23,32,223,129,247,218,219,254,5,134,171,255,150,127,255,248,154,255,73,143,40,140,217,63,229,111,215,19,242,164,
+255,9,220,184,58,2,114,131,92,168,117,15,34,168,128,166,39,148,241,33,189,219,177,101,18,254,9,89,191,134,6,203,154,3,149,86,103,25,207,161,
+117,236,178,171,83,170,32,98,218,187,17,34,192,21,137,25,178,208,172,112,134,85,3,99,130,100,155,187,19,8,68,123,216,72,3,32,230,192,129,74,
+223,235,224,34,235,78,187,130,198,141,107,104,50,38,174,175,67,110,78,42,80,59,227,114,151,4,30,38,104,92,72,225,182,114,5,22,21,37,204,89,
+225,42,70,198,26,17,227,28,103,161,26,31,70,174,16,33,4,105,160,210,6,6,78,4,32,52,101,32,1,14,14,91,31,240,6,244,228,252,173,255,
+255,131,143,224,59,255,229,152,149,249,153,250,113,255,5,162,28,254,72,63,179,0,230,123,66,249,73,5,38,35,247,76,32,194,243,20,36,214,71,135,
+175,124,199,68,165,220,140,29,98,228,179,208,95,43,239,210,192,251,175,55,79,161,186,181,221,52,1,94,176,52,92,34,154,9,206,240,231,229,23,48,
+228,187,135,124,149,149,229,212,227,84,189,43,115,16,6,21,67,24,48,48,89,98,190,2,240,139,235,142,45,40,51,179,146,179,131,194,220,41,88,142,
+39,146,128,140,98,12,39,8,228,25,178,103,142,225,38,37,232,231,11,98,83,141,80,82,36,120,198,0,106,46,139,128,74,160,152,179,7,121,212,140,
+112,148,153,136,254,112,34,248,173,127,228,13,214,87,255,128,239,255,192,71,231,21,255,128,7,241,251,138,27,72,122,62,118,115,208,151,249,54,120,150,
+227,63,248,134,114,205,139,239,136,150,55,166,175,152,244,74,193,14,33,196,150,15,196,244,86,128,98,47,108,0,50,103,78,254,198,122,147,240,232,77,
+148,207,136,243,30,163,236,54,157,76,245,224,165,1,50,249,122,40,60,143,203,116,66,60,58,216,218,12,32,68,178,15,250,36,73,232,238,164,28,139,
+141,166,90,7,140,197,230,212,101,11,34,121,197,4,160,103,252,58,9,26,127,130,44,134,39,164,10,71,206,112,128,210,117,230,64,34,230,250,86,131,
+90,105,100,164,68,230,14,63,132,230,86,35,116,81,164,110,55,6,66,21,11,13,245,218,252,117,191,181,151,255,202,135,255,60,159,191,111,255,142,117,
+135,191,233,75,230,153,90,34,121,214,78,142,29,72,62,72,183,26,240,172,249,70,225,129,201,3,203,175,4,12,145,184,215,216,122,115,24,185,204,169,
+177,38,10,255,135,32,204,105,224,50,70,134,71,64,224,41,160,18,3,32,94,58,96,126,12,6,78,2,225,40,129,32,120,19,137,6,22,65,16,148,
+34,108,14,136,246,56,128,188,132,100,156,9,71,82,88,192,100,99,166,64,2,133,42,107,64,46,67,102,208,9,227,126,106,129,62,47,38,44,31,98,
+166,87,18,197,132,80,73,8,114,69,4,113,136,172,80,197,32,158,196,252,54,10,172,75,194,0,174,68,28,17,138,84,45,193,96,242,217,51,25,175,
+243,120,248,229,42,71,255,255,31,31,6,155,54,127,239,173,250,140,253,6,255,215,251,58,28,77,103,33,30,32,55,208,7,147,49,225,117,233,240,164,
+34,14,161,126,22,193,135,192,167,173,97,162,229,31,197,105,60,235,55,166,50,245,198,183,7,6,85,108,58,73,50,202,92,197,65,136,205,69,168,150,
+228,152,82,57,78,70,212,191,146,116,78,71,144,251,195,60,74,140,244,27,67,0,161,192,76,35,135,100,15,2,0,78,65,248,34,2,212,43,2,64,
+20,195,16,35,128,76,47,129,232,1,130,112,20,0,4,24,0,88,10,64,88,12,193,140,15,193,252,41,194,60,50,195,132,53,196,20,67,196,20,73,
+68,156,69,68,164,69,67,228,65,194,164,116,235,229,238,221,255,54,232,34,127,139,223,255,253,226,126,95,158,175,94,80,159,245,17,182,71,245,32,254,
+93,111,105,216,67,54,208,84,97,200,42,56,90,100,237,73,74,151,133,231,177,129,27,55,243,224,199,85,4,248,170,100,138,53,58,220,99,226,11,216,
+234,98,62,58,214,38,192,60,181,165,177,109,179,122,128,21,100,207,113,106,168,122,131,7,153,45,244,64,37,200,191,162,240,169,64,157,31,130,81,182,
+82,104,4,22,93,41,129,5,30,82,160,31,205,229,37,2,212,169,81,152,58,199,253,6,132,172,97,78,184,92,68,220,202,135,4,67,202,104,134,67,
+236,127,137,156,62,69,160,169,195,236,57,139,60,60,193,240,182,195,84,13,11,12,36,192,160,176,193,69,102,56,2,127,140,71,229,101,238,107,255,249,
+20,255,199,191,255,180,196,53,42,147,248,134,254,164,152,10,127,131,95,218,82,126,94,230,124,194,152,122,215,241,46,67,224,212,56,181,28,133,196,220,
+92,18,113,215,203,135,164,219,177,183,147,52,115,50,37,154,115,186,99,63,58,196,246,194,94,117,69,41,115,217,175,3,229,109,229,208,39,116,31,147,
+33,74,201,222,59,71,35,12,216,171,33,203,148,195,89,37,214,94,11,73,126,131,111,176,152,37,138,234,9,82,52,45,120,146,33,86,194,136,238,1,
+202,180,141,97,40,145,136,206,28,135,104,141,162,16,90,200,242,34,3,248,143,162,8,38,8,234,30,128,252,138,225,216,1,168,62,30,128,226,120,34,
+80,19,167,42,45,153,175,122,207,127,226,193,15,95,252,126,127,255,4,60,233,63,249,247,125,140,240,127,35,223,163,199,9,190,254,191,212,179,132,255,
+39,63,193,227,49,27,109,246,184,156,43,15,223,241,21,69,93,104,134,24,27,131,189,113,1,89,49,97,36,25,45,123,34,194,85,120,25,114,31,187,
+189,203,209,92,219,214,83,13,82,195,177,250,120,181,15,137,212,5,207,134,14,80,81,42,55,174,130,40,179,183,179,255,129,187,37,60,152,109,45,51,
+134,142,98,126,51,233,69,34,146,249,152,177,206,43,185,182,22,194,134,156,81,5,37,169,189,9,178,57,154,64,50,33,233,126,3,10,4,149,32,135,
+158,153,39,12,201,199,144,48,253,153,200,235,17,105,94,142,225,77,134,41,249,123,89,126,8,95,240,122,255,208,79,255,138,175,250,82,255,239,93,231,
+169,255,36,252,205,48,20,141,247,81,149,170,247,194,249,147,178,215,188,23,189,252,35,58,253,118,99,137,86,126,218,67,192,114,130,212,59,96,102,158,
+95,211,126,49,225,173,14,225,16,17,1,103,0,50,158,54,16,109,53,68,237,6,211,130,96,208,31,53,198,195,5,227,10,113,80,248,42,167,19,26,
+130,70,105,241,252,39,6,19,27,194,242,88,49,132,53,228,231,20,195,180,69,17,10,63,3,207,12,68,2,53,208,106,63,35,5,0,35,192,44,144,
+111,55,34,165,14,83,14,40,241,93,42,2,129,28,82,44,38,178,35,28,162,79,38,17,122,34,18,129,20,65,213,39,81,70,27,209,199,91,15,33,
+15,205,11,247,124,250,47,255,254,139,126,220,252,67,63,247,52,255,123,27,181,252,118,151,101,236,232,135,197,41,46,188,156,123,111,81,19,212,239,146,
+181,193,59,248,230,229,108,14,16,245,40,166,214,47,176,64,146,20,237,210,201,224,29,76,143,147,129,12,66,144,161,8,44,21,194,16,41,67,124,71,
+64,240,67,201,132,50,3,252,209,68,104,47,79,76,83,1,93,6,197,184,10,16,140,97,130,192,255,198,96,78,142,244,103,6,240,218,198,72,137,140,
+76,93,9,216,178,69,16,169,10,68,64,10,176,154,194,144,165,137,100,14,9,128,149,192,244,134,9,124,45,71,8,154,68,140,91,137,180,95,196,144,
+151,199,20,59,8,244,121,67,48,126,199,100,55,136,132,3,157,139,229,221,250,65,125,116,191,220,247,255,242,107,179,223,193,131,253,15,63,244,71,21,
+79,195,243,100,87,63,27,108,115,10,231,128,79,115,195,120,240,95,238,56,250,221,236,120,251,72,3,154,206,121,146,116,216,102,198,209,196,196,166,52,
+144,116,168,43,14,54,180,109,77,217,73,156,172,99,142,65,81,193,8,137,143,100,36,195,224,176,68,36,4,135,164,75,194,76,78,196,92,63,66,148,
+54,68,204,8,193,252,78,193,8,4,196,188,38,129,64,68,67,96,42,131,204,62,3,192,54,195,216,71,3,92,55,132,144,56,66,152,68,132,4,23,
+131,144,75,64,16,42,5,116,23,65,136,99,66,212,8,6,196,64,192,84,112,196,212,13,198,244,82,65,12,98,68,204,8,200,124,204,166,45,251,230,
+126,90,155,74,127,250,163,255,252,24,122,67,124,239,61,60,191,246,245,223,11,244,128,252,13,202,67,85,228,137,66,148,107,203,152,207,242,151,230,192,
+0,60,22,121,238,25,87,21,126,26,202,233,191,190,147,205,145,172,238,9,206,161,152,93,25,157,19,9,152,135,54,197,154,89,73,141,168,246,131,203,
+13,44,146,108,77,200,164,137,114,35,63,104,39,30,147,86,130,25,193,44,72,72,154,98,63,133,89,148,28,40,88,152,193,88,132,249,132,15,232,69,
+151,128,181,132,9,101,8,24,66,148,128,94,132,249,32,4,232,100,143,0,78,136,24,186,5,168,160,135,240,105,140,24,71,7,152,223,129,128,134,143,
+40,11,136,168,249,130,40,128,143,72,28,134,88,229,137,92,19,178,236,255,81,175,111,12,81,255,255,110,95,249,102,255,200,83,121,161,144,255,23,127,
+134,247,193,19,252,76,117,6,239,193,223,253,105,173,4,154,34,154,7,211,42,46,24,145,229,108,63,182,129,212,8,14,241,53,209,192,96,50,51,201,
+168,187,178,59,190,129,249,99,91,81,4,156,195,70,79,9,249,124,88,16,41,133,168,88,129,81,170,210,143,10,165,66,115,40,85,137,107,145,2,178,
+70,28,86,149,226,8,33,148,177,14,18,12,139,32,188,224,40,177,201,206,5,170,232,129,32,226,168,134,170,23,41,240,89,162,14,146,4,214,44,40,
+36,69,99,126,112,196,14,67,101,224,61,100,234,76,3,174,87,35,180,55,101,210,46,67,42,95,34,76,43,101,198,34,130,22,89,160,177,117,174,180,
+159,244,124,181,231,243,131,255,252,114,124,91,127,253,69,169,219,159,207,64,191,137,102,77,223,215,47,211,83,152,87,225,99,171,182,188,156,210,101,197,
+218,168,209,193,40,69,60,31,96,181,17,216,104,13,154,223,208,224,98,97,243,86,32,223,152,221,74,0,38,142,52,36,12,138,149,202,248,98,42,227,
+19,98,50,170,171,219,22,101,59,217,88,214,40,154,164,199,185,55,148,34,69,137,64,154,114,99,69,204,167,148,162,11,228,28,174,206,166,49,139,92,
+203,98,48,184,74,250,20,75,108,152,96,88,176,72,86,10,106,96,119,33,170,152,6,202,43,40,120,100,227,178,117,197,234,73,166,68,88,229,86,84,
+5,34,93,228,116,74,102,22,61,3,246,95,227,176,54,229,94,79,28,65,62,37,223,242,0,207,31,255,177,255,254,162,239,225,255,238,61,250,76,235,
+83,65,205,162,131,167,225,7,240,120,168,103,225,123,228,153,138,247,188,126,232,24,28,114,211,174,149,45,47,34,230,208,148,113,115,12,74,65,65,10,
+1,50,39,32,163,26,116,144,18,179,237,89,33,63,90,149,218,16,182,235,91,32,171,123,245,76,2,184,24,166,112,50,65,45,18,132,10,4,39,168,
+52,79,126,109,4,128,230,38,12,90,141,26,85,134,168,188,36,172,118,202,114,63,7,244,148,163,40,130,200,74,35,200,32,120,97,64,124,6,242,2,
+199,48,105,96,230,102,134,82,31,37,136,97,162,234,75,5,226,59,163,236,89,100,74,53,5,30,73,226,232,71,164,134,47,4,126,32,42,157,235,61,
+249,21,127,43,239,229,239,255,248,35,251,56,250,144,127,227,225,255,139,42,228,252,121,162,19,5,153,49,243,208,6,159,19,255,63,102,138,245,75,239,
+241,37,111,17,222,21,83,120,228,211,140,116,186,179,199,157,244,90,44,74,235,14,237,27,212,40,86,134,115,30,163,118,65,176,106,27,98,121,8,112,
+64,21,177,11,14,208,147,19,209,199,0,113,45,37,144,96,14,210,167,11,32,137,43,240,246,1,50,175,19,0,100,39,241,88,13,130,67,22,161,64,
+32,145,106,24,97,211,21,1,176,27,17,24,28,1,169,13,1,170,26,240,114,23,161,197,0,161,54,30,48,97,14,161,255,12,112,162,33,113,27,6,
+66,23,21,144,58,32,49,117,2,129,201,21,240,64,35,210,52,141,119,232,145,249,241,118,248,255,237,31,255,244,117,189,247,213,155,236,93,255,195,127,
+37,47,211,11,227,66,30,248,58,20,50,115,200,71,123,194,75,220,79,174,160,209,115,67,233,28,154,220,179,120,49,54,247,5,28,226,159,59,82,219,
+122,63,118,66,178,254,119,235,165,189,163,96,83,157,69,23,122,93,38,32,159,17,55,24,196,36,124,16,120,55,102,125,3,178,238,85,144,163,41,4,
+81,12,242,86,54,80,203,35,66,141,11,50,38,29,16,141,33,225,59,6,50,14,12,48,73,31,64,115,3,241,198,4,112,75,24,64,59,6,241,50,
+4,240,159,13,0,115,14,16,110,10,49,33,0,160,209,21,176,69,15,145,131,8,49,11,25,80,161,16,81,141,9,16,209,22,241,117,111,44,46,191,
+201,91,229,164,225,127,255,166,31,254,100,127,224,157,217,170,36,223,240,145,246,52,250,46,127,109,220,32,187,93,113,247,39,105,101,9,193,91,160,125,
+247,139,238,160,58,237,10,78,50,251,108,6,166,109,250,163,21,102,117,249,73,32,70,98,183,132,78,108,130,105,4,171,152,100,199,1,99,46,246,235,
+139,29,98,53,92,87,106,101,157,242,173,77,204,158,149,18,67,99,12,166,144,201,13,69,50,120,80,92,83,6,83,0,133,48,83,208,49,82,68,71,
+5,245,4,55,80,145,77,66,207,12,180,138,37,81,9,66,1,253,21,115,166,28,177,171,49,65,105,35,146,78,11,210,213,24,0,49,50,112,160,4,
+3,51,2,240,138,47,48,231,11,226,125,22,112,246,31,241,77,8,28,72,57,156,127,206,66,64,223,97,31,255,178,159,225,195,255,217,24,175,171,211,
+232,219,165,7,220,91,247,41,64,31,212,147,180,46,6,62,94,144,41,169,189,187,8,128,232,69,232,185,151,129,22,197,62,134,201,14,218,54,144,22,
+89,192,214,64,190,44,203,36,103,38,185,250,224,73,26,197,225,189,64,137,222,157,29,26,160,242,232,51,140,77,216,216,198,176,81,229,222,230,67,213,
+48,116,120,71,41,8,142,3,26,65,60,47,92,201,133,203,29,219,142,173,16,91,208,82,212,125,121,131,105,92,209,224,165,21,44,180,143,33,46,196,
+105,27,15,140,33,210,24,185,199,181,7,135,116,193,205,96,56,79,20,148,0,5,9,68,200,44,144,148,6,132,200,242,67,116,96,140,124,102,71,24,
+163,197,156,96,56,4,121,247,127,189,195,118,255,228,235,255,164,239,62,31,255,170,86,153,190,140,36,153,128,39,14,111,144,184,2,254,68,158,86,184,
+150,253,149,47,111,177,191,121,1,131,200,159,13,164,234,148,43,82,42,49,146,139,33,44,16,160,2,12,250,79,8,98,145,165,241,150,59,89,140,43,
+52,14,65,193,197,158,172,161,223,185,131,213,5,245,143,37,212,91,128,77,97,26,170,66,145,13,179,96,54,232,34,138,130,130,55,136,86,176,2,144,
+147,59,47,24,249,212,176,128,135,163,154,155,6,162,99,159,241,45,37,89,68,27,114,26,135,226,1,27,248,64,160,177,82,142,105,221,13,249,105,151,
+224,108,156,57,3,0,121,243,136,16,72,31,40,0,136,49,199,135,24,169,23,120,194,140,145,71,134,217,230,119,48,250,90,127,53,109,206,255,254,189,
+63,161,75,143,255,252,3,189,10,255,12,95,48,168,107,1,214,147,39,65,230,145,212,6,171,63,66,236,89,119,161,245,112,56,158,35,60,92,23,115,
+79,59,29,71,74,211,44,41,26,232,52,138,99,154,29,120,95,159,160,111,135,56,116,1,144,7,138,200,4,136,145,72,136,201,8,22,121,61,149,1,
+32,158,41,85,9,58,91,146,0,26,41,56,191,12,82,125,131,241,88,34,88,72,156,65,157,140,105,253,15,169,40,159,192,77,150,153,197,5,113,139,
+150,128,223,24,168,237,19,225,106,134,17,112,19,72,43,151,80,243,138,185,78,10,169,21,144,80,98,150,8,165,1,233,141,132,0,24,25,56,34,132,
+65,119,135,120,99,19,136,176,136,33,41,128,203,4,121,237,126,68,223,92,239,20,31,255,227,151,210,77,105,63,249,55,124,48,127,44,255,200,248,244,
+173,2,159,107,9,174,22,172,177,15,244,228,189,30,159,126,121,71,199,197,223,152,82,246,111,211,134,20,219,51,19,128,117,53,42,86,60,147,128,125,
+177,175,133,241,243,153,106,202,11,169,160,149,160,43,148,136,68,1,152,210,134,8,88,134,40,161,139,104,18,136,249,17,129,112,72,148,168,23,1,177,
+86,128,120,131,19,72,59,141,240,238,135,73,31,8,248,168,147,144,35,140,249,41,4,112,230,143,128,161,14,200,171,14,16,225,132,177,2,12,152,28,
+144,48,171,135,200,224,8,40,211,138,80,89,145,72,91,3,25,61,128,192,14,148,152,60,128,225,54,135,184,39,16,88,160,132,49,10,132,3,239,123,
+163,126,200,94,98,95,10,255,255,242,65,149,221,215,63,238,173,243,215,253,5,127,173,128,0,242,39,120,135,26,148,117,191,213,143,180,101,130,114,147,
+242,42,66,126,52,61,19,23,251,147,190,95,84,218,220,102,92,116,47,153,141,25,55,94,138,124,37,71,87,230,233,88,25,46,25,59,76,183,160,77,
+180,73,244,6,146,228,140,64,174,37,88,16,138,161,186,137,8,131,18,232,195,133,0,186,140,8,38,6,56,151,128,176,37,133,216,2,0,0,30,128,
+128,20,1,112,24,1,176,58,2,192,25,4,128,61,0,240,66,4,96,1,130,176,66,1,40,4,3,64,41,130,72,21,3,168,82,128,232,75,135,184,
+52,133,120,156,133,88,96,138,216,112,134,8,173,136,8,89,137,104,121,132,184,192,143,20,233,190,156,95,209,138,136,31,166,31,255,252,95,244,148,237,
+105,249,124,124,225,254,229,191,240,236,105,95,150,15,78,72,143,78,204,20,203,138,155,143,255,26,93,252,13,239,56,222,10,73,233,193,31,43,106,71,
+112,61,150,182,43,90,104,151,214,101,23,185,56,124,159,36,143,1,251,255,41,188,177,232,208,30,243,205,131,225,31,78,61,49,145,90,74,35,0,175,
+80,107,18,85,214,99,83,21,90,67,249,67,244,250,29,180,191,64,224,3,75,19,0,23,100,55,30,226,132,55,16,228,50,162,137,0,147,100,25,208,
+207,52,0,195,22,178,198,0,209,215,33,0,122,34,17,60,13,2,67,5,224,238,35,240,115,14,34,21,18,208,182,29,17,181,7,97,117,32,208,54,
+16,146,39,0,192,129,35,176,99,69,12,191,63,31,47,240,12,221,175,252,14,127,255,196,183,245,168,249,230,54,103,136,95,100,95,243,244,160,31,229,
+107,246,4,140,199,144,158,31,148,84,152,120,209,34,2,166,10,106,241,210,144,164,42,255,77,200,69,98,95,13,10,224,98,86,92,24,122,90,20,202,
+241,222,147,28,15,112,182,91,121,223,215,168,72,235,79,35,98,204,176,91,27,45,229,67,201,49,232,166,18,37,240,138,130,233,253,194,81,91,87,173,
+246,137,237,190,90,48,14,28,237,58,9,225,179,204,129,8,23,84,84,148,177,34,65,69,100,12,68,110,85,136,103,203,45,43,1,44,225,78,88,51,
+15,164,146,134,88,254,67,168,130,142,236,25,72,184,208,70,36,132,10,116,153,198,248,117,203,228,84,4,36,203,195,184,10,78,52,67,29,43,167,215,
+231,101,253,111,63,167,223,251,54,255,252,34,127,230,37,248,125,122,50,222,173,196,126,211,85,163,250,109,254,67,144,4,250,220,244,244,202,35,180,28,
+173,49,18,174,216,189,71,56,133,193,4,112,142,112,142,17,149,28,152,73,240,72,178,47,16,107,25,185,192,56,74,202,207,113,24,97,191,41,161,21,
+152,220,16,8,146,129,170,120,156,19,179,31,102,218,145,200,148,191,195,251,158,172,17,149,21,115,223,32,156,91,213,167,129,25,215,84,56,166,156,60,
+208,145,105,136,69,121,95,19,76,25,87,200,211,199,181,114,7,28,198,84,48,22,207,140,248,3,121,20,201,248,112,145,148,65,9,57,7,65,156,159,
+142,52,105,201,160,179,74,124,134,7,188,206,198,112,63,205,220,75,128,13,13,203,210,88,223,20,175,196,11,243,224,255,238,223,254,209,127,228,199,255,
+140,55,214,147,253,113,208,227,16,107,93,77,143,152,143,194,81,48,62,117,254,13,217,218,123,240,225,21,196,3,157,186,1,109,81,115,146,165,194,129,
+128,81,150,61,65,130,101,104,124,36,193,150,14,65,108,48,194,226,32,102,48,55,38,78,117,193,222,160,230,152,15,12,154,70,196,0,214,225,76,107,
+140,150,34,40,172,165,165,86,154,135,42,125,233,152,55,169,122,137,64,60,160,166,208,57,137,174,73,134,60,135,34,24,127,198,158,6,104,204,72,162,
+150,136,129,226,77,102,172,21,134,70,60,195,212,99,160,100,80,68,234,45,100,208,46,165,50,52,128,178,103,33,12,17,70,90,22,162,24,81,163,138,
+36,67,42,76,161,212,12,167,158,176,84,244,252,225,61,119,190,61,223,254,168,191,248,27,232,143,242,20,255,92,15,248,81,231,223,249,157,53,205,64,
+77,237,224,51,196,214,70,50,190,146,146,243,228,219,225,8,232,157,217,113,254,207,187,139,121,105,111,45,102,215,157,208,208,252,103,147,80,227,102,154,
+74,231,53,52,10,193,97,166,17,212,175,82,168,101,78,172,138,128,4,208,64,144,22,137,44,62,192,60,88,68,252,43,67,124,58,68,60,50,193,100,
+64,67,252,10,2,84,75,65,112,6,4,188,16,131,24,56,192,84,82,1,124,29,197,208,15,130,228,77,131,112,51,194,216,80,130,196,3,5,128,27,
+66,76,71,0,92,68,66,64,14,5,132,6,193,88,90,67,52,17,4,244,88,64,16,59,198,244,21,194,92,116,66,220,18,198,52,61,192,68,98,192,
+122,44,222,39,95,209,107,84,170,130,255,255,195,135,116,221,36,63,100,136,117,127,220,15,194,19,233,109,240,185,78,125,48,128,68,135,96,211,3,235,
+255,101,222,88,253,11,41,95,130,191,65,96,172,222,191,49,10,98,110,42,222,217,152,96,238,123,185,206,62,12,170,110,164,8,149,17,134,82,232,79,
+188,147,32,105,8,82,217,127,4,121,93,245,204,13,118,217,46,161,174,99,16,48,46,36,117,30,179,6,38,179,9,37,160,137,51,145,88,13,66,165,
+5,1,158,26,144,119,29,192,153,14,17,168,5,0,235,18,128,244,11,208,158,19,32,103,1,129,32,1,176,77,12,160,22,8,208,74,2,96,185,3,
+48,10,13,16,159,3,80,213,14,240,133,13,17,35,12,48,209,18,240,237,12,241,25,15,48,181,13,240,203,31,215,202,171,39,239,221,244,222,19,207,
+245,197,255,253,135,124,179,186,236,122,200,121,158,253,151,255,187,195,79,126,7,122,218,102,177,128,184,101,165,195,95,12,116,246,228,133,87,204,127,198,
+59,106,170,201,199,39,129,17,201,226,247,147,115,109,103,7,18,234,239,96,102,11,184,33,71,69,237,108,220,90,115,147,141,49,140,80,148,252,26,170,
+62,98,190,249,140,154,166,237,168,75,174,50,142,2,8,229,35,60,102,139,106,31,232,72,110,165,182,126,66,30,117,229,196,33,7,30,47,4,220,84,
+224,20,97,194,190,33,101,208,1,163,70,69,2,20,56,162,64,53,195,6,1,131,156,32,33,190,46,0,230,47,225,124,0,131,158,2,96,128,57,97,
+174,7,131,10,46,96,20,35,227,138,8,225,98,57,161,18,8,35,70,9,162,231,107,46,8,223,238,109,64,204,89,255,255,42,63,233,31,254,62,26,
+207,79,235,246,73,27,255,241,66,242,1,239,19,244,56,1,221,231,105,29,0,2,223,23,209,35,150,128,133,81,246,136,18,128,197,245,57,178,174,181,
+170,174,235,12,222,53,141,200,240,152,49,123,151,244,124,48,157,38,10,245,80,5,88,108,44,183,114,129,151,32,71,82,37,120,21,114,114,32,232,252,
+144,85,67,56,22,32,251,146,179,192,12,64,132,232,13,169,207,65,225,85,19,204,147,87,40,133,80,69,55,131,9,42,76,72,189,144,124,60,16,192,
+175,196,45,22,4,20,156,206,0,42,140,132,128,135,184,197,65,48,160,137,164,83,73,128,91,73,220,103,1,124,197,66,8,29,140,68,42,195,160,159,
+198,196,62,6,108,149,67,32,35,203,44,24,147,75,103,15,156,135,250,115,121,15,254,158,255,255,194,158,94,246,159,240,184,163,29,171,124,96,252,191,
+188,69,63,139,154,196,126,29,93,174,240,97,242,46,76,27,240,213,129,72,18,244,78,8,225,82,129,77,76,225,152,148,18,187,92,169,112,77,180,63,
+109,140,245,176,17,180,32,169,211,198,78,74,121,102,84,42,143,101,12,202,158,122,143,51,2,57,82,15,156,208,92,72,210,39,70,75,205,189,22,146,
+97,131,18,202,176,59,223,9,139,242,171,33,103,62,217,27,44,83,6,136,139,94,25,233,206,178,32,14,167,218,61,21,34,139,144,50,53,32,24,70,
+168,33,33,148,234,46,2,41,241,150,96,188,33,232,102,20,33,211,137,201,100,19,249,103,146,0,138,157,168,148,1,241,235,129,24,148,25,136,171,141,
+145,36,143,72,203,102,45,226,9,253,37,57,96,127,229,55,254,156,191,238,175,255,204,67,196,19,244,75,66,84,198,234,92,205,127,9,127,78,13,142,
+190,236,117,52,243,172,235,150,221,253,191,163,167,88,28,149,8,234,67,109,224,170,198,254,36,5,64,50,1,44,54,165,216,98,9,58,29,139,220,153,
+229,186,234,133,42,209,172,192,32,144,205,55,132,118,134,24,70,181,131,80,163,251,140,25,91,164,172,208,90,65,124,183,15,169,223,65,181,119,20,100,
+216,89,0,123,213,21,70,5,57,117,75,200,246,148,4,25,149,8,201,71,189,88,3,108,222,208,240,88,16,92,150,12,8,238,64,168,240,10,132,115,
+78,16,74,204,180,154,129,48,244,67,112,87,142,132,51,71,96,178,200,220,110,6,108,197,196,96,23,77,44,18,3,24,242,201,241,23,61,194,62,28,
+95,199,235,236,155,255,236,23,243,141,13,191,255,50,143,15,223,215,183,208,146,114,5,195,89,214,67,241,204,141,79,109,63,47,9,183,122,233,228,49,
+199,107,168,136,25,116,72,180,156,166,118,52,34,186,158,211,97,73,37,118,154,142,64,199,32,54,179,196,166,61,101,144,8,227,58,8,128,34,16,225,
+254,33,160,152,30,36,190,11,192,18,102,160,190,34,70,70,50,227,184,69,229,154,63,193,90,112,34,212,30,70,230,10,132,124,83,33,214,94,130,134,
+60,229,180,10,4,210,67,67,100,73,225,224,83,131,90,10,101,192,23,98,190,78,0,148,64,162,244,36,4,106,8,131,28,62,33,218,47,130,182,60,
+97,244,20,228,234,6,64,14,81,225,78,11,132,102,44,224,252,48,35,182,14,129,46,105,110,213,135,135,242,66,240,154,228,181,255,249,59,255,196,53,
+33,62,120,223,168,247,253,53,101,43,253,17,178,161,206,214,125,141,24,219,86,57,46,62,122,211,207,206,247,180,129,168,116,185,209,19,21,174,94,43,
+141,192,99,30,86,131,221,65,190,234,183,137,65,39,91,142,35,143,245,72,81,192,142,84,7,206,86,21,199,62,202,43,144,0,109,190,79,196,60,187,
+160,170,90,200,10,72,165,20,67,102,66,52,192,254,99,33,68,18,68,222,6,98,52,46,97,122,39,192,254,28,162,48,8,129,122,25,1,136,13,96,
+232,31,192,46,5,129,240,5,64,10,22,192,168,6,32,192,10,0,158,0,160,92,13,224,190,2,161,22,21,96,206,20,33,210,21,225,118,33,225,202,
+25,226,42,32,225,178,31,226,26,24,33,146,31,226,78,63,148,144,247,82,255,0,68,126,237,131,255,255,45,49,145,248,148,121,166,32,239,250,117,252,
+109,190,61,95,173,120,148,120,249,84,150,2,110,168,154,137,5,25,241,120,202,10,90,114,3,222,104,117,243,89,204,98,52,27,22,196,107,29,76,143,
+72,15,74,137,51,202,111,33,161,155,184,92,249,23,10,236,167,237,38,137,160,159,76,211,20,190,32,48,86,15,41,75,155,50,156,67,76,109,91,121,
+64,213,205,124,130,205,190,205,24,179,152,244,3,146,200,245,74,157,52,3,93,3,77,152,120,144,4,81,142,64,171,67,84,253,131,20,144,76,120,70,
+10,236,97,9,120,145,193,4,174,4,244,106,72,120,1,201,196,57,3,160,159,65,252,79,135,164,108,195,224,66,73,172,15,128,188,161,194,140,22,8,
+12,90,66,80,75,71,156,24,94,83,40,207,195,227,249,156,115,169,252,180,127,255,156,159,45,175,233,76,0,51,121,249,223,249,41,123,216,126,211,103,
+43,248,9,103,151,166,255,24,3,94,160,170,93,40,225,34,5,153,242,194,241,72,38,114,160,213,102,152,154,10,226,184,140,180,89,179,98,113,95,189,
+166,168,65,88,82,203,182,163,127,200,166,136,129,189,88,54,46,114,10,35,136,44,131,158,133,190,226,120,53,50,17,87,227,162,142,120,72,53,227,91,
+159,139,155,18,155,77,169,240,253,55,184,255,39,50,141,139,74,249,16,169,228,167,224,146,36,233,90,28,129,235,128,50,77,16,9,22,160,176,23,26,
+249,50,16,17,181,130,1,111,19,136,221,149,16,127,152,8,188,3,65,177,128,200,161,22,168,207,139,48,221,149,40,111,3,185,120,128,48,77,22,56,
+13,0,222,146,220,247,63,211,1,209,63,53,63,253,53,255,212,119,255,128,198,124,26,217,230,207,28,223,192,41,241,254,236,62,151,91,229,124,62,217,
+235,170,214,18,240,57,196,144,1,150,228,250,12,136,172,131,252,136,94,216,135,160,94,196,144,82,143,8,34,210,233,152,222,22,141,128,165,67,119,158,
+111,138,63,131,148,182,33,46,206,114,196,39,249,94,184,65,199,77,188,92,29,242,18,40,83,7,3,187,126,86,102,22,200,117,148,114,157,56,216,215,
+182,225,197,166,219,8,4,115,18,156,1,242,42,184,34,45,1,127,148,74,184,0,90,13,157,17,74,33,136,135,32,145,119,139,186,15,7,217,154,150,
+144,123,30,168,102,17,209,165,138,121,63,15,249,114,142,0,56,156,248,51,6,97,171,136,200,178,18,9,34,139,16,105,154,40,208,59,199,84,47,145,
+247,248,122,126,147,255,214,23,255,175,30,59,159,251,52,116,113,217,198,1,120,116,118,236,247,171,165,255,231,149,116,223,30,255,47,169,96,117,211,153,
+198,79,86,7,31,122,72,11,185,127,157,33,39,15,224,142,133,43,20,0,10,211,176,178,62,65,236,119,161,136,231,168,91,34,98,183,137,43,213,24,
+52,198,202,17,219,34,126,112,49,10,75,248,16,186,112,94,72,84,209,148,170,24,35,70,236,138,34,180,237,196,13,47,42,132,135,120,224,96,208,197,
+136,186,96,236,216,24,42,30,148,69,92,168,99,120,156,199,118,41,42,212,40,38,226,133,194,172,136,227,184,101,71,98,23,231,132,68,101,174,95,0,
+106,126,226,136,43,135,198,24,100,48,89,165,6,60,130,122,111,97,204,8,198,238,10,226,192,97,96,158,70,92,106,61,84,63,136,100,130,63,252,63,
+127,149,79,229,191,255,196,3,184,199,248,224,155,182,39,148,62,40,254,218,187,208,115,230,248,22,135,63,200,243,79,29,85,252,132,6,27,137,254,18,
+213,232,198,20,152,173,168,219,40,95,24,224,58,65,179,130,36,129,75,4,64,166,15,224,44,31,145,14,29,195,97,15,19,114,43,83,173,56,64,101,
+91,49,218,36,5,225,16,52,20,66,147,229,68,33,63,90,242,190,28,229,187,3,99,242,64,146,99,73,97,83,65,179,154,24,164,109,150,50,71,68,
+104,225,134,142,130,118,81,39,152,33,134,158,67,133,140,92,32,6,112,67,62,58,166,16,0,101,218,52,194,180,98,96,74,64,196,182,57,227,164,37,
+37,202,28,64,24,101,224,190,26,133,66,51,98,32,49,164,186,26,64,110,123,170,113,26,111,194,99,213,75,236,177,255,90,63,255,14,188,162,241,114,
+255,209,43,235,199,249,63,254,60,209,62,200,84,204,195,11,70,132,199,225,247,198,27,1,207,28,216,64,119,52,221,246,90,61,241,24,39,76,125,69,
+161,57,163,27,213,93,98,165,165,199,108,100,159,128,76,108,135,58,14,39,116,151,12,26,24,105,8,94,166,14,84,129,106,106,225,12,8,5,38,27,
+160,60,49,98,178,13,161,202,35,33,162,24,97,14,25,97,198,2,224,182,31,160,4,9,1,158,5,225,164,10,96,250,33,192,160,20,97,184,30,129,
+22,12,66,176,7,32,74,42,0,124,18,161,196,21,65,150,7,1,172,23,224,250,21,193,6,34,96,104,7,34,222,12,96,42,46,161,254,3,162,114,
+46,160,162,27,99,70,19,224,250,46,97,170,6,227,14,14,17,152,240,30,254,155,89,47,58,63,255,250,135,248,188,241,194,250,89,111,137,255,85,185,
+141,127,55,239,20,220,242,249,14,20,2,121,161,40,147,97,196,233,118,213,219,129,147,56,136,213,123,72,109,163,72,215,147,180,205,109,59,179,17,32,
+103,51,66,74,21,98,42,25,215,240,142,187,236,215,136,105,103,195,0,196,202,156,8,175,62,195,240,161,91,208,25,75,153,167,112,136,60,184,170,29,
+66,227,143,234,51,23,90,6,155,240,1,164,152,215,17,17,213,130,73,148,15,88,223,152,80,1,18,201,5,12,225,13,133,177,58,9,168,66,147,208,
+12,138,120,226,7,32,200,133,96,185,10,168,55,139,64,99,138,104,108,1,104,228,128,16,28,14,136,109,130,80,187,140,104,7,7,136,242,130,248,56,
+142,152,100,128,56,183,134,216,208,204,131,13,175,234,145,237,149,128,111,252,132,127,255,26,223,209,19,211,18,239,28,162,254,122,127,198,235,21,175,228,
+191,149,39,147,119,38,182,67,203,112,60,207,4,6,12,178,30,12,22,175,184,27,1,37,189,106,181,44,108,112,205,227,38,138,86,189,174,107,134,63,
+114,122,210,53,86,25,168,253,77,234,92,166,29,136,150,94,97,114,140,31,106,148,162,131,170,76,20,149,98,188,197,46,162,255,65,11,23,84,60,65,
+200,69,130,27,71,42,90,10,180,112,147,176,186,59,21,34,253,139,18,129,32,56,208,172,144,151,156,202,44,13,82,21,144,161,206,26,88,57,161,240,
+200,147,73,185,3,49,180,141,144,246,26,120,46,148,33,36,145,73,14,7,41,154,135,128,50,26,248,67,137,33,82,143,8,158,11,153,86,134,112,13,
+153,56,100,17,230,242,158,71,31,241,230,217,215,243,201,255,246,95,227,199,255,214,120,238,244,27,217,53,120,63,7,174,242,190,30,127,158,145,54,124,
+82,247,82,212,147,133,248,166,100,20,190,40,166,217,4,180,26,194,86,18,142,128,49,235,11,14,163,144,145,154,131,70,42,65,228,71,75,69,121,135,
+28,203,5,122,146,107,168,237,83,221,19,89,63,59,187,185,198,248,87,101,202,183,200,153,44,176,74,123,7,117,77,184,19,20,59,251,174,97,54,65,
+172,123,151,73,140,200,157,193,10,21,63,87,64,93,151,204,195,17,233,55,192,245,115,9,172,187,84,184,30,145,68,198,11,129,12,65,145,4,11,52,
+133,207,40,51,78,188,146,4,65,5,64,192,140,13,68,119,201,88,114,77,52,89,128,76,238,192,60,73,12,12,98,70,192,109,202,220,144,43,89,227,
+101,247,20,252,201,63,232,67,253,248,255,235,39,243,26,255,176,39,222,215,84,24,125,92,99,16,15,39,116,163,251,91,102,115,220,111,217,66,26,158,
+65,182,184,216,227,65,82,223,206,73,51,224,15,32,131,24,75,210,104,52,128,46,4,0,95,35,130,44,53,16,96,79,195,55,55,213,196,3,150,211,
+57,195,166,120,208,165,100,37,65,82,22,56,17,87,237,56,163,32,126,144,151,91,133,55,72,149,220,18,22,193,58,66,212,104,112,54,84,132,23,48,
+213,150,9,116,235,61,130,190,77,145,0,76,163,3,29,21,4,5,83,145,55,226,58,61,145,8,60,34,177,23,115,208,12,147,37,39,65,36,58,144,
+98,36,98,235,27,114,84,23,147,39,21,96,26,57,144,47,18,98,237,27,241,116,25,178,181,16,128,3,62,83,90,93,79,104,15,82,111,229,205,248,
+213,255,240,233,252,86,92,127,255,192,139,73,159,209,247,111,234,169,47,133,18,241,103,240,96,118,207,99,252,129,186,230,118,171,92,159,25,169,73,228,
+255,179,34,240,99,127,2,234,17,71,28,70,228,52,66,39,110,155,3,36,66,97,164,37,0,156,6,162,94,32,130,24,95,96,214,87,69,154,96,38,
+88,24,234,82,57,131,184,177,225,214,119,135,214,121,103,220,31,107,30,74,132,28,173,32,174,129,198,226,94,168,184,16,104,214,93,132,184,135,161,24,
+133,69,22,57,168,204,3,38,114,98,68,120,106,33,196,116,132,86,41,231,84,11,101,142,76,66,212,101,96,212,78,4,234,49,228,196,35,37,214,42,
+64,164,106,160,122,38,197,122,57,34,176,49,37,146,23,0,90,94,160,106,28,5,246,30,136,29,221,107,231,201,245,22,17,159,255,200,111,231,159,197,
+167,254,179,221,69,63,232,163,27,47,28,70,183,95,154,18,214,107,86,78,138,235,159,236,177,87,62,57,125,221,33,209,215,190,158,218,233,104,90,117,
+59,27,51,172,230,236,216,121,147,105,84,7,198,109,80,255,106,34,17,52,19,68,8,34,179,5,128,168,20,80,219,9,48,121,8,177,193,13,48,88,
+30,113,243,13,128,247,47,208,116,7,227,37,11,177,180,35,50,23,33,0,127,46,145,102,20,194,187,1,66,136,25,81,75,44,192,18,33,178,4,27,
+2,15,10,34,166,19,16,203,42,160,20,27,241,196,20,65,251,6,1,230,23,241,5,27,160,151,32,48,220,4,226,91,5,80,202,32,17,127,11,193,
+61,35,240,42,5,242,105,9,208,56,30,49,79,8,33,37,36,247,138,207,123,248,108,117,152,222,163,255,239,15,255,4,118,66,244,138,254,83,159,228,
+227,206,95,251,9,50,223,48,184,247,59,3,152,56,189,17,246,176,108,110,117,245,104,225,33,194,213,98,123,117,70,207,52,221,238,27,19,104,121,3,
+97,105,130,249,132,228,96,203,114,199,167,129,85,81,165,71,30,234,43,35,179,6,4,93,95,213,198,2,102,255,31,2,206,89,17,121,53,227,9,56,
+18,96,9,211,239,11,160,244,49,16,203,25,1,159,26,145,92,3,113,191,11,224,200,19,112,20,19,224,103,5,145,60,5,64,109,14,0,214,4,112,
+114,15,192,3,0,224,210,3,128,55,6,224,84,6,48,3,3,160,115,6,208,13,7,144,193,6,144,129,15,144,187,9,209,7,15,240,187,15,209,33,
+13,48,227,17,176,213,11,48,237,8,210,91,139,133,119,63,149,39,183,176,204,127,184,223,255,234,67,230,125,220,203,205,195,139,207,239,243,251,236,113,
+48,253,119,101,197,107,182,165,177,220,101,243,17,145,15,160,94,21,185,4,49,189,112,115,188,104,109,82,100,9,147,118,65,232,11,181,211,190,218,183,
+30,132,180,201,69,240,42,53,105,211,31,187,83,93,202,198,120,131,109,84,148,216,120,201,124,147,92,91,150,221,228,93,208,6,162,218,102,72,204,253,
+35,2,198,8,134,158,170,188,2,172,126,88,198,108,167,224,170,153,133,98,89,168,252,9,71,186,87,197,108,107,96,216,124,195,122,49,231,72,8,5,
+70,71,3,212,84,32,164,85,67,106,45,100,180,13,36,242,37,1,120,86,32,174,40,132,54,55,98,48,36,37,26,10,0,70,85,33,98,15,68,30,
+49,225,96,33,164,90,2,44,9,155,167,207,59,252,64,185,139,253,93,255,255,134,251,221,127,192,160,94,226,19,240,125,207,43,241,248,250,223,233,67,
+250,28,65,7,186,142,237,211,240,193,196,176,161,188,3,32,66,59,233,48,227,142,186,35,117,210,66,152,214,214,65,27,173,110,214,84,110,168,9,147,
+222,217,131,102,115,75,66,198,181,26,181,70,34,140,166,51,64,70,79,140,156,105,3,202,133,104,52,208,146,83,37,88,113,44,11,156,188,112,36,68,
+180,235,19,177,242,196,37,199,144,45,50,217,248,28,25,140,236,144,153,97,64,73,126,11,84,190,214,40,30,18,4,212,140,249,14,65,113,36,137,228,
+145,208,144,8,79,44,146,135,160,249,64,140,184,138,252,148,202,48,62,78,148,76,2,152,241,66,116,101,11,52,142,198,80,80,76,124,57,1,88,229,
+196,216,119,57,105,120,150,127,181,150,54,255,231,55,255,135,47,199,63,255,212,184,227,189,172,214,172,176,188,252,42,243,239,211,240,88,208,115,236,95,
+47,207,53,238,23,115,35,231,196,98,182,183,163,19,80,60,217,17,42,64,7,1,224,17,147,161,192,27,200,53,183,145,47,170,75,131,15,244,41,77,
+105,164,160,122,77,176,206,70,151,149,117,65,12,144,105,123,45,36,51,202,37,237,19,5,189,90,0,26,33,158,93,9,76,239,227,42,214,199,206,165,
+44,4,17,13,70,103,72,88,179,96,190,191,133,142,107,107,8,22,9,130,103,135,40,136,96,112,158,68,142,77,168,236,8,71,186,79,196,208,122,96,
+34,108,133,10,75,37,224,20,39,98,43,194,28,121,97,66,60,197,134,77,35,128,38,102,194,23,192,172,106,33,18,44,69,142,23,101,245,194,3,224,
+49,249,33,103,33,255,239,163,251,220,253,223,255,229,25,248,22,127,186,249,147,243,32,77,160,175,223,30,111,30,10,29,124,109,11,242,146,121,62,233,
+61,13,173,121,212,237,230,55,54,189,251,89,230,244,77,178,211,146,2,141,64,116,159,24,112,210,196,212,222,128,156,80,193,176,15,0,152,56,197,44,
+65,0,252,195,193,128,83,142,76,97,201,240,157,206,124,148,0,245,51,195,48,125,145,84,93,205,0,156,77,188,195,0,145,16,198,56,155,142,60,35,
+78,192,108,201,84,223,130,136,200,72,88,165,138,164,8,14,56,80,70,92,206,2,16,161,71,80,127,137,204,0,10,112,97,198,148,139,128,244,168,67,
+192,56,10,252,38,197,112,131,199,220,69,131,228,175,192,232,3,138,244,53,66,160,125,198,228,53,3,108,203,217,58,217,223,161,183,143,39,166,199,255,
+126,191,252,236,98,195,209,99,254,38,31,193,47,222,215,246,6,55,77,48,193,224,223,176,88,95,61,48,248,41,86,107,187,92,41,58,202,108,111,47,
+62,216,137,71,169,190,119,82,86,209,93,105,48,186,160,122,144,220,144,174,99,99,13,99,226,136,185,24,49,114,202,147,106,143,15,122,25,147,64,51,
+31,24,9,136,1,68,140,24,61,10,104,225,130,200,89,138,24,104,133,104,81,133,136,111,130,88,20,134,216,46,131,160,60,133,8,102,1,112,97,133,
+96,117,4,216,29,11,32,15,130,120,181,4,16,84,135,128,139,5,184,25,10,112,54,132,152,133,0,64,145,131,16,52,10,168,57,132,16,148,137,200,
+30,6,8,222,130,88,44,142,152,119,128,200,193,139,184,12,135,104,210,130,8,25,151,58,244,67,179,240,134,250,26,110,89,248,136,255,255,17,208,90,
+189,215,245,22,158,223,250,132,252,106,188,31,61,28,71,174,235,69,100,4,211,93,105,204,217,48,213,136,15,71,132,21,218,79,86,138,74,112,133,100,
+205,131,175,118,249,186,208,26,141,190,107,68,223,150,213,59,41,209,69,221,20,229,180,90,240,61,103,34,98,130,88,166,37,210,217,149,202,55,19,90,
+82,147,128,30,36,216,18,12,81,155,140,200,211,11,233,37,135,224,9,144,136,22,5,160,156,131,104,119,2,152,71,134,64,44,2,184,65,5,112,4,
+2,128,92,2,128,33,4,112,53,2,48,42,2,176,28,1,96,11,0,144,6,1,152,21,128,232,54,131,216,41,132,120,101,132,184,78,136,56,108,133,
+104,137,136,168,93,135,200,154,134,72,100,136,168,99,132,184,170,138,52,185,188,87,191,172,133,7,38,239,255,254,50,126,4,254,52,30,163,155,84,127,
+183,74,133,127,91,206,200,188,74,122,145,32,68,68,195,84,95,41,96,88,182,137,196,138,97,155,60,175,134,238,88,91,197,231,140,161,153,230,127,138,
+180,136,180,11,75,12,84,170,74,215,248,132,27,61,64,101,164,164,85,127,42,8,198,69,69,35,227,16,109,48,139,96,65,236,136,24,160,39,179,67,
+152,74,182,22,74,188,157,160,99,45,216,132,24,114,13,140,41,225,13,9,132,151,192,105,25,248,177,19,225,33,130,137,137,5,152,187,148,96,113,14,
+216,175,15,128,187,128,17,28,5,8,134,141,112,37,12,232,83,7,80,207,131,200,126,9,104,180,132,96,72,143,136,24,128,200,250,135,216,9,12,56,
+204,128,120,116,142,184,41,130,40,222,129,200,185,217,227,98,239,244,240,196,43,6,159,255,39,255,253,44,127,204,107,140,181,104,189,150,250,134,255,135,
+96,180,254,182,189,122,185,20,117,135,5,124,133,11,236,207,194,136,251,31,209,185,207,7,2,225,165,174,221,139,162,181,141,74,42,99,125,77,151,105,
+204,56,187,110,107,79,199,78,194,116,208,170,217,59,150,79,175,97,229,208,190,38,136,1,83,146,26,134,4,104,83,54,49,71,131,17,54,154,34,104,
+234,142,99,4,57,185,133,185,17,107,177,26,183,13,99,95,145,34,103,39,104,176,175,0,226,158,90,96,12,130,65,146,81,243,27,168,64,165,80,172,
+148,233,221,7,161,191,141,161,77,24,136,78,152,160,218,147,153,37,0,137,173,133,160,149,25,72,138,140,209,15,147,248,149,6,57,141,129,32,48,22,
+136,125,136,160,246,141,152,14,83,195,115,47,222,203,237,249,248,156,255,82,159,255,147,191,231,73,252,255,181,143,183,15,12,159,22,142,139,95,166,89,
+37,126,40,92,95,246,211,241,252,34,45,60,230,125,37,199,79,4,132,106,40,225,160,54,82,216,127,69,133,52,57,216,9,92,118,98,224,195,84,103,
+40,105,211,69,157,105,233,84,88,115,101,132,242,67,83,12,113,34,129,22,181,77,144,65,186,199,133,181,11,10,88,163,8,220,15,210,125,175,224,97,
+46,210,186,196,33,0,217,99,228,179,11,174,69,237,124,65,233,222,169,195,228,179,228,180,151,136,78,30,107,68,46,38,166,143,2,240,134,164,24,112,
+70,230,22,232,44,52,101,174,98,192,228,122,34,56,62,70,234,35,164,204,68,229,170,54,128,254,116,32,164,25,70,142,39,226,196,67,36,214,40,193,
+26,109,99,144,180,29,94,61,123,63,206,171,231,87,253,180,127,246,135,77,159,254,164,25,20,244,105,85,56,164,120,220,115,191,227,127,247,94,20,239,
+132,63,0,237,195,186,17,132,134,236,16,215,129,141,38,136,201,53,75,160,195,134,0,11,6,45,17,140,73,98,71,89,213,149,212,229,226,32,46,240,
+121,106,68,20,145,136,156,64,145,242,211,206,29,5,107,19,246,2,46,73,24,135,163,90,60,90,42,188,193,103,190,58,177,17,196,23,197,153,108,24,
+28,180,90,248,131,214,85,76,8,129,136,72,49,67,145,148,88,215,240,88,79,37,45,7,121,35,200,105,6,14,28,53,210,208,89,204,52,228,131,217,
+0,69,112,167,141,244,71,76,40,125,204,44,139,0,140,250,65,232,79,142,20,89,199,24,142,203,84,87,2,92,215,65,128,54,141,220,64,134,195,159,
+7,148,199,246,50,68,191,253,38,255,188,111,226,75,255,217,235,52,111,218,108,100,162,117,169,97,189,250,13,243,176,232,57,241,169,2,47,134,118,115,
+121,236,246,112,41,109,95,233,101,70,202,52,133,84,176,138,252,171,210,152,96,129,44,7,1,216,178,1,44,192,205,80,147,21,228,46,21,1,60,206,
+29,143,135,21,198,81,88,155,160,122,10,203,24,201,104,82,201,196,186,231,40,168,64,207,146,22,202,56,180,38,82,192,131,210,181,104,252,65,204,34,
+48,73,172,135,227,122,182,66,98,125,232,224,65,8,250,60,200,116,104,161,226,154,66,30,95,167,72,43,7,142,45,69,244,100,226,22,106,3,38,93,
+100,160,7,71,122,16,195,4,106,162,222,60,68,38,92,162,148,16,102,234,2,193,112,94,34,102,45,196,10,64,104,73,161,183,209,91,229,129,226,73,
+255,240,201,254,189,190,255,63,187,7,248,168,127,178,45,254,253,130,133,105,6,238,46,127,221,182,52,7,213,223,217,0,172,188,197,245,156,219,99,167,
+136,35,116,58,166,141,62,117,66,27,235,173,198,250,41,210,181,9,40,215,33,153,233,176,128,31,32,88,245,12,225,50,131,232,83,6,200,119,135,88,
+73,129,152,221,139,136,70,10,153,80,132,0,8,153,152,59,138,1,83,142,200,242,9,73,116,140,48,86,24,120,45,17,33,14,136,169,97,4,25,8,
+146,48,160,17,248,135,19,240,192,131,57,111,1,248,190,145,208,141,15,88,121,15,192,199,132,41,9,5,184,212,138,224,32,17,216,23,7,1,10,136,
+168,119,11,57,7,131,112,72,147,184,50,128,177,25,138,24,49,11,136,230,130,160,44,155,235,124,79,43,246,10,243,58,240,180,255,197,15,255,220,133,
+59,179,238,255,103,47,133,63,239,107,252,62,43,237,227,38,150,146,20,98,33,147,187,221,212,48,186,226,158,15,221,177,46,199,138,79,82,162,152,226,
+163,127,236,51,181,137,6,141,106,37,107,43,92,108,2,170,212,48,240,130,117,22,192,122,82,13,98,190,48,104,14,120,23,159,113,134,57,216,64,162,
+226,51,156,169,198,10,234,91,140,128,111,33,56,59,142,193,69,143,24,230,6,105,41,136,112,75,15,72,24,10,128,122,131,216,188,0,48,90,137,32,
+101,4,72,79,9,112,21,129,48,148,1,192,20,134,80,64,2,168,39,4,64,46,129,136,41,2,184,74,128,168,40,134,248,64,131,24,128,134,248,71,
+135,232,144,134,8,116,137,216,115,134,120,145,135,184,81,134,248,112,141,170,226,79,11,238,25,251,177,3,87,189,207,255,250,106,189,71,192,139,191,128,
+245,255,151,79,136,167,226,9,248,69,201,31,214,113,197,234,226,249,9,140,149,137,234,169,56,40,14,38,45,117,12,183,6,112,32,125,184,52,205,105,
+71,170,240,211,102,95,63,74,56,98,250,0,248,139,71,70,54,182,218,5,155,27,190,243,151,84,140,22,228,244,254,237,251,21,97,131,145,42,130,30,
+212,97,65,29,164,152,5,43,217,120,91,219,100,247,10,73,155,193,193,55,15,228,165,212,104,46,80,188,226,8,249,4,68,113,0,10,4,76,208,208,
+19,74,132,191,6,248,185,68,56,186,8,68,58,75,192,43,201,12,119,130,216,177,65,40,95,137,92,83,197,248,88,73,180,47,129,44,181,65,116,29,
+9,180,93,194,184,96,200,164,30,129,132,163,65,40,96,179,134,240,44,255,135,244,200,253,89,127,254,199,126,210,127,249,218,65,233,185,252,225,73,207,
+249,128,113,187,248,163,253,170,166,237,236,83,85,173,96,173,254,95,50,224,15,192,155,18,18,54,129,210,18,168,157,31,6,146,135,240,224,145,37,94,
+192,22,240,16,51,137,141,167,130,42,207,112,58,132,69,125,194,126,146,144,139,131,44,222,132,6,143,236,140,180,147,239,9,56,145,60,11,69,195,0,
+93,99,70,164,135,253,18,176,38,113,229,187,69,55,70,15,246,187,76,195,94,104,17,16,95,100,3,39,118,60,8,20,143,69,98,204,75,241,90,75,
+195,41,26,20,220,11,83,149,52,65,174,65,176,200,49,163,43,27,147,38,22,179,109,30,128,106,63,176,6,25,131,69,30,49,214,28,243,39,18,32,
+47,54,208,5,17,195,15,3,16,156,215,203,178,119,247,220,189,55,252,21,127,214,111,254,27,191,251,161,121,235,125,75,97,90,50,125,208,19,187,237,
+123,184,215,175,7,193,62,9,255,32,234,110,237,127,196,177,190,50,77,119,73,194,56,40,104,179,112,86,1,184,30,11,145,242,15,41,43,177,96,77,
+52,218,58,40,115,247,131,188,17,21,197,127,96,40,13,177,143,71,196,164,140,152,123,188,163,26,176,171,166,8,220,59,80,128,236,161,34,14,109,8,
+172,105,70,211,1,194,220,40,88,106,141,22,17,11,180,126,165,202,194,128,178,154,232,84,96,73,158,36,201,252,96,99,154,163,0,190,117,38,216,68,
+72,10,27,71,40,93,227,102,113,194,26,109,164,80,27,71,226,3,4,0,101,227,230,66,67,82,105,226,80,1,39,66,8,98,48,91,35,70,50,131,
+38,91,38,249,112,207,131,87,203,211,237,209,255,195,79,252,251,255,116,159,141,103,253,167,63,138,143,19,254,113,16,66,78,109,151,74,255,218,179,0,
+222,169,62,153,146,20,244,55,186,103,31,110,1,41,51,198,209,199,106,7,123,196,116,155,122,164,62,178,201,133,58,195,6,24,214,141,48,88,0,152,
+81,133,56,176,3,89,117,137,48,169,32,168,110,151,241,165,156,41,158,7,74,182,141,224,233,44,24,116,157,113,216,156,137,240,6,10,138,147,17,21,
+38,136,8,160,97,116,147,122,37,1,89,226,151,161,54,28,232,94,32,1,14,139,170,15,0,33,105,150,113,6,24,24,96,25,113,8,138,121,140,4,
+41,90,142,224,128,25,8,9,14,209,66,141,168,228,10,105,114,134,208,0,25,200,59,134,225,79,141,248,136,11,121,64,133,176,0,158,90,50,55,215,
+205,179,216,179,241,34,151,251,70,255,250,50,245,103,3,143,254,15,219,20,255,64,63,44,108,125,164,150,210,174,75,180,82,248,119,25,186,39,63,174,
+145,237,95,229,65,38,253,68,120,116,59,166,198,241,150,192,146,195,101,23,119,132,63,124,152,182,19,211,170,152,18,76,33,184,117,154,80,170,143,232,
+109,1,136,164,134,120,93,130,168,125,143,152,20,128,201,82,136,8,124,17,201,39,139,32,104,154,40,106,7,49,153,131,249,27,16,56,246,148,128,23,
+150,8,232,13,113,70,131,1,115,11,40,143,152,176,31,16,73,22,14,129,11,133,49,91,10,120,117,149,16,11,143,216,206,8,177,40,128,240,219,14,
+200,174,140,64,116,147,40,85,0,145,92,132,72,86,18,56,217,133,176,171,147,88,30,2,137,56,131,104,65,20,216,175,47,167,142,55,226,189,228,156,
+193,63,255,208,223,202,141,106,127,200,155,148,7,253,242,105,205,244,252,204,174,86,166,173,10,170,11,102,102,133,253,229,165,75,188,111,79,200,219,118,
+1,163,86,247,90,218,169,95,26,39,83,184,190,55,138,109,129,11,95,77,178,94,36,139,53,100,15,109,151,50,20,135,77,35,99,160,82,241,135,53,
+162,125,51,241,168,8,147,63,1,176,54,36,145,45,1,129,69,21,176,85,10,80,241,8,240,125,5,144,101,8,80,6,0,224,113,0,192,154,2,176,
+29,14,160,80,4,144,224,13,32,67,8,1,42,0,176,0,18,160,74,6,144,196,9,160,159,2,0,182,9,240,133,7,160,109,16,208,7,3,81,89,
+9,240,37,21,17,45,4,145,13,24,176,141,11,177,151,13,208,119,20,81,13,4,144,203,30,120,236,106,189,253,184,54,220,151,215,255,225,175,255,28,
+222,231,157,198,62,156,95,211,95,156,159,250,68,67,199,215,167,85,106,47,58,105,70,146,125,77,145,251,46,121,22,104,129,159,154,174,243,226,128,14,
+89,123,65,60,198,223,113,120,200,99,21,52,69,209,17,175,234,67,108,99,182,187,90,226,72,122,123,229,219,54,37,125,132,12,15,131,106,67,102,4,
+159,16,31,34,22,40,67,181,129,75,192,43,103,209,230,43,165,57,17,19,234,42,211,29,55,0,16,59,113,224,34,98,239,0,99,34,21,17,95,46,
+192,118,31,81,218,29,33,171,7,66,102,12,240,189,33,224,48,22,177,42,15,193,139,0,17,60,18,209,11,14,64,155,27,48,34,1,113,231,11,112,
+28,26,49,113,0,81,29,29,80,95,9,81,201,12,16,29,22,144,197,27,25,133,96,201,252,245,189,232,44,247,254,164,255,255,156,95,214,243,216,187,
+19,173,94,127,3,31,206,235,145,23,240,177,143,87,171,102,155,50,145,196,152,119,11,132,79,70,34,84,6,243,18,251,93,46,134,24,239,173,129,53,
+192,208,199,69,198,3,175,174,4,138,69,139,203,81,84,34,189,39,187,115,6,45,153,204,218,137,10,182,40,193,1,41,140,152,156,119,22,38,8,239,
+68,18,82,1,48,229,4,129,120,246,182,50,22,172,10,221,2,131,90,150,145,225,43,136,72,170,177,79,153,42,106,4,194,20,150,129,145,27,248,35,
+34,64,216,142,105,236,3,161,110,145,193,21,21,248,21,22,224,218,140,249,51,2,153,83,136,160,108,22,104,64,138,145,15,143,40,134,8,153,87,129,
+192,12,149,152,103,131,225,3,141,56,85,7,233,30,129,18,208,104,109,241,208,255,17,174,75,127,64,95,255,210,188,142,191,220,136,7,95,183,219,87,
+8,111,197,139,226,255,175,127,226,44,174,189,116,244,154,161,37,139,199,65,231,132,208,27,140,5,34,160,48,243,99,195,100,3,155,146,221,76,20,162,
+217,43,185,75,106,55,159,109,213,21,38,110,243,204,52,107,32,163,164,92,167,58,117,243,86,88,216,197,194,160,84,39,38,103,204,161,23,50,183,129,
+98,93,184,11,85,5,4,29,75,233,45,155,100,81,218,0,210,81,229,110,131,33,105,76,120,254,146,140,5,213,176,137,74,181,55,3,8,247,203,56,
+195,141,236,11,144,48,123,72,60,223,0,64,211,71,16,108,13,68,22,201,112,148,72,220,124,131,108,209,194,208,28,13,60,53,196,136,156,72,156,68,
+132,140,178,193,232,12,139,252,40,2,171,99,110,184,159,238,24,157,191,146,175,255,35,223,224,255,255,207,138,160,90,189,231,202,228,63,137,164,195,254,
+217,62,223,219,162,124,136,219,99,181,38,29,177,73,200,168,34,154,213,16,14,48,133,130,4,141,91,72,204,32,54,137,81,128,133,121,117,211,184,239,
+227,239,43,163,208,169,186,18,71,162,98,103,247,63,165,23,145,172,76,8,106,145,38,136,239,18,67,55,184,183,40,28,26,93,248,70,164,62,97,11,
+137,3,50,27,123,195,233,95,54,156,16,231,83,53,68,234,94,176,173,106,162,175,61,53,230,17,133,41,52,164,18,70,176,3,85,226,53,43,244,168,
+8,36,43,39,98,182,63,208,71,57,194,129,42,147,6,8,19,249,20,161,58,63,144,211,32,130,203,42,177,202,17,211,155,11,0,116,54,208,175,24,
+66,157,21,145,138,205,67,193,75,248,15,120,51,127,227,51,253,167,127,231,167,254,247,159,191,167,235,43,41,181,210,212,146,92,223,15,153,66,124,215,
+188,27,243,89,249,199,34,207,97,221,210,173,1,178,154,41,98,73,8,84,101,148,112,64,29,169,139,18,208,51,0,104,72,151,96,158,32,72,234,34,
+146,121,143,235,36,21,171,11,170,112,180,65,20,110,148,73,208,204,13,168,142,229,181,213,32,55,32,170,58,73,28,219,36,190,197,134,158,177,170,112,
+29,141,78,76,200,152,169,226,30,186,68,158,119,234,64,37,137,150,89,71,212,125,224,86,163,67,126,83,40,216,27,71,138,75,69,204,110,160,110,118,
+3,246,77,166,16,2,167,62,41,130,240,114,97,150,67,132,242,82,227,108,29,167,6,16,0,240,107,225,242,40,4,158,68,226,184,26,103,58,142,19,
+122,250,98,123,14,126,108,223,249,88,255,229,67,234,227,180,231,255,0,207,198,175,228,15,239,105,6,100,243,156,234,146,246,224,91,126,240,253,59,51,
+16,244,67,111,239,12,45,95,233,131,214,208,166,244,13,194,178,71,216,85,157,133,110,160,158,136,178,150,16,182,79,79,98,166,75,208,148,43,98,45,
+21,176,242,10,209,63,12,144,181,6,49,81,27,144,24,10,178,173,5,16,128,43,113,117,22,1,179,41,209,100,0,211,27,8,129,134,40,80,207,39,
+65,29,30,210,90,10,162,85,21,226,36,28,176,5,45,192,155,19,82,142,13,33,203,23,33,238,25,208,4,36,224,213,19,241,210,2,161,255,11,128,
+240,32,240,153,18,129,135,27,208,192,11,146,97,1,112,1,37,241,13,5,97,199,29,48,70,14,146,21,0,208,6,50,180,226,119,79,177,199,213,107,
+176,23,204,135,255,250,24,187,172,204,191,210,17,228,127,229,139,239,133,231,41,228,226,121,52,246,86,130,54,183,43,28,110,109,145,172,234,123,152,24,
+15,23,157,131,173,153,201,5,84,56,12,96,19,23,29,175,138,119,7,186,225,64,66,248,102,57,73,232,225,169,252,221,138,126,38,45,52,93,145,15,
+16,229,94,97,211,73,80,34,111,85,242,202,9,69,75,150,5,132,68,117,99,210,74,131,42,91,99,12,7,133,94,12,194,164,53,161,38,54,64,242,
+32,34,212,19,65,214,26,130,132,14,160,124,45,128,60,5,98,80,18,64,166,20,65,148,10,96,36,22,64,122,12,96,156,4,33,126,5,160,74,29,
+161,78,9,225,230,33,33,34,28,98,130,26,225,154,40,226,14,24,34,54,35,97,62,25,34,42,30,162,237,74,79,28,15,241,170,79,76,63,255,255,
+196,223,184,255,225,185,208,171,7,175,240,171,62,207,240,248,240,237,236,151,235,220,132,25,60,171,195,58,32,32,195,191,109,16,161,153,137,170,70,104,
+221,94,88,136,238,168,66,121,87,224,53,42,236,248,207,75,32,42,149,191,46,59,134,15,105,217,172,49,229,204,73,90,104,210,119,93,153,171,28,28,
+162,92,216,190,38,30,44,77,144,252,168,18,236,134,30,230,234,52,53,143,54,46,9,124,173,36,94,179,195,226,142,40,180,49,9,162,60,71,204,109,
+33,134,149,66,38,82,167,132,43,70,90,58,198,0,79,160,170,110,130,22,63,229,72,17,197,138,32,195,92,81,225,134,61,131,66,69,98,140,14,101,
+194,3,64,224,86,226,98,25,131,210,69,97,32,26,101,18,0,96,96,76,160,18,25,56,206,112,204,255,95,170,84,121,196,255,242,221,255,193,103,255,
+19,14,37,207,79,204,87,76,127,225,40,18,127,181,143,128,7,107,79,90,80,121,232,209,26,120,179,205,96,202,133,124,29,66,161,243,1,157,224,226,
+156,219,84,39,47,138,247,70,149,153,111,72,60,117,99,150,179,122,91,212,143,41,41,42,118,161,168,161,150,209,22,17,200,197,83,81,134,136,196,96,
+213,166,58,134,219,27,86,178,44,41,47,140,195,102,59,121,201,190,241,83,182,170,238,18,83,178,145,66,211,42,24,228,181,128,215,163,138,162,16,114,
+149,147,2,80,30,248,107,170,224,177,153,186,21,10,66,19,142,17,146,28,40,119,156,240,237,152,9,81,0,209,249,133,240,199,28,200,173,144,81,36,
+151,152,188,5,41,204,129,208,91,25,56,145,140,1,9,144,88,152,90,203,165,7,234,173,246,56,255,47,255,235,115,255,207,55,246,166,255,44,143,117,
+155,185,181,207,8,109,118,62,166,226,249,248,121,113,199,227,155,238,60,92,221,30,111,209,122,139,218,131,85,44,11,36,182,209,160,134,132,240,55,64,
+165,91,129,21,67,214,73,1,31,196,91,160,100,211,169,39,20,161,231,138,43,46,30,84,163,195,81,238,159,125,70,224,208,88,177,9,90,2,174,141,
+184,114,50,211,130,159,235,161,19,203,137,169,225,38,60,72,201,44,130,165,146,123,68,12,218,109,168,129,29,43,25,14,39,1,238,136,234,207,9,57,
+180,162,192,218,33,136,236,29,17,172,135,122,12,11,249,131,151,208,75,31,120,117,16,97,190,138,201,55,16,217,135,141,80,53,158,40,24,7,65,170,
+139,88,189,16,105,72,138,112,52,157,201,94,52,55,151,151,173,7,247,240,253,65,255,229,135,254,110,162,147,255,224,101,197,191,220,190,123,210,60,206,
+107,76,125,53,254,56,132,161,240,57,224,61,198,163,190,152,34,245,108,161,141,41,243,90,38,201,234,185,35,146,42,24,57,36,32,18,1,24,14,9,
+1,56,16,120,185,163,48,102,167,137,210,19,195,94,130,114,176,44,74,7,176,209,1,186,202,8,17,196,9,64,201,80,152,44,254,216,0,137,218,221,
+12,136,49,197,195,121,64,19,236,170,215,120,94,83,221,30,8,201,83,70,177,47,142,164,87,85,224,57,205,221,14,135,241,4,199,40,251,12,76,59,
+81,112,70,203,196,204,4,32,240,196,56,159,12,244,81,203,24,115,76,44,118,128,100,242,192,216,73,141,108,99,198,104,134,75,92,73,2,12,208,192,
+224,54,141,180,91,139,59,187,87,182,183,237,173,4,63,255,77,63,203,71,204,199,255,145,70,94,223,230,223,38,237,77,149,81,17,247,209,215,147,129,
+135,165,136,94,252,36,179,67,216,55,197,176,234,57,84,221,123,9,76,145,64,131,19,38,119,108,217,109,11,179,52,158,81,226,24,8,6,144,32,30,
+131,168,87,128,128,124,15,248,210,144,144,154,158,184,206,7,2,119,131,73,105,32,169,139,155,240,215,168,185,50,9,210,183,128,129,182,31,57,66,161,
+48,155,161,137,143,13,162,44,135,241,226,23,56,172,163,48,71,151,105,182,14,225,160,139,129,192,18,88,96,158,192,74,146,169,102,9,225,120,135,193,
+50,19,168,129,148,64,160,148,24,205,1,17,148,128,192,137,22,152,189,138,64,230,148,248,94,4,89,129,129,200,56,20,8,153,135,240,220,142,218,243,
+107,153,249,157,121,176,113,202,255,252,104,127,175,13,184,255,11,175,231,125,255,17,156,74,127,71,102,145,187,120,23,169,230,77,149,203,192,183,187,129,
+180,119,217,206,131,113,238,150,161,163,217,170,177,55,161,224,184,83,89,227,207,26,144,215,53,0,11,60,55,139,137,202,120,19,161,162,146,136,136,221,
+33,2,151,71,62,107,38,0,29,103,210,21,192,216,98,97,250,15,131,162,52,160,26,29,34,218,17,161,30,25,225,70,17,224,138,9,161,34,2,96,
+136,11,224,86,23,128,36,10,33,188,20,128,166,20,2,68,3,224,96,41,192,132,7,162,32,21,128,254,15,129,216,16,224,98,26,64,170,26,32,188,
+2,34,110,8,224,28,41,161,226,1,162,54,46,224,190,24,227,102,25,32,254,50,98,86,10,162,70,42,96,142,11,102,15,7,10,152,127,25,111,38,
+236,234,191,240,211,255,249,112,235,13,187,103,239,209,233,35,251,73,255,52,203,246,124,170,226,165,143,97,218,148,170,232,201,162,126,217,52,129,55,30,
+202,28,222,191,143,225,195,111,215,102,204,67,52,209,9,221,133,164,171,61,188,137,133,123,1,24,133,70,10,179,161,27,65,71,81,117,24,213,4,204,
+121,210,9,7,161,94,26,43,148,164,169,58,153,194,130,193,36,124,53,74,142,16,102,0,100,165,2,91,65,126,102,35,100,37,69,86,9,4,88,44,
+33,154,72,0,24,39,227,64,37,194,26,23,131,112,14,160,30,52,192,100,16,226,36,22,1,98,10,193,156,19,96,178,17,128,214,27,32,16,8,226,
+66,16,224,150,37,225,246,15,162,34,40,225,114,29,98,178,29,97,150,37,226,2,19,161,186,29,163,6,175,148,106,250,147,127,1,160,119,244,111,255,
+255,32,19,42,247,118,238,16,26,95,225,111,210,107,240,226,250,28,207,87,204,121,58,104,126,192,9,24,193,9,194,201,56,54,22,70,54,116,14,188,
+118,85,225,195,181,52,120,233,255,160,81,78,101,7,39,42,52,96,62,31,56,5,65,246,52,245,62,4,138,159,179,147,101,78,188,68,226,144,216,109,
+106,249,130,19,17,19,200,54,168,11,134,58,184,38,202,33,167,240,124,173,201,104,17,162,134,128,177,241,22,249,17,159,96,32,153,25,82,15,161,103,
+134,129,148,12,40,103,153,96,11,13,201,22,11,192,234,133,225,18,9,248,81,143,192,45,140,136,140,3,128,244,128,136,102,13,104,148,133,0,143,143,
+40,5,4,41,17,133,168,16,142,216,174,128,76,177,67,27,80,29,8,81,211,2,144,78,190,151,75,207,246,64,33,45,60,127,255,37,127,204,207,252,
+181,179,110,150,151,224,39,36,31,241,152,212,183,227,255,238,57,80,174,128,45,101,93,99,169,22,80,205,97,135,64,144,8,33,98,28,231,242,213,200,
+208,212,177,243,147,149,117,48,195,22,188,173,33,183,56,28,2,133,243,3,24,7,70,170,205,227,15,80,200,16,196,86,98,64,207,71,117,114,92,105,
+158,137,172,38,154,157,161,223,16,60,225,218,134,135,173,0,208,73,101,132,181,64,182,56,7,213,209,62,163,50,85,48,186,83,163,7,34,53,68,0,
+179,179,56,194,156,58,241,2,65,34,83,22,51,248,5,82,235,40,65,126,52,80,108,39,130,129,25,146,84,18,50,243,19,128,60,53,144,85,17,2,
+191,29,113,40,25,50,199,9,0,75,46,144,83,11,98,105,9,144,139,195,35,127,143,240,242,229,197,246,141,255,153,95,255,97,159,249,153,123,218,102,
+171,146,30,191,255,93,42,147,127,5,125,33,62,39,30,119,242,91,242,190,108,188,24,109,88,193,141,74,56,6,228,104,65,212,135,106,112,218,208,13,
+3,154,30,42,107,245,209,16,121,169,238,216,209,22,164,24,206,210,249,206,98,55,51,32,80,167,202,201,54,100,253,70,198,62,78,38,249,112,238,10,
+25,91,165,66,120,71,4,56,95,129,110,86,77,226,129,229,245,210,9,9,156,140,20,26,217,3,77,173,171,0,13,87,209,104,229,20,140,63,22,72,
+195,200,165,93,128,157,3,78,16,159,145,52,45,15,160,191,200,20,240,3,204,240,200,152,67,144,188,5,72,200,209,200,236,140,6,124,229,196,160,5,
+143,76,24,69,0,186,199,92,110,5,220,193,200,210,117,94,33,95,88,143,225,213,254,209,255,226,39,255,133,47,144,87,254,148,223,50,254,17,174,229,
+109,77,36,188,130,98,79,248,114,93,143,203,55,212,82,160,30,97,116,34,225,25,152,154,126,232,32,111,240,247,140,145,239,39,104,254,26,240,18,1,
+48,70,143,17,36,27,24,28,167,129,122,161,42,173,1,211,155,150,210,2,59,232,198,178,178,104,174,234,240,3,204,16,75,152,232,158,228,85,87,225,
+42,212,61,109,129,157,186,77,0,220,152,236,17,86,160,224,77,133,103,0,113,61,78,96,214,18,68,40,148,152,162,72,109,67,0,200,235,77,0,170,
+14,228,42,15,192,155,71,44,236,129,220,215,72,128,86,142,196,2,73,64,180,200,100,138,5,60,217,196,16,14,14,156,34,196,168,181,72,20,85,133,
+172,181,67,112,10,15,188,233,22,211,225,241,237,165,251,85,126,4,63,254,161,190,170,235,155,255,221,59,29,63,238,243,223,51,51,70,117,125,249,144,
+241,164,133,183,152,253,181,59,233,117,229,137,31,168,164,100,247,99,226,197,17,173,221,225,213,139,85,145,78,39,0,195,227,132,156,90,139,193,243,75,
+1,57,17,164,80,205,200,89,201,76,59,128,212,103,67,36,41,66,164,65,199,20,26,65,20,152,196,108,44,7,236,141,196,72,45,75,220,37,3,72,
+178,66,60,126,6,156,112,72,248,1,137,116,100,6,152,132,65,48,171,3,244,60,74,248,28,134,164,120,7,0,105,66,32,154,131,212,51,72,224,3,
+6,204,80,131,216,125,64,60,86,134,68,84,68,88,52,200,164,17,128,68,154,66,244,21,136,4,107,65,80,79,200,196,4,193,156,135,66,76,17,137,
+84,95,29,11,203,123,245,174,230,81,8,191,255,242,133,236,147,11,79,226,173,196,11,255,11,90,188,126,165,28,192,110,87,111,197,142,67,9,223,146,
+223,18,136,2,233,151,199,90,68,157,40,230,97,193,179,90,86,121,230,128,230,248,185,230,192,211,89,160,185,229,142,43,46,117,118,202,82,152,239,199,
+240,144,38,6,107,76,141,3,210,115,107,35,229,92,244,114,0,134,119,19,130,100,80,49,163,47,130,153,52,114,50,4,211,129,12,193,62,41,80,135,
+30,33,35,21,17,184,4,1,99,17,65,56,14,80,86,26,64,41,3,17,130,8,96,105,15,224,246,5,208,90,16,192,51,2,240,186,0,96,155,3,
+96,28,13,80,93,0,0,223,13,176,75,12,241,53,10,80,189,21,144,247,11,113,65,19,48,181,16,145,61,10,176,173,18,112,111,21,250,71,109,253,
+254,115,152,19,32,175,255,216,151,254,56,63,173,183,32,238,125,95,156,239,22,159,245,142,142,31,216,39,176,38,51,90,100,136,20,34,13,240,61,160,
+158,220,149,202,172,90,8,236,136,182,248,19,230,144,244,218,131,192,99,27,204,26,212,103,69,102,69,177,205,194,146,59,13,245,160,156,197,70,207,238,
+166,139,199,38,88,213,13,53,20,205,225,174,163,182,92,176,76,78,87,61,103,128,114,132,121,83,34,195,110,140,10,247,26,218,57,168,208,68,43,121,
+89,27,242,42,129,138,107,15,169,51,162,224,95,26,185,74,22,161,112,130,161,221,11,152,199,153,224,39,20,200,223,13,129,79,128,201,26,14,104,220,
+142,16,80,149,120,77,3,33,104,134,40,108,17,88,250,133,128,150,148,152,7,1,153,61,133,168,65,14,216,134,134,173,66,180,14,254,134,158,249,158,
+65,127,230,123,255,245,205,254,7,95,103,36,223,199,63,206,135,234,69,196,179,248,147,200,115,231,117,203,70,221,252,248,1,182,134,174,12,169,65,108,
+22,228,91,2,35,194,143,234,184,79,186,85,38,247,130,50,39,207,222,173,10,21,121,21,80,161,181,41,209,102,203,202,247,54,249,102,21,213,120,79,
+98,17,147,49,59,217,49,43,12,70,95,232,72,165,178,97,75,213,11,242,107,124,100,63,101,118,122,13,71,163,49,68,182,97,144,227,102,162,201,62,
+21,168,16,37,11,50,131,242,66,240,16,83,129,243,39,52,146,11,3,177,40,130,196,55,48,5,57,130,15,35,50,250,3,211,105,21,65,66,55,112,
+167,30,66,125,38,17,140,17,19,77,7,64,60,51,176,227,15,162,75,31,209,34,15,18,211,16,38,144,226,109,241,102,255,33,15,126,223,213,71,255,
+220,237,107,191,242,192,175,174,36,250,153,216,91,227,89,234,231,176,127,229,208,170,190,114,124,109,176,68,220,124,224,47,172,180,230,46,184,4,188,49,
+3,114,10,15,64,51,108,15,11,195,248,147,154,6,71,250,48,231,67,71,164,13,145,60,111,12,234,154,38,189,11,233,66,160,92,160,147,150,48,111,
+236,52,211,97,43,134,128,137,105,146,193,57,25,93,117,171,132,98,23,165,180,168,77,222,51,110,16,99,233,206,194,2,108,194,38,88,146,73,198,10,
+172,12,68,38,62,168,2,40,140,37,204,113,199,182,1,169,32,65,37,18,122,192,120,123,99,180,65,199,138,18,37,140,80,101,74,71,193,146,120,225,
+152,22,199,102,31,162,252,83,164,250,44,130,30,101,225,76,15,70,226,35,66,229,200,227,193,163,253,30,165,7,254,133,63,245,43,252,67,127,252,123,
+36,237,238,26,202,162,129,230,213,14,255,140,15,163,199,4,15,163,75,89,122,53,106,223,84,126,80,1,79,104,217,72,58,19,54,138,98,67,7,112,
+68,9,153,41,35,18,0,139,27,204,16,187,68,183,161,106,70,44,161,157,186,12,231,91,19,41,103,207,11,215,12,30,201,91,145,67,54,67,12,228,
+224,48,132,239,154,203,2,149,18,242,90,87,39,69,36,183,46,52,21,175,96,97,94,108,178,230,79,5,89,13,118,116,35,83,189,89,33,102,78,114,
+252,66,100,23,3,21,64,30,178,203,70,128,182,65,178,48,44,3,213,8,115,132,37,146,203,44,192,99,64,17,12,19,195,231,16,145,244,43,50,197,
+26,1,1,57,240,134,8,35,87,12,177,128,40,81,91,44,205,96,189,160,63,37,174,157,223,254,50,127,204,31,248,30,255,166,247,241,58,255,41,184,
+96,238,217,16,3,40,231,15,9,47,80,46,137,185,125,252,186,13,159,195,223,138,246,47,220,233,210,123,114,106,125,190,174,45,129,27,31,55,240,82,
+230,69,19,164,180,28,49,13,24,128,70,2,49,9,8,145,120,21,242,193,28,192,56,72,80,80,37,4,117,37,83,120,40,116,197,45,160,96,92,176,
+186,46,164,201,32,148,36,36,52,45,56,160,212,77,145,148,53,35,189,14,116,122,22,242,211,63,1,60,56,114,32,53,2,205,2,116,36,17,82,3,
+55,192,236,46,177,196,39,34,169,5,114,246,24,146,23,36,64,11,49,48,200,17,227,5,15,81,138,34,18,105,18,32,225,49,240,28,3,226,241,17,
+112,222,31,178,1,15,96,165,56,85,180,163,23,227,65,231,49,243,66,255,217,63,255,130,158,49,187,34,127,224,245,248,160,253,90,127,18,7,246,194,
+116,210,194,43,73,99,217,226,11,192,35,28,175,6,181,112,239,241,161,61,113,251,18,14,46,189,184,174,79,211,48,115,96,193,170,65,108,43,86,97,
+77,137,123,107,32,19,219,135,34,142,33,249,77,155,176,166,155,200,124,0,161,94,134,56,4,140,152,173,134,8,120,135,168,161,136,8,29,136,216,182,
+129,128,41,141,136,7,5,64,177,132,40,179,4,72,141,140,32,78,10,136,127,13,16,121,128,241,20,1,56,88,143,144,106,9,40,145,12,160,136,128,
+48,230,4,88,126,138,176,20,13,8,52,5,112,221,133,152,101,10,232,210,131,32,94,145,136,41,129,121,20,137,56,15,13,72,226,128,128,112,143,136,
+23,128,57,117,166,83,205,125,57,62,192,157,4,189,152,255,255,149,92,127,227,101,254,63,134,83,255,13,223,49,79,61,110,224,169,123,52,38,60,54,
+107,153,168,166,246,216,101,210,103,175,240,166,240,251,208,18,234,92,25,78,235,112,202,248,198,135,73,225,97,186,12,234,31,114,184,163,229,49,231,249,
+80,248,172,14,139,237,166,49,59,57,216,26,31,18,74,151,121,143,14,90,6,138,16,16,28,168,59,134,177,32,139,216,93,7,184,204,130,16,13,136,
+152,13,130,0,45,129,56,42,1,64,16,2,128,47,4,16,47,2,208,92,4,144,29,5,64,102,1,16,47,6,240,20,0,56,85,2,32,52,129,224,
+42,5,40,42,129,208,88,135,8,12,132,152,166,132,104,59,139,152,131,131,168,167,139,72,71,135,216,201,133,200,79,138,216,106,130,152,167,129,196,131,
+186,229,127,82,44,97,137,15,255,251,68,252,203,249,149,123,180,119,178,255,119,178,235,254,233,91,243,242,167,224,164,200,137,222,112,98,147,130,112,150,
+228,131,138,149,159,183,241,56,46,62,23,155,161,191,27,192,227,210,166,245,211,250,206,196,161,177,190,157,172,15,240,6,30,186,170,196,129,118,169,142,
+34,209,62,129,74,172,193,192,157,224,226,150,132,117,3,144,70,72,229,131,53,180,146,32,117,25,45,1,12,78,176,126,45,3,47,24,211,56,14,242,
+149,38,193,24,39,145,16,37,161,121,4,82,176,2,113,21,34,1,16,20,113,18,28,160,239,0,81,210,4,176,221,19,160,86,20,240,78,10,193,83,
+10,80,148,16,113,97,1,128,159,28,112,141,5,81,195,18,144,69,22,113,149,6,16,231,26,208,139,5,241,119,4,241,217,168,102,118,223,229,45,188,
+100,127,255,250,102,255,246,95,254,101,29,17,52,216,244,223,244,107,255,5,165,170,253,158,120,83,116,40,226,150,86,183,98,0,129,117,39,211,138,153,
+83,216,178,78,64,192,35,130,237,115,167,109,148,201,47,102,201,66,56,202,230,72,41,184,77,207,34,24,152,92,139,181,131,37,194,249,245,120,41,154,
+117,192,65,57,42,10,25,17,4,134,154,223,196,128,178,98,198,185,133,193,23,144,246,100,198,109,57,22,238,31,150,45,79,66,84,101,17,164,81,196,
+57,26,245,208,16,179,199,71,2,24,67,17,232,66,34,249,12,116,146,13,242,175,54,65,76,54,113,76,43,2,211,15,146,234,23,146,167,30,224,22,
+54,112,76,18,131,17,23,17,114,31,242,179,14,96,167,50,176,33,6,226,185,19,49,16,27,49,237,2,137,166,108,189,250,167,126,153,223,86,63,228,
+27,255,247,55,249,115,127,140,118,78,182,123,231,87,220,163,199,91,244,67,49,127,207,235,96,254,72,62,41,202,77,173,92,117,166,244,216,160,146,136,
+133,124,63,199,66,69,208,132,82,180,93,157,16,24,203,38,18,206,97,74,145,28,162,164,57,220,126,145,67,119,71,215,208,89,10,138,131,244,125,34,
+14,210,114,32,41,25,103,178,225,225,76,44,41,158,185,227,211,94,9,196,119,1,53,182,48,168,30,139,163,58,44,57,102,185,240,174,171,138,176,22,
+82,233,144,98,191,31,232,185,176,176,126,158,170,69,16,146,70,142,18,6,28,24,158,163,48,185,155,57,136,6,82,33,134,97,37,29,72,208,148,241,
+14,155,24,219,2,58,7,128,224,139,27,200,205,141,49,5,150,104,181,2,41,234,146,18,173,120,66,122,189,127,163,183,217,199,254,39,63,242,251,128,
+127,255,169,230,159,62,252,238,249,30,238,35,26,248,241,127,250,120,40,151,207,167,123,142,152,94,23,164,39,219,234,112,53,239,205,120,212,40,98,212,
+142,232,161,160,64,137,192,168,2,160,130,31,197,88,70,227,182,144,65,78,173,38,252,88,141,254,2,171,56,175,169,18,196,3,118,246,231,180,81,208,
+59,2,181,128,93,244,83,96,129,207,110,116,10,38,135,5,9,197,58,75,50,225,94,129,25,80,84,88,40,101,43,23,196,238,54,113,129,87,128,153,
+56,20,22,35,99,249,25,99,254,45,241,23,68,32,235,47,242,248,18,99,185,13,2,118,49,241,117,41,193,173,50,17,160,0,179,197,0,1,24,51,
+209,181,23,129,249,45,240,250,6,243,41,1,32,220,53,49,152,56,175,23,47,146,71,226,245,24,31,255,192,183,229,219,195,159,255,88,45,0,191,231,
+179,117,14,216,12,78,180,117,131,196,99,68,46,237,227,15,237,225,142,110,230,254,72,10,17,215,47,6,44,242,53,247,14,253,127,161,115,38,59,180,
+15,180,224,89,121,184,158,252,20,90,8,195,77,4,224,128,132,202,193,248,31,7,132,64,65,212,55,67,228,101,195,124,9,199,180,107,194,8,77,74,
+92,28,0,96,180,65,140,86,8,84,98,71,200,39,201,60,102,132,40,146,66,56,147,5,140,43,74,240,0,6,12,139,5,208,107,196,0,152,132,108,
+21,201,248,6,69,116,112,3,176,115,66,8,96,134,60,53,69,192,57,71,100,46,0,116,148,229,130,168,48,17,8,178,131,96,190,145,8,5,5,105,
+43,132,136,4,143,40,143,130,240,170,140,108,0,183,80,254,63,220,212,48,42,255,253,169,127,175,156,171,62,30,95,147,103,251,123,227,251,253,194,40,
+207,201,134,187,15,28,143,142,171,11,189,153,141,43,140,46,8,218,160,113,191,26,254,188,20,183,195,95,137,65,202,108,123,71,11,115,99,254,29,249,
+1,66,118,61,117,248,12,138,108,179,99,105,74,172,59,96,224,185,171,166,207,1,202,239,101,100,78,76,218,30,167,44,121,230,214,94,130,22,134,34,
+172,31,134,242,11,35,224,61,98,254,62,64,146,57,34,148,31,66,178,15,3,68,16,96,82,53,192,172,13,162,124,31,64,198,20,130,104,4,32,32,
+32,192,64,10,161,20,8,193,38,1,32,112,21,225,22,2,97,90,30,96,238,20,226,102,26,161,106,39,98,58,25,98,66,39,225,182,30,162,94,26,
+97,106,30,160,222,76,50,104,187,7,244,254,241,150,34,239,251,232,255,253,41,125,252,186,128,121,235,119,141,252,127,127,156,182,52,95,157,189,116,185,
+185,92,109,59,91,97,57,145,210,37,225,213,145,180,19,104,75,168,17,239,105,135,68,140,15,179,31,23,29,107,163,79,74,252,143,136,99,22,152,135,
+75,106,224,226,179,95,136,9,196,118,109,192,87,68,149,102,91,201,106,137,236,4,153,53,143,219,168,66,96,150,110,70,60,234,33,46,164,8,142,119,
+41,188,20,234,10,93,132,188,140,160,204,127,68,202,54,40,0,0,197,106,87,68,36,80,97,212,100,66,202,23,166,16,1,131,118,62,130,148,62,160,
+252,58,194,242,28,227,52,21,35,178,23,64,44,70,32,194,14,67,218,44,224,172,42,36,26,4,97,74,69,161,122,5,163,142,39,224,60,34,35,6,
+23,44,249,129,199,215,107,249,166,96,95,241,223,255,254,175,50,142,253,194,41,228,124,255,163,191,34,143,194,131,237,99,95,191,161,228,34,244,189,190,
+211,129,39,88,30,133,84,16,7,90,74,240,124,158,37,106,195,239,45,39,177,157,30,47,70,33,138,60,73,168,165,119,145,193,192,122,5,50,133,171,
+128,109,89,133,155,159,74,150,163,111,42,71,57,128,28,65,2,118,87,104,188,149,17,133,17,215,30,88,149,109,104,96,177,116,83,164,53,230,109,0,
+5,124,57,83,9,86,64,21,71,115,128,46,100,11,13,132,128,35,177,131,70,160,28,45,146,232,34,98,243,12,131,44,31,81,61,47,64,123,40,113,
+174,14,2,231,0,81,142,37,113,165,22,97,75,42,208,132,3,82,239,9,240,118,38,81,175,10,1,101,36,112,94,3,242,131,5,192,238,206,139,178,
+55,252,23,153,191,209,87,255,226,115,248,25,255,230,89,61,197,231,241,197,112,63,230,13,158,191,208,23,230,57,124,143,83,57,15,108,165,76,211,253,
+142,240,244,1,208,250,140,84,83,15,5,159,105,40,95,149,75,124,233,193,85,204,113,112,30,115,249,96,216,104,121,174,150,221,81,142,174,41,25,211,
+113,233,99,71,46,192,26,168,26,154,51,116,230,198,254,44,13,90,235,48,100,7,216,235,163,114,92,66,244,37,221,169,59,83,29,198,128,117,175,81,
+105,1,24,52,36,153,0,212,203,13,136,0,185,34,207,224,210,17,188,58,19,152,172,199,197,43,1,12,235,203,96,125,143,252,20,140,104,187,200,84,
+185,132,180,232,70,0,36,15,236,25,198,64,199,72,220,105,6,108,211,67,104,1,77,132,18,68,168,176,194,180,32,51,122,232,201,253,166,184,127,127,
+150,255,250,99,255,229,91,255,129,119,206,155,223,78,116,46,7,227,97,41,143,198,199,44,239,144,119,171,109,36,126,42,16,187,221,7,93,232,104,95,
+253,68,36,220,138,97,250,127,131,164,43,195,134,22,75,184,78,104,118,233,2,213,8,52,66,103,104,122,141,220,92,149,133,230,224,216,14,82,215,63,
+69,186,144,89,8,193,129,121,92,229,221,129,6,53,231,104,148,144,169,19,87,52,78,85,91,108,192,9,116,83,242,66,230,113,0,230,120,55,115,87,
+100,64,96,81,51,252,59,36,183,12,5,112,42,114,55,82,192,28,62,243,48,41,36,21,6,227,204,44,82,39,55,192,203,60,17,216,17,100,21,5,
+82,22,50,18,93,31,193,129,57,176,240,2,67,187,8,209,54,43,241,231,25,161,73,50,51,46,163,247,179,23,201,139,245,120,255,186,191,250,217,255,
+97,95,5,79,253,63,191,21,254,159,122,253,73,242,77,28,36,92,223,228,13,72,159,16,191,49,75,34,121,255,206,227,153,246,164,109,151,192,65,26,
+233,99,80,5,78,139,217,178,53,129,192,135,73,177,1,96,70,130,24,26,12,0,190,145,89,66,0,218,83,138,193,47,42,88,202,161,33,204,166,25,
+249,3,59,78,142,33,102,49,120,189,165,97,213,163,106,64,1,26,232,147,209,138,40,232,54,167,97,91,151,218,106,3,114,30,152,113,153,30,72,61,
+37,96,248,143,42,60,3,193,158,150,97,73,25,216,56,28,225,6,142,41,161,2,105,148,141,240,164,27,88,34,144,113,75,145,56,234,9,153,167,133,
+208,22,27,168,94,136,49,82,144,168,149,10,73,98,133,144,27,30,9,213,44,39,192,195,219,59,244,100,249,104,255,250,14,250,184,195,119,255,158,229,
+34,255,174,95,61,12,201,145,69,220,104,167,195,26,74,222,67,52,142,239,137,204,238,72,254,94,206,135,179,174,210,209,172,212,93,194,48,26,158,153,
+221,214,176,161,220,253,203,138,249,113,70,56,219,10,148,71,69,184,39,68,116,49,194,92,2,6,100,123,194,208,50,77,132,11,3,56,236,197,180,133,
+138,44,206,72,240,26,80,220,71,135,40,242,67,20,206,136,76,161,77,48,19,141,116,134,9,248,186,64,208,239,133,116,99,206,160,41,138,36,151,9,
+160,154,65,200,210,133,124,86,75,224,7,137,244,104,5,200,172,64,164,130,136,4,116,198,200,53,203,124,38,1,24,196,195,52,56,137,156,132,195,96,
+81,75,20,15,0,108,169,194,60,50,9,244,25,22,51,177,151,225,129,235,4,145,223,255,195,87,229,163,99,127,242,6,244,188,255,184,42,173,125,37,
+42,31,34,17,191,136,134,35,218,86,192,71,202,41,253,121,130,244,24,170,39,105,56,199,113,118,207,101,229,120,123,39,205,237,239,56,209,151,35,75,
+169,143,69,12,206,227,164,90,45,22,172,2,252,198,97,232,89,71,242,59,35,240,58,37,94,11,129,70,71,33,162,16,226,166,35,161,210,23,161,98,
+36,97,98,0,129,190,31,97,12,5,34,78,16,129,124,29,224,44,46,64,154,13,227,68,18,65,118,39,130,192,20,160,244,57,192,102,9,163,64,13,
+65,182,30,65,220,33,224,12,33,193,178,28,161,112,14,35,14,0,128,34,56,161,146,1,131,38,47,160,70,35,163,202,16,161,58,60,33,226,8,98,
+210,39,32,18,22,36,223,16,204,165,63,166,87,47,76,147,191,254,57,63,249,79,240,24,235,121,250,143,127,20,159,53,95,242,220,39,31,81,156,25,
+169,64,93,102,114,190,183,40,119,205,99,225,17,188,118,118,112,111,234,32,183,58,126,234,157,32,205,210,220,179,52,44,3,217,55,60,169,106,15,95,
+218,149,39,69,196,80,10,71,146,191,66,57,70,34,236,50,91,160,94,35,50,58,201,168,229,165,138,175,70,194,174,103,176,9,11,194,38,69,100,139,
+226,166,112,131,222,91,165,212,16,6,62,48,4,104,70,96,26,93,1,106,36,165,44,25,131,2,50,67,176,37,96,176,70,64,230,20,99,132,11,130,
+106,26,193,208,42,32,106,31,2,18,35,161,20,18,163,94,5,160,114,58,161,222,3,163,38,49,96,134,35,99,162,18,33,66,53,225,186,6,34,122,
+27,163,67,29,203,149,127,21,47,165,165,6,255,179,223,255,241,129,246,174,248,131,102,245,139,239,233,139,248,84,120,77,127,11,21,68,247,204,201,254,
+146,56,101,23,193,66,140,72,112,76,232,158,100,243,99,231,146,197,125,139,49,164,179,75,39,233,148,144,183,171,186,163,111,100,142,160,214,78,173,42,
+222,222,121,75,105,143,47,35,136,180,73,164,68,154,99,168,219,39,68,229,139,187,205,12,180,175,74,17,131,160,130,88,239,32,118,108,166,193,66,100,
+232,165,92,152,203,30,34,108,108,73,39,134,169,130,156,150,37,180,127,7,118,2,234,20,50,100,206,136,193,200,111,100,124,88,70,90,6,166,216,59,
+36,122,86,192,66,107,98,36,39,6,166,27,163,132,75,228,238,43,1,254,105,96,132,7,134,82,32,161,220,70,100,22,33,193,170,88,161,104,171,91,
+142,124,31,191,213,19,196,255,242,3,255,250,212,138,31,254,164,209,29,188,79,41,218,116,125,231,61,150,121,43,254,171,198,11,235,235,196,59,33,45,
+194,73,162,254,137,142,102,105,220,84,132,172,75,224,167,8,129,129,114,56,136,37,244,217,206,122,94,209,227,73,154,147,29,252,207,99,168,126,85,151,
+46,104,196,75,13,55,102,28,147,242,95,128,161,35,79,236,154,156,218,43,103,111,13,132,33,127,214,230,26,136,150,149,210,244,56,88,252,188,145,114,
+170,219,43,13,131,53,153,34,145,40,8,79,180,1,0,156,10,191,11,66,91,150,193,252,32,88,40,167,49,3,151,41,252,3,82,26,142,49,39,31,
+232,106,152,1,72,151,249,44,5,122,12,133,224,117,31,56,151,141,161,85,149,184,193,7,137,178,133,96,89,29,40,172,14,247,77,79,40,175,242,60,
+165,239,254,39,255,231,159,243,229,255,244,132,147,71,231,246,93,208,130,224,32,231,190,128,254,35,156,37,62,138,43,89,239,225,187,254,19,126,0,193,
+111,165,93,180,165,125,81,178,30,147,17,214,146,42,102,8,64,72,128,64,60,19,128,109,150,217,168,11,114,205,137,18,59,44,137,121,175,81,99,181,
+74,72,10,244,15,196,25,49,27,44,212,216,96,203,90,69,46,132,193,227,70,41,36,151,100,140,215,224,154,211,149,61,133,249,107,201,73,29,145,44,
+54,86,176,98,204,253,51,134,49,9,201,248,246,141,124,19,82,176,92,74,52,242,3,64,233,70,240,159,13,100,44,76,24,130,74,180,145,1,76,237,
+194,160,66,14,44,78,70,112,156,74,220,80,3,164,216,193,0,27,12,12,57,197,48,145,196,253,22,55,148,250,157,124,197,183,234,255,251,79,254,255,
+190,59,63,219,91,247,136,255,148,251,255,251,216,17,106,243,209,165,203,57,181,108,91,132,111,181,113,4,248,102,241,20,205,75,177,186,14,115,98,189,
+188,188,118,168,13,187,184,206,210,4,212,53,29,200,241,47,9,220,183,160,103,167,9,83,11,113,198,130,232,137,13,232,182,130,232,110,136,56,185,137,
+104,25,139,153,9,129,48,66,149,120,38,133,145,49,138,152,198,9,185,32,140,112,50,20,8,95,14,208,236,131,201,82,4,40,185,147,80,135,14,104,
+181,18,16,170,128,113,93,2,184,138,146,0,105,13,120,140,13,64,205,130,88,234,7,216,190,137,240,17,145,136,23,4,1,29,136,40,85,13,136,254,
+130,112,113,147,184,47,129,105,35,137,40,31,12,136,210,130,208,63,153,187,181,87,59,247,78,240,232,238,57,255,199,47,255,178,43,24,111,33,254,126,
+31,122,159,188,191,242,128,128,199,108,118,36,135,51,150,21,237,193,241,178,179,55,34,84,32,234,105,143,77,125,122,192,6,206,235,120,228,86,211,87,
+114,238,206,34,128,112,105,195,168,92,106,19,19,198,20,158,72,147,66,193,194,82,125,206,135,213,187,206,32,104,25,132,11,75,193,7,202,212,157,6,
+180,228,196,56,5,140,84,20,67,136,119,68,132,59,130,124,77,194,104,15,3,4,17,130,144,6,64,144,46,129,136,17,2,160,37,129,240,36,2,56,
+38,130,40,23,130,24,34,0,160,15,129,208,0,0,140,13,0,76,33,64,196,8,195,68,40,193,36,59,68,60,34,195,132,87,67,92,49,197,180,72,
+66,188,80,69,60,40,67,148,79,194,76,25,201,37,118,163,253,247,110,252,86,42,1,241,113,255,254,227,230,145,193,163,240,120,63,31,245,125,244,212,
+248,107,124,71,84,127,130,16,205,159,121,195,163,149,180,38,39,18,125,249,0,167,90,188,90,45,213,182,185,93,110,121,90,89,104,235,32,27,120,176,
+209,250,47,88,30,140,197,114,163,110,223,116,38,31,25,117,181,18,9,73,108,23,26,177,171,82,13,131,136,221,174,77,8,91,153,124,0,141,9,10,
+74,60,214,133,196,234,200,152,56,13,84,33,136,224,125,195,84,161,129,84,92,71,200,68,133,68,65,7,96,41,192,120,124,128,144,28,69,200,51,2,
+148,43,132,64,35,64,84,57,1,76,42,193,112,7,68,36,17,64,100,73,195,92,19,68,76,79,194,124,60,69,188,58,195,76,88,68,124,48,68,124,
+74,194,108,47,196,100,46,67,58,162,221,197,63,201,225,176,42,119,255,253,43,254,11,191,136,199,60,141,14,191,175,153,108,255,145,7,53,31,19,95,
+55,39,28,198,148,252,152,129,75,130,254,38,179,184,149,118,43,101,9,173,197,34,230,99,183,208,5,103,159,102,138,49,103,30,52,153,74,79,126,49,
+248,141,12,13,210,99,164,230,214,199,11,105,176,69,197,186,229,44,78,114,203,97,3,150,148,88,41,54,67,125,164,235,109,17,91,147,162,177,26,55,
+216,102,38,98,68,147,106,165,9,106,24,158,208,254,33,168,189,31,177,86,135,42,51,3,169,49,154,144,214,21,232,186,23,192,255,132,25,144,5,104,
+246,145,48,90,20,104,77,12,49,35,136,56,200,11,89,31,134,176,53,150,40,35,130,81,66,139,88,67,13,233,23,130,0,94,147,40,29,129,65,11,
+129,168,149,223,171,104,239,244,40,210,27,171,239,254,228,255,252,183,255,227,197,216,208,69,121,192,243,181,254,46,140,121,252,46,121,130,120,239,120,250,
+158,175,40,102,11,132,203,255,29,208,203,16,72,177,200,128,29,36,91,25,168,130,86,188,93,175,177,24,24,74,224,124,17,119,31,144,132,31,47,2,
+19,149,134,144,236,16,105,252,65,53,71,122,101,112,170,40,31,70,146,27,108,243,26,130,107,145,187,2,29,4,137,66,241,208,154,205,13,95,48,110,
+92,5,91,140,49,195,70,113,131,146,68,140,90,192,59,82,13,59,138,161,57,71,185,57,13,124,76,213,16,55,205,92,242,6,153,3,101,138,81,159,
+26,40,170,155,96,199,153,217,28,2,113,253,130,80,199,27,152,221,142,209,11,153,56,150,3,233,204,128,152,97,23,200,174,139,144,225,146,24,135,81,
+171,150,87,230,77,250,89,127,41,159,231,23,255,229,99,243,222,255,120,14,234,56,36,212,79,131,231,68,111,173,170,2,254,100,154,163,244,163,244,54,
+105,14,95,180,86,190,5,23,195,142,72,1,38,51,35,96,66,71,44,68,227,226,230,128,96,233,235,208,176,17,115,5,232,219,55,75,35,199,224,73,
+101,170,193,73,237,53,48,63,133,99,220,179,12,45,7,230,63,106,132,117,17,251,1,135,30,106,84,205,120,97,167,121,117,8,50,199,129,17,6,56,
+77,18,207,108,160,223,81,244,232,47,133,79,27,229,90,55,113,133,92,32,163,58,84,32,35,4,53,23,3,232,50,145,93,65,1,55,53,82,174,13,
+132,17,7,194,38,54,241,195,37,1,237,53,241,102,3,211,231,1,240,252,51,241,183,23,65,219,43,145,48,2,179,169,37,68,238,240,90,244,118,255,
+45,207,142,255,252,10,255,225,243,78,191,255,32,204,1,253,157,84,154,28,92,123,179,193,228,211,242,92,117,239,143,126,144,29,26,58,156,155,111,70,
+136,113,211,103,5,131,224,142,42,103,49,17,97,128,25,19,11,144,140,16,232,94,34,65,137,152,186,224,3,155,117,159,97,211,64,116,32,90,177,122,
+85,213,183,5,206,22,104,16,104,144,229,7,246,70,96,116,243,105,97,127,120,148,52,48,39,105,6,165,224,75,211,73,102,0,207,86,244,128,48,133,
+111,21,197,114,54,145,209,93,96,99,61,116,50,41,100,59,23,100,96,47,81,97,72,64,207,53,147,8,22,3,255,10,162,186,52,49,191,44,193,167,
+55,49,166,1,228,9,1,241,80,54,17,237,26,33,243,49,241,14,4,179,91,0,129,18,51,48,182,37,206,137,30,181,95,192,200,182,63,252,47,255,
+120,95,173,239,254,255,29,71,63,196,13,10,50,118,150,96,186,245,5,210,99,172,135,166,122,157,252,159,175,167,194,215,187,131,111,114,35,162,230,40,
+151,207,26,59,207,34,139,63,193,168,133,19,36,133,138,208,79,193,124,4,130,128,28,9,228,17,201,104,184,203,156,202,132,29,89,71,208,115,24,84,
+57,207,217,28,80,109,20,5,5,137,202,152,137,24,100,17,81,200,253,76,197,56,2,189,55,205,128,163,146,220,51,18,136,181,199,61,63,128,100,218,
+206,104,162,14,52,79,144,120,146,68,181,13,1,52,180,75,88,105,13,44,44,139,16,165,69,220,173,4,164,191,70,32,22,142,36,10,69,24,189,199,
+132,89,6,244,192,194,224,23,77,4,24,194,176,163,69,196,77,133,244,154,214,35,46,47,198,107,212,75,200,43,255,228,203,254,135,251,22,253,1,191,
+210,83,253,14,248,18,254,53,130,235,76,52,101,55,13,191,41,195,163,191,129,227,170,120,251,226,33,200,187,156,138,2,246,224,151,94,40,59,72,38,
+22,109,177,112,168,69,101,198,110,174,138,190,234,112,208,16,104,2,152,65,239,45,216,156,156,113,96,153,56,214,6,9,141,129,216,13,145,40,154,131,
+104,152,137,200,115,134,104,81,135,248,115,128,16,73,136,216,35,1,160,131,128,128,128,4,104,45,139,112,30,5,72,165,8,208,81,133,176,217,1,248,
+0,14,32,45,4,120,163,7,144,105,131,144,155,5,184,57,136,32,46,137,104,51,0,16,199,131,88,22,12,56,154,128,16,150,142,40,49,133,248,249,
+135,8,52,141,104,169,129,216,143,139,168,24,130,41,134,189,244,232,63,121,15,94,109,115,191,225,11,255,248,156,225,181,177,247,242,226,236,247,253,35,
+255,133,182,188,31,50,86,150,203,224,160,201,93,168,99,109,94,108,138,72,231,153,212,147,242,33,226,248,199,28,79,105,17,153,246,146,102,31,184,212,
+67,107,219,142,145,133,98,162,250,210,230,175,9,20,211,129,183,97,167,27,160,68,151,250,0,40,84,73,198,221,164,20,61,102,84,216,44,219,140,145,
+9,241,112,67,116,247,140,164,197,78,40,20,79,52,130,7,184,197,192,240,195,5,220,76,76,24,21,7,28,131,135,32,99,67,8,157,130,228,27,73,
+40,17,4,140,91,4,56,85,65,48,85,4,52,48,196,24,35,197,252,18,0,92,116,66,92,5,134,172,87,192,68,78,199,116,27,195,4,123,67,124,
+24,70,76,77,192,100,60,69,108,59,85,58,212,223,69,175,234,233,29,63,86,31,255,242,163,61,47,219,19,35,128,165,254,76,60,42,63,96,47,184,
+190,41,63,87,70,183,213,190,212,207,16,115,97,198,18,241,138,42,106,10,194,18,175,22,173,34,221,25,30,46,171,185,21,33,6,89,48,214,173,118,
+6,101,183,138,20,5,103,199,95,1,152,188,155,28,67,114,172,36,255,57,199,63,136,140,100,0,54,119,40,208,177,18,33,25,24,6,45,11,24,185,
+144,32,192,84,249,144,145,189,192,245,153,14,228,231,88,120,14,148,148,244,142,73,38,66,225,82,137,204,128,212,64,18,142,28,206,10,144,226,66,160,
+243,137,36,109,77,248,29,76,188,124,4,216,224,64,132,131,138,228,130,199,104,85,205,4,49,128,56,222,194,156,57,138,212,126,196,72,90,202,204,43,
+128,0,190,194,208,80,182,52,238,133,255,22,41,125,253,254,127,252,82,126,220,255,253,102,159,107,47,253,165,79,207,244,30,198,135,232,219,244,60,201,
+99,230,27,56,206,159,89,143,182,78,77,1,174,196,233,80,105,68,32,29,99,218,229,68,73,3,117,72,131,212,104,198,222,147,74,211,18,153,167,16,
+5,81,85,82,19,20,21,43,25,199,53,44,87,227,112,16,148,115,70,6,104,151,169,29,196,161,135,94,30,2,0,7,29,20,24,81,72,66,135,107,
+212,36,170,133,185,96,42,55,74,33,35,227,8,130,179,82,25,89,136,178,128,66,38,169,249,29,66,75,133,114,158,21,153,36,166,192,13,160,57,104,
+17,162,31,128,209,171,24,41,52,152,0,139,159,168,187,5,210,25,132,168,225,25,137,59,142,64,196,156,56,113,1,49,192,130,200,178,22,216,84,141,
+22,199,30,55,31,200,179,103,15,253,116,127,177,191,249,193,255,225,97,246,92,254,40,44,87,20,205,11,152,235,219,207,0,47,117,111,58,122,234,253,
+15,34,71,208,247,149,52,233,55,165,114,236,64,165,170,110,243,226,14,180,135,68,226,72,16,48,20,4,97,238,5,67,59,28,66,244,77,81,77,82,
+163,101,83,116,242,3,7,189,34,67,224,118,50,31,94,164,107,95,53,82,1,215,205,39,163,190,110,17,97,93,67,197,74,21,124,4,102,17,49,227,
+202,83,144,31,90,130,155,46,181,102,10,228,75,53,195,128,62,80,134,78,130,17,32,116,136,5,99,127,42,162,110,57,48,42,54,98,103,33,242,246,
+10,19,137,22,160,248,60,16,149,28,130,217,38,113,160,21,243,115,10,0,28,55,144,181,16,194,125,30,49,102,17,115,49,73,74,225,125,64,61,174,
+62,230,223,252,69,255,231,175,236,27,220,243,255,33,79,220,135,200,63,219,105,150,142,102,152,101,227,222,114,48,189,50,251,209,90,179,206,206,98,93,
+106,183,27,135,63,73,233,106,163,139,94,37,14,241,119,244,248,156,4,22,75,54,35,67,170,160,40,84,45,199,134,11,2,180,52,162,50,11,225,42,
+20,163,170,34,160,220,62,100,234,28,129,134,115,32,116,29,135,38,41,100,92,71,165,194,74,192,62,117,34,168,62,70,70,12,38,128,48,227,222,105,
+1,52,86,100,80,79,132,162,12,135,4,33,34,122,105,193,64,69,228,16,66,68,106,8,69,104,44,162,202,73,128,90,78,226,32,28,197,102,16,98,
+192,67,227,230,34,130,42,90,160,100,2,101,210,29,225,24,71,99,214,20,130,62,75,96,164,4,6,222,150,13,209,244,124,248,130,124,52,62,207,255,
+255,110,28,215,70,99,255,11,10,117,255,154,47,163,247,23,76,247,79,236,9,238,24,215,156,63,228,21,207,51,123,25,44,248,237,50,158,249,251,177,
+77,67,129,59,162,103,45,108,181,193,200,144,231,102,199,43,196,96,149,137,105,57,19,62,148,202,235,17,186,73,149,32,46,32,168,18,134,177,69,140,
+136,8,10,88,208,134,184,118,135,88,148,137,168,30,133,152,203,128,168,26,11,248,63,136,176,105,136,136,184,2,80,177,136,240,184,8,248,39,17,112,
+43,132,105,25,5,208,140,139,240,212,8,168,48,16,160,73,133,200,226,1,128,191,134,240,108,13,216,41,136,144,180,139,120,91,6,41,21,128,104,20,
+146,152,126,129,96,244,142,88,16,9,73,24,129,232,45,144,8,86,130,80,255,134,179,222,120,19,126,216,220,167,7,255,255,251,208,250,83,190,7,235,
+245,222,187,254,207,44,237,251,93,109,175,134,189,99,152,153,110,39,14,139,252,112,21,255,106,62,6,149,2,233,19,5,46,59,217,226,195,223,149,178,
+108,228,255,139,180,16,50,201,82,11,65,80,229,70,107,180,122,178,51,131,145,115,73,180,127,152,17,206,204,157,113,140,85,108,205,88,20,23,12,26,
+8,65,6,199,116,145,7,172,185,69,216,4,74,212,23,4,24,109,193,252,89,130,12,53,68,232,30,130,156,52,4,64,10,193,168,79,129,64,12,132,
+64,41,128,136,45,3,0,7,1,80,39,0,72,0,1,16,0,193,44,8,192,180,35,193,252,28,194,252,51,194,236,56,196,28,61,195,252,72,196,92,
+67,68,132,71,68,20,65,68,36,53,67,36,54,65,148,122,231,29,162,247,248,233,107,156,96,31,255,9,191,253,1,126,220,28,211,60,245,63,28,223,
+20,191,245,58,45,255,181,175,15,172,207,176,179,14,21,144,99,67,20,155,43,18,98,49,98,150,217,224,24,127,185,94,229,121,33,173,126,216,43,53,
+171,213,186,126,140,73,79,121,26,227,48,6,31,39,193,66,106,27,171,157,48,146,214,97,112,136,40,138,12,145,243,122,68,12,241,95,168,252,93,205,
+108,4,162,5,35,204,146,76,26,62,171,124,80,168,222,149,2,76,159,164,120,120,7,78,14,41,128,41,100,186,129,194,100,97,36,116,96,4,234,2,
+199,52,33,163,66,93,65,24,80,34,184,55,4,226,13,100,8,51,227,206,45,129,14,87,96,124,11,69,126,33,225,96,65,228,66,15,66,42,83,32,
+78,4,228,190,27,161,8,52,226,102,24,115,180,204,43,248,244,125,112,187,202,255,102,95,255,207,79,240,248,252,214,139,94,247,190,234,63,42,206,234,
+159,197,109,66,190,218,220,14,114,13,231,168,53,84,217,101,133,190,15,32,137,43,23,216,75,41,37,161,229,54,164,78,162,248,51,24,141,84,105,28,
+207,24,15,158,21,79,168,146,194,54,148,71,26,103,200,192,254,45,14,85,81,140,152,42,140,203,97,37,228,106,249,68,121,54,178,94,111,8,80,154,
+188,30,142,93,202,90,152,116,160,46,89,139,108,193,162,242,229,196,150,144,43,240,57,202,254,96,201,152,137,96,214,188,131,110,98,105,180,38,136,126,
+76,70,188,120,97,2,130,68,38,90,230,80,0,200,26,38,67,72,123,162,54,72,133,54,94,163,120,28,103,186,13,65,48,114,162,82,44,196,182,76,
+98,244,22,102,174,52,140,157,209,251,224,9,254,151,223,94,191,234,151,255,209,164,131,191,251,28,106,75,202,237,193,103,53,231,181,224,31,193,47,243,
+136,32,223,140,127,63,237,142,59,62,150,71,4,105,93,190,221,122,133,177,97,206,56,205,2,192,4,68,140,251,137,17,96,72,9,158,23,252,207,225,
+48,78,48,85,106,227,8,147,232,203,59,36,32,82,38,22,7,63,16,150,70,33,233,44,140,51,39,63,201,221,189,145,170,186,218,245,14,180,15,72,
+153,104,24,156,132,92,48,146,84,37,113,135,225,121,75,9,69,17,188,49,88,224,100,77,157,71,6,121,28,202,8,252,142,220,33,210,176,112,203,196,
+233,130,41,7,197,224,144,143,76,67,75,64,154,76,76,132,130,85,3,193,240,58,15,28,85,198,96,159,203,28,88,3,68,211,194,48,48,142,132,122,
+11,131,195,251,216,147,249,115,98,199,255,227,215,250,50,247,103,255,240,184,138,103,248,185,216,203,51,230,204,96,254,1,188,143,181,106,247,79,70,239,
+127,173,221,114,201,243,110,3,190,61,249,23,89,179,55,242,96,194,226,6,43,187,54,96,34,105,20,100,51,99,177,1,130,0,13,80,213,9,80,29,
+5,66,37,23,17,142,27,51,133,23,224,44,76,112,23,34,228,61,40,51,52,34,84,127,41,0,172,81,144,168,47,195,229,27,180,8,23,115,125,54,
+225,82,62,145,156,55,98,209,9,180,80,12,50,75,58,1,128,46,113,222,50,34,75,4,19,164,14,17,243,45,0,198,44,209,38,31,34,155,12,114,
+56,26,18,85,24,0,93,49,240,40,10,2,249,21,48,254,33,50,119,10,224,225,46,144,23,2,226,129,15,16,228,30,177,1,100,14,47,95,161,55,
+148,54,33,31,255,191,111,234,227,25,255,217,123,242,118,255,169,139,254,254,170,19,145,188,201,146,52,213,215,173,163,64,30,235,65,123,213,223,107,12,
+225,186,228,152,215,84,12,35,106,115,198,176,30,243,141,176,36,181,48,195,29,75,44,67,253,158,231,48,42,49,99,91,35,162,129,120,19,39,178,111,
+155,105,220,13,90,70,138,208,44,31,72,85,135,81,55,142,24,78,8,184,235,128,32,33,138,8,43,128,48,62,130,136,12,0,64,6,1,16,32,3,
+240,41,1,224,100,4,224,25,5,240,118,1,176,61,8,96,44,0,208,113,4,16,28,131,144,76,3,72,15,131,176,55,133,120,11,2,216,143,131,88,
+41,138,104,123,131,40,159,139,24,78,136,8,206,134,216,95,140,8,140,132,40,142,137,40,45,130,249,92,197,146,241,95,209,27,179,22,9,223,252,165,
+255,252,144,250,32,113,138,252,226,62,106,191,108,191,238,161,15,79,149,189,118,49,166,97,82,139,54,249,103,69,11,27,243,38,223,90,198,244,143,228,
+164,6,27,62,225,45,101,77,108,200,67,78,234,70,200,103,43,161,25,189,156,157,159,82,211,33,213,56,8,115,180,60,136,8,142,61,106,208,102,145,
+101,0,197,156,97,84,41,84,66,11,96,146,246,21,101,165,2,195,34,57,50,23,53,225,11,49,50,86,18,162,203,13,162,110,24,208,121,43,96,15,
+18,114,24,19,97,37,150,34,131,204,20,224,48,60,64,16,18,226,144,19,1,210,13,129,160,28,224,206,18,129,90,33,160,28,14,162,210,17,224,202,
+46,98,54,15,226,138,46,161,102,32,99,10,28,97,146,41,161,246,15,225,214,27,35,26,224,213,4,252,73,63,71,195,51,250,78,255,255,118,59,44,
+123,135,117,130,87,127,235,31,231,189,243,110,251,198,177,127,156,180,3,103,94,254,201,76,147,74,30,135,184,18,4,54,5,245,176,168,86,101,227,129,
+170,197,1,229,215,164,80,13,227,179,65,73,44,98,42,29,23,48,146,204,29,107,92,54,53,15,121,5,114,163,232,18,67,74,0,107,235,3,98,59,
+135,138,84,21,164,35,64,169,86,150,36,232,214,0,101,86,12,231,135,177,77,67,137,1,12,212,100,209,160,35,203,148,209,7,96,185,69,160,209,135,
+28,28,77,232,11,198,148,162,133,40,128,196,16,135,6,76,34,200,64,46,198,156,77,0,168,140,64,8,41,136,44,75,194,104,93,72,28,5,3,4,
+150,66,124,15,72,76,83,192,16,91,70,196,2,130,68,118,64,92,91,48,168,240,30,255,100,195,241,227,159,255,251,22,250,179,255,163,214,18,77,13,
+248,81,144,223,247,220,231,199,234,243,243,20,132,247,76,249,4,87,161,108,68,204,62,151,225,91,162,186,66,23,112,132,172,43,114,58,12,140,56,103,
+233,56,108,95,66,219,25,73,105,199,207,7,96,227,190,44,89,159,178,234,224,41,69,136,221,192,38,114,4,51,68,54,154,74,105,240,128,116,21,158,
+229,105,224,180,64,48,169,84,67,60,131,24,107,50,226,173,153,219,104,8,234,192,166,177,109,43,248,208,42,145,191,140,42,222,4,105,191,161,113,38,
+31,88,206,32,49,103,136,106,25,7,9,116,150,208,139,28,184,93,18,81,131,139,185,50,13,121,132,139,48,19,157,40,16,135,33,146,141,184,157,15,
+153,99,134,80,65,152,56,3,133,177,83,128,216,38,229,225,200,3,252,237,49,166,252,116,127,239,35,255,157,95,254,119,94,13,219,99,227,223,129,159,
+219,49,131,191,100,190,92,30,168,94,230,42,227,231,77,40,187,207,226,228,151,208,73,50,164,122,26,128,66,42,53,22,80,7,121,15,201,78,49,171,
+42,207,48,0,231,250,239,142,77,76,112,47,156,20,30,95,70,100,66,231,69,22,104,84,170,34,130,252,73,160,34,212,113,26,30,57,12,172,97,248,
+71,100,22,157,201,148,209,237,246,5,37,202,213,88,224,156,60,88,153,217,26,201,229,187,2,117,51,83,224,195,20,68,112,21,16,217,70,13,96,130,
+244,236,79,64,122,145,100,72,14,0,217,198,140,229,134,28,229,201,0,29,145,28,9,135,16,230,199,220,128,136,68,219,68,240,20,207,68,7,67,232,
+194,197,252,107,6,220,160,200,162,189,30,29,95,129,199,229,225,255,33,159,237,143,255,131,223,211,139,254,151,159,91,220,234,88,107,13,172,179,61,7,
+78,255,239,93,159,31,98,127,105,104,19,120,108,219,203,81,172,198,72,199,34,4,113,111,56,92,21,33,203,140,177,20,8,32,0,14,121,60,19,50,
+90,128,34,180,33,234,42,177,16,101,190,249,222,28,20,34,195,77,155,151,245,97,218,32,93,96,214,123,70,61,5,80,97,96,101,115,71,22,92,17,
+214,185,67,3,26,104,16,180,92,36,3,42,182,40,6,116,171,70,67,10,75,113,112,82,98,245,24,181,94,4,243,121,60,2,66,62,241,40,60,98,
+229,23,243,202,16,115,87,37,224,230,63,176,62,32,195,73,31,18,40,29,51,107,19,32,43,61,208,75,15,227,37,29,17,106,27,114,191,18,0,3,
+60,243,70,94,111,88,207,81,207,233,185,248,120,255,234,83,250,212,186,223,255,137,86,140,255,138,94,136,212,130,145,165,102,114,241,242,254,118,143,112,
+220,205,186,219,118,189,77,255,15,41,80,226,159,172,114,154,96,198,246,82,200,134,72,117,193,120,114,75,244,208,3,248,73,64,244,5,195,248,36,74,
+244,78,4,233,23,195,52,207,15,4,244,78,216,74,216,124,136,7,249,153,67,141,15,145,157,1,210,88,65,215,140,186,137,177,107,64,57,45,142,4,
+175,212,104,19,209,124,231,11,49,16,68,41,47,138,20,99,83,224,1,12,188,224,9,208,221,68,128,248,9,108,84,207,112,34,203,244,156,133,32,226,
+65,88,149,11,116,114,73,32,93,205,4,76,128,64,238,65,140,67,140,76,125,197,56,112,75,228,49,129,12,195,192,132,62,139,252,69,15,59,186,23,
+203,83,239,40,34,255,255,116,95,168,95,69,223,252,43,186,65,127,203,54,63,221,229,143,165,55,109,103,116,205,191,186,254,169,95,188,181,146,120,192,
+248,22,65,43,173,77,90,53,20,208,68,202,117,78,107,57,128,214,80,197,37,174,150,141,84,209,226,70,171,196,106,98,164,72,2,36,202,12,224,118,
+33,34,82,49,96,226,14,229,22,33,97,92,75,100,174,40,194,14,108,33,156,25,6,210,15,164,112,70,227,250,86,64,142,91,163,248,55,133,82,16,
+134,52,46,34,10,107,128,160,63,100,236,63,196,18,28,197,240,39,97,110,93,0,12,58,163,180,39,132,114,10,67,176,57,98,118,52,129,202,74,97,
+108,1,133,118,16,225,44,75,35,118,18,194,250,79,224,48,16,165,50,20,96,104,63,34,150,20,2,62,68,238,249,162,215,240,112,236,213,193,75,255,
+240,1,255,100,243,212,246,102,254,106,31,230,187,199,15,250,189,51,111,18,184,150,57,132,60,158,86,149,188,4,154,107,161,237,152,184,73,113,95,78,
+126,223,210,109,204,7,125,69,252,218,30,68,87,236,194,220,185,113,114,111,89,88,209,104,119,168,226,151,205,181,24,241,255,121,4,187,95,181,46,5,
+182,229,26,34,66,87,113,119,46,130,253,52,18,34,10,83,135,12,32,230,42,16,125,24,129,57,18,209,120,1,1,41,15,192,246,10,80,114,22,0,
+4,1,161,86,9,64,4,15,192,236,0,224,146,14,224,40,2,224,172,3,0,31,3,192,32,6,48,49,1,112,151,9,48,107,11,112,231,11,240,211,
+17,209,1,15,17,47,18,81,7,18,17,45,16,49,1,17,16,221,12,48,207,6,242,89,140,149,126,191,153,7,179,1,243,127,194,55,255,243,227,242,
+238,236,217,236,69,202,183,247,173,254,41,156,14,191,77,153,30,117,206,174,27,16,181,178,135,42,116,70,194,39,49,6,229,176,78,145,12,53,174,252,
+161,178,46,203,92,244,246,154,130,205,176,241,212,61,236,171,94,218,139,87,49,50,123,104,59,92,178,102,204,31,213,117,75,38,234,153,185,49,195,233,
+127,221,181,210,0,198,38,230,144,134,15,110,38,44,68,131,41,6,176,192,12,183,166,60,106,73,142,4,9,240,75,36,142,151,65,0,107,102,8,90,
+69,254,23,135,232,50,98,142,116,128,132,78,100,96,56,197,46,9,68,216,58,162,238,66,1,90,82,97,200,12,197,190,18,33,212,74,227,202,24,194,
+190,85,160,56,12,101,110,25,32,160,66,163,14,20,194,18,64,96,26,201,153,141,125,40,191,193,139,142,31,211,159,255,248,240,198,107,253,151,1,10,
+1,191,32,61,96,191,36,79,179,14,100,127,160,196,184,84,245,221,221,42,106,23,35,45,40,4,6,80,26,22,138,126,60,228,17,68,198,201,201,211,
+34,122,243,31,21,221,219,74,129,213,225,52,59,189,55,60,227,233,44,65,23,37,85,232,125,83,244,201,103,104,219,241,169,140,176,62,81,29,15,25,
+18,78,228,31,13,133,149,110,215,202,4,40,112,160,194,128,60,24,67,186,209,234,162,43,110,5,18,248,161,2,42,41,152,66,49,81,86,148,218,222,
+4,34,35,155,225,155,33,120,62,35,193,75,145,250,0,2,233,240,145,32,204,32,232,36,148,129,133,147,249,35,10,137,234,135,224,44,31,184,94,138,
+209,123,146,72,191,11,9,139,135,112,40,27,232,168,16,87,42,111,20,111,247,80,200,199,252,80,255,242,125,248,58,255,250,133,24,7,162,27,94,149,
+55,175,37,146,125,233,254,52,89,187,125,115,104,33,229,81,194,22,65,252,204,140,246,182,115,230,97,6,209,30,100,108,7,160,64,18,18,116,58,100,
+105,13,23,28,50,85,247,113,97,118,139,233,163,50,20,68,202,190,22,10,54,255,46,176,18,146,129,48,197,112,137,185,59,190,50,132,183,59,99,2,
+164,49,205,41,51,29,196,74,220,48,242,83,29,159,130,217,147,206,249,30,21,140,7,153,96,167,203,229,120,131,65,33,206,64,235,16,204,28,20,24,
+150,201,93,31,0,96,251,201,216,140,144,44,10,204,168,180,202,36,174,3,220,252,196,192,46,144,76,50,198,152,193,202,52,103,5,148,223,194,232,14,
+13,100,29,69,144,174,194,36,188,56,105,123,204,126,114,153,103,127,251,13,254,245,63,133,239,253,43,62,223,159,236,42,70,124,102,154,8,12,56,134,
+210,243,196,51,182,77,104,254,100,144,65,237,59,210,194,192,29,50,224,37,179,53,234,88,167,42,162,197,146,44,101,17,113,238,72,73,71,12,212,85,
+73,144,26,196,188,33,65,108,19,6,36,134,68,96,35,79,132,19,133,65,15,199,12,173,11,84,254,74,144,18,212,148,70,136,233,34,197,12,239,137,
+188,212,206,136,24,144,204,134,139,136,222,192,141,17,6,52,132,80,56,56,12,4,162,11,168,170,65,160,248,133,44,97,205,232,31,138,164,125,135,224,
+173,64,52,165,135,92,118,200,112,33,203,236,52,130,128,200,195,60,76,137,180,143,67,248,78,204,36,11,128,68,189,195,116,43,136,84,110,195,240,54,
+76,77,143,46,61,249,201,121,92,123,39,127,247,235,255,198,30,164,189,112,191,229,21,252,52,253,114,255,71,163,144,199,76,66,203,35,47,102,123,214,
+207,143,133,106,60,9,99,33,214,91,107,121,38,246,148,83,157,40,115,130,139,166,124,235,61,121,41,254,166,237,124,12,150,39,175,188,95,16,169,26,
+164,244,86,114,121,62,34,37,62,81,122,2,243,109,8,144,50,34,49,119,4,209,33,20,208,219,12,144,155,14,112,243,0,192,97,18,80,54,7,128,
+247,1,177,64,5,176,145,24,160,144,13,81,56,23,160,171,7,162,2,1,176,79,30,64,170,13,209,50,21,0,253,2,193,136,11,48,209,18,128,41,
+24,176,84,5,65,209,10,176,118,25,17,151,3,33,7,34,144,97,7,114,51,17,16,23,27,241,161,0,32,249,28,208,19,1,50,239,93,200,91,126,
+8,95,56,14,96,159,138,95,255,237,214,80,53,70,255,25,234,68,255,164,175,199,99,184,151,138,184,210,210,65,81,6,250,191,47,45,170,246,76,113,
+25,235,228,153,123,123,236,101,66,206,28,237,97,172,102,4,46,247,167,209,247,218,142,162,76,9,105,19,100,147,148,96,80,254,52,198,134,252,171,12,
+50,143,202,27,199,104,174,165,74,110,196,230,134,35,160,3,167,238,0,98,20,84,34,142,38,66,58,52,97,152,0,194,114,9,129,68,14,224,20,26,
+0,104,4,1,124,19,0,200,20,129,92,20,1,52,18,65,80,20,192,180,15,1,64,6,64,64,13,192,56,8,224,36,1,193,70,12,32,50,25,161,
+186,12,97,158,40,33,118,24,98,226,34,97,114,43,226,182,22,226,50,46,97,130,23,98,114,22,224,202,44,34,217,38,15,27,143,233,29,107,169,11,
+255,255,143,79,119,62,183,223,8,142,3,159,240,187,105,15,234,125,214,247,116,190,109,136,140,209,100,98,24,23,0,51,59,226,229,57,52,237,238,90,
+123,125,236,109,98,187,199,185,2,115,109,197,250,44,218,55,166,6,19,85,183,107,92,24,144,134,160,114,90,68,138,203,147,52,44,163,30,145,176,214,
+60,216,47,172,240,181,67,20,76,145,225,149,203,13,69,138,213,63,78,160,48,20,180,82,12,8,230,68,36,242,4,252,155,76,144,66,10,116,107,138,
+80,112,64,96,199,1,156,66,74,104,60,133,228,90,135,104,81,192,104,128,2,132,63,69,184,6,6,124,27,2,80,110,194,172,38,5,140,100,192,184,
+55,200,60,30,193,180,131,196,164,13,70,140,104,64,244,63,71,12,22,193,60,100,192,124,85,236,217,179,167,250,132,97,173,101,63,255,61,31,252,180,
+255,200,27,140,69,254,61,237,250,42,255,144,129,45,254,141,253,158,184,149,116,61,4,236,61,136,100,150,193,197,16,33,212,248,167,231,136,33,32,217,
+174,215,81,0,201,229,35,177,138,173,219,192,229,240,121,183,145,167,131,68,98,78,102,20,212,163,27,50,214,41,30,232,167,16,227,100,171,73,17,65,
+74,59,105,71,21,227,253,134,171,89,15,228,101,200,121,127,155,252,164,221,16,170,214,117,112,7,73,144,202,89,62,146,60,55,88,72,97,205,77,64,
+6,177,9,74,40,251,141,36,16,210,120,86,73,204,233,131,64,222,198,128,149,140,196,44,203,16,125,202,68,127,129,164,225,65,216,51,141,124,79,197,
+24,149,202,108,61,3,228,202,64,72,14,139,52,59,68,40,118,70,12,7,42,33,181,151,240,172,251,43,125,138,127,171,31,255,206,39,244,96,254,63,
+217,2,218,95,152,143,157,103,76,79,213,212,233,63,12,142,43,250,161,248,132,14,182,97,114,138,138,146,209,130,33,116,28,17,27,39,105,124,67,25,
+173,207,86,140,67,207,45,56,229,46,5,96,202,2,113,82,103,96,26,85,28,92,252,97,76,127,21,89,28,72,121,71,213,85,99,244,124,113,235,111,
+130,128,150,88,228,54,179,246,156,124,6,139,253,193,88,192,138,158,180,154,151,25,97,70,165,192,135,77,27,86,152,134,20,228,174,147,88,250,66,101,
+109,133,132,196,82,32,89,16,92,133,13,88,225,66,204,246,135,116,184,75,88,7,143,196,56,134,80,235,69,44,131,137,180,191,69,208,50,78,252,11,
+130,48,214,197,28,80,8,148,149,69,24,35,76,188,110,23,3,164,39,179,247,250,20,124,104,255,157,63,255,42,52,5,255,231,93,129,239,17,152,157,
+199,147,211,235,170,255,27,127,194,216,47,189,232,120,45,108,25,203,12,73,181,166,126,118,225,150,17,12,24,248,206,15,129,125,2,57,158,168,97,172,
+58,72,228,63,195,105,162,220,108,137,14,51,237,244,122,19,99,18,200,33,67,13,84,226,108,105,177,201,101,2,182,149,248,151,54,211,245,161,219,255,
+23,171,223,175,33,43,65,108,121,152,33,125,201,133,207,37,143,74,159,173,225,47,47,57,71,42,242,32,136,11,42,10,73,200,168,48,244,35,249,40,
+33,1,208,133,250,89,12,201,143,156,48,91,33,152,159,18,241,230,138,73,104,18,137,161,143,192,60,161,40,41,7,225,225,140,24,208,19,89,113,138,
+160,87,154,232,60,6,241,173,136,208,213,115,136,242,16,255,0,164,99,255,195,55,252,131,127,38,159,255,0,12,162,63,54,80,84,118,206,22,7,71,
+235,123,214,147,163,103,201,148,79,190,22,25,236,229,159,216,0,133,180,83,162,164,219,38,230,23,145,92,37,18,47,51,225,60,6,128,249,6,211,96,
+14,52,61,56,226,42,107,176,136,86,165,247,65,86,134,38,23,221,73,2,58,135,216,53,45,131,107,161,251,86,20,203,180,166,81,13,63,168,145,43,
+194,215,150,171,71,14,90,186,168,209,42,47,57,6,42,2,14,138,171,21,8,89,217,167,17,24,35,41,28,35,65,169,134,42,123,9,105,129,157,208,
+153,31,200,179,22,129,185,137,105,148,15,105,147,145,48,12,160,88,45,9,241,211,140,216,219,18,201,135,137,192,89,156,168,14,5,97,129,136,200,193,
+15,232,230,161,38,147,223,59,47,159,55,134,167,255,190,159,244,191,248,236,255,24,207,240,138,255,92,27,43,250,62,19,17,84,224,174,151,30,1,90,
+115,233,255,238,96,63,222,88,251,42,108,109,211,196,61,57,203,84,126,140,122,92,8,229,188,98,201,6,169,73,131,116,43,145,156,243,84,144,17,207,
+220,77,3,120,150,67,180,10,195,188,68,198,156,51,64,132,142,199,44,48,134,28,191,194,240,1,13,220,16,198,64,174,70,236,152,132,36,180,72,40,
+65,11,220,52,138,128,125,66,252,212,129,36,118,75,32,98,136,116,90,11,96,94,64,212,202,128,228,94,201,160,71,8,52,62,135,224,115,194,132,129,
+3,244,122,68,240,0,74,68,0,66,160,156,69,84,49,6,236,148,65,48,50,74,220,30,64,20,151,69,60,26,5,252,114,193,224,18,77,117,193,40,
+61,251,8,121,163,121,39,127,228,195,255,234,46,106,90,60,127,192,211,227,227,251,33,255,20,10,149,119,177,73,136,162,62,96,186,224,183,132,38,34,
+156,139,196,235,185,102,6,56,120,245,138,29,110,41,248,39,96,45,174,232,85,105,253,52,217,70,226,76,4,54,157,132,147,181,82,60,2,99,96,226,
+107,238,246,130,231,1,243,130,38,135,41,10,51,204,70,147,115,50,225,117,70,81,120,11,131,191,4,145,190,34,145,121,28,224,129,28,49,60,12,97,
+79,8,65,116,7,80,7,25,128,90,3,81,74,15,0,25,12,193,48,1,192,88,16,224,76,0,64,162,6,96,65,2,96,70,6,144,83,0,112,133,
+11,112,109,10,16,255,12,208,191,18,177,17,14,145,43,19,209,1,17,145,63,16,80,247,17,80,239,11,80,195,11,81,173,96,41,211,125,241,191,107,
+66,80,248,35,255,255,164,44,33,61,159,60,159,136,239,252,219,252,181,63,5,143,192,230,27,126,148,141,95,64,54,226,76,166,8,89,53,175,197,176,
+92,50,21,174,21,179,180,91,9,77,195,168,39,74,221,92,131,67,56,90,1,78,219,33,112,5,194,2,81,177,203,179,160,143,217,165,235,25,210,173,
+160,199,30,168,40,183,124,68,7,158,64,170,0,113,81,105,0,182,102,94,116,77,102,193,97,102,20,34,42,37,251,14,36,252,57,178,17,85,64,119,
+58,147,214,38,131,165,23,132,26,35,208,221,68,160,59,37,179,10,26,226,197,17,66,190,33,176,233,43,64,225,37,49,164,6,34,229,0,225,42,40,
+177,135,18,129,147,41,240,112,7,146,243,9,208,74,38,209,161,8,193,103,35,48,100,3,114,95,5,160,186,203,91,171,119,252,44,140,71,198,63,255,
+225,59,251,92,255,230,169,109,100,67,241,141,154,175,244,146,179,127,224,79,240,102,212,235,214,133,157,184,82,77,69,123,100,60,78,64,48,52,225,57,
+17,194,15,125,249,117,44,21,94,82,34,172,83,137,88,251,253,29,205,92,231,16,181,215,181,44,105,255,78,109,159,105,228,124,180,117,132,18,6,85,
+196,87,34,9,24,21,171,142,49,140,199,109,158,141,26,68,162,96,232,205,134,126,240,8,26,118,241,89,227,82,111,209,154,102,100,93,37,182,228,8,
+52,179,77,131,42,78,177,144,84,195,33,27,85,92,6,83,201,55,194,50,67,112,172,57,163,11,32,211,104,16,243,207,29,32,222,66,240,105,31,35,
+53,39,145,222,24,115,175,12,192,46,59,176,177,20,2,161,32,145,158,16,51,19,28,8,16,117,22,249,37,127,140,23,232,31,253,79,255,249,157,204,
+35,255,157,215,21,94,63,106,11,75,239,28,15,8,29,146,255,52,66,255,248,143,244,88,217,35,182,185,71,112,242,150,156,40,236,228,55,12,194,120,
+71,52,1,32,6,24,102,100,72,137,242,37,12,144,165,167,254,251,130,155,11,21,96,64,201,0,128,219,235,57,107,4,192,112,113,99,150,152,199,137,
+29,144,131,114,198,99,88,119,82,18,216,28,163,81,228,62,24,9,53,114,65,159,107,102,0,170,251,162,193,250,44,8,93,49,65,118,148,170,253,4,
+2,48,157,241,190,33,184,74,39,129,53,146,58,56,0,161,247,146,241,28,32,24,39,153,33,90,149,121,77,6,58,2,135,160,115,31,248,138,141,209,
+102,150,88,190,8,137,202,131,128,65,25,168,106,140,65,33,139,169,138,104,189,237,125,248,36,120,232,127,246,147,254,121,191,196,23,250,46,127,130,215,
+246,89,175,14,243,81,100,86,14,64,38,137,237,173,177,223,4,255,126,36,22,242,101,205,83,99,46,25,98,67,190,212,43,229,163,113,130,188,145,122,
+140,49,162,131,132,41,249,6,8,165,130,48,18,3,160,203,141,88,229,6,58,12,137,80,190,40,72,167,155,81,219,162,25,198,5,187,16,141,177,54,
+46,56,167,163,1,174,160,186,38,0,146,175,146,241,152,36,152,59,167,81,17,151,26,84,7,177,250,150,1,197,26,72,16,37,240,171,144,218,21,8,
+129,156,146,1,119,23,72,25,156,192,194,146,25,102,2,33,174,136,48,207,25,184,137,144,81,13,150,24,177,4,233,198,128,48,77,25,232,190,137,17,
+10,148,216,113,4,201,115,129,80,95,25,41,17,32,71,145,151,200,179,238,9,38,159,255,173,143,196,23,123,159,252,75,181,114,255,129,221,63,187,15,
+38,234,113,212,214,230,26,160,116,161,69,191,91,106,197,240,93,237,9,8,142,138,52,8,210,243,40,212,11,209,121,87,230,67,68,35,218,146,121,198,
+53,114,218,142,42,106,12,137,138,139,144,14,16,72,100,132,56,88,136,137,1,131,136,3,150,24,189,137,17,14,151,168,173,2,201,235,131,48,201,26,
+184,169,150,112,207,150,169,86,5,209,173,138,225,94,20,8,63,157,208,90,143,217,163,11,145,69,142,17,134,15,40,24,156,176,61,141,249,102,9,65,
+58,137,17,36,17,40,97,147,96,138,146,24,196,1,113,124,128,96,130,21,104,199,137,64,219,149,168,66,4,25,138,132,24,48,20,104,202,134,16,181,
+145,168,83,0,25,201,172,20,28,190,234,94,211,159,36,201,95,255,183,127,255,255,253,89,246,135,90,95,255,254,147,190,150,127,255,198,255,254,135,62,
+191,62,109,88,169,40,236,234,87,63,32,251,176,253,186,126,69,115,75,254,189,173,47,241,103,248,142,221,151,230,222,212,190,62,187,211,175,63,113,78,
+23,147,61,167,75,151,10,41,115,18,150,166,246,236,57,19,208,251,56,36,210,230,17,79,211,93,73,36,208,188,170,80,18,30,207,168,209,10,164,20,
+111,135,240,222,23,196,8,81,9,64,172,52,138,128,232,24,68,161,30,3,32,232,188,6,224,66,85,136,32,75,25,197,152,22,129,130,184,8,132,24,
+214,15,131,156,10,9,129,230,46,194,208,189,43,224,188,59,155,17,170,20,204,249,103,12,229,4,223,138,17,154,109,71,56,107,40,100,44,17,137,180,
+19,154,79,117,31,255,206,215,228,227,178,47,255,255,252,254,255,255,249,137,254,54,191,144,239,255,68,223,255,89,255,240,79,255,254,209,5,79,253,207,
+249,94,235,50,95,212,27,243,226,219,1,94,212,231,83,238,99,198,78,186,255,116,136,207,233,183,210,183,36,223,89,109,3,227,187,156,92,243,251,76,
+56,190,14,245,177,124,93,166,140,45,248,100,230,202,116,248,121,117,103,44,15,83,60,33,206,148,168,46,59,102,200,188,214,42,242,70,83,254,17,223,
+211,105,88,239,144,52,187,148,212,128,152,184,120,104,133,188,139,179,160,224,112,81,65,238,48,162,241,74,10,176,254,146,2,241,59,41,196,128,174,129,
+98,164,65,71,200,226,15,166,148,7,0,243,178,53,192,49,151,50,96,212,142,159,17,70,41,206,217,15,11,37,148,167,130,113,102,88,196,10,130,235,
+179,253,190,127,255,177,5,151,247,147,255,255,255,252,82,254,191,255,255,89,223,22,218,78,255,251,199,92,159,255,220,151,246,39,254,57,255,241,241,67,
+31,118,248,70,210,145,75,27,172,207,7,215,41,196,105,244,243,221,157,125,18,251,164,38,30,146,119,173,196,39,157,48,207,232,19,64,251,1,238,240,
+51,119,239,122,88,190,233,76,209,240,65,128,60,123,232,144,49,240,3,19,147,5,166,83,119,127,211,99,79,53,188,11,112,114,212,160,122,179,70,205,
+9,53,55,239,46,130,146,67,216,67,180,128,80,37,33,134,157,24,195,145,10,100,170,9,132,42,112,84,238,9,153,183,95,129,241,84,149,35,108,163,
+196,154,0,52,232,76,167,7,149,182,4,131,18,183,40,162,184,246,163,240,184,56,84,152,79,0,8,172,128,137,98,154,89,66,94,98,61,54,127,250,
+2,255,248,122,254,19,255,253,0,255,255,255,251,41,253,224,127,254,42,133,166,86,127,241,167,252,158,127,227,67,255,184,220,132,255,243,245,196,175,212,
+127,202,245,157,107,181,79,72,114,230,18,17,211,66,151,253,155,145,71,212,164,249,231,63,160,198,1,216,205,117,108,123,151,85,239,210,229,76,235,87,
+109,71,179,158,216,114,193,214,223,219,78,149,166,95,32,183,224,69,53,154,183,39,139,16,234,182,230,30,253,59,208,81,54,183,53,1,28,19,38,89,
+104,225,7,192,140,140,26,136,195,78,80,140,221,196,60,142,16,181,75,1,6,25,176,157,70,112,170,68,203,144,34,233,125,65,10,70,62,44,142,2,
+181,38,231,160,200,169,82,52,14,216,168,45,22,10,116,189,143,163,22,147,196,240,81,76,160,68,89,31,80,82,9,250,226,248,180,255,249,168,248,194,
+255,193,15,255,241,239,255,255,186,127,255,230,27,252,175,120,147,231,47,201,207,251,178,226,91,255,137,126,141,63,212,215,235,15,76,63,189,70,239,206,
+238,181,39,66,79,71,98,164,78,195,233,207,176,233,230,157,20,7,149,132,255,123,247,156,233,52,230,139,177,1,129,248,161,203,242,145,202,77,21,55,
+45,6,136,203,38,174,24,237,181,163,119,128,88,96,100,23,158,2,231,146,47,95,252,238,8,25,235,110,204,218,82,192,180,149,43,213,131,28,66,2,
+1,214,179,40,110,160,170,21,12,58,11,120,67,25,131,158,229,12,168,66,43,22,40,103,253,46,5,197,138,51,140,50,109,29,39,56,173,162,82,88,
+5,84,168,10,26,8,116,145,145,130,54,119,197,224,0,61,160,64,109,24,176,42,53,184,94,243,181,254,59,57,26,255,226,175,253,96,255,225,143,255,
+72,223,191,143,224,94,63,83,247,5,20,185,243,167,38,95,108,29,238,236,15,232,32,60,247,111,165,140,69,105,236,77,98,97,149,175,24,104,25,71,
+108,97,14,32,136,11,199,72,250,28,8,236,21,163,227,218,135,211,176,63,113,228,240,211,56,113,170,174,144,186,179,77,64,1,195,143,227,140,188,70,
+170,144,43,232,205,19,7,101,46,59,14,177,233,16,41,72,75,151,211,184,49,13,136,206,53,196,148,41,157,224,106,67,202,176,180,39,97,216,157,13,
+208,210,77,1,184,247,23,65,120,135,128,161,96,49,196,88,158,9,99,132,37,2,65,190,7,194,240,143,15,33,128,20,137,112,104,12,3,216,0,12,
+193,20,7,141,135,193,97,21,68,247,188,107,227,102,94,241,61,143,236,184,157,185,4,12,1,68,209,134,231,20,115,82,171,160,21,140,212,195,34,4,
+54,22,207,192,165,34,36,24,25,14,80,100,22,131,200,47,5,64,204,28,128,144,54,9,192,
+        };
+
+        const uint8_t tableHyperFamilyCHRDAlvaJay[] = {
+0,1,119,0,54,81,234,100,206,0,0,0,0,4,0,24,56,132,128,96,144,2,24,104,206,54,10,98,78,57,9,105,159,252,159,179,244,249,140,31,
+41,220,63,255,153,127,254,233,239,44,91,7,199,124,203,218,199,197,183,58,183,49,72,147,146,153,101,241,33,195,16,96,242,113,91,246,63,54,51,24,
+27,112,73,35,13,168,99,120,180,6,175,202,168,246,94,17,109,162,74,64,44,139,179,121,2,100,117,4,234,225,140,184,40,190,227,11,96,147,188,178,
+114,159,60,34,95,109,160,82,104,16,208,193,4,36,182,0,169,13,107,15,177,6,75,208,35,150,116,224,201,93,121,54,67,74,109,74,35,158,194,164,
+75,41,114,171,8,97,128,105,1,200,109,26,74,44,91,28,89,152,240,8,105,138,100,215,24,183,198,161,220,175,72,35,140,203,137,212,255,29,207,123,
+109,47,159,6,254,161,118,238,223,225,5,13,117,40,249,77,148,147,141,184,59,169,225,174,181,137,156,132,122,233,226,61,48,223,5,185,68,101,16,154,
+101,84,202,80,119,19,143,40,171,22,177,204,7,112,189,232,43,181,249,86,11,141,114,28,10,25,192,110,128,166,151,152,97,18,90,36,247,16,93,49,
+108,226,189,242,122,78,248,234,157,53,161,24,155,128,16,41,100,124,202,178,82,241,23,70,14,102,150,211,178,184,228,118,220,139,87,104,28,175,106,175,
+252,106,2,158,40,27,0,152,148,239,156,238,41,43,228,155,202,182,133,189,133,43,83,42,112,3,209,98,52,90,19,93,3,61,224,93,71,94,125,69,
+134,124,63,216,122,250,169,119,120,205,191,24,205,60,163,225,209,83,176,73,43,230,39,196,250,199,207,107,147,186,174,17,228,126,133,197,101,252,51,83,
+183,12,199,216,9,133,26,232,213,221,203,134,202,166,30,3,243,79,5,133,69,43,47,129,104,18,219,178,250,74,96,53,67,139,188,69,156,72,145,39,
+171,189,99,155,225,90,174,208,238,170,64,132,40,155,48,219,78,188,75,199,109,212,181,200,98,156,228,155,147,108,234,65,14,56,53,125,41,132,65,240,
+238,82,143,145,37,170,134,63,93,111,91,190,197,58,248,79,202,187,140,81,45,168,130,163,193,183,217,130,156,8,132,226,70,65,132,105,121,100,149,114,
+79,10,23,1,162,102,164,19,35,31,69,246,59,191,148,232,90,22,169,241,172,59,250,22,69,81,205,0,105,55,58,38,251,119,198,59,140,121,143,81,
+208,168,115,23,5,151,130,44,31,78,153,199,248,246,151,135,72,64,35,150,124,42,147,82,197,224,0,16,201,251,144,220,87,52,69,134,140,40,58,59,
+209,121,55,35,114,212,187,72,31,4,187,128,162,64,185,207,131,101,235,76,89,206,40,45,105,146,33,197,169,238,74,235,194,99,225,47,9,240,29,219,
+200,253,83,75,134,223,172,120,116,190,27,88,132,160,219,35,165,243,169,10,223,26,237,186,148,124,162,179,158,18,230,252,17,214,179,92,92,167,148,79,
+162,105,123,6,82,191,135,25,177,182,0,30,152,189,40,110,103,253,175,249,72,173,152,19,168,123,166,213,247,206,105,24,138,174,30,122,111,56,224,184,
+157,211,165,141,32,99,228,110,209,19,16,0,16,133,5,176,40,100,45,175,161,87,237,56,117,7,124,202,214,107,12,40,9,80,27,207,162,92,116,190,
+92,14,119,151,242,231,23,211,227,7,149,229,151,72,252,210,14,10,175,150,76,192,68,42,190,121,224,238,208,237,127,185,103,50,31,10,226,99,248,231,
+25,241,142,83,90,23,43,45,2,198,56,253,17,125,32,99,105,248,231,134,179,245,206,127,192,181,57,209,72,83,229,205,194,151,208,49,219,143,6,128,
+207,121,85,237,134,128,21,23,132,16,44,128,16,49,90,122,231,183,238,141,90,30,137,145,196,180,222,151,222,251,234,191,60,212,60,91,149,120,247,239,
+211,20,128,38,112,35,175,133,200,140,220,96,250,125,97,204,78,174,117,14,152,133,68,28,203,144,75,27,40,182,162,20,16,2,104,26,229,227,147,226,
+141,30,43,218,139,69,222,214,32,18,114,225,65,97,144,197,83,103,201,168,80,9,128,8,234,132,60,240,105,15,10,190,210,123,37,174,31,130,71,77,
+8,210,104,149,23,228,107,158,52,142,50,178,63,48,110,223,224,200,208,248,81,218,216,174,37,121,13,80,131,80,202,105,19,185,84,29,158,120,1,139,
+241,44,69,114,81,203,253,27,193,112,35,9,61,8,94,26,69,165,118,247,78,133,222,112,64,218,12,9,207,194,255,71,45,221,118,78,145,139,123,215,
+174,122,180,72,68,144,180,75,97,102,193,79,208,114,208,148,140,220,98,189,179,207,32,232,6,112,141,15,157,62,198,230,3,146,20,64,65,67,192,17,
+109,151,202,54,23,226,176,232,54,151,64,198,53,120,193,72,2,32,174,55,184,50,163,139,134,59,63,142,203,40,169,129,40,135,210,53,25,98,164,238,
+37,113,194,167,32,21,140,95,131,120,222,240,165,198,123,166,234,17,138,10,232,45,138,82,60,11,105,215,176,56,98,12,239,164,106,40,8,234,132,2,
+108,26,238,44,125,159,224,65,44,239,22,220,130,14,76,137,158,35,132,89,227,81,119,4,24,195,248,60,41,213,230,245,93,226,190,83,243,117,229,76,
+83,177,103,31,189,113,107,199,122,240,185,113,189,189,99,39,137,158,171,128,97,165,169,88,43,211,36,46,7,138,42,225,253,75,127,158,37,76,200,43,
+199,244,61,179,197,245,9,166,78,10,185,66,227,123,52,6,27,212,58,125,41,22,72,122,250,209,27,201,45,225,97,106,201,152,30,53,117,183,98,51,
+131,100,179,8,234,129,226,85,190,93,25,74,78,90,226,122,80,33,105,122,128,172,245,107,94,198,235,251,246,142,48,125,66,148,210,232,208,173,22,228,
+91,63,218,31,238,108,20,105,153,140,72,125,124,58,105,85,74,150,105,60,2,194,3,40,146,192,32,180,136,74,10,196,146,106,8,93,43,51,251,143,
+215,195,13,38,221,43,218,54,79,62,247,99,160,104,40,99,185,190,126,113,115,137,148,2,98,44,111,78,99,9,115,42,200,190,5,3,45,53,148,15,
+68,233,146,149,96,116,84,197,90,181,36,4,114,205,147,158,70,37,180,232,91,83,137,192,161,244,189,15,94,208,94,0,33,241,72,222,177,89,77,1,
+157,60,130,149,198,170,114,160,9,94,5,129,129,101,20,86,147,173,83,194,249,212,214,83,183,96,169,120,4,133,244,192,106,253,188,154,110,158,59,62,
+171,64,108,250,17,45,37,10,40,243,45,220,177,148,33,144,136,48,204,142,120,154,96,219,34,70,225,124,96,102,134,81,66,170,181,16,45,155,90,125,
+239,196,115,85,126,93,149,97,94,25,247,111,218,56,142,24,42,235,23,140,113,118,18,204,197,211,23,30,164,153,19,64,82,89,40,92,54,192,233,111,
+126,7,61,138,19,133,153,35,131,68,53,61,162,62,24,141,3,167,84,84,141,132,76,10,80,113,13,30,20,182,185,0,200,91,133,203,3,24,90,160,
+241,227,12,38,196,134,6,38,3,6,189,229,90,44,25,50,27,26,108,210,97,4,119,172,28,202,12,142,147,167,254,177,247,155,131,22,103,149,106,61,
+75,67,39,135,22,196,36,39,179,204,21,99,4,200,221,245,105,88,156,41,188,158,48,110,66,212,135,21,158,79,57,174,132,133,194,123,118,175,24,21,
+156,228,212,127,160,232,190,190,100,3,218,184,55,108,234,31,120,227,19,211,132,242,185,139,220,20,117,183,39,152,113,251,69,4,248,102,70,104,46,204,
+82,4,64,150,53,26,129,149,45,219,31,220,104,21,124,2,90,248,90,154,177,35,194,167,182,167,87,24,177,21,71,102,91,235,251,131,124,234,58,50,
+67,146,98,39,70,166,197,143,87,219,198,203,94,40,155,168,78,50,242,255,10,229,235,15,203,242,219,241,150,203,177,87,210,33,90,237,241,100,213,31,
+8,61,162,193,23,36,104,169,211,29,163,105,149,2,139,198,50,59,115,115,169,58,8,134,121,164,174,50,100,252,193,156,237,61,82,173,191,213,180,95,
+217,255,188,195,139,252,59,159,124,147,246,79,193,52,13,71,185,110,116,114,56,15,117,191,115,214,153,39,95,26,163,40,146,230,188,98,18,123,156,103,
+238,207,147,86,108,43,198,253,75,149,227,212,80,84,193,216,165,44,184,184,147,25,227,83,113,156,43,210,121,80,19,73,179,237,169,228,85,74,227,169,
+80,230,23,146,199,106,46,165,71,117,129,17,86,237,146,90,63,6,187,208,130,71,203,233,210,114,10,254,121,154,188,75,176,81,169,64,142,51,208,184,
+91,67,244,85,67,3,106,202,184,220,127,224,93,68,190,40,57,76,196,233,12,105,21,205,30,208,22,62,81,16,67,46,150,240,142,142,217,250,47,255,
+152,227,169,152,247,133,127,141,125,203,255,162,67,173,195,220,190,33,215,74,125,87,164,121,143,159,231,21,185,8,226,58,114,166,55,209,28,224,171,16,
+237,59,207,248,176,117,87,20,190,140,66,26,72,222,240,12,85,192,168,2,227,162,2,97,175,198,50,73,158,53,132,149,30,25,28,30,109,248,49,66,
+20,214,37,43,100,14,7,186,240,170,191,5,196,37,148,179,229,209,252,120,254,27,176,107,227,213,236,22,216,7,177,204,51,77,230,169,151,237,195,218,
+173,162,146,139,169,105,104,163,194,3,55,126,73,138,231,81,253,63,232,93,79,206,57,107,87,114,240,125,145,100,86,209,14,157,152,205,56,111,228,63,
+251,239,248,127,15,252,51,104,254,177,255,199,63,176,127,245,109,253,9,21,167,215,231,230,158,155,226,48,45,126,34,85,57,74,103,130,86,126,45,233,
+247,44,192,64,238,201,195,122,114,173,53,50,25,49,86,77,144,178,231,217,44,73,251,109,136,252,194,135,189,242,142,103,158,40,56,214,247,69,247,203,
+218,103,2,247,159,147,113,150,226,225,251,78,185,187,214,43,37,25,15,130,102,168,140,92,47,225,158,195,184,33,66,199,30,51,189,153,251,219,253,89,
+55,177,252,115,49,158,197,163,80,188,167,120,173,136,138,86,200,20,173,104,28,35,208,116,194,235,16,151,128,252,171,101,248,7,107,167,2,119,173,182,
+69,157,203,56,103,128,249,175,255,228,63,55,252,20,31,240,79,249,103,253,147,252,51,255,227,1,161,205,54,115,79,182,233,241,63,59,164,120,72,127,
+142,249,21,127,213,127,239,95,236,58,43,200,104,84,83,124,84,115,197,121,166,111,226,204,110,60,31,98,206,139,143,132,170,149,36,155,132,37,82,192,
+211,10,248,27,108,192,253,21,161,85,210,117,86,174,94,210,1,152,124,233,53,87,227,155,82,119,104,27,180,222,10,147,227,10,12,32,198,28,197,28,
+19,149,132,226,5,218,105,252,223,171,118,99,237,99,154,186,151,58,68,110,192,108,107,131,164,149,154,64,234,73,119,59,225,88,88,101,64,211,13,80,
+228,248,217,134,238,164,204,72,59,134,173,26,48,172,79,93,24,176,30,178,203,168,254,203,255,2,230,88,184,153,196,95,128,62,82,244,150,88,18,88,
+93,167,32,66,61,242,86,82,223,170,152,36,138,224,130,96,145,246,96,156,73,179,52,35,164,47,250,242,13,130,142,20,157,104,223,16,134,146,161,36,
+115,36,42,11,47,152,129,143,46,65,237,201,109,143,56,75,160,168,128,126,12,22,142,1,13,173,23,193,7,220,19,109,7,14,236,50,204,28,41,130,
+104,238,83,212,1,217,214,234,139,195,135,137,55,73,80,174,107,63,149,188,135,200,1,189,55,192,82,8,108,14,142,137,97,65,157,27,110,100,252,233,
+136,209,128,182,235,64,230,136,67,134,160,197,122,34,130,196,113,17,161,124,135,40,95,25,14,112,145,227,97,250,135,187,253,23,250,221,95,146,178,119,
+158,60,85,251,67,93,56,28,86,232,251,14,207,98,55,15,53,205,89,204,226,89,152,48,104,159,143,179,40,54,148,120,205,8,54,48,240,29,7,202,
+130,103,253,173,139,71,48,194,228,2,20,38,68,48,207,48,87,168,22,66,204,160,244,102,169,232,137,86,122,173,105,193,245,119,128,163,19,81,169,186,
+142,50,28,203,33,120,207,31,98,119,64,172,78,237,187,153,226,178,169,74,136,177,226,64,4,159,55,65,243,148,146,124,37,133,25,0,121,126,234,226,
+94,104,217,112,19,251,31,191,45,220,109,17,154,13,38,154,121,210,28,179,182,110,120,48,34,69,64,99,145,201,164,119,86,210,21,123,11,23,250,191,
+246,110,111,122,100,206,202,240,39,171,191,19,108,6,108,15,20,193,27,70,75,149,75,248,172,40,201,147,85,192,87,250,128,34,110,130,30,224,109,77,
+137,231,230,155,216,238,126,113,178,130,3,216,44,212,224,153,88,52,34,190,5,223,89,36,94,150,5,204,216,245,92,202,42,96,92,64,20,122,150,239,
+198,14,119,242,70,13,103,221,216,158,56,138,99,139,158,166,64,144,92,52,116,50,145,148,151,52,182,97,183,18,153,183,69,45,220,96,60,121,134,73,
+177,2,21,252,237,165,186,103,84,32,105,28,41,13,176,200,240,5,71,141,46,19,160,158,230,136,70,38,225,37,129,24,191,117,0,18,79,115,32,8,
+136,52,0,110,239,249,159,204,126,197,6,70,95,22,122,11,215,159,78,122,35,49,179,141,125,30,230,198,246,107,189,35,110,195,218,85,76,211,199,152,
+22,66,33,130,36,192,50,42,93,202,213,108,80,100,144,209,197,96,140,75,4,232,134,222,53,210,210,248,109,4,7,43,76,56,218,201,11,98,174,35,
+206,16,172,177,80,202,70,113,185,114,76,211,249,25,122,203,110,34,211,37,26,82,223,84,68,91,191,123,106,123,209,4,245,76,210,192,57,222,200,179,
+241,117,46,31,3,85,85,43,65,154,196,62,152,145,41,182,145,229,46,243,192,88,206,108,3,158,219,58,234,221,93,6,97,98,48,10,65,233,238,79,
+201,1,73,127,10,64,224,23,159,164,253,179,246,153,151,59,117,23,48,125,217,247,87,5,74,22,77,111,165,62,117,13,59,82,188,230,103,196,29,203,
+123,74,107,228,57,65,76,18,68,42,38,155,57,16,149,149,246,196,171,18,224,204,91,117,65,245,173,128,3,192,60,21,189,202,27,203,66,169,115,196,
+86,5,67,197,17,108,225,19,210,215,173,60,31,51,166,120,19,171,225,71,97,238,3,101,35,89,23,45,64,6,205,244,117,5,162,100,172,13,213,185,
+152,214,23,121,78,46,166,28,60,55,189,251,179,180,110,34,60,99,97,29,220,102,113,96,28,42,37,58,185,12,177,60,25,36,77,226,188,92,131,29,
+155,146,147,223,94,106,150,240,217,145,37,144,154,95,71,245,63,238,88,127,1,120,67,150,60,53,253,13,177,177,231,3,223,221,30,87,99,211,248,61,
+33,203,173,1,84,198,125,125,3,135,216,15,126,6,83,242,226,172,35,11,22,224,109,15,119,8,164,21,242,84,98,99,155,165,148,233,98,204,190,211,
+4,193,248,189,100,171,83,26,204,138,85,98,82,51,154,169,252,93,76,158,130,192,227,104,13,151,24,82,49,242,100,190,168,38,176,232,40,157,248,19,
+92,214,24,125,109,29,81,120,115,132,242,194,140,211,76,100,113,166,236,227,83,14,104,160,74,232,137,198,2,60,193,152,118,144,38,66,238,4,78,106,
+187,95,201,154,162,41,111,42,5,149,158,2,38,153,79,188,211,176,127,137,115,94,140,216,30,142,205,159,190,60,168,67,115,97,215,230,49,173,83,48,
+77,222,87,54,195,108,236,175,161,46,51,36,132,51,3,47,28,237,166,112,189,247,20,18,27,237,6,13,51,190,155,120,150,156,104,167,138,38,168,148,
+249,90,86,99,65,16,32,176,33,56,188,23,241,69,70,198,75,0,78,101,246,224,5,10,41,76,200,207,86,202,242,58,170,197,114,36,54,210,45,168,
+36,188,149,37,154,88,76,248,34,41,94,12,226,75,36,143,155,49,137,217,88,141,147,112,85,142,81,147,27,230,196,249,24,226,236,114,73,249,194,181,
+171,143,12,156,184,235,209,89,35,199,27,198,167,26,79,35,255,5,255,245,214,240,175,94,249,199,254,173,253,187,255,10,200,183,59,55,33,121,147,250,
+125,133,23,83,164,182,120,78,56,79,21,192,48,241,79,106,209,103,188,170,159,58,27,171,118,159,183,126,247,219,140,169,115,60,72,207,83,159,97,152,
+42,130,216,191,0,191,194,198,52,174,27,147,70,92,159,54,187,112,156,187,69,69,225,145,146,210,88,206,169,134,240,15,95,204,174,251,20,165,96,163,
+87,148,108,220,166,173,52,205,217,31,108,156,39,199,47,117,219,35,36,174,131,135,75,59,206,37,51,24,82,225,60,209,85,93,65,125,25,58,4,255,
+18,97,141,25,190,1,44,205,145,76,17,218,61,183,25,255,244,255,160,224,154,23,241,15,154,127,222,191,26,239,217,182,11,180,137,108,118,217,30,150,
+21,152,219,216,109,88,233,32,171,36,24,190,143,132,8,167,37,0,141,232,191,129,124,53,98,8,15,43,151,75,227,80,247,1,144,82,208,25,129,38,
+119,18,57,122,36,22,190,230,26,190,173,77,159,97,177,102,129,154,61,193,182,135,190,107,38,209,76,22,16,216,63,41,176,98,59,150,103,132,74,66,
+228,217,93,115,5,214,47,180,172,86,4,252,107,144,239,89,236,40,179,33,197,140,97,225,129,120,166,86,13,193,187,47,54,61,93,42,116,17,34,6,
+33,25,163,93,86,143,253,199,250,239,250,15,50,191,255,159,124,107,202,63,251,102,20,124,128,103,218,229,28,54,226,203,149,129,170,241,120,240,29,255,
+128,112,154,244,83,13,217,56,14,188,45,174,248,196,14,111,61,234,216,138,110,173,194,99,136,135,45,39,135,17,136,172,151,8,31,135,209,148,243,158,
+109,29,142,247,15,55,132,60,12,153,71,243,173,6,97,55,165,53,135,193,55,62,37,101,150,80,214,150,240,72,9,218,66,75,134,19,206,186,172,112,
+143,28,248,31,210,55,241,184,130,107,53,108,241,241,157,84,144,177,91,13,102,203,184,126,20,54,48,126,152,112,12,38,61,127,240,202,45,5,161,57,
+103,180,254,251,231,124,111,40,232,222,149,252,203,240,207,152,55,35,10,223,218,229,185,108,205,62,34,239,49,32,164,177,72,226,10,137,225,80,236,111,
+48,91,74,37,45,134,1,238,60,161,214,11,96,160,178,56,211,171,244,163,240,68,249,160,37,223,2,196,108,139,234,111,68,226,192,208,89,229,174,244,
+206,29,0,209,247,109,135,44,166,149,213,157,220,56,223,172,113,123,210,187,234,64,60,210,226,155,40,155,205,7,176,120,67,3,8,122,148,22,153,174,
+237,85,55,155,19,137,221,26,10,79,100,200,241,41,44,137,84,198,185,75,144,72,233,71,235,179,171,154,238,223,254,143,225,235,125,211,213,62,49,250,
+231,201,190,181,160,155,203,55,19,143,39,90,198,101,33,54,24,252,49,84,238,1,81,0,209,176,185,212,182,164,70,219,0,144,216,34,116,237,38,104,
+66,44,139,135,98,165,179,5,68,148,251,86,10,55,165,115,26,50,2,90,219,228,62,145,81,182,74,202,141,156,109,24,236,176,85,125,56,76,188,192,
+36,184,164,239,20,194,64,216,18,79,150,74,178,93,233,244,100,254,17,59,210,188,167,199,36,241,21,129,182,251,67,27,156,121,92,22,73,91,192,23,
+220,240,40,152,136,189,50,74,144,92,142,234,181,191,254,115,242,123,205,19,196,61,235,244,239,208,188,0,57,33,35,111,77,111,147,234,109,96,120,201,
+84,173,8,53,12,197,232,116,101,154,55,58,132,179,1,130,43,205,161,224,140,1,213,217,145,212,246,196,134,70,220,95,5,196,36,112,154,18,200,249,
+13,99,121,208,34,226,41,3,131,47,25,174,133,31,129,105,57,243,201,48,248,161,54,27,226,29,38,132,201,140,201,164,220,13,119,191,110,230,251,135,
+55,200,37,39,136,80,89,5,159,66,216,103,1,16,214,161,82,130,208,128,96,116,228,185,113,77,238,249,20,226,120,240,77,119,160,107,110,224,30,127,
+253,55,43,31,225,94,249,247,143,140,127,88,20,140,71,198,109,178,112,92,94,163,137,217,53,52,245,164,90,141,112,66,203,194,181,58,146,10,93,186,
+159,18,138,211,158,83,39,49,1,150,200,56,72,190,101,169,190,53,77,106,148,120,212,12,232,176,133,213,120,49,117,152,228,241,172,71,139,120,126,136,
+222,22,32,207,2,16,164,207,9,33,116,204,151,78,168,210,250,197,254,111,104,105,135,230,157,7,187,100,48,203,171,164,50,47,56,236,126,105,137,143,
+39,134,64,132,169,112,160,1,38,199,21,185,1,51,154,1,33,139,51,154,132,76,151,59,254,87,232,179,157,35,215,62,77,240,47,234,154,210,190,129,
+185,195,66,39,189,39,46,241,178,236,13,88,79,27,118,192,181,117,97,228,22,160,164,3,215,122,17,220,187,131,208,172,24,9,112,99,13,202,78,116,
+181,69,147,17,58,193,7,228,241,96,19,115,48,217,37,158,40,42,42,7,48,157,183,223,141,91,205,130,74,163,109,12,74,112,12,222,133,22,198,240,
+75,26,211,155,164,143,92,230,49,99,68,112,130,37,22,140,225,233,33,112,204,151,24,130,147,193,28,107,154,254,177,87,164,68,76,240,73,185,19,4,
+46,105,23,13,158,91,227,28,95,214,127,95,184,190,115,239,144,125,3,224,159,199,136,81,167,50,206,139,36,249,94,85,195,204,101,167,100,84,176,104,
+21,5,208,157,25,166,165,33,48,30,5,46,91,84,49,130,91,232,201,40,139,164,116,169,43,16,113,40,144,205,131,53,70,126,211,252,35,214,248,244,
+20,254,17,53,195,167,177,73,108,226,170,252,78,10,18,96,21,17,162,70,83,161,90,126,24,105,144,218,169,119,77,215,66,186,145,73,170,115,168,154,
+81,24,65,124,146,247,104,69,202,240,227,225,217,11,130,61,154,74,48,168,243,34,142,198,23,207,131,193,70,3,30,90,113,191,243,223,5,132,84,61,
+227,166,127,52,254,4,197,126,101,184,142,62,232,226,122,200,21,100,155,121,202,38,98,144,186,113,11,201,162,164,174,232,78,74,101,103,197,137,196,80,
+208,31,219,135,4,155,202,18,156,39,50,164,209,178,36,144,151,69,81,212,105,140,112,197,106,147,129,84,103,129,211,149,26,225,197,108,74,64,238,160,
+182,14,148,120,226,72,187,26,170,149,233,151,118,220,186,207,84,232,189,98,74,56,130,154,216,153,43,76,31,79,84,129,98,180,100,84,67,215,33,22,
+252,91,73,200,38,234,183,227,16,245,17,119,238,87,248,207,85,242,217,167,226,88,135,235,31,160,124,49,94,201,43,80,226,242,149,209,126,86,161,136,
+131,46,157,92,232,4,231,171,140,37,199,67,168,22,222,237,182,136,212,45,185,68,180,253,72,24,178,10,41,96,142,132,71,161,234,147,59,80,86,207,
+92,8,101,114,117,82,13,92,97,43,149,71,195,18,151,80,142,148,196,170,251,245,93,22,156,15,135,219,158,213,134,162,226,13,205,226,207,120,134,27,
+6,75,70,25,60,155,224,153,29,9,228,52,217,111,64,225,48,74,117,245,26,221,215,252,227,39,23,96,52,159,231,88,123,112,100,69,11,234,191,61,
+236,114,63,50,238,93,131,248,183,241,97,156,176,110,206,11,192,90,185,233,198,19,25,52,140,147,201,114,12,100,193,128,122,34,189,26,151,141,185,49,
+75,198,235,16,242,193,49,248,213,181,42,149,163,228,67,112,220,89,94,99,50,138,155,46,94,91,136,83,128,153,223,5,129,164,40,146,172,182,249,29,
+3,139,70,64,230,214,151,66,152,66,217,202,0,24,220,62,128,134,40,98,158,200,28,246,232,146,76,60,110,195,44,138,170,11,202,118,110,51,139,45,
+174,59,153,80,46,169,18,201,90,61,208,172,236,18,51,124,57,207,249,111,237,127,49,200,185,151,48,251,135,228,31,180,70,138,80,34,112,151,93,93,
+47,47,48,188,173,160,65,64,141,192,94,171,116,196,85,167,211,59,128,218,27,164,204,200,64,169,20,57,241,204,85,176,114,155,183,71,73,38,180,72,
+218,224,109,94,237,87,141,25,21,202,243,107,141,147,13,186,82,75,151,161,170,5,137,101,140,227,209,129,90,122,5,114,238,19,122,229,59,212,101,44,
+152,48,24,81,245,233,26,98,132,14,44,174,31,68,226,252,121,118,239,137,25,77,65,49,109,158,216,116,250,115,74,125,14,5,138,80,87,190,239,196,
+255,132,131,215,61,227,159,127,54,253,123,92,52,124,223,105,154,173,46,119,115,47,95,128,156,182,156,176,25,91,213,39,67,58,206,232,17,11,28,106,
+53,115,211,177,148,24,224,149,111,147,105,38,118,225,130,178,2,115,80,212,67,73,60,50,166,240,78,248,19,19,138,55,134,11,59,8,113,158,76,254,
+142,79,80,49,203,122,118,203,92,190,236,92,79,158,98,105,109,193,106,150,117,130,135,152,5,47,60,205,100,10,238,128,21,188,163,7,106,56,135,195,
+128,32,170,145,167,57,174,44,142,52,105,134,235,76,37,105,48,165,124,223,224,63,111,226,185,19,23,249,55,174,126,105,234,198,216,22,19,159,226,155,
+253,174,55,27,77,134,195,64,204,142,109,242,6,165,48,246,197,18,209,190,161,235,253,155,19,10,26,137,95,115,11,105,65,82,48,242,248,52,194,14,
+192,182,82,82,128,56,59,53,162,42,85,85,18,157,225,12,241,9,43,52,124,234,28,166,203,76,198,235,142,41,73,151,220,194,90,66,22,208,126,135,
+10,204,241,233,43,1,184,88,241,161,104,242,200,26,49,72,146,168,148,90,54,52,92,128,158,60,36,195,141,87,222,244,40,232,123,227,201,33,31,196,
+253,151,241,216,213,43,219,61,19,248,7,228,152,194,1,134,22,57,97,197,87,116,49,232,124,172,37,44,100,141,178,154,141,46,73,155,221,134,67,76,
+225,202,233,56,20,205,238,184,186,215,163,97,102,119,34,242,33,19,49,48,210,226,200,155,164,198,0,159,34,41,129,203,161,100,65,80,1,221,7,94,
+105,69,37,163,31,225,60,123,75,174,98,123,183,31,232,153,216,57,208,98,101,125,80,218,7,10,162,230,217,156,218,3,40,33,168,231,201,176,150,195,
+104,220,96,53,253,50,73,21,137,224,72,35,6,24,126,245,11,7,93,149,62,227,127,37,250,79,21,206,151,191,212,188,195,244,207,54,70,177,97,121,
+190,29,194,236,242,184,106,156,149,156,181,89,110,183,24,130,63,147,32,20,169,143,114,47,57,232,215,208,161,200,101,175,22,171,137,26,41,7,56,153,
+63,61,186,58,147,145,153,25,8,222,114,129,138,203,98,212,230,205,67,181,93,102,87,87,40,98,124,103,20,223,117,10,91,161,37,55,72,197,75,132,
+207,10,39,117,205,247,118,178,194,25,78,134,75,6,0,222,66,98,9,228,36,145,156,65,237,173,18,100,230,227,118,208,250,230,178,251,192,37,163,53,
+173,159,4,152,249,127,232,255,23,201,165,31,8,249,215,235,95,96,171,32,7,200,228,170,252,20,251,159,192,39,55,245,0,209,108,46,189,23,54,131,
+80,110,145,112,218,181,14,48,130,235,62,3,158,228,90,60,97,234,62,133,24,176,229,16,155,14,64,238,86,108,110,191,28,3,150,226,87,244,12,3,
+55,134,11,29,152,191,74,104,212,212,73,183,19,230,154,141,40,117,238,96,70,214,84,82,172,158,66,201,79,84,195,58,93,121,79,42,201,68,149,136,
+219,168,110,61,59,187,202,42,209,154,62,177,19,6,34,5,9,42,17,42,6,73,61,190,69,199,252,191,111,254,123,128,241,238,69,252,42,189,255,219,
+151,2,152,23,216,242,145,61,126,74,31,43,156,138,41,137,181,226,29,247,173,98,182,41,59,81,29,10,154,108,107,163,114,218,81,37,95,82,158,160,
+216,38,113,64,34,51,120,37,7,52,227,177,39,169,42,34,107,19,30,1,149,164,36,36,41,157,194,162,229,72,47,17,238,187,135,51,14,224,244,38,
+39,118,218,178,12,22,133,15,11,73,133,81,229,2,205,101,134,102,59,103,45,197,36,49,93,42,22,158,48,221,19,56,40,1,1,53,129,1,53,145,
+21,13,2,7,164,171,50,158,126,211,250,204,54,151,242,78,249,242,47,200,63,28,106,2,70,212,70,171,119,220,172,96,7,131,142,23,166,164,81,78,
+164,210,240,10,212,28,222,28,74,177,61,129,52,99,185,69,46,205,163,235,150,84,6,196,120,132,100,103,24,235,57,144,235,252,163,11,158,32,84,232,
+75,231,52,201,108,89,100,84,140,37,96,68,229,49,46,29,130,198,129,164,58,4,236,8,185,93,90,187,52,118,213,110,140,167,96,236,130,11,22,21,
+71,138,60,9,133,51,35,228,148,80,179,1,119,171,124,26,97,83,58,50,36,129,210,39,164,194,138,210,127,137,252,15,197,210,242,15,152,123,231,207,
+191,201,37,0,115,59,247,179,204,58,170,105,135,21,89,9,85,57,27,14,61,24,87,196,174,170,133,114,224,114,247,253,195,154,227,200,225,144,152,160,
+232,192,224,161,242,24,81,153,176,131,202,224,236,247,16,123,48,127,139,5,32,142,184,23,214,250,183,29,134,23,175,15,198,97,4,66,49,218,53,110,
+85,0,192,100,136,28,71,137,103,114,198,55,92,105,60,252,138,187,220,182,18,249,130,122,236,163,65,233,91,218,210,146,229,21,192,198,101,63,12,70,
+110,153,186,15,141,162,219,166,184,127,238,62,235,39,135,120,7,178,126,73,254,117,8,152,74,176,54,153,126,119,83,180,118,147,51,155,186,20,2,155,
+1,202,171,235,68,11,249,101,252,175,6,121,51,133,44,173,214,39,237,67,165,72,81,58,131,168,176,240,133,21,201,226,110,112,179,78,121,133,216,149,
+78,105,15,241,25,129,3,56,145,64,74,250,100,54,12,245,91,0,116,7,31,134,75,67,100,83,151,216,209,67,106,81,185,113,232,225,34,68,212,34,
+225,141,148,19,0,133,2,141,132,57,27,207,246,73,217,48,120,104,124,240,102,239,20,66,111,158,243,127,239,57,72,127,155,119,143,52,255,142,120,16,
+150,249,186,134,76,243,242,14,146,249,103,167,174,202,162,181,125,243,142,193,169,88,220,66,73,117,131,59,90,107,4,240,212,97,199,74,12,40,92,20,
+78,189,161,207,34,217,220,128,109,13,105,77,17,68,230,65,13,171,51,199,209,49,204,44,53,218,75,54,67,136,210,158,87,150,69,69,103,17,241,220,
+122,146,215,149,110,239,203,104,5,198,231,11,112,73,171,146,164,85,104,204,90,87,76,134,185,68,233,14,227,97,80,64,73,11,64,58,50,200,240,237,
+51,49,155,7,169,240,223,146,254,210,148,225,240,143,88,253,83,251,178,176,244,98,23,117,107,115,229,164,171,29,30,157,186,184,54,207,180,90,162,124,
+202,110,204,114,115,162,93,79,238,20,25,67,57,12,0,252,168,162,175,102,78,193,246,46,7,147,70,66,149,83,163,153,237,56,12,236,44,144,98,14,
+216,241,7,12,24,63,21,26,102,152,196,168,48,129,4,167,176,82,68,97,81,23,113,56,3,10,43,49,229,14,32,182,232,66,104,254,20,122,164,42,
+253,143,205,135,160,51,168,201,145,156,185,12,244,70,225,11,206,234,240,155,42,143,196,56,63,147,253,71,204,239,222,69,186,125,115,254,21,184,90,128,
+165,175,233,222,115,2,220,192,161,118,179,72,234,202,146,69,68,194,121,17,53,98,22,84,133,194,36,183,236,150,116,209,5,2,73,145,49,95,242,238,
+11,168,1,62,194,230,6,216,222,40,47,115,160,23,166,61,165,8,141,17,91,248,6,14,64,209,111,193,162,226,182,206,163,150,45,9,197,69,40,151,
+59,214,26,12,253,113,178,8,98,250,181,78,29,79,150,24,178,76,203,2,0,168,57,245,118,249,170,173,84,37,100,200,246,234,252,128,252,9,184,228,
+45,157,241,94,49,240,31,177,251,250,142,105,240,110,29,254,29,245,173,161,138,94,25,7,196,96,117,87,28,206,21,152,153,167,65,217,246,175,21,227,
+205,165,138,35,215,203,27,31,20,229,181,7,58,146,105,8,48,4,98,54,108,141,37,160,62,163,65,221,23,84,27,51,185,115,101,126,8,42,14,193,
+49,167,90,103,206,97,7,123,167,85,62,177,81,79,129,79,14,39,120,116,124,198,39,164,78,111,60,83,29,161,66,195,19,128,220,221,5,90,221,135,
+223,85,157,171,169,66,64,101,2,12,38,134,4,134,81,242,104,98,56,88,136,96,34,150,239,224,191,141,251,62,177,230,94,41,242,111,213,189,210,156,
+254,41,35,205,195,52,209,58,78,70,161,15,57,87,35,167,95,222,13,192,39,15,163,0,175,84,216,80,192,49,166,147,214,177,250,181,231,30,145,141,
+21,53,169,58,74,65,14,9,199,86,163,241,226,185,14,65,133,229,23,113,103,99,120,141,200,110,251,54,51,19,46,14,49,66,87,141,15,213,236,4,
+173,105,21,122,17,85,254,208,154,104,98,57,39,193,38,45,0,84,49,125,67,9,72,93,36,108,43,133,218,28,224,19,56,177,72,106,163,187,16,185,
+252,146,255,134,255,17,249,232,135,36,236,223,114,241,79,246,36,9,193,252,54,75,25,194,76,185,248,0,190,199,60,141,187,170,14,41,137,195,17,93,
+30,210,136,28,212,167,92,23,68,59,124,193,99,137,243,136,120,120,182,41,176,200,41,247,99,176,138,174,88,151,25,41,185,35,193,100,209,83,97,185,
+196,108,180,120,102,81,109,141,89,119,142,147,220,177,244,156,161,204,164,251,138,244,199,89,237,242,190,18,153,126,220,229,74,167,64,234,245,107,108,139,
+93,231,215,120,190,237,173,231,140,235,103,192,147,43,42,195,68,148,10,145,138,242,45,20,5,111,225,191,191,244,188,235,195,61,11,198,63,219,187,147,
+114,138,197,103,134,183,99,177,89,77,204,227,27,193,56,62,121,81,9,24,14,26,135,85,86,33,213,25,65,168,221,154,194,26,232,58,104,105,53,76,
+90,93,88,7,141,210,40,248,182,90,216,233,77,105,219,157,96,98,53,9,41,37,83,135,209,16,32,167,140,48,163,73,249,158,185,53,41,15,82,68,
+202,242,108,191,44,207,110,10,227,98,6,41,197,206,170,138,163,128,137,26,46,217,67,58,13,132,199,12,14,205,141,217,12,220,114,76,12,122,100,146,
+134,59,34,93,234,127,137,254,231,152,15,126,101,229,223,122,253,178,29,175,98,170,175,53,28,238,97,238,117,75,138,60,118,5,129,213,169,241,72,157,
+209,228,200,124,112,12,48,193,77,192,12,222,169,140,172,2,203,50,157,1,61,212,96,21,185,36,64,178,199,100,125,36,16,78,145,145,41,39,168,50,
+133,233,220,198,176,126,230,156,237,55,72,189,111,185,21,30,4,134,36,44,178,207,32,49,68,7,195,240,101,17,1,5,42,248,46,141,155,162,26,143,
+199,160,36,179,106,222,13,107,198,173,179,70,114,33,98,16,249,196,237,113,133,154,195,245,63,170,246,89,151,197,187,23,215,63,0,252,112,56,92,206,
+214,239,45,150,211,228,110,107,165,86,215,108,86,241,37,128,5,130,70,97,72,6,35,135,116,200,27,16,156,143,48,157,139,27,151,2,198,162,97,70,
+6,230,196,74,163,37,129,225,163,161,3,202,80,177,152,192,139,8,67,52,142,24,158,103,14,85,49,48,48,86,181,195,161,216,220,89,204,208,29,61,
+48,176,253,21,161,10,122,192,81,73,189,66,88,67,105,17,115,22,0,2,51,102,71,177,9,69,181,51,18,230,57,162,216,65,121,128,162,95,63,254,
+151,235,245,163,239,214,58,247,249,55,120,216,36,23,241,247,221,76,221,183,134,174,88,196,37,39,19,250,37,246,221,7,131,54,196,38,52,168,122,128,
+32,32,176,40,99,133,149,96,145,82,175,157,83,80,20,82,137,147,87,8,100,179,166,244,67,55,234,58,97,113,250,67,218,148,163,83,201,46,163,72,
+74,151,189,0,111,3,197,166,176,200,91,193,186,201,156,178,31,58,141,194,233,204,103,128,231,24,93,2,1,143,195,156,201,34,86,87,69,40,28,57,
+215,16,212,242,41,74,209,168,225,12,146,110,209,47,171,116,63,172,253,119,69,207,62,113,205,63,18,252,227,227,210,247,72,221,38,15,19,162,208,115,
+192,98,226,74,50,118,203,157,90,95,112,147,161,72,234,9,171,138,161,146,104,92,122,22,107,136,84,201,21,96,6,49,201,171,33,168,177,48,228,21,
+40,204,168,108,100,149,216,74,46,15,74,115,59,54,54,146,208,168,174,129,71,33,100,67,209,238,75,201,26,97,105,74,169,137,224,166,134,140,39,180,
+67,249,237,81,46,95,170,103,35,5,247,42,74,76,216,242,227,108,74,174,185,82,57,206,180,161,162,230,216,44,209,197,185,172,99,213,127,152,242,242,
+140,43,239,30,69,254,173,162,121,85,4,84,103,21,193,92,186,137,12,252,44,228,174,106,95,48,187,222,10,228,242,97,243,251,38,19,22,62,70,165,
+173,9,78,184,60,138,165,85,17,139,24,143,25,185,88,220,33,10,168,165,48,2,185,141,234,66,88,225,128,211,1,36,243,200,251,209,133,181,193,112,
+26,54,245,11,147,13,131,192,226,207,105,194,213,124,1,44,6,175,66,152,115,92,233,45,197,145,20,210,75,118,220,119,231,153,254,96,210,84,155,10,
+111,50,135,91,96,76,150,186,147,120,178,78,9,237,252,95,252,236,220,251,203,191,42,245,111,194,62,84,38,162,63,31,91,213,226,234,171,180,181,211,
+19,144,178,84,215,0,103,179,227,228,118,193,232,107,83,228,253,160,37,8,86,183,195,52,181,199,41,61,138,119,32,144,177,24,62,151,31,71,84,135,
+205,108,151,211,11,22,159,62,12,68,224,188,178,62,38,40,38,6,106,232,174,228,130,223,40,64,187,142,237,220,126,192,234,208,149,175,222,135,45,121,
+86,10,35,172,119,27,161,130,248,233,96,9,241,172,58,82,188,221,81,129,64,49,23,134,166,176,244,195,39,51,188,159,253,239,200,112,4,175,144,127,
+22,224,31,226,14,17,100,156,36,63,1,55,228,243,237,125,132,18,255,60,49,136,128,21,4,24,22,139,54,67,192,109,77,177,92,40,189,164,160,45,
+6,229,148,214,32,180,108,31,60,180,205,22,85,207,152,159,211,86,129,4,13,225,218,158,184,186,122,152,146,187,140,84,73,82,150,160,176,156,97,13,
+14,125,157,213,133,212,48,116,234,101,157,184,189,20,177,97,230,59,131,8,217,99,134,166,234,201,107,6,104,74,40,78,17,85,129,213,133,145,67,129,
+177,82,85,34,210,33,205,119,193,255,170,225,246,46,97,247,239,2,254,209,234,87,157,91,1,62,235,161,210,60,45,203,165,131,215,186,138,101,3,15,
+144,35,147,167,50,69,200,168,84,54,165,92,170,254,20,68,153,107,205,159,207,70,237,212,152,37,55,126,199,73,225,129,34,112,58,21,174,125,5,60,
+94,150,191,7,170,170,8,148,182,90,109,22,185,48,48,1,56,83,125,233,205,173,208,194,55,54,170,163,242,206,54,148,4,58,180,94,166,115,138,87,
+201,80,9,89,16,192,143,9,14,213,101,129,71,230,108,69,72,35,36,182,139,120,116,105,111,241,191,132,252,38,17,193,190,77,221,63,209,189,224,41,
+160,245,183,39,11,162,185,242,251,5,246,54,148,95,121,201,168,227,242,99,51,104,44,41,110,244,246,219,38,113,138,47,190,208,158,219,141,97,182,225,
+8,59,242,233,162,179,186,156,194,6,56,197,129,208,156,232,79,233,171,197,14,180,108,134,64,28,178,217,39,33,228,156,29,112,69,234,15,94,174,208,
+167,232,122,6,62,91,40,69,177,213,16,32,230,84,156,88,150,134,11,98,169,194,19,98,200,111,243,163,86,204,110,212,157,53,134,93,241,199,121,149,
+36,97,198,191,254,71,211,94,102,95,168,122,231,193,63,211,3,143,26,66,115,243,172,55,25,23,75,195,96,180,42,10,186,212,78,145,147,227,195,163,
+100,2,34,51,6,48,128,226,145,192,180,8,235,224,248,144,42,67,29,243,55,196,172,240,65,240,36,214,92,33,110,75,20,53,1,84,71,116,77,144,
+207,5,39,231,192,106,65,180,25,0,170,144,208,75,170,164,227,140,224,69,37,99,36,138,163,8,39,71,224,168,118,72,154,200,194,176,172,74,130,196,
+90,56,156,46,162,100,184,118,110,237,15,116,68,195,246,172,36,147,29,251,63,239,229,114,207,192,181,239,244,79,60,238,195,161,152,74,118,11,5,174,
+212,203,40,246,152,182,95,114,142,175,216,30,68,198,101,128,245,222,25,173,216,6,161,35,138,202,232,72,37,236,196,38,245,39,24,246,143,208,186,78,
+60,158,94,169,1,36,60,97,16,90,132,192,154,91,142,48,88,16,99,92,163,67,229,23,113,195,38,220,171,135,240,97,105,237,127,168,99,101,244,108,
+110,52,70,134,214,200,168,79,87,164,8,68,232,75,118,189,218,199,58,38,217,247,104,188,18,91,108,161,170,53,213,39,174,7,85,154,225,238,47,247,
+127,192,115,157,179,84,250,71,186,127,46,226,88,118,54,141,9,105,211,221,60,142,13,161,178,97,32,128,38,147,53,192,168,182,227,169,18,77,230,129,
+231,35,67,194,198,33,212,189,154,39,3,80,120,206,46,187,2,46,117,100,163,214,29,73,64,76,131,145,77,0,160,43,197,4,7,102,15,169,77,98,
+17,168,218,80,27,92,225,118,40,246,145,10,214,229,142,89,45,210,211,0,155,203,37,239,139,105,82,125,59,21,92,81,70,46,137,193,129,196,134,22,
+213,24,236,154,47,6,197,83,129,80,4,224,53,162,145,14,226,75,255,73,194,197,185,167,161,126,73,250,151,34,198,16,66,64,120,186,10,222,27,7,
+93,125,117,87,180,116,60,0,29,157,169,50,171,159,92,103,10,170,70,165,48,201,44,58,83,34,99,10,114,173,218,13,151,192,73,227,209,119,107,189,
+232,247,23,219,42,52,75,235,240,97,11,148,68,157,152,108,157,115,75,205,141,37,169,64,179,204,6,225,63,145,23,159,79,195,204,9,203,225,81,249,
+221,232,4,117,110,229,170,228,144,118,25,16,99,154,129,219,243,10,48,67,188,82,59,108,175,203,136,207,216,7,68,204,33,123,159,241,31,63,78,139,
+125,179,194,191,140,125,98,197,25,135,37,215,104,239,55,16,94,91,106,179,194,213,166,39,76,206,35,115,169,236,152,124,10,53,117,151,13,66,65,155,
+139,203,215,148,201,84,22,145,97,15,34,133,166,71,204,102,33,41,5,18,248,176,1,60,71,26,167,195,36,172,193,36,236,114,100,80,128,0,50,131,
+56,49,8,201,33,196,221,32,210,114,95,94,203,103,133,104,232,132,82,188,130,122,82,220,58,199,2,45,87,179,89,82,145,13,100,24,204,153,72,173,
+148,162,28,242,168,99,4,225,244,111,246,127,81,154,191,124,91,240,13,19,252,3,226,92,255,104,111,220,71,181,83,46,58,205,168,191,88,76,89,168,
+108,66,103,4,99,66,235,1,99,180,73,250,238,121,59,155,237,154,109,120,99,1,149,64,144,78,5,89,82,144,162,49,169,58,177,136,83,92,104,24,
+213,53,26,13,132,210,20,209,78,240,109,127,114,183,174,1,40,218,32,166,4,240,232,25,132,229,1,17,5,116,253,129,91,33,208,174,52,36,242,211,
+100,215,130,245,115,229,201,221,33,221,186,251,98,164,114,188,209,116,217,116,161,233,196,110,173,113,5,252,191,235,185,156,31,246,174,249,210,191,212,184,
+241,206,161,202,106,156,13,107,229,184,213,228,199,117,98,124,210,96,210,88,226,68,124,169,152,222,101,23,49,108,54,128,175,18,133,4,16,143,56,200,
+139,132,74,192,9,130,132,18,77,162,179,38,54,152,208,134,35,188,82,198,144,227,195,55,219,161,117,77,32,16,253,248,76,250,19,0,31,120,65,175,
+235,212,55,24,181,189,248,130,51,34,147,139,64,155,77,15,23,196,213,136,205,70,232,22,184,176,233,73,18,34,72,250,65,226,154,194,250,97,123,130,
+139,48,158,162,147,254,55,196,223,116,207,74,248,215,110,254,201,133,97,57,69,54,154,147,134,138,227,34,247,85,43,24,42,20,213,128,37,89,254,40,
+154,156,26,47,40,101,127,155,10,87,232,8,106,182,138,72,172,200,44,52,193,68,85,201,156,9,58,30,188,134,101,25,177,31,136,193,237,68,115,249,
+209,204,68,242,113,163,236,216,124,225,204,18,100,222,52,46,240,222,57,31,40,82,65,77,65,44,151,102,183,72,27,49,101,14,109,9,110,21,33,83,
+162,73,219,12,70,129,102,252,211,73,60,133,68,89,28,97,192,142,235,203,147,57,223,248,238,47,204,231,95,181,112,175,22,255,129,35,38,68,174,234,
+219,187,199,204,116,44,204,139,163,206,147,179,24,4,118,28,197,41,24,133,42,207,31,82,85,25,32,167,0,131,36,197,161,202,42,207,138,231,205,105,
+194,239,211,214,166,179,3,168,25,174,21,123,80,114,141,173,66,241,140,100,14,216,211,49,148,63,174,0,182,33,170,196,136,105,92,37,131,60,223,218,
+23,86,241,76,21,144,14,99,114,75,69,156,65,77,97,9,225,202,109,130,231,238,78,104,128,73,216,13,120,225,108,32,216,76,44,230,152,219,10,208,
+216,124,111,249,220,5,211,177,121,199,206,190,145,246,10,252,73,61,230,39,33,162,173,195,235,161,227,56,125,58,195,46,176,234,83,208,184,225,138,133,
+175,28,77,91,138,69,224,7,240,27,69,62,40,66,34,172,22,56,142,224,98,138,64,117,35,46,144,76,83,164,184,150,71,142,81,216,8,38,115,70,
+178,116,194,18,21,129,135,249,66,171,99,154,145,139,69,4,248,4,212,10,63,102,158,174,18,130,7,157,72,54,27,224,14,135,220,59,31,12,224,123,
+53,196,162,0,118,126,184,29,27,174,36,138,5,60,78,222,135,213,232,92,151,184,248,239,221,117,172,75,240,13,51,250,87,122,122,179,100,108,152,44,
+22,87,39,158,150,103,237,84,24,236,80,216,182,18,228,69,24,195,242,105,154,64,88,224,120,137,146,40,193,50,104,156,233,37,54,145,17,104,147,196,
+6,165,48,65,121,156,176,100,148,193,222,32,78,34,159,76,162,188,103,145,207,145,96,112,64,152,94,145,25,60,150,181,56,30,155,130,167,152,185,16,
+183,134,144,57,61,147,26,40,160,30,132,37,15,144,149,72,101,138,37,139,112,202,110,137,25,115,50,169,22,198,217,17,19,75,24,81,15,34,188,191,
+242,127,15,80,100,252,115,208,182,239,243,198,104,102,63,14,101,186,188,235,233,210,88,250,169,76,165,200,154,82,228,34,156,183,30,69,10,58,136,229,
+28,134,136,240,142,118,90,180,125,53,172,0,89,118,107,10,0,224,250,40,64,211,68,109,61,153,146,34,140,50,20,4,129,49,116,22,103,106,147,196,
+129,0,206,73,179,239,19,206,131,213,226,212,18,36,215,104,12,14,196,151,9,191,78,216,23,211,43,28,54,8,237,47,146,73,213,129,205,20,199,96,
+140,33,176,37,216,145,40,42,25,173,90,106,13,82,133,193,104,255,151,250,11,251,55,196,60,59,226,223,36,244,134,80,225,89,75,234,254,210,169,159,
+162,149,208,211,162,56,6,34,65,120,180,158,69,177,30,53,159,170,34,21,138,194,49,60,106,114,5,34,155,217,34,230,16,72,168,140,194,130,5,94,
+195,227,145,151,101,80,230,170,125,233,228,250,155,146,86,194,212,9,32,105,18,9,25,43,147,5,100,210,61,13,82,103,4,90,203,239,81,87,157,67,
+35,92,161,92,88,7,32,182,169,89,218,16,235,100,189,80,176,82,46,49,76,175,208,141,208,233,83,17,231,41,155,193,91,64,153,221,47,212,127,103,
+214,119,13,43,213,60,171,240,239,142,5,135,2,203,79,103,181,248,138,61,141,179,160,227,143,50,121,225,186,68,183,26,105,105,151,6,201,219,163,209,
+113,168,171,100,50,94,28,253,21,62,167,73,67,134,0,129,15,196,135,136,213,35,170,206,109,4,144,122,2,216,168,146,220,98,122,196,48,64,91,13,
+181,2,45,189,65,193,76,0,5,81,225,210,50,81,133,140,79,84,121,32,142,199,14,206,135,171,246,137,234,98,194,188,86,249,49,133,64,228,144,210,
+73,197,142,64,34,90,48,74,111,92,47,115,36,94,252,103,235,250,237,7,224,28,27,199,63,72,248,53,168,202,62,44,99,189,154,207,85,112,82,241,
+237,71,78,195,68,229,192,18,56,177,5,31,4,27,132,164,22,4,181,177,30,27,170,158,229,86,56,224,232,201,44,41,44,213,97,52,110,109,105,80,
+47,35,118,29,62,97,14,43,142,68,84,83,42,23,116,92,242,78,82,52,213,7,110,106,188,133,70,147,94,241,142,38,169,4,3,47,16,29,49,18,
+80,68,140,195,169,111,74,45,0,146,215,3,17,243,36,167,173,183,16,60,145,147,22,70,184,223,58,183,164,5,34,39,134,55,255,173,238,57,126,109,
+189,113,239,189,124,139,182,37,42,16,226,109,220,252,226,87,143,173,101,239,81,17,145,161,40,26,227,49,173,79,4,43,18,34,170,224,133,230,107,240,
+160,86,147,230,6,89,54,63,42,174,87,204,153,230,68,183,25,67,229,125,153,190,44,74,86,18,132,157,79,47,129,35,68,101,81,56,53,158,152,241,
+136,223,174,108,3,66,134,109,18,240,67,3,120,6,11,10,38,51,38,12,135,175,9,177,0,83,215,42,88,232,125,58,191,16,57,122,95,26,22,136,
+216,133,170,180,163,217,29,242,63,98,165,185,77,183,53,159,171,248,47,127,208,56,198,85,250,151,196,61,128,14,28,222,158,135,73,184,194,69,42,107,
+170,113,153,227,171,234,67,80,76,231,16,196,243,132,124,231,100,35,141,210,37,226,145,105,140,226,175,46,3,85,96,26,4,81,60,17,42,142,200,23,
+208,94,160,54,139,90,224,128,160,245,54,105,55,139,20,69,233,18,19,101,104,252,177,141,174,168,75,41,201,179,210,74,213,236,74,37,71,139,40,112,
+60,224,149,20,232,114,34,228,177,91,100,32,183,234,83,52,250,83,104,186,16,10,206,61,193,115,101,243,56,69,31,28,121,45,149,38,159,208,252,167,
+233,124,28,235,173,100,223,118,254,53,86,207,137,35,217,28,172,46,238,1,129,228,249,214,227,9,203,36,117,186,97,180,141,249,4,176,84,208,164,248,
+229,158,80,100,194,30,39,135,108,184,229,230,124,141,134,240,77,94,185,105,181,64,194,75,13,85,112,233,24,9,97,4,84,250,97,216,249,84,117,81,
+20,152,45,177,156,204,6,241,115,47,196,182,156,216,198,211,90,107,45,92,47,95,94,49,78,11,195,250,70,123,8,55,1,61,129,1,227,53,96,51,
+71,244,3,200,138,177,44,144,31,33,195,1,6,40,50,101,100,182,250,82,30,15,142,254,207,214,202,122,134,209,240,175,186,122,101,248,178,19,122,220,
+97,100,222,43,54,130,208,96,172,209,52,212,65,48,2,112,8,83,57,9,129,160,185,178,72,105,80,180,75,109,195,150,48,122,226,9,50,252,8,180,
+165,170,87,16,51,25,117,138,65,171,103,66,5,236,19,17,41,3,58,93,24,253,223,59,64,8,49,58,126,41,188,231,206,225,128,101,172,87,188,162,
+235,2,12,170,224,202,122,207,154,102,36,197,208,250,1,60,214,104,222,6,172,186,248,234,40,98,36,196,42,70,216,198,245,25,88,56,143,224,140,36,
+232,74,96,190,3,245,28,247,85,224,94,9,196,62,29,248,230,160,212,29,151,204,177,87,58,200,150,182,183,76,206,72,149,78,5,46,53,161,70,49,
+24,0,138,108,33,140,36,217,24,54,163,58,62,43,67,42,46,115,158,43,175,92,114,203,235,81,69,207,82,77,143,181,25,167,59,158,17,140,66,98,
+205,87,183,130,53,225,164,184,223,28,226,116,64,0,216,10,161,66,90,114,90,130,200,18,9,97,129,105,75,229,158,80,112,226,96,174,248,142,28,207,
+18,103,93,200,52,187,212,158,108,90,174,136,200,70,211,6,101,42,144,71,72,165,156,36,151,241,159,159,153,129,122,183,201,52,143,237,17,11,213,59,
+83,69,88,224,231,240,217,169,198,142,128,78,77,29,4,16,106,155,147,34,33,49,167,7,129,41,202,135,74,72,69,30,149,68,192,66,97,200,48,122,
+243,40,177,73,84,206,136,225,119,136,4,207,228,199,209,120,14,89,101,98,21,33,165,76,92,239,74,40,235,3,83,26,34,59,13,34,175,74,160,195,
+22,195,70,3,195,79,204,26,33,164,65,5,201,32,69,4,162,37,0,112,152,48,121,72,137,144,208,200,224,56,108,202,50,91,18,87,66,54,43,49,
+70,43,218,254,59,221,120,61,91,177,113,111,124,250,135,143,66,155,180,248,83,253,254,18,111,111,134,187,83,207,69,138,64,28,217,138,17,199,82,138,
+135,196,137,64,135,7,12,39,44,80,39,51,5,54,164,247,134,154,37,254,96,138,63,6,200,242,65,170,154,96,1,179,234,16,153,120,40,44,178,166,
+168,147,18,21,11,154,237,153,218,243,163,120,168,155,2,219,99,187,114,104,137,201,1,0,115,188,98,86,97,2,130,164,59,181,3,147,162,178,3,97,
+124,155,49,108,23,86,32,134,186,8,37,71,94,146,193,162,5,48,28,3,75,71,248,127,230,174,225,252,139,239,89,183,245,44,90,13,189,104,176,247,
+205,86,6,55,168,202,179,177,176,67,73,40,48,91,115,201,90,99,3,89,49,16,250,108,64,25,20,32,246,100,158,66,16,66,228,133,121,173,10,141,
+140,156,73,211,176,108,28,217,58,219,12,98,115,162,229,211,209,88,164,254,236,71,107,145,46,73,217,10,16,210,231,146,149,96,210,56,85,102,120,210,
+58,28,76,102,235,58,7,125,66,65,116,11,166,211,9,213,214,11,170,165,80,68,17,144,165,99,112,116,133,243,138,84,236,189,176,56,181,64,114,123,
+68,29,193,122,175,158,244,211,93,3,120,242,110,249,242,45,177,248,62,114,152,215,147,146,195,220,74,97,38,105,103,132,244,57,16,148,5,233,196,136,
+154,28,215,3,136,6,9,172,203,162,110,131,161,232,83,153,162,101,60,114,237,119,140,40,143,205,176,26,96,36,68,28,226,9,133,199,6,51,60,224,
+54,199,38,94,161,170,58,81,221,148,166,235,72,176,129,23,182,192,209,241,187,70,210,213,88,206,217,18,158,212,6,72,219,170,237,133,197,174,75,49,
+212,41,228,38,23,44,103,26,134,72,87,131,14,0,199,197,66,22,145,209,109,9,241,91,244,181,118,31,240,95,57,206,96,26,71,32,248,71,22,250,
+246,32,154,161,1,29,197,66,231,230,175,51,119,171,8,249,91,210,251,219,33,10,162,153,145,124,97,148,213,241,44,144,125,209,205,154,50,232,98,33,
+44,159,135,140,74,163,35,202,66,90,207,70,75,193,241,139,122,65,124,186,226,136,28,108,69,73,175,82,93,33,88,235,4,98,155,20,45,63,138,27,
+131,29,63,156,235,219,9,37,99,85,188,66,79,32,166,214,173,190,80,100,94,54,36,52,150,155,20,0,132,166,9,130,14,156,48,47,173,27,137,184,
+27,161,60,146,12,44,29,149,36,156,162,113,255,141,250,40,24,135,112,227,30,177,243,206,133,26,59,19,115,9,164,139,110,96,224,56,139,164,109,28,
+180,112,241,132,92,34,108,234,126,144,107,36,140,193,151,215,239,144,209,23,97,219,46,52,19,51,144,11,172,155,82,177,121,80,90,61,51,23,137,18,
+164,133,184,22,192,204,161,76,45,176,227,151,136,138,147,124,136,166,199,172,43,168,129,159,208,13,177,156,187,51,96,176,96,226,9,55,107,120,37,66,
+54,239,34,5,28,93,30,24,109,138,101,248,64,85,134,180,174,31,52,168,202,32,220,79,0,74,23,79,75,173,69,95,4,225,172,193,248,221,103,244,
+94,139,24,130,122,198,69,243,111,131,114,66,241,80,35,60,212,64,95,89,156,114,241,195,168,200,251,173,66,86,28,209,81,184,31,137,59,190,49,152,
+79,174,237,195,194,163,235,212,55,224,67,252,239,197,167,176,226,241,196,213,128,200,141,90,50,94,184,25,89,200,48,176,202,197,166,109,27,84,147,97,
+160,218,183,19,136,4,143,68,174,178,6,88,193,122,74,144,4,94,80,182,6,170,152,42,139,129,107,42,208,226,216,44,106,3,22,157,135,67,175,244,
+36,49,132,188,186,79,51,193,142,205,77,136,83,9,73,227,208,82,70,154,160,62,147,151,105,62,103,235,188,54,109,164,118,205,211,237,94,113,36,116,
+8,148,163,141,101,109,234,46,43,37,108,237,97,128,65,65,80,82,167,2,48,17,145,32,246,4,114,25,163,108,86,104,0,66,70,54,48,232,206,104,
+205,63,151,17,128,49,70,75,102,144,81,165,211,101,170,155,0,138,140,232,117,132,224,112,102,11,145,98,181,226,188,103,126,157,196,41,180,129,88,156,
+186,98,116,120,1,17,60,1,21,37,106,133,181,17,88,114,203,27,128,252,174,72,70,46,159,108,119,87,122,31,18,18,52,71,58,59,30,98,139,140,
+71,26,197,8,166,50,229,126,75,217,253,238,11,22,228,154,55,194,190,89,196,178,100,26,27,1,103,27,44,182,176,130,189,211,84,143,67,207,214,104,
+148,216,16,34,75,146,216,28,58,34,188,22,134,44,204,158,157,3,78,70,166,221,20,65,68,7,147,108,213,176,202,86,71,14,70,156,141,19,0,197,
+218,143,22,93,23,72,136,148,68,112,141,182,108,64,52,11,53,131,8,37,69,76,135,113,140,253,98,38,196,192,178,234,113,124,211,89,20,106,208,241,
+50,198,210,97,216,65,220,46,45,13,162,53,172,75,99,145,238,95,224,153,120,221,0,204,165,163,25,171,81,56,190,56,191,79,219,122,143,125,203,250,
+213,187,205,60,211,202,190,0,247,30,196,213,140,61,143,22,148,228,242,11,249,186,216,43,133,100,50,12,210,171,84,137,183,45,105,186,68,101,112,204,
+173,73,33,22,31,74,125,118,141,193,17,160,225,85,107,46,21,71,71,165,94,242,44,134,40,42,246,8,76,58,152,113,43,116,72,150,198,138,86,108,
+145,85,244,131,34,118,164,85,51,165,134,181,32,138,13,18,67,18,57,138,222,32,49,81,43,196,21,156,134,120,194,211,159,106,97,211,69,208,241,163,
+122,49,123,41,29,161,37,221,24,246,177,142,226,19,18,40,117,190,104,203,15,231,255,89,211,95,33,222,33,207,188,203,226,156,9,156,118,197,189,138,
+60,228,34,74,48,21,211,244,245,204,85,178,93,133,164,67,141,78,70,77,24,150,82,143,95,116,108,53,185,155,17,194,172,235,78,74,162,43,131,19,
+29,115,41,64,144,78,85,149,218,37,237,137,101,164,128,110,81,249,244,149,16,193,69,201,252,192,192,228,160,242,110,176,59,16,150,146,100,27,204,161,
+20,29,193,92,77,50,10,8,204,246,204,191,4,149,130,186,50,156,5,170,172,56,98,116,66,182,245,100,194,43,222,208,75,129,213,157,77,5,10,215,
+4,209,67,96,207,44,64,153,91,191,147,250,90,12,115,104,195,60,51,241,140,58,104,108,122,0,25,157,151,138,101,106,151,147,3,89,74,179,250,33,
+200,161,76,65,124,117,34,63,104,109,3,78,69,9,122,67,19,29,53,186,92,90,10,152,217,3,80,8,195,195,135,84,134,37,242,11,123,208,28,71,
+2,155,155,48,190,10,17,148,58,197,135,211,98,143,109,56,132,92,60,4,117,8,112,202,38,224,94,38,104,16,94,162,196,134,24,10,66,74,68,180,
+194,182,216,152,254,6,40,112,254,196,45,5,146,14,151,139,8,4,201,50,216,21,123,65,166,33,132,162,27,128,11,24,15,195,100,188,39,231,122,30,
+21,150,85,62,233,196,184,39,8,9,144,92,212,192,139,242,179,182,140,213,68,9,43,135,217,30,53,156,82,18,12,40,32,42,22,244,110,98,124,181,
+89,134,5,130,152,77,239,18,16,232,81,250,107,68,219,109,184,27,130,43,44,151,94,234,16,177,68,160,137,172,104,202,171,170,91,195,24,14,12,211,
+196,132,162,212,245,188,88,190,126,220,80,8,78,2,116,158,203,70,9,51,67,39,132,40,190,181,41,93,108,199,177,89,113,59,43,242,9,173,99,3,
+84,9,98,6,115,132,64,88,9,2,207,193,147,26,94,9,169,114,224,99,112,58,11,167,69,252,222,6,23,18,240,13,163,211,57,199,16,164,108,187,
+20,79,83,150,83,88,226,167,42,240,112,246,172,44,218,109,149,210,141,71,70,74,32,20,154,211,56,57,244,150,220,178,58,150,204,137,55,148,50,194,
+142,201,192,222,1,147,76,147,90,36,177,9,120,162,161,58,41,18,50,122,112,176,101,47,54,115,77,48,2,34,28,147,172,66,50,124,82,118,112,212,
+246,160,38,143,24,45,129,184,17,170,140,12,60,208,145,233,249,17,189,158,168,42,121,130,177,87,48,120,17,186,34,217,113,209,137,192,230,106,208,153,
+165,120,19,157,199,137,162,44,215,61,185,137,130,249,31,255,91,181,211,162,255,228,188,55,144,255,248,207,176,92,21,229,153,157,11,57,31,131,202,110,
+116,162,164,188,90,74,2,85,176,194,0,3,115,218,121,179,89,194,29,15,84,127,115,164,129,57,69,179,204,57,41,93,208,251,173,88,90,108,235,9,
+203,56,114,192,210,1,2,126,153,93,93,101,246,204,110,226,52,251,252,135,141,242,133,123,94,138,206,251,115,176,29,67,174,229,237,168,110,31,242,61,
+102,199,152,233,242,17,181,124,35,182,112,69,116,253,196,140,152,186,160,170,109,247,137,173,240,211,176,249,8,27,44,43,159,41,194,168,97,6,1,64,
+95,177,255,202,254,12,125,191,238,63,125,247,223,230,191,212,108,133,62,183,35,202,197,121,241,125,122,139,24,150,164,94,104,109,46,238,45,111,22,137,
+88,106,239,32,212,238,3,123,156,31,171,214,5,16,67,75,227,52,235,57,207,18,31,200,103,252,31,140,67,145,178,155,30,249,113,157,47,182,212,161,
+194,103,253,103,66,16,109,102,134,41,226,152,119,62,19,159,216,114,250,110,3,227,225,168,145,147,198,236,181,43,40,60,127,154,151,187,180,24,165,13,
+101,108,229,56,138,14,87,116,125,180,28,19,212,122,139,23,178,146,148,242,133,185,253,215,49,243,116,80,25,147,63,241,127,230,255,67,180,251,79,1,
+250,143,244,31,235,190,10,26,46,83,26,127,135,213,139,141,199,214,181,73,46,165,202,190,107,169,9,53,81,94,247,25,55,12,173,212,252,197,103,95,
+195,97,102,7,93,228,18,217,109,105,45,51,165,33,152,240,189,84,142,215,150,135,64,85,123,99,248,194,57,125,36,168,140,86,165,45,34,178,116,91,
+119,87,77,80,194,49,65,16,222,173,100,150,70,57,124,156,227,49,147,156,124,212,178,244,245,152,20,122,172,218,225,48,183,139,183,251,201,148,132,153,
+205,97,120,42,183,186,100,242,242,200,171,192,211,93,255,51,255,19,249,54,217,15,146,253,119,240,223,246,95,117,104,144,58,30,61,122,94,109,15,123,
+5,11,135,12,228,24,163,228,13,167,170,74,37,176,74,251,98,32,199,35,158,171,91,172,194,223,43,193,247,219,124,20,103,79,130,201,120,83,187,140,
+104,131,211,240,66,153,63,139,237,54,109,7,190,132,191,2,31,13,232,124,118,85,244,137,30,107,141,211,113,248,238,67,216,138,197,59,41,82,14,203,
+127,146,131,155,227,49,104,229,6,63,13,41,87,45,10,158,227,83,44,160,162,116,64,107,116,199,225,83,226,134,84,224,139,241,252,103,9,242,179,210,
+154,248,143,236,127,149,253,93,95,239,181,30,251,244,223,218,126,235,124,33,74,203,85,59,124,120,120,123,27,84,225,13,195,161,131,195,33,193,178,178,
+69,183,174,28,214,114,118,146,198,74,211,159,212,86,190,109,165,214,79,231,28,237,125,52,93,236,66,200,61,127,101,67,167,232,36,77,4,145,140,87,
+17,130,218,133,186,157,146,25,151,85,1,27,16,63,31,57,101,14,158,178,132,245,68,60,74,93,70,212,214,19,185,176,2,238,160,46,134,106,122,28,
+92,213,107,222,35,143,156,69,161,101,204,66,242,61,5,204,100,12,240,187,222,251,183,156,204,97,85,195,78,97,220,223,43,249,31,227,127,201,234,125,
+54,51,217,124,87,252,151,245,25,110,171,133,240,28,239,11,29,208,190,226,247,35,115,159,63,174,208,230,254,75,211,248,46,116,146,71,124,135,27,150,
+39,133,97,158,173,71,172,163,30,24,16,199,249,68,245,52,80,194,238,75,100,35,110,108,176,178,74,186,190,41,36,218,33,224,72,225,13,197,212,78,
+158,16,246,171,50,209,148,59,166,51,151,185,231,158,175,226,57,22,210,219,253,215,110,227,45,23,114,98,66,157,240,96,15,136,209,128,202,85,185,68,
+118,48,98,186,221,196,136,234,204,46,59,216,251,226,93,190,176,124,21,141,82,243,194,200,160,147,195,254,183,252,95,102,169,151,208,125,231,243,95,206,
+127,100,121,206,43,98,66,94,119,67,102,34,118,206,142,19,22,103,25,204,194,70,102,225,135,68,87,201,41,71,201,120,30,137,205,47,13,189,192,94,
+195,76,104,248,140,153,12,97,60,11,105,174,223,176,155,206,242,209,41,80,131,154,69,207,240,146,156,255,52,86,76,66,194,102,206,49,62,169,69,254,
+81,138,169,111,107,246,155,219,63,144,249,221,49,173,11,35,183,157,125,148,214,231,49,10,10,104,86,157,134,59,191,226,154,239,253,134,22,111,148,230,
+107,171,59,190,129,53,13,155,142,131,139,101,130,202,182,116,70,12,186,225,201,127,55,253,223,198,230,84,125,215,231,169,63,238,191,238,147,249,41,79,
+194,243,87,248,244,223,23,144,205,208,203,134,232,252,231,175,121,121,240,253,99,177,34,163,106,167,121,74,244,114,10,95,89,242,88,87,112,141,139,220,
+247,90,148,68,136,209,99,67,194,16,143,26,136,76,230,237,47,178,237,76,90,17,26,61,65,2,19,179,92,254,211,65,237,97,140,75,33,102,31,4,
+125,252,38,30,200,230,20,224,113,133,35,204,24,114,142,16,160,99,101,0,192,202,99,222,65,41,107,69,42,199,130,213,231,165,84,211,28,215,152,246,
+159,79,220,19,183,213,109,247,87,166,29,87,158,244,59,31,247,255,219,243,144,159,130,253,55,152,255,125,250,202,40,130,50,164,245,162,181,119,176,30,
+213,81,60,141,151,87,128,149,73,21,245,191,130,149,135,216,105,231,160,101,168,172,98,239,25,157,224,54,99,232,17,51,71,81,99,97,133,53,190,247,
+248,10,107,240,206,132,227,247,145,50,122,135,241,13,81,229,178,41,1,179,166,149,43,89,114,127,144,153,42,6,31,49,34,70,187,199,244,205,62,127,
+170,89,197,248,174,253,38,211,191,236,173,72,177,158,73,139,197,77,225,114,23,28,157,114,245,145,90,188,197,56,202,36,237,171,225,135,20,47,28,115,
+62,54,144,98,184,240,122,255,255,23,139,235,201,254,51,235,191,41,234,191,244,152,12,4,215,47,190,237,115,43,60,204,230,103,129,186,195,208,160,94,
+196,153,65,170,13,137,206,79,171,170,86,208,8,179,240,186,2,98,217,199,65,201,47,216,253,23,14,133,160,246,105,46,179,162,228,158,198,236,171,202,
+107,181,98,184,13,74,50,75,141,99,116,146,226,217,196,67,74,193,20,155,12,8,92,243,22,100,195,60,17,143,130,92,67,2,11,61,131,16,97,220,
+243,49,13,199,85,106,244,154,26,161,113,120,170,218,139,154,128,107,204,54,125,161,97,180,226,94,80,97,204,22,19,119,85,31,254,231,245,126,6,47,
+117,242,31,208,115,223,244,159,208,31,180,53,42,78,231,185,158,219,167,206,220,210,109,98,179,33,166,188,175,128,41,217,252,37,235,249,12,68,223,103,
+230,175,62,111,73,218,125,191,32,19,11,178,219,218,14,220,249,46,4,70,43,54,240,80,113,37,196,128,15,20,246,42,74,190,199,166,7,216,224,41,
+57,220,197,151,157,162,105,49,139,164,79,62,74,16,214,103,172,215,168,97,102,251,51,198,0,161,140,229,250,1,220,222,72,202,11,80,189,39,123,109,
+29,197,227,133,214,213,16,94,49,77,1,21,46,165,222,56,40,38,12,193,254,3,157,11,144,197,168,150,229,216,120,255,248,93,207,91,224,8,127,186,
+247,30,11,254,179,124,162,115,133,19,232,191,196,150,29,204,128,197,201,130,11,135,107,105,50,62,203,103,85,109,204,190,226,38,108,105,36,51,109,173,
+181,251,33,53,57,143,133,233,160,182,124,71,159,193,119,159,31,182,133,127,144,50,79,107,217,102,223,78,57,139,49,120,221,24,56,9,24,133,224,8,
+68,158,164,74,84,133,59,160,168,128,195,206,64,151,198,80,187,41,144,161,216,252,23,6,117,134,15,158,181,159,13,225,54,48,242,7,76,138,156,173,
+214,122,94,178,84,15,49,241,239,53,205,59,126,154,142,55,144,143,102,248,14,102,248,245,106,199,81,112,237,125,239,244,190,190,23,148,248,78,203,242,
+159,195,124,55,146,35,97,91,194,222,92,211,237,204,95,183,173,163,195,108,86,20,230,97,58,206,239,52,117,60,230,23,134,218,242,142,241,122,231,103,
+12,144,66,37,32,85,228,106,164,216,229,168,198,52,155,208,99,104,248,204,76,176,10,221,50,12,11,166,84,46,145,113,123,133,157,95,128,183,20,32,
+8,70,171,34,242,156,93,225,84,199,113,191,41,230,118,20,248,63,97,233,241,69,107,113,11,231,91,70,88,164,96,148,65,217,103,175,107,33,209,18,
+129,80,37,224,156,191,101,74,17,166,119,142,155,70,104,114,114,9,101,168,62,103,158,144,255,30,59,254,175,241,191,156,219,255,69,247,151,159,251,111,
+41,146,48,141,199,2,228,126,78,38,148,236,62,132,209,92,60,65,76,219,205,247,50,131,53,159,223,108,104,38,59,94,232,38,63,28,221,155,136,151,
+150,123,204,120,30,59,220,216,54,132,1,143,132,98,162,83,30,242,34,142,152,217,87,81,45,135,179,96,20,11,21,23,21,176,113,196,37,203,63,45,
+160,219,144,196,63,161,146,180,205,192,68,116,124,5,106,169,215,254,235,238,252,215,7,17,142,227,100,161,118,30,127,158,97,157,197,105,85,54,64,14,
+13,193,116,45,27,3,135,4,41,18,74,23,131,33,84,19,28,238,218,119,181,248,63,234,123,93,71,53,227,62,43,227,191,229,155,126,154,87,46,55,
+52,126,59,201,203,225,231,186,144,49,180,101,67,26,171,152,161,156,25,42,99,136,196,222,243,73,200,15,175,216,15,157,138,173,27,40,81,121,151,80,
+38,138,80,102,210,66,89,225,181,121,226,51,123,8,58,63,17,230,198,243,85,108,36,65,131,210,97,223,234,131,249,30,136,46,151,49,71,57,82,184,
+2,169,236,136,178,212,66,109,222,64,132,10,17,102,62,248,67,146,13,177,243,208,216,253,151,163,244,139,61,76,182,131,103,53,130,244,125,230,247,100,
+118,164,179,74,143,59,228,166,98,113,89,214,154,9,94,55,156,19,189,179,254,191,243,115,182,30,43,205,121,15,218,127,49,194,66,74,59,110,58,159,
+34,223,163,162,161,228,71,36,83,202,227,9,159,134,21,87,56,112,72,148,179,208,154,93,117,24,101,142,67,205,246,94,247,128,65,192,240,217,253,17,
+236,216,28,49,29,78,168,46,151,186,15,175,170,64,133,140,145,188,63,73,159,23,180,209,162,162,194,161,203,93,201,207,64,79,214,252,103,110,139,37,
+205,235,148,200,241,157,251,108,102,238,227,103,117,41,197,202,32,72,237,221,129,201,117,174,32,3,223,158,188,149,0,137,218,9,108,169,204,182,204,127,
+17,127,91,226,40,98,76,80,102,238,42,60,46,106,28,239,133,254,31,249,54,23,156,215,186,216,127,221,124,69,247,84,166,230,154,135,110,124,127,82,
+173,60,232,202,242,98,201,168,171,57,68,132,192,80,6,242,16,103,96,153,139,48,1,218,123,36,240,60,87,161,188,226,62,95,49,37,115,134,227,114,
+82,149,234,116,132,98,217,226,23,102,102,176,232,43,9,72,165,198,94,173,158,73,74,141,242,212,193,33,224,4,8,15,37,123,32,213,46,67,10,182,
+160,220,222,3,14,154,243,90,218,26,70,163,42,30,202,19,11,40,35,6,216,80,114,209,241,14,165,196,15,156,179,55,176,133,54,33,29,3,182,18,
+220,60,148,150,13,114,223,63,255,3,240,120,232,191,205,112,159,73,254,27,53,248,105,138,178,64,230,112,48,180,123,219,44,232,31,51,154,49,75,119,
+196,53,226,254,195,147,44,128,113,192,237,172,79,76,68,193,184,6,88,106,249,98,120,156,84,167,157,202,74,37,31,107,239,59,247,148,135,166,221,227,
+164,75,49,51,192,113,186,238,76,255,158,240,120,5,97,196,177,162,74,53,12,64,185,124,81,44,125,148,120,225,51,211,42,142,206,203,81,244,92,9,
+115,147,16,221,201,237,98,151,97,135,64,65,191,227,172,109,212,32,190,248,63,162,147,222,180,178,57,119,109,91,57,107,52,49,240,85,47,168,195,218,
+105,118,152,127,19,241,63,133,231,233,185,15,57,252,226,31,246,31,203,39,64,58,14,251,209,199,206,119,106,70,240,53,91,213,217,47,201,247,200,98,
+118,217,16,75,28,73,196,11,59,150,243,125,37,44,239,57,131,83,150,187,28,88,116,153,169,108,60,0,59,224,126,15,207,67,164,15,29,221,234,160,
+166,192,193,211,28,175,64,33,99,52,140,122,63,188,99,206,238,57,62,88,250,61,175,53,45,177,146,126,66,73,249,16,227,230,139,209,200,225,34,38,
+75,197,43,95,37,230,127,195,124,152,62,163,199,221,78,228,42,194,210,87,141,100,14,25,184,12,95,65,118,22,202,150,42,159,61,63,130,19,189,134,
+176,23,181,150,97,244,191,63,240,124,94,66,219,204,126,3,29,252,167,245,74,174,105,34,62,126,224,255,151,216,121,119,52,91,89,81,75,97,3,213,
+213,0,208,238,130,199,231,186,30,107,54,248,145,83,216,219,192,113,89,59,11,112,245,199,105,199,62,152,39,107,172,39,159,245,18,62,215,214,1,165,
+19,162,212,177,234,59,189,100,236,222,96,236,154,68,132,150,155,92,166,58,109,33,91,142,175,160,167,161,251,15,220,245,16,103,39,48,43,106,39,66,
+78,45,103,52,134,231,140,173,95,156,197,166,163,246,95,6,219,105,202,163,216,31,183,134,146,193,150,194,96,227,115,134,159,176,108,188,168,106,138,122,
+222,163,51,23,204,84,253,31,155,251,221,187,110,3,230,54,31,196,126,91,29,231,18,111,244,87,123,58,236,254,213,116,62,53,26,52,228,3,73,164,
+125,147,69,213,107,225,97,3,214,45,210,227,2,15,120,11,135,160,245,223,207,218,102,4,112,224,59,43,18,50,194,193,10,24,64,169,160,82,35,159,
+65,109,239,56,93,133,167,223,252,183,79,25,198,124,142,67,154,250,61,211,52,119,214,168,149,59,18,103,57,83,7,125,83,162,234,108,188,55,251,127,
+186,123,15,158,236,121,44,78,17,154,117,33,182,82,251,157,17,237,142,89,183,99,116,233,235,188,100,238,97,80,121,140,45,117,39,192,253,4,250,119,
+207,201,21,11,69,11,63,9,21,103,137,255,99,231,107,85,246,30,155,198,127,128,248,71,31,36,41,214,118,197,131,123,124,236,42,107,186,54,74,226,
+204,78,222,79,129,198,79,130,4,14,119,88,75,153,240,19,187,62,1,244,156,8,185,136,147,231,133,24,8,81,46,80,220,139,64,236,145,154,3,14,
+192,248,187,12,125,127,20,23,59,120,41,138,40,216,35,22,251,44,152,156,84,73,87,162,177,66,244,244,133,15,162,17,10,14,217,46,22,113,96,237,
+238,152,218,185,172,218,76,69,250,254,91,185,226,45,97,116,154,146,212,86,178,197,34,214,240,209,61,143,222,45,228,124,215,54,193,132,22,165,197,54,
+247,36,29,59,8,159,19,248,223,199,230,238,186,238,123,211,126,163,200,127,68,220,61,242,31,23,197,101,244,166,234,98,76,201,222,231,160,240,50,3,
+32,79,193,41,154,91,57,203,213,105,59,93,182,15,8,231,141,241,6,113,176,134,69,202,53,153,207,69,79,158,31,60,46,86,120,29,157,3,218,105,
+26,18,186,104,113,160,160,241,152,87,137,145,194,99,192,113,30,15,16,171,155,228,32,40,114,60,198,55,0,174,55,85,193,238,184,249,43,204,72,208,
+168,20,0,57,137,9,184,220,130,204,96,219,59,123,188,233,118,25,248,228,143,83,47,60,57,242,146,179,74,225,233,27,89,198,55,9,65,66,177,218,
+44,71,204,244,220,127,254,47,107,201,210,120,14,83,203,125,119,237,62,72,176,218,140,27,216,107,221,234,250,111,167,124,243,207,242,88,247,100,182,27,
+151,13,185,253,133,150,61,188,132,198,12,62,131,191,238,152,240,186,41,222,11,161,176,135,121,132,202,184,63,148,106,149,226,18,12,198,216,86,182,183,
+72,26,170,252,129,4,169,172,172,110,121,137,80,139,96,152,209,198,109,48,53,185,104,25,153,104,196,27,147,90,201,59,126,163,183,158,215,111,102,112,
+205,48,97,162,11,189,41,21,50,46,147,34,138,115,147,224,37,78,6,3,53,147,49,84,90,198,41,57,170,235,117,118,195,225,203,66,39,175,132,142,
+19,145,219,254,55,229,118,104,190,3,13,245,223,172,253,37,246,50,88,155,52,225,119,183,45,42,243,113,225,90,100,85,6,169,174,179,112,109,52,37,
+248,103,146,153,16,52,17,45,9,155,40,253,225,3,153,122,204,70,78,120,74,21,132,235,12,101,193,190,65,46,85,0,104,186,134,167,101,33,224,117,
+73,102,92,243,146,187,31,117,234,106,169,49,96,238,150,206,148,29,130,63,208,251,7,254,31,199,22,183,147,227,156,212,156,158,63,151,203,18,211,213,
+70,190,136,173,43,16,236,27,217,227,218,88,237,134,85,205,192,11,156,212,72,8,6,42,97,13,39,112,187,50,40,143,1,35,147,211,65,165,137,210,
+255,173,238,198,186,239,60,71,101,241,222,131,248,164,36,28,231,169,251,153,169,29,123,54,243,226,9,193,129,1,63,109,55,23,197,103,230,149,130,92,
+252,155,224,225,85,90,224,3,102,111,172,245,71,103,221,18,40,129,42,64,231,114,216,244,184,236,43,201,250,166,39,94,69,165,184,141,49,105,87,63,
+52,71,21,219,238,156,194,108,65,248,235,253,175,160,241,121,137,150,90,143,43,134,0,121,197,104,103,83,227,117,145,123,156,116,134,198,144,101,122,198,
+143,193,176,123,43,49,113,127,47,240,222,222,170,219,155,215,97,194,241,88,55,53,7,14,143,47,20,188,53,142,176,108,74,64,98,15,185,227,125,63,
+214,245,56,43,237,199,242,214,159,234,56,44,80,198,129,33,98,96,112,50,161,167,103,96,74,210,117,51,74,204,207,89,214,72,130,4,205,240,32,19,
+25,117,147,209,41,244,90,246,197,66,211,19,94,64,206,242,54,150,129,186,164,66,41,240,28,221,132,85,72,216,34,205,113,189,96,174,47,81,22,235,
+83,142,170,225,204,83,73,146,158,210,182,121,54,112,206,25,29,74,200,131,213,160,149,31,132,1,141,203,102,108,21,119,251,9,43,146,163,219,192,88,
+73,204,231,178,224,59,77,136,97,113,189,167,26,103,28,50,108,236,162,136,91,46,31,96,71,31,223,123,253,69,118,92,28,176,250,213,61,31,253,201,
+50,50,190,67,248,174,91,237,187,205,87,57,14,110,11,51,145,113,145,149,167,218,125,156,149,247,167,232,185,119,5,73,44,133,82,224,0,137,246,156,
+167,183,247,155,26,221,178,50,160,20,168,146,131,43,125,179,196,58,175,188,209,221,45,103,140,123,42,145,1,84,35,169,58,93,160,252,208,49,192,159,
+161,200,82,152,6,230,146,21,12,128,44,77,33,162,220,255,202,107,104,247,71,215,184,145,21,140,15,228,240,158,43,238,101,137,39,180,153,131,134,106,
+15,1,70,46,40,12,252,51,9,185,44,60,194,75,188,176,12,220,115,38,90,185,201,141,111,41,87,39,190,214,192,12,22,9,108,182,3,223,248,189,
+223,224,246,187,202,207,136,246,221,135,203,126,120,65,83,82,114,200,254,150,224,31,102,250,14,252,192,243,112,40,94,33,147,150,42,57,200,78,27,137,
+138,38,200,249,37,16,35,67,2,112,190,243,123,52,34,17,185,226,100,131,140,73,46,30,226,30,245,244,241,85,238,170,224,145,5,153,158,21,114,242,
+58,174,32,132,92,190,129,171,56,108,78,26,42,148,188,131,82,120,133,239,209,1,52,79,75,226,182,37,247,94,141,213,196,250,98,89,94,178,30,110,
+250,76,138,135,201,225,77,42,66,68,225,36,37,242,221,28,183,33,240,254,130,86,37,3,100,46,196,84,12,204,201,28,135,199,252,191,203,246,50,151,
+29,23,154,252,55,37,233,189,64,35,84,180,94,76,227,79,18,52,234,153,113,170,99,88,170,77,133,142,130,197,169,168,217,117,115,5,35,98,17,1,
+155,7,88,220,75,44,239,121,179,61,125,133,132,44,58,102,144,5,28,178,244,230,12,234,185,94,99,129,113,65,167,140,32,60,168,100,77,73,85,90,
+202,246,92,201,29,164,204,27,35,73,154,171,144,52,230,0,217,245,7,166,73,237,181,178,248,165,101,136,231,235,128,136,162,225,118,26,63,85,187,83,
+1,159,203,42,122,45,188,53,231,10,121,27,236,39,59,136,12,220,224,83,79,161,224,101,160,200,102,53,184,11,187,243,31,254,102,38,50,239,190,250,
+239,13,228,62,59,228,181,185,46,171,235,210,69,119,231,234,227,4,243,168,208,83,137,41,115,77,21,220,249,175,23,93,196,121,18,92,245,235,28,178,
+250,248,200,54,148,88,241,208,79,51,172,47,165,67,101,46,107,246,18,32,155,100,113,81,185,71,187,126,18,61,34,182,112,204,34,97,101,45,57,61,
+177,254,167,215,121,29,83,238,71,60,218,180,72,198,17,180,68,157,200,235,6,236,119,208,240,236,156,87,206,197,6,4,9,161,124,159,13,59,89,143,
+216,92,194,222,47,95,104,167,31,193,37,153,137,150,180,119,6,56,85,210,156,127,172,229,97,101,31,71,130,56,108,244,243,30,15,198,252,141,47,147,
+227,181,91,175,197,119,156,135,237,148,153,237,189,43,194,55,176,171,104,97,193,171,159,38,6,125,243,154,202,216,254,40,253,125,97,55,161,46,158,137,
+4,100,34,130,115,49,216,206,85,244,18,131,171,75,29,188,161,4,202,188,54,219,6,111,125,199,178,162,240,60,96,152,150,16,245,197,248,127,188,244,
+162,51,212,160,69,146,48,188,101,135,7,150,78,207,125,208,226,139,185,108,25,60,36,136,145,200,177,184,129,184,246,7,129,56,149,27,229,61,92,161,
+137,154,163,96,75,172,27,127,142,47,15,4,197,81,44,30,24,73,54,67,72,175,218,64,246,127,13,175,42,177,84,68,236,220,231,157,255,127,155,2,
+55,232,176,158,163,228,190,19,146,80,170,211,54,128,191,122,81,60,220,25,181,228,232,237,248,2,28,60,224,180,166,37,153,205,211,24,173,193,73,192,
+244,220,218,233,203,153,161,163,200,14,96,34,191,105,225,121,101,110,209,38,70,118,41,196,217,69,102,236,154,215,230,170,200,30,42,120,100,124,132,138,
+224,244,89,56,192,51,53,193,240,254,91,175,184,155,115,211,106,234,22,157,16,248,205,174,123,3,83,202,72,161,6,36,49,131,70,132,204,211,19,149,
+194,78,202,95,180,24,148,176,71,43,43,247,16,167,173,105,165,151,157,14,113,5,124,66,171,56,136,164,231,209,39,187,232,254,239,236,198,254,35,39,
+250,79,17,199,127,9,180,130,8,80,84,60,190,20,81,28,78,109,81,172,248,42,137,188,12,244,13,18,46,62,208,84,53,58,220,144,59,19,66,53,
+94,101,119,166,237,211,245,219,180,79,21,172,34,231,13,30,37,62,227,70,2,137,249,7,152,240,92,7,127,37,89,22,252,134,146,206,118,120,84,94,
+155,59,150,175,193,248,141,72,233,96,48,171,223,74,115,254,155,7,99,144,91,89,110,92,57,89,2,88,248,222,192,30,238,33,80,160,36,192,162,15,
+42,159,172,217,196,75,135,124,50,53,44,209,172,77,164,134,117,86,130,252,49,36,210,239,165,56,186,129,241,134,51,78,195,57,222,245,191,59,212,149,
+138,229,62,83,9,250,207,170,158,101,184,197,154,192,225,233,15,241,184,94,123,202,151,85,34,73,92,29,0,221,62,178,75,218,242,130,163,107,48,181,
+10,73,132,49,81,203,212,92,103,224,153,43,24,181,195,202,51,60,71,43,25,53,196,242,201,206,192,135,138,31,38,216,52,127,77,229,242,18,50,197,
+158,132,4,24,227,185,102,115,121,136,20,86,176,14,161,194,71,39,61,175,234,140,228,100,23,172,38,171,2,103,178,213,222,252,7,143,152,154,165,60,
+97,136,88,66,181,53,77,220,100,113,82,101,97,154,98,196,110,32,241,58,165,246,217,250,255,0,174,254,152,153,121,43,57,99,208,32,171,126,215,246,
+114,232,42,42,59,143,228,187,43,175,217,23,133,226,184,123,49,199,178,184,88,104,95,79,218,9,238,78,244,153,112,10,71,20,62,64,99,189,215,149,
+225,2,185,74,218,163,31,3,174,107,17,99,20,72,170,75,189,49,251,82,86,78,174,230,126,59,196,179,199,75,129,132,82,213,208,7,123,143,43,198,
+46,233,247,136,226,68,82,17,155,56,206,81,155,99,167,81,67,77,175,130,148,51,147,140,196,90,134,145,160,171,13,174,194,193,225,168,104,18,230,124,
+198,85,94,115,90,128,112,151,12,111,115,86,120,1,250,159,97,232,233,166,131,161,6,241,29,255,12,181,44,125,0,67,12,226,101,173,48,99,227,254,
+183,251,52,20,253,86,163,21,243,159,134,230,54,87,137,202,147,26,7,99,66,206,10,167,86,216,156,56,177,36,34,226,164,202,26,159,136,164,214,228,
+174,98,135,57,101,11,121,34,152,115,89,164,175,242,18,235,111,161,197,17,146,118,6,131,67,13,29,163,23,156,159,64,219,71,108,195,31,69,45,153,
+135,229,14,121,122,108,68,76,28,80,122,89,160,233,128,236,250,199,181,54,145,171,40,164,99,228,169,249,15,137,233,139,79,174,189,202,4,149,134,177,
+49,204,106,242,187,166,230,130,213,197,34,171,109,41,191,225,1,208,160,104,13,152,200,4,40,235,47,193,109,189,143,56,214,1,88,37,208,176,105,127,
+47,246,124,174,162,235,89,226,62,107,21,238,190,145,54,132,212,215,27,29,129,155,39,208,209,14,189,129,6,76,26,120,238,7,45,46,216,68,8,7,
+134,4,189,44,70,161,168,96,7,225,32,169,220,195,62,57,171,170,68,237,65,102,236,158,133,214,118,121,200,113,13,147,159,96,32,4,71,137,226,152,
+92,133,96,153,221,110,152,14,182,193,212,172,99,83,41,140,137,206,77,217,214,24,157,178,39,66,13,208,72,60,52,237,110,1,82,55,168,17,77,180,
+132,147,23,19,150,145,107,32,50,189,132,36,125,80,74,80,81,193,209,152,80,134,151,142,199,136,132,107,59,45,134,87,145,182,29,18,11,244,118,63,
+203,131,227,11,104,63,188,170,249,237,7,132,20,222,53,208,28,92,75,186,248,220,198,190,45,169,131,210,106,231,182,59,65,125,127,121,141,192,17,143,
+50,147,97,212,228,131,240,62,187,14,225,4,201,88,10,190,131,83,8,186,54,38,145,244,122,122,68,218,27,202,218,6,40,238,7,220,166,88,137,220,
+137,236,2,250,184,32,209,117,1,118,123,39,22,236,135,143,18,17,240,74,92,85,187,64,36,81,13,110,81,147,114,130,66,9,137,232,185,18,120,105,
+181,123,207,11,198,88,192,182,182,119,18,65,178,76,95,21,175,188,66,130,68,189,97,171,19,130,16,195,20,91,11,32,209,57,72,204,24,47,236,122,
+246,254,175,93,201,120,46,251,132,252,199,84,242,0,184,103,113,112,52,48,98,19,225,97,67,163,36,213,165,27,186,105,145,145,80,52,89,250,224,102,
+10,175,132,77,54,163,97,217,204,82,99,203,56,47,33,147,188,131,63,162,201,168,140,137,35,57,66,152,123,126,27,145,195,33,145,65,24,134,124,62,
+219,181,184,168,219,174,152,34,188,56,0,26,77,236,223,132,191,153,193,46,179,68,94,154,68,162,40,144,34,17,21,145,202,72,143,213,125,159,170,95,
+165,193,56,211,202,67,106,237,164,242,216,49,245,133,87,184,54,37,130,105,183,57,233,84,179,138,111,119,132,183,59,228,184,62,154,54,126,193,71,83,
+238,127,196,142,85,99,243,94,131,29,231,191,41,201,54,62,17,19,112,187,58,17,70,107,100,216,25,233,226,46,185,150,24,236,221,158,144,44,14,43,
+83,120,26,86,58,20,246,2,109,223,130,246,249,65,201,88,68,150,32,182,216,70,31,13,154,166,137,250,124,244,253,62,82,127,53,147,145,248,175,147,
+192,13,90,216,53,106,229,74,37,205,5,48,152,109,121,238,155,192,170,132,38,84,105,160,7,1,43,121,141,130,231,58,84,41,14,36,38,244,43,135,
+155,28,165,200,250,65,49,33,83,19,112,124,138,96,36,211,176,56,12,98,178,195,167,113,25,117,16,195,208,150,112,189,238,243,35,104,38,45,0,110,
+31,241,127,38,131,151,227,62,17,183,226,57,111,142,237,129,146,160,208,172,212,143,132,240,229,67,211,163,105,159,8,120,234,86,144,161,84,35,23,146,
+221,211,95,122,190,136,12,125,97,121,252,196,184,94,3,249,95,205,57,153,150,14,212,240,144,152,44,121,52,9,162,102,15,78,139,92,128,252,140,164,
+9,33,146,242,21,92,24,77,245,168,48,150,85,234,240,7,242,184,0,212,58,109,220,101,198,45,98,72,52,146,89,183,141,37,97,247,10,220,132,54,
+110,56,109,94,179,145,142,192,102,93,227,132,86,232,163,113,62,83,155,188,18,84,250,54,140,170,97,132,76,183,229,151,187,112,36,190,34,252,158,131,
+189,225,173,245,62,135,240,186,188,20,151,128,223,124,135,207,102,179,23,16,194,234,86,175,65,246,251,231,60,153,97,39,72,226,233,168,203,50,193,213,
+30,173,88,202,126,232,61,238,72,180,122,98,129,205,131,60,100,35,74,219,166,22,101,25,27,0,250,110,42,140,174,170,133,132,8,37,209,175,146,243,
+255,192,121,80,47,131,151,6,201,245,72,56,195,51,117,6,96,98,142,94,168,180,107,63,24,110,210,204,227,102,36,86,150,144,118,38,9,123,178,65,
+207,192,8,118,44,40,23,129,39,213,66,25,101,165,182,162,203,166,85,38,192,195,116,15,222,48,159,158,66,118,105,184,185,105,153,234,248,225,89,94,
+31,224,249,252,57,30,11,218,108,184,47,235,184,43,4,80,208,180,101,8,240,118,51,216,180,245,108,133,228,67,89,104,65,178,16,157,224,12,158,33,
+4,108,244,232,93,166,158,233,187,60,21,139,221,178,61,79,96,230,206,58,72,118,172,174,201,39,91,49,200,116,230,48,219,187,228,50,177,3,50,57,
+195,156,207,130,191,16,96,112,32,226,26,172,143,104,178,198,160,243,54,175,253,38,119,27,146,158,218,158,207,53,227,238,140,62,169,92,98,61,42,226,
+4,179,188,20,250,249,136,81,5,166,239,20,68,198,96,98,170,39,224,100,135,133,95,23,218,111,201,88,57,141,198,25,196,241,145,161,200,37,92,226,
+124,165,95,202,243,126,85,32,236,135,85,198,126,163,184,152,247,209,36,216,67,226,78,150,241,251,110,126,123,143,44,186,30,37,33,181,112,213,49,62,
+58,23,83,53,105,145,178,106,21,97,228,45,88,73,87,148,186,231,113,213,92,8,45,128,9,152,253,17,189,174,249,28,221,20,7,3,217,120,209,253,
+215,15,52,86,238,67,134,233,97,33,51,249,0,194,38,85,223,68,161,200,76,161,71,44,73,88,241,81,19,115,73,198,152,78,133,195,102,38,225,50,
+52,200,68,12,122,158,243,133,197,34,167,10,18,208,79,15,218,10,216,234,53,54,136,158,198,148,207,59,187,140,4,52,219,194,8,100,53,54,201,41,
+121,76,125,12,117,98,223,63,75,247,127,83,202,40,192,120,47,49,207,108,191,96,242,222,168,172,45,202,242,216,19,180,45,74,17,194,160,17,82,218,
+54,32,214,101,196,224,53,33,207,34,74,234,247,16,20,186,161,118,228,184,44,152,105,106,89,195,232,238,50,249,130,186,188,64,241,97,65,139,6,101,
+243,145,101,104,16,202,197,90,114,124,21,136,29,247,122,114,210,4,237,215,23,77,65,50,150,8,34,243,82,26,54,218,174,118,121,67,16,165,17,196,
+84,200,79,213,79,161,68,20,89,77,63,164,215,170,97,145,168,188,236,250,41,88,253,19,216,179,80,72,99,102,7,153,32,182,234,188,12,82,241,209,
+16,36,6,5,136,159,87,21,131,250,30,55,239,244,85,88,110,179,197,120,110,251,188,64,139,45,226,81,218,106,245,250,108,95,123,241,95,46,106,139,
+139,17,65,94,136,201,58,171,243,208,70,199,166,23,8,150,71,69,10,149,162,9,24,62,138,63,87,215,96,225,141,73,154,162,230,239,168,181,177,4,
+20,131,16,76,162,216,66,89,62,203,27,19,12,177,80,122,243,129,6,206,59,123,32,74,198,209,90,152,232,147,136,150,131,134,137,152,199,221,58,151,
+114,225,164,72,242,153,174,245,71,239,212,66,47,122,31,53,62,126,242,156,4,16,114,106,54,255,61,233,240,70,95,199,46,191,84,247,69,203,202,98,
+172,71,56,189,152,92,4,116,123,226,43,77,209,248,95,131,241,117,16,94,67,158,214,122,111,144,182,154,2,106,148,16,154,216,113,178,118,162,131,205,
+145,161,142,111,43,142,69,200,220,95,246,212,101,82,176,166,167,84,154,45,1,67,139,193,164,110,240,148,184,237,116,94,118,106,227,47,97,79,63,228,
+181,230,15,63,83,16,144,60,172,209,178,161,92,26,147,79,140,210,228,39,71,73,61,59,68,150,207,150,198,227,248,227,161,128,177,14,106,186,118,143,
+64,147,74,71,36,87,119,213,114,186,173,75,32,194,91,18,209,219,70,236,43,69,172,50,8,226,187,204,153,73,167,101,207,4,126,111,89,208,244,220,
+155,77,245,45,156,164,196,184,190,59,197,230,29,136,21,194,253,223,145,187,217,94,253,199,134,190,248,111,101,21,61,134,157,233,245,140,119,227,141,226,
+196,191,50,54,46,37,128,200,146,112,69,201,148,160,173,140,110,110,177,102,46,8,196,247,3,0,112,88,67,8,44,102,131,148,66,28,75,226,24,155,
+228,113,53,16,38,160,226,23,111,115,208,222,7,196,110,236,32,42,227,100,32,137,242,127,1,175,153,232,140,229,86,48,22,156,238,163,143,134,152,153,
+83,170,167,95,136,91,71,8,194,109,236,113,131,122,223,25,79,59,68,70,70,64,165,110,227,10,183,97,46,32,164,156,244,39,23,56,88,24,183,164,
+165,26,153,111,56,104,69,26,105,1,43,97,11,155,144,29,163,41,149,253,95,189,117,37,63,252,103,97,160,239,61,246,17,236,133,215,153,97,2,252,
+235,217,184,240,165,46,78,110,243,194,236,203,77,49,157,211,37,118,138,138,92,172,112,84,54,153,185,67,160,91,76,155,195,67,190,135,134,163,138,117,
+2,93,162,178,37,139,31,102,145,194,209,55,218,113,254,27,167,59,112,196,9,170,89,42,10,182,245,134,32,92,146,150,65,163,198,96,193,93,2,70,
+164,149,198,213,116,112,233,243,237,137,153,146,189,124,125,212,140,65,54,165,137,75,229,27,187,124,217,248,197,78,197,209,80,153,132,90,104,116,25,152,
+105,105,210,140,153,175,112,48,18,101,168,157,19,129,87,167,224,255,103,145,220,77,92,118,28,38,251,247,68,54,75,177,38,236,181,237,64,173,115,185,
+25,33,169,28,27,71,192,97,220,200,54,153,1,36,52,17,84,132,90,230,33,220,101,88,71,2,137,71,84,75,171,244,82,47,80,34,50,201,108,246,
+53,19,32,172,86,207,69,205,66,133,88,73,188,79,125,192,211,235,6,135,5,147,238,172,229,240,131,196,151,95,4,124,160,153,123,192,13,96,25,227,
+125,118,132,1,225,34,197,199,225,164,203,15,16,24,218,27,172,220,131,180,129,202,192,17,27,49,90,88,33,99,142,66,15,29,65,141,91,84,234,214,
+41,105,225,34,5,10,32,84,4,47,9,98,13,224,136,122,186,30,143,243,242,176,216,77,38,219,199,120,47,37,150,97,12,183,27,178,221,206,178,137,
+191,94,9,156,120,232,58,76,136,136,198,49,124,70,141,6,34,244,157,112,44,94,0,170,16,69,208,28,126,233,8,121,72,84,180,211,90,146,202,144,
+223,76,198,162,124,253,20,134,93,191,40,55,137,93,128,27,79,3,158,5,14,41,224,212,105,131,146,66,1,4,168,33,249,42,80,64,149,174,229,62,
+199,172,127,47,150,7,189,152,235,190,207,88,34,150,208,214,167,101,126,202,166,41,244,138,186,169,123,41,56,255,5,153,194,228,151,96,245,220,110,17,
+201,102,202,84,138,71,213,111,94,211,48,183,29,196,113,98,163,141,45,23,28,198,119,196,243,254,54,199,13,164,159,255,142,138,221,126,41,66,199,209,
+238,132,236,228,77,63,90,78,252,139,236,136,0,39,201,73,29,234,124,34,86,75,99,74,83,55,9,79,32,193,169,23,3,157,190,153,140,16,172,196,
+211,144,98,74,71,194,73,67,216,245,88,157,175,136,102,93,106,89,65,50,170,134,8,12,16,8,183,139,40,200,2,12,0,184,129,18,112,67,196,204,
+10,221,186,233,185,208,211,137,75,156,90,34,83,47,108,18,20,116,180,72,25,17,82,8,169,219,224,157,133,116,62,12,84,81,107,149,10,30,95,136,
+112,44,172,213,168,11,131,179,50,79,182,123,201,188,211,253,71,30,250,122,28,148,82,190,7,43,199,253,254,135,200,109,162,127,166,158,231,189,134,248,
+67,208,248,111,75,68,214,157,56,121,151,42,211,157,28,41,106,154,235,59,164,111,78,62,67,107,146,1,107,40,140,25,129,128,239,125,86,220,123,67,
+74,88,198,45,132,67,12,182,78,11,29,208,232,41,85,20,193,133,201,13,207,217,41,28,200,92,136,142,35,14,81,74,6,203,93,166,85,123,36,173,
+225,101,111,67,228,149,179,85,35,4,58,158,216,59,252,215,147,215,68,100,193,108,60,157,84,224,156,40,89,69,162,37,53,59,42,212,71,44,226,48,
+155,215,201,83,18,2,144,94,95,168,123,59,20,201,184,113,23,124,70,70,32,65,149,143,168,101,171,89,247,190,71,157,189,186,219,95,111,62,91,174,
+225,178,195,14,217,95,157,99,54,28,79,111,65,49,237,111,21,185,72,66,116,225,164,8,33,198,180,39,83,120,90,45,205,145,204,9,173,103,107,184,
+70,196,140,4,165,201,75,239,47,208,67,73,192,148,160,13,198,243,151,236,105,134,112,57,137,124,132,136,177,193,83,79,105,224,152,205,2,122,45,245,
+190,99,149,213,23,0,5,40,210,209,71,97,214,15,63,4,192,238,207,144,54,68,232,37,16,177,178,89,204,252,12,145,108,91,196,147,212,114,173,167,
+19,220,240,89,80,120,131,52,164,104,151,83,152,132,14,172,75,4,25,188,97,59,92,114,55,243,192,76,160,70,211,71,233,124,126,188,67,158,131,125,
+196,123,14,203,21,152,172,74,220,48,201,220,43,17,132,235,212,149,22,85,59,56,202,212,206,153,76,173,104,72,248,163,113,213,97,230,143,70,138,51,
+88,109,26,0,207,99,26,150,4,14,64,124,122,68,20,221,93,176,21,97,9,64,188,126,120,194,134,172,227,175,57,157,85,8,1,65,80,75,100,80,
+164,134,94,124,49,226,149,57,136,117,116,13,227,237,155,84,177,152,164,210,154,188,220,176,198,107,193,82,31,135,6,1,165,7,99,105,77,135,147,209,
+16,139,159,226,157,192,128,117,5,149,93,140,197,162,4,45,98,40,20,242,11,198,33,45,73,43,83,215,57,149,42,215,181,252,30,28,26,142,19,85,
+156,233,61,167,112,171,61,14,245,104,52,133,252,157,100,187,213,225,19,116,248,100,42,217,11,86,218,174,224,138,84,166,163,134,241,252,144,185,116,7,
+12,140,130,58,52,161,145,236,131,99,251,108,43,96,199,203,42,192,194,0,22,20,123,22,16,26,26,198,105,165,141,214,204,29,76,36,184,65,80,54,
+138,232,98,11,47,72,230,56,107,88,99,244,56,67,110,235,137,80,161,128,11,117,210,225,5,140,75,98,195,228,191,179,242,142,92,144,9,7,210,117,
+170,147,12,44,122,189,36,38,21,165,81,60,203,172,181,202,37,4,214,148,120,220,107,132,176,163,46,6,117,190,146,78,78,33,103,135,133,252,255,131,
+190,88,123,121,241,87,222,227,89,164,76,4,21,156,113,91,149,107,217,167,137,35,2,241,203,178,8,49,252,102,54,201,75,48,33,0,40,70,44,113,
+17,45,146,64,158,63,40,46,101,34,40,124,52,219,162,206,85,23,91,89,30,232,117,152,89,198,240,119,8,220,170,8,175,65,135,96,180,109,81,174,
+6,250,36,176,225,132,41,120,14,254,234,74,13,204,160,54,28,45,69,227,121,217,194,103,175,221,95,73,228,242,6,177,250,8,88,19,139,164,72,37,
+156,33,18,141,162,193,214,235,5,11,72,139,3,125,22,74,138,46,6,194,66,236,208,245,38,165,7,111,243,6,112,57,71,144,229,78,94,225,190,143,
+236,112,228,134,202,104,190,162,227,216,117,80,207,176,28,175,9,183,153,120,27,149,0,9,158,102,136,94,198,74,203,141,31,100,120,104,183,49,188,101,
+186,121,33,119,54,2,140,179,195,5,171,5,207,123,63,17,167,84,112,138,165,148,106,12,6,22,188,223,45,228,243,193,241,230,46,29,135,52,237,179,
+134,234,237,46,192,90,74,154,26,253,192,8,253,68,58,241,138,8,148,141,201,96,74,203,22,161,186,90,26,22,96,198,39,5,135,132,73,30,1,208,
+250,20,75,18,99,95,96,45,109,252,199,10,224,51,18,115,16,219,212,253,164,93,74,136,40,60,51,87,239,0,59,152,19,74,248,114,113,231,157,69,
+203,71,135,43,219,253,73,222,229,86,251,188,224,177,93,7,229,12,230,207,10,183,104,91,106,56,236,249,28,27,8,77,174,47,8,50,125,0,195,41,
+7,27,139,197,59,126,24,136,94,3,171,21,134,1,63,40,74,69,193,64,65,204,143,178,183,80,184,32,146,107,246,216,146,160,4,6,18,94,106,205,
+162,181,135,32,239,177,96,28,8,2,52,152,227,36,133,178,66,214,137,134,124,44,146,67,102,208,49,32,248,99,176,49,5,117,124,132,216,245,66,160,
+228,110,128,76,196,59,59,84,154,180,20,116,168,40,64,146,228,136,2,61,2,62,217,124,143,130,243,112,214,7,221,235,187,59,199,20,226,217,51,4,
+98,16,138,80,162,155,248,31,79,203,179,5,170,239,168,178,95,232,7,244,20,138,222,164,42,222,165,74,5,186,23,49,87,167,27,144,16,221,226,80,
+71,106,36,101,106,15,176,171,162,99,6,218,227,78,248,194,1,226,138,9,50,231,28,244,251,134,210,42,206,111,176,45,80,6,153,164,22,2,92,243,
+161,174,232,53,121,194,49,40,38,177,178,4,213,87,196,56,151,25,49,123,0,230,25,5,77,148,27,29,5,184,121,68,33,21,170,22,213,36,4,77,
+143,21,91,39,80,154,61,43,192,139,159,149,92,138,29,81,211,225,17,11,86,23,61,103,39,150,42,2,91,6,38,154,54,186,14,14,18,135,88,222,
+118,82,4,174,137,170,217,31,67,149,228,118,171,173,184,47,194,40,239,61,86,48,188,1,80,104,175,228,65,59,204,227,52,102,198,204,139,225,190,38,
+251,121,220,158,154,42,82,134,202,206,31,52,179,66,7,97,159,40,29,116,241,77,254,96,75,150,195,84,164,199,117,188,197,201,188,49,206,77,71,49,
+205,140,182,75,78,200,138,59,167,108,196,54,73,141,57,109,26,142,137,55,75,146,109,87,89,14,174,40,202,40,14,103,40,80,170,3,238,112,201,223,
+175,113,53,163,136,152,237,113,128,98,227,173,190,23,216,65,163,50,65,68,59,35,137,226,195,68,16,203,231,15,169,53,0,30,165,20,114,51,192,77,
+11,196,236,48,184,76,109,65,75,248,9,204,124,241,45,127,31,179,233,247,102,55,222,163,77,132,232,59,78,170,51,47,132,41,137,179,108,3,42,180,
+220,27,54,132,231,218,132,164,29,139,130,57,141,225,165,101,231,6,105,121,203,148,44,17,63,80,56,185,133,68,140,151,108,228,80,195,70,14,226,125,
+134,45,10,193,144,106,231,133,165,2,41,74,0,100,48,53,83,152,53,182,65,198,55,22,89,78,155,38,216,180,169,253,52,204,62,65,235,88,9,15,
+43,241,215,225,6,157,57,77,239,254,2,166,230,26,106,188,240,242,135,156,130,168,191,69,1,71,72,10,246,209,236,109,35,112,44,148,137,48,201,184,
+232,0,24,26,162,233,6,53,47,196,106,80,197,65,148,130,90,97,205,101,254,31,31,214,249,145,83,215,156,134,130,243,229,184,107,7,130,21,155,130,
+13,239,117,145,248,55,36,161,102,58,86,85,134,241,237,161,173,104,15,165,40,161,248,199,242,0,25,152,154,206,160,132,24,52,115,131,171,177,34,47,
+28,107,229,10,35,52,208,147,154,126,35,46,17,146,88,221,198,29,45,19,210,239,139,169,96,94,57,172,30,19,91,96,234,124,83,2,226,225,243,14,
+72,140,18,94,176,21,172,192,137,115,133,31,203,74,133,64,156,82,132,78,196,168,3,151,247,30,231,128,8,244,57,237,143,93,145,52,17,40,16,213,
+216,56,101,79,97,114,200,76,128,4,12,114,128,108,38,64,166,11,31,76,205,163,241,33,39,252,222,231,201,195,24,195,120,45,246,171,77,226,182,3,
+22,152,139,142,192,191,20,175,2,76,83,216,208,67,208,152,112,207,27,194,10,197,144,148,197,214,41,6,9,59,0,2,27,132,120,200,172,188,68,164,
+122,57,41,238,62,152,88,200,96,55,176,2,20,45,151,101,117,151,52,255,57,15,122,107,164,217,209,245,152,52,240,193,89,208,92,220,9,86,1,126,
+90,205,157,0,86,54,135,114,253,3,217,51,148,211,107,76,225,153,222,136,206,112,252,68,120,21,9,243,254,139,98,34,64,82,209,241,187,206,94,65,
+244,45,190,90,127,81,86,36,80,211,84,81,183,51,20,192,231,210,54,12,20,200,145,129,16,219,235,131,167,12,247,63,171,241,250,21,247,30,9,7,
+81,238,181,151,25,11,105,208,197,74,96,77,193,112,237,243,6,133,80,238,118,1,154,248,65,132,74,137,123,150,210,195,38,58,197,62,203,95,93,54,
+174,82,169,206,63,156,43,10,34,33,186,224,112,52,133,48,230,59,111,82,186,136,187,250,141,110,98,124,129,48,116,214,177,124,69,73,245,197,146,138,
+94,226,26,62,71,150,197,181,200,93,134,176,22,133,8,73,194,111,69,69,102,247,151,168,194,5,29,61,149,146,58,48,210,180,134,39,96,141,11,13,
+22,114,58,253,65,198,46,52,51,146,210,35,80,35,144,115,85,159,57,144,23,203,251,172,73,184,194,81,165,0,57,7,28,94,14,73,24,110,239,145,
+228,245,38,119,28,129,78,195,232,55,133,187,100,52,144,249,112,211,208,125,158,123,90,57,108,153,21,146,101,0,140,78,238,184,185,76,74,75,64,123,
+219,39,152,122,67,19,237,237,27,73,131,186,15,179,216,90,102,229,113,205,167,209,41,24,97,26,1,210,251,46,93,180,163,24,51,67,117,222,142,169,
+48,65,79,67,207,59,72,180,190,42,38,230,74,32,180,109,15,152,185,189,190,2,148,163,136,149,116,148,102,35,53,42,56,47,7,64,201,73,240,57,
+107,48,33,192,26,14,112,89,240,167,128,204,143,104,242,61,250,75,200,80,232,89,3,66,67,142,242,121,96,224,21,5,197,238,22,219,216,27,147,124,
+40,28,167,23,157,225,252,157,62,43,7,249,201,202,79,77,239,48,11,133,65,71,206,204,57,147,179,4,37,90,216,188,62,210,13,216,133,2,114,122,
+232,19,3,155,204,231,147,193,172,20,108,217,128,116,145,102,197,46,203,103,197,72,27,46,64,75,8,55,71,195,158,37,163,241,155,115,194,16,135,148,
+193,211,87,208,11,143,150,145,64,162,12,179,196,239,240,145,35,141,158,130,198,236,163,224,109,3,92,134,186,86,198,114,150,55,130,179,149,223,72,209,
+140,184,146,241,175,176,194,227,65,215,95,144,116,28,81,187,60,48,172,220,209,181,49,145,156,46,50,134,104,149,11,108,102,62,138,181,229,133,156,34,
+153,124,34,74,217,188,48,240,135,38,100,101,253,175,201,212,86,229,59,110,26,179,168,245,218,97,98,27,12,198,190,133,199,190,75,189,142,86,180,187,
+48,33,47,242,198,200,181,17,16,84,170,89,104,216,184,141,38,78,143,0,68,235,35,142,233,171,84,83,10,185,84,12,144,145,142,46,104,137,139,52,
+38,62,0,170,198,35,193,145,130,78,44,57,112,207,137,196,144,80,192,28,251,134,145,41,138,15,18,154,31,1,6,149,81,82,173,20,143,32,88,219,
+204,139,104,99,242,51,204,98,32,202,174,81,58,153,49,208,196,10,165,50,57,17,19,224,8,188,153,152,28,196,122,194,201,83,32,43,27,80,129,170,
+162,103,90,17,95,20,133,216,139,76,42,92,47,107,221,225,211,97,47,185,141,134,187,148,242,16,5,203,190,67,74,40,199,30,112,116,253,204,80,238,
+94,176,76,105,92,165,156,118,28,69,66,78,79,96,66,100,10,226,192,213,167,130,32,32,115,146,48,200,144,149,64,243,6,130,144,139,116,216,238,84,
+85,2,52,49,150,37,157,72,140,37,39,76,99,47,128,9,90,114,114,110,65,200,68,204,217,78,96,83,22,42,120,61,63,69,147,133,146,99,20,43,
+127,198,30,224,238,0,77,224,33,221,164,25,9,26,24,8,226,132,130,235,248,33,20,170,103,19,133,62,56,128,184,9,152,103,42,93,97,173,219,194,
+14,64,49,121,66,119,83,161,22,59,83,88,133,168,1,136,228,249,255,107,106,21,229,70,19,193,111,186,142,58,184,148,101,12,100,92,153,82,148,241,
+100,201,204,195,217,98,206,12,131,43,12,41,173,142,240,108,152,204,231,43,144,110,21,64,137,123,104,209,128,202,146,205,114,48,78,151,139,164,161,20,
+240,80,178,10,160,67,42,163,76,186,140,207,33,223,193,68,27,155,215,109,216,66,53,31,176,251,191,32,218,204,180,164,184,36,202,228,141,68,187,108,
+98,53,195,38,113,113,133,140,61,10,177,105,23,216,121,200,201,123,222,106,44,153,21,76,36,220,237,176,106,87,36,181,203,96,65,204,10,175,156,3,
+43,72,29,169,198,0,45,113,200,153,133,40,197,66,164,229,228,48,228,50,87,178,34,230,127,27,151,37,51,154,240,137,60,135,105,193,93,36,69,132,
+207,162,55,27,114,207,29,185,204,244,196,121,52,144,54,187,45,219,40,69,103,22,96,102,3,17,52,149,52,53,154,21,10,136,35,18,54,56,94,38,
+218,187,155,170,36,22,42,254,176,120,117,130,34,215,60,212,194,2,110,106,43,31,0,192,251,52,133,14,141,16,40,56,87,82,234,36,140,196,162,109,
+15,20,92,184,68,51,252,100,249,160,76,225,133,167,170,221,142,232,179,115,120,5,226,66,131,168,147,94,216,177,245,48,66,176,55,1,100,77,206,20,
+179,96,28,164,166,62,136,88,17,229,70,76,41,34,208,162,84,44,149,162,56,21,41,81,101,132,19,229,252,254,55,59,84,47,5,220,117,18,158,59,
+196,43,164,68,196,122,249,20,212,112,33,87,218,208,103,71,6,106,57,9,249,100,39,81,9,168,175,34,177,81,90,28,244,152,64,99,144,80,140,164,
+51,34,34,169,152,131,103,31,19,171,228,162,95,188,32,68,40,184,78,151,36,114,61,0,90,220,243,114,106,2,214,240,219,144,150,133,183,58,131,149,
+163,158,44,7,181,73,196,79,223,172,219,97,101,246,19,36,233,35,91,231,178,224,231,9,113,124,164,42,242,134,8,144,18,12,40,128,230,104,55,185,
+227,164,218,195,242,7,241,234,41,1,225,227,52,220,216,230,202,139,39,16,241,233,18,195,156,91,199,20,114,62,115,23,33,204,246,250,250,184,188,35,
+14,11,213,103,171,188,182,80,234,234,52,82,220,42,26,142,68,233,166,58,218,100,241,97,142,169,178,137,12,161,184,136,231,116,211,162,9,129,125,21,
+222,241,9,89,144,96,166,135,130,203,178,132,133,150,167,65,52,117,43,161,68,77,3,155,37,202,112,245,58,200,211,40,139,167,116,80,139,48,181,144,
+107,107,37,84,203,88,121,252,165,98,57,52,51,203,184,155,197,210,40,251,111,11,176,91,147,134,217,115,120,165,122,157,36,214,84,173,214,182,89,16,
+128,183,116,12,39,218,36,131,15,43,104,44,105,81,179,80,102,12,19,14,105,120,120,193,134,192,40,165,152,22,32,208,216,252,134,69,4,145,248,176,
+55,171,255,149,200,203,78,55,251,32,62,91,201,111,28,29,224,135,101,68,135,131,79,54,170,156,11,27,18,51,27,221,163,27,240,120,8,140,169,200,
+35,245,59,166,109,208,34,63,31,5,37,131,52,128,24,57,156,66,208,193,135,133,68,234,157,242,165,42,129,137,146,145,137,88,208,236,40,34,192,10,
+168,141,130,68,140,92,166,69,62,8,67,241,183,91,125,214,54,8,163,117,147,28,44,241,226,98,80,21,36,116,193,67,224,90,198,11,143,21,140,220,
+201,32,163,154,134,234,112,17,216,24,192,179,32,112,82,44,87,34,70,134,234,188,157,32,202,118,18,21,174,130,131,105,35,49,27,44,45,153,99,138,
+96,172,210,83,71,209,145,255,18,78,15,7,192,111,20,122,142,67,69,156,178,148,153,32,57,60,88,92,12,230,117,184,101,177,106,157,155,16,24,140,
+246,12,244,242,86,182,25,121,227,72,199,148,20,108,32,19,110,30,105,73,246,156,120,91,228,29,255,180,189,127,108,139,79,197,39,38,153,56,249,108,
+56,38,138,198,136,38,113,37,172,98,134,166,225,136,100,222,82,21,221,244,19,98,26,37,151,229,56,81,249,228,114,176,74,32,80,1,22,44,57,40,
+173,254,96,134,60,12,224,118,208,236,207,5,35,85,18,181,67,107,153,33,109,81,28,122,145,68,140,16,98,105,36,222,70,57,102,66,57,58,152,7,
+228,167,4,225,109,136,41,90,2,138,15,51,107,231,250,82,182,8,188,49,79,49,234,164,55,146,86,122,131,118,226,173,99,50,242,173,12,113,244,86,
+171,83,10,30,114,110,16,136,144,199,13,0,129,56,12,18,162,151,120,72,49,34,135,148,106,129,129,84,170,9,67,156,84,72,88,133,248,233,18,52,
+15,57,220,54,119,72,54,12,187,187,36,168,211,0,114,168,44,20,104,98,139,201,65,75,137,144,130,135,222,250,11,80,198,19,217,249,76,104,151,72,
+100,95,32,33,46,104,193,115,33,154,14,149,31,77,133,160,50,230,33,5,172,51,236,188,130,232,156,47,32,196,112,17,163,194,76,1,185,134,136,59,
+133,89,178,225,223,65,69,204,67,134,76,68,164,22,198,106,158,15,147,242,250,217,129,188,245,214,251,172,205,106,185,36,161,134,7,55,183,205,164,224,
+65,153,185,131,232,58,216,117,11,19,211,245,28,91,34,197,195,92,105,216,19,132,57,129,134,158,200,193,14,122,14,200,142,117,116,192,12,126,154,36,
+32,226,2,151,33,46,129,128,7,172,2,19,62,144,116,106,7,106,111,12,201,164,29,113,147,14,152,129,241,144,82,35,78,30,4,116,104,152,96,242,
+111,26,91,212,9,54,146,215,136,205,177,184,37,198,245,89,149,213,144,182,178,134,21,110,107,160,39,235,125,86,174,13,209,130,224,164,118,24,49,178,
+12,179,185,192,17,234,153,39,137,120,234,148,59,194,10,51,249,196,210,106,240,217,19,15,51,186,157,47,143,224,252,128,29,54,226,227,128,252,161,22,
+210,8,15,143,200,194,43,135,157,131,8,57,29,57,245,10,44,225,140,151,20,185,22,247,100,22,92,124,180,23,39,128,140,98,236,36,51,184,92,243,
+121,147,200,13,176,4,44,136,234,234,57,9,147,19,193,110,108,9,76,137,120,22,92,93,68,27,212,14,34,236,161,67,148,8,126,147,111,52,136,104,
+16,227,150,130,128,21,79,48,76,72,98,2,140,159,13,33,34,26,10,14,151,182,167,167,97,65,111,69,66,94,40,244,11,249,5,144,168,64,32,180,
+209,188,30,196,229,163,180,18,244,193,163,71,201,14,94,172,242,104,58,200,82,1,138,14,74,168,171,113,55,190,79,47,179,103,65,188,208,88,118,156,
+230,19,68,249,42,56,138,48,109,233,98,197,36,163,102,129,44,248,66,69,71,15,34,82,58,60,81,85,4,30,189,227,167,200,146,30,191,17,151,144,
+101,75,19,158,110,254,32,97,194,56,94,73,43,216,226,174,245,88,115,245,65,90,151,128,106,65,121,161,115,53,193,72,59,70,218,154,37,249,138,138,
+185,94,58,30,222,217,104,196,79,235,173,205,58,28,181,204,178,179,192,18,147,152,55,133,206,44,179,189,241,26,188,150,164,61,128,174,23,64,68,195,
+119,49,196,23,162,114,122,89,184,88,237,142,10,50,116,67,7,38,150,128,134,62,68,97,67,134,224,248,108,184,2,75,104,113,61,127,7,95,85,25,
+65,218,79,124,214,250,1,115,228,146,219,154,88,1,149,241,37,91,158,119,30,43,1,211,194,61,136,117,169,144,205,105,206,156,88,250,190,40,232,32,
+36,68,195,41,125,14,86,179,163,225,29,155,130,93,86,145,32,51,165,145,45,210,98,225,102,160,25,183,104,254,112,109,11,63,17,240,250,193,173,75,
+91,119,63,57,165,163,134,152,217,228,11,201,134,84,48,90,121,41,24,165,26,155,9,79,19,220,6,217,209,70,98,95,10,12,6,79,21,22,148,112,
+192,21,157,172,4,64,148,101,148,82,167,210,11,177,182,216,240,203,80,130,28,120,130,56,137,121,25,110,43,196,219,61,18,249,33,249,114,23,195,104,
+77,31,192,210,249,94,76,233,12,87,69,168,182,200,115,222,88,88,176,134,139,223,202,118,245,138,179,121,95,13,239,232,161,66,22,55,27,182,224,93,
+6,10,216,185,72,176,144,196,47,244,148,44,151,139,120,164,84,133,201,246,145,1,47,204,99,29,196,216,27,47,33,22,18,1,251,186,101,201,94,129,
+197,103,92,230,161,93,213,33,191,223,29,129,10,249,139,129,149,167,37,44,218,239,48,174,14,70,148,142,193,214,23,30,251,31,76,53,193,149,234,1,
+89,233,6,196,169,64,34,17,236,90,202,238,118,99,85,195,191,156,176,181,20,153,132,250,158,59,103,28,122,100,85,48,218,25,3,42,131,189,136,129,
+104,4,120,16,110,30,167,158,163,214,180,254,79,115,24,75,33,208,82,89,124,150,50,74,58,49,249,216,10,57,208,207,188,142,139,2,109,250,250,167,
+248,156,64,88,244,243,137,42,71,65,12,135,39,170,194,183,113,12,149,76,0,83,166,196,46,65,141,146,96,206,7,4,114,132,114,225,76,77,29,130,
+114,33,240,174,55,206,87,197,178,136,200,182,132,133,50,121,98,208,129,6,11,4,121,217,120,69,175,79,101,174,98,231,15,174,128,203,180,104,124,129,
+224,201,115,126,33,46,36,158,105,121,249,153,98,206,67,18,14,108,32,128,160,156,208,61,14,0,68,243,81,34,202,174,184,223,205,7,42,161,36,40,
+73,162,50,226,165,167,93,11,30,52,82,101,52,44,252,127,95,86,80,135,104,179,210,112,82,155,175,121,155,129,170,74,164,227,51,160,243,102,198,59,
+90,5,232,33,74,99,116,215,226,11,13,26,201,252,3,18,131,0,182,143,100,68,40,209,176,67,214,170,42,78,32,138,49,3,211,50,169,11,174,205,
+140,96,76,253,52,40,32,65,15,44,149,16,128,218,24,5,16,109,229,146,70,198,241,28,75,35,199,222,142,170,63,35,32,67,123,199,66,95,145,64,
+209,183,47,199,68,193,199,83,117,249,6,237,0,165,70,162,63,45,38,164,48,53,9,46,227,6,179,164,204,218,16,22,24,51,214,71,141,51,39,1,
+6,169,50,233,119,120,67,224,25,164,32,142,13,38,154,182,173,12,95,222,241,169,110,165,160,49,158,35,204,66,114,147,201,201,229,37,240,228,203,9,
+187,110,137,139,212,226,95,98,211,50,147,63,130,196,142,116,164,81,100,117,145,101,72,50,61,54,80,130,55,7,37,209,220,29,54,20,211,104,213,174,
+149,2,66,61,32,2,140,193,54,118,30,1,98,151,35,160,146,142,54,208,117,121,202,72,51,107,70,201,25,141,148,82,85,145,82,107,146,190,57,26,
+48,101,133,43,22,201,170,109,161,201,1,70,72,161,104,213,48,19,26,57,226,44,204,10,83,160,193,163,6,184,243,82,196,98,24,129,130,31,19,136,
+163,47,5,13,58,108,149,228,235,221,54,20,238,25,219,243,19,22,247,60,79,71,98,102,111,69,242,4,245,94,163,192,76,76,240,129,98,96,67,36,
+187,175,140,75,126,17,57,211,195,220,171,128,106,41,154,38,5,243,124,192,152,113,46,27,88,192,6,54,32,242,150,173,12,35,41,1,2,188,66,137,
+34,120,219,162,162,76,195,36,192,172,128,133,112,17,219,39,108,145,17,70,5,180,231,23,21,4,150,166,57,42,116,65,140,131,52,124,51,36,238,244,
+146,164,141,33,32,226,237,209,66,96,3,27,27,130,203,158,0,77,131,109,11,128,0,140,5,82,185,169,229,70,107,111,21,134,2,0,179,203,124,116,
+137,183,194,29,193,52,157,58,209,30,59,6,73,33,2,170,113,63,85,216,202,135,232,254,117,61,254,251,32,203,125,206,116,94,17,192,52,81,153,243,
+143,169,240,102,105,50,106,207,51,131,34,153,138,19,3,220,163,166,142,231,240,145,17,177,253,167,7,52,14,4,134,26,86,207,24,228,48,136,88,98,
+36,22,132,128,93,26,56,1,0,227,199,3,100,22,5,50,44,14,146,149,177,164,103,212,21,124,108,120,128,173,69,62,141,10,84,125,68,170,217,69,
+227,164,164,230,142,157,48,68,253,165,237,243,88,49,145,3,232,241,141,89,128,89,71,156,171,16,76,42,203,14,70,145,24,18,2,90,96,113,84,230,
+229,38,51,245,69,224,154,197,186,206,111,91,22,12,60,248,158,19,118,22,16,197,109,178,123,214,123,191,75,179,67,117,170,168,199,114,93,231,132,8,
+145,240,116,242,27,50,204,227,64,142,213,139,178,151,126,92,170,177,88,44,105,88,33,90,30,56,100,184,193,14,116,201,114,184,227,207,79,183,188,149,
+80,29,152,156,215,11,164,75,18,163,69,185,64,161,20,9,157,38,61,158,234,86,132,101,80,66,98,36,212,84,66,185,202,94,149,76,89,234,217,225,
+217,213,218,78,183,113,46,21,80,193,51,20,161,143,10,10,94,119,166,207,138,150,107,155,218,7,110,88,249,213,208,219,60,65,24,114,214,216,153,201,
+17,40,5,193,228,23,194,176,44,24,148,126,58,108,235,164,211,181,12,212,69,174,138,163,136,86,85,224,247,233,17,115,252,255,43,98,189,127,121,225,
+33,126,3,205,82,101,151,45,53,8,135,43,63,198,105,111,194,19,133,140,131,169,116,173,74,69,217,24,67,67,205,134,160,157,124,116,139,40,77,191,
+69,3,90,57,208,1,56,253,20,56,7,128,46,247,15,82,166,68,238,35,31,193,12,177,129,152,132,181,80,0,88,132,1,97,107,5,171,38,73,255,
+13,149,145,138,142,187,32,210,4,57,131,3,67,49,156,14,148,36,99,213,19,177,141,161,91,182,54,177,24,104,10,245,75,217,17,14,193,92,141,32,
+112,65,81,168,126,168,185,161,145,237,39,170,83,160,132,48,205,0,2,229,21,2,122,153,245,168,105,134,97,86,6,129,62,57,175,204,234,122,48,248,
+172,228,182,163,55,142,200,110,53,15,153,136,16,140,92,60,217,160,156,238,187,11,143,109,53,192,231,46,84,194,56,210,217,33,10,0,242,193,233,197,
+42,0,84,80,131,20,48,197,36,227,123,174,69,52,243,24,25,32,10,159,130,130,81,11,23,140,147,64,36,156,36,187,99,98,12,140,176,218,178,112,
+56,169,115,128,49,187,4,241,98,140,24,94,56,96,211,102,235,128,196,196,42,133,102,47,92,246,92,68,150,22,112,128,149,230,82,64,87,203,75,130,
+124,75,19,174,171,12,16,65,10,122,225,48,107,144,78,194,74,228,154,137,108,34,191,156,210,154,80,24,27,19,129,17,152,124,62,190,240,14,86,222,
+199,213,245,172,165,180,89,236,38,155,224,178,82,207,130,19,22,66,22,132,176,42,29,110,107,30,144,188,203,187,140,94,74,188,104,132,52,76,181,54,
+139,214,219,26,135,97,43,9,45,31,18,209,253,97,56,211,15,39,213,2,8,162,10,108,52,164,153,73,7,40,99,52,249,163,88,146,190,139,228,104,
+153,10,34,158,41,125,126,73,213,156,14,194,117,104,65,137,43,58,89,35,73,192,186,42,231,138,197,132,92,190,159,199,112,51,184,200,76,25,190,27,
+50,28,145,51,182,80,107,198,60,21,66,119,24,254,6,145,70,181,6,51,15,32,101,219,34,196,108,48,98,42,7,139,85,66,249,50,21,240,59,41,
+18,112,198,181,249,170,62,118,103,200,250,62,1,148,118,139,132,225,183,92,214,48,41,17,107,9,112,240,198,239,204,140,63,99,31,28,252,48,3,243,
+28,142,17,154,65,80,184,136,25,92,81,182,113,9,173,211,76,35,137,42,115,5,58,156,152,4,83,155,60,35,136,214,243,208,14,203,160,58,86,24,
+180,122,16,113,143,172,208,218,105,112,134,173,78,88,110,243,0,96,197,211,65,131,8,36,184,70,11,200,162,18,4,177,128,139,181,245,83,149,106,109,
+168,72,154,88,50,70,25,168,64,131,0,228,248,162,55,165,33,6,158,177,108,133,147,8,16,178,26,154,71,13,211,220,21,159,206,47,171,209,7,155,
+125,14,241,119,15,201,7,200,207,44,129,103,133,241,252,30,140,118,90,19,9,232,163,189,215,16,5,212,214,70,121,235,112,48,179,99,68,197,179,28,
+59,54,160,24,18,3,235,119,138,237,227,128,53,160,54,89,140,48,56,17,147,145,229,132,2,0,107,3,12,40,248,196,7,193,152,208,99,81,224,135,
+223,202,33,132,67,70,163,93,161,75,24,37,172,17,150,49,5,197,129,107,120,93,156,128,185,48,238,7,153,24,32,32,234,145,92,20,12,41,68,206,
+68,44,33,30,159,13,10,190,242,252,85,116,45,94,90,108,34,0,175,230,35,236,39,194,182,153,37,136,196,166,40,28,36,206,65,9,16,194,139,192,
+58,187,132,36,164,171,168,57,101,100,74,15,14,5,223,47,231,119,166,180,191,144,67,203,120,109,197,39,178,230,124,3,20,34,153,193,187,69,55,14,
+0,103,47,100,5,170,50,32,77,170,30,128,154,176,19,87,116,2,65,12,58,102,218,174,56,58,119,83,111,140,23,90,148,149,132,169,163,42,24,39,
+55,105,14,125,17,163,44,207,15,2,96,177,156,95,96,246,189,146,10,27,8,87,137,68,34,36,22,4,11,98,76,226,217,68,73,149,164,93,133,24,
+209,93,115,25,210,143,2,154,192,198,77,73,171,27,68,79,14,7,146,147,223,246,81,239,207,62,189,204,100,231,11,31,14,166,185,92,139,133,15,98,
+25,109,242,202,160,215,225,18,177,59,32,170,86,79,81,135,128,71,167,230,245,63,111,217,56,130,222,121,11,110,194,115,112,9,106,139,15,47,85,50,
+24,157,250,18,177,44,136,208,201,202,76,92,151,44,104,32,84,101,132,10,90,215,24,9,121,131,32,157,2,43,47,134,71,14,66,41,220,77,112,99,
+225,74,65,90,213,28,129,111,69,39,117,58,52,192,178,162,157,37,2,84,253,21,171,193,64,142,145,195,93,204,65,175,93,68,183,39,136,8,244,43,
+6,45,2,189,128,81,18,255,158,207,192,212,16,155,176,179,100,17,24,210,194,14,103,245,5,92,146,48,84,50,82,12,133,97,242,195,98,213,14,78,
+65,209,54,232,17,3,46,6,114,142,56,52,154,70,86,55,6,219,163,131,135,252,94,244,211,230,217,78,251,54,59,57,209,105,157,2,70,41,53,171,
+209,139,104,225,177,161,78,179,105,75,3,160,165,54,250,246,224,105,242,7,204,208,6,167,64,152,80,68,148,49,202,38,78,70,83,132,148,46,212,18,
+129,200,194,166,38,8,208,106,221,149,73,53,135,141,158,141,144,143,39,4,24,92,90,164,66,16,149,172,183,115,148,109,67,51,144,110,69,225,53,238,
+176,113,20,18,39,77,9,96,214,97,137,179,9,35,233,174,193,18,28,138,60,161,182,134,8,149,45,18,249,132,12,43,98,145,212,228,216,26,126,232,
+26,22,75,68,229,50,235,145,35,44,161,136,151,138,96,17,203,152,198,112,180,60,222,255,19,51,73,227,156,102,59,46,195,33,124,57,10,199,47,95,
+51,202,177,81,19,19,4,214,148,139,36,42,214,22,197,186,112,8,249,215,67,99,102,133,33,21,47,124,25,234,71,74,225,109,161,72,36,0,173,237,
+129,112,225,204,30,201,225,3,64,156,88,158,13,213,244,172,137,104,42,187,10,121,64,208,231,250,239,153,225,138,17,74,182,17,196,42,179,142,138,71,
+158,23,18,218,48,189,58,192,50,139,85,199,39,119,198,114,160,98,29,162,77,62,134,10,24,125,223,77,228,236,153,41,43,97,195,220,67,152,130,23,
+3,84,205,233,72,68,85,236,165,30,139,40,0,172,101,254,8,68,73,180,138,128,199,218,228,117,60,78,199,49,73,109,201,119,72,188,103,116,84,33,
+66,46,207,198,162,153,147,20,237,185,71,36,192,149,126,184,9,209,193,131,164,165,214,66,203,180,172,233,251,44,154,195,69,209,146,196,66,165,34,193,
+117,220,241,50,104,9,25,23,23,146,90,148,0,192,0,158,15,110,61,98,73,185,196,32,64,47,149,245,157,216,228,135,3,19,42,217,89,66,7,80,
+15,6,20,104,146,77,141,201,168,4,64,225,121,41,180,112,130,230,240,87,245,19,35,211,34,6,13,220,160,87,98,106,38,106,119,17,239,223,11,104,
+69,75,1,175,115,18,230,104,147,161,100,138,158,202,222,65,20,73,103,152,88,132,131,231,120,186,255,71,149,194,78,26,232,58,237,102,251,65,0,146,
+104,223,7,92,47,35,59,85,119,6,124,72,147,174,86,64,135,26,160,4,26,105,236,158,202,166,14,114,83,193,243,134,103,90,75,88,168,24,120,115,
+113,118,146,226,84,35,6,153,34,89,220,1,151,104,162,177,98,53,23,100,95,18,201,239,16,227,239,26,49,35,106,139,81,98,230,66,43,55,0,192,
+216,209,232,89,7,116,189,233,72,196,40,196,79,63,149,61,148,191,107,203,93,216,170,168,195,215,51,79,4,114,118,81,248,123,106,118,120,41,90,253,
+100,234,129,16,241,70,199,223,67,157,88,20,204,246,111,80,2,245,98,133,248,78,30,50,219,2,54,123,18,11,141,244,59,20,120,197,90,141,55,9,
+205,115,26,12,174,209,229,28,220,53,57,26,148,42,79,130,163,32,158,70,18,26,38,134,24,107,1,102,66,135,184,173,40,64,249,217,162,237,79,2,
+20,96,211,53,64,128,165,30,216,120,193,70,82,2,115,28,221,172,192,148,224,2,66,101,109,132,23,16,226,165,98,129,115,230,242,6,241,252,133,56,
+213,132,209,207,90,188,8,92,32,54,252,5,155,246,78,48,56,37,169,71,26,6,61,17,213,109,15,167,148,15,137,233,45,221,195,60,208,230,38,94,
+204,11,159,234,61,108,150,162,133,45,82,181,109,16,192,34,86,229,50,167,106,23,27,151,146,8,89,200,33,143,241,122,223,171,15,24,24,231,201,98,
+53,156,55,33,88,117,46,187,11,74,249,237,154,75,27,58,202,56,49,196,47,114,147,165,206,26,47,87,164,26,172,80,50,232,152,81,196,1,131,13,
+162,216,149,199,27,58,137,198,255,101,10,61,113,5,38,34,115,80,164,75,0,63,133,225,143,189,20,209,252,82,204,141,128,153,216,163,146,52,213,225,
+91,21,36,44,28,114,121,112,177,132,9,139,38,177,149,201,126,187,169,56,208,123,137,144,140,153,156,89,50,90,235,110,225,65,243,56,12,105,72,67,
+46,199,24,82,28,64,32,225,149,53,33,52,141,73,103,80,176,64,206,140,35,27,168,147,64,92,137,194,212,187,239,99,25,67,236,124,236,80,43,107,
+238,123,150,204,101,57,204,201,13,144,68,87,11,45,51,118,132,131,60,58,73,121,72,84,103,142,64,144,98,248,81,80,9,0,57,64,4,57,36,133,
+204,131,4,33,18,236,141,112,1,197,89,145,202,76,149,134,54,53,192,149,166,31,180,37,14,144,196,125,82,210,173,1,25,77,47,60,46,21,115,122,
+233,115,36,23,26,196,230,23,151,18,80,226,55,55,1,165,201,201,15,38,108,4,115,122,28,33,140,156,240,176,65,8,206,115,58,33,74,65,30,204,
+235,160,80,170,51,15,142,192,171,219,71,193,205,67,92,158,130,96,206,132,63,61,111,119,125,17,27,71,199,104,91,30,118,61,135,51,213,209,247,35,
+178,215,145,94,91,33,211,106,165,141,1,109,107,57,110,204,228,138,190,14,73,101,189,139,232,76,10,93,34,251,114,205,143,15,62,168,19,113,71,28,
+64,131,92,34,159,17,86,248,122,83,84,20,44,150,155,146,97,74,34,81,106,41,16,182,209,116,123,235,147,175,147,97,102,156,69,162,22,134,88,155,
+56,73,17,107,3,160,58,124,80,182,211,29,142,152,3,210,139,134,224,249,141,123,99,128,8,141,149,220,97,199,36,14,12,75,13,62,154,66,183,15,
+207,82,131,48,164,202,96,193,104,229,11,47,43,53,42,167,130,161,151,148,188,103,74,146,121,157,12,164,135,35,211,69,155,92,23,153,245,88,153,59,
+223,55,239,246,2,79,249,235,76,7,142,232,180,202,73,80,35,155,158,175,91,126,4,43,56,182,168,25,145,2,61,75,200,16,236,16,25,54,226,44,
+225,96,6,141,90,227,167,199,199,3,122,41,110,178,166,78,162,91,107,154,169,69,0,9,250,89,74,12,136,65,0,65,171,144,78,136,27,146,57,77,
+94,225,173,88,106,197,215,102,238,47,194,211,2,163,136,44,252,251,168,204,76,16,225,143,194,197,23,30,41,120,165,67,43,103,3,171,60,20,20,214,
+133,51,195,70,82,128,68,164,98,177,41,19,86,227,169,224,94,67,9,177,226,52,247,203,72,188,46,127,45,167,24,224,50,182,138,210,37,24,65,221,
+255,131,222,205,200,202,117,145,25,239,109,9,233,174,174,88,88,92,196,67,224,78,192,99,226,64,11,161,44,42,165,46,50,188,205,2,179,44,153,200,
+70,194,55,68,153,57,151,204,225,170,76,71,25,147,218,122,95,33,18,222,1,37,93,80,72,16,176,194,217,154,97,18,169,235,192,109,72,44,111,0,
+124,41,0,162,231,43,75,223,77,154,49,26,74,17,248,32,5,6,153,76,166,177,124,236,225,42,181,88,110,215,60,42,141,100,118,46,9,68,140,164,
+8,167,11,72,194,25,42,12,56,176,165,72,1,78,200,210,214,178,80,153,26,128,137,204,54,157,174,129,95,88,29,249,71,82,241,72,73,43,141,169,
+238,255,7,176,187,174,223,107,184,239,88,187,128,121,40,196,121,38,119,177,145,245,168,73,163,87,31,73,126,70,0,219,245,73,32,220,7,54,1,49,
+40,145,10,156,81,135,148,29,131,184,90,85,160,145,235,132,85,230,26,151,32,92,124,244,170,89,194,36,139,167,124,130,60,96,180,72,15,193,146,180,
+179,80,4,40,113,146,154,186,7,148,232,227,30,105,218,93,68,167,48,136,156,127,41,103,34,216,57,22,5,203,169,172,98,24,140,11,138,77,76,132,
+115,180,112,68,36,199,200,55,131,56,178,6,137,137,85,8,214,32,189,144,88,140,128,48,33,197,224,177,238,134,21,6,72,145,150,185,124,47,185,195,
+174,112,35,240,152,196,95,25,192,54,108,30,23,9,7,114,156,81,91,119,42,231,43,216,129,79,39,146,90,10,69,225,230,234,100,133,3,141,112,41,
+75,195,165,206,0,4,8,145,137,123,107,56,5,198,211,140,144,163,48,113,201,38,69,95,206,23,32,97,218,54,205,10,187,138,106,132,81,98,103,135,
+159,146,10,172,0,148,64,176,56,36,14,71,176,177,200,70,133,168,111,91,124,30,222,88,90,104,120,26,132,217,189,246,166,73,52,58,28,194,184,120,
+128,36,202,155,89,106,241,96,3,45,193,100,35,82,129,188,169,103,140,41,179,204,66,182,38,25,84,8,217,225,112,161,91,236,123,94,70,207,17,130,
+132,220,122,78,97,207,229,34,239,36,96,95,46,240,179,14,192,218,181,16,69,233,12,215,179,1,28,136,61,179,230,145,193,184,34,60,100,28,112,101,
+35,1,30,21,103,166,75,19,12,92,105,160,16,147,116,147,35,3,151,134,9,90,176,36,176,58,20,251,101,43,192,141,56,73,156,31,65,194,162,83,
+0,250,117,15,65,194,151,5,24,81,233,97,134,204,61,96,153,28,86,103,113,151,52,209,170,188,246,165,16,33,200,192,44,71,130,139,197,230,18,51,
+46,145,156,112,61,254,128,70,22,65,70,127,172,230,240,209,87,49,188,214,118,48,243,177,103,131,26,151,178,155,150,23,10,107,17,244,187,175,197,249,
+177,103,131,114,25,78,178,131,205,107,11,5,140,59,65,185,133,60,78,100,216,215,122,158,58,133,233,106,217,224,211,232,5,20,0,94,51,18,239,186,
+165,110,121,24,42,165,234,218,216,65,86,148,73,35,120,148,88,97,160,221,25,87,18,241,209,114,225,36,38,228,26,163,162,174,248,223,97,141,66,64,
+1,69,152,254,99,54,88,64,34,1,6,161,103,162,151,7,16,180,179,210,73,148,172,77,114,38,128,165,43,249,101,151,169,161,165,236,163,65,56,39,
+43,76,249,124,123,165,19,114,252,246,253,227,234,80,87,13,102,101,147,176,88,189,109,179,28,47,29,102,89,18,84,119,89,124,196,136,171,159,11,208,
+225,205,26,194,114,22,153,239,138,207,12,49,4,168,92,253,46,115,155,141,204,103,113,233,42,172,205,133,156,222,174,136,135,51,125,187,164,108,244,250,
+129,172,34,208,11,8,104,1,243,3,16,89,223,31,155,224,33,106,242,18,44,14,65,183,154,98,206,136,58,18,205,13,209,244,26,245,8,13,151,103,
+25,21,192,213,50,131,111,25,9,110,9,208,38,161,243,22,52,185,161,76,192,34,26,124,185,200,41,117,238,152,109,104,36,167,214,186,92,196,128,248,
+197,163,99,135,231,249,4,250,125,148,91,86,77,168,69,208,31,50,8,80,82,202,10,155,112,46,12,94,105,222,151,17,3,20,226,118,29,231,79,220,
+230,88,175,142,250,172,213,15,236,186,10,37,164,243,68,108,71,139,135,106,141,248,202,181,201,205,169,5,8,205,219,108,94,152,53,169,106,141,239,28,
+239,11,108,226,212,254,163,161,239,50,102,152,19,58,4,46,67,83,52,28,59,105,116,59,236,254,47,206,115,57,69,165,216,10,59,89,147,138,169,198,
+22,195,163,201,43,191,224,155,211,184,104,149,74,6,16,101,11,203,73,188,146,226,226,184,15,47,190,173,20,25,40,137,74,152,152,195,1,195,41,1,
+85,14,0,176,48,213,148,117,180,78,22,158,211,223,8,14,133,9,137,168,241,50,68,195,131,22,57,85,205,48,53,98,73,11,66,170,203,198,227,113,
+63,159,97,170,186,197,101,184,15,134,166,140,108,96,41,52,175,83,154,189,118,140,217,18,40,212,72,132,52,221,209,138,216,126,25,221,125,146,16,224,
+136,145,138,137,21,37,86,225,64,241,230,199,184,158,194,138,112,20,122,67,103,90,227,33,212,146,100,89,90,252,53,11,96,81,99,34,12,211,230,160,
+95,231,182,176,143,176,47,37,177,246,67,80,169,158,85,171,33,230,60,44,4,37,88,55,64,214,210,237,178,97,102,29,141,112,92,120,225,102,133,52,
+62,85,113,176,176,151,230,31,41,133,113,49,153,158,74,72,140,20,56,156,17,27,154,161,44,201,138,6,33,82,24,142,199,89,228,253,46,85,92,23,
+0,51,192,125,115,205,229,145,194,135,146,233,109,148,211,179,114,68,44,155,121,74,48,99,0,160,5,30,101,148,85,59,167,162,19,45,75,148,215,239,
+53,165,174,31,195,230,171,209,223,16,157,42,232,81,122,44,110,18,68,18,170,53,20,149,36,2,146,80,45,116,11,153,228,153,218,67,208,106,155,137,
+120,93,12,213,206,66,76,176,114,166,133,176,26,214,112,220,57,72,68,49,49,150,113,193,22,128,18,118,146,94,175,212,111,64,68,5,51,40,221,90,
+192,202,149,177,36,138,125,180,50,120,216,200,9,150,122,172,121,233,234,240,141,147,49,115,136,233,102,52,153,91,61,190,183,79,181,224,178,67,63,132,
+89,176,230,44,147,50,179,140,196,203,70,206,183,58,92,183,3,113,118,161,26,22,13,36,96,39,211,16,88,236,218,71,39,6,76,110,224,159,13,46,
+32,160,169,146,151,65,108,72,82,80,132,65,154,128,236,248,40,160,19,111,10,96,245,131,41,208,201,52,137,67,8,13,105,55,1,216,150,154,223,238,
+150,202,207,17,58,137,188,242,247,236,36,9,187,20,89,173,84,77,109,1,69,232,208,42,111,51,12,144,50,48,200,3,38,157,144,42,213,131,96,239,
+213,209,55,52,150,8,124,25,42,103,167,197,172,100,236,145,230,35,134,64,172,99,4,143,3,187,230,107,114,172,188,20,231,101,192,108,57,167,132,21,
+36,137,173,130,11,129,62,27,58,243,3,60,150,101,56,233,39,33,140,198,53,8,184,124,77,85,12,14,153,251,147,49,81,27,61,0,156,46,80,220,
+57,168,35,239,77,6,199,76,195,216,26,211,172,184,111,115,68,209,218,118,73,131,226,120,138,82,98,134,130,124,46,118,104,88,50,225,160,133,233,247,
+67,42,196,212,37,54,144,196,11,160,115,228,149,35,0,225,45,26,2,57,172,169,21,130,138,133,184,143,115,113,14,136,195,52,69,71,202,51,70,2,
+88,22,54,42,147,22,160,194,116,7,133,137,36,132,188,198,45,83,168,122,122,255,169,143,165,146,212,109,184,14,43,136,201,116,151,104,0,25,60,135,
+46,65,170,18,179,160,217,169,68,43,23,48,56,120,225,108,2,68,219,95,132,128,118,34,0,253,43,34,117,79,214,203,3,22,222,55,226,60,89,12,
+54,46,64,216,43,170,119,179,202,93,31,122,137,20,153,140,5,28,221,192,135,34,22,53,71,36,76,186,34,78,207,206,81,116,115,152,174,134,201,68,
+89,195,151,58,130,155,57,34,6,67,171,52,4,2,243,114,129,92,128,32,72,152,33,4,148,39,67,49,115,80,8,124,20,9,82,194,210,15,6,0,
+169,55,6,23,134,59,48,102,118,49,168,165,74,194,179,243,251,127,55,36,250,219,178,209,87,122,46,209,44,242,136,85,166,175,102,41,93,165,155,134,
+71,145,44,172,17,22,207,86,8,110,51,65,167,124,37,212,123,216,168,203,176,202,7,149,119,134,9,98,106,162,125,163,43,54,198,141,131,2,153,148,
+57,179,139,136,189,2,210,22,210,84,25,228,99,30,70,181,226,40,221,176,90,10,112,28,123,132,216,187,230,23,240,143,80,60,139,39,72,109,42,213,
+192,197,57,59,49,10,17,148,202,125,5,10,20,143,34,73,50,147,93,5,62,57,115,34,229,171,111,4,200,178,61,6,21,225,248,123,130,219,92,243,
+50,167,9,139,24,228,47,75,244,114,172,98,36,188,247,146,190,231,188,36,125,131,167,106,225,203,61,114,253,202,19,114,105,28,163,30,194,76,228,35,
+113,177,208,108,31,217,39,103,85,135,148,14,228,160,192,71,198,36,135,144,69,14,82,17,187,25,192,115,170,14,3,9,2,240,81,209,2,14,128,16,
+90,118,66,19,59,32,168,121,228,117,121,10,252,36,184,1,195,175,169,69,158,171,130,162,200,197,97,113,140,48,99,9,158,117,46,94,58,100,128,99,
+52,137,227,224,134,179,164,39,27,85,185,233,145,239,252,99,250,88,199,131,79,138,41,200,247,4,116,115,74,162,209,150,57,136,225,206,78,81,145,203,
+253,45,187,147,187,46,18,43,248,107,165,159,28,30,206,208,141,185,244,179,174,37,236,207,176,151,171,108,146,60,69,70,13,126,243,75,128,114,126,40,
+59,130,117,113,71,30,190,191,174,0,86,94,42,10,4,149,70,142,33,246,207,207,118,234,167,21,187,24,64,25,89,68,175,198,226,42,202,198,15,82,
+249,99,122,28,68,172,36,13,4,217,21,133,143,35,104,139,135,236,180,165,33,157,192,195,56,179,54,35,45,35,34,72,189,52,74,186,160,25,120,168,
+133,107,91,55,37,24,69,168,246,148,9,233,247,28,127,32,206,166,193,250,121,101,241,53,206,196,148,38,37,49,36,49,57,31,19,227,80,162,229,141,
+254,3,180,176,241,215,73,74,20,53,106,10,69,43,16,89,82,240,82,183,177,132,208,83,168,103,44,74,30,33,12,93,160,201,121,69,219,30,139,106,
+7,1,2,84,114,252,151,23,117,77,205,230,12,53,24,20,64,87,241,69,233,114,217,124,82,24,121,166,41,97,148,148,60,188,131,35,228,228,29,183,
+44,48,35,12,30,50,67,135,200,67,150,72,12,216,180,205,230,242,147,163,15,27,64,173,170,227,145,49,12,66,230,31,176,220,130,172,137,98,208,20,
+21,10,126,162,174,86,241,120,70,133,72,192,66,148,141,112,138,110,137,28,137,198,196,198,156,123,115,242,255,43,154,30,195,160,227,182,29,199,136,182,
+183,202,2,204,222,107,72,158,181,143,97,74,205,150,53,228,108,196,168,51,140,74,86,93,188,8,26,78,120,113,176,131,192,58,21,95,32,42,166,186,
+54,24,89,147,128,6,180,20,22,183,57,208,232,23,193,218,31,114,243,39,178,122,12,210,48,47,3,57,120,50,254,121,116,72,145,71,210,18,52,33,
+40,136,73,86,133,15,134,159,166,153,48,16,184,67,33,37,34,75,192,229,24,149,26,49,49,246,52,206,210,195,14,129,40,56,25,101,136,100,117,198,
+184,222,59,22,248,200,99,100,80,16,18,132,220,240,42,87,113,190,55,224,78,224,12,103,60,133,247,228,170,15,92,24,25,106,166,82,166,189,57,97,
+222,167,88,155,135,52,242,133,28,229,94,11,3,96,4,90,147,203,34,75,206,43,41,57,192,230,16,103,102,139,41,82,130,64,253,238,162,45,67,73,
+186,204,89,186,69,241,56,38,98,229,110,145,204,236,167,217,186,44,209,75,119,145,118,192,240,224,240,0,39,65,64,4,0,20,1,225,213,235,37,15,
+167,15,59,76,60,141,46,40,156,252,66,137,210,53,71,216,134,146,185,117,49,173,136,0,81,229,10,193,203,207,75,65,188,135,112,65,185,228,138,233,
+245,211,165,134,207,219,62,179,153,95,212,254,52,16,172,23,61,121,228,188,84,38,227,57,123,3,170,225,225,176,228,202,204,167,50,114,47,3,152,159,
+110,176,89,176,98,235,153,185,168,9,139,210,97,204,87,57,12,149,194,167,36,224,42,101,134,92,208,55,192,61,0,40,153,99,36,218,84,152,120,156,
+4,44,144,55,237,133,6,86,159,125,135,48,44,208,130,2,231,72,114,222,207,53,5,161,184,12,132,97,67,160,163,163,210,192,35,50,190,41,216,24,
+98,48,230,122,46,140,211,67,135,50,36,242,195,110,106,17,141,142,200,226,154,134,36,129,9,88,131,193,96,211,242,25,25,28,3,18,49,10,233,105,
+135,57,244,174,127,103,161,240,150,73,189,55,198,111,54,84,192,162,166,211,95,176,143,224,117,91,49,180,54,147,183,174,10,25,50,206,137,219,232,213,
+213,91,52,205,37,180,231,178,212,172,104,137,143,104,70,102,178,149,228,39,7,227,176,228,97,12,195,172,84,253,72,128,71,10,152,54,5,64,185,52,
+210,192,170,207,84,21,82,12,48,235,222,147,11,7,138,181,203,95,138,196,81,136,130,143,34,169,221,38,44,205,134,23,142,227,236,13,105,113,65,71,
+143,28,114,197,196,67,245,35,36,155,176,204,224,27,70,138,132,78,150,56,129,55,89,153,200,43,17,207,163,81,27,134,119,205,251,158,69,58,25,47,
+130,208,116,221,135,138,104,121,229,204,86,92,153,107,244,168,229,96,176,169,41,231,161,208,174,147,170,135,17,37,18,33,128,211,96,24,43,15,93,187,
+221,43,149,69,85,107,77,34,182,209,75,28,99,26,21,26,45,220,254,192,141,172,144,8,87,1,82,33,141,144,81,111,20,41,206,227,50,201,26,38,
+155,29,18,50,39,208,215,13,79,5,143,211,60,227,78,78,66,178,153,27,49,50,42,2,116,117,197,9,21,135,154,165,164,102,190,123,7,16,106,109,
+147,36,105,151,197,91,199,60,34,237,20,129,245,175,5,223,196,97,40,230,102,25,239,242,191,163,54,182,243,231,174,184,238,235,182,148,100,154,21,56,
+235,84,26,209,104,70,80,165,102,40,178,113,228,198,197,12,169,80,170,18,125,61,132,8,37,80,114,209,239,23,70,142,56,206,57,137,152,100,178,81,
+178,252,52,249,240,108,138,208,174,142,179,9,84,236,113,235,154,234,56,72,8,22,243,3,199,195,19,137,36,225,232,104,172,170,105,193,141,76,44,155,
+96,145,42,181,49,3,47,238,5,224,113,16,34,159,21,141,100,160,185,179,65,228,224,19,84,205,11,147,53,170,153,165,172,74,96,0,8,135,102,248,
+47,19,134,128,143,74,50,114,6,190,175,87,240,57,149,146,92,7,182,231,45,60,69,181,244,169,160,59,158,3,191,74,10,68,83,59,208,108,132,106,
+120,206,174,170,179,11,166,210,190,62,34,81,200,119,206,90,172,166,161,11,125,39,152,251,233,58,106,217,102,81,164,214,26,23,18,46,40,246,5,145,
+106,157,5,27,252,80,55,229,4,153,8,14,114,125,65,232,57,232,83,69,157,140,28,92,64,33,193,138,220,59,205,249,239,95,193,66,187,164,175,51,
+84,49,250,86,134,26,158,64,246,186,76,182,23,48,78,36,48,224,104,143,49,78,225,52,44,80,19,172,182,62,227,26,254,8,81,39,105,5,39,15,
+155,235,124,238,92,197,150,195,211,114,216,143,1,73,32,56,129,27,117,35,53,176,88,19,212,178,112,205,65,79,195,14,139,104,242,116,37,198,13,35,
+33,104,172,241,153,155,128,81,52,3,217,186,54,93,36,94,1,137,155,13,12,144,193,87,113,136,48,53,194,169,86,64,39,38,8,76,1,238,87,17,
+57,202,225,17,57,2,41,97,18,170,153,139,2,193,123,62,3,95,188,167,171,231,51,169,109,37,207,217,83,135,68,1,118,95,68,181,59,132,161,19,
+22,153,39,12,149,173,101,105,30,11,30,79,69,189,154,150,218,212,67,19,99,3,57,85,141,29,136,202,150,130,129,185,248,222,246,190,2,234,123,158,
+244,92,230,171,21,101,35,47,152,143,220,236,181,60,29,149,41,208,115,97,141,74,154,58,39,41,196,228,141,110,248,169,216,100,164,204,49,120,194,108,
+210,67,50,90,62,106,174,159,9,67,172,227,109,157,91,162,36,198,50,84,105,164,197,206,129,64,9,214,20,230,66,197,44,1,81,102,211,23,124,156,
+17,75,189,17,236,120,130,141,129,29,22,130,10,4,170,172,45,128,8,208,133,132,172,74,8,128,130,231,85,16,14,57,107,7,164,131,81,214,17,2,
+69,210,179,242,67,210,200,78,162,128,5,137,178,168,225,116,76,208,170,141,175,233,254,86,52,53,103,37,134,251,205,101,7,142,149,130,25,34,172,43,
+214,168,100,225,75,95,156,97,198,244,88,248,93,5,138,165,212,48,7,17,219,107,196,116,221,29,80,105,55,135,225,23,70,147,72,60,203,225,85,111,
+12,34,147,88,1,188,197,201,140,38,148,84,176,244,164,32,143,201,229,160,239,247,89,23,193,42,240,0,227,225,139,157,140,94,149,225,12,30,10,82,
+237,227,240,113,81,160,151,101,112,69,50,176,145,145,43,139,87,213,19,131,198,96,85,73,228,163,196,152,11,149,204,66,97,101,19,132,166,192,178,37,
+35,52,80,58,202,216,32,128,64,192,173,252,31,221,134,152,197,106,185,239,121,205,64,123,108,9,19,131,225,105,204,183,106,2,204,138,204,250,225,18,
+54,20,32,230,154,145,104,68,72,163,198,212,23,83,40,26,69,2,161,107,7,155,33,103,136,42,132,82,122,44,30,251,183,172,207,116,114,129,200,155,
+96,201,232,183,192,211,166,17,43,44,110,150,2,26,204,225,25,35,238,235,164,207,68,201,20,58,73,211,179,163,9,144,56,172,232,48,71,154,95,196,
+40,38,67,35,170,79,15,24,212,83,167,38,160,215,14,82,152,152,182,141,80,38,127,21,83,152,173,138,115,92,222,4,211,47,131,234,250,27,56,173,
+215,69,158,241,159,41,72,50,144,44,26,214,165,56,243,73,185,184,135,225,98,106,56,88,72,106,90,11,86,142,153,182,90,6,66,164,229,246,101,117,
+5,249,232,197,213,242,253,98,158,39,61,5,205,230,148,177,164,165,120,90,118,72,100,251,194,82,176,196,211,37,121,3,37,115,152,200,180,72,126,213,
+70,179,98,94,192,29,222,17,54,68,100,145,130,101,97,165,73,160,68,205,142,59,107,125,2,64,197,46,72,248,145,178,52,7,170,211,46,46,93,93,
+146,154,61,214,108,21,246,37,69,20,235,200,55,74,165,228,158,138,76,56,29,222,255,225,244,32,92,249,14,179,57,235,188,81,110,49,200,214,88,113,
+157,14,67,82,164,186,22,38,50,235,177,26,52,118,141,193,154,106,248,112,88,218,2,17,243,70,238,251,77,60,63,28,30,108,110,42,110,47,9,74,
+6,98,77,80,252,159,37,2,102,51,137,222,58,231,119,215,163,166,133,147,147,213,94,186,48,142,52,35,0,170,195,170,38,21,99,182,74,78,200,34,
+135,112,173,12,132,125,198,37,161,42,219,1,172,199,182,130,194,144,199,103,91,49,9,81,10,245,166,75,58,16,176,7,47,129,7,105,131,184,82,114,
+82,253,110,25,5,8,232,76,185,45,47,233,241,160,157,94,126,99,52,151,138,243,217,134,46,149,68,167,155,147,3,39,54,25,170,240,200,95,97,195,
+200,12,106,13,0,0,3,79,224,172,234,144,210,164,193,95,186,0,53,17,116,192,5,202,100,80,50,137,76,132,162,52,1,135,159,80,226,254,41,101,
+77,84,107,229,216,56,167,145,238,154,192,221,57,131,84,138,158,201,141,30,72,157,174,138,157,145,181,131,192,137,8,169,185,52,197,69,74,195,75,106,
+120,239,15,182,49,193,245,220,124,195,40,177,114,196,223,196,31,24,132,194,72,178,74,26,199,25,58,216,252,34,186,62,75,58,235,15,237,245,61,233,
+44,103,17,196,118,92,215,164,209,87,186,170,224,68,198,122,56,195,189,158,219,129,47,97,161,174,192,205,25,139,150,22,100,241,185,72,113,178,135,212,
+197,7,167,132,170,217,207,52,149,202,103,237,131,104,247,80,45,87,25,58,72,152,229,241,69,78,205,61,145,168,4,161,122,51,65,161,13,207,229,48,
+37,158,86,168,0,149,162,242,2,205,11,115,28,130,76,147,66,40,219,65,150,158,175,10,200,85,108,35,203,57,162,112,52,18,170,139,159,148,135,40,
+226,70,56,25,144,131,201,27,136,135,7,5,18,209,189,147,208,36,133,149,77,185,247,61,62,4,87,41,211,93,121,175,109,138,128,128,33,75,93,75,
+143,69,139,50,157,252,89,68,162,36,197,65,41,111,20,105,202,35,203,210,36,31,3,56,221,225,215,48,17,52,18,225,233,1,131,6,129,220,113,23,
+232,135,165,24,16,169,17,114,80,168,157,108,116,143,186,61,161,112,167,167,102,14,73,155,138,34,197,43,230,145,160,3,196,223,19,47,11,20,99,15,
+104,112,149,157,50,209,196,157,148,12,40,154,197,35,205,63,96,114,28,68,35,113,109,164,100,146,83,200,4,54,218,180,84,2,136,53,128,156,132,68,
+0,33,55,118,127,31,227,219,216,111,34,190,203,195,99,187,136,28,16,249,252,167,75,2,227,22,188,168,185,250,88,194,50,48,150,117,64,176,57,129,
+212,52,4,77,45,124,236,109,17,208,55,180,73,26,185,168,7,59,146,61,127,56,149,2,84,137,227,235,137,197,140,40,166,42,214,97,85,105,142,163,
+224,245,5,8,19,189,233,53,96,153,28,126,214,73,56,165,33,163,33,81,72,163,198,66,135,88,60,34,88,0,170,67,20,11,23,128,47,59,65,78,
+144,27,201,24,232,243,5,88,54,175,56,130,89,142,175,112,34,44,96,116,134,50,61,150,76,2,122,6,63,131,137,249,218,26,143,97,200,110,190,19,
+130,212,45,166,70,146,244,92,142,13,150,36,32,218,242,225,218,147,24,58,18,117,62,80,154,115,192,34,17,219,243,24,176,179,89,125,86,239,64,19,
+165,238,168,84,82,96,221,4,73,75,57,71,40,55,99,234,62,127,172,51,181,234,51,47,0,54,135,124,130,69,80,218,71,119,248,3,224,67,10,207,
+230,4,57,38,70,89,122,210,133,5,130,49,131,158,206,101,195,5,11,53,26,236,54,162,180,169,136,26,7,34,197,23,150,74,118,111,72,49,137,122,
+106,215,143,93,251,79,179,233,17,217,216,71,231,184,61,7,59,241,126,30,238,139,5,205,96,63,57,178,231,43,4,135,114,82,140,68,94,140,42,40,
+60,202,99,152,18,192,12,166,110,240,139,186,231,78,205,210,55,157,213,82,150,142,215,227,3,97,97,137,156,142,173,158,113,196,243,82,228,93,101,243,
+217,90,136,54,207,91,194,16,1,15,132,201,215,58,135,106,233,18,204,221,160,236,190,200,143,51,134,101,10,78,130,116,237,148,137,97,180,182,64,224,
+86,34,28,140,73,33,104,29,162,10,98,183,73,192,229,1,235,247,84,243,192,234,229,134,69,219,29,107,8,51,67,215,104,197,66,61,34,19,81,209,
+217,29,250,159,123,27,35,13,227,188,101,119,222,121,102,117,85,19,42,197,198,212,183,41,63,107,16,238,238,72,13,201,132,74,193,150,84,157,212,38,
+119,76,39,7,166,175,19,93,62,78,24,186,178,1,132,36,12,118,113,108,222,81,119,129,197,72,216,7,207,215,15,26,184,94,183,37,152,243,120,8,
+196,27,217,10,232,211,175,14,132,26,56,216,98,7,87,162,144,141,4,196,133,198,156,146,137,61,149,27,254,10,174,63,29,145,201,71,159,146,151,48,
+223,49,155,64,160,253,23,3,207,13,241,63,25,183,172,98,175,53,37,222,163,66,234,127,8,243,161,193,67,114,168,252,63,234,192,96,173,184,175,117,
+194,121,12,22,90,6,113,143,3,121,141,141,67,82,61,232,33,213,234,218,11,18,148,236,194,176,105,5,64,69,109,83,91,53,69,153,174,48,117,153,
+91,71,42,106,18,129,60,190,194,213,147,106,16,64,15,169,211,90,189,234,61,44,102,10,4,59,59,166,101,72,12,8,28,1,87,128,159,131,24,56,
+104,225,43,206,9,25,9,139,87,168,157,127,84,140,64,2,113,14,193,67,90,199,10,118,84,219,200,75,145,52,146,48,193,70,185,200,41,139,116,241,
+13,78,2,12,177,74,119,17,87,241,138,60,75,191,241,161,71,28,250,204,39,142,248,13,144,45,192,190,15,32,175,98,66,214,140,65,122,114,169,168,
+202,28,126,120,137,48,64,10,48,84,173,65,67,110,171,209,60,133,123,192,106,223,11,6,17,197,28,213,230,230,152,116,42,247,144,240,205,107,186,253,
+193,10,249,169,122,170,152,62,106,37,58,1,101,22,90,146,172,110,92,73,226,207,78,22,98,40,2,64,19,102,225,11,61,20,166,8,74,155,73,155,
+44,170,44,135,95,176,147,153,196,14,171,51,97,83,142,189,144,53,11,109,198,245,209,108,76,31,138,87,13,98,47,37,147,57,21,141,208,253,255,42,
+216,135,150,197,123,174,179,174,193,24,84,24,124,249,180,58,54,102,43,84,151,126,192,233,209,40,99,167,81,241,218,148,147,80,53,203,205,162,20,178,
+5,140,228,216,10,37,176,242,146,28,207,57,14,119,17,131,4,162,35,147,220,103,98,124,150,124,232,76,85,249,27,110,15,136,95,18,232,68,84,249,
+133,106,150,75,129,21,16,180,170,65,225,147,164,44,148,44,122,131,193,163,85,27,17,12,83,23,53,13,6,8,105,42,81,87,3,118,251,201,148,236,
+164,2,92,174,190,167,3,89,161,198,34,193,145,170,27,34,177,2,215,242,126,183,237,84,43,221,122,202,239,146,238,53,139,156,38,159,114,81,94,13,
+140,11,241,85,176,47,141,183,56,169,220,59,229,195,208,176,56,72,218,64,105,225,144,53,157,162,94,64,220,1,185,188,176,148,225,208,77,90,195,43,
+78,138,117,179,154,4,175,89,71,57,165,208,97,106,21,170,34,61,80,166,241,250,8,118,115,215,53,17,57,38,51,227,35,144,185,18,145,136,166,18,
+243,17,101,115,18,108,82,93,104,232,136,216,226,169,85,214,53,131,56,186,82,229,85,118,109,181,212,235,27,194,50,172,26,70,137,152,147,31,31,197,
+249,31,90,159,81,192,118,93,103,224,52,143,182,199,234,87,55,189,27,35,10,118,190,37,84,8,39,22,35,199,230,37,96,97,3,151,140,89,111,146,
+127,4,53,24,133,240,204,206,153,208,86,175,211,73,149,108,157,176,164,32,68,193,207,102,86,75,92,222,78,210,61,54,184,16,115,146,122,41,212,109,
+31,229,50,35,89,23,112,229,97,210,145,217,151,135,34,83,67,217,99,108,162,213,215,74,190,146,197,134,64,241,76,174,82,164,134,215,224,52,178,59,
+45,222,50,127,40,182,70,96,51,36,170,228,164,67,97,48,110,114,15,224,100,126,79,227,101,216,101,60,151,53,199,126,43,164,143,202,1,201,202,99,
+214,203,216,200,97,106,212,33,106,164,240,50,234,226,16,65,142,44,40,153,35,81,143,81,5,71,4,189,116,105,16,135,141,0,20,1,60,80,48,234,
+83,44,189,112,244,33,230,49,84,178,210,243,67,200,52,181,93,5,50,241,166,46,146,126,64,133,12,53,143,65,126,93,65,208,14,163,71,24,223,248,
+140,233,66,12,160,236,123,106,23,179,204,204,94,243,214,182,250,234,241,19,26,26,32,104,202,20,144,131,71,28,193,75,121,167,243,207,80,186,153,170,
+206,249,93,63,181,143,188,204,122,111,166,214,117,221,117,94,1,102,117,13,169,102,188,237,83,124,11,53,199,197,157,87,81,67,20,221,174,154,132,236,
+208,149,55,79,70,229,48,173,107,6,35,122,150,209,72,41,10,21,74,21,151,195,99,71,74,92,190,143,6,21,65,40,52,69,20,83,192,82,99,243,
+22,234,238,146,137,26,166,137,154,218,204,221,160,131,35,41,105,42,82,87,99,80,12,64,236,179,205,110,138,28,193,3,148,48,9,170,231,177,249,202,
+240,240,7,96,100,17,45,139,243,30,231,76,202,95,52,244,56,75,198,58,253,99,79,10,43,231,124,141,27,126,75,170,219,126,139,25,216,87,30,118,
+226,62,93,110,110,59,102,38,3,192,204,7,17,151,188,94,30,75,15,36,74,174,225,170,168,60,83,142,6,66,170,68,112,33,229,137,173,146,2,253,
+16,124,21,187,60,244,217,54,17,32,16,23,86,94,9,136,22,128,12,139,178,110,148,176,224,229,8,49,26,32,241,183,211,97,86,22,62,8,168,144,
+37,3,71,207,18,183,33,36,44,248,229,230,151,17,137,197,96,199,211,77,176,32,230,22,249,249,1,80,185,1,114,47,0,55,199,37,50,32,128,131,
+115,248,15,210,239,252,207,71,246,205,62,3,194,88,127,108,69,100,164,73,176,173,238,229,75,192,200,151,13,38,22,67,157,217,7,197,243,26,113,202,
+141,70,156,121,5,183,199,23,32,13,129,48,0,198,143,130,83,19,132,66,81,44,38,55,76,254,53,128,49,229,200,53,46,240,164,109,0,250,21,88,
+69,113,243,17,170,29,33,126,121,211,210,206,216,20,137,136,106,61,81,119,114,70,206,178,78,68,148,19,149,14,72,48,161,100,72,201,212,135,198,203,
+72,177,184,161,43,100,212,234,132,4,163,222,32,50,192,152,244,131,34,195,141,254,55,210,202,134,238,145,125,119,41,244,92,130,58,167,58,110,172,149,
+174,6,211,78,79,34,170,51,122,146,22,128,133,253,82,177,228,9,197,0,179,196,84,192,78,96,238,48,248,104,207,75,243,154,185,29,50,144,5,99,
+185,30,65,135,31,144,13,133,72,143,65,161,79,57,38,121,4,174,66,21,173,150,191,164,139,205,244,136,237,247,82,47,221,71,210,9,155,80,242,46,
+46,201,91,156,117,172,46,122,117,163,49,111,128,48,195,190,88,172,35,153,0,113,226,234,159,130,93,139,160,98,114,10,238,248,132,40,164,198,80,44,
+70,198,120,13,25,238,215,234,120,51,230,122,111,17,225,60,7,198,71,2,128,2,150,125,247,110,202,102,108,212,125,157,98,216,247,54,199,167,68,141,
+180,141,103,186,203,161,162,37,6,224,248,233,163,48,96,37,154,107,117,152,89,232,77,190,235,42,234,59,51,68,69,104,17,170,98,141,165,40,36,235,
+66,173,179,250,2,213,118,208,34,227,2,137,2,108,34,137,146,252,23,54,184,225,232,178,162,140,73,102,115,219,121,10,43,185,193,149,183,25,24,229,
+80,37,220,7,171,221,101,193,72,68,156,51,5,2,194,35,51,160,167,150,37,63,144,200,208,61,157,237,255,51,171,105,105,228,188,246,123,230,185,76,
+65,178,185,46,204,69,124,120,248,216,241,228,243,55,15,195,150,46,138,52,83,231,110,143,153,156,45,147,198,57,58,74,40,70,63,136,13,151,180,0,
+126,98,158,129,88,182,41,152,72,205,79,199,206,43,22,96,64,155,218,201,204,26,32,68,87,70,86,160,174,201,232,178,46,39,183,182,6,92,204,82,
+162,26,186,28,81,176,81,82,169,11,61,65,28,188,50,208,85,22,162,36,46,230,27,190,66,173,19,183,4,4,63,152,165,178,131,96,169,57,82,115,
+141,75,100,253,239,171,185,145,248,169,46,251,241,28,182,249,98,67,66,72,202,225,67,98,212,155,103,6,124,146,19,8,192,165,154,46,78,103,20,28,
+216,209,17,23,53,3,224,97,17,51,20,88,12,16,217,29,1,184,248,71,230,133,137,38,136,34,56,182,140,171,206,209,25,171,216,53,189,184,133,201,
+71,194,221,2,5,43,138,59,42,122,155,54,167,160,222,145,192,111,242,85,242,80,165,33,31,151,13,105,185,201,19,55,69,175,170,41,131,184,15,10,
+34,170,197,27,229,51,81,117,150,101,244,26,58,226,2,98,97,144,99,121,111,131,234,125,237,202,201,15,85,210,125,39,57,33,158,182,193,153,20,150,
+86,85,203,156,154,187,12,91,75,54,202,1,218,219,4,187,194,19,173,186,17,18,200,163,185,165,235,81,44,32,157,48,50,245,201,89,80,200,21,129,
+144,39,91,80,29,104,44,14,225,109,252,162,43,216,227,37,142,135,186,201,197,97,57,221,48,208,163,27,208,80,166,87,144,240,250,65,118,50,3,85,
+137,33,33,139,150,21,47,69,27,56,137,171,148,205,172,225,12,129,172,217,209,78,228,41,75,2,12,80,204,4,137,104,100,165,193,201,73,158,173,245,
+127,185,82,234,187,188,243,30,123,218,105,47,254,139,191,27,73,155,177,140,137,191,43,35,46,202,93,172,49,211,228,18,65,202,6,197,224,139,94,195,
+32,105,137,55,207,101,197,64,72,222,102,112,199,74,20,68,237,68,66,185,244,22,218,85,72,160,234,172,212,197,32,208,226,142,241,125,128,253,205,6,
+27,7,25,23,72,254,24,105,130,20,250,105,244,103,161,53,168,151,11,135,60,16,97,55,250,13,25,121,171,13,26,14,91,195,196,44,143,124,18,78,
+33,26,226,49,185,204,74,133,80,233,161,28,153,0,152,203,131,34,200,79,254,95,224,93,186,17,248,111,117,194,121,141,163,230,248,171,217,241,147,229,
+115,175,168,101,211,100,211,47,136,27,75,134,165,207,93,130,192,120,126,162,28,178,56,105,240,215,13,213,164,84,37,74,60,65,51,51,76,88,214,75,
+209,97,196,220,71,155,128,135,24,110,65,204,120,41,2,56,188,66,176,101,139,15,72,117,64,147,185,76,93,117,77,3,176,202,196,42,194,212,94,214,
+69,134,144,187,136,24,156,3,130,231,131,66,212,78,179,178,129,116,142,119,140,222,208,64,90,165,225,36,116,122,69,23,176,133,40,106,138,140,229,124,
+15,151,236,108,177,94,187,215,110,189,166,91,65,167,203,68,187,181,147,148,228,97,56,213,82,28,186,154,133,233,35,217,69,86,215,67,139,164,153,18,
+184,11,85,71,161,111,46,226,26,104,246,17,244,83,180,80,99,168,148,185,5,37,2,77,213,10,29,132,189,28,163,115,131,205,141,149,202,31,102,32,
+240,148,131,162,112,145,181,17,225,218,32,86,148,1,0,76,69,177,138,31,74,138,104,93,124,192,85,49,209,115,212,242,77,180,248,203,121,67,44,96,
+0,44,129,111,176,181,10,152,213,58,168,139,21,143,23,160,229,124,63,214,214,235,167,179,159,125,201,122,79,29,42,137,82,184,241,28,74,84,83,116,
+34,33,87,162,62,220,157,100,105,74,107,182,195,14,197,43,129,80,209,136,184,39,224,237,173,100,2,201,194,96,173,199,197,19,44,110,179,111,160,141,
+157,205,57,74,206,250,6,36,149,37,120,97,239,228,29,90,128,73,5,18,240,170,9,140,141,49,248,165,49,98,179,92,190,26,206,95,148,222,234,46,
+194,131,11,97,119,60,206,70,137,53,61,49,42,56,73,26,43,90,132,152,121,69,192,99,192,217,66,193,206,89,227,30,204,225,181,63,83,240,58,122,
+14,43,224,185,111,142,239,180,137,11,6,177,78,111,18,118,100,253,60,117,249,243,81,243,20,244,144,230,108,27,92,140,132,102,29,33,84,196,98,85,
+75,68,142,28,9,225,9,50,82,143,225,4,144,175,146,150,221,199,15,117,131,184,135,72,108,0,179,230,74,154,97,2,148,177,195,71,144,96,119,24,
+26,0,33,24,136,84,10,100,225,75,88,39,221,31,61,66,222,184,232,5,37,145,207,80,198,4,137,200,101,234,170,228,15,80,222,95,206,48,143,51,
+73,159,180,13,135,204,17,119,47,229,253,174,254,239,227,57,205,167,236,186,141,194,107,106,114,82,180,111,85,210,201,176,173,117,193,219,61,159,219,113,
+119,135,166,229,137,197,96,110,16,165,56,109,65,200,241,246,216,59,0,54,188,196,202,91,172,109,210,55,248,162,239,236,120,134,121,29,212,235,90,99,
+229,215,150,24,58,204,60,113,120,123,35,120,157,177,171,190,130,254,63,45,14,242,54,0,139,118,24,61,198,172,165,55,71,190,131,68,180,82,150,14,
+42,97,155,218,104,115,199,185,29,245,61,150,199,121,38,4,176,100,211,162,150,4,106,40,130,94,23,249,221,169,64,159,1,231,59,47,101,215,92,40,
+90,51,129,146,43,220,141,86,53,204,121,98,211,236,44,91,50,135,0,184,19,100,100,7,37,46,176,1,133,105,139,139,117,127,132,12,52,83,41,185,
+97,225,2,47,96,178,252,134,203,185,208,43,127,12,221,244,74,196,227,97,226,22,112,58,41,180,80,15,222,36,22,128,153,210,206,109,49,184,0,27,
+62,91,62,89,102,199,117,119,125,177,136,160,183,152,151,40,61,100,197,168,104,36,230,160,46,209,58,38,125,114,22,143,79,238,59,89,232,75,28,143,
+131,251,125,159,77,57,234,189,183,132,250,98,250,98,152,250,46,28,51,252,120,88,186,249,229,169,87,157,112,172,204,86,143,124,214,199,112,124,10,74,
+122,169,89,37,232,172,110,133,185,116,62,79,4,226,69,194,185,233,209,139,49,188,38,22,235,53,88,213,72,200,5,144,183,63,12,73,123,52,132,186,
+31,85,169,47,116,24,17,215,70,86,75,197,21,153,192,88,227,158,198,219,72,175,64,116,169,0,128,6,65,204,5,171,140,6,41,211,21,83,180,192,
+139,155,92,206,74,70,7,203,119,50,192,13,130,24,247,239,253,254,236,79,97,211,119,159,140,223,107,181,209,105,78,133,139,196,142,197,194,183,64,196,
+202,231,166,68,49,138,42,93,57,198,201,37,100,13,2,171,130,128,179,138,74,62,26,4,178,89,193,98,133,3,89,47,53,2,226,142,209,168,242,9,
+144,199,193,22,141,138,58,84,10,11,247,142,51,39,40,33,207,26,160,195,217,17,137,80,1,125,53,56,189,198,191,37,181,156,7,2,138,22,123,39,
+72,163,39,160,143,139,154,132,151,165,237,23,227,248,8,88,90,170,90,202,248,4,23,58,137,52,248,76,72,78,191,235,252,170,220,215,13,243,30,35,
+197,125,48,50,40,247,30,148,234,13,12,140,151,54,181,113,72,245,4,96,213,18,46,198,178,206,0,57,196,40,163,23,146,175,196,16,211,227,160,207,
+80,216,6,139,209,93,200,22,151,178,135,28,108,29,21,156,84,72,197,1,147,145,83,112,182,159,5,70,26,11,99,92,141,61,147,18,131,105,164,202,
+14,102,195,35,17,215,123,253,113,233,22,210,38,11,61,103,73,34,65,214,247,168,153,213,247,9,101,211,90,97,99,133,68,229,49,250,14,134,106,163,
+31,166,231,112,216,14,22,91,177,246,190,134,228,95,184,232,189,87,211,117,16,13,168,39,100,209,193,200,179,161,71,58,117,179,208,129,219,205,65,214,
+90,172,18,166,145,233,247,150,156,239,36,229,107,11,125,84,220,59,44,86,60,161,225,35,31,19,144,212,225,159,152,160,235,237,41,37,216,201,96,112,
+69,89,172,39,115,166,149,70,200,44,234,38,199,195,5,132,4,230,66,85,20,45,2,154,188,240,228,165,88,35,22,254,33,40,114,216,245,25,77,93,
+2,80,6,13,194,11,142,181,138,18,16,73,3,97,148,49,14,145,101,189,150,87,209,253,47,19,136,71,249,142,179,205,125,49,205,163,43,80,44,111,
+67,226,101,217,105,206,47,50,60,144,65,36,129,32,135,72,16,28,239,45,197,240,155,57,105,76,46,2,182,97,155,88,224,146,183,14,208,15,142,137,
+104,52,75,73,150,5,218,51,55,57,47,9,111,120,220,249,194,38,193,4,164,227,100,168,60,95,201,112,96,54,221,47,21,163,162,98,89,105,104,43,
+155,194,103,69,26,71,27,81,86,18,10,164,142,195,139,160,14,185,56,124,119,67,198,21,127,28,204,96,144,205,238,170,209,95,122,21,191,59,233,113,
+248,78,147,224,190,163,117,245,202,4,197,90,145,193,151,185,145,63,34,118,158,218,141,60,160,240,32,23,233,47,196,209,63,91,48,37,44,149,205,244,
+92,4,250,72,138,248,4,119,19,230,14,223,113,125,68,72,80,111,227,134,15,115,17,46,81,80,102,96,199,198,55,79,13,58,192,216,114,113,206,208,
+4,131,136,20,116,72,180,147,58,172,40,48,26,138,210,103,110,49,113,16,101,79,2,106,210,102,145,250,59,227,218,253,129,182,20,34,181,27,155,233,
+211,48,196,154,160,137,235,127,7,181,183,202,122,206,235,227,60,135,166,47,100,222,150,139,208,173,105,149,107,74,173,245,170,124,2,220,15,69,90,88,
+224,103,172,143,206,17,165,104,42,26,157,145,178,134,101,177,243,200,150,164,33,23,85,11,45,165,207,67,111,220,74,88,221,71,129,59,0,30,68,115,
+224,87,185,235,246,78,67,97,45,236,121,171,112,80,147,109,128,12,74,126,17,26,185,4,36,29,31,9,38,185,117,169,104,36,181,178,133,198,24,135,
+76,184,24,208,145,67,84,195,51,64,4,170,252,247,143,240,156,191,103,243,254,14,176,151,178,252,55,61,207,126,147,161,227,137,114,230,27,226,218,135,
+237,112,152,185,27,44,60,16,168,91,98,110,222,56,159,29,136,202,213,64,158,4,223,13,187,160,105,50,96,221,101,106,196,198,23,131,160,129,94,106,
+8,108,221,0,101,40,17,128,113,110,185,214,79,12,7,67,192,47,141,40,130,87,41,78,84,66,98,34,36,106,10,139,126,233,37,126,49,249,186,200,
+20,177,208,44,87,29,130,179,140,139,150,145,63,72,132,113,165,115,4,157,188,38,44,240,182,168,141,72,158,253,95,208,177,205,194,251,111,65,229,188,
+199,148,244,201,90,212,83,217,201,158,185,171,135,161,104,150,180,37,22,207,4,176,90,120,68,174,161,91,13,88,142,18,109,115,246,129,164,97,8,66,
+208,68,176,105,22,232,1,135,236,229,26,75,199,31,94,200,56,198,107,15,71,137,64,171,27,140,18,228,56,182,85,124,6,85,158,131,51,20,145,125,
+239,9,145,164,126,22,163,79,140,6,165,128,102,101,22,193,223,47,63,7,138,83,71,116,198,255,206,116,244,3,144,14,65,6,106,50,76,123,4,166,
+184,30,175,241,126,119,201,66,117,223,180,237,62,64,191,174,224,67,22,159,215,138,173,91,106,125,134,53,54,111,12,124,113,65,133,67,78,65,156,14,
+146,7,21,70,120,248,208,46,156,162,90,16,37,84,57,18,149,1,248,60,146,9,210,193,158,96,117,6,102,198,50,29,111,176,207,163,166,89,59,25,
+42,186,158,160,137,37,108,177,59,77,222,129,140,235,162,167,206,22,172,225,227,169,163,193,20,68,94,255,89,191,200,106,117,85,166,52,222,191,138,135,
+60,33,89,137,71,176,194,203,8,149,180,203,240,28,216,191,191,252,77,77,86,171,226,189,247,101,236,183,204,181,245,144,180,42,110,244,245,152,183,180,
+54,24,176,33,87,37,132,153,13,200,97,82,65,212,16,137,119,182,91,6,96,203,166,97,21,204,4,79,3,116,121,202,32,105,77,105,254,123,205,212,
+42,195,201,32,54,81,85,219,166,179,140,68,167,176,151,100,140,44,109,116,93,116,235,219,129,90,153,6,218,60,245,93,2,113,41,166,237,33,45,81,
+73,117,57,68,49,118,153,92,98,86,39,130,195,75,135,172,221,238,142,174,82,225,25,2,4,64,89,196,252,111,228,100,224,57,143,212,110,189,55,166,
+219,14,149,142,212,151,45,243,49,198,112,109,96,54,111,136,149,21,83,184,175,100,34,57,120,160,132,131,9,27,53,157,204,84,146,170,224,240,74,103,
+36,65,68,80,199,34,151,128,54,214,186,126,32,249,22,60,87,39,80,203,59,48,130,190,17,117,125,67,142,127,36,9,234,1,78,68,79,70,200,229,
+180,165,44,176,162,161,149,134,40,170,103,138,226,237,13,100,111,179,243,196,232,108,0,185,72,52,192,135,42,146,98,120,4,217,217,224,24,14,102,120,
+156,239,51,253,175,181,245,200,253,135,240,222,179,49,231,46,169,207,75,201,207,189,179,102,254,180,220,134,94,35,63,174,59,111,121,31,194,111,110,171,
+186,93,149,125,228,236,50,210,144,184,202,18,104,150,66,154,219,124,95,138,161,52,140,64,184,168,48,140,106,142,112,187,40,80,249,46,22,57,52,8,
+230,11,80,210,90,211,39,201,245,218,121,8,86,210,116,141,236,225,9,30,153,92,218,45,33,39,79,56,123,0,134,52,232,34,149,173,57,29,47,0,
+33,104,48,174,152,208,5,14,40,122,28,54,108,55,187,255,66,84,126,171,170,252,167,113,236,55,209,4,148,204,148,197,228,90,179,145,38,206,141,100,
+28,213,12,63,21,161,132,124,246,33,92,35,217,39,98,33,150,143,83,64,115,7,60,133,0,226,231,236,163,204,172,93,167,195,41,44,46,55,17,54,
+31,5,177,228,56,156,197,59,65,225,94,63,107,164,208,137,215,110,240,21,225,164,17,209,207,88,196,33,22,242,20,225,178,209,1,198,193,53,89,54,
+134,35,7,52,33,186,163,166,132,73,229,23,185,182,118,61,128,163,138,40,83,201,127,23,228,254,23,24,171,232,191,29,192,125,70,57,244,150,190,25,
+126,142,133,122,61,42,136,246,161,199,3,163,3,120,236,130,24,165,241,2,210,4,199,248,142,167,37,54,11,5,19,63,140,145,162,141,140,129,150,207,
+225,137,96,87,5,60,153,140,254,251,6,2,170,68,147,186,169,91,10,185,130,40,69,133,52,178,133,208,90,122,32,234,197,167,164,175,81,7,61,70,
+99,9,191,218,80,212,3,135,68,88,61,139,132,46,113,143,223,225,169,65,78,103,248,75,81,150,73,69,38,225,125,54,47,43,201,252,15,228,244,80,
+223,130,248,140,151,237,178,20,14,195,161,13,208,153,193,180,224,198,47,39,99,109,34,121,232,88,97,12,79,27,105,65,129,53,76,220,122,166,237,242,
+133,50,184,200,49,243,206,49,161,111,44,78,4,111,146,183,133,182,3,59,36,29,139,35,150,57,42,184,129,206,224,144,139,2,202,221,244,84,105,48,
+160,34,182,242,10,38,78,64,86,157,160,13,153,122,99,67,148,186,131,45,4,135,11,32,20,184,136,12,189,161,137,112,240,134,10,188,115,37,10,233,
+11,43,127,107,242,124,94,47,224,185,143,156,247,30,155,33,52,72,31,23,85,119,143,71,87,6,13,70,125,42,224,112,231,140,55,174,155,108,26,71,
+72,190,167,60,142,79,93,201,231,152,175,188,139,4,18,233,29,174,243,131,69,121,155,13,144,189,3,61,38,94,122,205,226,216,130,147,112,128,192,27,
+199,104,196,103,181,106,157,75,195,45,0,106,229,18,102,115,213,231,193,234,177,165,98,155,172,146,209,230,28,162,2,172,250,128,109,75,221,73,171,192,
+93,174,38,73,241,84,2,201,18,131,176,216,238,255,133,236,202,92,125,119,154,250,206,147,195,22,133,40,172,15,26,150,164,61,106,21,101,78,95,193,
+31,20,118,106,21,67,16,14,30,232,173,76,152,150,129,20,97,71,31,210,62,231,122,172,107,99,184,206,38,105,60,50,244,239,37,100,33,186,92,18,
+9,24,165,100,96,26,178,13,14,147,25,189,201,67,167,196,105,110,49,247,130,113,114,196,76,175,124,141,25,72,200,49,3,0,27,48,136,65,243,78,
+103,36,101,41,193,136,48,52,32,117,178,130,77,132,156,118,96,0,167,88,157,95,246,254,12,143,89,223,126,163,57,248,78,145,61,52,203,249,182,165,
+247,37,105,101,51,100,76,143,84,188,16,70,56,74,181,133,3,103,122,136,84,107,2,78,217,52,226,117,11,85,20,115,56,148,72,25,233,181,240,194,
+38,218,23,116,18,77,211,250,109,141,210,168,208,38,81,97,48,113,203,212,240,153,16,140,104,148,205,227,34,107,84,56,98,21,28,69,30,155,179,226,
+131,216,202,15,135,213,112,121,37,220,77,147,193,241,47,116,26,121,192,180,118,202,208,236,54,113,148,87,248,203,113,221,175,209,254,102,66,203,227,55,
+223,200,122,46,57,230,39,61,139,133,169,145,19,169,69,149,32,122,148,228,236,4,110,98,108,128,165,80,240,205,77,198,51,92,82,70,32,178,240,0,
+102,41,242,11,77,186,81,143,202,76,195,233,181,54,145,166,47,180,165,248,206,173,144,97,12,40,98,159,218,21,83,36,109,28,66,147,19,114,64,35,
+110,57,120,72,10,240,178,211,180,215,120,203,185,101,33,30,230,155,234,121,39,163,207,13,130,149,21,37,151,28,87,93,210,224,159,78,209,53,24,184,
+61,143,135,253,31,171,170,233,60,7,207,127,29,180,209,68,29,55,15,143,157,123,54,7,66,125,18,85,100,74,148,20,97,174,58,173,157,80,20,97,
+147,180,57,63,144,171,19,48,230,80,60,94,89,136,230,105,159,100,222,17,59,68,236,8,162,207,71,194,75,226,189,111,134,157,96,125,36,20,172,114,
+241,143,5,198,162,4,180,24,8,219,141,220,228,22,55,61,145,124,128,60,206,33,157,44,145,113,136,130,7,60,189,160,236,108,97,39,175,37,215,90,
+100,102,5,0,4,119,183,249,63,135,179,240,156,71,117,251,111,218,54,202,59,113,23,83,171,77,157,79,169,176,205,150,15,22,160,124,14,90,246,144,
+248,240,180,150,247,216,122,169,83,8,133,157,96,214,168,218,253,5,138,42,44,26,33,194,226,95,8,38,145,40,224,73,201,12,183,192,75,216,105,100,
+140,56,133,124,231,93,133,69,63,108,124,233,208,170,167,81,152,152,204,225,38,208,15,120,74,109,0,248,75,26,8,116,82,88,61,182,93,99,137,112,
+168,197,62,139,140,16,116,2,40,105,150,126,159,241,254,30,11,203,115,95,128,249,79,89,150,31,53,98,126,167,42,206,140,13,252,74,195,114,38,14,
+136,84,172,36,242,216,217,192,64,199,177,130,25,7,44,149,140,195,24,129,79,102,134,35,32,134,139,6,96,66,249,195,101,195,36,102,214,202,215,5,
+215,236,150,144,40,126,194,118,25,40,71,1,36,77,10,86,52,132,141,6,37,37,166,231,128,199,160,108,14,142,232,78,14,40,72,68,1,2,152,70,
+97,102,93,241,231,41,153,136,198,100,228,136,4,12,87,153,249,31,129,213,245,29,23,61,250,143,231,25,103,142,142,63,99,192,186,211,175,202,194,89,
+139,29,38,120,12,62,58,206,120,137,144,115,147,246,88,154,70,103,98,12,157,104,214,56,196,238,170,116,46,67,34,56,240,42,88,130,5,210,43,52,
+33,217,71,154,155,168,28,7,23,64,18,41,201,197,188,118,108,212,44,81,132,241,121,139,86,111,64,20,166,209,218,51,46,81,163,140,124,132,43,0,
+33,94,156,212,120,191,73,181,56,249,90,49,25,30,106,156,94,11,22,161,5,230,124,223,161,254,23,42,135,236,56,15,205,113,159,160,225,184,62,187,
+59,2,3,181,23,153,49,47,102,208,94,110,128,122,28,7,47,172,66,88,88,146,209,80,51,185,136,112,12,105,148,194,195,60,71,41,153,229,56,94,
+75,22,145,53,73,129,2,222,3,145,154,19,47,57,6,22,35,14,65,144,19,7,164,220,40,22,9,230,7,1,115,97,35,23,125,59,91,41,57,133,
+24,18,130,255,61,11,91,120,125,153,103,56,67,176,34,49,146,32,146,149,192,114,121,107,92,37,91,37,141,88,25,47,103,252,95,194,187,205,122,15,
+199,118,30,211,241,87,119,13,112,161,40,110,100,101,214,198,215,233,53,103,231,12,171,38,138,154,126,74,142,88,99,220,151,7,142,179,100,113,10,120,
+195,33,168,48,187,139,153,6,236,35,103,177,50,202,90,16,90,154,14,34,6,10,76,34,104,121,197,51,245,1,5,69,245,156,75,193,161,151,41,22,
+203,59,68,180,26,22,208,230,231,25,170,19,35,186,169,155,200,100,215,46,89,159,234,32,97,224,32,95,73,170,12,196,221,52,124,1,75,90,139,95,
+79,249,156,185,236,199,249,174,67,232,189,4,84,130,77,90,77,169,187,124,28,55,62,234,157,100,104,192,111,35,88,70,207,22,137,156,110,34,57,25,
+209,167,19,80,206,87,201,23,132,46,32,41,163,70,34,214,72,217,105,249,204,9,200,122,199,40,142,177,156,141,56,2,239,96,244,184,32,70,151,20,
+151,144,110,120,48,170,56,133,34,76,141,107,48,6,28,5,195,83,224,87,78,202,51,8,200,137,86,5,229,168,86,238,56,152,65,227,70,1,42,168,
+146,150,116,63,208,253,108,134,235,130,254,251,128,251,44,54,168,142,68,194,158,30,117,167,31,30,218,175,51,231,60,44,52,21,172,112,211,13,240,18,
+34,229,33,70,209,82,225,53,248,168,21,119,17,166,240,203,224,108,166,242,212,177,90,156,245,139,228,6,99,109,172,108,151,196,197,12,39,2,8,212,
+246,172,166,179,6,49,192,225,225,210,61,133,209,39,59,14,128,53,25,103,215,58,138,243,81,17,227,215,77,231,52,172,21,62,135,128,118,49,161,246,
+32,84,69,208,76,146,132,98,55,123,157,255,87,175,245,24,15,200,124,247,232,54,149,147,90,157,23,207,186,183,169,181,87,26,220,24,236,94,171,11,
+4,64,233,154,164,113,122,172,237,53,206,88,139,84,118,86,47,139,158,60,236,84,80,166,102,136,43,124,244,140,64,250,123,69,97,88,5,193,232,157,
+192,154,60,16,38,47,172,231,120,75,86,141,163,89,70,172,65,59,32,102,60,242,19,245,153,220,4,54,230,248,147,30,23,215,107,209,28,64,156,131,
+101,169,146,192,212,19,163,33,148,234,118,81,237,160,255,35,244,122,248,31,205,109,191,65,254,49,7,117,85,35,38,135,15,7,110,71,161,76,111,2,
+10,91,153,211,11,12,142,40,121,232,220,150,173,53,213,11,126,67,147,160,50,57,132,156,18,220,39,15,193,59,47,5,39,12,146,100,24,162,135,78,
+23,130,149,27,64,63,51,152,38,164,170,72,253,102,134,168,204,5,157,195,118,245,89,24,98,7,181,182,145,113,22,251,78,79,36,122,12,80,60,30,
+96,251,216,102,64,231,102,22,83,216,90,129,108,52,110,7,117,66,104,223,55,252,143,90,94,235,231,63,184,207,126,179,104,56,208,219,178,250,180,251,
+56,142,76,165,41,104,112,35,100,32,85,4,128,153,199,94,184,20,253,144,66,101,158,224,180,49,15,139,158,197,240,216,187,33,118,123,0,188,111,16,
+221,155,138,52,201,139,95,236,40,65,139,130,23,22,49,2,145,143,143,147,72,185,26,86,252,135,107,4,136,227,118,112,212,244,217,28,176,25,24,2,
+86,112,70,197,136,59,117,139,199,1,54,4,4,109,244,123,53,203,44,235,172,74,197,127,179,251,215,249,111,109,241,223,33,231,191,60,164,48,168,246,
+54,116,50,175,226,241,103,13,203,165,5,4,116,97,92,228,170,153,135,154,58,99,34,200,1,90,90,50,214,96,252,133,157,1,120,76,205,226,170,24,
+101,24,24,36,218,156,99,118,15,71,5,77,25,143,136,42,13,214,37,210,37,181,151,237,41,36,206,168,143,158,82,172,189,117,237,69,169,163,68,229,
+165,71,192,102,94,76,245,126,34,13,67,75,59,201,14,46,217,121,4,183,156,158,171,30,177,150,95,225,254,7,199,152,251,47,182,232,191,81,200,119,
+6,215,202,172,218,145,226,231,182,53,228,148,165,203,182,136,165,152,200,248,74,91,138,180,144,185,106,120,4,241,176,197,46,244,81,171,19,196,67,201,
+11,143,134,88,229,30,24,221,12,149,125,102,78,2,50,52,240,241,46,138,63,84,237,19,184,200,180,8,6,21,93,27,57,34,21,37,46,35,19,73,
+161,198,16,147,23,25,19,33,11,8,118,60,126,18,245,144,38,10,24,192,216,63,136,114,203,79,186,155,149,150,127,219,254,95,216,160,227,62,107,227,
+190,75,218,111,45,41,86,181,122,221,175,54,187,30,13,74,219,117,128,86,155,192,87,229,133,163,176,191,140,20,68,152,103,54,89,155,105,251,136,55,
+78,234,162,223,55,71,124,221,174,91,91,130,111,15,77,2,124,4,32,92,239,144,226,230,28,71,143,116,244,128,133,42,153,83,224,163,103,186,126,155,
+34,78,114,214,186,165,128,18,16,55,85,239,18,130,132,183,31,97,99,142,200,220,36,195,228,178,122,140,26,12,37,109,252,116,135,74,227,252,15,220,
+153,211,116,223,105,249,47,202,77,64,93,84,185,3,215,151,61,210,225,58,176,164,41,80,77,184,171,160,165,228,47,116,217,26,3,4,79,150,129,170,
+55,34,41,180,204,180,118,78,90,50,108,142,75,107,88,223,1,159,140,52,126,13,97,120,77,174,241,187,250,163,225,64,28,8,172,12,110,218,117,171,
+166,7,223,186,69,34,98,70,137,218,179,196,9,19,32,41,184,226,132,23,158,82,120,232,105,135,98,214,76,214,57,144,102,14,67,14,223,65,228,247,
+63,229,110,208,124,215,170,251,239,164,245,129,51,72,243,224,115,37,182,168,83,185,15,110,66,109,116,136,136,237,255,37,59,138,200,237,165,109,55,120,
+36,85,182,153,148,66,234,166,195,198,45,186,131,78,224,67,215,140,94,71,205,17,193,230,37,74,196,64,133,178,217,229,32,230,46,102,10,75,182,99,
+61,86,248,165,62,25,137,49,227,88,70,194,99,112,12,100,246,153,61,118,133,241,146,130,161,66,198,29,44,123,19,68,186,126,50,71,69,147,192,98,
+239,32,198,107,250,223,237,249,246,223,89,215,125,167,244,222,177,84,80,238,222,227,151,151,47,3,137,2,237,70,183,25,153,36,229,240,150,56,6,167,
+25,29,36,64,0,69,114,21,97,135,10,100,5,153,73,198,35,78,55,142,177,134,136,199,218,73,128,134,91,11,85,54,200,83,124,38,70,72,196,56,
+56,133,161,19,61,38,208,33,248,72,18,96,69,22,122,76,44,113,214,244,0,166,195,89,103,102,32,234,159,170,129,156,155,132,147,132,58,176,9,164,
+171,34,228,249,223,225,127,103,174,228,190,91,249,111,130,249,76,130,181,200,122,146,214,179,178,33,55,120,76,185,116,78,83,75,169,178,122,81,206,146,
+53,210,252,55,47,213,102,94,3,177,158,128,218,211,108,59,126,42,5,108,116,236,116,157,150,135,57,74,160,51,215,69,199,19,16,77,33,148,142,51,
+174,177,28,125,67,77,47,93,169,75,56,25,74,136,112,112,209,163,9,63,120,196,129,27,170,116,210,249,141,28,160,48,113,251,45,44,192,23,242,216,
+28,211,178,8,233,165,81,251,159,214,251,213,90,143,138,254,3,249,236,39,199,72,196,104,215,207,221,139,149,200,144,51,90,178,53,182,119,56,87,43,
+176,183,138,103,20,154,5,146,166,115,155,254,11,70,3,93,110,39,45,171,217,94,178,76,86,45,159,17,153,128,208,249,174,94,90,21,4,83,215,53,
+81,116,206,222,160,125,50,200,16,65,3,67,57,72,209,136,8,88,128,33,32,96,174,240,142,225,232,150,104,120,108,172,68,221,147,184,157,65,251,56,
+135,41,138,28,94,61,193,90,110,110,147,63,255,67,221,214,248,175,201,120,175,237,187,173,86,43,2,58,79,102,134,14,102,85,72,155,183,82,164,1,
+58,208,206,46,137,36,88,48,211,81,15,104,56,28,113,180,35,130,132,92,70,120,124,204,146,240,195,66,136,16,172,51,107,189,22,94,218,95,5,137,
+130,84,245,20,173,132,105,24,72,27,45,126,0,164,156,99,113,2,134,149,4,242,197,208,67,178,59,11,85,150,60,134,247,1,55,32,133,205,3,81,
+170,21,140,96,148,10,134,173,20,136,55,143,255,107,215,217,247,92,199,244,159,17,246,27,164,65,162,85,121,212,121,131,119,121,15,59,201,121,123,236,
+27,227,102,9,178,137,20,201,137,38,133,199,197,68,184,1,149,235,54,111,132,64,35,48,98,31,53,169,160,102,24,232,99,176,83,120,205,137,169,196,
+18,99,7,65,35,67,13,111,49,26,193,188,147,50,71,5,195,219,29,155,164,122,18,6,56,181,221,226,249,220,68,153,132,142,209,26,141,21,49,2,
+41,13,69,200,168,170,187,37,80,229,79,208,57,225,127,91,248,185,191,29,238,61,103,226,62,203,158,24,138,22,86,63,23,34,3,42,58,118,28,192,
+185,148,129,201,90,100,193,66,36,161,45,4,116,210,82,241,72,68,139,40,170,127,104,206,87,73,26,74,207,65,78,113,43,56,226,44,86,43,1,49,
+10,88,98,36,166,130,45,130,203,236,181,238,29,3,6,254,40,117,142,98,6,102,194,20,32,193,100,74,201,33,90,150,169,88,210,71,212,27,40,117,
+66,181,15,86,28,50,32,142,3,99,32,190,175,246,127,163,153,210,123,47,158,250,143,204,111,157,44,169,33,181,133,35,231,116,220,155,172,40,64,111,
+89,39,96,84,162,150,6,76,5,40,174,138,68,164,6,143,68,230,6,208,153,68,118,152,220,132,217,161,36,193,135,87,37,31,12,214,70,248,48,87,
+170,139,58,185,170,189,170,165,84,109,113,80,70,134,73,205,30,185,142,34,76,201,124,22,118,104,21,44,32,133,114,20,241,0,85,179,207,92,176,111,
+89,66,62,17,250,139,203,244,209,244,137,107,255,71,249,158,55,164,243,95,25,241,159,158,241,14,135,136,185,127,145,147,51,82,149,30,46,0,220,40,
+184,73,61,197,233,180,83,212,162,227,4,137,16,246,89,24,18,163,155,75,202,90,114,188,84,172,22,70,184,153,81,86,117,1,215,150,18,206,217,169,
+184,130,33,7,200,98,110,177,183,85,48,59,37,160,95,182,101,95,60,219,165,228,169,64,14,12,196,146,35,212,101,97,142,66,166,86,104,160,120,59,
+202,53,202,192,62,54,73,143,29,200,129,150,227,250,31,249,121,89,143,178,244,94,235,249,206,144,22,27,46,131,131,29,39,226,231,39,101,201,84,152,
+58,122,118,88,130,248,2,99,147,47,0,239,13,38,151,1,54,174,8,156,17,146,178,72,70,5,140,179,144,106,32,84,75,102,161,227,49,180,196,111,
+184,27,136,140,254,195,70,218,27,91,64,5,125,118,70,193,41,216,168,251,235,19,140,50,114,135,171,112,201,218,174,133,138,179,200,105,116,83,173,163,
+240,217,54,133,131,191,172,21,30,210,9,156,155,111,95,252,95,209,150,247,157,135,248,47,142,241,30,75,43,96,175,155,33,201,131,95,193,128,98,82,
+140,59,65,166,192,91,98,244,20,99,28,76,194,9,106,176,106,168,212,69,13,79,229,21,156,54,2,82,101,145,177,34,8,202,205,69,213,99,90,82,
+102,113,139,85,74,230,171,82,206,68,205,229,131,72,128,55,92,173,237,52,88,122,232,214,104,136,162,123,8,116,129,20,32,86,202,65,170,121,6,186,
+54,50,4,2,128,192,35,243,198,192,130,215,249,255,236,249,182,159,61,248,79,146,252,215,195,51,210,76,192,228,210,229,203,104,240,41,169,192,166,199,
+200,7,68,37,16,103,248,11,87,65,143,150,106,58,106,61,221,18,140,111,13,133,134,93,46,208,0,229,21,241,194,42,214,21,25,11,81,46,15,89,
+201,227,12,47,67,93,165,176,3,58,152,192,117,179,11,207,89,196,52,90,209,154,182,1,81,170,2,239,9,139,48,220,194,97,100,134,134,56,146,236,
+84,176,125,63,56,252,178,26,12,168,223,189,255,159,183,244,25,207,243,159,37,225,62,129,225,212,118,53,113,40,239,225,101,105,196,65,207,101,99,141,
+148,49,24,15,55,201,89,144,71,150,229,112,3,80,151,116,174,97,59,124,117,93,165,172,64,162,98,129,54,202,220,104,248,174,127,17,14,121,33,179,
+8,39,97,153,75,192,231,174,108,49,236,167,33,89,194,4,151,128,8,72,87,11,225,160,223,137,84,211,67,21,61,157,64,166,170,117,80,60,20,252,
+58,232,44,29,228,252,54,15,202,101,75,1,241,191,157,251,217,159,53,227,62,195,247,223,101,148,103,81,39,46,255,55,39,7,6,119,135,81,5,194,
+212,34,135,158,10,170,30,34,239,0,122,190,146,132,60,212,237,38,55,168,216,180,47,130,179,104,29,125,34,115,76,210,53,108,125,185,25,134,97,128,
+151,201,97,70,170,150,205,175,201,94,214,40,237,122,70,172,107,178,181,140,205,47,23,69,133,166,10,33,171,69,102,156,202,106,111,173,113,22,101,163,
+146,27,135,142,171,168,151,88,114,7,17,75,41,43,241,191,55,249,112,95,130,216,127,136,251,110,147,160,94,9,23,159,81,79,118,166,206,173,52,140,
+253,246,167,108,93,221,33,86,48,13,102,19,194,233,55,56,236,205,145,147,243,5,72,138,32,129,138,163,168,120,142,60,97,106,76,168,71,135,100,185,
+29,4,7,27,196,17,212,224,2,76,199,35,4,104,73,96,210,172,37,39,79,139,214,120,61,38,55,190,241,188,179,243,164,200,22,118,97,153,250,41,
+247,192,33,44,250,47,23,72,64,137,243,69,154,43,74,111,185,255,226,200,157,250,111,219,117,95,226,54,144,18,211,114,100,116,34,60,76,101,141,10,
+22,168,217,1,153,194,15,109,31,65,86,176,157,112,93,142,96,51,249,188,129,53,169,168,44,102,19,136,103,53,35,40,85,8,151,177,11,178,251,110,
+239,160,18,188,20,5,138,194,229,16,135,132,27,6,200,112,224,12,72,3,121,23,83,213,116,53,194,206,53,136,86,104,123,121,232,245,232,115,152,181,
+6,6,50,133,17,61,151,105,1,26,18,88,152,94,207,137,255,201,152,136,254,27,174,254,123,216,115,143,17,174,230,82,77,249,61,23,118,138,222,5,
+230,37,81,165,245,208,53,144,161,144,148,108,84,128,33,200,87,201,101,245,132,73,170,78,210,110,184,108,174,18,212,48,131,68,30,194,233,176,108,132,
+54,209,246,21,102,68,132,45,135,204,11,133,44,249,249,163,144,44,4,28,212,215,9,21,10,233,60,16,117,150,115,68,99,101,181,60,182,100,154,164,
+64,73,22,10,212,68,181,201,100,76,21,100,239,127,133,254,230,243,49,245,30,243,251,111,45,166,4,243,34,167,14,110,246,132,221,236,173,38,36,116,
+14,2,53,129,156,23,51,209,93,150,2,96,195,52,11,20,175,101,23,112,130,175,65,129,48,122,14,171,91,158,30,124,22,7,132,157,165,211,82,168,
+24,34,163,103,36,49,26,241,81,71,102,100,141,59,40,105,137,39,72,84,171,140,26,237,1,219,101,116,57,6,100,68,39,151,226,181,229,31,92,211,
+82,95,130,166,179,152,165,180,25,153,211,91,254,47,248,126,157,215,231,60,135,247,223,41,231,145,1,3,141,131,129,206,212,166,214,163,122,162,62,7,
+13,26,162,66,156,5,67,113,37,135,39,96,221,68,181,200,72,34,103,146,78,211,13,131,13,12,228,226,147,200,197,9,77,54,201,52,12,0,86,72,
+74,147,52,22,223,60,236,32,146,32,106,164,217,201,10,169,104,28,33,16,37,27,223,51,103,48,180,97,54,175,164,88,57,16,193,196,253,132,248,91,
+204,171,6,9,99,36,249,159,206,255,115,33,195,126,171,215,127,69,239,48,128,224,182,231,106,235,97,109,206,220,173,45,74,72,252,144,243,102,163,173,
+242,88,216,193,42,20,152,28,138,85,16,144,181,15,76,42,153,144,155,128,98,46,242,246,43,23,72,243,107,112,45,76,195,156,102,76,163,198,42,69,
+197,3,165,120,177,200,131,138,65,65,29,78,206,48,59,147,199,110,150,205,228,158,133,8,222,7,144,231,98,9,78,213,76,102,91,56,161,146,165,201,
+37,183,213,107,255,47,251,30,70,235,244,158,35,252,135,186,244,68,74,29,193,197,192,235,97,69,109,72,192,178,171,63,117,43,1,1,110,154,97,232,
+35,64,13,174,129,140,113,131,68,208,235,1,210,182,136,228,84,46,110,161,154,69,228,5,26,187,176,5,7,44,37,0,243,227,205,3,189,213,75,168,
+86,68,101,229,186,185,225,115,49,142,218,39,28,13,110,130,220,110,27,27,132,199,201,65,161,156,179,15,72,179,47,195,110,226,167,181,54,131,37,236,
+37,253,111,223,255,23,49,223,127,97,225,63,146,247,19,66,96,187,182,215,188,24,236,123,23,174,202,216,209,49,146,3,54,211,17,149,96,49,189,148,
+234,68,0,64,37,28,208,76,126,242,204,45,22,22,9,219,131,33,139,146,22,198,113,233,3,240,17,245,7,215,72,212,92,146,35,97,118,144,1,100,
+32,206,218,96,93,11,42,24,178,116,146,243,76,111,33,97,232,132,66,166,77,200,229,149,97,103,36,80,54,35,23,88,8,186,24,204,31,5,240,127,
+151,249,253,111,138,242,31,164,253,151,205,113,132,78,204,122,121,142,157,93,44,77,42,83,218,251,44,202,64,10,100,172,5,3,50,233,11,147,72,218,
+13,35,24,192,171,32,202,24,28,68,51,88,2,48,42,144,76,178,38,240,185,20,97,76,32,100,188,204,53,29,246,29,65,90,41,144,161,48,156,44,
+179,186,105,117,209,32,166,168,222,52,216,228,20,78,192,7,149,207,92,141,121,19,25,91,60,252,171,194,211,112,208,82,230,128,60,199,251,95,239,246,
+40,189,87,249,110,187,248,108,151,128,55,86,151,147,146,223,225,231,90,109,64,36,216,201,8,117,27,24,28,163,16,183,154,124,84,169,166,212,123,142,
+54,18,200,52,233,104,168,249,236,44,98,149,120,173,77,49,241,67,69,168,17,2,2,58,77,100,100,12,103,63,198,61,25,43,142,137,56,220,131,133,
+44,66,21,20,250,230,128,89,87,18,36,153,39,156,187,168,34,77,187,36,35,96,42,222,18,192,237,48,240,208,15,85,65,229,63,127,245,62,167,91,
+237,190,179,248,175,117,247,80,215,13,231,201,243,163,111,224,242,101,169,83,66,210,228,23,147,142,103,25,67,93,70,144,146,210,217,46,166,233,67,215,
+2,234,44,230,139,177,67,89,7,75,172,207,212,65,162,40,5,76,4,121,196,7,195,220,89,134,32,4,48,39,108,9,26,59,15,64,100,137,241,33,
+75,70,203,22,201,220,20,62,76,156,97,49,178,216,218,229,162,135,94,219,43,3,6,225,148,252,244,77,128,118,55,191,7,254,198,207,89,240,95,182,
+234,63,220,79,100,171,105,58,17,250,185,211,243,56,48,14,215,154,115,64,220,141,245,238,51,83,88,9,168,108,38,189,240,99,65,16,2,80,222,154,
+100,221,4,9,39,39,106,178,50,194,208,0,66,126,170,126,8,77,190,73,117,203,105,57,64,179,177,198,133,171,108,17,139,138,123,44,107,129,229,78,
+41,13,53,6,162,54,154,158,64,146,20,72,75,42,201,232,51,49,1,35,206,60,137,61,8,76,244,191,141,254,47,244,124,150,115,235,191,168,253,87,
+60,146,208,220,206,133,123,125,109,29,156,164,188,184,187,76,9,68,211,152,58,75,120,163,182,24,185,168,120,133,42,162,241,79,208,97,185,29,67,114,
+162,48,252,86,4,204,197,184,28,97,26,25,72,185,73,60,70,6,131,11,204,114,42,171,181,252,38,205,226,189,5,120,25,170,115,119,24,220,247,107,
+128,26,82,53,130,98,152,250,129,129,212,218,41,149,203,80,202,85,146,82,208,249,90,173,45,81,118,8,171,124,255,237,255,111,196,113,159,204,126,179,
+214,123,107,98,69,52,183,105,246,170,237,233,79,86,190,192,200,26,191,176,162,163,127,40,2,55,49,177,144,89,30,129,30,0,140,13,37,54,69,116,
+61,246,134,114,174,242,213,80,131,233,24,206,39,16,44,32,8,204,189,208,182,49,24,56,224,37,198,31,156,173,128,130,202,214,12,141,110,113,195,53,
+25,254,107,79,146,202,204,59,112,217,72,104,76,78,243,38,176,67,209,193,215,206,79,184,11,69,63,31,254,111,238,113,125,119,158,254,155,241,95,97,
+206,61,56,110,143,110,147,171,167,151,66,66,150,27,3,8,72,18,67,12,73,160,110,218,159,60,126,175,5,135,128,136,62,35,162,232,106,162,220,71,
+160,26,197,12,148,29,198,141,242,0,192,91,88,168,203,103,208,5,55,130,208,207,65,164,106,208,122,89,6,43,149,158,57,18,34,62,73,40,5,148,
+51,4,213,145,108,186,22,146,29,193,117,208,237,38,233,35,200,59,52,80,68,83,152,255,47,252,239,183,156,236,191,188,243,31,232,177,153,72,202,216,
+251,26,120,124,78,5,12,233,32,48,35,142,6,48,116,83,65,118,178,68,26,128,125,23,4,212,180,130,54,197,21,9,185,219,105,204,47,64,108,233,
+39,74,204,204,8,199,232,37,221,74,100,69,60,41,98,226,59,14,138,51,14,91,21,214,246,17,109,109,175,222,59,48,110,74,205,176,137,56,4,239,
+46,246,19,233,38,176,53,134,176,177,8,211,21,35,91,134,143,168,25,103,27,254,7,241,40,228,191,142,253,7,214,124,39,1,132,145,200,219,120,186,
+88,217,252,26,84,55,179,11,158,136,57,29,135,174,86,142,90,229,161,169,122,104,121,39,100,96,163,134,158,46,96,130,184,52,15,74,16,155,172,86,
+13,207,1,74,126,194,190,194,13,52,174,3,47,96,133,220,228,40,66,99,17,200,29,99,113,42,120,234,49,204,171,112,87,112,16,110,5,159,28,192,
+120,193,77,51,37,58,152,104,20,225,12,148,10,2,130,14,79,203,255,119,227,112,28,103,243,159,93,250,206,82,218,90,118,165,158,204,174,206,101,204,
+184,98,98,200,170,16,32,72,68,5,49,246,1,221,148,113,63,16,108,28,129,182,67,154,17,153,197,100,77,41,2,17,24,104,102,160,223,20,187,194,
+64,166,150,189,15,0,74,189,180,53,185,73,44,89,140,55,71,209,63,119,117,126,241,217,163,114,86,174,3,71,182,50,186,199,73,38,106,139,27,112,
+75,3,12,117,1,18,116,248,40,218,161,150,113,63,225,255,6,166,83,248,207,209,125,71,195,112,24,40,252,173,215,145,163,143,157,194,163,75,111,28,
+250,36,145,10,12,173,162,180,50,150,236,15,80,219,78,215,74,135,117,60,165,226,181,0,141,201,166,126,136,12,173,17,18,175,121,10,118,185,108,61,
+99,149,148,185,206,55,72,214,6,186,36,41,179,208,54,77,214,228,45,222,33,58,14,67,31,152,185,85,27,40,50,92,21,52,59,32,242,144,166,89,
+18,102,84,16,115,71,193,82,59,157,242,255,233,120,220,134,219,246,95,200,122,47,77,41,81,67,114,155,214,192,120,16,246,175,75,177,142,126,201,50,
+213,131,195,206,112,186,231,176,176,203,51,49,19,87,246,200,97,151,224,164,105,48,35,12,13,224,120,73,85,109,142,216,99,103,163,48,250,45,125,148,
+199,71,174,90,164,80,2,200,214,69,153,174,201,203,58,200,208,34,133,52,96,91,250,73,57,189,181,43,221,135,39,108,165,192,144,40,6,3,75,97,
+189,196,99,102,18,51,31,20,207,43,254,47,234,196,224,191,5,253,151,57,250,46,80,168,83,184,180,94,13,141,187,221,237,117,251,69,164,23,65,81,
+170,28,154,86,139,35,72,9,187,137,50,85,148,166,162,150,70,192,78,89,208,96,194,1,9,34,30,130,222,137,9,69,13,175,92,88,90,156,49,23,
+12,237,195,86,209,108,7,175,32,4,211,151,129,66,167,84,44,160,24,25,8,113,65,2,152,145,186,199,198,28,44,61,13,21,94,115,133,128,170,230,
+109,160,33,230,55,126,247,248,158,61,151,236,60,55,238,62,99,228,0,143,37,15,145,5,171,204,175,123,63,38,178,11,137,222,3,101,99,146,194,215,
+97,108,12,179,100,85,156,132,109,20,238,10,134,121,241,17,34,215,203,98,69,178,90,60,246,55,202,102,196,40,36,88,58,214,145,152,83,130,201,12,
+78,192,200,217,154,68,33,216,206,37,4,254,184,236,124,116,22,150,80,200,33,99,23,214,75,140,6,177,171,2,206,51,181,196,98,104,16,183,209,110,
+98,127,147,253,92,143,41,244,31,209,126,115,117,224,129,196,92,224,204,231,205,241,114,106,49,100,76,135,152,62,126,217,138,33,177,113,76,104,177,42,
+25,67,188,78,2,106,46,251,3,134,146,216,188,14,205,50,54,241,90,126,18,172,52,32,75,93,178,80,43,206,85,86,199,217,53,40,134,8,141,156,
+226,18,152,158,34,254,42,190,17,64,99,108,71,54,82,169,156,158,147,15,44,33,120,242,199,99,139,88,221,23,129,87,174,193,207,73,133,253,159,248,
+152,87,95,37,248,239,158,254,99,61,20,13,140,124,14,78,222,30,78,116,141,29,134,174,80,91,64,233,17,131,193,96,68,174,114,217,43,100,114,53,
+6,161,228,130,214,79,145,84,68,32,9,81,182,219,24,5,137,205,8,24,29,0,16,164,227,3,86,144,36,81,68,185,195,32,149,63,66,201,4,220,
+99,242,81,86,246,212,228,36,34,77,49,128,70,64,162,84,206,195,170,32,16,10,251,236,171,34,71,109,182,183,127,233,254,124,103,214,124,199,156,255,
+158,172,229,7,84,141,159,181,173,203,181,103,118,193,154,13,30,203,79,195,90,213,9,30,152,92,93,5,11,7,111,15,95,216,15,64,113,190,243,151,
+205,109,120,13,221,49,40,60,95,57,161,170,26,198,40,60,11,4,16,88,184,5,17,48,72,239,122,238,95,154,226,212,28,4,197,48,240,176,52,139,
+197,10,139,174,106,4,232,136,196,170,97,22,135,146,185,21,53,42,201,165,11,130,234,40,240,7,246,191,187,252,123,151,223,215,126,51,209,127,77,1,
+32,172,30,86,15,163,73,63,199,140,6,158,150,153,40,114,34,40,29,168,52,129,120,128,240,164,149,17,2,56,139,135,55,6,209,168,157,142,62,57,
+105,39,92,30,218,60,240,164,101,1,10,16,72,168,251,12,41,193,1,10,102,151,170,131,148,175,121,71,142,204,230,52,50,197,201,59,92,1,214,150,
+114,82,158,18,134,56,130,205,45,196,189,2,22,50,0,157,180,66,90,71,97,221,247,255,197,250,126,107,184,251,143,236,60,103,197,1,138,207,174,229,
+218,234,75,227,93,130,200,225,159,153,83,0,12,193,243,152,13,191,5,107,65,137,132,102,128,51,82,146,139,236,51,47,164,165,193,133,85,2,226,78,
+56,24,216,55,67,68,196,53,149,194,16,102,105,54,119,85,126,122,50,12,24,98,198,70,32,185,148,115,65,145,190,151,56,32,216,192,227,140,134,158,
+193,202,19,108,172,124,93,113,19,102,6,174,181,180,57,139,154,248,159,199,252,105,255,33,250,79,85,254,75,125,220,84,152,79,183,183,87,157,126,230,
+165,155,133,164,8,73,168,11,64,164,8,73,98,45,224,128,216,176,89,18,168,172,96,211,43,129,161,6,124,161,183,202,67,36,66,126,90,37,29,4,
+156,16,134,49,208,96,39,50,174,17,57,60,202,183,17,82,104,178,54,151,246,10,64,194,207,43,36,190,43,23,162,177,96,138,191,88,175,59,195,59,
+192,246,93,46,90,190,194,142,195,3,109,71,55,249,223,236,215,240,159,61,245,223,148,252,86,152,228,118,31,107,37,229,232,65,116,119,26,216,155,68,
+226,195,49,49,0,206,161,186,194,36,145,206,49,23,3,130,194,176,88,148,77,117,157,246,142,90,4,193,193,227,92,9,46,156,98,226,96,220,207,2,
+111,13,11,37,133,172,171,150,20,212,36,68,75,135,175,50,188,53,185,20,193,76,135,84,125,108,163,150,146,117,82,96,45,162,192,38,191,196,77,197,
+37,69,14,121,192,186,86,31,59,253,79,90,211,239,190,35,239,191,164,208,112,211,162,218,230,240,45,115,172,99,227,218,168,42,88,187,52,133,157,31,
+20,6,154,4,92,67,23,113,7,204,152,12,96,113,20,5,74,143,6,8,171,132,165,138,55,48,202,100,83,200,89,2,228,94,71,166,97,143,152,8,
+205,160,136,92,22,110,128,249,130,241,52,201,74,175,156,78,16,251,11,61,230,231,0,228,174,50,87,7,224,183,98,46,180,184,202,121,137,59,44,30,
+27,71,11,253,175,232,195,118,223,73,247,223,148,250,203,69,14,183,55,44,190,28,76,46,174,195,159,1,44,156,56,136,153,34,3,98,19,176,38,4,
+12,195,212,37,237,178,241,6,149,146,142,171,196,112,120,76,93,97,48,70,229,149,133,114,177,1,51,39,111,163,195,52,133,125,111,97,103,100,172,120,
+166,210,52,20,45,179,126,179,191,132,8,0,184,86,206,204,203,71,214,106,247,90,184,76,54,158,112,150,38,242,191,49,58,203,63,206,80,174,218,227,
+63,177,254,127,135,229,63,37,235,63,53,252,149,150,235,10,125,109,222,204,206,165,29,184,27,216,225,99,29,130,21,48,205,177,244,205,165,210,87,106,
+116,82,226,152,206,61,127,178,131,110,154,69,64,181,20,50,69,111,51,32,53,91,89,169,88,38,82,116,215,177,195,163,100,167,68,199,31,18,54,82,
+85,128,177,99,143,98,232,10,71,176,6,6,6,80,251,107,177,214,19,106,141,144,4,65,66,119,180,211,48,13,95,21,25,15,25,249,223,202,253,222,
+67,154,254,243,211,126,195,227,31,14,159,144,240,41,244,112,244,249,152,204,236,35,145,192,6,37,116,56,153,8,40,215,71,131,165,52,161,123,135,116,
+154,124,148,24,64,68,211,186,157,104,69,128,80,228,148,82,192,10,26,100,162,38,50,83,233,23,230,60,79,41,161,196,39,46,170,46,170,207,25,62,
+120,152,24,218,136,85,1,133,185,160,200,236,182,120,97,50,177,64,6,143,81,59,148,185,134,54,24,145,245,201,246,127,141,255,147,134,238,62,43,232,
+63,130,252,6,144,220,166,156,190,221,110,197,78,44,187,150,165,112,25,248,96,64,80,174,146,163,162,23,23,130,133,112,140,114,161,175,234,25,139,67,
+32,254,46,34,238,168,81,176,72,109,143,153,6,28,125,4,40,176,146,13,194,5,98,89,73,40,168,23,18,166,20,21,55,17,27,121,63,46,234,106,
+92,172,195,80,138,193,64,43,36,93,83,147,58,174,111,12,28,52,189,144,3,96,91,220,106,254,111,251,30,151,33,248,79,73,252,247,214,120,162,214,
+218,145,221,40,46,86,229,5,140,44,204,49,121,156,246,134,65,99,216,194,225,130,186,25,2,62,240,233,83,192,197,24,139,130,66,164,229,109,6,104,
+114,81,125,167,35,0,112,60,69,26,128,112,88,120,198,83,115,81,164,19,166,109,200,240,209,38,2,169,104,96,234,57,170,83,64,145,202,35,3,31,
+125,58,118,250,108,172,82,86,211,100,142,19,83,24,8,252,35,25,41,212,128,254,111,241,191,173,130,236,63,172,238,191,113,251,72,222,147,102,13,191,
+141,13,145,167,25,169,105,127,0,77,12,117,142,25,201,219,8,146,19,21,246,21,117,209,54,150,246,132,192,53,182,198,142,72,174,30,81,43,214,17,
+211,36,165,160,94,64,204,51,91,85,171,218,72,143,186,203,176,78,46,163,39,12,110,10,61,82,160,50,44,18,91,222,89,205,0,137,168,177,60,49,
+17,112,2,134,76,168,60,172,83,91,5,168,10,5,44,54,53,223,247,127,83,203,249,79,156,241,31,232,190,19,76,99,49,207,163,159,214,223,170,213,
+161,173,96,22,109,16,72,92,81,211,102,133,16,70,144,17,34,8,207,29,172,187,188,70,81,56,210,82,39,2,129,165,128,162,145,144,153,56,88,211,
+88,96,143,67,202,96,113,8,204,167,85,11,77,102,97,132,125,130,121,220,51,17,12,99,46,236,10,171,148,114,16,249,26,100,113,115,138,180,249,44,
+27,162,213,177,193,92,4,67,76,181,233,95,111,253,223,185,221,98,63,228,185,239,201,125,195,5,116,28,172,73,94,142,53,203,186,215,204,69,218,197,
+52,115,24,188,82,32,201,224,34,224,144,53,80,214,64,58,1,164,66,69,84,177,134,21,185,205,15,102,58,18,110,97,70,22,89,20,174,99,34,159,
+28,156,40,147,165,212,18,82,90,45,209,153,169,18,233,25,170,44,131,99,204,83,140,51,138,225,112,144,235,146,178,127,142,209,154,8,44,165,77,196,
+13,1,251,76,109,182,70,15,253,15,229,193,232,63,138,242,95,205,124,100,196,164,151,35,50,71,102,119,169,68,86,212,251,135,44,229,17,204,98,231,
+174,49,102,135,207,100,92,92,76,136,0,232,216,19,79,153,207,206,19,126,128,218,19,58,13,13,164,120,8,163,36,11,66,172,12,178,182,16,146,181,
+16,160,69,4,85,78,194,147,99,52,9,58,64,32,14,172,141,188,110,109,197,141,18,54,81,246,6,233,99,21,156,118,73,141,0,245,202,234,36,209,
+99,126,103,252,253,125,55,172,253,135,204,126,211,134,88,233,30,204,206,54,95,78,85,173,28,116,216,73,89,226,96,29,61,88,88,137,117,78,229,10,
+128,22,17,65,64,161,7,176,11,34,78,98,94,111,77,46,28,178,72,187,198,48,181,137,203,224,56,185,166,134,192,137,102,65,16,115,33,155,195,53,
+180,202,205,74,162,11,109,149,11,125,14,53,128,170,60,5,91,195,44,20,211,114,186,235,185,236,108,128,130,193,98,130,47,57,147,212,255,229,114,161,
+254,91,241,95,45,252,183,9,13,92,103,165,17,137,149,171,214,208,95,192,140,85,127,0,9,112,122,254,90,5,249,69,2,52,60,81,115,227,212,26,
+54,25,241,74,82,246,21,233,18,136,163,205,25,143,160,189,176,6,53,99,18,108,10,7,155,182,145,130,86,180,16,231,78,229,248,76,25,185,202,150,
+132,3,33,77,39,21,37,157,199,99,92,22,10,154,47,49,161,104,94,11,39,125,139,142,32,168,73,161,35,132,250,127,241,254,124,247,25,248,15,121,
+254,203,105,65,76,155,157,85,224,210,102,249,220,214,253,1,217,154,72,215,148,249,232,51,134,129,47,28,4,114,154,170,185,200,154,231,36,89,58,82,
+237,84,205,246,54,122,93,97,103,114,85,174,164,47,114,23,35,38,173,105,140,161,180,221,213,0,129,138,122,78,98,20,140,198,247,138,195,158,64,148,
+35,169,59,205,46,211,2,184,168,105,106,218,165,163,71,132,37,6,201,248,61,246,132,227,41,77,172,223,238,255,39,35,9,255,69,166,252,183,248,162,
+175,175,184,51,183,119,53,175,101,200,229,89,28,91,46,250,146,174,98,7,85,194,238,178,227,130,52,30,17,52,221,242,114,96,166,174,113,19,240,52,
+143,67,41,116,28,76,109,66,173,207,5,127,88,134,78,226,37,1,232,183,136,217,43,131,197,97,229,161,209,13,121,175,178,58,178,135,29,102,217,94,
+58,54,239,32,58,124,85,98,151,179,8,201,166,118,141,0,0,180,146,175,157,164,91,253,191,200,253,95,164,250,175,37,250,143,209,90,80,24,95,71,
+114,159,103,46,245,122,178,113,101,10,212,113,125,116,110,97,208,5,84,142,46,20,226,122,36,233,203,96,49,41,10,9,89,107,68,38,102,56,69,108,
+210,248,11,156,84,121,67,2,2,159,65,7,73,55,136,219,234,30,215,243,27,89,72,244,144,152,185,200,243,193,71,164,110,144,236,177,176,99,132,134,
+139,172,167,162,44,229,132,28,54,31,45,22,126,49,248,5,131,35,57,126,175,249,31,107,93,239,60,87,238,63,180,162,210,27,121,213,138,159,213,202,
+143,189,62,102,36,192,194,50,120,194,2,140,192,65,166,38,66,239,69,115,140,195,220,48,187,96,40,9,18,192,217,140,150,171,26,144,114,43,252,2,
+52,177,202,70,133,92,164,192,50,202,71,7,128,145,88,86,38,210,44,18,184,230,38,74,196,99,248,75,85,196,11,21,98,232,196,8,131,7,112,216,
+249,3,21,179,20,180,86,241,208,144,175,51,57,239,55,255,51,173,159,244,95,29,247,95,203,104,57,196,73,237,86,200,232,238,67,87,192,155,75,19,
+4,44,9,249,104,71,105,19,201,39,194,229,23,131,60,212,23,21,175,128,54,254,168,86,78,176,42,245,83,58,237,218,105,72,115,141,42,103,147,140,
+20,149,212,92,19,50,70,139,183,198,83,148,66,249,252,93,180,152,168,76,90,9,166,34,148,2,98,170,54,144,133,90,134,74,98,151,161,174,145,129,
+152,46,20,113,19,7,66,96,127,151,254,78,18,67,232,191,41,248,239,162,170,104,56,79,102,106,238,198,86,157,42,106,186,56,129,234,99,7,198,10,
+40,69,158,43,106,241,164,92,181,94,106,214,56,165,42,42,74,113,146,28,63,41,135,3,53,54,42,115,27,138,149,28,54,73,105,85,67,83,211,101,
+232,26,102,240,208,104,130,137,9,79,16,166,1,125,44,133,54,118,72,120,73,75,152,162,38,7,161,36,202,61,133,54,111,13,10,36,32,245,6,206,
+41,89,66,59,245,63,199,233,247,93,55,236,191,5,248,43,204,243,216,117,232,247,243,235,228,98,92,161,45,129,116,4,76,32,38,68,66,176,67,49,
+165,61,8,53,141,196,218,157,246,77,193,211,173,149,94,186,52,93,236,53,110,65,236,158,98,110,41,233,98,131,214,67,128,192,114,124,54,102,169,234,
+41,59,197,244,245,81,98,196,158,145,134,112,236,240,81,226,98,19,141,10,41,64,18,171,223,8,36,68,186,99,147,173,139,63,20,25,143,143,255,19,
+223,184,247,223,105,251,15,85,229,38,136,172,212,196,210,163,203,218,152,71,141,45,6,233,236,20,238,8,145,122,168,212,185,44,9,131,19,243,72,169,
+240,82,242,212,112,197,211,193,30,167,76,82,20,48,24,7,36,1,28,122,98,202,237,132,14,114,165,84,9,40,8,18,165,31,96,242,20,236,86,2,
+50,173,64,34,81,186,108,76,145,180,114,211,182,148,164,234,139,187,84,145,125,86,22,122,13,65,231,35,140,53,47,212,254,231,233,80,115,159,138,248,
+47,232,58,44,66,9,241,242,53,121,21,117,170,102,202,130,131,90,209,108,112,20,137,146,188,78,168,93,45,49,209,168,154,103,116,5,212,176,141,69,
+17,30,69,48,134,33,11,141,205,115,250,6,165,133,27,52,32,17,172,63,13,141,116,45,156,147,49,11,241,27,121,228,41,200,164,90,94,201,104,114,
+130,77,168,56,196,129,182,193,3,59,40,176,48,164,33,31,55,63,32,244,104,226,184,223,220,254,213,223,33,245,159,160,252,87,49,222,49,148,192,210,
+210,167,177,198,175,109,175,10,189,1,241,198,71,97,165,103,14,97,112,1,230,100,163,70,228,177,113,0,6,16,139,146,151,116,177,44,189,228,233,17,
+176,2,78,140,28,2,63,101,42,69,76,228,54,46,107,39,176,114,197,110,91,10,217,166,157,224,96,18,112,136,215,59,134,77,133,213,103,241,20,237,
+26,104,241,197,18,205,223,29,60,37,173,214,63,69,90,21,211,112,249,31,141,254,7,51,117,249,15,85,247,159,204,73,102,55,245,87,51,250,209,218,
+83,117,231,78,61,133,16,118,64,131,187,194,37,140,71,202,45,68,69,172,210,208,64,216,61,134,110,78,203,3,72,102,94,194,230,18,135,117,177,41,
+152,218,182,25,13,26,216,236,162,240,236,40,224,139,128,99,9,23,81,86,215,1,149,76,53,48,81,112,81,113,204,208,221,43,201,242,24,24,135,179,
+147,105,155,39,75,44,171,51,176,171,92,164,155,11,63,153,253,95,133,178,249,111,81,155,242,223,196,93,77,36,98,206,255,3,23,50,190,245,186,232,
+17,103,193,144,40,159,57,110,114,136,137,209,102,154,83,218,89,180,24,69,229,124,65,67,165,201,73,98,107,176,181,139,72,147,130,171,166,90,177,138,
+91,196,36,13,217,96,225,38,96,141,61,26,153,233,195,41,218,101,115,20,242,198,72,211,67,149,178,161,83,4,133,160,209,160,146,188,19,3,154,118,
+193,248,105,171,86,129,74,167,244,255,198,248,82,255,65,234,61,71,252,55,12,161,228,122,109,157,202,187,26,153,114,23,48,147,45,19,155,136,94,232,
+168,73,98,40,26,194,59,40,218,61,99,85,70,40,241,149,112,134,43,98,130,39,0,193,218,233,24,40,80,84,24,87,144,5,89,156,138,2,156,238,
+42,140,108,60,241,8,183,185,42,153,147,19,87,115,78,91,2,162,173,64,197,160,209,80,120,42,16,50,154,254,18,70,33,75,94,35,43,0,14,125,
+69,150,199,39,251,159,199,179,234,191,29,243,31,142,240,222,83,149,240,222,52,246,54,239,6,157,126,52,193,28,110,130,254,226,36,108,176,240,33,99,
+143,70,136,144,82,36,242,109,110,122,150,98,45,32,215,7,206,211,99,225,138,144,89,54,58,11,15,85,51,28,26,150,17,1,70,15,64,65,64,188,
+145,16,57,11,204,158,42,190,142,232,181,154,73,230,46,29,112,59,43,149,202,219,42,103,51,170,179,52,134,160,217,1,66,143,73,209,78,180,161,107,
+249,127,231,237,244,31,21,252,151,142,252,119,121,3,61,171,55,7,137,165,181,47,102,181,198,206,128,17,116,177,12,139,160,155,199,74,216,72,168,90,
+178,26,149,113,24,90,235,57,163,80,174,152,140,28,172,209,3,204,83,66,172,118,113,236,68,12,160,85,236,33,23,182,85,159,148,137,156,157,124,245,
+89,229,96,71,21,67,32,85,65,114,20,92,14,50,132,44,48,26,30,27,74,136,42,192,134,18,43,23,28,238,83,6,65,239,201,255,43,198,162,246,
+223,227,187,175,215,109,36,38,181,35,51,49,122,113,181,179,224,229,74,75,186,18,28,192,154,69,170,7,167,176,98,17,206,58,61,1,116,37,129,7,
+22,40,131,40,213,16,114,80,243,70,76,157,150,133,45,71,33,30,224,138,92,19,84,2,77,40,15,2,170,13,80,168,48,224,81,131,98,50,8,101,
+45,209,7,161,148,70,201,65,142,93,2,128,156,51,115,58,11,121,101,44,16,128,12,162,109,159,35,255,27,237,248,236,151,249,111,138,248,79,33,154,
+71,62,203,59,179,1,129,218,209,110,211,223,114,184,139,54,195,23,2,152,102,22,58,174,16,140,4,220,209,118,182,217,249,70,84,232,133,22,16,118,
+62,210,70,88,117,13,100,140,50,122,56,128,113,33,83,81,94,194,101,176,169,16,4,122,121,92,174,17,75,23,43,19,179,192,84,210,11,135,190,179,
+128,38,70,10,213,67,33,163,199,31,154,14,44,161,66,241,215,244,72,66,231,238,127,196,254,143,156,204,127,1,244,31,176,216,112,213,50,211,124,25,
+206,22,15,10,39,31,57,106,109,148,74,224,199,233,145,47,172,167,138,137,158,42,221,144,198,102,129,42,155,84,152,74,241,131,206,0,50,224,196,123,
+97,72,216,69,187,136,122,84,227,5,20,251,74,217,98,40,216,69,164,122,242,68,144,86,230,77,11,170,207,231,140,192,170,85,135,152,49,39,12,148,
+145,88,102,107,137,19,134,42,190,146,100,145,228,44,124,207,240,255,119,109,214,125,71,243,222,155,176,227,146,192,131,175,208,179,151,224,225,48,243,185,
+13,204,17,240,4,149,20,84,4,26,6,173,150,207,81,190,5,3,105,133,120,250,108,145,192,165,142,196,217,66,184,77,71,77,22,232,173,107,161,210,
+160,209,77,79,156,211,89,146,84,9,153,2,117,120,164,45,91,164,54,254,250,118,32,181,62,58,197,112,52,49,214,167,154,5,42,73,12,192,1,99,
+143,27,146,187,148,38,31,31,127,253,31,243,60,182,27,247,159,53,251,141,215,37,67,0,207,155,81,195,194,224,197,227,99,167,90,197,78,184,4,126,
+105,180,45,229,60,20,76,160,72,246,70,29,160,10,210,109,34,192,173,201,19,68,0,203,4,146,44,137,43,100,214,134,113,235,23,194,163,178,124,181,
+75,224,75,225,166,88,79,210,78,138,33,14,109,115,156,150,183,52,54,118,9,86,77,196,246,46,80,233,44,200,230,32,235,35,212,62,21,137,224,176,
+32,20,11,15,246,255,31,248,146,255,93,170,255,148,247,154,111,56,212,140,92,13,157,203,221,56,119,56,187,106,56,122,100,229,216,52,54,226,3,27,
+96,227,63,182,173,26,129,76,68,123,225,237,167,241,218,250,41,50,20,77,199,174,20,81,25,193,213,228,34,53,45,34,161,79,20,15,142,177,92,72,
+60,125,101,172,52,120,1,192,42,78,32,44,61,166,23,109,94,80,44,60,65,106,249,129,128,233,247,144,175,131,66,205,14,63,27,89,14,72,255,133,
+253,79,198,191,220,127,152,242,31,101,244,140,35,138,181,163,161,187,167,83,155,46,244,197,43,227,224,149,198,31,138,20,46,57,137,99,1,80,86,216,
+109,241,140,99,166,100,132,155,130,219,227,0,233,122,201,245,65,193,148,93,86,240,172,41,84,7,39,84,68,47,136,109,22,49,195,18,237,244,157,61,
+16,1,152,26,9,23,70,73,75,83,178,19,7,8,253,115,118,71,69,213,39,76,28,44,161,247,50,199,205,182,210,234,60,15,250,63,131,75,228,190,
+19,234,62,243,246,7,228,135,159,147,192,199,207,206,231,69,35,137,78,240,153,115,240,74,39,232,167,43,224,6,12,16,1,107,200,50,96,23,23,40,
+144,214,30,24,52,205,145,212,247,213,111,12,4,66,108,137,226,89,218,104,186,231,225,165,138,196,81,132,176,194,174,106,49,131,216,122,203,56,165,168,
+97,0,197,92,168,36,245,84,57,165,77,233,50,122,164,147,47,10,15,132,133,4,74,111,81,183,206,254,7,248,219,127,194,121,111,206,123,47,184,220,
+59,74,131,26,175,54,11,129,141,46,142,126,7,53,78,154,247,24,25,35,146,10,160,20,201,91,190,121,131,164,126,36,0,226,117,146,230,221,33,147,
+170,97,71,44,214,171,31,96,105,232,22,224,145,61,44,84,240,197,71,212,22,114,194,12,194,11,58,169,120,40,183,89,156,48,248,120,97,4,80,35,
+85,129,37,17,2,9,34,8,43,91,98,47,133,156,187,200,69,201,218,71,235,127,39,251,216,126,115,230,190,243,238,190,51,138,66,220,124,106,28,109,
+171,187,17,178,240,96,95,77,152,52,214,242,134,32,66,251,35,228,6,138,44,189,131,147,64,205,142,68,100,116,124,161,120,188,133,190,42,108,148,164,
+24,96,51,92,29,17,153,28,5,140,32,36,3,211,71,218,96,230,26,202,106,232,4,169,134,173,172,175,36,177,170,132,75,78,61,156,171,103,69,71,
+146,196,230,22,160,72,150,154,247,96,199,22,106,251,99,57,244,255,161,245,34,57,143,200,126,195,233,181,92,64,169,52,221,121,212,250,121,79,86,178,
+28,164,123,37,160,206,218,78,213,53,5,52,221,130,118,10,154,151,76,253,225,234,20,142,45,100,14,171,84,41,52,77,98,83,35,154,2,181,206,75,
+187,121,6,72,83,34,229,37,118,16,116,176,195,141,191,160,110,57,121,102,20,166,1,36,98,176,43,84,193,139,141,2,148,227,123,131,166,22,61,162,
+30,201,185,5,91,29,53,10,127,67,253,95,127,61,228,190,219,234,190,195,146,226,36,82,193,207,189,210,132,203,152,202,146,189,188,192,216,99,96,140,
+26,50,73,83,202,50,25,75,153,43,216,0,178,90,59,135,48,68,230,209,32,143,130,14,234,135,89,145,53,5,11,32,2,86,187,63,41,23,17,27,
+112,212,176,115,2,94,203,98,109,134,173,38,41,50,242,83,187,142,127,32,205,194,114,38,18,176,151,10,192,138,100,173,248,169,248,36,118,146,237,35,
+88,0,11,34,215,220,255,99,171,214,102,63,121,249,239,158,205,109,177,235,31,240,163,176,118,110,222,131,161,125,102,153,90,166,38,160,155,195,11,20,
+104,64,4,179,81,164,213,11,96,141,41,40,10,17,137,87,15,87,174,187,120,45,76,80,38,176,206,66,9,50,154,110,216,217,18,11,17,134,50,148,
+177,5,48,76,196,155,88,33,216,0,16,14,72,18,50,182,25,184,145,96,137,19,88,41,96,241,203,131,150,22,65,152,49,208,42,255,147,253,92,254,
+91,230,190,179,238,62,107,21,109,18,158,117,158,204,109,44,106,184,241,165,198,53,77,31,52,205,241,247,129,94,86,225,20,134,30,92,189,19,118,243,
+142,224,155,196,206,66,148,6,249,107,132,152,156,18,113,116,84,45,153,183,112,140,227,92,20,172,68,157,69,172,212,78,100,183,17,224,20,192,51,85,
+47,20,62,247,128,181,172,206,223,71,190,141,30,41,180,109,182,111,64,4,9,102,128,79,150,94,176,106,23,249,255,214,254,101,150,67,199,127,65,248,
+238,187,76,243,3,61,208,185,71,159,129,133,23,34,12,20,122,6,177,83,248,40,20,137,7,150,44,17,9,7,150,175,12,178,2,125,124,161,24,81,
+135,225,42,110,160,48,182,148,110,23,49,28,178,118,58,206,178,84,180,51,112,144,201,197,156,129,67,4,92,26,136,242,133,224,22,157,43,8,66,61,
+177,233,177,15,167,83,39,88,28,106,101,0,200,10,60,77,161,85,104,11,175,33,205,255,167,235,83,247,95,156,242,95,192,120,101,217,204,12,57,92,
+157,105,93,56,52,117,113,146,240,216,87,65,69,41,116,65,1,89,104,211,203,172,243,220,13,115,172,40,205,247,135,239,54,37,147,166,82,160,24,169,
+42,154,169,87,65,5,19,22,116,113,115,80,153,92,99,12,222,74,164,69,39,47,108,16,184,224,84,248,41,247,9,192,6,61,35,24,40,92,252,64,
+73,52,134,40,113,68,68,62,137,178,171,162,30,52,138,4,228,228,121,63,218,252,203,110,163,251,238,35,249,78,114,192,52,88,252,58,187,28,184,74,
+86,98,17,153,151,227,185,88,193,71,76,7,166,141,132,64,125,5,62,27,62,163,29,181,193,17,110,226,118,137,248,60,30,193,42,12,31,41,42,89,
+89,170,107,113,3,14,196,75,139,170,22,77,49,48,73,196,70,182,40,100,105,146,197,139,149,0,102,98,148,245,22,46,128,172,8,117,130,240,188,114,
+115,173,8,152,64,122,12,240,39,208,245,252,151,139,217,255,165,231,118,28,23,241,30,155,235,61,130,154,201,186,116,117,54,117,165,105,82,134,118,41,
+37,8,10,42,55,196,83,59,172,24,137,108,206,58,84,48,177,38,134,26,53,99,29,2,81,40,32,137,160,234,154,132,128,62,88,18,12,46,26,133,
+213,222,201,200,54,201,93,96,230,25,159,109,2,192,200,67,173,32,70,158,1,23,138,102,82,126,210,126,58,238,122,36,20,148,12,33,130,43,2,45,
+112,173,98,242,66,14,230,122,31,242,249,216,143,240,219,79,211,123,142,32,116,162,222,54,171,204,186,221,137,127,54,106,118,234,165,1,116,147,53,16,
+109,129,176,103,109,115,96,237,77,198,174,177,91,201,123,236,12,81,51,232,26,130,24,190,154,46,145,12,141,162,136,178,160,152,31,79,41,19,28,157,
+145,115,11,199,13,78,86,186,156,28,83,240,46,105,165,66,206,95,209,6,58,97,137,1,206,196,194,47,36,66,90,28,20,116,253,48,178,103,202,198,
+23,83,47,238,127,147,171,128,239,62,187,242,95,37,170,176,66,94,30,236,174,45,204,157,120,1,50,169,10,137,186,199,139,138,113,102,249,177,148,201,
+199,42,66,20,154,103,37,117,92,77,144,34,49,106,151,77,174,169,193,29,24,80,99,124,53,105,33,230,147,178,54,73,180,93,166,214,233,3,20,168,
+102,34,204,225,182,180,128,225,92,53,10,46,0,228,25,88,226,105,65,17,0,145,56,201,40,185,136,118,192,199,55,146,73,196,237,44,228,174,124,175,
+236,249,57,205,103,237,190,123,211,124,129,56,105,209,208,126,102,19,58,189,172,168,2,35,215,193,31,18,218,22,88,201,134,44,160,171,102,12,87,198,
+21,12,41,235,65,136,204,195,41,42,97,236,116,251,34,141,109,32,206,1,146,167,67,146,220,229,35,69,97,53,51,195,31,206,78,142,41,15,93,143,
+188,155,68,90,108,116,54,119,32,132,16,67,235,147,174,181,190,122,33,29,245,10,101,2,88,200,9,131,88,201,219,89,232,177,254,95,242,189,91,127,
+193,116,31,128,253,181,7,124,94,76,86,204,61,238,164,92,104,91,245,64,2,199,207,3,111,73,95,84,68,189,4,73,2,196,7,141,20,41,232,168,
+167,168,34,225,0,167,24,132,97,8,20,206,9,192,96,119,217,52,132,3,163,65,5,133,188,1,42,130,186,156,100,92,224,233,213,65,40,110,145,185,
+36,76,113,241,201,135,160,114,113,236,115,112,178,144,176,10,98,12,161,96,68,4,157,128,4,42,167,204,47,215,255,35,224,80,111,190,11,243,29,71,
+232,161,132,43,19,126,175,19,147,25,151,20,63,35,0,80,184,212,193,160,240,21,116,194,193,8,58,90,42,85,45,22,97,243,184,140,237,193,88,118,
+134,77,17,129,140,46,237,240,118,79,106,176,184,229,117,120,34,111,219,8,91,44,148,120,132,140,195,184,78,58,207,0,252,144,72,17,10,162,204,50,
+122,248,169,48,133,195,34,26,4,107,193,1,74,166,21,2,160,82,20,66,211,152,53,55,204,253,159,192,163,248,237,199,235,63,45,184,226,7,70,133,
+187,79,129,193,193,177,83,2,36,72,72,57,32,134,203,21,104,28,205,165,42,97,67,5,139,12,89,153,25,136,21,82,176,128,83,146,74,64,10,146,
+16,71,97,175,246,24,116,67,131,161,61,13,133,184,13,34,122,186,156,148,76,161,41,83,68,41,109,144,185,28,60,49,112,139,137,160,106,113,252,131,
+48,113,206,91,29,128,46,117,96,240,113,244,193,17,166,157,28,175,95,252,175,131,61,190,247,95,162,233,63,69,28,25,72,60,10,60,94,60,102,92,
+128,252,188,80,194,163,82,6,135,192,85,208,5,14,57,9,41,9,54,53,195,233,114,218,123,193,177,237,139,158,42,254,32,124,43,224,9,28,217,102,
+114,136,237,112,0,167,98,133,74,229,162,198,146,68,196,59,226,101,232,238,151,136,2,212,2,4,167,229,37,229,134,185,60,238,16,104,224,160,8,74,
+39,111,4,243,87,9,17,46,33,34,51,246,89,221,63,187,253,40,95,49,117,252,231,216,121,108,99,71,105,78,207,219,197,231,65,86,186,177,50,73,
+59,97,205,182,124,84,56,131,250,76,139,34,135,201,19,2,192,134,79,45,59,89,147,128,2,12,185,192,112,49,148,249,138,154,5,100,224,32,218,19,
+78,114,91,2,42,162,6,82,213,148,148,169,21,129,167,231,160,95,71,195,240,150,233,196,196,8,207,236,15,179,18,72,97,16,110,153,41,95,130,90,
+28,56,180,226,241,154,218,200,83,235,51,191,39,248,92,191,49,238,62,227,211,123,46,232,188,53,44,188,140,186,156,78,30,147,43,27,65,86,152,192,
+195,38,19,130,201,89,180,37,55,138,161,160,185,190,82,252,194,160,81,241,151,247,208,40,157,176,90,104,80,116,243,128,201,136,135,198,78,157,53,65,
+139,174,141,53,77,202,238,141,185,176,193,200,25,46,29,93,117,170,3,132,216,152,8,24,251,201,19,64,199,195,98,241,66,228,39,105,22,145,130,161,
+160,179,100,73,203,38,232,235,186,190,207,238,251,95,17,210,122,15,209,116,222,10,74,230,146,94,189,141,173,120,137,218,185,13,189,64,169,184,192,233,
+90,31,68,242,255,85,133,182,141,29,17,83,60,196,33,18,3,134,169,128,197,235,27,213,176,100,18,222,192,188,2,90,158,139,11,7,190,187,119,116,
+173,60,84,75,66,105,10,188,185,170,22,22,109,52,166,54,138,231,77,167,176,75,27,20,182,10,70,42,60,11,132,97,212,60,145,212,74,183,174,118,
+65,235,0,32,225,194,223,96,82,197,255,129,202,232,119,159,93,229,62,131,220,76,76,11,78,95,149,150,230,194,216,173,129,109,74,222,120,24,24,155,
+74,184,6,120,163,118,54,75,159,175,150,21,50,121,211,245,0,142,145,20,100,27,137,52,141,204,89,102,114,214,161,179,213,97,217,13,114,208,185,38,
+41,21,59,8,136,144,0,11,81,47,180,214,182,150,199,222,65,136,107,9,22,209,8,6,207,203,131,182,179,41,0,62,34,21,20,68,200,137,137,147,
+42,9,140,179,195,85,128,240,255,131,235,73,120,238,227,247,156,199,210,8,89,61,220,190,111,179,33,196,158,135,161,105,46,128,193,117,79,65,21,92,
+161,60,17,86,210,42,12,73,219,64,135,56,125,165,110,81,188,11,72,50,35,133,60,98,247,25,6,48,66,203,156,80,152,54,75,95,97,230,142,57,
+3,8,29,12,4,41,65,136,170,192,75,27,26,133,2,147,130,202,83,224,47,102,150,183,212,102,224,8,193,27,104,101,84,11,226,208,224,80,0,49,
+131,146,3,58,31,230,127,15,195,237,58,239,162,245,223,113,156,130,12,28,253,250,153,189,59,75,149,49,238,18,133,59,69,102,50,115,23,101,19,96,
+252,209,199,18,229,134,151,172,151,21,37,123,84,236,0,11,29,5,234,197,167,245,149,231,241,213,48,5,65,66,95,200,18,42,212,34,193,112,240,139,
+19,148,20,116,107,2,230,210,188,49,6,65,10,37,24,249,161,139,68,12,165,182,93,129,180,204,244,173,224,27,251,128,235,95,78,231,37,101,235,156,
+163,77,15,177,242,191,187,37,138,248,79,152,238,191,17,45,24,17,62,28,245,221,124,75,177,121,118,0,33,99,3,206,186,56,164,106,160,5,214,41,
+130,140,183,28,136,168,7,84,50,198,35,65,178,131,36,140,152,1,229,24,0,115,134,129,26,176,169,34,34,66,166,75,39,146,157,76,44,48,43,73,
+87,240,129,226,84,19,32,105,123,138,153,128,152,220,1,243,171,172,242,22,244,0,221,144,164,70,231,49,181,164,73,91,72,42,86,113,108,12,245,106,
+190,223,213,252,40,207,17,236,188,167,231,56,200,45,214,156,131,60,42,91,181,179,240,229,28,192,55,143,146,134,193,164,12,142,130,109,17,162,134,147,
+140,32,18,54,136,36,109,100,8,16,68,196,53,93,71,29,51,60,60,81,226,197,65,162,10,100,140,84,200,64,207,163,192,34,52,76,225,182,206,64,
+16,78,37,16,144,72,65,12,28,10,12,113,161,167,68,28,103,48,37,74,64,70,6,164,90,120,242,83,132,41,241,146,237,227,36,236,253,15,239,224,
+108,61,23,209,115,159,180,190,112,250,101,154,153,92,121,152,246,112,225,66,57,124,85,203,66,10,192,18,8,93,162,246,142,35,66,34,58,13,147,246,
+137,161,66,178,118,24,153,144,35,202,44,16,230,217,137,21,133,69,13,18,61,98,25,124,68,73,96,32,72,81,63,139,136,15,6,120,88,100,207,96,
+170,227,7,99,108,5,177,128,192,229,42,226,138,66,152,154,35,7,162,217,203,60,185,158,53,67,48,134,54,106,149,159,79,236,254,36,111,128,245,158,
+99,242,29,51,46,51,66,16,254,29,61,139,57,25,52,15,225,22,204,198,73,95,142,56,222,154,124,225,225,71,147,136,28,50,102,128,229,77,227,177,
+165,18,162,137,121,91,37,26,248,80,131,6,8,143,96,100,26,56,233,241,1,162,39,198,32,36,53,18,120,167,37,209,47,6,136,250,38,161,135,7,
+134,189,11,12,101,139,66,24,158,57,186,184,200,19,205,129,77,207,0,25,19,45,83,152,155,153,182,167,91,233,255,119,139,121,226,190,99,203,125,7,
+24,15,61,167,146,181,137,191,38,55,155,174,139,42,173,227,114,172,144,72,184,78,16,171,225,230,210,27,104,20,228,121,65,135,139,174,129,108,9,122,
+153,8,116,98,134,26,2,128,152,131,71,0,0,149,160,181,172,137,26,1,96,164,161,25,54,177,146,145,156,126,82,44,20,196,136,41,107,176,87,83,
+160,21,78,134,193,104,228,129,22,77,59,64,172,43,36,145,97,38,160,193,8,60,33,152,165,42,52,252,175,193,251,156,53,199,238,60,167,117,233,143,
+235,8,212,201,141,123,191,138,193,198,154,34,13,203,198,171,155,137,168,192,201,11,115,89,129,199,61,157,203,0,47,47,64,36,139,170,25,166,44,109,
+177,240,69,206,136,66,193,48,49,107,133,69,212,41,42,83,23,152,149,105,3,44,140,160,231,248,7,96,157,178,145,166,122,125,194,81,103,163,87,18,
+87,57,98,216,88,3,38,15,35,116,93,77,180,56,122,76,205,208,113,161,146,231,55,97,43,180,33,249,63,139,245,32,57,207,13,248,13,215,206,74,
+28,68,229,125,217,124,40,7,121,57,36,51,50,15,89,63,52,73,251,129,168,224,160,56,155,99,75,211,23,128,122,137,35,81,167,36,182,55,74,85,
+192,74,162,2,37,12,147,23,71,11,145,148,126,164,112,112,2,141,141,108,45,115,145,15,4,141,22,68,9,38,230,31,100,208,66,61,16,100,211,168,
+116,66,166,234,158,199,21,137,146,8,4,169,8,170,87,134,192,87,78,148,46,163,27,81,63,67,250,159,183,186,148,247,92,119,237,55,26,71,135,211,
+53,193,192,185,163,86,102,110,50,197,112,72,187,236,172,48,98,41,241,149,226,207,11,28,96,40,129,35,101,168,76,71,66,168,70,222,130,229,144,48,
+97,131,183,142,8,94,170,93,46,97,235,178,142,227,7,201,196,24,14,124,195,135,242,82,110,136,198,200,61,44,37,153,34,199,196,59,172,137,68,81,
+25,1,33,100,39,84,62,194,232,161,196,138,113,34,184,208,96,32,204,152,179,166,129,228,122,159,149,139,128,243,31,17,236,59,236,150,57,53,138,59,
+53,152,90,151,109,47,215,130,205,17,38,64,90,182,4,225,37,225,168,241,18,232,36,241,12,96,117,155,122,226,5,78,74,158,178,225,114,20,171,203,
+97,174,65,192,51,112,247,53,106,242,38,80,30,223,162,199,178,37,14,209,77,116,56,136,133,238,239,48,57,172,248,56,68,224,152,144,52,94,62,72,
+16,99,239,1,215,229,156,136,36,254,41,190,19,39,112,173,75,164,44,145,64,139,140,195,190,87,99,205,254,199,111,166,229,190,75,210,117,29,37,193,
+115,207,241,40,52,42,54,37,77,95,179,186,83,2,5,210,208,118,26,120,197,205,200,37,124,114,36,190,58,28,201,98,74,39,110,49,119,23,44,10,
+169,60,85,2,68,40,5,140,48,83,7,146,94,124,245,12,208,145,224,130,158,53,59,174,187,24,224,76,57,22,5,33,224,49,185,108,221,164,88,213,
+143,109,22,139,48,41,125,182,151,4,52,153,130,144,114,208,38,1,184,18,60,99,116,205,214,103,246,255,167,217,223,83,123,175,130,249,108,214,192,245,
+8,58,82,215,172,211,225,66,49,54,0,83,18,237,15,144,38,7,9,167,152,9,30,225,164,72,108,38,118,105,203,96,97,209,37,86,136,136,81,216,
+92,2,179,196,157,81,148,202,95,130,28,206,121,234,120,104,152,169,251,72,52,67,2,162,78,97,51,240,167,68,38,149,146,149,10,217,120,242,175,8,
+41,121,6,240,154,5,37,137,164,132,141,84,246,33,90,131,73,79,148,93,2,114,54,3,215,252,79,147,111,233,187,15,61,229,188,230,34,33,155,145,
+181,230,90,210,185,54,244,122,146,164,15,57,55,36,21,73,4,14,226,18,137,128,74,60,192,216,74,23,17,150,48,136,66,9,90,64,65,149,240,71,
+29,158,144,153,194,74,151,23,16,165,186,226,78,201,54,131,21,61,58,75,41,196,230,159,147,10,20,89,32,208,34,152,98,236,33,226,40,228,17,74,
+204,9,131,158,15,79,88,109,96,244,148,181,210,176,65,64,147,72,254,26,4,41,109,47,195,253,202,61,54,187,206,126,51,184,188,197,7,126,166,12,
+222,28,149,60,121,243,165,202,142,74,134,50,5,130,148,16,213,242,133,213,172,89,10,233,85,108,227,53,65,193,160,98,36,8,49,166,175,232,7,144,
+28,226,4,174,82,61,25,164,106,15,95,215,49,32,149,66,105,121,227,229,131,137,48,66,4,67,88,131,236,98,167,206,28,82,52,124,64,209,236,32,
+93,13,40,132,112,178,19,19,236,155,180,50,42,9,232,145,49,82,45,160,203,87,253,111,107,209,241,30,35,172,242,158,107,146,142,81,38,85,188,216,
+216,217,181,105,92,133,102,44,130,8,208,114,2,212,152,60,222,16,185,120,131,164,205,27,146,137,19,121,90,176,121,50,141,192,4,49,58,146,25,27,
+188,196,40,42,204,8,225,52,21,162,224,3,85,208,14,147,93,49,155,178,150,225,247,85,225,129,130,70,112,164,154,34,214,179,141,92,49,21,33,129,
+190,19,35,20,171,43,120,238,48,26,139,119,140,38,235,145,192,192,29,43,73,143,142,67,201,255,3,199,158,241,87,222,235,245,87,214,19,0,88,194,
+149,169,183,132,167,103,74,56,37,9,227,85,120,40,83,180,209,35,154,64,201,23,98,217,0,54,45,157,199,25,40,230,9,218,163,240,113,205,198,76,
+197,75,98,235,149,79,202,35,93,103,144,187,69,9,151,180,66,8,153,96,134,102,6,206,228,42,84,23,38,141,241,245,50,89,91,10,23,135,150,161,
+148,66,85,16,53,82,37,11,40,82,96,80,65,193,16,170,32,252,17,163,229,25,68,129,107,245,63,122,214,91,224,48,223,81,241,18,27,73,184,103,
+51,39,109,65,67,210,132,110,252,130,115,52,90,90,67,212,48,74,132,225,247,141,194,154,22,89,59,67,171,142,165,112,130,6,15,93,155,14,225,236,
+150,37,117,52,139,68,216,158,98,158,127,48,173,120,192,0,2,128,49,39,64,30,22,200,13,44,129,39,224,131,18,131,52,155,2,82,178,204,166,3,
+95,32,4,26,72,88,104,89,168,245,197,34,112,19,235,32,152,145,28,32,72,51,238,11,163,68,115,228,126,39,106,46,243,223,113,95,81,230,131,96,
+19,154,203,197,107,70,85,201,143,26,246,21,34,21,83,115,24,123,32,168,213,11,103,112,125,155,195,129,100,223,62,205,47,12,140,251,163,167,47,104,
+139,165,40,92,139,4,142,199,225,153,183,136,74,21,19,86,75,205,45,68,98,5,96,246,70,196,42,54,28,200,97,225,218,81,182,38,197,97,81,198,
+154,206,98,100,8,27,73,67,109,71,24,171,47,164,41,147,194,38,173,164,155,36,29,245,108,50,169,89,223,131,236,248,90,174,155,220,112,223,117,156,
+84,30,26,60,238,133,65,126,166,9,249,44,27,163,235,81,79,225,35,199,174,10,182,105,202,161,4,220,73,209,21,4,52,9,250,71,105,209,22,133,
+117,7,47,202,93,167,124,134,73,89,166,115,193,225,206,7,24,0,250,0,163,25,137,134,30,28,156,129,17,169,201,44,167,3,24,102,134,65,201,96,
+128,137,184,1,23,25,2,234,78,49,140,214,14,65,227,211,145,82,104,29,91,201,39,36,60,185,64,141,189,95,208,242,236,123,13,151,128,249,174,91,
+80,89,236,212,13,89,249,247,160,107,89,146,30,238,3,39,69,6,145,4,105,8,200,248,32,233,100,144,146,61,67,88,82,182,8,154,3,47,43,234,
+176,36,39,44,65,194,21,141,156,96,229,83,218,1,211,37,227,27,156,34,10,51,6,248,123,232,53,186,170,88,42,180,206,25,152,145,8,14,26,142,
+66,60,205,228,24,154,9,50,72,77,55,140,70,222,64,241,182,249,67,233,213,53,146,171,9,73,10,104,248,233,190,79,245,116,227,188,71,81,236,187,
+78,106,97,97,242,237,222,143,222,199,106,213,70,136,133,59,44,174,77,177,16,169,11,170,42,222,41,68,107,162,42,10,73,148,100,166,0,136,25,220,
+245,108,60,178,82,36,0,1,20,48,80,0,66,232,164,80,130,48,62,10,117,145,209,196,3,145,3,12,77,123,225,176,54,89,123,41,208,166,132,45,
+52,254,72,105,152,136,23,142,201,64,197,59,105,10,170,81,168,88,233,156,36,138,58,168,81,40,99,8,98,240,221,143,195,244,182,121,239,1,228,60,
+119,146,168,142,89,50,74,100,118,174,54,43,149,184,217,219,82,137,10,138,134,48,105,246,75,221,16,157,138,36,142,42,215,57,70,17,228,238,27,15,
+92,106,6,61,195,12,126,82,253,2,64,168,198,40,100,173,140,48,135,176,8,234,243,209,35,112,27,121,32,69,7,59,180,169,93,7,146,215,221,53,
+143,154,66,100,153,5,120,107,150,64,215,87,235,174,82,164,45,67,8,178,167,33,35,85,30,128,192,200,53,131,86,78,158,154,177,65,19,240,254,230,
+167,41,170,241,29,23,21,244,4,196,148,1,7,70,124,173,73,26,179,130,102,199,19,48,92,121,226,41,87,8,20,52,225,212,67,202,195,37,18,170,
+102,56,8,162,9,96,142,224,111,148,181,130,137,125,7,65,27,12,60,35,92,19,121,58,202,121,72,50,67,1,142,22,52,160,186,12,158,235,30,49,
+211,244,19,120,76,126,91,145,176,28,214,10,117,225,89,165,110,224,32,211,18,169,76,224,233,5,200,225,36,239,35,78,199,64,128,104,164,76,166,5,
+23,194,248,222,13,87,134,210,124,7,5,228,39,140,200,88,167,53,133,83,38,100,188,40,172,78,18,102,79,37,47,17,30,144,82,24,230,98,80,42,
+110,233,124,94,122,28,41,21,138,165,104,35,84,0,2,244,202,228,35,145,10,179,176,12,41,123,97,241,56,171,80,14,0,183,52,117,178,81,18,83,
+177,141,228,159,169,158,155,44,16,200,209,70,204,53,100,106,46,33,60,33,240,111,67,44,54,124,192,131,196,76,237,180,242,193,85,156,52,244,3,233,
+24,128,113,185,31,212,238,105,32,59,175,41,233,184,13,80,194,108,64,57,141,43,82,157,233,48,109,90,139,32,242,149,177,160,114,178,194,29,203,64,
+194,19,0,206,81,168,160,69,208,23,104,60,130,21,75,205,174,11,59,0,154,86,144,217,18,193,33,108,156,177,136,26,140,131,235,250,4,169,96,132,
+162,57,67,76,148,101,12,1,6,106,27,180,201,237,177,164,168,43,87,78,74,208,237,159,222,234,174,74,16,47,29,47,128,157,154,38,118,90,197,80,
+48,1,195,8,10,19,135,245,188,222,15,65,245,150,29,231,226,2,100,138,102,200,5,155,114,182,133,105,170,81,99,165,88,27,52,238,177,24,53,170,
+152,71,197,11,5,23,121,38,200,76,94,19,54,62,96,144,242,37,12,63,64,253,17,97,38,196,160,146,189,134,50,17,36,252,227,244,72,142,179,152,
+86,190,9,140,5,61,212,199,39,150,82,116,41,86,70,97,95,1,98,154,175,101,135,43,164,145,131,178,151,59,77,167,214,75,192,90,208,50,119,65,
+165,230,43,205,53,7,0,22,21,224,195,176,127,123,237,212,229,49,222,163,195,120,141,211,97,202,212,132,183,27,139,18,188,108,9,84,46,230,28,163,
+120,170,231,61,46,8,48,57,43,87,19,16,108,226,159,156,6,185,42,24,164,176,149,101,240,212,34,83,71,208,15,51,21,66,97,212,89,228,145,102,
+150,33,12,53,50,177,128,9,158,16,218,125,194,230,225,192,136,46,60,225,16,202,86,198,25,28,109,32,51,33,223,45,103,33,63,12,124,160,35,132,
+153,207,39,79,29,30,177,76,17,244,50,205,207,252,15,127,159,39,220,122,12,231,208,106,40,41,36,89,145,107,22,198,6,84,41,57,211,10,76,138,
+28,44,26,65,134,81,205,41,0,120,50,48,208,149,54,147,36,16,64,201,35,72,253,209,50,164,72,160,20,68,200,167,193,227,237,44,229,140,167,84,
+117,33,102,36,100,165,207,13,28,122,191,134,87,87,109,34,129,233,227,140,208,203,78,188,98,183,65,179,150,146,165,35,113,157,120,36,252,84,77,71,
+11,199,45,64,252,229,198,118,178,205,179,37,43,109,35,204,106,255,59,213,197,92,114,30,195,176,240,216,163,66,165,70,45,177,47,126,29,152,203,245,
+81,161,91,61,63,130,122,239,65,106,137,77,17,26,27,100,211,164,6,43,108,117,212,41,2,194,24,109,103,38,48,42,139,147,174,149,76,130,134,40,
+11,120,66,172,87,16,30,44,27,234,22,130,196,132,136,67,27,120,93,88,65,133,71,149,134,129,101,98,90,74,62,9,137,228,40,16,201,79,145,124,
+228,240,0,3,150,29,14,241,120,118,211,246,151,121,235,150,133,135,229,127,55,141,173,168,242,28,199,172,241,138,186,106,48,198,103,96,81,208,159,135,
+21,70,9,106,139,186,64,160,81,150,154,196,229,44,229,134,167,128,26,190,33,72,64,169,27,186,86,144,52,10,131,106,41,230,144,156,58,70,146,44,
+208,34,227,17,201,13,204,242,217,86,77,171,114,91,157,149,249,10,136,245,69,217,80,207,57,28,4,48,40,87,203,198,196,90,168,188,217,208,21,28,
+124,66,140,158,194,84,155,197,101,131,4,5,13,75,80,166,150,105,16,8,86,131,229,19,224,115,255,133,175,57,192,115,157,23,160,208,101,148,9,131,
+57,15,129,6,182,148,188,139,39,237,223,45,122,217,116,92,228,11,99,47,44,232,141,72,194,55,162,137,22,88,181,14,170,68,81,179,44,4,155,74,
+210,37,225,128,76,80,3,136,169,120,21,73,227,98,215,12,119,53,70,104,224,19,166,137,41,178,95,46,161,97,105,243,136,146,141,4,213,128,163,227,
+135,158,43,23,88,123,131,213,37,17,18,146,50,102,122,84,148,64,243,35,138,149,88,162,78,24,41,130,34,243,127,111,141,199,238,186,10,239,176,238,
+51,8,129,168,59,137,14,11,147,128,149,118,37,57,21,226,134,18,131,4,233,131,244,128,67,144,44,148,99,201,120,195,234,96,138,146,127,37,13,200,
+224,12,194,208,79,152,14,192,52,10,8,40,114,138,27,176,145,140,93,153,113,13,42,232,248,82,65,19,74,198,6,66,72,130,216,198,227,144,171,158,
+147,55,36,78,70,8,136,131,10,73,172,38,5,156,243,240,42,148,170,20,173,145,236,30,227,54,224,58,164,212,48,146,85,34,3,254,174,183,175,61,
+204,120,77,71,201,107,150,104,47,219,72,196,129,191,78,59,18,149,68,59,218,139,20,68,35,239,165,102,159,152,96,124,164,30,2,76,172,64,53,32,
+228,26,155,48,184,108,91,32,171,83,59,56,178,86,32,52,190,2,36,173,179,180,237,154,146,121,94,144,41,130,13,76,38,8,116,205,180,216,105,107,
+216,97,17,174,7,201,199,59,134,90,36,33,1,236,100,143,134,14,92,18,134,235,13,140,40,24,216,71,79,98,171,226,32,177,55,0,66,15,14,139,
+202,250,93,218,22,221,231,197,105,60,21,180,116,180,60,120,40,219,18,138,108,198,173,58,19,46,25,195,39,50,26,196,147,169,154,229,138,178,33,161,
+75,71,0,209,135,191,149,18,91,203,223,140,249,80,227,32,217,51,1,213,237,26,217,108,21,111,202,251,185,14,98,220,145,190,39,83,179,220,224,238,
+79,103,59,4,69,153,108,204,27,143,67,203,198,161,203,133,145,228,248,211,230,196,68,225,68,175,210,190,2,73,18,202,210,186,63,10,188,222,18,150,
+115,242,63,254,95,243,248,52,59,31,246,63,19,254,23,157,242,39,71,151,205,198,242,77,215,95,138,51,182,81,115,22,100,141,124,72,165,72,12,192,
+81,9,232,218,109,86,133,230,226,102,110,202,135,165,197,176,182,172,254,4,155,255,3,167,55,136,51,165,16,136,110,64,124,176,108,231,105,243,165,219,
+202,150,161,23,16,241,120,19,58,181,34,232,124,94,244,249,59,158,63,133,217,246,60,186,2,27,153,203,105,0,87,13,225,181,126,183,239,254,231,29,
+189,11,238,78,175,133,3,30,128,207,255,179,252,255,227,171,240,62,23,224,127,249,222,119,181,43,149,219,14,217,124,113,126,222,16,189,21,112,118,43,
+225,173,208,223,133,23,49,177,139,74,65,57,244,173,38,222,118,189,45,159,59,5,26,155,49,21,145,159,153,154,66,76,9,21,30,22,28,193,153,78,
+84,157,13,154,189,130,249,58,67,100,245,178,250,28,60,73,175,228,17,224,242,34,243,254,7,55,2,105,250,220,217,65,165,3,95,141,215,196,20,210,
+175,229,89,164,112,242,228,68,108,38,169,243,143,178,228,197,127,39,159,255,230,248,127,104,31,251,95,241,190,39,245,61,78,15,50,109,217,125,90,30,
+76,57,224,232,174,40,67,190,241,153,125,174,95,82,218,49,16,141,203,229,83,50,147,163,64,225,249,91,236,57,108,253,77,115,246,60,186,214,176,67,
+208,201,161,51,195,224,64,193,160,108,81,113,49,207,222,229,169,206,232,212,152,170,182,171,151,165,244,253,76,209,104,111,244,53,203,164,76,23,137,96,
+87,226,5,209,250,91,185,110,92,115,191,198,45,167,178,199,249,159,94,247,1,222,46,179,222,47,39,254,255,246,201,245,63,214,251,31,123,235,123,222,
+115,99,234,206,119,235,233,126,29,232,127,147,247,61,17,72,46,53,251,16,78,127,161,186,130,197,46,55,67,238,251,150,233,54,254,52,220,76,176,208,
+218,248,243,41,117,120,128,242,114,152,187,96,70,197,185,147,218,230,175,235,123,185,81,66,0,201,92,121,208,30,2,93,225,238,192,139,161,103,143,206,
+16,46,93,8,143,197,51,50,252,35,23,45,26,88,176,33,99,160,28,60,227,181,125,239,131,35,173,134,66,58,152,100,20,65,248,127,171,251,127,174,
+111,177,249,95,208,251,223,206,220,200,42,1,95,143,128,63,230,226,111,213,147,21,234,179,166,143,129,76,87,239,94,232,188,226,113,15,119,64,57,167,
+101,93,127,33,151,35,179,165,219,196,39,23,169,242,125,77,48,112,175,232,77,143,220,187,227,255,165,246,94,141,197,204,75,29,166,47,242,176,237,40,
+232,35,146,210,175,194,93,233,242,248,92,144,248,154,174,32,109,12,20,55,60,24,83,183,212,37,98,162,104,194,208,213,181,31,99,146,183,169,219,132,
+24,79,111,213,229,255,247,251,35,126,135,196,252,143,242,189,79,50,228,230,119,83,145,234,135,226,141,154,248,195,159,159,239,124,62,67,59,62,48,28,
+56,72,12,25,15,63,129,207,244,32,223,140,44,193,149,191,224,119,210,149,139,11,79,49,80,76,21,229,70,45,38,2,159,114,156,189,137,160,170,101,
+107,182,171,241,165,224,252,175,85,192,139,99,5,192,232,99,187,91,86,149,171,166,112,59,250,203,223,216,213,71,41,153,52,58,62,209,184,102,114,57,
+239,101,117,255,3,197,66,51,214,80,190,111,239,255,241,118,111,126,55,107,253,175,177,250,152,221,2,71,183,142,118,14,222,44,92,59,27,51,114,7,
+138,224,115,201,241,181,229,227,96,133,141,3,117,174,54,187,209,180,250,208,117,243,34,103,202,2,60,28,140,50,239,105,234,96,184,17,11,206,18,252,
+202,83,223,88,218,156,56,82,153,63,89,28,91,18,161,170,51,85,66,82,253,8,216,244,105,38,34,208,179,245,140,158,234,89,105,106,218,186,80,68,
+133,64,169,160,240,177,97,239,87,168,56,135,148,194,125,26,159,241,255,227,225,133,249,95,141,255,19,220,245,61,203,76,190,54,156,244,251,100,118,203,
+141,183,71,189,197,98,231,147,231,91,163,177,86,41,154,70,239,253,14,76,95,90,205,253,128,49,239,41,175,136,134,188,234,184,141,217,160,122,32,232,
+116,96,114,185,36,103,96,164,196,87,39,179,129,46,130,216,224,226,100,114,206,114,173,33,183,120,152,244,157,130,59,54,47,129,194,111,39,214,231,176,
+43,175,2,168,81,229,77,67,10,206,37,25,136,187,112,245,162,216,18,236,6,114,62,239,244,255,155,215,225,119,191,145,248,31,242,186,157,76,35,87,
+170,15,84,158,172,117,112,111,111,190,6,133,181,112,21,178,23,141,236,239,102,214,183,188,103,47,194,175,169,146,67,152,121,136,120,61,3,219,113,152,
+49,153,13,73,111,249,157,181,184,30,143,98,88,236,89,228,107,137,9,82,74,32,0,131,192,138,32,38,142,32,77,101,212,179,1,21,210,142,131,142,
+69,168,218,172,30,11,180,45,140,90,194,40,246,13,34,80,86,179,160,66,76,153,213,226,114,74,255,163,254,206,62,87,228,125,175,240,62,135,214,241,
+146,29,187,33,239,197,193,119,203,194,111,13,158,39,37,203,92,60,231,89,200,201,4,12,136,244,125,206,217,156,138,114,244,32,179,80,124,60,192,238,
+152,12,105,234,168,50,163,238,122,121,154,221,88,83,165,176,41,41,91,22,228,250,133,99,161,153,11,135,56,89,120,137,236,246,183,240,167,166,185,72,
+77,3,185,166,255,173,230,208,76,246,135,68,41,249,26,246,41,91,200,167,57,208,226,2,133,29,200,243,228,55,99,246,255,175,252,219,122,223,19,247,
+63,19,254,229,207,50,81,176,98,187,186,175,130,54,43,184,94,8,0,102,98,135,88,222,79,18,167,171,235,122,253,13,190,195,56,123,132,202,197,132,
+6,47,106,31,95,202,134,188,105,228,194,142,129,152,32,251,31,39,3,27,203,240,45,169,4,46,39,155,104,132,75,72,160,79,35,90,200,165,14,152,
+69,72,211,177,130,51,213,238,105,176,115,9,26,132,51,150,125,49,167,106,198,143,80,33,105,98,224,98,230,42,193,216,248,195,199,196,178,66,108,250,
+191,246,125,218,127,216,212,250,223,200,249,223,129,160,123,152,246,101,121,171,175,103,193,208,111,13,194,81,191,231,102,226,245,177,92,145,187,128,154,229,
+80,42,74,152,206,215,173,31,2,75,246,48,248,152,242,123,86,224,150,222,19,156,29,44,20,123,155,240,49,111,101,123,252,229,48,221,198,28,50,207,
+177,79,27,135,164,214,75,18,52,233,80,249,63,91,95,143,157,9,120,177,247,153,42,118,124,130,169,153,192,252,127,122,187,185,157,126,165,92,202,224,
+200,42,88,90,217,249,152,50,248,211,208,135,179,209,255,219,230,226,57,255,67,224,126,71,216,235,103,59,165,183,101,247,122,34,79,235,224,85,37,35,
+236,226,50,218,199,212,179,64,57,33,94,182,175,189,243,120,84,182,245,180,84,204,201,209,248,84,242,110,27,98,216,229,75,210,158,92,69,226,204,13,
+83,163,235,104,231,39,163,148,213,176,43,98,244,186,119,152,199,194,125,139,122,18,190,142,36,236,245,149,9,105,235,92,207,181,147,220,71,219,248,150,
+230,224,83,22,97,38,143,82,58,136,41,78,85,12,115,3,97,250,144,75,119,39,248,191,199,226,157,249,31,157,246,191,43,234,112,164,52,158,173,77,
+127,84,128,179,97,190,250,194,85,128,141,156,167,86,149,85,156,201,224,21,87,192,159,14,228,82,174,89,69,34,11,139,198,209,194,19,209,249,28,219,
+133,233,250,92,179,144,162,180,1,225,184,65,97,184,248,57,158,159,80,238,127,198,237,161,64,182,77,227,100,199,164,217,166,22,168,66,203,220,171,31,
+17,136,232,21,155,192,143,86,144,3,144,12,20,176,49,237,68,211,55,128,231,95,82,235,19,31,138,224,62,255,244,127,203,160,103,228,126,183,200,253,
+15,202,58,118,103,151,137,205,155,142,29,184,49,225,185,155,8,117,219,149,46,85,206,14,90,21,186,184,208,179,96,40,228,147,163,58,98,105,180,52,
+217,217,222,223,48,82,96,120,124,8,181,40,162,22,21,22,70,167,227,97,198,217,216,157,217,149,47,129,30,78,53,20,8,97,236,216,204,131,153,195,
+200,240,120,16,63,111,252,47,118,47,98,40,193,47,79,216,225,147,123,12,144,249,213,241,118,174,185,3,39,202,205,6,22,207,177,203,139,229,116,100,
+82,209,115,79,175,252,223,232,145,243,60,207,11,254,7,216,220,251,91,105,222,217,87,154,141,84,184,55,235,89,123,118,67,149,226,231,49,135,210,239,
+222,60,106,27,124,229,98,184,34,177,139,154,191,43,85,75,215,100,72,197,94,48,71,196,139,13,162,157,15,43,209,241,36,167,198,229,185,114,221,250,
+216,86,217,35,49,216,126,23,130,94,17,116,227,69,51,11,86,58,25,89,37,176,190,199,15,58,169,213,56,248,130,170,145,226,56,41,233,34,66,79,
+75,119,161,175,16,40,225,88,138,130,184,255,87,250,127,183,210,248,24,31,233,126,167,218,206,161,58,71,21,239,78,92,46,217,47,124,223,3,193,7,
+91,171,98,78,22,175,18,12,221,73,101,39,82,91,85,57,253,13,60,100,234,228,108,225,22,160,138,192,18,62,4,92,27,83,116,58,120,150,189,254,
+4,182,30,76,168,149,192,141,45,134,104,87,31,42,205,228,207,31,169,234,161,177,226,210,25,238,45,108,46,253,130,85,177,139,140,184,20,97,72,197,
+218,179,47,32,114,214,24,157,158,132,142,29,102,64,98,167,87,1,237,62,6,253,237,255,248,255,23,207,210,242,62,215,212,255,3,214,208,216,219,238,
+112,105,175,151,166,82,58,227,215,148,189,185,211,220,45,224,159,129,30,128,18,54,250,221,190,132,210,115,51,204,159,152,250,1,159,57,44,222,231,92,
+77,108,19,69,20,35,132,130,28,39,229,16,101,220,107,112,151,36,5,247,39,162,159,34,74,35,194,142,11,212,202,114,104,228,14,133,15,87,157,99,
+213,233,97,176,50,160,168,193,175,196,141,46,78,49,184,190,20,61,60,72,252,107,56,122,135,177,201,231,21,167,103,191,253,31,240,126,87,105,143,250,
+222,39,141,249,72,84,117,102,244,234,133,191,117,44,217,153,176,115,182,192,189,14,28,236,79,23,24,19,243,51,121,29,118,182,187,189,5,68,203,194,
+19,111,225,120,113,20,120,236,153,209,242,31,209,91,137,167,14,16,67,46,98,199,211,224,16,249,176,102,9,92,203,21,214,192,213,114,148,148,231,73,
+23,43,158,160,9,17,102,246,12,4,1,30,60,97,225,220,39,119,177,20,18,178,251,8,118,241,44,115,238,8,73,146,113,19,195,243,184,49,120,149,
+226,65,19,87,247,255,131,37,29,207,238,118,62,199,231,112,163,9,165,139,147,137,242,70,175,183,99,29,92,154,70,109,226,79,133,19,94,196,29,106,
+38,194,118,117,125,12,119,160,30,12,221,12,86,154,29,144,246,178,194,56,67,1,205,184,247,79,122,138,52,157,17,72,183,2,142,192,204,179,58,57,
+251,83,113,253,204,91,186,74,214,244,212,248,30,220,161,164,212,213,196,60,216,3,207,98,148,57,42,248,156,181,247,180,115,128,213,177,58,200,88,93,
+25,92,174,138,60,38,215,13,67,80,4,91,28,92,110,159,244,127,190,146,200,127,196,242,63,99,107,240,138,156,236,253,207,207,21,184,31,125,13,175,
+195,136,132,183,6,199,208,159,40,141,31,43,76,188,76,114,174,27,5,34,18,0,3,74,82,42,119,148,203,43,17,149,69,107,55,33,206,206,198,78,
+134,27,126,103,86,242,218,121,19,239,67,211,233,113,252,142,189,170,30,223,204,186,100,187,89,227,105,85,130,52,164,207,199,218,83,6,96,117,228,28,
+57,118,243,2,163,40,20,72,113,42,235,210,185,203,176,115,164,20,35,183,53,120,26,245,45,113,112,63,71,215,254,157,26,30,215,230,113,191,177,177,
+246,13,106,247,126,5,59,185,229,103,170,14,253,202,119,236,12,139,216,120,193,77,224,87,197,224,41,219,157,169,108,233,214,97,4,243,245,122,24,97,
+194,191,218,199,76,130,162,120,190,182,73,153,105,129,173,203,227,118,249,152,94,106,215,155,90,121,57,221,30,4,244,119,42,155,8,23,193,97,246,149,
+102,214,156,5,128,101,2,225,218,10,42,52,2,155,64,62,159,129,91,193,129,2,142,117,151,151,139,233,107,134,59,76,184,76,60,138,55,167,154,31,
+79,252,63,215,111,133,240,60,207,189,231,126,151,66,108,41,133,242,226,151,170,157,114,111,147,27,117,102,76,82,92,226,233,15,199,238,63,60,106,68,
+231,248,208,240,120,138,138,230,45,39,78,210,213,111,58,186,212,56,37,74,76,121,92,87,44,42,236,129,93,194,117,116,233,11,55,26,185,242,23,140,
+149,211,35,42,204,233,169,225,96,153,3,13,30,64,126,31,58,204,132,65,218,251,191,169,234,143,220,203,45,93,172,24,174,101,93,48,167,241,28,213,
+25,71,38,160,49,123,93,123,132,195,241,255,230,252,156,8,94,215,212,226,127,198,228,120,129,146,29,55,184,175,155,213,151,74,174,77,232,181,92,163,
+137,151,153,67,155,96,71,47,175,66,214,138,212,175,240,172,197,236,83,93,199,78,14,181,50,14,138,178,166,10,220,34,79,1,37,194,212,236,233,50,
+60,107,248,149,97,225,53,101,220,167,89,206,207,206,146,54,110,100,45,182,19,72,161,178,80,177,62,35,17,97,116,126,215,6,238,146,35,73,161,5,
+3,200,32,178,5,106,67,241,76,48,131,144,195,192,138,114,4,213,253,127,183,240,90,91,244,191,19,145,252,207,198,201,249,147,112,90,195,27,213,169,
+224,176,23,111,67,30,46,39,30,213,188,66,167,237,115,108,64,126,190,1,173,238,96,153,136,138,163,149,82,204,158,149,245,115,164,166,27,16,78,5,
+112,16,51,31,161,171,160,191,47,240,61,184,91,158,255,56,186,109,3,59,159,196,6,238,68,242,38,19,167,113,141,157,140,89,125,77,208,240,182,116,
+128,201,234,15,63,23,10,231,46,194,89,51,10,30,41,10,56,118,60,105,72,195,192,31,151,194,133,213,244,29,242,252,204,122,126,95,253,211,178,121,
+31,51,91,255,9,239,161,235,120,254,37,208,106,228,135,197,192,195,193,58,236,142,13,70,59,121,15,233,106,161,189,195,156,168,205,73,62,130,201,128,
+146,12,55,103,88,141,60,32,7,60,192,76,68,208,110,241,8,227,198,49,130,217,18,225,241,235,108,214,99,4,165,13,132,232,174,18,184,244,151,137,
+70,180,113,18,215,188,59,44,218,195,35,50,254,36,114,231,17,134,95,35,125,198,43,200,134,240,13,200,68,100,76,200,201,2,85,58,0,201,136,32,
+167,18,184,221,191,47,241,126,191,161,43,145,255,18,199,238,121,145,125,206,126,214,255,175,249,95,162,64,188,49,168,168,86,185,176,167,165,115,52,105,
+69,14,221,44,28,43,226,116,186,171,102,62,42,146,180,96,86,223,188,35,115,176,220,145,147,17,51,231,69,62,131,242,117,130,124,230,220,74,106,199,
+211,228,99,209,224,54,206,119,87,1,108,62,70,59,81,242,151,151,1,253,188,140,46,190,66,32,237,120,188,38,110,246,183,245,50,79,145,6,4,253,
+104,55,214,164,26,101,204,35,151,231,79,163,56,226,42,198,93,69,44,196,226,255,103,219,231,218,245,56,31,137,248,157,142,214,33,8,154,188,55,240,
+93,83,86,106,18,197,18,122,91,122,134,67,90,14,118,207,67,191,3,206,251,124,67,194,6,20,140,23,22,93,253,173,24,21,181,198,210,193,52,21,
+16,195,196,116,56,46,52,72,145,27,44,167,94,17,22,192,22,131,49,229,24,28,177,176,164,132,243,43,2,249,173,194,92,152,82,236,62,4,168,242,
+43,228,71,76,166,139,199,177,59,38,5,12,183,128,83,31,73,141,85,174,77,82,126,246,123,125,206,221,64,9,243,124,63,248,54,253,40,223,194,222,
+249,223,194,141,202,138,82,94,77,135,123,50,31,223,1,136,125,54,182,56,115,250,212,232,230,75,104,201,184,19,69,204,207,129,74,220,224,12,4,134,
+82,127,2,186,85,168,211,75,194,247,196,208,135,159,234,87,224,235,9,150,37,156,137,234,156,209,181,120,28,56,2,65,149,151,152,19,108,100,239,45,
+183,148,88,215,195,202,227,200,133,163,140,21,219,65,38,33,115,19,60,138,113,142,24,179,66,66,199,29,202,23,101,41,147,156,202,56,22,228,107,244,
+45,159,48,208,79,252,127,63,39,251,127,129,220,233,126,135,67,230,120,13,50,84,46,89,204,250,125,13,127,31,144,127,5,252,106,250,189,206,125,43,
+154,252,111,6,86,134,30,38,152,189,236,178,156,159,58,49,181,228,33,22,80,147,75,140,132,50,80,1,85,21,89,114,102,45,21,99,85,153,14,246,
+156,3,182,121,85,213,79,25,15,131,250,92,114,28,195,238,81,154,159,129,197,130,161,15,192,81,187,29,126,4,116,52,188,146,181,139,221,218,150,223,
+18,58,176,7,195,180,100,53,160,62,173,0,13,21,86,8,146,225,5,177,87,87,252,191,197,149,129,192,247,62,215,153,238,103,61,157,130,164,94,204,
+5,60,217,23,221,23,39,11,171,218,236,151,129,53,129,204,36,103,19,28,75,155,119,164,102,243,182,243,26,241,123,211,67,149,179,66,101,49,92,116,
+88,153,172,98,102,200,73,180,4,32,80,64,88,249,48,13,18,237,8,217,183,184,59,10,111,248,28,154,211,51,74,140,252,252,106,175,59,32,44,221,
+204,88,69,65,104,181,7,215,240,176,86,83,47,145,60,243,4,109,232,56,16,189,94,195,94,207,210,223,163,226,122,58,7,98,238,54,223,175,250,190,
+62,78,215,169,227,124,47,123,231,102,11,120,187,173,67,230,164,183,158,112,182,90,219,140,191,7,185,101,25,7,130,96,231,51,153,163,82,215,159,188,
+117,39,224,180,90,209,56,58,203,197,192,170,81,149,236,83,57,97,196,143,168,77,117,170,77,64,216,188,11,180,109,11,84,74,209,197,153,109,195,130,
+46,30,196,147,206,155,157,6,74,72,39,31,161,134,74,87,242,3,9,240,90,147,1,162,31,69,231,112,51,224,57,54,82,39,55,89,118,228,65,143,
+48,96,7,3,11,193,55,234,255,39,6,135,181,235,108,122,158,215,200,131,156,218,103,161,102,217,155,175,79,190,37,142,77,157,41,36,131,135,172,166,
+46,117,208,100,57,4,154,146,212,42,229,80,231,73,128,200,209,166,161,19,5,105,157,248,216,213,94,146,128,89,26,161,105,43,187,204,7,6,162,34,
+155,22,115,247,168,199,112,156,238,29,99,193,73,124,13,121,8,42,75,206,183,64,179,78,211,242,163,237,208,181,201,216,51,143,214,224,241,153,134,124,
+133,180,232,45,94,64,12,229,1,158,111,59,134,53,44,89,8,208,5,48,216,228,254,143,187,158,103,67,225,119,60,111,59,51,218,62,11,135,67,229,
+181,46,72,168,234,160,122,111,195,49,106,164,57,14,64,98,30,134,23,187,245,180,217,228,116,254,22,28,215,48,38,219,230,93,159,210,119,70,160,99,
+197,164,31,15,206,201,87,129,150,117,169,42,228,55,53,166,25,187,121,140,186,199,203,181,13,61,46,190,84,108,92,13,157,224,244,233,16,18,175,206,
+66,106,232,72,61,248,59,213,70,56,112,241,45,193,228,100,203,208,95,31,41,201,34,202,46,78,114,186,248,18,226,6,27,185,72,160,62,27,159,195,
+254,43,97,208,250,30,199,3,225,124,167,9,204,134,50,58,236,107,196,215,193,185,116,9,162,96,198,6,89,134,34,161,128,30,13,37,73,208,236,233,
+103,122,187,138,65,145,155,98,20,120,115,140,142,202,85,33,195,115,47,64,161,224,161,133,197,184,178,152,47,6,171,79,150,145,132,128,182,12,136,97,
+224,81,63,8,216,54,171,149,50,184,45,54,179,50,92,160,139,179,35,193,144,25,70,51,120,56,229,31,59,125,172,171,42,18,12,103,74,149,203,98,
+246,221,35,150,166,175,173,226,243,51,237,235,255,213,205,180,215,129,242,61,15,11,200,208,9,108,10,237,241,242,38,225,226,228,113,115,125,47,146,209,
+227,146,26,81,76,168,140,21,146,38,37,57,81,48,78,247,50,254,78,132,132,222,233,250,217,110,188,210,50,82,65,81,32,173,83,47,59,143,67,123,
+163,185,45,3,217,177,28,82,98,50,174,19,53,104,85,32,104,208,226,34,106,6,237,113,204,14,144,61,24,24,141,182,16,206,69,87,137,126,10,146,
+37,120,127,51,23,20,171,67,207,173,70,52,119,138,64,215,212,138,78,54,191,66,121,171,53,37,194,221,217,255,221,197,164,151,67,212,244,63,51,26,
+215,145,84,155,94,14,199,134,117,143,235,247,49,234,216,223,60,83,35,160,25,146,179,234,49,175,206,95,55,185,151,8,104,17,214,153,130,225,120,12,
+236,226,4,56,12,100,153,157,93,50,68,196,207,136,13,42,51,141,240,254,243,186,53,48,240,12,103,22,150,5,244,76,118,162,37,168,221,225,89,193,
+198,105,184,178,160,154,118,159,161,63,23,106,92,25,140,230,109,241,35,199,173,62,244,118,57,125,234,97,198,84,38,218,68,135,47,167,136,196,248,125,
+9,116,121,89,248,154,126,207,155,252,81,250,158,6,119,192,252,170,156,110,67,237,45,203,164,111,108,9,48,222,233,151,123,227,234,7,95,43,55,1,
+81,20,0,38,75,152,64,141,218,201,204,133,108,248,134,72,233,229,33,201,230,49,228,206,198,162,204,128,113,237,70,215,232,111,169,165,158,3,129,17,
+38,51,177,25,12,151,171,149,19,7,1,142,95,42,124,68,180,99,61,159,128,5,117,34,113,244,128,183,72,22,203,169,3,127,65,45,53,178,176,207,
+160,102,142,129,220,120,215,36,158,209,170,151,32,171,111,94,209,115,42,76,157,7,231,243,254,239,179,201,249,194,250,31,224,45,245,188,162,234,82,190,
+170,18,240,221,142,235,109,221,72,221,186,219,30,205,96,220,189,170,29,35,68,129,30,127,26,167,205,233,74,11,143,83,75,108,25,16,76,53,97,69,
+72,248,164,76,46,11,22,121,197,245,125,46,206,69,79,103,161,107,226,248,89,44,66,199,152,137,168,181,58,169,78,39,43,143,192,145,250,191,149,207,
+144,134,126,69,57,131,186,73,57,74,121,59,213,58,57,213,57,171,74,61,183,14,134,98,248,90,186,203,248,255,145,219,96,198,78,0,27,78,207,114,
+212,26,154,48,39,253,255,179,182,63,19,225,66,226,127,123,67,198,199,189,57,119,112,64,31,38,72,114,230,147,94,101,209,38,54,90,0,170,229,171,
+236,249,95,62,71,74,217,146,110,12,200,135,12,40,162,183,128,156,151,3,72,178,0,116,20,151,148,135,131,194,189,219,196,41,117,25,6,18,102,214,
+201,82,68,19,97,177,128,125,153,136,58,224,236,191,132,46,43,138,25,146,193,199,168,61,26,146,51,100,99,120,126,247,118,52,237,89,79,91,156,68,
+87,249,21,251,191,90,110,94,164,244,225,36,108,220,163,110,244,48,90,105,83,102,245,254,207,85,180,58,94,230,183,230,99,113,182,162,102,235,51,130,
+155,245,221,103,45,61,47,94,17,74,203,136,107,6,16,38,158,195,220,61,236,124,232,248,125,65,169,168,146,109,3,125,172,108,214,153,152,52,117,20,
+124,148,11,153,30,40,90,85,212,37,25,210,210,122,12,169,54,254,23,197,206,67,139,133,65,186,178,12,54,85,20,160,109,241,189,30,112,216,227,22,
+176,133,9,84,237,174,10,153,23,227,62,109,137,44,2,188,231,195,17,215,9,98,204,68,41,137,80,215,227,69,90,101,24,12,185,67,183,188,39,205,
+243,252,62,238,86,86,183,196,241,62,87,72,173,32,33,172,14,61,145,7,246,237,55,209,227,110,170,86,22,8,209,48,200,238,112,75,43,67,5,222,
+135,127,105,204,117,26,18,6,93,74,51,24,211,144,174,85,16,144,36,131,95,210,195,165,142,177,120,149,196,16,145,164,5,138,165,233,98,39,34,202,
+118,173,108,133,98,42,177,35,1,178,118,102,12,28,141,84,46,69,178,181,195,232,210,82,57,52,130,175,140,187,116,145,147,98,74,9,133,3,29,9,
+6,81,64,65,226,15,143,113,135,197,203,41,76,84,32,37,31,23,175,244,121,177,243,60,204,175,177,242,186,204,101,66,28,244,207,179,159,10,94,92,
+53,226,96,128,67,165,0,138,197,188,53,22,167,9,191,194,150,130,2,140,9,176,2,39,47,89,45,157,171,173,30,212,198,102,136,225,80,205,121,23,
+113,173,172,229,114,177,159,138,111,59,77,190,215,179,152,230,41,212,153,125,66,172,51,179,231,98,238,242,0,199,87,17,58,238,64,35,71,96,27,245,
+31,141,2,25,177,131,68,178,46,118,224,110,109,175,88,9,244,9,37,0,37,165,17,181,42,108,160,79,9,155,174,21,131,197,241,253,191,15,226,53,
+243,188,142,55,177,145,188,226,108,148,183,62,206,39,62,169,151,73,50,9,34,54,66,214,97,92,217,226,104,222,22,91,197,6,162,160,216,126,28,73,
+59,86,223,136,59,135,132,65,236,66,203,58,101,120,148,241,177,92,42,156,6,32,194,149,125,120,133,61,193,222,151,43,159,67,137,162,255,67,171,169,
+126,149,111,6,209,166,17,108,22,166,129,173,15,111,82,22,12,227,36,184,225,34,156,140,181,50,179,236,252,207,171,148,245,218,145,209,196,3,70,178,
+75,144,156,34,68,159,148,83,224,0,158,111,195,248,250,250,196,253,174,71,3,242,180,57,74,54,81,161,187,69,248,120,170,69,146,217,48,166,195,113,
+85,26,151,161,171,137,94,64,129,200,138,220,227,163,181,59,151,149,61,105,151,98,69,176,212,178,84,52,165,23,94,247,155,228,71,134,83,5,85,47,
+161,46,110,20,86,52,120,134,115,106,53,46,1,212,229,25,12,224,237,69,154,147,4,215,0,196,227,3,111,43,31,56,61,254,4,104,225,144,218,87,
+39,219,218,223,3,165,174,66,231,236,81,155,132,132,212,222,129,47,11,151,180,76,189,12,112,244,33,215,19,151,252,190,142,119,7,248,222,84,47,27,
+241,55,161,3,5,135,185,237,39,227,222,193,143,87,59,94,93,200,50,113,55,115,32,204,18,42,197,28,139,52,161,115,125,206,248,186,12,154,17,96,
+82,138,190,247,38,226,199,132,91,244,40,149,145,162,10,192,22,106,137,106,240,153,37,163,29,38,48,86,241,183,117,160,175,16,198,73,140,83,55,126,
+103,207,115,18,216,101,73,10,224,61,188,142,39,84,166,4,106,5,214,161,103,239,77,84,162,17,94,48,46,194,197,180,4,154,140,111,212,50,102,236,
+103,37,202,6,124,74,28,125,136,170,111,249,184,125,157,253,111,145,153,196,245,183,57,149,3,30,0,187,105,105,196,43,232,202,107,21,182,166,174,192,
+160,42,68,232,162,204,12,39,212,196,207,96,179,134,61,162,93,81,58,81,237,79,62,80,136,50,130,162,10,64,77,131,65,219,106,86,76,212,15,9,
+132,17,119,75,13,188,169,96,180,28,114,246,42,136,181,252,36,166,166,193,51,113,149,142,16,196,5,4,140,205,59,82,61,159,73,179,229,73,135,173,
+69,249,144,195,65,131,95,9,64,207,40,224,23,196,178,254,80,123,190,22,184,11,52,105,230,57,147,251,61,124,212,48,185,222,7,27,181,210,200,114,
+68,14,206,116,209,240,73,131,171,24,126,27,137,130,168,65,146,123,21,178,106,64,166,204,12,71,107,210,77,90,134,147,62,224,203,164,44,254,199,6,
+20,202,37,36,43,33,218,224,222,84,208,77,164,153,180,180,113,136,205,204,60,68,206,34,10,211,48,211,226,104,139,128,76,176,148,56,123,48,28,138,
+80,42,128,96,80,206,208,221,42,161,168,37,187,148,203,12,104,202,118,192,23,92,70,223,133,134,116,48,178,7,170,163,52,152,223,196,92,241,136,42,
+0,215,116,52,248,60,63,197,109,136,222,247,206,199,255,189,149,95,194,64,118,203,47,179,90,23,199,97,77,86,85,66,101,188,62,37,210,41,89,137,
+50,25,183,58,252,232,94,222,134,86,184,215,159,143,58,92,105,215,194,136,148,22,106,37,151,153,149,143,79,128,106,169,38,237,200,248,212,105,236,67,
+56,8,114,146,94,75,152,91,183,134,195,82,199,31,194,193,195,242,178,205,37,65,85,160,139,114,247,25,187,104,72,41,70,15,103,16,115,141,132,12,
+209,233,71,129,127,177,237,229,21,21,103,35,179,176,156,181,235,72,154,249,0,214,118,159,165,186,140,196,49,124,63,71,213,71,107,43,27,157,236,124,
+202,200,104,73,98,247,205,227,106,217,129,95,29,134,231,140,155,169,20,104,231,12,156,134,110,104,133,189,138,77,6,215,50,131,162,4,8,172,7,12,
+174,87,126,66,141,30,248,64,36,150,110,134,137,187,148,79,184,141,28,4,119,126,199,147,141,102,113,150,218,214,242,107,90,199,121,52,11,93,196,182,
+117,37,131,157,203,198,101,182,2,70,52,48,144,50,141,34,167,143,73,153,212,79,228,110,138,130,97,196,68,144,167,105,210,73,49,136,45,37,104,235,
+89,120,96,197,67,51,15,31,75,251,62,254,218,25,19,56,159,192,224,53,243,160,35,145,68,112,98,201,162,251,27,170,1,178,74,197,170,96,70,13,
+179,200,137,116,150,15,29,104,86,197,212,205,132,132,150,48,56,244,28,195,192,76,32,140,89,23,240,58,188,169,169,156,82,106,192,157,101,165,71,184,
+188,88,7,85,172,218,71,71,132,184,9,20,13,220,140,80,245,188,62,211,172,169,69,43,218,120,19,70,26,20,144,236,102,139,164,249,39,38,49,194,
+2,53,219,11,187,41,20,149,30,67,106,16,251,84,108,2,91,38,227,0,200,192,212,193,22,79,205,250,118,92,99,141,234,112,60,175,122,32,26,24,
+94,158,117,153,97,211,102,73,227,175,6,91,74,75,147,42,20,113,243,137,224,230,77,172,37,214,20,56,107,178,179,184,108,23,165,167,23,122,7,86,
+198,167,159,210,178,176,173,168,197,17,15,202,217,106,36,24,131,96,194,204,239,220,141,5,82,174,63,110,161,84,114,50,114,39,211,153,51,127,40,132,
+219,10,50,54,250,217,233,196,1,231,98,188,252,199,171,193,177,82,61,24,133,8,152,225,8,76,81,121,24,45,34,74,137,11,69,169,151,72,156,45,
+121,20,168,132,129,80,100,153,254,238,126,77,108,204,78,135,137,165,204,241,8,120,212,198,47,37,167,117,77,82,29,120,29,188,232,88,240,237,53,151,
+25,103,96,50,92,66,182,245,174,122,123,131,18,64,146,115,50,100,67,192,110,205,232,216,177,18,84,82,193,157,54,143,107,142,116,70,211,210,150,3,
+104,70,109,88,130,191,200,233,202,44,168,16,73,73,118,27,48,199,71,177,13,139,48,148,116,218,80,225,109,232,13,13,20,5,120,248,219,120,86,53,
+205,236,120,181,24,124,177,133,118,35,214,225,20,16,174,224,95,50,17,23,76,212,139,139,172,221,106,181,99,88,238,248,188,31,143,104,172,47,59,169,
+177,225,119,144,18,130,77,187,183,173,31,174,144,181,207,161,215,17,194,40,139,105,94,79,176,62,232,216,129,77,137,22,131,40,12,42,12,114,250,207,
+170,156,103,34,221,235,83,153,126,1,133,134,28,222,86,233,105,80,10,217,126,87,124,26,9,134,193,146,218,82,110,101,245,116,32,226,239,75,125,9,
+2,199,81,185,76,168,25,226,40,21,114,158,98,156,26,17,42,164,124,169,161,96,3,195,231,106,225,55,94,68,108,181,42,109,222,45,68,15,163,149,
+119,25,185,55,3,217,232,50,2,108,7,4,26,85,248,191,103,86,108,105,87,60,207,181,35,189,196,48,246,160,95,149,193,167,34,77,147,196,166,74,
+168,9,21,211,26,157,211,184,82,33,156,64,2,202,155,16,7,222,161,201,224,107,218,12,177,70,26,102,94,69,184,3,46,12,235,230,64,76,112,10,
+75,7,153,203,152,244,119,228,78,171,40,109,190,51,52,231,70,207,111,112,109,208,241,144,170,5,172,248,68,8,98,181,250,25,111,195,152,232,86,161,
+205,177,63,91,60,235,9,150,92,94,6,139,69,213,141,149,175,7,32,83,10,93,125,173,53,37,97,165,89,183,86,88,212,198,104,184,116,188,94,126,
+255,203,115,122,199,157,137,233,114,39,112,34,22,138,178,38,217,44,61,59,57,68,119,65,153,125,35,31,40,60,94,180,86,194,40,131,137,157,118,209,
+32,160,187,43,44,41,162,136,52,72,104,22,141,65,100,142,194,194,102,214,17,16,154,155,74,202,87,44,143,74,156,226,39,180,1,7,43,159,216,126,
+89,197,32,188,221,98,242,236,48,233,7,81,132,185,54,11,178,20,229,213,214,186,138,204,14,76,235,108,198,49,53,196,98,204,164,141,36,184,80,42,
+173,67,53,67,135,6,17,114,204,160,217,105,29,5,250,159,71,203,221,154,46,103,214,232,17,242,186,19,166,24,78,135,207,237,97,243,100,1,138,189,
+59,83,102,175,16,200,226,132,200,24,75,193,0,169,133,191,157,143,89,235,112,119,182,247,170,154,93,39,183,117,33,224,247,43,152,212,243,96,95,228,
+91,25,162,98,159,144,157,90,75,54,124,138,183,169,145,89,217,174,28,179,179,86,156,44,208,109,103,228,3,139,18,97,240,90,134,147,44,32,170,180,
+171,202,36,118,1,68,70,29,8,112,133,85,171,31,23,214,182,126,3,167,222,174,60,136,213,81,57,33,100,234,106,225,26,10,43,202,129,167,63,211,
+242,238,169,106,150,231,212,200,232,117,30,42,55,23,105,79,125,229,91,63,13,234,98,158,137,32,158,72,229,176,178,169,144,81,135,5,75,86,98,145,
+84,57,24,152,178,136,20,169,111,64,174,101,168,242,240,128,215,214,139,42,8,239,79,82,134,141,35,162,153,50,236,69,203,194,182,163,214,204,160,92,
+116,107,51,71,72,93,93,66,21,52,16,202,177,201,31,157,135,22,147,215,92,70,49,226,160,42,101,18,246,28,226,31,89,207,55,210,135,86,38,71,
+79,18,4,176,144,70,198,172,8,144,73,113,16,218,49,149,78,169,178,118,159,232,236,180,65,255,161,82,247,189,222,103,83,50,24,247,81,189,55,175,
+145,6,250,108,67,46,57,228,0,48,217,111,72,37,49,164,17,175,82,228,182,115,142,241,118,134,52,103,50,244,31,109,194,223,225,89,151,200,201,78,
+226,97,13,13,227,83,180,109,187,14,164,117,57,24,158,94,49,32,214,217,67,177,224,198,106,172,68,173,140,193,128,178,96,69,28,108,147,252,207,45,
+38,4,44,113,6,16,227,193,58,253,12,204,181,204,32,224,91,45,36,7,151,129,93,7,130,76,87,19,104,178,64,80,212,69,104,64,10,77,129,211,
+128,222,140,191,87,193,110,197,236,14,55,206,115,220,164,81,210,130,203,143,157,135,146,241,60,92,45,17,1,142,124,42,238,62,4,197,56,251,138,158,
+210,146,82,112,112,76,17,183,137,119,34,107,183,6,236,247,33,175,9,78,79,133,130,164,172,58,255,11,134,12,168,164,152,25,20,168,162,81,197,171,
+165,109,21,22,33,52,99,65,32,35,219,236,115,75,184,36,16,14,145,138,37,3,242,242,141,110,132,22,110,29,175,152,233,43,21,20,232,18,217,141,
+18,234,6,158,225,3,143,115,131,122,53,88,248,8,100,233,63,29,139,92,126,101,19,151,6,34,21,88,151,234,251,120,242,176,122,220,108,207,27,184,
+231,27,3,63,88,152,234,95,162,132,85,211,134,178,187,231,24,48,173,134,179,153,43,102,79,163,148,139,77,147,90,140,67,163,181,10,90,249,154,243,
+18,134,221,128,102,196,40,48,192,32,81,72,60,250,133,217,148,32,227,45,30,37,48,233,21,38,85,188,106,171,41,54,143,214,244,210,104,19,193,18,
+165,113,210,57,24,56,18,209,140,85,211,49,29,116,35,130,141,175,156,184,97,166,115,25,91,45,161,95,17,4,98,16,73,99,136,44,34,97,133,65,
+217,90,179,37,23,22,80,49,238,46,136,89,57,62,95,146,20,41,220,143,42,23,208,192,198,152,221,196,93,108,208,213,215,38,21,216,161,33,116,35,
+88,138,92,73,89,34,222,52,144,71,184,221,61,65,104,180,113,9,194,38,57,252,110,190,100,244,100,66,183,141,36,26,81,237,241,17,221,220,30,57,
+114,32,39,183,75,24,222,13,78,7,76,201,70,209,220,215,136,212,208,108,43,139,212,197,16,160,134,52,198,80,36,213,0,155,148,154,170,151,224,112,
+97,202,133,14,159,32,78,108,101,132,2,11,128,201,49,98,6,159,177,124,4,1,131,75,38,209,133,138,165,188,168,24,167,56,88,144,209,204,226,246,
+243,121,253,126,229,138,93,207,66,183,98,241,152,131,197,90,109,86,167,146,221,245,183,118,167,224,133,66,200,22,44,131,0,139,60,76,155,148,200,164,
+92,89,64,26,160,115,74,244,189,241,167,7,70,131,97,52,112,174,153,98,201,14,71,135,168,79,111,136,209,241,203,210,127,15,72,154,49,47,118,251,
+220,115,238,74,228,244,184,164,238,5,155,96,59,120,129,142,77,189,138,34,194,13,177,203,192,116,113,204,66,44,102,72,24,180,80,105,82,204,69,26,
+17,105,54,139,131,95,204,62,9,35,68,133,233,250,134,203,112,72,249,136,191,6,212,42,177,192,232,250,124,179,231,45,241,128,247,186,25,154,220,110,
+140,75,0,228,201,123,23,39,58,220,146,192,95,87,73,24,226,60,42,103,212,52,18,17,34,32,176,96,53,78,148,121,2,73,94,98,80,203,48,160,
+67,74,174,211,227,168,22,57,219,89,161,40,107,55,180,118,42,169,58,60,253,9,36,0,8,133,142,241,41,134,100,108,83,51,46,139,90,220,10,157,
+218,17,33,147,99,143,90,1,46,133,58,154,13,71,78,68,110,94,177,234,132,32,1,14,113,162,70,195,136,0,98,19,111,198,223,97,8,111,250,222,
+174,114,17,67,192,154,154,74,7,86,211,243,245,252,30,171,147,246,184,153,27,222,6,22,100,133,18,123,151,56,185,113,214,229,196,78,42,224,150,200,
+131,146,181,14,156,43,196,245,126,53,28,92,200,92,125,70,183,111,64,175,25,176,216,62,28,33,147,40,0,164,71,78,177,109,145,33,156,60,72,151,
+105,244,179,225,28,248,251,29,121,147,5,175,64,5,200,16,145,155,144,43,36,244,189,121,202,20,177,240,200,4,3,30,211,160,115,164,206,138,66,139,
+135,26,104,15,34,8,81,240,1,130,90,80,35,152,2,226,98,87,131,72,4,83,14,244,145,88,74,254,34,35,0,155,254,87,163,144,28,53,46,104,
+147,171,197,219,248,251,218,74,110,121,132,122,220,42,203,12,203,210,221,20,151,91,178,10,233,169,76,213,17,52,226,74,109,132,5,110,97,40,140,193,
+200,156,220,65,178,119,129,197,8,0,247,52,78,77,201,86,92,9,80,8,56,72,107,22,124,34,99,173,80,92,84,124,13,184,193,79,7,165,197,120,
+230,225,204,32,5,65,113,112,65,112,103,219,202,193,112,72,112,20,193,152,99,108,241,53,97,212,149,94,20,80,5,74,4,245,112,6,163,39,112,92,
+155,130,193,185,179,97,83,26,7,22,195,180,14,154,193,13,168,25,182,179,220,128,42,34,57,103,7,15,163,240,245,52,251,222,118,145,157,111,132,67,
+148,161,118,121,27,101,3,46,249,41,173,126,126,4,185,52,160,167,2,20,28,123,207,62,222,149,149,136,1,32,139,77,37,15,147,64,241,195,73,137,
+242,162,143,57,204,181,142,88,12,250,193,26,17,8,83,112,192,67,68,97,38,79,14,131,224,176,72,162,179,196,242,110,68,111,15,181,215,216,50,92,
+120,210,17,186,198,119,76,142,182,108,88,135,4,217,14,7,167,177,148,218,241,33,75,22,212,53,200,132,93,56,69,8,220,126,214,89,240,16,191,120,
+55,96,49,116,204,12,23,3,147,113,44,54,154,12,69,240,101,244,124,28,114,184,27,91,24,213,62,102,80,49,154,84,151,165,226,135,3,86,237,35,
+239,197,206,118,56,235,5,61,235,90,37,40,41,136,0,136,143,16,219,85,220,157,38,62,17,113,70,164,250,107,52,92,121,129,154,241,176,227,58,113,
+80,81,194,142,242,164,1,22,240,112,212,56,208,0,72,116,201,136,28,186,197,215,83,137,215,50,49,16,232,100,189,16,57,169,222,29,84,64,152,214,
+75,196,197,132,225,104,154,148,205,55,20,32,152,107,17,5,192,160,184,26,8,164,180,182,128,117,135,160,175,16,198,64,121,208,103,34,168,206,91,103,
+211,243,113,84,204,129,194,230,106,78,239,80,113,160,215,112,186,109,174,250,155,230,206,86,154,80,75,128,233,249,214,103,230,10,218,72,36,76,245,52,
+54,106,19,5,168,155,50,36,65,36,164,3,36,4,139,127,73,242,161,163,9,104,49,228,49,6,223,177,193,5,2,141,105,152,140,167,33,8,33,140,
+33,46,75,25,96,162,159,225,113,221,145,18,77,110,190,193,147,93,196,5,182,76,149,36,225,17,33,99,198,37,182,33,77,113,81,131,20,18,9,28,
+34,14,61,93,74,165,206,130,140,196,75,48,65,72,20,147,38,89,49,32,8,2,61,186,125,158,237,156,229,187,18,186,222,148,75,26,197,144,66,38,
+79,142,42,115,76,54,203,36,25,84,98,128,36,176,234,77,1,99,135,102,65,77,154,224,71,130,112,134,187,177,78,60,201,28,28,130,167,177,33,178,
+196,96,244,197,57,49,146,37,55,142,166,37,134,55,94,72,153,196,111,214,73,114,144,62,121,126,6,29,248,152,4,215,70,52,235,100,188,89,163,10,
+41,67,144,131,161,129,56,11,53,170,145,104,142,255,129,130,108,105,157,122,25,88,52,116,166,143,113,90,252,76,119,149,14,113,54,102,6,125,107,160,
+235,11,227,247,5,117,36,179,247,51,85,207,242,250,45,192,230,110,35,216,248,18,38,97,108,108,156,112,49,103,185,30,10,176,84,158,89,199,123,127,
+42,219,166,53,110,195,32,70,18,104,44,48,204,235,167,52,68,214,2,28,169,205,238,226,52,108,11,32,68,97,114,169,192,80,153,112,8,68,85,36,
+202,12,240,165,50,24,2,5,15,8,170,105,242,54,105,232,49,37,9,179,138,61,51,2,16,0,71,77,225,143,130,161,42,0,73,6,71,96,67,202,
+173,166,108,171,220,86,33,18,187,80,72,72,56,247,31,53,70,155,41,208,152,120,188,58,65,22,34,193,166,36,100,170,148,98,129,96,188,142,79,47,
+119,186,118,22,85,12,239,168,23,3,181,44,205,76,121,58,220,17,64,94,109,57,66,112,217,214,3,167,160,44,241,148,98,73,107,84,226,227,16,136,
+14,30,56,128,128,44,0,207,62,181,216,129,50,124,70,40,135,144,124,183,3,68,99,21,109,236,13,214,20,24,152,115,27,112,98,99,96,131,97,13,
+60,202,239,12,174,47,72,25,38,196,92,70,143,142,30,197,209,66,69,100,163,136,161,83,97,26,67,74,190,92,102,23,21,8,42,64,211,206,100,50,
+144,236,251,216,44,181,83,151,66,16,204,215,198,116,37,130,151,161,44,42,91,55,33,63,13,199,225,35,6,239,151,244,238,16,69,143,137,67,91,115,
+9,78,37,118,136,138,56,84,81,70,88,14,148,172,183,4,150,106,146,48,90,44,112,165,73,72,17,204,181,205,177,72,221,94,4,243,16,26,122,64,
+148,80,83,226,28,170,56,0,65,53,11,91,229,78,94,206,244,180,200,98,118,92,37,38,203,242,169,193,21,72,200,229,199,216,102,206,4,45,248,13,
+51,129,130,112,3,133,83,36,128,143,181,52,149,138,151,129,167,96,166,212,92,145,144,122,25,107,14,106,17,25,150,6,4,146,15,56,132,223,145,73,
+92,153,141,77,13,131,167,91,45,137,136,211,192,94,27,150,174,193,44,92,191,197,182,115,208,176,59,92,138,151,188,128,13,180,6,77,72,236,166,187,
+237,99,170,33,129,97,180,42,101,68,203,13,229,25,37,7,2,150,68,67,135,60,97,14,20,212,103,85,33,68,131,174,242,128,14,64,79,65,110,35,
+147,75,28,10,145,192,80,8,116,155,32,1,74,137,92,99,16,141,197,176,18,32,52,201,129,158,192,132,58,188,105,155,179,4,146,209,228,70,2,168,
+6,32,42,34,156,98,160,210,166,84,168,112,238,45,46,9,85,147,205,225,55,70,100,43,226,60,181,210,2,65,228,55,247,16,155,47,64,103,221,59,
+2,217,101,40,143,119,87,55,69,92,41,92,206,166,53,108,238,82,46,2,190,86,189,55,146,197,162,128,16,96,192,134,105,129,197,86,49,102,141,83,
+28,225,218,172,94,45,129,147,16,26,86,79,176,232,43,38,122,210,236,6,57,165,227,7,76,124,201,114,94,21,84,142,44,32,138,118,32,45,139,169,
+187,104,209,72,58,122,197,2,74,145,82,104,44,156,201,107,64,110,124,98,64,74,9,133,46,37,9,239,212,45,118,31,152,89,96,78,215,180,65,163,
+216,102,104,237,23,75,29,8,141,204,223,99,10,55,213,249,218,98,32,25,123,25,37,196,28,196,157,69,131,46,200,132,143,54,158,111,94,140,139,83,
+56,219,155,87,54,47,14,72,214,21,227,206,107,154,45,45,18,220,197,87,58,156,240,230,73,32,241,224,42,146,98,80,33,211,0,0,132,72,21,5,
+166,144,164,18,112,177,240,153,44,1,136,72,49,66,37,116,16,29,81,133,82,22,76,33,133,46,180,247,136,147,25,241,10,74,45,200,173,149,33,179,
+78,165,154,224,35,131,83,5,64,36,227,9,45,56,207,148,33,64,199,192,178,222,178,49,208,80,37,50,92,164,102,172,224,77,67,22,179,193,236,229,
+16,248,182,171,142,209,208,212,53,102,11,124,165,140,10,172,0,69,18,53,146,4,211,209,209,223,167,185,165,27,35,74,182,103,18,176,150,115,29,146,
+158,86,58,232,167,103,99,54,56,53,41,186,89,53,47,202,54,60,168,21,220,181,193,153,64,218,47,40,42,105,242,186,240,33,21,150,52,100,11,74,
+41,175,84,190,100,68,110,222,52,179,75,222,211,62,69,239,15,161,45,153,135,148,160,178,96,6,48,170,163,185,109,124,104,181,232,66,116,16,81,10,
+16,117,101,41,143,10,35,104,194,193,140,1,167,231,83,52,102,131,12,145,169,110,206,64,8,243,17,20,211,112,176,210,106,205,0,81,61,196,36,136,
+130,4,96,204,185,138,254,177,115,234,46,186,142,37,174,52,227,62,174,238,76,18,55,152,194,226,108,45,234,52,32,180,147,84,208,4,170,35,52,208,
+19,37,10,156,210,130,40,138,96,66,2,62,84,53,90,169,167,56,96,197,25,252,163,176,102,227,16,123,242,27,24,194,13,54,113,21,96,54,51,208,
+187,51,34,5,102,144,9,134,160,194,130,56,118,45,152,176,68,138,138,21,49,206,4,66,135,17,33,225,184,235,133,75,200,186,105,141,14,40,161,132,
+121,66,0,213,249,202,11,101,8,6,18,138,201,130,97,0,67,65,133,105,225,10,218,196,10,218,53,7,108,227,44,226,28,155,106,61,44,200,128,62,
+0,66,16,53,48,1,243,252,246,166,217,248,153,83,55,57,198,250,16,9,70,131,232,138,40,209,227,150,89,49,201,4,116,97,204,38,200,25,63,7,
+198,63,69,245,201,18,11,42,172,197,233,69,68,166,201,100,13,54,66,49,27,163,231,178,164,209,195,114,185,201,224,203,109,6,129,97,97,74,248,54,
+113,178,225,105,107,182,43,199,66,33,78,197,130,147,236,92,177,11,199,248,53,198,109,221,245,0,46,240,252,80,227,146,237,100,117,255,7,123,49,111,
+39,21,186,122,30,84,166,136,79,52,214,237,241,15,91,253,23,198,25,136,228,194,204,148,137,133,132,76,20,43,217,183,246,255,166,158,217,189,199,252,
+159,147,205,226,255,131,79,67,33,247,112,231,75,63,111,197,126,153,231,199,192,63,40,86,25,46,249,248,136,57,108,76,18,51,183,112,214,223,119,142,
+4,67,135,249,190,61,254,205,159,219,171,99,217,93,130,235,87,209,167,142,46,174,178,161,61,14,227,159,178,179,204,108,116,114,112,215,241,125,242,116,
+43,248,116,122,181,235,217,187,206,168,169,54,102,222,154,162,190,249,56,182,142,142,143,243,248,166,77,253,222,19,102,175,32,52,223,249,58,230,28,43,
+224,109,112,135,217,218,44,8,253,63,82,122,121,176,124,180,124,29,172,107,166,190,196,6,28,188,202,167,47,187,62,61,189,63,199,253,170,209,209,240,
+124,223,23,205,238,23,230,43,49,124,255,139,229,198,227,124,108,37,254,29,5,159,61,119,88,93,236,109,20,3,199,250,33,203,47,34,161,74,134,153,
+162,29,173,116,154,62,253,194,93,127,179,242,201,97,121,254,75,111,138,104,202,160,29,4,50,192,227,150,137,108,45,119,255,87,202,121,21,90,217,33,
+165,64,203,84,103,105,59,189,172,49,156,152,68,236,126,238,48,201,44,122,7,8,46,140,224,179,159,152,117,228,194,24,129,183,201,157,232,128,105,42,
+137,92,140,53,249,2,85,224,123,84,232,70,100,18,141,242,237,249,127,206,49,168,31,236,246,118,117,124,219,185,183,94,20,22,146,235,12,93,106,211,
+106,93,44,50,151,37,52,139,147,57,213,179,24,141,52,92,243,120,190,24,16,96,104,229,6,6,214,230,1,96,26,116,105,138,3,86,9,42,229,224,
+207,143,102,40,111,143,236,222,211,80,249,11,9,250,49,231,147,230,251,101,209,119,12,146,120,254,12,165,118,30,233,114,159,224,227,142,72,37,1,95,
+145,149,242,255,119,173,170,221,241,241,76,243,198,72,51,111,19,36,237,245,87,191,4,178,32,218,110,90,113,90,229,19,143,160,101,54,23,68,142,158,
+32,150,207,46,235,9,198,236,125,190,159,239,4,57,255,248,57,174,213,255,208,62,78,13,21,168,103,182,24,35,244,209,107,87,223,162,184,223,96,48,
+219,205,131,158,94,168,244,23,14,191,204,89,246,253,221,234,197,164,145,26,216,8,52,227,224,0,201,223,213,129,223,95,52,13,211,241,112,210,60,83,
+87,12,94,79,202,79,22,79,107,96,242,116,176,175,128,143,5,157,62,40,123,121,164,150,148,43,70,31,47,209,90,137,133,16,10,28,29,187,49,109,
+190,137,170,175,191,193,193,229,183,144,210,170,200,227,62,142,54,114,125,249,180,7,231,248,151,10,213,197,45,108,107,132,52,1,35,101,24,214,139,46,
+182,145,116,101,231,241,255,159,109,167,217,255,128,252,223,213,197,241,112,81,215,251,171,190,254,239,150,19,97,104,178,247,236,202,81,65,244,251,141,248,
+124,209,21,32,83,151,175,216,82,174,157,66,10,43,175,54,174,81,185,79,227,238,4,185,155,105,58,31,122,162,140,227,66,174,202,211,11,209,199,92,
+213,78,20,29,203,29,217,84,128,117,254,142,58,120,50,138,38,109,209,88,186,190,61,5,141,145,90,14,11,101,130,203,242,42,52,104,246,248,139,148,
+29,215,222,141,80,164,24,191,79,102,110,176,243,23,77,61,213,55,233,226,208,12,235,230,190,186,140,36,19,207,236,52,120,124,25,81,138,15,72,113,
+255,135,31,240,175,179,213,131,230,243,65,255,220,11,181,46,254,74,185,125,120,15,91,97,223,78,142,153,209,131,241,243,64,12,172,144,192,166,40,137,
+143,145,241,151,230,252,117,104,149,139,25,226,227,155,4,99,121,177,4,229,101,223,11,181,108,242,207,117,27,115,4,47,205,215,86,228,231,66,2,201,
+104,71,30,196,140,200,198,103,10,9,210,102,224,3,198,54,163,84,183,146,41,36,229,94,65,94,201,47,136,75,127,213,241,147,20,107,136,57,98,48,
+65,155,235,201,161,28,245,48,53,122,104,196,111,45,147,34,252,143,105,149,12,90,163,207,36,72,223,187,63,203,253,190,242,136,223,179,179,103,23,246,
+124,89,156,62,204,105,4,219,231,159,135,139,159,28,58,189,107,4,219,234,112,111,21,17,74,5,48,28,190,165,180,122,163,142,30,169,55,225,138,74,
+205,119,135,240,107,203,201,139,233,131,224,225,53,43,228,92,235,31,50,218,22,66,122,181,109,89,77,50,179,171,131,215,197,18,126,223,230,235,7,6,
+117,172,159,7,194,135,65,251,255,153,120,246,3,73,50,120,125,11,181,147,79,28,60,14,190,93,21,103,77,153,102,27,99,242,105,157,72,152,11,173,
+152,140,254,30,135,215,101,157,41,217,131,105,28,112,136,74,187,90,172,194,201,119,250,255,47,158,150,123,56,189,30,111,103,155,217,67,191,131,249,110,
+184,191,135,217,191,211,193,211,134,82,85,199,58,209,86,117,247,114,212,193,134,81,201,193,189,6,48,98,81,87,151,17,31,46,233,79,131,174,14,13,
+31,223,234,24,110,227,152,67,75,146,24,18,32,4,232,138,44,103,3,15,0,11,187,194,76,143,134,10,54,234,167,15,52,170,13,164,136,152,197,184,
+93,247,110,111,175,226,188,215,114,196,32,103,242,79,142,234,175,151,178,245,145,220,60,16,122,124,82,190,30,98,165,53,244,39,134,142,11,248,120,160,
+90,198,0,147,139,109,100,251,188,109,119,119,73,136,153,182,246,251,126,126,116,221,193,245,106,197,253,94,44,26,62,239,225,234,228,191,227,224,147,242,
+129,139,247,213,132,180,117,174,75,58,98,16,14,168,17,133,249,48,111,86,130,122,123,172,79,151,184,181,235,252,220,181,139,217,90,195,207,197,130,15,
+175,178,1,245,240,4,99,73,197,49,230,6,212,84,161,225,146,72,61,114,96,213,241,224,205,55,244,244,72,174,62,202,229,153,150,199,187,195,154,97,
+122,254,39,124,122,168,29,58,183,154,141,52,72,79,15,51,95,130,54,147,240,127,143,5,152,118,62,126,31,246,125,115,244,82,52,98,233,82,141,37,
+96,16,220,66,31,183,193,193,225,45,76,56,138,5,13,130,190,175,111,191,211,15,149,51,122,61,222,143,23,7,131,155,139,118,217,153,150,51,7,78,
+146,166,177,54,24,204,181,172,240,0,110,72,9,5,116,73,195,138,35,37,174,32,121,120,25,183,17,19,94,194,22,156,63,34,118,139,171,14,62,238,
+21,40,215,209,6,26,22,183,116,118,195,152,152,89,187,121,24,226,141,8,180,202,22,255,69,117,131,201,233,195,228,46,84,120,63,14,233,5,167,226,
+199,252,191,240,54,252,126,206,52,160,71,162,76,111,67,149,126,7,75,124,72,32,39,21,215,161,10,240,253,5,215,143,208,89,196,57,29,156,123,160,
+246,234,136,120,124,91,87,7,23,56,104,191,223,211,207,252,106,187,147,54,207,187,245,89,147,217,116,193,204,5,233,213,219,140,57,190,60,241,85,206,
+217,155,223,55,71,211,184,199,72,130,141,154,221,18,43,123,189,158,80,168,216,246,10,122,123,161,237,251,177,133,196,219,5,18,196,146,178,140,181,201,
+2,4,150,162,11,190,254,44,70,250,124,10,151,131,157,87,74,23,43,143,35,11,215,228,166,154,166,214,252,142,189,51,32,101,2,134,1,197,132,20,
+73,202,104,13,76,144,101,192,243,211,238,190,59,184,110,21,42,162,191,63,254,47,13,227,221,105,64,28,7,156,246,8,117,234,25,237,243,95,24,243,
+26,26,110,123,38,250,241,249,254,190,49,77,187,242,116,116,118,126,78,35,43,34,192,97,225,166,24,227,25,91,233,200,58,228,227,59,53,105,42,168,
+211,118,12,48,4,97,209,75,236,122,73,131,195,192,106,242,70,51,98,198,2,23,4,181,155,1,79,143,178,119,176,168,37,38,192,41,233,208,100,145,
+166,169,157,246,114,112,156,140,40,0,55,117,242,73,211,153,171,167,201,172,119,22,120,56,191,46,170,168,249,249,24,62,60,70,20,94,87,98,232,250,
+73,55,23,26,209,139,183,17,26,57,23,95,1,103,183,228,233,28,0,92,200,211,66,5,12,131,60,254,9,90,5,226,84,35,25,17,175,233,233,237,
+248,96,205,209,228,244,115,118,124,211,112,88,217,22,144,167,165,122,61,33,75,252,254,168,125,188,213,181,124,217,78,24,160,123,98,161,107,136,236,6,
+60,71,57,36,104,12,4,48,220,248,144,26,245,75,61,202,141,112,9,231,113,211,23,7,194,107,189,31,233,244,92,111,215,252,139,229,119,54,158,31,
+171,72,64,107,113,65,206,201,141,142,66,128,128,189,27,177,132,214,23,158,142,64,251,238,221,225,196,160,245,252,13,237,155,96,249,117,0,15,96,70,
+4,168,80,117,228,232,250,212,137,24,34,222,195,4,250,167,157,152,37,175,81,82,124,212,134,128,66,44,24,203,167,246,249,101,141,121,188,158,206,46,
+78,207,49,61,83,3,134,196,67,166,87,209,142,185,114,118,172,198,194,8,62,63,145,222,125,0,29,127,21,120,113,83,52,157,48,93,139,225,232,6,
+185,36,64,212,215,208,211,150,1,32,23,196,68,208,116,223,201,106,84,18,1,113,49,151,200,98,90,167,33,230,60,253,24,229,163,147,110,190,78,28,
+155,56,66,184,250,41,88,236,164,110,4,6,203,153,112,185,144,219,22,194,223,223,238,147,142,160,55,143,246,87,124,200,150,219,148,1,97,152,139,25,
+93,18,105,47,39,28,82,86,41,153,207,154,0,114,241,69,47,95,70,7,144,161,89,219,47,241,255,11,228,220,253,159,103,243,39,87,250,165,201,118,
+54,9,116,221,175,182,140,226,187,158,51,193,207,16,176,232,141,167,208,54,145,132,6,223,16,250,124,218,86,31,197,207,140,155,2,156,62,235,120,248,
+41,1,50,103,109,11,204,79,111,67,15,215,221,30,24,52,1,125,124,148,43,203,212,172,176,8,33,128,235,108,196,6,25,16,5,136,212,109,128,89,
+69,154,15,29,130,102,142,144,208,130,132,51,90,181,40,101,26,192,204,156,102,153,86,178,139,224,78,95,155,158,154,58,60,116,253,30,152,48,59,180,
+19,64,204,60,63,179,29,184,255,193,207,120,112,8,232,159,37,222,252,147,51,211,154,127,63,248,107,124,48,120,60,95,4,30,47,71,178,197,203,242,
+87,109,251,186,229,25,182,175,7,29,237,234,243,169,153,205,69,94,123,32,114,80,153,245,9,107,92,74,118,66,71,46,72,155,45,133,105,92,166,243,
+252,9,134,253,208,11,215,200,227,105,42,42,188,180,115,122,84,194,13,12,106,66,234,173,66,187,121,152,189,121,28,61,183,68,217,194,235,57,71,20,
+84,193,155,158,132,4,178,15,207,228,42,209,9,129,92,19,51,135,1,6,148,16,203,89,93,52,240,247,109,133,191,155,218,242,247,109,22,14,86,69,
+146,216,71,145,82,180,177,89,23,78,98,189,57,140,210,233,182,31,251,118,203,171,54,172,158,47,163,118,47,216,177,76,51,54,184,33,190,118,99,203,
+138,185,235,66,23,125,203,74,248,26,244,234,132,177,46,82,217,97,210,10,7,124,4,0,76,178,138,232,101,128,238,146,121,104,228,231,16,5,143,49,
+56,122,136,95,79,196,120,91,83,10,174,120,187,180,140,89,61,253,18,114,143,4,89,70,168,22,112,174,141,98,224,105,135,134,12,140,174,20,69,103,
+225,197,230,229,172,216,177,216,10,120,178,182,11,143,28,250,22,187,37,24,241,62,60,255,163,14,30,191,221,142,62,175,191,39,0,250,98,204,248,163,
+175,80,142,38,78,14,173,36,11,61,52,65,254,255,125,240,147,171,22,111,232,221,179,155,138,137,17,191,85,159,10,139,29,237,56,37,157,110,233,113,
+48,244,67,12,179,33,26,60,48,179,201,133,36,32,141,102,183,73,155,210,198,101,248,51,233,205,138,94,25,32,138,142,91,17,75,26,178,64,1,197,
+142,140,31,135,220,11,209,112,177,192,65,10,88,17,95,117,250,205,200,250,88,5,175,193,203,72,126,143,46,63,131,24,209,119,78,174,143,181,208,85,
+219,161,84,203,67,158,113,17,3,98,60,189,196,110,191,137,254,124,216,3,172,83,32,56,88,161,52,0,83,135,183,33,136,3,162,205,166,85,141,27,
+175,145,88,248,161,211,102,158,127,225,47,15,31,55,226,230,183,249,55,102,226,243,85,191,65,75,87,27,208,60,244,209,173,40,195,25,125,31,43,77,
+146,144,232,229,101,80,145,140,207,52,19,230,3,119,238,171,88,160,213,222,195,24,139,135,66,64,22,162,0,78,174,207,231,213,197,76,166,209,199,52,
+155,106,115,50,148,25,161,82,35,41,180,107,0,144,245,65,55,14,255,83,66,234,225,79,84,96,86,89,29,86,178,34,137,87,4,232,51,48,155,51,
+218,19,20,114,226,136,95,15,184,201,249,252,218,45,19,97,176,133,182,0,136,0,42,37,130,7,82,86,0,196,32,196,170,84,128,150,75,60,37,103,
+193,229,173,248,127,95,109,98,147,7,213,70,239,155,186,138,61,7,16,39,56,24,124,189,57,37,124,162,107,231,10,42,222,18,34,66,229,145,200,175,
+49,227,77,206,78,123,185,190,28,147,31,151,71,119,248,124,81,66,215,68,151,142,78,79,14,254,205,17,251,254,104,225,109,136,20,47,71,131,231,139,
+1,94,28,13,56,138,98,133,134,6,157,197,166,97,151,29,14,71,94,40,42,231,130,202,216,35,201,93,255,139,92,111,204,51,210,193,21,2,33,147,
+77,191,187,158,60,81,152,213,117,151,146,44,56,115,52,161,144,239,215,236,20,165,17,16,227,180,84,11,61,128,44,132,61,97,138,1,60,104,242,215,
+159,254,80,162,130,126,14,173,255,250,56,48,35,209,103,135,3,164,151,142,57,171,141,112,120,71,197,246,220,205,105,155,103,166,34,67,64,136,68,39,
+151,212,4,237,224,83,70,130,105,224,22,60,7,73,112,38,155,163,45,217,35,116,22,133,146,101,72,58,173,89,157,27,120,35,56,72,177,246,120,199,
+39,163,203,143,201,57,67,117,39,1,8,70,90,182,58,120,245,40,175,143,85,156,47,155,155,239,213,33,112,132,156,215,194,190,174,63,47,241,37,57,
+200,233,164,235,71,163,188,72,240,124,165,221,150,167,97,41,141,62,227,112,196,0,216,19,215,201,44,253,92,162,216,210,4,235,1,160,33,112,201,111,
+47,175,167,59,240,245,124,28,220,28,28,31,38,9,23,101,91,190,52,143,39,150,49,165,3,225,188,81,27,132,187,48,173,62,74,223,143,20,14,198,
+70,68,116,148,152,155,135,34,7,199,232,135,61,72,12,114,36,252,23,164,46,129,220,113,0,77,170,110,81,51,4,233,10,38,77,227,130,35,44,99,
+128,35,69,240,73,148,202,129,150,198,9,128,244,20,216,181,133,218,167,132,80,205,35,218,28,26,208,230,140,104,92,200,210,163,35,102,122,244,25,47,
+197,41,226,189,4,17,143,133,88,49,124,59,12,208,152,145,245,30,211,137,214,82,84,38,32,105,226,57,235,212,159,12,59,247,255,12,174,221,246,6,
+79,252,64,197,201,248,173,74,180,67,108,45,42,236,223,219,68,146,254,30,100,18,220,172,230,194,211,178,194,218,28,83,118,226,41,220,197,38,121,32,
+121,7,62,226,167,195,234,138,59,88,172,156,40,152,171,29,145,181,55,4,18,236,108,113,152,211,85,167,15,99,74,18,216,239,62,68,34,218,153,174,
+229,215,144,35,141,113,77,71,120,251,139,44,185,161,24,232,104,194,101,195,34,19,211,236,62,26,2,20,230,150,59,4,1,160,231,78,37,243,230,74,
+104,130,60,122,150,26,154,4,200,181,234,57,113,232,68,240,13,178,8,57,120,15,199,152,2,211,60,255,79,199,134,201,184,62,1,248,59,60,219,170,
+9,243,127,39,254,91,182,107,165,112,115,131,163,233,88,72,176,162,183,154,6,223,116,210,120,76,206,12,163,68,71,121,162,33,202,136,33,123,115,64,
+15,159,217,20,249,240,118,124,53,73,12,36,243,111,109,125,139,142,105,207,99,198,204,46,85,146,173,195,33,18,16,129,196,60,36,209,222,238,77,172,
+97,225,42,134,73,33,64,136,179,192,193,90,228,175,116,244,158,97,109,236,78,61,9,104,148,24,245,14,222,103,210,88,32,78,54,104,218,80,73,57,
+124,26,211,68,164,147,38,123,120,35,11,4,72,181,213,119,182,233,44,229,29,201,66,187,102,85,31,191,167,159,132,44,103,7,7,249,37,179,221,240,
+26,95,49,215,134,131,109,11,105,98,79,202,17,144,105,202,192,132,244,51,150,228,52,177,96,240,186,13,214,173,0,27,102,153,222,25,160,55,10,188,
+17,174,58,41,63,170,248,235,241,6,53,164,188,22,151,22,113,143,131,30,63,131,108,97,240,23,142,35,40,21,175,224,231,140,221,147,235,29,147,28,
+99,77,177,114,105,56,185,183,195,98,130,216,236,154,92,233,254,15,210,95,23,24,205,17,203,154,245,192,130,8,177,151,230,233,159,35,173,239,245,20,
+240,160,18,200,169,185,230,205,132,161,234,202,92,154,72,230,74,254,200,225,124,194,9,33,111,70,120,205,99,250,111,237,241,229,74,63,97,114,125,213,
+106,228,249,26,93,132,14,18,20,33,215,167,130,27,126,63,112,251,92,16,227,137,214,109,142,31,186,125,37,161,18,228,50,231,138,205,46,138,12,165,
+187,33,70,243,49,214,196,106,80,203,186,240,114,113,172,245,32,43,182,76,157,246,64,28,98,236,218,117,72,182,213,89,252,214,207,183,176,132,207,137,
+88,88,132,29,175,228,157,175,176,85,246,55,72,234,163,142,2,77,164,177,8,39,50,195,129,161,110,34,194,128,146,73,199,20,32,29,16,199,116,231,
+97,80,202,85,32,225,44,80,4,43,101,91,216,193,4,160,58,36,180,33,193,89,230,40,198,26,109,235,245,241,207,53,152,61,26,180,125,19,81,243,
+70,39,112,99,229,232,182,117,173,175,164,228,140,101,148,66,102,48,84,56,87,129,66,215,96,6,22,65,77,14,241,234,130,23,38,94,41,225,78,100,
+107,177,12,173,14,146,54,172,140,209,188,167,128,162,179,57,120,23,13,248,12,105,80,20,74,170,8,183,128,76,226,227,40,106,159,31,226,233,182,138,
+19,203,234,108,233,137,147,136,8,120,131,66,78,86,26,21,8,6,16,189,62,172,93,100,37,216,202,57,128,73,212,70,152,195,138,250,126,105,223,159,
+129,1,100,111,178,48,113,107,2,32,191,47,185,235,199,192,39,227,197,201,252,60,153,173,223,175,199,247,147,39,191,228,249,177,59,87,245,65,102,69,
+24,204,194,188,154,231,141,212,237,238,229,190,132,191,62,163,229,196,51,164,200,130,147,58,41,239,196,48,56,203,219,244,62,90,102,102,156,72,107,134,
+254,9,101,100,130,157,129,17,200,174,60,12,105,76,196,164,240,92,143,207,232,137,249,89,84,55,51,199,100,93,94,51,131,85,115,232,75,79,80,103,
+98,225,220,213,167,65,120,213,4,15,8,36,104,164,222,6,120,179,225,114,1,76,72,96,99,199,220,154,68,201,188,56,177,86,180,238,149,238,80,99,
+152,15,208,62,158,161,231,115,46,225,52,199,8,99,154,41,66,17,36,53,24,122,110,95,143,207,167,92,240,113,65,147,197,179,54,175,37,214,36,64,
+201,203,111,213,241,233,230,165,187,232,95,195,234,15,93,0,106,68,92,80,211,82,21,223,146,195,148,161,32,14,196,22,0,94,131,81,165,149,66,137,
+45,64,46,142,29,215,195,146,182,212,64,30,18,139,1,47,64,31,112,35,76,84,97,16,102,1,90,165,44,132,136,231,233,247,69,174,19,104,227,54,
+42,192,201,84,129,0,17,144,121,18,123,226,69,87,164,91,133,225,160,38,42,181,120,196,165,24,7,134,127,146,218,76,144,242,79,31,63,209,70,124,
+170,249,60,101,115,135,78,134,227,228,58,200,151,240,66,187,242,65,182,195,43,104,188,216,225,92,208,244,254,29,61,61,68,46,15,7,192,31,71,118,
+104,38,197,199,15,187,44,118,212,123,222,221,58,159,211,35,25,233,131,6,90,44,227,49,132,113,106,141,121,243,59,6,180,146,32,144,32,90,4,65,
+71,95,160,103,24,133,60,140,41,207,111,18,56,76,140,217,83,31,49,101,16,5,100,248,124,209,199,28,145,91,138,14,90,148,148,153,74,27,220,217,
+247,39,93,200,36,43,63,102,26,120,177,194,62,8,167,198,159,36,47,191,96,229,136,32,182,109,28,169,47,197,167,123,44,163,159,3,183,224,68,236,
+27,242,17,248,226,240,114,140,146,12,165,1,88,234,62,126,76,83,214,126,238,118,232,16,86,112,151,48,99,41,49,122,86,31,241,229,198,234,36,251,
+21,87,209,102,47,96,141,20,3,219,146,161,194,183,218,177,73,235,100,152,204,206,150,59,22,90,108,88,166,88,117,120,75,163,20,63,79,224,13,109,
+139,22,114,24,195,56,38,147,75,20,129,2,248,12,139,193,128,111,195,4,156,95,134,44,9,84,77,166,255,34,13,235,224,155,93,8,90,193,146,144,
+32,66,70,85,92,112,139,141,209,115,113,231,200,198,115,236,146,121,211,145,65,164,240,121,63,40,113,110,135,92,183,108,198,49,128,39,178,85,234,194,
+126,206,51,131,49,55,200,72,123,163,244,240,32,128,25,91,36,85,193,7,62,169,15,123,232,97,149,222,111,85,47,223,216,24,65,3,33,58,98,243,
+247,225,229,225,23,179,139,63,228,224,228,205,70,238,132,70,64,52,101,76,37,108,229,107,43,134,85,26,10,227,126,135,66,80,38,65,150,121,188,159,
+25,38,33,199,155,30,30,192,7,126,233,182,176,142,57,174,218,122,14,52,232,175,175,234,151,121,40,170,178,25,115,59,195,162,3,36,240,200,36,20,
+4,206,206,8,78,250,8,12,112,69,9,136,152,91,176,99,166,35,34,18,160,134,162,243,128,16,73,27,79,66,210,3,4,69,1,138,5,28,114,232,
+4,170,9,37,86,172,224,129,96,0,132,100,145,75,32,201,0,169,129,7,2,99,192,6,136,129,24,160,132,165,144,72,207,146,47,166,251,126,123,219,
+196,73,51,124,219,189,3,187,178,128,6,6,181,230,21,171,56,239,120,146,80,70,116,28,6,88,4,16,69,122,16,195,166,102,175,69,107,240,99,141,
+60,12,243,244,35,77,200,44,35,14,67,210,146,10,41,101,224,123,88,131,36,3,159,137,152,204,1,20,142,8,70,212,196,99,95,116,22,169,212,173,
+127,38,222,27,136,121,6,209,162,7,138,8,65,17,196,2,145,100,52,13,45,174,67,92,69,186,45,168,36,207,191,161,246,240,67,134,163,8,199,27,
+69,162,213,167,67,50,148,30,142,153,245,36,53,66,177,32,219,241,102,222,67,232,143,14,32,162,179,85,165,28,217,211,36,243,254,90,231,173,70,7,
+197,204,236,152,63,145,169,213,4,210,141,99,92,118,46,95,43,185,53,195,203,220,12,226,10,80,33,60,20,74,52,4,22,74,249,145,23,30,141,159,
+125,23,85,111,127,216,27,223,7,23,41,98,104,162,122,99,196,204,234,80,6,54,33,11,92,61,15,75,102,205,222,68,110,143,125,202,119,74,187,173,
+94,63,3,48,160,252,52,59,131,142,220,17,51,158,102,32,160,56,87,64,135,17,227,106,42,57,101,80,178,113,172,123,149,172,70,244,120,233,69,146,
+112,221,21,164,30,106,231,200,248,96,101,158,218,188,28,41,62,192,101,200,12,181,18,50,19,70,121,113,28,224,81,57,249,183,125,48,56,66,21,86,
+244,254,236,62,189,120,248,121,224,224,44,220,220,152,188,213,73,161,132,144,64,22,187,124,213,195,203,2,175,25,235,19,43,51,175,4,17,142,127,17,
+41,140,18,4,81,52,226,0,53,94,186,10,57,106,136,235,124,67,0,72,105,64,195,136,175,36,195,16,132,1,184,85,216,137,66,28,141,73,80,24,
+171,175,177,237,50,157,156,210,16,225,223,7,53,45,195,228,15,78,98,60,64,187,25,114,45,44,56,223,139,23,173,64,193,62,30,67,202,17,68,80,
+150,65,194,1,81,147,24,120,39,45,125,144,124,247,58,140,115,249,175,157,145,77,223,187,179,250,234,197,146,190,30,162,194,146,41,230,192,245,206,197,
+25,231,200,16,227,153,68,0,249,111,191,235,134,61,64,79,245,93,153,125,31,115,132,132,34,137,91,135,96,250,82,26,56,101,197,134,24,232,147,165,
+130,138,89,250,30,209,177,197,109,253,130,121,68,167,137,202,29,120,141,104,65,226,233,132,55,65,148,132,163,61,254,137,99,83,145,25,140,248,46,180,
+76,16,193,132,158,42,211,77,196,190,132,18,245,249,183,211,160,96,133,145,114,201,35,196,100,152,56,161,215,18,20,33,9,96,77,192,231,152,219,56,
+233,220,211,230,181,241,0,11,84,152,64,29,209,223,33,12,180,73,104,197,48,37,80,64,98,20,96,137,167,97,131,92,18,66,1,128,97,169,179,200,
+68,111,139,201,206,41,14,122,248,137,180,212,254,221,113,161,164,209,209,130,237,218,189,208,84,248,153,36,180,208,149,225,89,78,90,64,146,164,97,73,
+32,156,243,44,101,66,134,49,201,10,104,0,14,230,101,118,43,192,42,19,42,2,254,3,244,192,142,14,85,234,181,54,16,207,42,243,41,219,220,128,
+132,135,36,16,153,210,156,248,147,175,200,28,112,131,36,0,225,98,44,222,222,66,142,51,48,75,133,82,69,198,170,22,33,90,233,150,17,8,107,113,
+25,132,185,33,26,92,8,106,103,43,13,96,6,211,13,195,42,143,28,134,147,75,178,101,76,58,144,12,228,228,229,63,22,117,236,148,34,154,15,45,
+145,4,101,81,70,195,174,161,141,51,215,195,175,183,142,15,49,98,255,16,106,23,217,226,225,138,45,199,225,192,141,45,135,36,115,210,88,35,13,242,
+65,164,171,212,45,166,53,15,191,49,101,184,21,208,170,228,154,80,158,34,67,34,57,106,184,231,199,192,143,203,232,226,243,144,151,7,167,83,134,183,
+200,74,47,18,144,137,88,137,81,155,89,88,98,82,200,26,80,32,139,130,12,161,38,1,239,212,109,113,10,34,211,16,130,3,144,100,142,108,220,39,
+191,209,71,207,18,60,153,126,127,177,19,214,223,163,127,79,49,133,24,238,189,124,81,198,5,89,40,76,1,13,16,107,54,4,142,22,42,9,116,232,
+86,15,12,125,208,172,10,163,132,30,12,237,93,217,56,68,133,10,20,16,33,16,128,186,11,246,136,127,210,220,61,19,85,217,130,45,22,119,58,108,
+68,75,199,171,61,104,8,240,149,213,172,96,70,147,77,72,224,149,102,146,12,33,110,1,9,163,169,243,232,20,90,203,144,34,121,215,97,7,9,244,
+74,209,186,108,32,205,199,15,186,117,174,11,184,213,226,198,248,18,188,139,108,38,242,112,215,153,39,149,152,33,20,15,124,131,11,68,163,13,144,156,
+132,9,133,5,235,213,11,72,34,152,11,64,108,123,84,101,74,48,64,39,145,21,162,232,211,14,236,159,93,18,101,131,138,50,156,227,176,1,132,55,
+82,152,138,91,159,27,136,243,14,169,97,35,168,25,252,125,150,86,2,204,254,159,98,169,40,40,125,180,16,200,13,109,79,167,63,122,81,118,41,145,
+226,224,162,238,76,68,94,135,107,48,157,46,250,130,30,123,249,154,179,149,45,10,88,37,87,126,133,69,165,36,205,119,199,118,138,196,204,133,26,88,
+202,230,197,206,90,33,13,195,13,108,163,8,110,148,246,36,20,197,146,112,24,66,116,117,246,55,13,65,13,107,250,48,218,212,84,1,113,243,93,214,
+98,32,20,232,70,180,16,240,96,218,149,80,174,252,18,82,52,224,80,180,190,232,168,240,187,68,101,26,0,82,41,163,57,140,233,86,227,8,225,13,
+4,140,70,11,97,236,46,148,0,145,73,198,33,72,8,76,72,30,146,177,5,16,70,19,197,54,17,30,195,112,226,146,212,69,166,13,215,182,29,88,
+191,194,50,254,150,207,217,5,188,153,60,25,186,27,55,212,49,117,244,112,112,190,217,1,40,211,158,42,187,194,155,135,223,99,134,218,112,8,49,129,
+144,35,26,12,195,51,41,245,9,157,179,108,206,80,76,108,241,72,88,112,246,3,44,68,88,215,212,252,243,2,64,128,203,142,226,26,18,173,6,112,
+65,88,9,96,47,115,146,49,144,148,109,110,224,11,107,32,177,61,119,42,234,97,9,36,58,107,224,171,140,71,160,109,144,137,24,83,5,88,193,86,
+114,212,195,111,116,136,62,58,152,102,164,17,69,120,23,66,47,146,107,200,3,2,59,145,211,36,197,17,72,16,12,99,138,109,34,144,224,0,66,224,
+148,226,29,196,219,116,80,219,202,172,63,94,182,252,69,23,197,37,25,174,250,148,199,200,232,155,27,194,120,21,225,16,33,78,92,192,156,3,190,10,
+43,12,182,32,135,27,224,162,210,84,208,149,6,0,78,161,18,19,228,181,244,16,146,149,76,69,168,81,139,30,3,29,35,168,109,128,166,132,162,146,
+41,70,187,143,142,32,152,6,24,66,17,208,56,72,4,176,194,78,93,21,82,52,176,114,186,203,193,1,153,214,236,197,13,106,136,64,52,242,234,0,
+214,123,161,191,96,41,9,112,1,171,46,69,164,1,96,70,179,56,225,137,41,105,176,53,96,1,16,44,112,80,240,149,2,24,148,243,226,134,154,4,
+33,42,244,68,112,56,41,25,24,150,189,246,247,225,241,213,162,8,58,16,47,205,6,38,19,209,12,234,19,161,74,202,113,155,207,38,76,235,41,157,
+225,86,98,158,180,72,208,200,247,204,36,160,128,0,208,16,137,84,147,70,153,122,151,10,197,116,48,230,59,74,58,14,49,130,66,164,6,170,52,182,
+110,143,25,116,52,228,28,244,48,144,223,185,79,108,184,128,234,90,226,64,242,174,172,25,214,187,24,148,165,64,33,74,115,33,76,227,100,144,11,150,
+136,164,46,53,6,162,202,129,61,208,90,56,28,207,125,158,77,35,199,155,39,41,102,99,178,144,144,34,114,0,2,8,0,128,172,32,153,169,141,221,
+215,167,43,176,90,94,137,103,106,178,70,120,132,167,151,95,7,38,115,244,243,81,109,118,254,155,228,16,9,39,22,171,174,171,146,103,96,73,234,4,
+227,60,232,138,244,194,0,235,39,179,190,211,50,13,239,248,47,142,116,122,179,214,4,113,118,167,226,191,61,196,8,206,2,47,33,185,226,162,48,48,
+68,229,171,226,239,142,60,219,59,197,205,142,92,0,8,5,68,51,204,12,58,172,198,189,60,209,70,186,251,13,122,207,96,2,213,200,39,78,35,4,
+16,31,47,83,62,154,38,152,125,251,42,222,76,25,37,9,149,36,233,92,81,44,196,8,48,209,131,40,192,65,20,68,160,222,249,38,128,5,9,181,
+171,115,66,67,194,163,76,245,128,210,70,49,9,102,13,20,191,32,0,178,136,68,105,85,37,29,232,178,35,125,57,57,30,35,156,102,37,149,180,180,
+207,233,135,123,16,232,56,185,48,65,118,76,206,144,194,8,85,74,70,18,206,58,169,167,42,186,50,167,12,85,90,51,4,146,155,37,227,97,153,132,
+25,146,49,140,99,12,138,139,105,92,133,82,136,14,5,132,185,129,88,70,195,69,40,202,170,37,29,141,27,205,33,3,195,71,38,148,153,214,123,89,
+246,121,237,196,134,94,28,69,27,66,28,148,124,108,47,114,190,156,17,4,245,200,224,0,22,135,201,158,120,133,117,43,160,67,41,72,19,144,40,33,
+47,84,141,24,16,172,32,84,10,202,128,230,71,44,145,60,106,41,100,126,126,102,54,24,241,8,13,56,140,132,130,35,136,67,239,242,96,225,18,0,
+67,178,110,114,73,100,28,40,136,163,142,89,124,246,252,253,18,65,4,220,20,104,209,186,98,26,168,43,0,2,51,132,153,75,91,134,198,227,144,120,
+224,146,147,150,136,185,100,230,243,167,66,149,202,111,22,121,72,203,10,12,168,83,131,77,145,113,193,138,178,176,64,180,158,12,113,168,35,49,152,113,
+204,14,92,140,99,115,226,97,82,185,135,142,200,33,24,28,76,179,96,188,179,53,115,13,42,50,74,87,17,237,62,32,149,96,161,240,208,67,132,50,
+38,156,140,172,173,234,15,11,8,65,165,130,57,82,193,29,6,88,207,1,33,69,11,17,64,86,0,207,191,136,22,160,48,21,226,3,140,139,95,216,
+254,26,145,83,113,204,36,170,75,75,97,64,208,228,74,192,4,5,0,41,244,215,235,109,33,78,40,40,228,155,100,23,115,73,11,51,74,18,8,111,
+42,167,182,64,227,48,26,22,128,8,60,234,53,40,193,25,192,101,12,34,110,191,146,14,215,24,68,150,39,99,70,200,82,144,160,67,152,242,144,117,
+54,152,141,138,56,210,46,39,188,65,161,165,56,152,17,52,138,0,103,5,12,87,107,49,8,221,181,117,103,107,128,139,67,168,161,210,13,75,124,67,
+157,132,16,200,146,153,24,33,90,2,65,25,97,0,200,64,162,209,234,159,62,162,52,64,96,107,97,134,40,142,1,13,9,40,5,117,163,50,87,82,
+30,88,241,11,12,151,86,6,4,146,146,8,95,160,179,209,21,33,108,140,2,101,200,166,157,49,26,245,81,233,167,203,45,225,103,160,235,246,69,118,
+106,54,51,68,169,212,186,70,93,147,242,192,40,64,205,171,109,151,113,189,2,34,68,179,167,176,124,104,14,97,229,161,6,78,28,80,74,2,20,16,
+2,43,78,65,40,193,132,98,112,101,170,173,98,136,6,157,155,52,164,48,100,165,33,16,18,19,59,22,243,145,147,116,143,136,108,198,43,43,135,97,
+9,142,223,0,206,176,211,5,211,150,2,134,50,245,87,159,98,18,218,253,66,206,0,64,4,83,79,64,103,141,254,133,239,26,114,5,9,43,31,126,
+229,20,245,242,19,73,129,32,167,17,226,20,156,57,255,67,252,121,160,104,97,201,82,35,85,20,148,36,48,138,168,231,238,38,117,15,65,252,250,166,
+33,86,130,44,3,66,63,27,243,229,109,249,58,132,143,115,21,192,239,100,41,224,96,223,28,131,88,71,132,117,90,187,209,155,123,96,10,68,45,52,
+98,180,232,33,33,53,208,198,226,68,245,136,206,17,176,138,40,166,252,54,120,178,140,232,116,167,114,174,194,123,243,108,164,248,232,178,176,92,114,94,
+139,163,73,25,54,23,208,16,140,49,193,68,39,96,64,176,106,167,63,18,7,77,249,12,50,11,90,184,45,90,25,38,118,241,12,176,135,51,223,49,
+55,224,196,144,248,234,116,0,202,196,36,0,33,130,88,238,137,231,124,72,195,71,71,11,231,163,131,42,192,166,74,17,32,129,25,146,90,128,146,174,
+225,188,202,194,173,79,28,102,128,225,145,109,185,24,220,136,73,50,218,71,237,239,237,24,67,84,21,77,213,3,188,202,186,136,158,35,80,43,95,11,
+128,85,194,51,180,233,16,0,243,149,83,99,151,48,134,80,48,6,148,164,117,88,211,145,173,32,52,70,213,154,103,172,72,170,51,136,128,1,16,89,
+96,22,41,247,249,34,237,49,247,35,150,140,89,78,58,40,218,121,2,20,128,112,49,35,57,136,97,140,66,8,77,25,113,28,26,67,228,174,183,10,
+201,101,168,35,50,22,17,49,133,62,28,74,140,10,140,112,5,36,10,212,104,195,201,76,160,53,205,90,4,16,146,182,102,172,161,16,132,18,12,65,
+16,66,184,8,100,182,225,101,113,2,24,130,106,69,34,203,48,70,97,52,6,65,22,3,144,13,183,95,109,233,32,34,23,100,88,54,59,170,11,24,
+96,153,2,54,117,69,57,117,197,103,157,121,22,152,199,3,107,204,78,58,32,0,111,154,104,66,2,25,226,153,235,136,0,91,243,7,45,14,88,202,
+199,90,74,150,216,0,3,157,192,114,215,1,36,150,25,10,52,9,75,174,168,2,188,249,32,202,134,8,34,56,224,117,35,61,6,148,70,0,70,40,
+41,76,128,68,33,136,103,0,195,54,239,59,245,34,13,105,212,213,212,109,98,127,66,55,148,247,35,27,144,64,79,4,147,133,73,142,224,25,111,212,
+59,64,188,1,72,74,224,173,138,188,80,234,197,180,101,99,161,16,24,129,31,46,71,36,51,226,147,173,90,142,90,209,138,115,144,51,114,199,150,255,
+76,192,182,173,148,51,54,79,64,77,226,11,12,72,205,100,99,164,5,164,99,18,183,166,163,173,229,153,112,204,106,80,33,4,166,33,132,22,191,97,
+123,244,110,225,42,162,171,148,91,49,231,242,2,149,16,36,121,139,64,94,33,228,63,45,210,8,11,8,4,39,184,0,2,150,53,146,234,91,48,66,
+66,28,107,169,24,73,154,244,208,88,208,41,142,146,133,176,102,189,44,43,234,16,78,252,74,148,35,136,65,75,80,35,132,10,1,37,203,212,193,207,
+151,161,92,48,72,208,24,167,97,12,17,52,7,129,199,29,102,36,128,132,233,226,5,227,44,128,134,202,50,148,44,129,102,101,180,247,1,169,56,5,
+97,205,225,139,201,25,60,102,205,240,229,248,73,52,165,247,9,30,12,26,34,201,143,36,242,76,60,227,240,159,118,124,60,127,95,148,181,199,223,202,
+90,172,102,62,70,253,231,253,53,227,201,129,235,228,63,235,229,229,114,239,203,133,204,163,175,200,184,164,126,201,254,125,52,197,59,98,174,18,56,249,
+2,231,159,8,122,119,170,180,129,96,53,98,32,78,56,253,9,167,61,23,158,212,114,28,111,249,46,234,190,138,124,103,244,85,138,193,56,115,159,130,
+91,227,31,180,251,252,169,248,202,0,120,163,81,56,201,179,127,133,243,162,97,17,220,255,183,28,112,76,79,95,202,17,207,175,132,169,199,159,131,93,
+25,7,143,45,38,255,63,211,229,245,126,191,15,135,234,30,154,214,200,162,100,54,105,126,109,253,189,227,241,207,231,241,239,140,45,194,223,253,10,191,
+240,242,254,131,191,237,211,230,214,147,120,170,234,180,90,245,126,218,250,242,133,99,199,102,214,222,94,179,233,58,217,156,79,32,231,11,33,40,22,99,
+249,113,235,209,148,169,169,87,167,47,55,145,61,137,97,167,170,167,135,167,254,33,240,20,241,47,42,133,225,37,59,183,166,177,6,161,148,200,232,219,
+134,8,87,61,254,157,191,205,172,67,33,183,157,252,169,225,247,223,246,92,80,244,175,94,212,234,144,113,99,206,204,7,11,153,225,237,234,235,75,76,
+121,68,241,93,136,224,126,60,189,63,27,195,79,111,87,207,45,0,230,212,185,232,239,66,116,3,58,240,219,184,209,227,236,93,80,114,124,234,127,245,
+191,241,156,253,33,219,150,95,195,15,46,218,124,169,149,111,232,117,114,186,220,199,116,78,55,65,55,42,87,174,73,69,206,68,233,132,206,52,233,198,
+108,219,98,44,69,136,244,174,58,37,163,23,77,167,93,9,167,86,44,163,124,146,24,241,216,40,9,186,80,155,185,125,183,84,92,109,104,47,143,43,
+28,121,240,211,152,65,146,167,124,152,141,208,180,143,93,165,73,235,164,141,245,131,123,87,156,215,225,94,188,41,227,46,17,79,215,203,254,159,252,120,
+255,33,132,213,64,185,39,17,175,2,218,248,200,149,113,236,82,199,57,8,91,135,169,240,49,204,63,225,248,254,255,178,85,3,64,234,139,208,182,239,
+227,255,7,255,159,183,5,175,207,19,255,254,51,201,223,249,101,252,37,15,252,176,242,72,112,151,195,173,200,184,120,226,110,28,107,133,126,189,48,214,
+186,201,32,37,88,155,104,137,230,219,40,99,111,79,59,181,60,55,7,100,81,130,191,104,121,194,64,88,194,211,90,12,179,8,3,76,242,120,224,94,
+61,57,98,127,95,183,225,255,119,255,46,57,192,169,120,177,123,102,113,19,181,58,132,136,166,91,78,48,14,254,153,85,111,74,69,5,137,39,198,208,
+129,243,229,76,204,152,61,242,253,61,220,8,48,40,153,210,220,233,182,163,130,146,179,149,108,128,113,0,116,100,41,182,88,134,56,112,241,62,14,4,
+6,205,86,237,120,204,190,155,227,38,133,223,90,254,253,122,252,70,95,111,163,75,250,118,246,150,159,209,195,34,203,157,200,19,173,72,181,155,184,206,
+1,220,36,131,52,40,158,8,153,207,128,138,3,181,50,12,151,201,129,163,199,22,170,210,130,26,20,234,106,194,27,163,175,49,163,24,12,100,67,78,
+66,41,45,128,145,144,17,11,27,152,113,233,205,171,58,95,86,9,192,120,162,229,22,38,133,160,201,59,226,5,119,73,56,72,128,0,249,114,80,50,
+229,177,213,145,8,103,10,56,47,141,6,162,152,118,67,150,71,28,64,32,142,171,167,90,205,64,136,82,132,226,160,242,194,31,102,31,14,227,28,142,
+132,99,50,158,156,139,104,133,154,123,234,49,150,252,196,180,0,160,144,132,108,35,222,222,248,123,75,14,5,81,68,159,20,18,81,23,82,27,34,138,
+55,152,92,161,197,27,90,117,165,242,39,94,75,62,148,114,25,158,85,108,140,162,3,100,65,15,76,198,48,214,34,84,187,234,112,91,27,13,99,109,
+128,71,68,208,133,174,146,21,176,109,145,73,1,88,67,38,24,0,177,5,130,88,66,112,176,1,160,154,98,65,4,2,150,145,112,70,180,138,166,190,
+35,33,165,81,47,178,74,70,67,42,243,96,149,102,50,146,217,135,134,201,179,134,38,167,17,225,25,98,52,150,195,176,98,72,4,36,12,241,170,194,
+135,74,166,0,86,1,28,25,31,190,227,85,30,156,138,89,20,208,102,159,126,197,33,178,230,7,45,88,161,2,217,55,26,224,237,231,240,151,192,252,
+61,146,124,68,7,52,158,69,85,89,211,131,86,115,246,226,161,237,244,228,179,148,163,50,55,131,68,171,74,53,101,158,129,73,60,118,1,172,82,196,
+132,134,66,219,146,45,164,176,98,10,237,170,10,23,199,64,113,46,19,159,205,30,112,138,65,24,33,106,168,164,228,9,12,137,196,123,5,195,69,149,
+129,130,3,193,186,24,212,72,198,253,198,194,50,216,40,84,204,163,226,56,51,155,193,142,149,3,69,181,196,137,37,108,192,190,98,24,181,200,204,96,
+136,100,17,6,112,168,146,236,197,239,38,130,146,83,24,196,214,142,44,107,81,140,177,177,120,120,160,214,98,24,0,24,24,46,59,56,142,47,61,219,
+167,9,73,4,103,144,0,48,235,50,54,203,248,204,84,132,92,223,20,98,224,224,243,41,15,137,24,1,206,128,76,127,93,217,185,75,26,38,250,195,
+234,173,235,53,218,116,248,16,75,109,228,6,118,25,194,34,202,84,102,182,125,4,88,67,8,164,1,18,2,153,133,24,12,137,77,19,66,84,32,192,
+104,34,121,200,69,44,119,67,134,228,44,239,185,150,152,137,14,195,195,73,254,76,123,240,34,179,6,131,86,35,152,155,171,181,130,32,2,49,168,132,
+40,17,12,57,3,92,82,28,251,106,114,133,104,83,144,121,226,99,3,27,9,0,109,80,168,6,23,8,129,19,91,81,14,82,176,111,48,230,29,113,
+0,67,60,8,203,39,71,11,76,35,40,133,2,84,50,9,143,27,132,104,198,123,241,250,105,92,78,18,62,132,27,154,78,137,52,86,27,141,86,243,
+201,61,106,34,223,108,131,210,97,136,32,74,208,4,61,242,4,4,36,34,18,20,176,176,105,160,101,40,228,28,42,4,137,211,115,4,33,144,145,129,
+66,34,151,27,13,49,107,40,120,151,182,132,8,224,1,39,69,217,45,78,196,222,129,20,146,4,212,154,203,67,33,210,130,33,57,116,50,16,12,129,
+146,60,123,149,40,147,80,250,246,115,101,93,46,98,133,174,140,216,71,11,170,218,46,73,233,96,194,234,37,44,120,50,114,130,161,134,83,92,19,105,
+8,110,193,225,21,197,4,100,113,211,32,22,3,144,210,74,182,1,201,9,217,18,70,50,58,213,248,151,72,130,96,85,203,47,198,187,94,88,168,201,
+130,43,176,113,98,130,161,9,3,145,101,180,248,45,207,33,48,144,88,199,50,73,202,31,118,125,247,24,39,167,192,14,183,2,1,89,93,248,9,147,
+110,255,98,7,77,186,8,148,18,116,96,90,97,71,38,89,224,69,19,203,65,145,10,212,73,35,105,8,100,27,42,13,51,57,89,138,80,181,82,66,
+116,50,44,240,246,45,96,10,19,62,166,101,18,230,16,68,73,203,33,153,9,78,96,192,99,149,166,21,80,194,161,24,39,72,181,87,134,33,72,153,
+84,44,17,188,6,209,59,212,0,26,45,100,226,150,19,135,4,241,230,4,97,0,195,84,169,160,116,200,10,27,174,200,12,26,212,192,24,230,36,42,
+186,151,212,18,52,177,95,235,141,61,99,126,231,89,87,22,136,176,73,138,5,8,72,24,231,50,169,46,22,100,244,175,67,105,57,100,124,174,37,174,
+154,82,129,14,140,176,12,114,1,224,93,128,123,16,48,129,242,249,1,181,206,148,6,115,169,44,135,28,64,133,78,148,118,242,98,231,11,138,52,154,
+199,156,103,135,37,217,194,19,18,50,96,132,168,0,196,58,138,51,146,215,84,80,28,45,168,152,217,4,103,61,158,111,191,15,221,28,107,29,5,151,
+34,59,240,112,109,57,130,64,5,133,24,193,126,13,28,103,192,16,128,33,16,228,43,96,187,74,70,167,16,49,166,62,194,227,0,40,6,59,42,214,
+40,0,172,230,137,202,74,99,177,195,78,190,44,26,70,137,157,214,173,22,159,242,183,75,223,115,57,0,143,130,109,0,47,238,108,115,16,205,174,165,
+117,170,108,107,99,103,72,196,0,172,173,52,89,219,200,146,70,80,153,134,2,35,191,176,213,157,253,202,227,61,62,5,86,17,136,153,49,235,234,32,
+87,31,0,247,193,4,67,198,227,12,78,89,196,3,28,177,6,53,4,66,101,178,249,159,223,170,128,175,94,139,49,154,196,130,146,76,48,214,235,30,
+55,162,3,147,109,92,219,225,160,8,57,214,100,88,79,44,218,146,28,236,68,132,188,1,136,199,77,187,157,59,109,216,130,29,112,8,193,41,70,163,
+77,180,168,130,142,18,178,9,175,42,226,162,209,24,227,128,144,129,60,201,244,234,196,49,244,240,100,202,81,209,21,96,92,140,158,60,187,109,231,16,
+40,102,197,98,224,197,114,29,201,128,143,225,209,6,215,77,56,250,81,85,101,72,8,211,243,201,176,232,252,56,183,36,38,135,78,168,16,216,216,102,
+13,240,0,164,115,203,49,194,19,149,145,12,20,193,71,8,61,211,199,24,124,26,117,246,33,178,231,246,10,56,113,249,135,229,217,131,9,192,168,43,
+3,26,222,99,233,136,74,9,228,131,181,94,137,207,219,23,205,215,95,1,99,1,232,29,120,32,218,74,45,95,32,201,182,94,161,171,31,173,127,129,
+207,91,250,8,205,74,25,113,89,44,122,55,235,225,252,191,121,175,151,242,255,157,127,150,60,242,0,121,244,108,227,124,153,5,232,62,123,112,212,20,
+9,12,54,237,253,197,182,219,16,219,159,95,162,0,166,34,224,223,248,243,255,121,28,155,167,150,223,45,191,165,19,250,74,206,168,33,119,198,29,62,
+124,197,190,31,247,241,250,18,93,234,53,229,14,98,128,136,32,68,160,26,67,84,50,40,10,40,217,230,133,5,191,131,46,190,63,210,209,191,31,70,
+186,44,23,28,48,196,86,155,124,67,97,8,128,27,200,188,56,212,219,132,99,130,68,12,3,148,226,98,80,180,103,191,10,92,104,103,138,100,16,245,
+151,132,203,157,191,135,247,239,255,40,247,115,252,43,245,242,132,68,220,124,31,137,159,250,111,227,130,101,91,232,14,82,212,120,70,96,214,158,185,33,
+25,185,16,140,128,6,118,39,99,228,122,130,246,12,81,118,5,86,239,27,254,255,63,55,199,211,111,233,43,126,30,159,70,246,149,5,36,174,202,188,
+245,192,23,27,220,154,179,5,174,16,220,69,144,13,49,62,134,98,56,31,30,80,206,156,166,238,79,40,57,10,165,22,44,156,43,191,70,172,107,240,
+77,200,110,31,211,191,215,200,184,117,248,255,36,205,245,246,22,198,242,65,182,220,79,143,183,203,247,87,233,211,81,222,150,193,126,54,28,1,187,231,
+250,23,16,90,12,240,145,174,180,68,24,144,156,189,63,62,127,66,233,231,82,151,44,230,141,150,47,145,38,35,2,203,53,208,33,221,100,51,251,75,
+248,163,73,174,17,218,87,142,127,70,247,195,167,17,144,168,23,8,196,72,118,240,252,220,7,15,255,174,191,205,0,45,250,114,237,237,167,233,151,43,
+83,211,126,62,0,220,115,225,63,158,146,249,141,72,38,224,173,227,79,110,245,32,148,207,225,31,56,64,144,96,149,132,162,112,109,58,223,34,148,99,
+101,143,41,124,114,237,187,140,180,212,18,92,61,214,6,22,103,125,254,1,188,176,254,107,255,229,215,188,195,246,241,243,252,19,239,211,163,159,175,14,
+21,29,28,51,14,149,139,135,72,174,229,176,166,105,162,134,97,193,213,71,104,174,41,43,105,250,150,24,105,254,52,252,184,206,4,217,191,177,142,111,
+208,137,214,2,96,144,124,224,92,35,189,146,105,43,139,66,90,141,5,104,56,194,4,172,210,221,122,40,128,202,56,202,63,231,247,255,61,154,122,91,
+248,101,246,225,225,229,151,208,6,8,202,55,23,85,204,243,69,3,230,38,99,150,243,217,49,23,144,60,160,163,151,24,236,20,48,137,74,39,65,89,
+36,194,124,32,111,207,130,96,166,0,164,72,128,101,19,244,199,227,216,41,61,250,52,206,100,126,23,190,0,231,31,40,92,235,177,25,199,163,98,36,
+108,168,215,88,242,233,252,207,252,57,215,206,159,237,241,239,240,21,207,63,244,127,173,138,1,155,36,10,21,83,76,28,204,2,77,188,33,132,191,190,
+95,211,117,235,135,229,243,206,196,128,83,51,201,0,164,143,110,104,39,35,22,89,142,49,0,36,18,65,97,78,210,230,56,196,27,86,63,227,190,35,
+158,1,120,44,187,68,28,19,98,17,6,132,32,59,96,130,52,227,44,53,0,117,223,96,47,48,216,0,44,171,70,41,95,32,78,85,242,55,109,211,
+66,18,168,8,27,204,60,141,219,154,140,98,114,79,80,72,213,238,135,126,234,47,10,234,34,70,34,142,38,189,72,98,111,128,88,37,215,137,14,124,
+108,10,12,32,130,87,76,145,20,138,73,204,34,4,22,193,2,131,219,101,7,1,213,87,132,60,146,199,144,81,129,42,2,236,201,235,6,234,218,36,
+112,97,134,132,225,177,206,62,186,25,58,176,20,53,171,20,233,0,140,113,200,2,202,157,77,190,133,41,117,216,238,88,50,8,30,188,95,71,124,37,
+117,65,40,6,71,11,182,173,89,91,253,226,148,35,126,43,178,73,250,2,44,146,117,53,46,49,165,183,96,181,158,25,11,237,197,171,26,252,58,49,
+70,94,60,89,176,134,23,50,208,98,40,33,9,24,195,166,154,38,25,112,230,170,116,231,224,179,121,174,121,78,74,161,46,134,233,128,212,6,121,21,
+149,84,12,35,109,56,16,71,225,226,119,24,129,83,60,184,61,94,87,196,203,175,74,0,35,17,236,145,96,72,215,168,217,192,10,17,165,130,112,7,
+29,57,8,243,50,17,100,174,119,32,100,34,68,87,85,231,55,130,122,88,105,30,244,171,68,231,72,15,101,13,12,170,17,205,163,28,38,86,141,180,
+192,104,14,73,77,20,35,66,32,89,206,80,208,195,159,79,4,157,114,104,72,178,197,209,219,11,41,167,239,194,226,10,103,115,77,139,20,94,69,92,
+82,48,34,132,104,92,242,7,215,51,128,30,249,168,180,235,0,32,4,234,67,70,96,129,130,207,18,49,23,174,168,2,39,61,40,9,84,163,6,219,
+40,231,52,140,102,49,64,135,113,179,171,12,168,71,22,186,119,47,110,232,185,72,75,157,229,70,131,138,52,16,229,177,119,212,70,39,62,229,99,130,
+67,130,88,49,107,110,227,202,130,16,103,16,0,16,36,185,161,121,64,163,22,0,229,137,142,23,12,84,82,55,1,11,1,85,3,74,214,40,224,17,
+132,177,76,148,140,24,30,145,8,131,3,73,154,182,140,213,60,233,49,140,53,30,187,162,121,227,136,192,2,230,70,56,44,120,66,4,211,15,174,28,
+230,4,16,69,161,223,4,89,160,102,38,93,133,36,51,169,27,207,25,14,9,241,232,37,175,167,82,56,98,146,176,133,78,172,180,28,246,23,44,144,
+24,178,192,228,136,230,52,36,226,182,185,9,138,252,123,5,25,11,80,22,33,148,149,28,149,162,169,82,161,50,152,110,61,56,29,120,152,114,4,129,
+0,220,118,152,49,12,69,36,104,209,105,220,3,4,1,92,251,162,214,64,4,64,16,76,104,83,95,170,47,166,41,24,78,57,44,104,154,129,16,175,
+117,15,43,226,82,68,69,183,17,52,200,164,1,45,183,224,14,208,6,4,37,136,222,55,81,131,180,19,4,211,170,203,231,212,22,152,34,50,30,249,
+8,225,137,97,167,138,174,250,123,95,15,133,18,104,161,118,119,106,171,144,133,201,213,68,233,191,146,43,103,219,34,129,14,85,3,25,36,188,240,30,
+87,1,82,237,236,131,74,17,8,121,39,92,33,224,91,96,38,90,44,156,50,37,168,54,43,105,112,144,169,184,70,202,177,121,197,96,145,41,162,41,
+173,36,205,56,77,37,248,253,137,206,129,68,8,64,90,0,72,211,0,74,101,36,202,41,72,35,0,84,152,208,33,165,199,137,129,41,196,69,145,213,
+159,98,75,24,232,61,250,141,140,199,192,140,234,65,141,134,40,37,13,199,44,35,209,11,234,13,44,50,3,150,171,175,4,7,59,137,74,130,193,156,
+132,140,208,4,163,13,117,76,17,227,161,65,10,72,38,16,71,77,71,198,208,248,231,233,64,145,39,53,16,113,69,171,53,6,84,66,54,49,80,208,
+99,56,222,17,46,113,12,169,158,163,105,33,130,1,152,201,2,208,104,9,174,141,27,87,66,36,164,58,35,158,129,44,129,160,152,224,113,192,241,135,
+17,178,168,182,10,48,142,32,219,52,89,67,80,217,148,49,8,68,12,36,26,140,232,90,194,41,241,241,30,112,175,96,66,242,184,43,34,35,101,15,
+72,208,198,182,64,36,130,33,214,96,196,213,168,75,35,167,12,12,163,202,255,201,143,151,82,130,152,242,27,8,135,97,134,182,136,52,44,165,36,203,
+175,81,43,67,178,131,65,201,56,84,48,0,10,25,165,24,32,130,145,208,20,70,138,177,229,249,137,107,99,83,251,240,215,172,155,12,79,36,23,102,
+171,137,86,32,132,8,76,65,182,210,130,16,157,39,18,67,157,187,161,227,200,136,68,131,138,54,72,176,192,217,238,48,11,62,35,65,30,255,35,175,
+25,102,17,77,22,113,241,91,93,138,19,101,204,72,194,155,141,195,68,217,67,96,201,88,119,87,125,2,113,209,120,164,35,185,89,209,27,222,108,139,
+2,200,35,129,70,163,77,249,21,131,109,252,128,52,169,112,14,198,86,104,150,52,152,104,34,75,46,40,185,96,209,73,241,217,234,244,211,153,88,58,
+95,216,177,180,113,20,241,27,142,75,150,24,81,36,35,49,148,49,97,98,34,30,121,172,148,56,238,201,89,233,186,237,169,138,43,60,33,230,0,70,
+85,157,253,192,227,207,181,49,248,96,15,67,174,205,69,82,115,77,100,64,130,151,212,17,70,59,76,234,211,198,140,16,143,157,156,87,159,150,77,82,
+164,200,85,105,220,123,92,2,22,62,9,186,85,36,74,240,213,201,132,115,21,97,19,151,62,196,78,83,196,106,93,131,148,189,11,46,80,241,83,95,
+50,62,124,216,0,158,28,89,56,71,192,246,132,104,66,6,51,144,4,16,140,172,99,85,87,121,201,112,198,130,173,6,56,152,112,148,206,190,30,1,
+69,166,57,130,152,12,208,36,160,168,99,57,234,61,246,33,5,141,1,96,207,1,167,48,76,0,29,102,49,136,182,9,228,146,48,152,78,198,125,69,
+56,66,215,69,121,220,137,45,30,134,194,100,48,128,188,112,34,111,227,123,239,206,101,113,24,95,68,8,209,139,113,132,231,86,140,144,135,148,217,51,
+210,97,150,89,212,50,172,162,8,90,153,142,177,3,3,120,248,166,165,54,241,85,198,201,8,206,90,187,177,254,185,255,103,207,174,63,255,46,191,191,
+100,180,245,176,26,81,19,214,9,2,205,143,163,126,52,129,12,21,205,40,243,201,53,146,250,23,243,218,150,27,130,50,67,30,63,2,121,235,240,46,
+50,145,31,159,44,129,124,250,97,204,180,136,41,2,30,99,104,97,238,153,84,85,56,84,73,155,23,242,80,198,254,202,218,207,237,95,27,52,163,227,
+242,195,186,1,149,0,177,61,15,15,140,255,39,110,175,237,92,88,61,51,235,228,147,21,242,79,92,185,125,95,199,159,143,227,90,33,255,134,152,124,
+190,153,101,248,101,225,115,177,101,238,51,148,62,235,109,110,207,245,217,179,122,193,34,117,195,15,187,105,151,15,248,211,233,21,156,182,172,112,9,48,
+103,6,179,115,150,6,30,121,126,222,115,227,151,194,163,186,47,8,117,60,126,84,254,184,120,25,249,237,248,127,215,31,242,51,197,127,135,127,215,237,
+15,135,127,175,217,49,21,209,156,7,154,126,28,119,217,144,199,84,148,169,117,54,68,13,114,134,35,132,70,165,98,134,99,7,26,167,11,199,210,60,
+240,146,47,95,77,185,129,169,242,40,125,250,255,246,199,235,131,4,107,219,12,215,22,47,202,254,176,25,0,196,164,50,168,112,207,235,252,41,239,149,
+176,15,223,13,52,150,190,62,247,199,255,222,19,254,150,95,111,47,219,47,43,75,254,148,226,205,0,13,113,17,109,110,111,139,206,203,197,207,3,247,
+211,15,22,242,198,241,78,8,81,39,177,17,28,147,59,124,187,215,192,167,59,236,159,15,190,63,105,235,98,48,175,9,125,240,252,189,234,173,211,185,
+216,204,138,40,72,0,100,129,181,248,242,102,175,31,165,63,191,79,76,95,231,225,242,248,174,65,15,17,249,56,212,36,5,83,228,163,184,112,18,234,
+63,183,125,242,2,18,168,237,83,20,225,198,190,5,215,107,110,16,182,223,197,191,15,93,125,5,49,215,236,190,56,51,1,214,61,133,221,242,1,114,
+22,194,226,138,244,128,30,52,13,30,252,32,88,248,232,127,255,56,243,197,211,183,135,219,47,202,150,255,166,73,11,48,78,18,226,113,158,240,53,207,
+88,28,111,20,3,140,100,59,237,44,204,154,215,36,132,0,43,132,184,183,99,5,54,148,130,61,120,64,2,178,38,142,121,90,228,209,25,166,142,94,
+180,246,241,175,5,0,73,146,109,135,252,250,127,167,197,235,135,111,140,127,219,63,86,90,67,78,239,62,95,79,249,199,237,13,191,90,250,9,192,183,
+166,70,63,127,47,111,117,175,14,159,49,106,97,212,87,76,183,90,217,168,122,148,127,131,253,242,192,135,207,166,27,148,116,219,249,195,162,22,229,203,
+158,255,177,222,119,236,145,70,184,47,41,102,14,35,162,42,135,60,190,156,214,65,8,191,90,235,255,159,93,251,125,34,31,167,167,252,154,156,189,191,
+203,81,84,70,63,156,182,205,255,54,183,85,5,120,159,92,173,138,163,188,199,246,235,171,55,108,92,225,225,89,131,96,77,213,188,163,28,130,23,191,
+96,239,202,155,173,121,105,204,50,186,217,123,244,219,196,70,0,226,178,32,19,55,240,10,144,249,99,241,201,129,212,71,211,178,37,132,240,3,60,20,
+4,22,144,52,42,49,164,131,212,178,188,120,167,207,161,0,9,94,88,12,205,35,184,2,65,111,130,5,132,40,101,164,152,225,80,31,20,25,73,35,
+74,82,84,244,156,211,36,15,37,18,173,74,116,175,128,74,72,226,44,232,29,4,52,103,160,101,41,224,0,8,18,63,29,173,242,174,218,141,146,142,
+224,155,224,179,177,97,216,121,98,48,215,135,51,61,97,76,2,229,17,146,32,62,116,147,130,253,187,141,140,196,152,28,118,64,192,215,3,0,96,12,
+176,9,32,62,98,60,136,198,45,3,27,75,14,42,182,141,58,49,122,197,129,169,112,86,97,160,248,108,128,163,133,0,112,91,3,173,51,148,74,68,
+190,75,190,246,98,16,142,64,97,135,232,175,150,96,200,19,52,47,117,147,150,102,189,68,178,27,240,35,149,136,192,142,217,176,78,56,22,147,10,37,
+172,192,59,162,188,112,58,142,80,104,150,57,7,12,82,90,25,146,178,0,1,5,67,194,69,21,19,28,156,164,220,4,78,2,0,192,4,152,103,243,
+30,83,136,166,100,32,254,240,179,76,100,118,46,139,180,65,87,53,70,85,211,159,34,105,152,156,34,52,105,210,204,158,86,240,62,148,136,164,4,161,
+96,82,224,77,94,157,198,129,43,33,8,34,80,47,62,173,145,135,30,77,158,50,251,51,219,81,52,111,231,243,18,48,30,225,222,130,12,72,75,88,
+21,153,4,62,221,218,61,166,208,67,114,187,187,28,115,16,68,10,72,164,27,8,160,40,32,74,99,78,161,194,128,16,8,190,31,1,101,1,212,82,
+204,74,196,85,17,71,191,33,167,76,253,209,109,32,28,45,182,98,172,238,92,56,136,103,199,64,43,130,70,141,234,84,166,177,241,200,3,173,122,129,
+40,131,0,99,68,81,132,144,89,194,38,34,8,64,209,11,50,248,241,65,142,191,173,178,140,82,72,207,67,21,217,130,104,56,22,92,3,30,23,248,
+169,239,184,151,174,149,2,177,26,115,148,96,8,4,0,52,176,0,97,33,208,3,26,231,210,0,112,62,124,8,206,134,64,104,204,37,146,100,129,225,
+152,162,104,16,82,176,13,17,20,7,129,108,25,78,124,193,133,111,238,63,108,72,216,90,92,105,85,138,16,164,130,16,10,65,140,41,68,139,42,64,
+96,5,65,91,8,145,149,200,149,16,8,222,89,176,40,156,238,176,162,105,157,24,102,9,78,124,75,182,64,56,109,32,90,160,216,9,86,252,66,165,
+8,8,2,152,115,16,233,108,2,80,133,120,178,52,166,19,31,12,130,186,185,102,37,153,109,240,55,246,141,124,239,223,224,216,185,188,85,93,161,82,
+110,200,213,240,248,178,107,110,27,36,243,128,199,40,219,199,82,158,220,57,25,148,132,48,18,51,0,164,9,156,103,136,142,52,238,170,113,141,142,40,
+177,217,171,25,76,96,4,228,35,43,8,164,179,122,104,1,150,41,220,201,69,18,215,97,121,106,129,69,174,72,171,6,168,222,85,115,82,113,129,201,
+10,2,202,227,160,211,83,45,71,142,39,60,75,129,11,42,226,16,200,197,156,163,20,8,140,129,8,64,67,99,155,252,171,199,38,106,249,254,150,249,
+163,73,186,181,36,149,92,246,110,184,112,220,107,110,157,103,180,231,224,219,130,236,91,202,70,92,53,231,180,54,199,91,36,141,112,143,62,186,254,122,
+255,126,84,76,63,244,70,254,27,127,192,173,146,114,120,115,44,51,142,98,53,94,99,78,49,18,151,140,208,235,210,219,159,95,108,51,88,240,145,174,
+190,22,226,153,1,137,36,99,237,57,161,148,187,119,140,114,244,243,139,37,183,11,0,56,48,150,39,233,174,168,63,13,252,125,139,190,25,69,222,86,
+81,130,54,165,228,241,115,229,141,126,1,220,35,128,206,80,204,36,161,22,248,120,213,27,76,95,37,207,149,188,211,3,30,178,242,198,109,14,220,221,
+194,144,11,95,215,233,135,120,112,254,123,255,240,80,252,245,255,229,227,252,127,8,123,219,10,23,231,135,41,142,139,14,47,228,175,113,251,57,124,79,
+216,155,113,208,130,163,107,151,251,239,253,86,181,111,15,211,244,180,54,255,79,252,63,56,127,32,135,80,244,247,222,65,195,235,243,224,49,139,220,241,
+104,110,3,90,251,4,204,224,66,130,97,37,14,209,239,218,21,17,218,29,240,237,222,54,3,128,50,128,10,44,114,148,68,212,18,20,235,94,145,138,
+4,150,250,39,88,105,204,54,49,36,202,184,209,52,154,146,112,199,61,134,176,41,7,57,67,154,123,85,238,76,10,76,194,106,89,113,215,236,110,231,
+0,97,30,176,240,18,205,36,36,75,159,11,1,248,236,130,24,229,12,69,90,21,17,16,192,202,166,133,97,11,162,16,34,66,167,65,88,14,19,189,
+19,101,93,223,227,231,245,205,108,135,248,91,248,97,15,246,211,242,54,144,140,32,177,247,163,85,122,173,72,222,39,17,231,107,110,36,137,222,94,213,
+44,83,32,9,165,32,157,225,246,204,119,132,178,74,177,94,56,74,154,207,129,166,235,232,241,37,40,122,127,89,253,148,241,143,149,124,250,75,122,90,
+39,52,160,132,167,175,70,211,31,95,240,135,241,130,118,135,56,34,140,242,182,107,92,185,127,16,246,136,76,169,142,191,3,227,67,244,127,91,49,18,
+59,147,109,231,215,250,46,114,58,3,77,100,219,117,199,229,31,159,134,26,172,244,67,126,58,64,5,241,199,255,151,143,248,248,83,133,122,246,134,96,
+254,16,12,126,126,212,249,119,253,254,146,154,22,144,249,198,191,174,63,252,249,116,152,252,60,189,190,24,116,242,250,97,39,194,221,227,240,227,142,33,
+237,248,254,123,13,74,223,205,116,52,245,79,135,93,82,93,187,241,250,6,54,150,104,157,59,127,49,127,14,27,136,217,177,44,8,51,72,83,15,171,
+109,172,250,67,15,174,191,160,182,177,228,239,48,176,184,140,88,36,157,101,147,148,23,60,155,74,239,192,179,182,151,36,68,136,128,12,19,92,56,125,
+215,4,20,13,96,198,46,204,9,112,61,145,222,172,92,170,172,10,117,236,15,8,111,14,211,168,5,166,250,29,217,55,70,128,115,79,14,179,200,180,
+231,60,12,4,96,144,83,33,60,145,41,163,143,83,178,161,202,54,18,51,26,252,109,195,74,124,6,38,133,123,149,23,36,12,147,54,243,224,89,97,
+24,26,154,70,200,214,146,231,145,68,62,151,42,48,204,83,156,155,45,141,70,144,99,40,156,3,160,53,28,145,128,136,50,143,142,201,51,130,69,43,
+89,53,78,113,163,21,241,216,51,36,230,0,206,54,0,39,8,132,67,150,32,182,70,103,35,44,103,76,87,52,103,32,228,68,102,0,130,49,13,195,
+148,75,228,39,141,204,32,140,180,132,96,32,100,38,251,49,111,8,38,193,156,236,101,28,161,204,48,233,103,201,183,63,33,116,224,162,146,227,226,205,
+235,45,8,85,97,98,79,17,97,32,108,94,220,78,156,128,145,155,217,205,157,50,16,65,45,71,122,140,97,26,83,131,47,111,45,179,8,61,146,81,
+53,223,22,42,236,216,112,4,204,121,222,53,136,125,176,69,104,225,9,30,50,36,178,131,35,233,153,15,64,150,14,72,91,57,60,216,113,226,0,88,
+130,23,94,140,13,78,90,28,113,182,72,48,130,129,140,69,40,3,65,107,145,2,94,25,144,17,157,4,57,2,98,111,131,129,36,202,201,150,82,1,
+193,68,100,3,149,158,75,41,73,17,102,21,196,4,78,28,209,211,16,138,64,4,48,162,109,99,216,148,132,34,52,21,150,68,50,176,84,210,144,50,
+36,164,18,146,184,129,12,10,156,65,0,64,1,4,174,61,115,59,25,144,99,107,103,86,89,242,23,13,12,48,37,161,143,35,158,61,5,158,34,74,
+218,243,199,222,16,0,191,83,32,201,23,204,69,80,171,150,112,136,105,165,3,149,111,24,225,24,43,77,82,207,1,2,18,97,63,98,83,8,236,25,
+108,6,50,7,128,216,208,59,133,134,42,177,142,131,152,226,8,8,1,199,36,77,33,222,222,1,54,57,246,14,17,47,66,242,176,140,19,41,135,96,
+193,124,254,33,22,184,98,118,43,225,160,112,196,167,152,64,17,205,131,150,95,1,218,50,140,214,44,29,119,106,180,177,46,186,136,145,0,98,166,109,
+27,82,4,50,65,97,52,62,69,121,84,73,9,58,20,96,90,229,4,52,221,131,222,47,20,163,188,26,163,59,200,194,50,241,177,33,128,15,114,14,
+0,168,200,28,172,52,132,117,50,224,3,183,215,225,135,174,133,54,110,237,153,35,209,241,1,28,193,59,199,201,30,209,13,147,244,212,44,164,19,79,
+173,150,101,62,102,202,49,245,101,235,236,146,18,25,33,177,33,104,54,36,35,10,226,137,96,82,237,136,90,39,141,6,81,206,209,104,158,93,5,188,
+35,196,24,206,90,7,9,12,114,64,3,78,48,192,43,23,203,130,3,128,232,25,8,67,150,97,215,51,161,26,240,81,229,131,118,120,245,21,34,24,
+200,153,9,157,151,99,45,69,72,203,145,182,184,17,36,96,0,141,21,224,232,167,94,99,41,182,184,150,54,122,4,56,237,241,35,203,35,36,30,17,
+175,113,19,110,29,8,116,49,160,211,83,46,34,45,200,57,101,201,131,8,130,231,86,110,44,237,241,203,174,251,123,135,143,221,201,36,156,81,69,116,
+93,154,97,212,189,36,5,144,241,189,177,30,244,6,177,215,143,165,63,20,164,131,235,167,165,194,240,131,48,140,116,72,62,62,208,248,218,153,15,231,
+203,219,168,237,60,112,107,140,250,75,48,56,135,37,57,157,9,62,175,249,22,159,152,165,180,238,63,77,103,34,43,235,252,11,53,86,68,48,34,203,
+125,126,203,199,41,77,231,68,128,56,186,1,210,25,139,59,156,188,57,206,112,148,32,175,227,229,72,141,120,54,244,219,119,224,155,125,103,250,99,227,
+201,2,58,242,41,164,8,255,143,167,203,152,235,2,98,44,251,254,16,173,113,237,33,119,232,61,114,194,100,27,109,152,239,166,159,142,191,231,28,126,
+33,111,78,159,107,114,254,95,10,74,157,50,37,140,222,151,247,96,140,245,172,234,27,121,213,3,78,248,232,73,80,224,37,119,202,24,57,132,52,168,
+107,195,203,173,116,11,106,113,203,146,159,207,44,162,32,73,83,254,30,255,191,251,67,213,235,242,167,187,38,101,217,94,32,251,112,226,134,192,170,212,
+219,169,160,191,64,154,223,216,126,126,153,102,185,229,167,118,244,235,54,12,124,186,127,157,58,85,124,240,255,15,190,190,69,27,191,37,215,195,15,54,
+131,22,164,90,83,17,27,21,39,207,132,174,102,5,59,118,251,189,37,134,239,165,119,216,173,61,72,56,86,118,0,120,240,132,171,20,151,8,227,66,
+209,91,120,227,249,252,252,212,168,159,202,214,251,116,255,149,11,134,72,146,117,170,150,250,237,95,189,3,155,205,155,172,93,16,196,20,88,32,35,0,
+142,204,1,39,92,137,38,125,43,174,148,18,83,92,157,226,29,39,199,147,92,231,164,138,252,232,31,135,95,126,208,75,239,228,222,250,105,136,132,173,
+170,90,113,224,154,119,239,249,22,164,58,7,88,36,1,200,160,122,210,149,26,240,229,252,219,176,55,238,223,219,189,65,60,190,125,127,202,60,242,109,
+183,255,207,255,151,211,249,164,122,75,205,48,82,40,120,120,204,90,74,119,151,167,187,138,65,10,160,244,77,211,43,158,124,191,15,235,124,169,195,115,
+100,45,147,215,10,114,15,215,135,166,35,222,171,255,247,197,41,35,135,255,38,135,242,219,252,2,27,67,134,56,187,114,239,196,207,155,204,3,119,158,
+85,253,251,80,35,251,246,202,15,223,211,78,164,190,27,126,116,252,184,174,139,174,210,164,111,106,28,110,141,240,191,141,153,70,253,37,243,147,80,190,
+187,125,61,227,233,91,153,237,25,216,107,11,2,249,225,160,20,20,64,100,218,126,175,255,45,103,168,122,94,57,7,207,150,220,65,145,53,15,10,174,
+101,225,153,176,10,199,2,23,156,137,0,93,32,44,164,198,244,12,47,18,106,9,17,231,165,59,132,121,97,241,74,24,169,35,185,145,229,78,34,232,
+156,35,199,70,130,239,201,32,5,137,254,19,188,7,167,159,127,235,191,205,22,205,233,211,167,246,194,159,47,208,97,64,8,138,68,185,171,206,188,85,
+43,157,3,136,78,3,215,40,24,92,15,38,225,231,191,236,36,107,193,245,240,194,96,49,95,210,121,153,216,204,12,7,76,79,40,250,246,131,141,242,
+100,103,89,9,67,14,156,56,29,88,27,145,88,76,128,24,9,175,99,33,3,104,32,146,80,10,133,172,196,104,147,17,14,121,244,3,44,16,74,28,
+11,38,81,92,2,44,101,16,136,20,137,214,147,100,109,112,160,158,20,51,131,44,179,24,9,78,5,223,117,92,106,217,73,109,101,146,173,129,73,2,
+80,141,68,72,192,17,224,109,176,27,36,124,60,211,112,186,72,145,231,179,162,81,148,81,125,55,227,60,41,21,152,56,160,87,117,92,141,86,71,77,
+189,58,161,149,96,132,169,89,107,0,231,4,84,225,168,41,1,6,92,58,179,118,131,100,107,74,62,14,189,191,16,175,81,115,5,229,4,130,20,43,
+192,24,212,2,140,200,70,113,102,149,38,18,22,150,4,164,3,151,175,84,16,133,49,35,91,178,66,19,152,134,19,72,195,134,3,89,214,221,72,163,
+206,223,178,186,101,47,209,191,191,152,200,175,79,152,218,221,4,33,34,34,202,123,6,72,64,195,166,96,70,36,226,21,104,29,128,123,99,244,7,10,
+95,208,30,27,166,180,43,186,79,57,181,20,153,69,82,194,177,32,229,48,91,19,163,27,116,89,239,101,193,13,0,42,75,0,0,129,93,30,16,143,
+203,95,167,0,145,21,156,85,59,39,99,157,66,32,56,76,219,232,36,112,214,51,186,90,74,7,174,60,132,202,21,204,132,157,34,38,73,214,101,69,
+12,186,4,50,16,67,143,86,207,104,187,176,211,65,166,158,56,2,184,157,194,13,131,54,115,108,215,45,194,8,136,144,66,228,52,35,97,8,17,156,
+243,14,27,29,72,1,17,35,20,73,1,10,184,140,3,195,17,18,86,176,128,18,196,40,228,193,202,158,195,130,242,184,109,220,109,166,52,96,224,158,
+120,140,17,157,4,48,21,24,40,76,52,16,169,91,25,131,13,224,87,38,123,247,39,40,139,204,189,243,69,8,229,136,136,8,82,57,130,211,8,70,
+169,233,10,49,83,15,18,237,64,54,227,249,92,0,24,127,38,33,58,111,139,17,29,17,194,17,157,132,222,89,232,4,243,239,204,235,215,167,97,57,
+100,155,43,114,37,245,16,79,134,96,38,75,177,142,64,24,230,128,169,184,88,224,66,2,212,21,195,132,1,184,186,236,193,225,54,69,51,148,4,145,
+216,70,136,32,235,86,170,227,204,16,172,230,18,28,206,85,113,60,49,178,203,83,17,42,165,176,187,53,165,57,170,181,50,20,102,8,196,3,150,162,
+141,165,200,214,152,46,0,90,58,33,142,6,25,47,48,38,1,167,26,8,160,144,32,24,6,198,166,225,101,64,128,6,70,152,0,51,182,96,128,161,
+106,49,97,175,128,16,133,58,135,150,104,42,94,120,141,128,48,148,121,231,225,195,142,162,43,68,156,145,77,193,54,132,100,156,243,17,24,97,161,248,
+218,188,81,235,48,22,80,202,113,137,210,148,166,80,192,49,14,224,86,233,35,19,142,121,12,48,17,0,141,144,36,83,53,96,0,136,131,23,108,72,
+136,48,128,64,33,76,204,164,200,113,94,35,20,121,143,227,221,81,79,134,0,84,38,70,220,129,174,101,99,69,75,43,134,82,158,135,240,242,81,218,
+204,5,28,32,70,67,10,83,8,134,58,177,114,199,83,38,164,230,0,134,30,12,60,250,153,101,189,191,20,30,155,176,70,89,114,118,126,23,243,4,
+83,151,130,90,84,48,161,83,133,131,9,193,163,95,15,200,14,85,11,136,255,47,38,108,33,49,1,16,18,32,228,45,36,86,85,235,199,127,42,187,
+156,206,105,176,108,200,218,60,129,85,100,117,177,240,79,198,129,202,83,74,209,20,156,52,247,4,219,95,162,60,121,156,243,10,148,244,1,215,151,1,
+227,136,81,38,90,130,214,56,64,9,233,168,142,56,214,8,10,83,142,106,116,253,74,241,152,59,3,227,201,102,176,110,182,24,132,135,195,48,26,232,
+158,40,37,135,112,14,146,224,29,48,26,82,40,225,112,193,43,226,51,14,90,81,113,193,133,154,173,77,3,42,71,114,235,80,164,8,146,0,17,19,
+150,130,51,9,116,37,162,21,144,219,18,2,84,200,136,70,155,13,211,68,65,29,50,89,172,117,44,224,33,80,68,15,77,153,47,41,20,99,1,32,
+21,130,58,198,151,239,195,126,146,81,68,24,166,243,69,36,209,114,26,40,76,18,3,9,198,146,101,4,220,179,128,153,54,210,192,41,229,97,99,113,
+2,22,204,101,128,117,34,51,57,39,36,24,43,28,44,161,163,96,14,64,44,74,96,173,48,144,24,35,190,195,12,112,226,14,20,10,66,70,52,230,
+23,78,44,155,198,168,42,240,131,201,92,176,2,2,134,116,96,11,189,44,241,53,28,100,234,206,242,1,130,38,49,72,39,113,171,130,117,160,17,52,
+160,8,2,67,169,197,42,213,101,105,200,150,148,117,0,152,87,208,149,157,50,21,102,10,6,24,193,226,175,92,129,96,195,9,230,74,98,35,221,22,
+147,178,76,92,165,217,11,236,16,97,175,192,129,198,180,31,190,220,239,74,230,87,201,35,174,197,116,156,72,99,65,16,197,132,102,141,162,29,51,166,
+48,85,73,210,17,61,57,147,195,162,9,196,131,43,199,103,201,207,27,157,147,92,187,137,35,75,74,179,86,121,0,21,151,51,243,236,119,124,211,40,
+90,84,232,195,65,210,195,52,247,245,34,240,63,33,39,80,6,85,197,131,88,244,67,12,68,17,82,192,53,12,89,166,142,91,4,39,164,40,170,120,
+96,9,70,156,5,141,4,56,201,4,158,118,114,20,221,108,232,181,176,25,15,91,8,54,8,135,166,101,28,55,228,81,206,208,131,116,250,98,53,208,
+237,217,5,161,74,5,116,57,108,34,169,233,250,38,206,84,144,25,18,57,195,228,195,175,115,153,77,182,11,198,216,125,171,115,129,209,23,160,64,242,
+51,20,217,167,8,144,204,97,131,14,93,7,210,3,105,56,86,120,135,88,0,65,173,0,168,176,173,124,67,122,0,83,72,148,149,21,65,39,121,172,
+2,48,152,78,13,79,180,1,200,81,210,126,72,239,98,46,134,116,142,193,10,49,160,206,120,18,164,24,153,226,201,58,79,38,46,52,230,72,66,52,
+20,16,6,146,33,8,83,233,168,13,17,20,13,174,52,64,148,65,65,160,166,22,6,0,42,49,8,2,112,86,2,204,58,224,20,66,36,239,160,6,
+41,68,2,177,156,106,152,74,156,96,8,242,38,92,100,148,158,186,67,82,164,66,9,135,24,217,37,130,126,252,62,92,66,5,43,190,62,127,191,140,
+235,134,76,223,249,114,251,5,191,249,68,52,99,36,144,252,214,164,229,190,51,56,152,122,167,109,243,144,105,207,143,193,161,138,197,61,140,252,240,255,
+47,199,159,193,178,227,60,165,195,172,104,51,202,141,127,191,211,71,175,227,246,192,222,174,127,105,247,65,98,237,241,158,84,183,85,208,85,11,67,196,
+151,148,102,201,92,58,121,197,118,240,245,48,38,97,223,9,0,205,165,17,187,82,98,201,12,194,104,61,130,171,125,4,209,162,94,29,115,246,29,118,
+134,34,205,47,22,200,18,34,176,69,90,218,85,18,115,128,43,67,54,229,189,74,29,59,215,6,105,158,134,114,104,145,50,72,231,2,14,191,126,247,
+254,228,191,108,190,153,114,250,75,240,219,219,8,113,211,151,197,208,11,198,39,91,132,99,92,250,7,204,136,202,100,145,44,163,159,32,17,60,145,34,
+3,78,152,239,224,29,123,101,196,152,6,203,189,153,13,57,231,254,145,250,201,254,87,235,146,76,227,149,6,189,236,223,149,255,30,18,20,91,75,48,
+60,165,239,135,166,102,164,140,92,225,2,89,181,55,61,138,93,215,254,30,127,94,64,48,203,204,82,88,119,31,150,55,154,125,58,249,251,1,140,21,
+43,225,225,235,30,190,29,179,44,101,76,81,130,26,145,67,15,116,131,168,75,229,249,249,253,131,78,56,240,4,172,114,74,201,170,69,148,55,106,50,
+10,163,167,77,126,123,215,249,193,144,189,178,237,165,62,82,219,164,175,78,223,23,50,11,186,198,98,245,20,168,182,56,236,142,247,96,209,192,16,209,
+89,40,96,161,144,167,20,248,107,60,14,74,21,45,157,208,218,107,98,40,188,0,20,224,48,155,200,77,5,134,56,33,140,248,39,188,188,46,32,208,
+169,224,1,21,161,184,51,162,24,24,33,20,74,10,70,81,200,181,70,128,78,4,96,236,64,34,134,192,0,32,72,160,194,176,71,2,16,22,50,7,
+8,40,48,78,8,98,65,9,177,192,197,0,65,4,88,208,80,193,0,200,80,64,77,0,9,8,132,
+        };
+    }
+
+    const std::array<AllWaveTable::Carrier, AllWaveTable::numCarriers> AllWaveTable::carriers{ {
+        { "Saw", "tableSaw", tableSaw, sizeof(tableSaw), tableSampleRate },
+        { "Hyper Family Chord", "tableHyperFamilyCHRDAlvaJay", tableHyperFamilyCHRDAlvaJay, sizeof(tableHyperFamilyCHRDAlvaJay), tableSampleRate }
+    } };
+
+    static_assert(AllWaveTable::numCarriers == 2, "WaveTable.cpp and WaveTableSize.h are from different CarrierAssetTool runs");
+}
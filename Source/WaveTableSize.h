@@ -0,0 +1,16 @@
+/*
+  ==============================================================================
+
+    WaveTableSize.h
+    Written by CarrierAssetTool with WaveTable.cpp, edit the tool's command line rather than this file.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace WaveTable
+{
+    /** The number of carriers defined in WaveTable.cpp. */
+    enum { generatedNumCarriers = 2 };
+}